@@ -78,6 +78,8 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+// SumatraPDF: for INT_MAX outside of MSVC
+#include <limits.h>
 #include <string.h>
 #include <math.h>
 #include "MMX.h"
@@ -68,13 +68,13 @@ void fz_var_imp(void *);
 
 int fz_push_try(fz_error_context *ex);
 /* SumatraPDF: add filename and line number to errors and warnings */
-#define fz_throw(CTX, ERRCODE, MSG, ...) fz_throw_imp(CTX, __FILE__, __LINE__, ERRCODE, MSG, __VA_ARGS__)
+#define fz_throw(CTX, ERRCODE, ...) fz_throw_imp(CTX, __FILE__, __LINE__, ERRCODE, __VA_ARGS__)
 FZ_NORETURN void fz_throw_imp(fz_context *ctx, char *file, int line, int errcode, const char *fmt, ...) __printflike(5, 6);
 FZ_NORETURN void fz_rethrow(fz_context *);
 /* SumatraPDF: add filename and line number to errors and warnings */
-#define fz_rethrow_message(CTX, MSG, ...) fz_rethrow_message_imp(CTX, __FILE__, __LINE__, MSG, __VA_ARGS__)
+#define fz_rethrow_message(CTX, ...) fz_rethrow_message_imp(CTX, __FILE__, __LINE__, __VA_ARGS__)
 FZ_NORETURN void fz_rethrow_message_imp(fz_context *, char *file, int line, const char *, ...)  __printflike(4, 5);
-#define fz_warn(CTX, MSG, ...) fz_warn_imp(CTX, __FILE__, __LINE__, MSG, __VA_ARGS__)
+#define fz_warn(CTX, ...) fz_warn_imp(CTX, __FILE__, __LINE__, __VA_ARGS__)
 void fz_warn_imp(fz_context *ctx, char *file, int line, const char *fmt, ...) __printflike(4, 5);
 const char *fz_caught_message(fz_context *ctx);
 int fz_caught(fz_context *ctx);
@@ -205,6 +205,49 @@ int fz_aa_level(fz_context *ctx);
 */
 void fz_set_aa_level(fz_context *ctx, int bits);
 
+/*
+	SumatraPDF: fz_scan_converter: Get the way filled paths are
+	anti-aliased (one of FZ_SCAN_CONVERT_*).
+*/
+enum { FZ_SCAN_CONVERT_SAMPLED, FZ_SCAN_CONVERT_ANALYTIC };
+
+int fz_scan_converter(fz_context *ctx);
+
+/*
+	SumatraPDF: fz_set_scan_converter: Choose how filled paths are
+	anti-aliased. FZ_SCAN_CONVERT_SAMPLED (the default) counts the
+	covered points of a sub-pixel grid whose size depends on the aa
+	level. FZ_SCAN_CONVERT_ANALYTIC computes the exact area of each
+	pixel covered by a path instead (for any aa level above 0), which
+	takes a single pass per row. Cloned contexts inherit the choice.
+*/
+void fz_set_scan_converter(fz_context *ctx, int converter);
+
+/*
+	SumatraPDF: fz_simd_level: Get the instruction set used by the
+	paint functions for RGB(A) pixmaps and by the image scaler. By
+	default this is the best one the CPU supports.
+*/
+enum { FZ_SIMD_NONE, FZ_SIMD_SSE2, FZ_SIMD_AVX2 };
+
+int fz_simd_level(void);
+
+/*
+	SumatraPDF: fz_set_simd_level: Limit the paint functions and the
+	image scaler to the given instruction set (e.g. for comparing
+	results or speed). This applies to all contexts and must not be
+	called while rendering. Returns the level actually used, which is
+	clamped to what the CPU supports.
+*/
+int fz_set_simd_level(int level);
+
+/*
+	SumatraPDF: fz_init_simd_level: Detect the instruction set the
+	CPU supports. Called by fz_new_context, so that the first context
+	should be created before any other thread renders.
+*/
+void fz_init_simd_level(void);
+
 /*
 	Locking functions
 
@@ -88,4 +88,14 @@ fz_display_list *fz_keep_display_list(fz_context *ctx, fz_display_list *list);
 */
 void fz_drop_display_list(fz_context *ctx, fz_display_list *list);
 
+/*
+	SumatraPDF: fz_display_list_size: Determine the amount of memory
+	kept alive by a display list: its nodes and the paths, texts and
+	stroke states they own, as well as the (compressed) data of the
+	images and shadings they reference.
+
+	Does not throw exceptions.
+*/
+size_t fz_display_list_size(fz_context *ctx, fz_display_list *list);
+
 #endif
@@ -103,6 +103,36 @@ fz_pixmap *fz_new_pixmap_with_data(fz_context *ctx, fz_colorspace *colorspace, i
 */
 fz_pixmap *fz_new_pixmap_with_bbox_and_data(fz_context *ctx, fz_colorspace *colorspace, const fz_irect *rect, unsigned char *samples);
 
+/*
+	SumatraPDF: fz_pixmap_allocator: Lets an application provide the
+	memory for a pixmap's samples, so that e.g. the draw device can
+	render straight into a bitmap which is then handed on without
+	copying.
+
+	alloc: Returns a block of h rows of w * n bytes (without padding)
+	or NULL, in which case the samples are allocated as usual.
+
+	release: Called with the block returned by alloc when the pixmap
+	is freed. May be NULL if the application keeps ownership.
+
+	opaque: Passed to both alloc and release.
+*/
+typedef struct fz_pixmap_allocator_s fz_pixmap_allocator;
+
+struct fz_pixmap_allocator_s
+{
+	unsigned char *(*alloc)(fz_context *ctx, void *opaque, int w, int h, int n);
+	void (*release)(fz_context *ctx, void *opaque, unsigned char *samples);
+	void *opaque;
+};
+
+/*
+	SumatraPDF: fz_new_pixmap_with_bbox_and_allocator: Create a pixmap
+	of a given size and location, with the samples allocated through
+	allocator (see fz_pixmap_allocator). allocator may be NULL.
+*/
+fz_pixmap *fz_new_pixmap_with_bbox_and_allocator(fz_context *ctx, fz_colorspace *colorspace, const fz_irect *rect, const fz_pixmap_allocator *allocator);
+
 /*
 	fz_keep_pixmap: Take a reference to a pixmap.
 
@@ -269,6 +299,9 @@ void fz_convert_pixmap(fz_context *ctx, fz_pixmap *dst, fz_pixmap *src);
 	buffer for pixel data through fz_new_pixmap_with_bbox_and_data.
 	If not zero the buffer will be freed when fz_drop_pixmap is
 	called for the pixmap.
+
+	release_samples, release_opaque: SumatraPDF: set for pixmaps
+	created through fz_new_pixmap_with_bbox_and_allocator.
 */
 struct fz_pixmap_s
 {
@@ -279,6 +312,8 @@ struct fz_pixmap_s
 	fz_colorspace *colorspace;
 	unsigned char *samples;
 	int free_samples;
+	void (*release_samples)(fz_context *ctx, void *opaque, unsigned char *samples);
+	void *release_opaque;
 };
 
 void fz_free_pixmap_imp(fz_context *ctx, fz_storable *pix);
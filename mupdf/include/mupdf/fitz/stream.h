@@ -41,6 +41,33 @@ fz_stream *fz_open_file_progressive(fz_context *ctx, const char *filename, int b
 */
 fz_stream *fz_open_file_w(fz_context *ctx, const wchar_t *filename);
 
+/*
+	SumatraPDF: fz_open_file_mapped: Map the named file into memory and
+	wrap it in a stream.
+
+	The whole file is the stream's buffer, so reading and seeking don't
+	copy any data nor call into the OS (pages are loaded on first access
+	instead). The stream can be cloned without copying the data.
+
+	Throws if the file can't be mapped (e.g. if it is empty or larger
+	than 2 GB, which the int based stream positions don't allow).
+
+	Note: if the file is truncated while it's mapped, accessing the
+	missing data crashes. On Win32, the file can't be truncated at all
+	while it's mapped and read errors (e.g. of files on network shares)
+	raise exceptions instead of errors, so only use this for files on
+	local drives which aren't going to be rewritten.
+*/
+fz_stream *fz_open_file_mapped(fz_context *ctx, const char *filename);
+
+/*
+	SumatraPDF: fz_open_file_mapped_w: Same as fz_open_file_mapped for
+	a wide character path.
+
+	This function is only available when compiling for Win32.
+*/
+fz_stream *fz_open_file_mapped_w(fz_context *ctx, const wchar_t *filename);
+
 /*
 	fz_open_fd: Wrap an open file descriptor in a stream.
 
@@ -244,6 +244,46 @@ void fz_print_text_page(fz_context *ctx, fz_output *out, fz_text_page *page);
 */
 int fz_search_text_page(fz_context *ctx, fz_text_page *text, const char *needle, fz_rect *hit_bbox, int hit_max);
 
+/*
+	fz_text_index: The characters of a text page and their bounding boxes
+	in reading order, as flat arrays for constant time access (other than
+	fz_text_char_at, which walks the whole page for every index).
+
+	As for fz_text_char_at, every line is followed by a pseudo-newline
+	(a ' ' with an empty bbox).
+*/
+typedef struct fz_text_index_s fz_text_index;
+
+struct fz_text_index_s
+{
+	int len;
+	int *chars;
+	fz_rect *bboxes;
+};
+
+/*
+	fz_new_text_index: Index the characters of a text page.
+
+	The index doesn't reference the page, which may be dropped afterwards.
+*/
+fz_text_index *fz_new_text_index(fz_context *ctx, fz_text_page *page);
+
+void fz_drop_text_index(fz_context *ctx, fz_text_index *index);
+
+/*
+	fz_search_text_index: Search for occurrence of 'needle' in an indexed
+	text page. Same as fz_search_text_page but without the cost of
+	indexing the page for every search.
+*/
+int fz_search_text_index(fz_context *ctx, fz_text_index *index, const char *needle, fz_rect *hit_bbox, int hit_max);
+
+/*
+	fz_text_index_contains: Return whether 'needle' occurs in an indexed
+	text page (matched as for fz_search_text_index, but also counting
+	occurrences without any bbox) without collecting hit bboxes.
+*/
+int fz_text_index_contains(fz_context *ctx, fz_text_index *index, const char *needle);
+
 /*
 	fz_highlight_selection: Return a list of rectangles to highlight given a selection rectangle.
 
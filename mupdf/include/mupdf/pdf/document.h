@@ -89,6 +89,26 @@ pdf_document *pdf_open_document_with_stream(fz_context *ctx, fz_stream *file);
 pdf_document *pdf_open_document_no_run(fz_context *ctx, const char *filename);
 pdf_document *pdf_open_document_no_run_with_stream(fz_context *ctx, fz_stream *file);
 
+/*
+	SumatraPDF: pdf_open_document_linear_with_stream: Opens a PDF document.
+
+	Same as pdf_open_document_with_stream, but linearized documents
+	are read through their first page section and hint tables, so that
+	any page can be loaded without reading the complete xref or page
+	tree. The remaining xref is read as soon as an object outside of
+	these is needed (or pdf_load_complete_xref is called). Documents
+	which aren't linearized are read as usual.
+*/
+pdf_document *pdf_open_document_linear_with_stream(fz_context *ctx, fz_stream *file);
+pdf_document *pdf_open_document_no_run_linear_with_stream(fz_context *ctx, fz_stream *file);
+
+/*
+	SumatraPDF: pdf_load_complete_xref: Reads the remaining xref for a
+	document opened with pdf_open_document_linear_with_stream (e.g.
+	before writing it out). Does nothing for other documents.
+*/
+void pdf_load_complete_xref(pdf_document *doc);
+
 /*
 	pdf_close_document: Closes and frees an opened PDF document.
 
@@ -142,6 +142,9 @@ fz_new_context_imp(fz_alloc_context *alloc, fz_locks_context *locks, unsigned in
 	if (!ctx)
 		return NULL;
 
+	/* SumatraPDF: detect the paint functions' instruction set only once */
+	fz_init_simd_level();
+
 	/* Now initialise sections that are shared */
 	fz_try(ctx)
 	{
@@ -316,8 +316,10 @@ fz_blend_separable(byte * restrict bp, byte * restrict sp, int n, int w, int ble
 	}
 }
 
+/* SumatraPDF: the non-separable blend functions expect RGB, so red and blue are
+   swapped for BGR pixmaps (r and b are the indices of the red and blue components) */
 void
-fz_blend_nonseparable(byte * restrict bp, byte * restrict sp, int w, int blendmode)
+fz_blend_nonseparable(byte * restrict bp, byte * restrict sp, int w, int blendmode, int r, int b)
 {
 	while (w--)
 	{
@@ -331,13 +333,13 @@ fz_blend_nonseparable(byte * restrict bp, byte * restrict sp, int w, int blendmo
 		int invsa = sa ? 255 * 256 / sa : 0;
 		int invba = ba ? 255 * 256 / ba : 0;
 
-		int sr = (sp[0] * invsa) >> 8;
+		int sr = (sp[r] * invsa) >> 8;
 		int sg = (sp[1] * invsa) >> 8;
-		int sb = (sp[2] * invsa) >> 8;
+		int sb = (sp[b] * invsa) >> 8;
 
-		int br = (bp[0] * invba) >> 8;
+		int br = (bp[r] * invba) >> 8;
 		int bg = (bp[1] * invba) >> 8;
-		int bb = (bp[2] * invba) >> 8;
+		int bb = (bp[b] * invba) >> 8;
 
 		switch (blendmode)
 		{
@@ -356,9 +358,9 @@ fz_blend_nonseparable(byte * restrict bp, byte * restrict sp, int w, int blendmo
 			break;
 		}
 
-		bp[0] = fz_mul255(255 - sa, bp[0]) + fz_mul255(255 - ba, sp[0]) + fz_mul255(saba, rr);
+		bp[r] = fz_mul255(255 - sa, bp[r]) + fz_mul255(255 - ba, sp[r]) + fz_mul255(saba, rr);
 		bp[1] = fz_mul255(255 - sa, bp[1]) + fz_mul255(255 - ba, sp[1]) + fz_mul255(saba, rg);
-		bp[2] = fz_mul255(255 - sa, bp[2]) + fz_mul255(255 - ba, sp[2]) + fz_mul255(saba, rb);
+		bp[b] = fz_mul255(255 - sa, bp[b]) + fz_mul255(255 - ba, sp[b]) + fz_mul255(saba, rb);
 		bp[3] = ba + sa - saba;
 
 		sp += 4;
@@ -494,7 +496,7 @@ fz_blend_separable_nonisolated(byte * restrict bp, byte * restrict sp, int n, in
 }
 
 static void
-fz_blend_nonseparable_nonisolated(byte * restrict bp, byte * restrict sp, int w, int blendmode, byte * restrict hp, int alpha)
+fz_blend_nonseparable_nonisolated(byte * restrict bp, byte * restrict sp, int w, int blendmode, byte * restrict hp, int alpha, int r, int b)
 {
 	while (w--)
 	{
@@ -527,13 +529,13 @@ fz_blend_nonseparable_nonisolated(byte * restrict bp, byte * restrict sp, int w,
 				int invsa = sa ? 255 * 256 / sa : 0;
 				int invba = ba ? 255 * 256 / ba : 0;
 
-				int sr = (sp[0] * invsa) >> 8;
+				int sr = (sp[r] * invsa) >> 8;
 				int sg = (sp[1] * invsa) >> 8;
-				int sb = (sp[2] * invsa) >> 8;
+				int sb = (sp[b] * invsa) >> 8;
 
-				int br = (bp[0] * invba) >> 8;
+				int br = (bp[r] * invba) >> 8;
 				int bg = (bp[1] * invba) >> 8;
-				int bb = (bp[2] * invba) >> 8;
+				int bb = (bp[b] * invba) >> 8;
 
 				/* Uncomposite */
 				sr = (((sr-br)*invha)>>8) + br;
@@ -557,12 +559,12 @@ fz_blend_nonseparable_nonisolated(byte * restrict bp, byte * restrict sp, int w,
 					break;
 				}
 
-				rr = fz_mul255(255 - haa, bp[0]) + fz_mul255(fz_mul255(255 - ba, sr), haa) + fz_mul255(baha, rr);
+				rr = fz_mul255(255 - haa, bp[r]) + fz_mul255(fz_mul255(255 - ba, sr), haa) + fz_mul255(baha, rr);
 				rg = fz_mul255(255 - haa, bp[1]) + fz_mul255(fz_mul255(255 - ba, sg), haa) + fz_mul255(baha, rg);
-				rb = fz_mul255(255 - haa, bp[2]) + fz_mul255(fz_mul255(255 - ba, sb), haa) + fz_mul255(baha, rb);
-				bp[0] = fz_mul255(ra, rr);
+				rb = fz_mul255(255 - haa, bp[b]) + fz_mul255(fz_mul255(255 - ba, sb), haa) + fz_mul255(baha, rb);
+				bp[r] = fz_mul255(ra, rr);
 				bp[1] = fz_mul255(ra, rg);
-				bp[2] = fz_mul255(ra, rb);
+				bp[b] = fz_mul255(ra, rb);
 			}
 		}
 
@@ -578,6 +580,9 @@ fz_blend_pixmap(fz_pixmap *dst, fz_pixmap *src, int alpha, int blendmode, int is
 	fz_irect bbox;
 	fz_irect bbox2;
 	int x, y, w, h, n;
+	/* SumatraPDF: cf. fz_blend_nonseparable */
+	int bgr = dst->colorspace && !strcmp(dst->colorspace->name, "DeviceBGR");
+	int r = bgr ? 2 : 0, b = bgr ? 0 : 2;
 
 	/* TODO: fix this hack! */
 	if (isolated && alpha < 255)
@@ -613,7 +618,7 @@ fz_blend_pixmap(fz_pixmap *dst, fz_pixmap *src, int alpha, int blendmode, int is
 		while (h--)
 		{
 			if (n == 4 && blendmode >= FZ_BLEND_HUE)
-				fz_blend_nonseparable_nonisolated(dp, sp, w, blendmode, hp, alpha);
+				fz_blend_nonseparable_nonisolated(dp, sp, w, blendmode, hp, alpha, r, b);
 			else
 				fz_blend_separable_nonisolated(dp, sp, n, w, blendmode, hp, alpha);
 			sp += src->w * n;
@@ -626,7 +631,7 @@ fz_blend_pixmap(fz_pixmap *dst, fz_pixmap *src, int alpha, int blendmode, int is
 		while (h--)
 		{
 			if (n == 4 && blendmode >= FZ_BLEND_HUE)
-				fz_blend_nonseparable(dp, sp, w, blendmode);
+				fz_blend_nonseparable(dp, sp, w, blendmode, r, b);
 			else
 				fz_blend_separable(dp, sp, n, w, blendmode);
 			sp += src->w * n;
@@ -22,8 +22,12 @@ struct fz_aa_context_s
 	int vscale;
 	int scale;
 	int bits;
+	int analytic; /* SumatraPDF: see fz_set_scan_converter */
 };
 
+/* SumatraPDF: exact coverage needs edges with more precision than the sub-pixel grids below */
+#define FZ_AA_ANALYTIC_SCALE 256
+
 void fz_new_aa_context(fz_context *ctx)
 {
 #ifndef AA_BITS
@@ -37,6 +41,7 @@ void fz_new_aa_context(fz_context *ctx)
 #define fz_aa_vscale ((ctxaa)->vscale)
 #define fz_aa_scale ((ctxaa)->scale)
 #define fz_aa_bits ((ctxaa)->bits)
+#define fz_aa_analytic ((ctxaa)->analytic)
 #define AA_SCALE(x) ((x * fz_aa_scale) >> 8)
 
 #endif
@@ -58,6 +63,8 @@ void fz_free_aa_context(fz_context *ctx)
 
 #ifdef AA_BITS
 
+#define fz_aa_analytic 0
+
 #if AA_BITS > 6
 #define AA_SCALE(x) (x)
 #define fz_aa_hscale 17
@@ -135,10 +142,35 @@ fz_set_aa_level(fz_context *ctx, int level)
 		fz_aa_vscale = 1;
 		fz_aa_bits = 0;
 	}
+	if (fz_aa_analytic && fz_aa_bits > 0)
+	{
+		fz_aa_hscale = FZ_AA_ANALYTIC_SCALE;
+		fz_aa_vscale = FZ_AA_ANALYTIC_SCALE;
+	}
 	fz_aa_scale = 0xFF00 / (fz_aa_hscale * fz_aa_vscale);
 #endif
 }
 
+int
+fz_scan_converter(fz_context *ctx)
+{
+	fz_aa_context *ctxaa = ctx->aa;
+	return fz_aa_analytic ? FZ_SCAN_CONVERT_ANALYTIC : FZ_SCAN_CONVERT_SAMPLED;
+}
+
+void
+fz_set_scan_converter(fz_context *ctx, int converter)
+{
+#ifdef AA_BITS
+	if (converter != FZ_SCAN_CONVERT_SAMPLED)
+		fz_warn(ctx, "anti-aliasing was compiled with a fixed precision of %d bits", fz_aa_bits);
+#else
+	ctx->aa->analytic = converter == FZ_SCAN_CONVERT_ANALYTIC;
+	/* the sub-pixel grid depends on the converter */
+	fz_set_aa_level(ctx, ctx->aa->bits);
+#endif
+}
+
 /*
  * Global Edge List -- list of straight path segments for scan conversion
  *
@@ -441,7 +473,11 @@ fz_sort_gel(fz_gel *gel)
 	int n = gel->len;
 	int h, i, k;
 	fz_edge t;
+	fz_aa_context *ctxaa = gel->ctx->aa;
 
+	/* SumatraPDF: fz_scan_convert_analytic groups the edges by row itself */
+	if (fz_aa_analytic && fz_aa_bits > 0)
+		return;
 
 	/* quick sort for long lists */
 	if (n > 10000)
@@ -879,6 +915,256 @@ clip_ended:
 	fz_free(ctx, alphas);
 }
 
+/*
+ * SumatraPDF: anti-aliased scan conversion with exact coverage.
+ *
+ * Instead of sampling sub-scanlines, every edge adds the signed area it
+ * covers in each pixel of a row to an accumulation buffer (plus the rest
+ * of its height to the pixel right of it), so that the running sum over
+ * the buffer is the area of each pixel covered by the path. This needs
+ * a single pass per row instead of one per sub-scanline. Where a path
+ * overlaps itself within a pixel, the coverage is approximated as by
+ * FreeType's rasterizer: it is clamped for non-zero winding and folded
+ * for even-odd filling.
+ */
+
+typedef struct fz_aa_line_s fz_aa_line;
+
+struct fz_aa_line_s
+{
+	int y0, y1; /* in sub-scanlines */
+	float x0; /* in pixels, relative to the left of the bounding box */
+	float dxdy; /* in pixels per pixel row */
+	float dir;
+};
+
+/* adds the area right of the line from (xa,0) to (xb,dy) (within a single
+ * pixel row, d is dy with the direction of the edge) */
+static inline void
+accumulate_line(float * restrict acc, float xa, float xb, float d, int *lo, int *hi)
+{
+	float x0 = fz_min(xa, xb);
+	float x1 = fz_max(xa, xb);
+	float x0floor = floorf(x0);
+	float x1ceil = ceilf(x1);
+	int x0i = (int)x0floor;
+	int x1i = (int)x1ceil;
+
+	if (x0i < *lo)
+		*lo = x0i;
+	if (fz_maxi(x0i + 1, x1i) > *hi)
+		*hi = fz_maxi(x0i + 1, x1i);
+
+	if (x1i <= x0i + 1)
+	{
+		/* the line stays within a single pixel */
+		float xmf = 0.5f * (xa + xb) - x0floor;
+		acc[x0i] += d - d * xmf;
+		acc[x0i + 1] += d * xmf;
+	}
+	else
+	{
+		float s = 1.0f / (x1 - x0);
+		float x0f = x0 - x0floor;
+		float a0 = 0.5f * s * (1 - x0f) * (1 - x0f);
+		float x1f = x1 - x1ceil + 1;
+		float am = 0.5f * s * x1f * x1f;
+		int xi;
+
+		acc[x0i] += d * a0;
+		if (x1i == x0i + 2)
+			acc[x0i + 1] += d * (1 - a0 - am);
+		else
+		{
+			float a1 = s * (1.5f - x0f);
+			acc[x0i + 1] += d * (a1 - a0);
+			for (xi = x0i + 2; xi < x1i - 1; xi++)
+				acc[xi] += d * s;
+			acc[x1i - 1] += d * (1 - a1 - (x1i - x0i - 3) * s - am);
+		}
+		acc[x1i] += d * am;
+	}
+}
+
+/* turns the accumulated areas from lo to hi into alpha values (and clears them) */
+static inline void
+undelta_analytic(unsigned char * restrict out, float * restrict acc, int lo, int hi, int eofill)
+{
+	float sum = 0;
+	int x;
+
+	if (eofill)
+	{
+		for (x = lo; x <= hi; x++)
+		{
+			float c;
+			sum += acc[x];
+			acc[x] = 0;
+			c = fabsf(sum);
+			c -= 2 * floorf(c * 0.5f);
+			if (c > 1)
+				c = 2 - c;
+			out[x] = (unsigned char)(c * 255 + 0.5f);
+		}
+	}
+	else
+	{
+		for (x = lo; x <= hi; x++)
+		{
+			float c;
+			sum += acc[x];
+			acc[x] = 0;
+			c = fz_min(fabsf(sum), 1);
+			out[x] = (unsigned char)(c * 255 + 0.5f);
+		}
+	}
+}
+
+static void
+fz_scan_convert_analytic(fz_gel *gel, int eofill, const fz_irect *clip,
+	fz_pixmap *dst, unsigned char *color)
+{
+	fz_context *ctx = gel->ctx;
+	fz_aa_context *ctxaa = ctx->aa;
+	fz_aa_line *lines;
+	int *starts, *active;
+	float *acc;
+	unsigned char *alphas;
+	int alen = 0, e, i, yd;
+	int lo = 0, hi = -1;
+	int reusable = 0;
+
+	int xmin = fz_idiv(gel->bbox.x0, fz_aa_hscale);
+	int xmax = fz_idiv(gel->bbox.x1, fz_aa_hscale) + 1;
+
+	int xofs = xmin * fz_aa_hscale;
+	float width = (float)(xmax - xmin);
+
+	int ymin = fz_idiv(gel->bbox.y0, fz_aa_vscale);
+	int rows = fz_idiv(gel->bbox.y1, fz_aa_vscale) - ymin + 1;
+
+	int skipx = clip->x0 - xmin;
+	int clipn = clip->x1 - clip->x0;
+
+	if (gel->len == 0)
+		return;
+
+	assert(clip->x0 >= xmin);
+	assert(clip->x1 <= xmax);
+
+	lines = fz_malloc_no_throw(ctx, gel->len * sizeof(fz_aa_line));
+	starts = fz_malloc_no_throw(ctx, (rows + 2) * sizeof(int));
+	active = fz_malloc_no_throw(ctx, gel->len * sizeof(int));
+	acc = fz_malloc_no_throw(ctx, (xmax - xmin + 2) * sizeof(float));
+	alphas = fz_malloc_no_throw(ctx, xmax - xmin + 2);
+	if (lines == NULL || starts == NULL || active == NULL || acc == NULL || alphas == NULL)
+	{
+		fz_free(ctx, lines);
+		fz_free(ctx, starts);
+		fz_free(ctx, active);
+		fz_free(ctx, acc);
+		fz_free(ctx, alphas);
+		fz_throw(ctx, FZ_ERROR_GENERIC, "scan conversion failed (malloc failure)");
+	}
+	memset(acc, 0, (xmax - xmin + 2) * sizeof(float));
+	memset(starts, 0, (rows + 2) * sizeof(int));
+
+	/* The edges haven't been sorted (see fz_sort_gel), as it's enough to
+	 * know which ones start in which row: lines[starts[r]] up to
+	 * lines[starts[r+1]] are the ones starting in row ymin + r. */
+	for (i = 0; i < gel->len; i++)
+		starts[fz_idiv(gel->edges[i].y, fz_aa_vscale) - ymin + 2]++;
+	for (i = 2; i < rows + 2; i++)
+		starts[i] += starts[i - 1];
+	for (i = 0; i < gel->len; i++)
+	{
+		/* recover the end points of the (not yet advanced) edge */
+		fz_edge *edge = &gel->edges[i];
+		fz_aa_line *l = &lines[starts[fz_idiv(edge->y, fz_aa_vscale) - ymin + 1]++];
+		int dx = edge->xdir * (fz_absi(edge->xmove) * edge->h + edge->adj_up);
+		l->y0 = edge->y;
+		l->y1 = edge->y + edge->h;
+		l->x0 = (float)(edge->x - xofs) / fz_aa_hscale;
+		l->dxdy = (float)dx * fz_aa_vscale / ((float)edge->h * fz_aa_hscale);
+		l->dir = (float)edge->ydir;
+	}
+
+	yd = fz_maxi(ymin, clip->y0);
+	/* edges starting above the clip region may still cross it */
+	for (e = 0; e < starts[fz_mini(yd - ymin, rows)]; e++)
+	{
+		if (lines[e].y1 > yd * fz_aa_vscale)
+			active[alen++] = e;
+	}
+	for (; yd < clip->y1 && yd - ymin < rows; yd++)
+	{
+		int ry0 = yd * fz_aa_vscale;
+		int ry1 = ry0 + fz_aa_vscale;
+		int vertical = 1;
+
+		for (e = starts[yd - ymin]; e < starts[yd - ymin + 1]; e++)
+		{
+			active[alen++] = e;
+			reusable = 0;
+		}
+		if (alen == 0)
+			continue;
+
+		for (i = 0; i < alen && vertical; i++)
+		{
+			fz_aa_line *l = &lines[active[i]];
+			vertical = l->dxdy == 0 && l->y0 <= ry0 && l->y1 >= ry1;
+		}
+		/* rows crossed by the same vertical edges (e.g. of rectangles)
+		 * are covered the same and have to be computed only once */
+		if (!vertical || !reusable)
+		{
+			lo = INT_MAX;
+			hi = -1;
+			for (i = 0; i < alen; i++)
+			{
+				fz_aa_line *l = &lines[active[i]];
+				int ya = fz_maxi(l->y0, ry0);
+				int yb = fz_mini(l->y1, ry1);
+				float xa = l->x0 + l->dxdy * (ya - l->y0) / fz_aa_vscale;
+				float xb = xa + l->dxdy * (yb - ya) / fz_aa_vscale;
+				xa = fz_clamp(xa, 0, width);
+				xb = fz_clamp(xb, 0, width);
+				accumulate_line(acc, xa, xb, l->dir * (yb - ya) / fz_aa_vscale, &lo, &hi);
+			}
+			if (hi >= lo)
+				undelta_analytic(alphas, acc, lo, hi, eofill);
+		}
+		reusable = vertical;
+
+		if (hi >= lo)
+		{
+			int x0 = fz_maxi(lo, skipx);
+			int x1 = fz_mini(hi + 1, skipx + clipn);
+			if (x0 < x1)
+				blit_aa(dst, xmin + x0, yd, alphas + x0, x1 - x0, color);
+		}
+
+		/* retire the edges ending in this row */
+		for (i = 0; i < alen; )
+		{
+			if (lines[active[i]].y1 <= ry1)
+			{
+				active[i] = active[--alen];
+				reusable = 0;
+			}
+			else
+				i++;
+		}
+	}
+
+	fz_free(ctx, alphas);
+	fz_free(ctx, acc);
+	fz_free(ctx, active);
+	fz_free(ctx, starts);
+	fz_free(ctx, lines);
+}
+
 /*
  * Sharp (not anti-aliased) scan conversion
  */
@@ -996,7 +1282,9 @@ fz_scan_convert(fz_gel *gel, int eofill, const fz_irect *clip,
 	if (fz_is_empty_irect(fz_intersect_irect(fz_pixmap_bbox_no_ctx(dst, &local_clip), clip)))
 		return;
 
-	if (fz_aa_bits > 0)
+	if (fz_aa_bits > 0 && fz_aa_analytic)
+		fz_scan_convert_analytic(gel, eofill, &local_clip, dst, color);
+	else if (fz_aa_bits > 0)
 		fz_scan_convert_aa(gel, eofill, &local_clip, dst, color);
 	else
 		fz_scan_convert_sharp(gel, eofill, &local_clip, dst, color);
@@ -1,6 +1,21 @@
 #include "mupdf/fitz.h"
 #include "draw-imp.h"
 
+/* SumatraPDF: SIMD versions of the most used paint functions */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FZ_HAS_SSE2 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+/* MSVC allows using AVX2 intrinsics without enabling them for the whole file */
+#define FZ_TARGET_AVX2
+#else
+#define FZ_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#else
+#define FZ_HAS_SSE2 0
+#endif
+
 /*
 
 The functions in this file implement various flavours of Porter-Duff blending.
@@ -73,6 +88,12 @@ and stick to using the premultiplied form.
 
 typedef unsigned char byte;
 
+/* SumatraPDF: these dispatch to the SIMD versions at the end of this file */
+static void fz_paint_solid_color_4_simd(byte * restrict dp, int w, byte *color);
+static void fz_paint_span_with_color_4_simd(byte * restrict dp, byte * restrict mp, int w, byte *color);
+static void fz_paint_span_with_mask_4_simd(byte * restrict dp, byte * restrict sp, byte * restrict mp, int w);
+static void fz_paint_span_4_with_alpha_simd(byte * restrict dp, byte * restrict sp, int w, int alpha);
+
 /* These are used by the non-aa scan converter */
 
 void
@@ -193,7 +214,7 @@ fz_paint_solid_color(byte * restrict dp, int n, int w, byte *color)
 	switch (n)
 	{
 	case 2: fz_paint_solid_color_2(dp, w, color); break;
-	case 4: fz_paint_solid_color_4(dp, w, color); break;
+	case 4: fz_paint_solid_color_4_simd(dp, w, color); break;
 	default: fz_paint_solid_color_N(dp, n, w, color); break;
 	}
 }
@@ -363,7 +384,7 @@ fz_paint_span_with_color(byte * restrict dp, byte * restrict mp, int n, int w, b
 	switch (n)
 	{
 	case 2: fz_paint_span_with_color_2(dp, mp, w, color); break;
-	case 4: fz_paint_span_with_color_4(dp, mp, w, color); break;
+	case 4: fz_paint_span_with_color_4_simd(dp, mp, w, color); break;
 	default: fz_paint_span_with_color_N(dp, mp, n, w, color); break;
 	}
 }
@@ -521,7 +542,7 @@ fz_paint_span_with_mask(byte * restrict dp, byte * restrict sp, byte * restrict
 	switch (n)
 	{
 	case 2: fz_paint_span_with_mask_2(dp, sp, mp, w); break;
-	case 4: fz_paint_span_with_mask_4(dp, sp, mp, w); break;
+	case 4: fz_paint_span_with_mask_4_simd(dp, sp, mp, w); break;
 	default: fz_paint_span_with_mask_N(dp, sp, mp, n, w); break;
 	}
 }
@@ -703,7 +724,7 @@ fz_paint_span(byte * restrict dp, byte * restrict sp, int n, int w, int alpha)
 		switch (n)
 		{
 		case 2: fz_paint_span_2_with_alpha(dp, sp, w, alpha); break;
-		case 4: fz_paint_span_4_with_alpha(dp, sp, w, alpha); break;
+		case 4: fz_paint_span_4_with_alpha_simd(dp, sp, w, alpha); break;
 		default: fz_paint_span_N_with_alpha(dp, sp, n, w, alpha); break;
 		}
 	}
@@ -1035,6 +1056,13 @@ solid_run:
 					if (len > ww)
 						len = ww;
 					ww -= len;
+					if (n == 4)
+					{
+						/* SumatraPDF: paint runs through the SIMD functions */
+						fz_paint_solid_color_4_simd(ddp, len, colorbv);
+						ddp += len * 4;
+						break;
+					}
 					do
 					{
 						int k = 0;
@@ -1057,6 +1085,13 @@ intermediate_run:
 					if (len > ww)
 						len = ww;
 					ww -= len;
+					if (n == 4)
+					{
+						fz_paint_span_with_color_4_simd(ddp, runp, len, colorbv);
+						ddp += len * 4;
+						runp += len;
+						break;
+					}
 					do
 					{
 						int k = 0;
@@ -1171,6 +1206,13 @@ solid_run:
 					if (len > ww)
 						len = ww;
 					ww -= len;
+					if (n == 4)
+					{
+						/* SumatraPDF: paint runs through the SIMD functions */
+						fz_paint_solid_color_4_simd(ddp, len, colorbv);
+						ddp += len * 4;
+						break;
+					}
 					do
 					{
 						int k = 0;
@@ -1190,6 +1232,13 @@ intermediate_run:
 					if (len > ww)
 						len = ww;
 					ww -= len;
+					if (n == 4)
+					{
+						fz_paint_span_with_color_4_simd(ddp, runp, len, colorbv);
+						ddp += len * 4;
+						runp += len;
+						break;
+					}
 					do
 					{
 						int k = 0;
@@ -1262,3 +1311,396 @@ fz_paint_glyph(unsigned char *colorbv, fz_pixmap *dst, unsigned char *dp, fz_gly
 	else
 		fz_paint_glyph_mask(dst->w, dp, glyph, w, h, skip_x, skip_y);
 }
+
+/*
+	SumatraPDF: SSE2 and AVX2 versions of the paint functions for 4
+	components, which are used for most rendering. They process 4 (or 8)
+	pixels at once and leave the few remaining ones to the scalar
+	functions above.
+
+	The results are bit-exact, as FZ_BLEND(S, D, A) can be computed as
+	(S * A + D * (256 - A)) >> 8 and neither product (nor their sum)
+	overflows 16 bits for A <= 256.
+*/
+
+#if FZ_HAS_SSE2
+static int
+fz_detect_avx2(void)
+{
+#ifdef _MSC_VER
+	int info[4];
+	__cpuid(info, 0);
+	if (info[0] < 7)
+		return 0;
+	__cpuid(info, 1);
+	/* the OS must also save the AVX registers on context switches */
+	if (!(info[2] & (1 << 27)) || !(info[2] & (1 << 28)) || (_xgetbv(0) & 6) != 6)
+		return 0;
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#else
+	return __builtin_cpu_supports("avx2");
+#endif
+}
+#endif
+
+/* set by fz_init_simd_level when the first context is created, so that the paint
+   functions (which don't get a context) only ever read it while rendering */
+static int fz_simd_level_used = -1;
+
+static int
+fz_supported_simd_level(void)
+{
+#if FZ_HAS_SSE2
+	return fz_detect_avx2() ? FZ_SIMD_AVX2 : FZ_SIMD_SSE2;
+#else
+	return FZ_SIMD_NONE;
+#endif
+}
+
+void
+fz_init_simd_level(void)
+{
+	if (fz_simd_level_used < 0)
+		fz_simd_level_used = fz_supported_simd_level();
+}
+
+int
+fz_simd_level(void)
+{
+	return fz_simd_level_used < 0 ? FZ_SIMD_NONE : fz_simd_level_used;
+}
+
+int
+fz_set_simd_level(int level)
+{
+	fz_simd_level_used = fz_clampi(level, FZ_SIMD_NONE, fz_supported_simd_level());
+	return fz_simd_level_used;
+}
+
+#if FZ_HAS_SSE2
+
+/* all of the following work on 16 bit lanes holding the components of 2 pixels */
+
+static inline __m128i
+fz_blend_sse2(__m128i s, __m128i d, __m128i a)
+{
+	__m128i na = _mm_sub_epi16(_mm_set1_epi16(256), a);
+	return _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(s, a), _mm_mullo_epi16(d, na)), 8);
+}
+
+/* FZ_COMBINE(s, ma) + FZ_COMBINE(d, FZ_EXPAND(255 - FZ_COMBINE(alpha of s, ma))) as a byte */
+static inline __m128i
+fz_blend_masked_sse2(__m128i s, __m128i d, __m128i ma)
+{
+	__m128i sa = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s, 0xFF), 0xFF);
+	__m128i masa = _mm_sub_epi16(_mm_set1_epi16(255), _mm_srli_epi16(_mm_mullo_epi16(sa, ma), 8));
+	masa = _mm_add_epi16(masa, _mm_srli_epi16(masa, 7));
+	s = _mm_srli_epi16(_mm_mullo_epi16(s, ma), 8);
+	d = _mm_srli_epi16(_mm_mullo_epi16(d, masa), 8);
+	return _mm_and_si128(_mm_add_epi16(s, d), _mm_set1_epi16(0xFF));
+}
+
+/* FZ_EXPAND of the 4 mask values in m, spread over the lanes of 2 pixels each */
+static inline void
+fz_load_mask_sse2(unsigned int m, int sa, __m128i *lo, __m128i *hi)
+{
+	__m128i a = _mm_unpacklo_epi8(_mm_cvtsi32_si128((int)m), _mm_setzero_si128());
+	a = _mm_add_epi16(a, _mm_srli_epi16(a, 7));
+	if (sa != 256)
+		a = _mm_srli_epi16(_mm_mullo_epi16(a, _mm_set1_epi16(sa)), 8);
+	a = _mm_unpacklo_epi16(a, a);
+	*lo = _mm_unpacklo_epi32(a, a);
+	*hi = _mm_unpackhi_epi32(a, a);
+}
+
+static void
+fz_paint_solid_color_4_sse2(byte * restrict dp, int w, byte *color)
+{
+	__m128i zero = _mm_setzero_si128();
+	__m128i c = _mm_set1_epi32((int)(*(unsigned int *)color | 0xFF000000));
+	__m128i c16 = _mm_unpacklo_epi8(c, zero);
+	int sa = FZ_EXPAND(color[3]);
+	__m128i a = _mm_set1_epi16(sa);
+	if (sa == 0)
+		return;
+	for (; w >= 4; w -= 4, dp += 16)
+	{
+		__m128i d, lo, hi;
+		if (sa == 256)
+		{
+			_mm_storeu_si128((__m128i *)dp, c);
+			continue;
+		}
+		d = _mm_loadu_si128((__m128i *)dp);
+		lo = fz_blend_sse2(c16, _mm_unpacklo_epi8(d, zero), a);
+		hi = fz_blend_sse2(c16, _mm_unpackhi_epi8(d, zero), a);
+		_mm_storeu_si128((__m128i *)dp, _mm_packus_epi16(lo, hi));
+	}
+	fz_paint_solid_color_4(dp, w, color);
+}
+
+static void
+fz_paint_span_with_color_4_sse2(byte * restrict dp, byte * restrict mp, int w, byte *color)
+{
+	__m128i zero = _mm_setzero_si128();
+	__m128i c = _mm_set1_epi32((int)(*(unsigned int *)color | 0xFF000000));
+	__m128i c16 = _mm_unpacklo_epi8(c, zero);
+	int sa = FZ_EXPAND(color[3]);
+	if (sa == 0)
+		return;
+	for (; w >= 4; w -= 4, dp += 16, mp += 4)
+	{
+		unsigned int m;
+		__m128i d, alo, ahi, lo, hi;
+		memcpy(&m, mp, 4);
+		if (m == 0)
+			continue;
+		if (m == 0xFFFFFFFF && sa == 256)
+		{
+			_mm_storeu_si128((__m128i *)dp, c);
+			continue;
+		}
+		fz_load_mask_sse2(m, sa, &alo, &ahi);
+		d = _mm_loadu_si128((__m128i *)dp);
+		lo = fz_blend_sse2(c16, _mm_unpacklo_epi8(d, zero), alo);
+		hi = fz_blend_sse2(c16, _mm_unpackhi_epi8(d, zero), ahi);
+		_mm_storeu_si128((__m128i *)dp, _mm_packus_epi16(lo, hi));
+	}
+	fz_paint_span_with_color_4(dp, mp, w, color);
+}
+
+static void
+fz_paint_span_with_mask_4_sse2(byte * restrict dp, byte * restrict sp, byte * restrict mp, int w)
+{
+	__m128i zero = _mm_setzero_si128();
+	for (; w >= 4; w -= 4, dp += 16, sp += 16, mp += 4)
+	{
+		unsigned int m;
+		__m128i s, d, alo, ahi, lo, hi;
+		memcpy(&m, mp, 4);
+		if (m == 0)
+			continue;
+		fz_load_mask_sse2(m, 256, &alo, &ahi);
+		s = _mm_loadu_si128((__m128i *)sp);
+		d = _mm_loadu_si128((__m128i *)dp);
+		lo = fz_blend_masked_sse2(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero), alo);
+		hi = fz_blend_masked_sse2(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero), ahi);
+		_mm_storeu_si128((__m128i *)dp, _mm_packus_epi16(lo, hi));
+	}
+	fz_paint_span_with_mask_4(dp, sp, mp, w);
+}
+
+static void
+fz_paint_span_4_with_alpha_sse2(byte * restrict dp, byte * restrict sp, int w, int alpha)
+{
+	__m128i zero = _mm_setzero_si128();
+	__m128i a = _mm_set1_epi16(FZ_EXPAND(alpha));
+	for (; w >= 4; w -= 4, dp += 16, sp += 16)
+	{
+		__m128i s = _mm_loadu_si128((__m128i *)sp);
+		__m128i d = _mm_loadu_si128((__m128i *)dp);
+		__m128i slo = _mm_unpacklo_epi8(s, zero);
+		__m128i shi = _mm_unpackhi_epi8(s, zero);
+		__m128i alo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(slo, 0xFF), 0xFF);
+		__m128i ahi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(shi, 0xFF), 0xFF);
+		alo = _mm_srli_epi16(_mm_mullo_epi16(alo, a), 8);
+		ahi = _mm_srli_epi16(_mm_mullo_epi16(ahi, a), 8);
+		alo = fz_blend_sse2(slo, _mm_unpacklo_epi8(d, zero), alo);
+		ahi = fz_blend_sse2(shi, _mm_unpackhi_epi8(d, zero), ahi);
+		_mm_storeu_si128((__m128i *)dp, _mm_packus_epi16(alo, ahi));
+	}
+	fz_paint_span_4_with_alpha(dp, sp, w, alpha);
+}
+
+/* the same for AVX2, with each 128 bit lane holding the components of 2 pixels */
+
+FZ_TARGET_AVX2 static inline __m256i
+fz_blend_avx2(__m256i s, __m256i d, __m256i a)
+{
+	__m256i na = _mm256_sub_epi16(_mm256_set1_epi16(256), a);
+	return _mm256_srli_epi16(_mm256_add_epi16(_mm256_mullo_epi16(s, a), _mm256_mullo_epi16(d, na)), 8);
+}
+
+FZ_TARGET_AVX2 static inline __m256i
+fz_blend_masked_avx2(__m256i s, __m256i d, __m256i ma)
+{
+	__m256i sa = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(s, 0xFF), 0xFF);
+	__m256i masa = _mm256_sub_epi16(_mm256_set1_epi16(255), _mm256_srli_epi16(_mm256_mullo_epi16(sa, ma), 8));
+	masa = _mm256_add_epi16(masa, _mm256_srli_epi16(masa, 7));
+	s = _mm256_srli_epi16(_mm256_mullo_epi16(s, ma), 8);
+	d = _mm256_srli_epi16(_mm256_mullo_epi16(d, masa), 8);
+	return _mm256_and_si256(_mm256_add_epi16(s, d), _mm256_set1_epi16(0xFF));
+}
+
+/* lo matches _mm256_unpacklo_epi8 of 8 pixels (pixels 0, 1, 4 and 5), hi the others */
+FZ_TARGET_AVX2 static inline void
+fz_load_mask_avx2(const byte *mp, int sa, __m256i *lo, __m256i *hi)
+{
+	__m128i a = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)mp), _mm_setzero_si128());
+	__m128i a03, a47;
+	a = _mm_add_epi16(a, _mm_srli_epi16(a, 7));
+	if (sa != 256)
+		a = _mm_srli_epi16(_mm_mullo_epi16(a, _mm_set1_epi16(sa)), 8);
+	a03 = _mm_unpacklo_epi16(a, a);
+	a47 = _mm_unpackhi_epi16(a, a);
+	*lo = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_unpacklo_epi32(a03, a03)), _mm_unpacklo_epi32(a47, a47), 1);
+	*hi = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_unpackhi_epi32(a03, a03)), _mm_unpackhi_epi32(a47, a47), 1);
+}
+
+FZ_TARGET_AVX2 static void
+fz_paint_solid_color_4_avx2(byte * restrict dp, int w, byte *color)
+{
+	__m256i zero = _mm256_setzero_si256();
+	__m256i c = _mm256_set1_epi32((int)(*(unsigned int *)color | 0xFF000000));
+	__m256i c16 = _mm256_unpacklo_epi8(c, zero);
+	int sa = FZ_EXPAND(color[3]);
+	__m256i a = _mm256_set1_epi16((short)sa);
+	if (sa == 0)
+		return;
+	for (; w >= 8; w -= 8, dp += 32)
+	{
+		__m256i d, lo, hi;
+		if (sa == 256)
+		{
+			_mm256_storeu_si256((__m256i *)dp, c);
+			continue;
+		}
+		d = _mm256_loadu_si256((__m256i *)dp);
+		lo = fz_blend_avx2(c16, _mm256_unpacklo_epi8(d, zero), a);
+		hi = fz_blend_avx2(c16, _mm256_unpackhi_epi8(d, zero), a);
+		_mm256_storeu_si256((__m256i *)dp, _mm256_packus_epi16(lo, hi));
+	}
+	_mm256_zeroupper();
+	fz_paint_solid_color_4(dp, w, color);
+}
+
+FZ_TARGET_AVX2 static void
+fz_paint_span_with_color_4_avx2(byte * restrict dp, byte * restrict mp, int w, byte *color)
+{
+	__m256i zero = _mm256_setzero_si256();
+	__m256i c = _mm256_set1_epi32((int)(*(unsigned int *)color | 0xFF000000));
+	__m256i c16 = _mm256_unpacklo_epi8(c, zero);
+	int sa = FZ_EXPAND(color[3]);
+	if (sa == 0)
+		return;
+	for (; w >= 8; w -= 8, dp += 32, mp += 8)
+	{
+		uint64_t m;
+		__m256i d, alo, ahi, lo, hi;
+		memcpy(&m, mp, 8);
+		if (m == 0)
+			continue;
+		if (m == ~(uint64_t)0 && sa == 256)
+		{
+			_mm256_storeu_si256((__m256i *)dp, c);
+			continue;
+		}
+		fz_load_mask_avx2(mp, sa, &alo, &ahi);
+		d = _mm256_loadu_si256((__m256i *)dp);
+		lo = fz_blend_avx2(c16, _mm256_unpacklo_epi8(d, zero), alo);
+		hi = fz_blend_avx2(c16, _mm256_unpackhi_epi8(d, zero), ahi);
+		_mm256_storeu_si256((__m256i *)dp, _mm256_packus_epi16(lo, hi));
+	}
+	_mm256_zeroupper();
+	fz_paint_span_with_color_4(dp, mp, w, color);
+}
+
+FZ_TARGET_AVX2 static void
+fz_paint_span_with_mask_4_avx2(byte * restrict dp, byte * restrict sp, byte * restrict mp, int w)
+{
+	__m256i zero = _mm256_setzero_si256();
+	for (; w >= 8; w -= 8, dp += 32, sp += 32, mp += 8)
+	{
+		uint64_t m;
+		__m256i s, d, alo, ahi, lo, hi;
+		memcpy(&m, mp, 8);
+		if (m == 0)
+			continue;
+		fz_load_mask_avx2(mp, 256, &alo, &ahi);
+		s = _mm256_loadu_si256((__m256i *)sp);
+		d = _mm256_loadu_si256((__m256i *)dp);
+		lo = fz_blend_masked_avx2(_mm256_unpacklo_epi8(s, zero), _mm256_unpacklo_epi8(d, zero), alo);
+		hi = fz_blend_masked_avx2(_mm256_unpackhi_epi8(s, zero), _mm256_unpackhi_epi8(d, zero), ahi);
+		_mm256_storeu_si256((__m256i *)dp, _mm256_packus_epi16(lo, hi));
+	}
+	_mm256_zeroupper();
+	fz_paint_span_with_mask_4(dp, sp, mp, w);
+}
+
+FZ_TARGET_AVX2 static void
+fz_paint_span_4_with_alpha_avx2(byte * restrict dp, byte * restrict sp, int w, int alpha)
+{
+	__m256i zero = _mm256_setzero_si256();
+	__m256i a = _mm256_set1_epi16((short)FZ_EXPAND(alpha));
+	for (; w >= 8; w -= 8, dp += 32, sp += 32)
+	{
+		__m256i s = _mm256_loadu_si256((__m256i *)sp);
+		__m256i d = _mm256_loadu_si256((__m256i *)dp);
+		__m256i slo = _mm256_unpacklo_epi8(s, zero);
+		__m256i shi = _mm256_unpackhi_epi8(s, zero);
+		__m256i alo = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(slo, 0xFF), 0xFF);
+		__m256i ahi = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(shi, 0xFF), 0xFF);
+		alo = _mm256_srli_epi16(_mm256_mullo_epi16(alo, a), 8);
+		ahi = _mm256_srli_epi16(_mm256_mullo_epi16(ahi, a), 8);
+		alo = fz_blend_avx2(slo, _mm256_unpacklo_epi8(d, zero), alo);
+		ahi = fz_blend_avx2(shi, _mm256_unpackhi_epi8(d, zero), ahi);
+		_mm256_storeu_si256((__m256i *)dp, _mm256_packus_epi16(alo, ahi));
+	}
+	_mm256_zeroupper();
+	fz_paint_span_4_with_alpha(dp, sp, w, alpha);
+}
+
+#endif
+
+static void
+fz_paint_solid_color_4_simd(byte * restrict dp, int w, byte *color)
+{
+#if FZ_HAS_SSE2
+	switch (fz_simd_level())
+	{
+	case FZ_SIMD_AVX2: fz_paint_solid_color_4_avx2(dp, w, color); return;
+	case FZ_SIMD_SSE2: fz_paint_solid_color_4_sse2(dp, w, color); return;
+	}
+#endif
+	fz_paint_solid_color_4(dp, w, color);
+}
+
+static void
+fz_paint_span_with_color_4_simd(byte * restrict dp, byte * restrict mp, int w, byte *color)
+{
+#if FZ_HAS_SSE2
+	switch (fz_simd_level())
+	{
+	case FZ_SIMD_AVX2: fz_paint_span_with_color_4_avx2(dp, mp, w, color); return;
+	case FZ_SIMD_SSE2: fz_paint_span_with_color_4_sse2(dp, mp, w, color); return;
+	}
+#endif
+	fz_paint_span_with_color_4(dp, mp, w, color);
+}
+
+static void
+fz_paint_span_with_mask_4_simd(byte * restrict dp, byte * restrict sp, byte * restrict mp, int w)
+{
+#if FZ_HAS_SSE2
+	switch (fz_simd_level())
+	{
+	case FZ_SIMD_AVX2: fz_paint_span_with_mask_4_avx2(dp, sp, mp, w); return;
+	case FZ_SIMD_SSE2: fz_paint_span_with_mask_4_sse2(dp, sp, mp, w); return;
+	}
+#endif
+	fz_paint_span_with_mask_4(dp, sp, mp, w);
+}
+
+static void
+fz_paint_span_4_with_alpha_simd(byte * restrict dp, byte * restrict sp, int w, int alpha)
+{
+#if FZ_HAS_SSE2
+	switch (fz_simd_level())
+	{
+	case FZ_SIMD_AVX2: fz_paint_span_4_with_alpha_avx2(dp, sp, w, alpha); return;
+	case FZ_SIMD_SSE2: fz_paint_span_4_with_alpha_sse2(dp, sp, w, alpha); return;
+	}
+#endif
+	fz_paint_span_4_with_alpha(dp, sp, w, alpha);
+}
@@ -13,6 +13,14 @@ intermediate results rather than ints.
 #include "mupdf/fitz.h"
 #include "draw-imp.h"
 
+/* SumatraPDF: SIMD versions of the row and column scalers */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FZ_HAS_SSE2 1
+#include <emmintrin.h>
+#else
+#define FZ_HAS_SSE2 0
+#endif
+
 /* Do we special case handling of single pixel high/wide images? The
  * 'purest' handling is given by not special casing them, but certain
  * files that use such images 'stack' them to give full images. Not
@@ -1057,6 +1065,212 @@ scale_row_from_temp(unsigned char *dst, unsigned char *src, fz_weights *weights,
 		src++;
 	}
 }
+
+/*
+	SumatraPDF: SSE2 versions of the row scalers for 1, 2 and 4
+	components and of the column scaler, which do most of the work when
+	drawing scanned pages. Both the samples and the weights fit into
+	signed 16 bits, so _mm_madd_epi16 can multiply and add pairs of them
+	into exact 32 bit sums and the results are bit-exact.
+*/
+#if FZ_HAS_SSE2
+
+static inline __m128i
+fz_load4_sse2(const unsigned char *p)
+{
+	int v;
+	memcpy(&v, p, 4);
+	return _mm_cvtsi32_si128(v);
+}
+
+/* the low bytes of (val >> 8) for the 4 sums in acc */
+static inline unsigned int
+fz_sums_to_bytes_sse2(__m128i acc)
+{
+	acc = _mm_and_si128(_mm_srai_epi32(acc, 8), _mm_set1_epi32(0xFF));
+	acc = _mm_packs_epi32(acc, acc);
+	return (unsigned int)_mm_cvtsi128_si32(_mm_packus_epi16(acc, acc));
+}
+
+static inline int
+fz_sum_lanes_sse2(__m128i acc)
+{
+	acc = _mm_add_epi32(acc, _mm_srli_si128(acc, 8));
+	acc = _mm_add_epi32(acc, _mm_srli_si128(acc, 4));
+	return _mm_cvtsi128_si32(acc);
+}
+
+static void
+scale_row_to_temp1_sse2(unsigned char *dst, unsigned char *src, fz_weights *weights)
+{
+	int *contrib = &weights->index[weights->index[0]];
+	__m128i zero = _mm_setzero_si128();
+	int len, i, step = 1;
+	unsigned char *min;
+
+	assert(weights->n == 1);
+	if (weights->flip)
+	{
+		dst += weights->count - 1;
+		step = -1;
+	}
+	for (i=weights->count; i > 0; i--, dst += step)
+	{
+		__m128i acc = zero;
+		int val;
+		min = &src[*contrib++];
+		len = *contrib++;
+		for (; len >= 8; len -= 8, min += 8, contrib += 8)
+		{
+			__m128i p = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)min), zero);
+			__m128i w = _mm_packs_epi32(_mm_loadu_si128((const __m128i *)contrib), _mm_loadu_si128((const __m128i *)(contrib + 4)));
+			acc = _mm_add_epi32(acc, _mm_madd_epi16(p, w));
+		}
+		val = 128 + fz_sum_lanes_sse2(acc);
+		while (len-- > 0)
+		{
+			val += *min++ * *contrib++;
+		}
+		*dst = (unsigned char)(val>>8);
+	}
+}
+
+static void
+scale_row_to_temp2_sse2(unsigned char *dst, unsigned char *src, fz_weights *weights)
+{
+	int *contrib = &weights->index[weights->index[0]];
+	__m128i zero = _mm_setzero_si128();
+	int len, i, step = 2;
+	unsigned char *min;
+
+	assert(weights->n == 2);
+	if (weights->flip)
+	{
+		dst += 2*(weights->count - 1);
+		step = -2;
+	}
+	for (i=weights->count; i > 0; i--, dst += step)
+	{
+		__m128i acc = _mm_set_epi32(0, 0, 128, 128);
+		unsigned int out;
+		min = &src[2 * *contrib++];
+		len = *contrib++;
+		/* pair up the gray and alpha values of 2 pixels each for 4 pixels at once */
+		for (; len >= 4; len -= 4, min += 8, contrib += 4)
+		{
+			__m128i p = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)min), zero);
+			__m128i w = _mm_packs_epi32(_mm_loadu_si128((const __m128i *)contrib), zero);
+			p = _mm_shufflehi_epi16(_mm_shufflelo_epi16(p, _MM_SHUFFLE(3,1,2,0)), _MM_SHUFFLE(3,1,2,0));
+			acc = _mm_add_epi32(acc, _mm_madd_epi16(p, _mm_unpacklo_epi32(w, w)));
+		}
+		for (; len > 0; len--, min += 2)
+		{
+			__m128i p = _mm_set_epi32(0, 0, min[1], min[0]);
+			acc = _mm_add_epi32(acc, _mm_madd_epi16(p, _mm_set1_epi32(*contrib++ & 0xFFFF)));
+		}
+		out = fz_sums_to_bytes_sse2(_mm_add_epi32(acc, _mm_srli_si128(acc, 8)));
+		dst[0] = (unsigned char)out;
+		dst[1] = (unsigned char)(out >> 8);
+	}
+}
+
+static void
+scale_row_to_temp4_sse2(unsigned char *dst, unsigned char *src, fz_weights *weights)
+{
+	int *contrib = &weights->index[weights->index[0]];
+	__m128i zero = _mm_setzero_si128();
+	int len, i, step = 4;
+	unsigned char *min;
+
+	assert(weights->n == 4);
+	if (weights->flip)
+	{
+		dst += 4*(weights->count - 1);
+		step = -4;
+	}
+	for (i=weights->count; i > 0; i--, dst += step)
+	{
+		__m128i acc = _mm_set1_epi32(128);
+		unsigned int out;
+		min = &src[4 * *contrib++];
+		len = *contrib++;
+		/* pair up the components of pixels 0 and 2 and of pixels 1 and 3 */
+		for (; len >= 4; len -= 4, min += 16, contrib += 4)
+		{
+			__m128i p = _mm_loadu_si128((const __m128i *)min);
+			__m128i lo = _mm_unpacklo_epi8(p, zero);
+			__m128i hi = _mm_unpackhi_epi8(p, zero);
+			__m128i w = _mm_packs_epi32(_mm_loadu_si128((const __m128i *)contrib), zero);
+			w = _mm_shufflelo_epi16(w, _MM_SHUFFLE(3,1,2,0));
+			acc = _mm_add_epi32(acc, _mm_madd_epi16(_mm_unpacklo_epi16(lo, hi), _mm_shuffle_epi32(w, 0x00)));
+			acc = _mm_add_epi32(acc, _mm_madd_epi16(_mm_unpackhi_epi16(lo, hi), _mm_shuffle_epi32(w, 0x55)));
+		}
+		for (; len > 0; len--, min += 4)
+		{
+			__m128i p = _mm_unpacklo_epi16(_mm_unpacklo_epi8(fz_load4_sse2(min), zero), zero);
+			acc = _mm_add_epi32(acc, _mm_madd_epi16(p, _mm_set1_epi32(*contrib++ & 0xFFFF)));
+		}
+		out = fz_sums_to_bytes_sse2(acc);
+		memcpy(dst, &out, 4);
+	}
+}
+
+static void
+scale_row_from_temp_sse2(unsigned char *dst, unsigned char *src, fz_weights *weights, int width, int row)
+{
+	int *contrib = &weights->index[weights->index[row]];
+	__m128i zero = _mm_setzero_si128();
+	__m128i mask = _mm_set1_epi32(0xFF);
+	int len, x, k;
+
+	contrib++; /* Skip min */
+	len = *contrib++;
+	/* pair up the samples of 2 rows at a time for 16 samples at once */
+	for (x = 0; x + 16 <= width; x += 16)
+	{
+		__m128i acc0 = _mm_set1_epi32(128);
+		__m128i acc1 = acc0, acc2 = acc0, acc3 = acc0;
+		unsigned char *min = src + x;
+		for (k = 0; k < len; k += 2, min += 2*width)
+		{
+			__m128i a = _mm_loadu_si128((const __m128i *)min);
+			__m128i b = zero;
+			__m128i w, lo, hi;
+			int w1 = 0;
+			if (k + 1 < len)
+			{
+				b = _mm_loadu_si128((const __m128i *)(min + width));
+				w1 = contrib[k + 1];
+			}
+			w = _mm_set1_epi32((int)(((unsigned int)w1 << 16) | (contrib[k] & 0xFFFF)));
+			lo = _mm_unpacklo_epi8(a, b);
+			hi = _mm_unpackhi_epi8(a, b);
+			acc0 = _mm_add_epi32(acc0, _mm_madd_epi16(_mm_unpacklo_epi8(lo, zero), w));
+			acc1 = _mm_add_epi32(acc1, _mm_madd_epi16(_mm_unpackhi_epi8(lo, zero), w));
+			acc2 = _mm_add_epi32(acc2, _mm_madd_epi16(_mm_unpacklo_epi8(hi, zero), w));
+			acc3 = _mm_add_epi32(acc3, _mm_madd_epi16(_mm_unpackhi_epi8(hi, zero), w));
+		}
+		acc0 = _mm_and_si128(_mm_srai_epi32(acc0, 8), mask);
+		acc1 = _mm_and_si128(_mm_srai_epi32(acc1, 8), mask);
+		acc2 = _mm_and_si128(_mm_srai_epi32(acc2, 8), mask);
+		acc3 = _mm_and_si128(_mm_srai_epi32(acc3, 8), mask);
+		_mm_storeu_si128((__m128i *)(dst + x), _mm_packus_epi16(_mm_packs_epi32(acc0, acc1), _mm_packs_epi32(acc2, acc3)));
+	}
+	for (; x < width; x++)
+	{
+		unsigned char *min = src + x;
+		int val = 128;
+
+		for (k = 0; k < len; k++)
+		{
+			val += *min * contrib[k];
+			min += width;
+		}
+		dst[x] = (unsigned char)(val>>8);
+	}
+}
+
+#endif
 #endif
 
 #ifdef SINGLE_PIXEL_SPECIALS
@@ -1430,6 +1644,7 @@ fz_scale_pixmap_cached(fz_context *ctx, fz_pixmap *src, float x, float y, float
 #endif /* SINGLE_PIXEL_SPECIALS */
 	{
 		void (*row_scale)(unsigned char *dst, unsigned char *src, fz_weights *weights);
+		void (*col_scale)(unsigned char *dst, unsigned char *src, fz_weights *weights, int width, int row) = scale_row_from_temp;
 
 		temp_span = contrib_cols->count * src->n;
 		temp_rows = contrib_rows->max_len;
@@ -1463,6 +1678,19 @@ fz_scale_pixmap_cached(fz_context *ctx, fz_pixmap *src, float x, float y, float
 			row_scale = scale_row_to_temp4;
 			break;
 		}
+#if FZ_HAS_SSE2
+		/* SumatraPDF: use the SSE2 scalers (which are bit-exact) */
+		if (fz_simd_level() >= FZ_SIMD_SSE2)
+		{
+			if (src->n == 1)
+				row_scale = scale_row_to_temp1_sse2;
+			else if (src->n == 2)
+				row_scale = scale_row_to_temp2_sse2;
+			else if (src->n == 4)
+				row_scale = scale_row_to_temp4_sse2;
+			col_scale = scale_row_from_temp_sse2;
+		}
+#endif
 		max_row = contrib_rows->index[contrib_rows->index[0]];
 		for (row = 0; row < contrib_rows->count; row++)
 		{
@@ -1484,7 +1712,7 @@ fz_scale_pixmap_cached(fz_context *ctx, fz_pixmap *src, float x, float y, float
 			}
 
 			DBUG(("scaling row %d from temp\n", row));
-			scale_row_from_temp(&output->samples[row*output->w*output->n], temp, contrib_rows, temp_span, row);
+			(*col_scale)(&output->samples[row*output->w*output->n], temp, contrib_rows, temp_span, row);
 		}
 		fz_free(ctx, temp);
 	}
@@ -92,7 +92,7 @@ void fz_warn_imp(fz_context *ctx, char *file, int line, const char *fmt, ...)
  */
 
 /* SumatraPDF: force crash so that we get crash report */
-inline void fz_crash_abort()
+static inline void fz_crash_abort()
 {
 	char *p = NULL;
 	*p = 0;
@@ -114,6 +114,8 @@ FZ_NORETURN static void throw(fz_error_context *ex)
 		OutputDebugStringA("\n");
 #endif
 		fz_crash_abort();
+		/* SumatraPDF: not reached, but tells the compiler that throw() doesn't return */
+		abort();
 	}
 }
 
@@ -655,6 +655,63 @@ fz_drop_display_list(fz_context *ctx, fz_display_list *list)
 	fz_drop_storable(ctx, &list->storable);
 }
 
+/* SumatraPDF: allow to budget caches of display lists */
+size_t
+fz_display_list_size(fz_context *ctx, fz_display_list *list)
+{
+	fz_display_node *node;
+	fz_image *prev_image = NULL;
+	fz_stroke_state *prev_stroke = NULL;
+	size_t size = sizeof(fz_display_list);
+
+	for (node = list->first; node; node = node->next)
+	{
+		size += sizeof(fz_display_node);
+		switch (node->cmd)
+		{
+		case FZ_CMD_FILL_PATH:
+		case FZ_CMD_STROKE_PATH:
+		case FZ_CMD_CLIP_PATH:
+		case FZ_CMD_CLIP_STROKE_PATH:
+			size += sizeof(fz_path) + node->item.path->cmd_cap + node->item.path->coord_cap * sizeof(float);
+			break;
+		case FZ_CMD_FILL_TEXT:
+		case FZ_CMD_STROKE_TEXT:
+		case FZ_CMD_CLIP_TEXT:
+		case FZ_CMD_CLIP_STROKE_TEXT:
+		case FZ_CMD_IGNORE_TEXT:
+			size += sizeof(fz_text) + node->item.text->cap * sizeof(fz_text_item);
+			break;
+		case FZ_CMD_FILL_SHADE:
+			size += sizeof(fz_shade) + fz_compressed_buffer_size(node->item.shade->buffer);
+			break;
+		case FZ_CMD_FILL_IMAGE:
+		case FZ_CMD_FILL_IMAGE_MASK:
+		case FZ_CMD_CLIP_IMAGE_MASK:
+			/* tiled images usually repeat the same image over and over */
+			if (node->item.image != prev_image)
+			{
+				fz_image *image = node->item.image;
+				size += sizeof(fz_image) + fz_compressed_buffer_size(image->buffer);
+				if (image->tile)
+					size += image->tile->w * image->tile->h * image->tile->n;
+				prev_image = image;
+			}
+			break;
+		default:
+			break;
+		}
+		/* stroke states are shared between consecutive nodes */
+		if (node->stroke && node->stroke != prev_stroke)
+		{
+			size += sizeof(fz_stroke_state);
+			prev_stroke = node->stroke;
+		}
+	}
+
+	return size;
+}
+
 static fz_display_node *
 skip_to_end_tile(fz_display_node *node, int *progress)
 {
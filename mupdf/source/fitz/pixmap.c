@@ -21,6 +21,8 @@ fz_free_pixmap_imp(fz_context *ctx, fz_storable *pix_)
 		fz_drop_colorspace(ctx, pix->colorspace);
 	if (pix->free_samples)
 		fz_free(ctx, pix->samples);
+	else if (pix->release_samples)
+		pix->release_samples(ctx, pix->release_opaque, pix->samples);
 	fz_free(ctx, pix);
 }
 
@@ -101,6 +103,38 @@ fz_new_pixmap_with_bbox_and_data(fz_context *ctx, fz_colorspace *colorspace, con
 	return pixmap;
 }
 
+/* SumatraPDF: allow rendering straight into application provided memory */
+fz_pixmap *
+fz_new_pixmap_with_bbox_and_allocator(fz_context *ctx, fz_colorspace *colorspace, const fz_irect *r, const fz_pixmap_allocator *allocator)
+{
+	fz_pixmap *pixmap;
+	unsigned char *samples;
+	int w = r->x1 - r->x0;
+	int h = r->y1 - r->y0;
+	int n = colorspace ? 1 + colorspace->n : 1;
+
+	if (w < 0 || h < 0)
+		fz_throw(ctx, FZ_ERROR_GENERIC, "Illegal dimensions for pixmap %d %d", w, h);
+	samples = allocator ? allocator->alloc(ctx, allocator->opaque, w, h, n) : NULL;
+	if (!samples)
+		return fz_new_pixmap_with_bbox(ctx, colorspace, r);
+
+	fz_var(pixmap);
+	fz_try(ctx)
+	{
+		pixmap = fz_new_pixmap_with_bbox_and_data(ctx, colorspace, r, samples);
+	}
+	fz_catch(ctx)
+	{
+		if (allocator->release)
+			allocator->release(ctx, allocator->opaque, samples);
+		fz_rethrow(ctx);
+	}
+	pixmap->release_samples = allocator->release;
+	pixmap->release_opaque = allocator->opaque;
+	return pixmap;
+}
+
 fz_irect *
 fz_pixmap_bbox(fz_context *ctx, fz_pixmap *pix, fz_irect *bbox)
 {
@@ -55,20 +55,6 @@ fz_char_and_box *fz_text_char_at(fz_char_and_box *cab, fz_text_page *page, int i
 	return cab;
 }
 
-static int charat(fz_text_page *page, int idx)
-{
-	fz_char_and_box cab;
-	return fz_text_char_at(&cab, page, idx)->c;
-}
-
-static fz_rect *bboxat(fz_text_page *page, int idx, fz_rect *bbox)
-{
-	fz_char_and_box cab;
-	/* FIXME: Nasty extra copy */
-	*bbox = fz_text_char_at(&cab, page, idx)->bbox;
-	return bbox;
-}
-
 static int textlen(fz_text_page *page)
 {
 	int len = 0;
@@ -95,29 +81,112 @@ static int textlen(fz_text_page *page)
 	return len;
 }
 
-static int match(fz_text_page *page, const char *s, int n)
+fz_text_index *
+fz_new_text_index(fz_context *ctx, fz_text_page *page)
 {
-	int orig = n;
-	int c;
-	while (*s)
+	fz_text_index *index;
+	int block_num, i, n = textlen(page);
+
+	fz_var(n);
+
+	index = fz_malloc_struct(ctx, fz_text_index);
+	fz_try(ctx)
+	{
+		index->chars = fz_malloc_array(ctx, n, sizeof(int));
+		index->bboxes = fz_malloc_array(ctx, n, sizeof(fz_rect));
+	}
+	fz_catch(ctx)
+	{
+		fz_drop_text_index(ctx, index);
+		fz_rethrow(ctx);
+	}
+
+	for (block_num = 0; block_num < page->len; block_num++)
+	{
+		fz_text_block *block;
+		fz_text_line *line;
+		fz_text_span *span;
+
+		if (page->blocks[block_num].type != FZ_PAGE_BLOCK_TEXT)
+			continue;
+		block = page->blocks[block_num].u.text;
+		for (line = block->lines; line < block->lines + block->len; line++)
+		{
+			for (span = line->first_span; span; span = span->next)
+			{
+				for (i = 0; i < span->len; i++)
+				{
+					index->chars[index->len] = span->text[i].c;
+					fz_text_char_bbox(&index->bboxes[index->len], span, i);
+					index->len++;
+				}
+			}
+			index->chars[index->len] = ' ';
+			index->bboxes[index->len] = fz_empty_rect;
+			index->len++;
+		}
+	}
+
+	return index;
+}
+
+void
+fz_drop_text_index(fz_context *ctx, fz_text_index *index)
+{
+	if (!index)
+		return;
+	fz_free(ctx, index->chars);
+	fz_free(ctx, index->bboxes);
+	fz_free(ctx, index);
+}
+
+static inline int charat(fz_text_index *index, int idx)
+{
+	return idx < index->len ? index->chars[idx] : 0;
+}
+
+/* the needle is decoded once upfront, with runs of whitespace collapsed into a single ' ' */
+static int *decode_needle(fz_context *ctx, const char *needle, int *len)
+{
+	int *runes = fz_malloc_array(ctx, strlen(needle) + 1, sizeof(int));
+	int c, n = 0;
+
+	while (*needle)
 	{
-		s += fz_chartorune(&c, (char *)s);
-		if (iswhite(c) && iswhite(charat(page, n)))
+		needle += fz_chartorune(&c, (char *)needle);
+		if (iswhite(c))
 		{
-			const char *s_next;
+			if (n > 0 && runes[n - 1] == ' ')
+				continue;
+			c = ' ';
+		}
+		else
+			c = fz_tolower(c);
+		runes[n++] = c;
+	}
+	*len = n;
+	return runes;
+}
+
+static int match(fz_text_index *index, const int *runes, int len, int n)
+{
+	int orig = n;
+	int i, c;
 
+	for (i = 0; i < len; i++)
+	{
+		c = charat(index, n);
+		if (runes[i] == ' ' && iswhite(c))
+		{
 			/* Skip over whitespace in the document */
 			do
 				n++;
-			while (iswhite(charat(page, n)));
-
-			/* Skip over multiple whitespace in the search string */
-			while (s_next = s + fz_chartorune(&c, (char *)s), iswhite(c))
-				s = s_next;
+			while (iswhite(charat(index, n)));
 		}
 		else
 		{
-			if (fz_tolower(c) != fz_tolower(charat(page, n)))
+			/* whitespace in the needle only matches whitespace */
+			if (runes[i] == ' ' || runes[i] != fz_tolower(c))
 				return 0;
 			n++;
 		}
@@ -126,25 +195,28 @@ static int match(fz_text_page *page, const char *s, int n)
 }
 
 int
-fz_search_text_page(fz_context *ctx, fz_text_page *text, const char *needle, fz_rect *hit_bbox, int hit_max)
+fz_search_text_index(fz_context *ctx, fz_text_index *index, const char *needle, fz_rect *hit_bbox, int hit_max)
 {
-	int pos, len, i, n, hit_count;
+	int pos, i, n, hit_count, len;
+	int *runes;
 
 	if (strlen(needle) == 0)
 		return 0;
 
+	runes = decode_needle(ctx, needle, &len);
 	hit_count = 0;
-	len = textlen(text);
-	for (pos = 0; pos < len; pos++)
+	for (pos = 0; pos < index->len; pos++)
 	{
-		n = match(text, needle, pos);
+		/* quickly skip positions where not even the first character matches */
+		if (runes[0] != ' ' && runes[0] != fz_tolower(index->chars[pos]))
+			continue;
+		n = match(index, runes, len, pos);
 		if (n)
 		{
 			fz_rect linebox = fz_empty_rect;
 			for (i = 0; i < n; i++)
 			{
-				fz_rect charbox;
-				bboxat(text, pos + i, &charbox);
+				fz_rect charbox = index->bboxes[pos + i];
 				if (!fz_is_empty_rect(&charbox))
 				{
 					if (charbox.y0 != linebox.y0 || fz_abs(charbox.x0 - linebox.x1) > 5)
@@ -163,6 +235,51 @@ fz_search_text_page(fz_context *ctx, fz_text_page *text, const char *needle, fz_
 				hit_bbox[hit_count++] = linebox;
 		}
 	}
+	fz_free(ctx, runes);
+
+	return hit_count;
+}
+
+int
+fz_text_index_contains(fz_context *ctx, fz_text_index *index, const char *needle)
+{
+	int pos, len, found;
+	int *runes;
+
+	if (strlen(needle) == 0)
+		return 0;
+
+	runes = decode_needle(ctx, needle, &len);
+	found = 0;
+	for (pos = 0; pos < index->len && !found; pos++)
+	{
+		if (runes[0] != ' ' && runes[0] != fz_tolower(index->chars[pos]))
+			continue;
+		found = match(index, runes, len, pos) != 0;
+	}
+	fz_free(ctx, runes);
+
+	return found;
+}
+
+int
+fz_search_text_page(fz_context *ctx, fz_text_page *text, const char *needle, fz_rect *hit_bbox, int hit_max)
+{
+	fz_text_index *index;
+	int hit_count = 0;
+
+	if (strlen(needle) == 0)
+		return 0;
+
+	fz_var(hit_count);
+
+	index = fz_new_text_index(ctx, text);
+	fz_try(ctx)
+		hit_count = fz_search_text_index(ctx, index, needle, hit_bbox, hit_max);
+	fz_always(ctx)
+		fz_drop_text_index(ctx, index);
+	fz_catch(ctx)
+		fz_rethrow(ctx);
 
 	return hit_count;
 }
@@ -1,5 +1,13 @@
 #include "mupdf/fitz.h"
 
+/* SumatraPDF: memory-mapped file streams */
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 void fz_rebind_stream(fz_stream *stm, fz_context *ctx)
 {
 	if (stm == NULL || stm->ctx == ctx)
@@ -273,3 +281,168 @@ fz_open_memory(fz_context *ctx, unsigned char *data, int len)
 
 	return stm;
 }
+
+/* SumatraPDF: memory-mapped file stream */
+
+typedef struct fz_mapped_file_s
+{
+	int refs;
+	unsigned char *data;
+	int len;
+} fz_mapped_file;
+
+static void drop_mapped_file(fz_context *ctx, fz_mapped_file *map)
+{
+	int drop;
+
+	fz_lock(ctx, FZ_LOCK_ALLOC);
+	drop = --map->refs == 0;
+	fz_unlock(ctx, FZ_LOCK_ALLOC);
+	if (!drop)
+		return;
+#ifdef _WIN32
+	UnmapViewOfFile(map->data);
+#else
+	munmap(map->data, map->len);
+#endif
+	fz_free(ctx, map);
+}
+
+static void close_mapped(fz_context *ctx, void *state_)
+{
+	drop_mapped_file(ctx, (fz_mapped_file *)state_);
+}
+
+static fz_stream *open_mapped(fz_context *ctx, fz_mapped_file *map);
+
+/* clones share the mapping, so that cloning doesn't copy anything either */
+static fz_stream *reopen_mapped(fz_context *ctx, fz_stream *stm)
+{
+	fz_mapped_file *map = stm->state;
+
+	fz_lock(ctx, FZ_LOCK_ALLOC);
+	map->refs++;
+	fz_unlock(ctx, FZ_LOCK_ALLOC);
+	return open_mapped(ctx, map);
+}
+
+/* takes ownership of the reference to map */
+static fz_stream *open_mapped(fz_context *ctx, fz_mapped_file *map)
+{
+	fz_stream *stm;
+
+	/* the whole file is the stream's buffer, so reading and seeking
+	   (which work as for memory streams) never copy data or call the OS */
+	fz_try(ctx)
+	{
+		stm = fz_new_stream(ctx, map, next_buffer, close_mapped, NULL);
+	}
+	fz_catch(ctx)
+	{
+		drop_mapped_file(ctx, map);
+		fz_rethrow(ctx);
+	}
+	stm->seek = seek_buffer;
+	stm->reopen = reopen_mapped;
+
+	stm->rp = map->data;
+	stm->wp = map->data + map->len;
+
+	stm->pos = map->len;
+
+	return stm;
+}
+
+#ifdef _WIN32
+static fz_stream *
+open_file_mapped_handle(fz_context *ctx, HANDLE file, const char *name)
+{
+	LARGE_INTEGER size;
+	HANDLE mapping;
+	void *data;
+	fz_mapped_file *map;
+
+	if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0 || size.QuadPart > INT_MAX)
+	{
+		CloseHandle(file);
+		fz_throw(ctx, FZ_ERROR_GENERIC, "cannot map %s: unsupported size", name);
+	}
+	mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	CloseHandle(file);
+	if (!mapping)
+		fz_throw(ctx, FZ_ERROR_GENERIC, "cannot map %s", name);
+	data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	/* the view keeps the mapping alive */
+	CloseHandle(mapping);
+	if (!data)
+		fz_throw(ctx, FZ_ERROR_GENERIC, "cannot map %s", name);
+
+	fz_try(ctx)
+	{
+		map = fz_malloc_struct(ctx, fz_mapped_file);
+	}
+	fz_catch(ctx)
+	{
+		UnmapViewOfFile(data);
+		fz_rethrow(ctx);
+	}
+	map->refs = 1;
+	map->data = data;
+	map->len = (int)size.QuadPart;
+	return open_mapped(ctx, map);
+}
+
+fz_stream *
+fz_open_file_mapped_w(fz_context *ctx, const wchar_t *name)
+{
+	HANDLE file = CreateFileW(name, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+		fz_throw(ctx, FZ_ERROR_GENERIC, "cannot open file %ls", name);
+	return open_file_mapped_handle(ctx, file, "file");
+}
+
+fz_stream *
+fz_open_file_mapped(fz_context *ctx, const char *name)
+{
+	HANDLE file = CreateFileA(name, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+		fz_throw(ctx, FZ_ERROR_GENERIC, "cannot open %s", name);
+	return open_file_mapped_handle(ctx, file, name);
+}
+#else
+fz_stream *
+fz_open_file_mapped(fz_context *ctx, const char *name)
+{
+	struct stat st;
+	void *data;
+	fz_mapped_file *map;
+	int fd = open(name, O_RDONLY, 0);
+
+	if (fd == -1)
+		fz_throw(ctx, FZ_ERROR_GENERIC, "cannot open %s", name);
+	if (fstat(fd, &st) < 0 || st.st_size <= 0 || st.st_size > INT_MAX)
+	{
+		close(fd);
+		fz_throw(ctx, FZ_ERROR_GENERIC, "cannot map %s: unsupported size", name);
+	}
+	data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	/* the mapping stays valid after closing the file */
+	close(fd);
+	if (data == MAP_FAILED)
+		fz_throw(ctx, FZ_ERROR_GENERIC, "cannot map %s: %s", name, strerror(errno));
+
+	fz_try(ctx)
+	{
+		map = fz_malloc_struct(ctx, fz_mapped_file);
+	}
+	fz_catch(ctx)
+	{
+		munmap(data, st.st_size);
+		fz_rethrow(ctx);
+	}
+	map->refs = 1;
+	map->data = data;
+	map->len = (int)st.st_size;
+	return open_mapped(ctx, map);
+}
+#endif
@@ -1274,7 +1274,8 @@ pdf_append_line(pdf_document *doc, pdf_obj *res, fz_buffer *content, fz_buffer *
 		} while (w <= width && *end);
 	}
 	else
-		end = ucs2 + wcslen(ucs2);
+		/* SumatraPDF: wchar_t isn't 16-bit everywhere */
+		for (end = ucs2; *end; end++);
 
 	if (align != 0)
 	{
@@ -1419,7 +1420,8 @@ pdf_update_tx_widget_annot(pdf_document *doc, pdf_obj *obj)
 		if ((flags & Ff_Comb))
 		{
 			pdf_append_combed_line(doc, res, content, base_ap, ucs2, font_size, rect.x1 - rect.x0, pdf_to_int(pdf_dict_get_inheritable(doc, obj, "MaxLen")));
-			rest = L"";
+			/* SumatraPDF: wchar_t isn't 16-bit everywhere */
+			for (rest = ucs2; *rest; rest++);
 		}
 		while (*rest)
 			rest = pdf_append_line(doc, res, content, base_ap, rest, font_size, align, rect.x1 - rect.x0 - 4.0f, is_multiline, &x);
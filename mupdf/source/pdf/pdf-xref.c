@@ -1119,11 +1119,15 @@ pdf_load_linear(pdf_document *doc)
 		pdf_xref_entry *entry;
 
 		dict = pdf_parse_ind_obj(doc, doc->file, &doc->lexbuf.base, &num, &gen, &stmofs, NULL);
-		if (!pdf_is_dict(dict))
-			fz_throw(ctx, FZ_ERROR_GENERIC, "Failed to read linearized dictionary");
 		o = pdf_dict_gets(dict, "Linearized");
+		/* SumatraPDF: most files simply aren't linearized, which isn't worth a warning */
 		if (o == NULL)
-			fz_throw(ctx, FZ_ERROR_GENERIC, "Failed to read linearized dictionary");
+		{
+			pdf_drop_obj(dict);
+			dict = NULL;
+			doc->file_reading_linearly = 0;
+			break;
+		}
 		lin = pdf_to_int(o);
 		if (lin != 1)
 			fz_throw(ctx, FZ_ERROR_GENERIC, "Unexpected version of Linearized tag (%d)", lin);
@@ -1336,6 +1340,8 @@ pdf_init_document(pdf_document *doc)
 
 	fz_try(ctx)
 	{
+		int linear_complete = 0;
+
 		pdf_load_version(doc);
 
 		doc->file_length = fz_stream_meta(doc->file, FZ_STREAM_META_LENGTH, 0, NULL);
@@ -1345,12 +1351,25 @@ pdf_init_document(pdf_document *doc)
 		/* Check to see if we should work in progressive mode */
 		if (fz_stream_meta(doc->file, FZ_STREAM_META_PROGRESSIVE, 0, NULL) > 0)
 			doc->file_reading_linearly = 1;
+		/* SumatraPDF: complete files opened through pdf_open_document_linear_with_stream */
+		else if (doc->file_reading_linearly && !doc->file_length)
+		{
+			int pos = fz_tell(doc->file);
+			fz_seek(doc->file, 0, SEEK_END);
+			doc->file_length = doc->file_size = fz_tell(doc->file);
+			fz_seek(doc->file, pos, SEEK_SET);
+			linear_complete = 1;
+		}
 
 		/* Try to load the linearized file if we are in progressive
 		 * mode. */
 		if (doc->file_reading_linearly)
 			pdf_load_linear(doc);
 
+		/* SumatraPDF: missing objects aren't expected to arrive later */
+		if (linear_complete && !doc->file_reading_linearly)
+			doc->file_length = 0;
+
 		/* If we aren't in progressive mode (or the linear load failed
 		 * and has set us back to non-progressive mode), load normally.
 		 */
@@ -1817,12 +1836,71 @@ pdf_obj_read(pdf_document *doc, int *offset, int *nump, pdf_obj **page)
 	return 0;
 }
 
+static void pdf_load_hint_object_complete(pdf_document *doc);
+
+/* SumatraPDF: for complete files read linearly, objects outside of the first
+ * page section and the hint tables are located through the regular xref */
+static int
+pdf_linear_data_is_partial(pdf_document *doc)
+{
+	return fz_stream_meta(doc->file, FZ_STREAM_META_PROGRESSIVE, 0, NULL) > 0;
+}
+
+void
+pdf_load_complete_xref(pdf_document *doc)
+{
+	fz_context *ctx = doc->ctx;
+	int curr_pos, repaired = 0;
+
+	if (!doc->linear_obj || doc->linear_pos == doc->file_length)
+		return;
+	if (pdf_linear_data_is_partial(doc))
+		fz_throw(ctx, FZ_ERROR_TRYLATER, "cannot read the complete xref yet");
+
+	curr_pos = fz_tell(doc->file);
+	doc->linear_pos = doc->file_length;
+	fz_try(ctx)
+	{
+		pdf_load_xref(doc, &doc->lexbuf.base);
+	}
+	fz_catch(ctx)
+	{
+		fz_rethrow_if(ctx, FZ_ERROR_TRYLATER);
+		fz_warn(ctx, "trying to repair broken xref");
+		repaired = 1;
+	}
+
+	fz_try(ctx)
+	{
+		/* same as pdf_init_document does for documents with a broken xref */
+		if (repaired)
+		{
+			pdf_repair_xref(doc);
+			pdf_prime_xref_index(doc);
+			pdf_repair_obj_stms(doc);
+			/* ensure that strings are not used in their repaired, non-decrypted form */
+			if (doc->crypt)
+				pdf_clear_xref(doc);
+		}
+	}
+	fz_always(ctx)
+	{
+		fz_seek(doc->file, curr_pos, SEEK_SET);
+	}
+	fz_catch(ctx)
+	{
+		fz_rethrow(ctx);
+	}
+	/* pages are now looked up through the page tree */
+	doc->file_reading_linearly = 0;
+}
+
 static void
 pdf_load_hinted_page(pdf_document *doc, int pagenum)
 {
 	fz_context *ctx = doc->ctx;
 
-	if (!doc->hints_loaded || !doc->linear_page_refs)
+	if (!doc->hints_loaded || !doc->linear_page_refs || !doc->hint_page)
 		return;
 
 	if (doc->linear_page_refs[pagenum])
@@ -2012,6 +2090,15 @@ object_updated:
 	}
 	else if (doc->file_length && doc->linear_pos < doc->file_length)
 	{
+		/* SumatraPDF: all data is available, so try the hints or else read the remaining xref */
+		if (doc->linear_obj && !pdf_linear_data_is_partial(doc))
+		{
+			if (!doc->hints_loaded && doc->hint_object_offset > 0)
+				pdf_load_hint_object_complete(doc);
+			else
+				pdf_load_complete_xref(doc);
+			goto object_updated;
+		}
 		fz_throw(ctx, FZ_ERROR_TRYLATER, "cannot find object in xref (%d %d R) - not loaded yet?", num, gen);
 	}
 	else
@@ -2327,6 +2414,27 @@ pdf_open_document_no_run_with_stream(fz_context *ctx, fz_stream *file)
 	return doc;
 }
 
+/* SumatraPDF: read linearized files through their first page section and hint tables */
+pdf_document *
+pdf_open_document_no_run_linear_with_stream(fz_context *ctx, fz_stream *file)
+{
+	pdf_document *doc = pdf_new_document(ctx, file);
+
+	fz_var(doc);
+
+	fz_try(ctx)
+	{
+		doc->file_reading_linearly = 1;
+		pdf_init_document(doc);
+	}
+	fz_catch(ctx)
+	{
+		pdf_close_document(doc);
+		fz_rethrow_message(ctx, "cannot load document from stream");
+	}
+	return doc;
+}
+
 pdf_document *
 pdf_open_document_no_run(fz_context *ctx, const char *filename)
 {
@@ -2612,6 +2720,26 @@ pdf_load_hint_object(pdf_document *doc)
 	}
 }
 
+static void
+pdf_load_hint_object_complete(pdf_document *doc)
+{
+	fz_try(doc->ctx)
+	{
+		pdf_load_hint_object(doc);
+	}
+	fz_catch(doc->ctx)
+	{
+		/* malformed hints are only reported as FZ_ERROR_TRYLATER */
+		fz_warn(doc->ctx, "ignoring broken hint tables");
+		fz_free(doc->ctx, doc->hint_page);
+		doc->hint_page = NULL;
+		fz_free(doc->ctx, doc->hint_obj_offsets);
+		doc->hint_obj_offsets = NULL;
+		doc->hint_obj_offsets_max = 0;
+	}
+	doc->hints_loaded = 1;
+}
+
 pdf_obj *pdf_progressive_advance(pdf_document *doc, int pagenum)
 {
 	fz_context *ctx = doc->ctx;
@@ -2633,6 +2761,22 @@ pdf_obj *pdf_progressive_advance(pdf_document *doc, int pagenum)
 		/* Found hint object */
 		pdf_load_hint_object(doc);
 	}
+	/* SumatraPDF: with all data available, the hints can be loaded right away */
+	else if (!doc->hints_loaded && doc->hint_object_offset > 0 && !pdf_linear_data_is_partial(doc))
+	{
+		pdf_load_hint_object_complete(doc);
+	}
+
+	/* SumatraPDF: don't read through the whole file if the hints locate the page */
+	pdf_load_hinted_page(doc, pagenum);
+	if (doc->linear_page_refs[pagenum])
+		return doc->linear_page_refs[pagenum];
+	if (!pdf_linear_data_is_partial(doc))
+	{
+		pdf_load_complete_xref(doc);
+		doc->linear_page_refs[pagenum] = pdf_keep_obj(pdf_lookup_page_obj(doc, pagenum));
+		return doc->linear_page_refs[pagenum];
+	}
 
 	DEBUGMESS((ctx, "continuing to try to advance from %d", doc->linear_pos));
 	curr_pos = fz_tell(doc->file);
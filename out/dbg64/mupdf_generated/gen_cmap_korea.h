@@ -0,0 +1,9074 @@
+/* This is an automatically generated file. Do not edit. */
+
+/* Adobe-Korea1-0 */
+
+static const pdf_range cmap_Adobe_Korea1_0_ranges[] = {
+{0u,9332u,0u},
+};
+
+static pdf_cmap cmap_Adobe_Korea1_0 = {
+	{-1, pdf_free_cmap_imp}, "Adobe-Korea1-0", "", 0, 0, 1,
+	{ {2,0u,9471u}, },
+	1, 1, (pdf_range*) cmap_Adobe_Korea1_0_ranges,
+	0, 0, NULL,
+	0, 0, NULL,
+};
+
+/* Adobe-Korea1-1 */
+
+static const pdf_range cmap_Adobe_Korea1_1_ranges[] = {
+{0u,18154u,0u},
+};
+
+static pdf_cmap cmap_Adobe_Korea1_1 = {
+	{-1, pdf_free_cmap_imp}, "Adobe-Korea1-1", "", 0, 0, 1,
+	{ {2,0u,18175u}, },
+	1, 1, (pdf_range*) cmap_Adobe_Korea1_1_ranges,
+	0, 0, NULL,
+	0, 0, NULL,
+};
+
+/* Adobe-Korea1-2 */
+
+static const pdf_range cmap_Adobe_Korea1_2_ranges[] = {
+{0u,18351u,0u},
+};
+
+static pdf_cmap cmap_Adobe_Korea1_2 = {
+	{-1, pdf_free_cmap_imp}, "Adobe-Korea1-2", "", 0, 0, 1,
+	{ {2,0u,18431u}, },
+	1, 1, (pdf_range*) cmap_Adobe_Korea1_2_ranges,
+	0, 0, NULL,
+	0, 0, NULL,
+};
+
+/* Adobe-Korea1-UCS2 */
+
+static const pdf_range cmap_Adobe_Korea1_UCS2_ranges[] = {
+{0u,0u,65533u},{1u,95u,32u},{96u,96u,8361u},{97u,97u,8208u},
+{98u,98u,169u},{99u,99u,8482u},{100u,100u,8943u},{101u,103u,12288u},
+{104u,104u,183u},{105u,106u,8229u},{107u,107u,168u},{108u,108u,12291u},
+{109u,110u,8211u},{111u,111u,8214u},{112u,112u,65340u},{113u,113u,8764u},
+{114u,115u,8216u},{116u,117u,8220u},{118u,119u,12308u},{120u,129u,12296u},
+{130u,130u,177u},{131u,131u,215u},{132u,132u,247u},{133u,133u,8800u},
+{134u,135u,8804u},{136u,136u,8734u},{137u,137u,8756u},{138u,138u,176u},
+{139u,140u,8242u},{141u,141u,8451u},{142u,142u,8491u},{143u,144u,65504u},
+{145u,145u,65509u},{146u,146u,9794u},{147u,147u,9792u},{148u,148u,8736u},
+{149u,149u,8869u},{150u,150u,8978u},{151u,151u,8706u},{152u,152u,8711u},
+{153u,153u,8801u},{154u,154u,8786u},{155u,155u,167u},{156u,156u,8251u},
+{157u,157u,9734u},{158u,158u,9733u},{159u,159u,9675u},{160u,160u,9679u},
+{161u,161u,9678u},{162u,162u,9671u},{163u,163u,9670u},{164u,164u,9633u},
+{165u,165u,9632u},{166u,166u,9651u},{167u,167u,9650u},{168u,168u,9661u},
+{169u,169u,9660u},{170u,170u,8594u},{171u,172u,8592u},{173u,174u,8595u},
+{175u,175u,12307u},{176u,177u,8810u},{178u,178u,8730u},{179u,179u,8765u},
+{180u,180u,8733u},{181u,181u,8757u},{182u,183u,8747u},{184u,184u,8712u},
+{185u,185u,8715u},{186u,187u,8838u},{188u,189u,8834u},{190u,190u,8746u},
+{191u,191u,8745u},{192u,193u,8743u},{194u,194u,65506u},{195u,195u,8658u},
+{196u,196u,8660u},{197u,197u,8704u},{198u,198u,8707u},{199u,199u,180u},
+{200u,200u,732u},{201u,201u,711u},{202u,202u,728u},{203u,203u,733u},
+{204u,204u,730u},{205u,205u,729u},{206u,206u,184u},{207u,207u,731u},
+{208u,208u,161u},{209u,209u,191u},{210u,210u,8758u},{211u,211u,8750u},
+{212u,212u,8721u},{213u,213u,8719u},{214u,214u,164u},{215u,215u,8457u},
+{216u,216u,8240u},{217u,217u,9665u},{218u,218u,9664u},{219u,219u,9655u},
+{220u,220u,9654u},{221u,221u,9828u},{222u,223u,9824u},{224u,224u,9829u},
+{225u,225u,9831u},{226u,226u,9827u},{227u,227u,8857u},{228u,228u,9672u},
+{229u,229u,9635u},{230u,231u,9680u},{232u,232u,9618u},{233u,234u,9636u},
+{235u,235u,9640u},{236u,236u,9639u},{237u,237u,9638u},{238u,238u,9641u},
+{239u,239u,9832u},{240u,240u,9743u},{241u,241u,9742u},{242u,242u,9756u},
+{243u,243u,9758u},{244u,244u,182u},{245u,246u,8224u},{247u,247u,8597u},
+{248u,248u,8599u},{249u,249u,8601u},{250u,250u,8598u},{251u,251u,8600u},
+{252u,252u,9837u},{253u,254u,9833u},{255u,255u,9836u},{256u,256u,12927u},
+{257u,257u,12828u},{258u,258u,8470u},{259u,259u,13255u},{260u,260u,8482u},
+{261u,261u,13250u},{262u,262u,13272u},{263u,263u,8481u},{264u,322u,65281u},
+{323u,323u,65510u},{324u,356u,65341u},{357u,357u,65507u},{358u,408u,12593u},
+{409u,450u,12645u},{451u,460u,8560u},{461u,470u,8544u},{471u,487u,913u},
+{488u,494u,931u},{495u,511u,945u},{512u,518u,963u},{519u,519u,9472u},
+{520u,520u,9474u},{521u,521u,9484u},{522u,522u,9488u},{523u,523u,9496u},
+{524u,524u,9492u},{525u,525u,9500u},{526u,526u,9516u},{527u,527u,9508u},
+{528u,528u,9524u},{529u,529u,9532u},{530u,530u,9473u},{531u,531u,9475u},
+{532u,532u,9487u},{533u,533u,9491u},{534u,534u,9499u},{535u,535u,9495u},
+{536u,536u,9507u},{537u,537u,9523u},{538u,538u,9515u},{539u,539u,9531u},
+{540u,540u,9547u},{541u,541u,9504u},{542u,542u,9519u},{543u,543u,9512u},
+{544u,544u,9527u},{545u,545u,9535u},{546u,546u,9501u},{547u,547u,9520u},
+{548u,548u,9509u},{549u,549u,9528u},{550u,550u,9538u},{551u,551u,9490u},
+{552u,552u,9489u},{553u,553u,9498u},{554u,554u,9497u},{555u,555u,9494u},
+{556u,556u,9493u},{557u,557u,9486u},{558u,558u,9485u},{559u,560u,9502u},
+{561u,562u,9505u},{563u,564u,9510u},{565u,566u,9513u},{567u,568u,9517u},
+{569u,570u,9521u},{571u,572u,9525u},{573u,574u,9529u},{575u,576u,9533u},
+{577u,578u,9536u},{579u,586u,9539u},{587u,589u,13205u},{590u,590u,8467u},
+{591u,591u,13208u},{592u,592u,13252u},{593u,596u,13219u},{597u,606u,13209u},
+{607u,607u,13258u},{608u,610u,13197u},{611u,611u,13263u},{612u,613u,13192u},
+{614u,614u,13256u},{615u,616u,13223u},{617u,626u,13232u},{627u,631u,13184u},
+{632u,637u,13242u},{638u,642u,13200u},{643u,643u,8486u},{644u,645u,13248u},
+{646u,648u,13194u},{649u,649u,13270u},{650u,650u,13253u},{651u,653u,13229u},
+{654u,654u,13275u},{655u,658u,13225u},{659u,659u,13277u},{660u,660u,13264u},
+{661u,661u,13267u},{662u,662u,13251u},{663u,663u,13257u},{664u,664u,13276u},
+{665u,665u,13254u},{666u,666u,198u},{667u,667u,208u},{668u,668u,170u},
+{669u,669u,294u},{670u,670u,306u},{671u,671u,319u},{672u,672u,321u},
+{673u,673u,216u},{674u,674u,338u},{675u,675u,186u},{676u,676u,222u},
+{677u,677u,358u},{678u,678u,330u},{679u,706u,12896u},{707u,732u,9424u},
+{733u,747u,9312u},{748u,748u,189u},{749u,750u,8531u},{751u,751u,188u},
+{752u,752u,190u},{753u,756u,8539u},{757u,757u,230u},{758u,758u,273u},
+{759u,759u,240u},{760u,760u,295u},{761u,761u,305u},{762u,762u,307u},
+{763u,763u,312u},{764u,764u,320u},{765u,765u,322u},{766u,766u,248u},
+{767u,767u,339u},{768u,768u,223u},{769u,769u,254u},{770u,770u,359u},
+{771u,771u,331u},{772u,772u,329u},{773u,800u,12800u},{801u,826u,9372u},
+{827u,841u,9332u},{842u,842u,185u},{843u,844u,178u},{845u,845u,8308u},
+{846u,846u,8319u},{847u,850u,8321u},{851u,933u,12353u},{934u,1019u,12449u},
+{1020u,1025u,1040u},{1026u,1026u,1025u},{1027u,1058u,1046u},{1059u,1059u,1105u},
+{1060u,1085u,1078u},{1086u,1087u,44032u},{1088u,1088u,44036u},{1089u,1092u,44039u},
+{1093u,1100u,44048u},{1101u,1105u,44057u},{1106u,1106u,44064u},{1107u,1107u,44068u},
+{1108u,1109u,44076u},{1110u,1112u,44079u},{1113u,1114u,44088u},{1115u,1115u,44092u},
+{1116u,1116u,44096u},{1117u,1117u,44107u},{1118u,1118u,44109u},{1119u,1119u,44116u},
+{1120u,1120u,44120u},{1121u,1121u,44124u},{1122u,1123u,44144u},{1124u,1124u,44148u},
+{1125u,1126u,44151u},{1127u,1127u,44154u},{1128u,1129u,44160u},{1130u,1133u,44163u},
+{1134u,1137u,44169u},{1138u,1138u,44176u},{1139u,1139u,44180u},{1140u,1141u,44188u},
+{1142u,1144u,44191u},{1145u,1147u,44200u},{1148u,1148u,44204u},{1149u,1150u,44207u},
+{1151u,1152u,44216u},{1153u,1155u,44219u},{1156u,1156u,44225u},{1157u,1157u,44228u},
+{1158u,1158u,44232u},{1159u,1159u,44236u},{1160u,1160u,44245u},{1161u,1161u,44247u},
+{1162u,1163u,44256u},{1164u,1164u,44260u},{1165u,1166u,44263u},{1167u,1167u,44266u},
+{1168u,1168u,44268u},{1169u,1171u,44271u},{1172u,1172u,44275u},{1173u,1174u,44277u},
+{1175u,1176u,44284u},{1177u,1177u,44288u},{1178u,1178u,44292u},{1179u,1179u,44294u},
+{1180u,1181u,44300u},{1182u,1182u,44303u},{1183u,1183u,44305u},{1184u,1184u,44312u},
+{1185u,1185u,44316u},{1186u,1186u,44320u},{1187u,1187u,44329u},{1188u,1189u,44332u},
+{1190u,1191u,44340u},{1192u,1192u,44344u},{1193u,1193u,44348u},{1194u,1195u,44356u},
+{1196u,1196u,44359u},{1197u,1197u,44361u},{1198u,1198u,44368u},{1199u,1199u,44372u},
+{1200u,1200u,44376u},{1201u,1201u,44385u},{1202u,1202u,44387u},{1203u,1204u,44396u},
+{1205u,1205u,44400u},{1206u,1209u,44403u},{1210u,1212u,44411u},{1213u,1213u,44415u},
+{1214u,1215u,44417u},{1216u,1217u,44424u},{1218u,1218u,44428u},{1219u,1219u,44432u},
+{1220u,1221u,44444u},{1222u,1222u,44452u},{1223u,1223u,44471u},{1224u,1225u,44480u},
+{1226u,1226u,44484u},{1227u,1227u,44488u},{1228u,1229u,44496u},{1230u,1230u,44499u},
+{1231u,1231u,44508u},{1232u,1232u,44512u},{1233u,1233u,44516u},{1234u,1235u,44536u},
+{1236u,1236u,44540u},{1237u,1239u,44543u},{1240u,1241u,44552u},{1242u,1242u,44555u},
+{1243u,1243u,44557u},{1244u,1244u,44564u},{1245u,1246u,44592u},{1247u,1247u,44596u},
+{1248u,1249u,44599u},{1250u,1250u,44602u},{1251u,1252u,44608u},{1253u,1253u,44611u},
+{1254u,1255u,44613u},{1256u,1256u,44618u},{1257u,1259u,44620u},{1260u,1260u,44624u},
+{1261u,1261u,44628u},{1262u,1262u,44630u},{1263u,1264u,44636u},{1265u,1267u,44639u},
+{1268u,1268u,44645u},{1269u,1270u,44648u},{1271u,1271u,44652u},{1272u,1272u,44656u},
+{1273u,1274u,44664u},{1275u,1277u,44667u},{1278u,1279u,44676u},{1280u,1280u,44684u},
+{1281u,1283u,44732u},{1284u,1284u,44736u},{1285u,1285u,44740u},{1286u,1287u,44748u},
+{1288u,1290u,44751u},{1291u,1292u,44760u},{1293u,1293u,44764u},{1294u,1294u,44776u},
+{1295u,1295u,44779u},{1296u,1296u,44781u},{1297u,1297u,44788u},{1298u,1298u,44792u},
+{1299u,1299u,44796u},{1300u,1301u,44807u},{1302u,1302u,44813u},{1303u,1303u,44816u},
+{1304u,1305u,44844u},{1306u,1306u,44848u},{1307u,1307u,44850u},{1308u,1308u,44852u},
+{1309u,1310u,44860u},{1311u,1311u,44863u},{1312u,1314u,44865u},{1315u,1316u,44872u},
+{1317u,1317u,44880u},{1318u,1319u,44892u},{1320u,1321u,44900u},{1322u,1322u,44921u},
+{1323u,1323u,44928u},{1324u,1324u,44932u},{1325u,1325u,44936u},{1326u,1327u,44944u},
+{1328u,1328u,44949u},{1329u,1329u,44956u},{1330u,1331u,44984u},{1332u,1332u,44988u},
+{1333u,1333u,44992u},{1334u,1336u,44999u},{1337u,1337u,45003u},{1338u,1339u,45005u},
+{1340u,1340u,45012u},{1341u,1341u,45020u},{1342u,1343u,45032u},{1344u,1345u,45040u},
+{1346u,1346u,45044u},{1347u,1347u,45048u},{1348u,1349u,45056u},{1350u,1350u,45060u},
+{1351u,1351u,45068u},{1352u,1352u,45072u},{1353u,1353u,45076u},{1354u,1355u,45084u},
+{1356u,1356u,45096u},{1357u,1358u,45124u},{1359u,1359u,45128u},{1360u,1360u,45130u},
+{1361u,1361u,45132u},{1362u,1362u,45134u},{1363u,1365u,45139u},{1366u,1366u,45143u},
+{1367u,1367u,45145u},{1368u,1368u,45149u},{1369u,1370u,45180u},{1371u,1371u,45184u},
+{1372u,1372u,45188u},{1373u,1374u,45196u},{1375u,1375u,45199u},{1376u,1376u,45201u},
+{1377u,1379u,45208u},{1380u,1380u,45212u},{1381u,1384u,45215u},{1385u,1386u,45224u},
+{1387u,1391u,45227u},{1392u,1392u,45233u},{1393u,1395u,45235u},{1396u,1396u,45240u},
+{1397u,1397u,45244u},{1398u,1399u,45252u},{1400u,1402u,45255u},{1403u,1404u,45264u},
+{1405u,1405u,45268u},{1406u,1406u,45272u},{1407u,1407u,45280u},{1408u,1408u,45285u},
+{1409u,1410u,45320u},{1411u,1412u,45323u},{1413u,1413u,45328u},{1414u,1415u,45330u},
+{1416u,1417u,45336u},{1418u,1420u,45339u},{1421u,1423u,45347u},{1424u,1424u,45352u},
+{1425u,1425u,45356u},{1426u,1427u,45364u},{1428u,1430u,45367u},{1431u,1432u,45376u},
+{1433u,1433u,45380u},{1434u,1434u,45384u},{1435u,1436u,45392u},{1437u,1438u,45396u},
+{1439u,1439u,45400u},{1440u,1440u,45404u},{1441u,1441u,45408u},{1442u,1443u,45432u},
+{1444u,1444u,45436u},{1445u,1445u,45440u},{1446u,1446u,45442u},{1447u,1448u,45448u},
+{1449u,1449u,45451u},{1450u,1450u,45453u},{1451u,1453u,45458u},{1454u,1454u,45464u},
+{1455u,1455u,45468u},{1456u,1456u,45480u},{1457u,1457u,45516u},{1458u,1458u,45520u},
+{1459u,1459u,45524u},{1460u,1461u,45532u},{1462u,1462u,45535u},{1463u,1464u,45544u},
+{1465u,1465u,45548u},{1466u,1466u,45552u},{1467u,1467u,45561u},{1468u,1468u,45563u},
+{1469u,1469u,45565u},{1470u,1471u,45572u},{1472u,1472u,45576u},{1473u,1474u,45579u},
+{1475u,1476u,45588u},{1477u,1477u,45591u},{1478u,1478u,45593u},{1479u,1479u,45600u},
+{1480u,1480u,45620u},{1481u,1481u,45628u},{1482u,1482u,45656u},{1483u,1483u,45660u},
+{1484u,1484u,45664u},{1485u,1486u,45672u},{1487u,1488u,45684u},{1489u,1489u,45692u},
+{1490u,1491u,45700u},{1492u,1492u,45705u},{1493u,1494u,45712u},{1495u,1495u,45716u},
+{1496u,1498u,45720u},{1499u,1500u,45728u},{1501u,1501u,45731u},{1502u,1503u,45733u},
+{1504u,1504u,45738u},{1505u,1505u,45740u},{1506u,1506u,45744u},{1507u,1507u,45748u},
+{1508u,1509u,45768u},{1510u,1510u,45772u},{1511u,1511u,45776u},{1512u,1512u,45778u},
+{1513u,1514u,45784u},{1515u,1515u,45787u},{1516u,1516u,45789u},{1517u,1517u,45794u},
+{1518u,1520u,45796u},{1521u,1521u,45800u},{1522u,1526u,45803u},{1527u,1529u,45811u},
+{1530u,1534u,45815u},{1535u,1537u,45823u},{1538u,1538u,45828u},{1539u,1539u,45832u},
+{1540u,1541u,45840u},{1542u,1544u,45843u},{1545u,1545u,45852u},{1546u,1548u,45908u},
+{1549u,1549u,45912u},{1550u,1551u,45915u},{1552u,1553u,45918u},{1554u,1555u,45924u},
+{1556u,1556u,45927u},{1557u,1557u,45929u},{1558u,1558u,45931u},{1559u,1559u,45934u},
+{1560u,1561u,45936u},{1562u,1562u,45940u},{1563u,1563u,45944u},{1564u,1565u,45952u},
+{1566u,1568u,45955u},{1569u,1569u,45964u},{1570u,1570u,45968u},{1571u,1571u,45972u},
+{1572u,1573u,45984u},{1574u,1574u,45992u},{1575u,1575u,45996u},{1576u,1577u,46020u},
+{1578u,1578u,46024u},{1579u,1580u,46027u},{1581u,1581u,46030u},{1582u,1582u,46032u},
+{1583u,1584u,46036u},{1585u,1585u,46039u},{1586u,1586u,46041u},{1587u,1587u,46043u},
+{1588u,1588u,46045u},{1589u,1589u,46048u},{1590u,1590u,46052u},{1591u,1591u,46056u},
+{1592u,1592u,46076u},{1593u,1593u,46096u},{1594u,1594u,46104u},{1595u,1595u,46108u},
+{1596u,1596u,46112u},{1597u,1598u,46120u},{1599u,1599u,46123u},{1600u,1600u,46132u},
+{1601u,1602u,46160u},{1603u,1603u,46164u},{1604u,1604u,46168u},{1605u,1606u,46176u},
+{1607u,1607u,46179u},{1608u,1608u,46181u},{1609u,1609u,46188u},{1610u,1610u,46208u},
+{1611u,1611u,46216u},{1612u,1612u,46237u},{1613u,1613u,46244u},{1614u,1614u,46248u},
+{1615u,1615u,46252u},{1616u,1616u,46261u},{1617u,1617u,46263u},{1618u,1618u,46265u},
+{1619u,1619u,46272u},{1620u,1620u,46276u},{1621u,1621u,46280u},{1622u,1622u,46288u},
+{1623u,1623u,46293u},{1624u,1625u,46300u},{1626u,1626u,46304u},{1627u,1628u,46307u},
+{1629u,1629u,46310u},{1630u,1631u,46316u},{1632u,1632u,46319u},{1633u,1633u,46321u},
+{1634u,1634u,46328u},{1635u,1636u,46356u},{1637u,1637u,46360u},{1638u,1639u,46363u},
+{1640u,1641u,46372u},{1642u,1645u,46375u},{1646u,1647u,46384u},{1648u,1648u,46388u},
+{1649u,1649u,46392u},{1650u,1651u,46400u},{1652u,1654u,46403u},{1655u,1657u,46411u},
+{1658u,1658u,46416u},{1659u,1659u,46420u},{1660u,1661u,46428u},{1662u,1664u,46431u},
+{1665u,1666u,46496u},{1667u,1667u,46500u},{1668u,1668u,46504u},{1669u,1670u,46506u},
+{1671u,1672u,46512u},{1673u,1675u,46515u},{1676u,1678u,46523u},{1679u,1679u,46528u},
+{1680u,1680u,46532u},{1681u,1682u,46540u},{1683u,1685u,46543u},{1686u,1686u,46552u},
+{1687u,1687u,46572u},{1688u,1689u,46608u},{1690u,1690u,46612u},{1691u,1691u,46616u},
+{1692u,1692u,46629u},{1693u,1693u,46636u},{1694u,1694u,46644u},{1695u,1695u,46664u},
+{1696u,1696u,46692u},{1697u,1697u,46696u},{1698u,1699u,46748u},{1700u,1700u,46752u},
+{1701u,1701u,46756u},{1702u,1703u,46763u},{1704u,1704u,46769u},{1705u,1705u,46804u},
+{1706u,1706u,46832u},{1707u,1707u,46836u},{1708u,1708u,46840u},{1709u,1710u,46848u},
+{1711u,1711u,46853u},{1712u,1713u,46888u},{1714u,1714u,46892u},{1715u,1716u,46895u},
+{1717u,1718u,46904u},{1719u,1719u,46907u},{1720u,1720u,46916u},{1721u,1721u,46920u},
+{1722u,1722u,46924u},{1723u,1724u,46932u},{1725u,1725u,46944u},{1726u,1726u,46948u},
+{1727u,1727u,46952u},{1728u,1729u,46960u},{1730u,1730u,46963u},{1731u,1731u,46965u},
+{1732u,1733u,46972u},{1734u,1734u,46976u},{1735u,1735u,46980u},{1736u,1737u,46988u},
+{1738u,1741u,46991u},{1742u,1745u,46998u},{1746u,1746u,47004u},{1747u,1747u,47008u},
+{1748u,1749u,47016u},{1750u,1752u,47019u},{1753u,1754u,47028u},{1755u,1755u,47032u},
+{1756u,1756u,47047u},{1757u,1757u,47049u},{1758u,1759u,47084u},{1760u,1760u,47088u},
+{1761u,1761u,47092u},{1762u,1763u,47100u},{1764u,1766u,47103u},{1767u,1769u,47111u},
+{1770u,1770u,47116u},{1771u,1771u,47120u},{1772u,1773u,47128u},{1774u,1774u,47131u},
+{1775u,1775u,47133u},{1776u,1777u,47140u},{1778u,1778u,47144u},{1779u,1779u,47148u},
+{1780u,1781u,47156u},{1782u,1784u,47159u},{1785u,1785u,47168u},{1786u,1786u,47172u},
+{1787u,1787u,47185u},{1788u,1788u,47187u},{1789u,1790u,47196u},{1791u,1791u,47200u},
+{1792u,1792u,47204u},{1793u,1794u,47212u},{1795u,1795u,47215u},{1796u,1796u,47217u},
+{1797u,1797u,47224u},{1798u,1798u,47228u},{1799u,1799u,47245u},{1800u,1800u,47272u},
+{1801u,1801u,47280u},{1802u,1802u,47284u},{1803u,1803u,47288u},{1804u,1805u,47296u},
+{1806u,1806u,47299u},{1807u,1807u,47301u},{1808u,1808u,47308u},{1809u,1809u,47312u},
+{1810u,1810u,47316u},{1811u,1811u,47325u},{1812u,1812u,47327u},{1813u,1813u,47329u},
+{1814u,1815u,47336u},{1816u,1816u,47340u},{1817u,1817u,47344u},{1818u,1819u,47352u},
+{1820u,1820u,47355u},{1821u,1821u,47357u},{1822u,1822u,47364u},{1823u,1823u,47384u},
+{1824u,1824u,47392u},{1825u,1826u,47420u},{1827u,1827u,47424u},{1828u,1828u,47428u},
+{1829u,1829u,47436u},{1830u,1830u,47439u},{1831u,1831u,47441u},{1832u,1833u,47448u},
+{1834u,1834u,47452u},{1835u,1835u,47456u},{1836u,1837u,47464u},{1838u,1838u,47467u},
+{1839u,1839u,47469u},{1840u,1841u,47476u},{1842u,1842u,47480u},{1843u,1843u,47484u},
+{1844u,1845u,47492u},{1846u,1846u,47495u},{1847u,1848u,47497u},{1849u,1850u,47501u},
+{1851u,1852u,47532u},{1853u,1853u,47536u},{1854u,1854u,47540u},{1855u,1856u,47548u},
+{1857u,1857u,47551u},{1858u,1858u,47553u},{1859u,1860u,47560u},{1861u,1861u,47564u},
+{1862u,1866u,47566u},{1867u,1868u,47576u},{1869u,1869u,47579u},{1870u,1871u,47581u},
+{1872u,1872u,47585u},{1873u,1875u,47587u},{1876u,1876u,47592u},{1877u,1877u,47596u},
+{1878u,1879u,47604u},{1880u,1883u,47607u},{1884u,1885u,47616u},{1886u,1886u,47624u},
+{1887u,1887u,47637u},{1888u,1889u,47672u},{1890u,1890u,47676u},{1891u,1891u,47680u},
+{1892u,1892u,47682u},{1893u,1894u,47688u},{1895u,1895u,47691u},{1896u,1897u,47693u},
+{1898u,1900u,47699u},{1901u,1901u,47704u},{1902u,1902u,47708u},{1903u,1904u,47716u},
+{1905u,1907u,47719u},{1908u,1909u,47728u},{1910u,1910u,47732u},{1911u,1911u,47736u},
+{1912u,1914u,47747u},{1915u,1915u,47751u},{1916u,1916u,47756u},{1917u,1918u,47784u},
+{1919u,1920u,47787u},{1921u,1921u,47792u},{1922u,1922u,47794u},{1923u,1924u,47800u},
+{1925u,1925u,47803u},{1926u,1926u,47805u},{1927u,1927u,47812u},{1928u,1928u,47816u},
+{1929u,1930u,47832u},{1931u,1931u,47868u},{1932u,1932u,47872u},{1933u,1933u,47876u},
+{1934u,1934u,47885u},{1935u,1935u,47887u},{1936u,1936u,47889u},{1937u,1937u,47896u},
+{1938u,1938u,47900u},{1939u,1939u,47904u},{1940u,1940u,47913u},{1941u,1941u,47915u},
+{1942u,1944u,47924u},{1945u,1945u,47928u},{1946u,1949u,47931u},{1950u,1951u,47940u},
+{1952u,1952u,47943u},{1953u,1953u,47945u},{1954u,1954u,47949u},{1955u,1956u,47951u},
+{1957u,1957u,47956u},{1958u,1958u,47960u},{1959u,1959u,47969u},{1960u,1960u,47971u},
+{1961u,1961u,47980u},{1962u,1962u,48008u},{1963u,1963u,48012u},{1964u,1964u,48016u},
+{1965u,1965u,48036u},{1966u,1966u,48040u},{1967u,1967u,48044u},{1968u,1968u,48052u},
+{1969u,1969u,48055u},{1970u,1970u,48064u},{1971u,1971u,48068u},{1972u,1972u,48072u},
+{1973u,1973u,48080u},{1974u,1974u,48083u},{1975u,1976u,48120u},{1977u,1977u,48124u},
+{1978u,1979u,48127u},{1980u,1980u,48130u},{1981u,1982u,48136u},{1983u,1985u,48139u},
+{1986u,1986u,48143u},{1987u,1987u,48145u},{1988u,1992u,48148u},{1993u,1997u,48155u},
+{1998u,1999u,48164u},{2000u,2000u,48167u},{2001u,2001u,48169u},{2002u,2002u,48173u},
+{2003u,2004u,48176u},{2005u,2005u,48180u},{2006u,2006u,48184u},{2007u,2008u,48192u},
+{2009u,2011u,48195u},{2012u,2012u,48201u},{2013u,2014u,48204u},{2015u,2015u,48208u},
+{2016u,2016u,48221u},{2017u,2018u,48260u},{2019u,2019u,48264u},{2020u,2021u,48267u},
+{2022u,2022u,48270u},{2023u,2024u,48276u},{2025u,2025u,48279u},{2026u,2027u,48281u},
+{2028u,2029u,48288u},{2030u,2030u,48292u},{2031u,2032u,48295u},{2033u,2034u,48304u},
+{2035u,2037u,48307u},{2038u,2039u,48316u},{2040u,2040u,48320u},{2041u,2041u,48324u},
+{2042u,2042u,48333u},{2043u,2045u,48335u},{2046u,2046u,48341u},{2047u,2047u,48344u},
+{2048u,2048u,48348u},{2049u,2051u,48372u},{2052u,2052u,48376u},{2053u,2053u,48380u},
+{2054u,2055u,48388u},{2056u,2056u,48391u},{2057u,2057u,48393u},{2058u,2058u,48400u},
+{2059u,2059u,48404u},{2060u,2060u,48420u},{2061u,2061u,48428u},{2062u,2062u,48448u},
+{2063u,2064u,48456u},{2065u,2065u,48460u},{2066u,2066u,48464u},{2067u,2068u,48472u},
+{2069u,2069u,48484u},{2070u,2070u,48488u},{2071u,2072u,48512u},{2073u,2073u,48516u},
+{2074u,2077u,48519u},{2078u,2079u,48528u},{2080u,2080u,48531u},{2081u,2081u,48533u},
+{2082u,2083u,48537u},{2084u,2084u,48540u},{2085u,2085u,48548u},{2086u,2086u,48560u},
+{2087u,2087u,48568u},{2088u,2089u,48596u},{2090u,2090u,48600u},{2091u,2091u,48604u},
+{2092u,2092u,48617u},{2093u,2093u,48624u},{2094u,2094u,48628u},{2095u,2095u,48632u},
+{2096u,2096u,48640u},{2097u,2097u,48643u},{2098u,2098u,48645u},{2099u,2100u,48652u},
+{2101u,2101u,48656u},{2102u,2102u,48660u},{2103u,2104u,48668u},{2105u,2105u,48671u},
+{2106u,2107u,48708u},{2108u,2108u,48712u},{2109u,2109u,48716u},{2110u,2110u,48718u},
+{2111u,2112u,48724u},{2113u,2113u,48727u},{2114u,2116u,48729u},{2117u,2118u,48736u},
+{2119u,2119u,48740u},{2120u,2120u,48744u},{2121u,2121u,48746u},{2122u,2123u,48752u},
+{2124u,2126u,48755u},{2127u,2129u,48763u},{2130u,2130u,48768u},{2131u,2131u,48772u},
+{2132u,2133u,48780u},{2134u,2136u,48783u},{2137u,2138u,48792u},{2139u,2139u,48808u},
+{2140u,2141u,48848u},{2142u,2142u,48852u},{2143u,2144u,48855u},{2145u,2145u,48864u},
+{2146u,2148u,48867u},{2149u,2149u,48876u},{2150u,2150u,48897u},{2151u,2152u,48904u},
+{2153u,2154u,48920u},{2155u,2157u,48923u},{2158u,2159u,48960u},{2160u,2160u,48964u},
+{2161u,2161u,48968u},{2162u,2163u,48976u},{2164u,2164u,48981u},{2165u,2165u,49044u},
+{2166u,2166u,49072u},{2167u,2167u,49093u},{2168u,2169u,49100u},{2170u,2170u,49104u},
+{2171u,2171u,49108u},{2172u,2172u,49116u},{2173u,2173u,49119u},{2174u,2174u,49121u},
+{2175u,2175u,49212u},{2176u,2176u,49233u},{2177u,2177u,49240u},{2178u,2178u,49244u},
+{2179u,2179u,49248u},{2180u,2181u,49256u},{2182u,2183u,49296u},{2184u,2184u,49300u},
+{2185u,2185u,49304u},{2186u,2187u,49312u},{2188u,2188u,49315u},{2189u,2189u,49317u},
+{2190u,2191u,49324u},{2192u,2193u,49327u},{2194u,2197u,49331u},{2198u,2199u,49340u},
+{2200u,2202u,49343u},{2203u,2203u,49349u},{2204u,2205u,49352u},{2206u,2206u,49356u},
+{2207u,2207u,49360u},{2208u,2209u,49368u},{2210u,2212u,49371u},{2213u,2214u,49380u},
+{2215u,2215u,49384u},{2216u,2216u,49388u},{2217u,2218u,49396u},{2219u,2219u,49399u},
+{2220u,2220u,49401u},{2221u,2221u,49408u},{2222u,2222u,49412u},{2223u,2223u,49416u},
+{2224u,2224u,49424u},{2225u,2225u,49429u},{2226u,2230u,49436u},{2231u,2232u,49443u},
+{2233u,2234u,49446u},{2235u,2236u,49452u},{2237u,2239u,49455u},{2240u,2240u,49462u},
+{2241u,2242u,49464u},{2243u,2243u,49468u},{2244u,2244u,49472u},{2245u,2246u,49480u},
+{2247u,2249u,49483u},{2250u,2251u,49492u},{2252u,2252u,49496u},{2253u,2253u,49500u},
+{2254u,2255u,49508u},{2256u,2258u,49511u},{2259u,2259u,49520u},{2260u,2260u,49524u},
+{2261u,2261u,49528u},{2262u,2262u,49541u},{2263u,2265u,49548u},{2266u,2266u,49552u},
+{2267u,2267u,49556u},{2268u,2268u,49558u},{2269u,2270u,49564u},{2271u,2271u,49567u},
+{2272u,2272u,49569u},{2273u,2273u,49573u},{2274u,2275u,49576u},{2276u,2276u,49580u},
+{2277u,2277u,49584u},{2278u,2278u,49597u},{2279u,2279u,49604u},{2280u,2280u,49608u},
+{2281u,2281u,49612u},{2282u,2282u,49620u},{2283u,2284u,49623u},{2285u,2285u,49632u},
+{2286u,2286u,49636u},{2287u,2287u,49640u},{2288u,2289u,49648u},{2290u,2290u,49651u},
+{2291u,2292u,49660u},{2293u,2293u,49664u},{2294u,2294u,49668u},{2295u,2296u,49676u},
+{2297u,2297u,49679u},{2298u,2298u,49681u},{2299u,2300u,49688u},{2301u,2301u,49692u},
+{2302u,2303u,49695u},{2304u,2305u,49704u},{2306u,2306u,49707u},{2307u,2307u,49709u},
+{2308u,2308u,49711u},{2309u,2310u,49713u},{2311u,2311u,49716u},{2312u,2312u,49736u},
+{2313u,2314u,49744u},{2315u,2315u,49748u},{2316u,2316u,49752u},{2317u,2317u,49760u},
+{2318u,2318u,49765u},{2319u,2320u,49772u},{2321u,2321u,49776u},{2322u,2322u,49780u},
+{2323u,2324u,49788u},{2325u,2325u,49791u},{2326u,2326u,49793u},{2327u,2328u,49800u},
+{2329u,2329u,49808u},{2330u,2330u,49816u},{2331u,2331u,49819u},{2332u,2332u,49821u},
+{2333u,2334u,49828u},{2335u,2335u,49832u},{2336u,2337u,49836u},{2338u,2339u,49844u},
+{2340u,2340u,49847u},{2341u,2341u,49849u},{2342u,2343u,49884u},{2344u,2344u,49888u},
+{2345u,2346u,49891u},{2347u,2349u,49899u},{2350u,2350u,49903u},{2351u,2351u,49905u},
+{2352u,2352u,49910u},{2353u,2354u,49912u},{2355u,2356u,49915u},{2357u,2357u,49920u},
+{2358u,2359u,49928u},{2360u,2361u,49932u},{2362u,2364u,49939u},{2365u,2365u,49944u},
+{2366u,2366u,49948u},{2367u,2368u,49956u},{2369u,2370u,49960u},{2371u,2371u,49989u},
+{2372u,2373u,50024u},{2374u,2374u,50028u},{2375u,2375u,50032u},{2376u,2376u,50034u},
+{2377u,2378u,50040u},{2379u,2380u,50044u},{2381u,2381u,50052u},{2382u,2382u,50056u},
+{2383u,2383u,50060u},{2384u,2384u,50112u},{2385u,2386u,50136u},{2387u,2387u,50140u},
+{2388u,2389u,50143u},{2390u,2390u,50146u},{2391u,2392u,50152u},{2393u,2393u,50157u},
+{2394u,2395u,50164u},{2396u,2396u,50168u},{2397u,2397u,50184u},{2398u,2398u,50192u},
+{2399u,2399u,50212u},{2400u,2400u,50220u},{2401u,2401u,50224u},{2402u,2402u,50228u},
+{2403u,2404u,50236u},{2405u,2405u,50248u},{2406u,2407u,50276u},{2408u,2408u,50280u},
+{2409u,2409u,50284u},{2410u,2411u,50292u},{2412u,2412u,50297u},{2413u,2413u,50304u},
+{2414u,2414u,50324u},{2415u,2415u,50332u},{2416u,2416u,50360u},{2417u,2417u,50364u},
+{2418u,2418u,50409u},{2419u,2420u,50416u},{2421u,2421u,50420u},{2422u,2422u,50424u},
+{2423u,2423u,50426u},{2424u,2426u,50431u},{2427u,2427u,50444u},{2428u,2428u,50448u},
+{2429u,2429u,50452u},{2430u,2430u,50460u},{2431u,2432u,50472u},{2433u,2433u,50476u},
+{2434u,2434u,50480u},{2435u,2436u,50488u},{2437u,2437u,50491u},{2438u,2438u,50493u},
+{2439u,2440u,50500u},{2441u,2443u,50504u},{2444u,2446u,50508u},{2447u,2449u,50515u},
+{2450u,2452u,50519u},{2453u,2454u,50525u},{2455u,2456u,50528u},{2457u,2457u,50532u},
+{2458u,2458u,50536u},{2459u,2460u,50544u},{2461u,2463u,50547u},{2464u,2465u,50556u},
+{2466u,2466u,50560u},{2467u,2467u,50564u},{2468u,2468u,50567u},{2469u,2470u,50572u},
+{2471u,2471u,50575u},{2472u,2472u,50577u},{2473u,2473u,50581u},{2474u,2475u,50583u},
+{2476u,2476u,50588u},{2477u,2477u,50592u},{2478u,2478u,50601u},{2479u,2480u,50612u},
+{2481u,2482u,50616u},{2483u,2486u,50619u},{2487u,2493u,50628u},{2494u,2494u,50636u},
+{2495u,2495u,50638u},{2496u,2497u,50640u},{2498u,2498u,50644u},{2499u,2499u,50648u},
+{2500u,2501u,50656u},{2502u,2502u,50659u},{2503u,2503u,50661u},{2504u,2506u,50668u},
+{2507u,2507u,50672u},{2508u,2508u,50676u},{2509u,2510u,50678u},{2511u,2516u,50684u},
+{2517u,2520u,50693u},{2521u,2521u,50700u},{2522u,2522u,50704u},{2523u,2524u,50712u},
+{2525u,2526u,50715u},{2527u,2528u,50724u},{2529u,2529u,50728u},{2530u,2532u,50732u},
+{2533u,2533u,50736u},{2534u,2536u,50739u},{2537u,2537u,50743u},{2538u,2538u,50745u},
+{2539u,2539u,50747u},{2540u,2541u,50752u},{2542u,2542u,50756u},{2543u,2543u,50760u},
+{2544u,2545u,50768u},{2546u,2548u,50771u},{2549u,2550u,50780u},{2551u,2551u,50784u},
+{2552u,2552u,50796u},{2553u,2553u,50799u},{2554u,2554u,50801u},{2555u,2556u,50808u},
+{2557u,2557u,50812u},{2558u,2558u,50816u},{2559u,2560u,50824u},{2561u,2561u,50827u},
+{2562u,2562u,50829u},{2563u,2564u,50836u},{2565u,2565u,50840u},{2566u,2566u,50844u},
+{2567u,2568u,50852u},{2569u,2569u,50855u},{2570u,2570u,50857u},{2571u,2572u,50864u},
+{2573u,2573u,50868u},{2574u,2576u,50872u},{2577u,2578u,50880u},{2579u,2579u,50883u},
+{2580u,2580u,50885u},{2581u,2582u,50892u},{2583u,2583u,50896u},{2584u,2584u,50900u},
+{2585u,2586u,50908u},{2587u,2588u,50912u},{2589u,2590u,50920u},{2591u,2591u,50924u},
+{2592u,2592u,50928u},{2593u,2594u,50936u},{2595u,2595u,50941u},{2596u,2597u,50948u},
+{2598u,2598u,50952u},{2599u,2599u,50956u},{2600u,2601u,50964u},{2602u,2602u,50967u},
+{2603u,2603u,50969u},{2604u,2605u,50976u},{2606u,2606u,50980u},{2607u,2607u,50984u},
+{2608u,2609u,50992u},{2610u,2610u,50995u},{2611u,2611u,50997u},{2612u,2612u,50999u},
+{2613u,2614u,51004u},{2615u,2615u,51008u},{2616u,2616u,51012u},{2617u,2617u,51018u},
+{2618u,2619u,51020u},{2620u,2620u,51023u},{2621u,2628u,51025u},{2629u,2629u,51036u},
+{2630u,2630u,51040u},{2631u,2631u,51048u},{2632u,2632u,51051u},{2633u,2634u,51060u},
+{2635u,2635u,51064u},{2636u,2638u,51068u},{2639u,2641u,51075u},{2642u,2645u,51079u},
+{2646u,2646u,51086u},{2647u,2648u,51088u},{2649u,2649u,51092u},{2650u,2652u,51094u},
+{2653u,2653u,51098u},{2654u,2655u,51104u},{2656u,2659u,51107u},{2660u,2661u,51116u},
+{2662u,2662u,51120u},{2663u,2663u,51124u},{2664u,2665u,51132u},{2666u,2668u,51135u},
+{2669u,2670u,51144u},{2671u,2671u,51148u},{2672u,2672u,51150u},{2673u,2673u,51152u},
+{2674u,2674u,51160u},{2675u,2675u,51165u},{2676u,2676u,51172u},{2677u,2677u,51176u},
+{2678u,2678u,51180u},{2679u,2680u,51200u},{2681u,2681u,51204u},{2682u,2682u,51208u},
+{2683u,2683u,51210u},{2684u,2685u,51216u},{2686u,2686u,51219u},{2687u,2688u,51221u},
+{2689u,2690u,51228u},{2691u,2691u,51232u},{2692u,2692u,51236u},{2693u,2694u,51244u},
+{2695u,2695u,51247u},{2696u,2696u,51249u},{2697u,2697u,51256u},{2698u,2698u,51260u},
+{2699u,2699u,51264u},{2700u,2701u,51272u},{2702u,2703u,51276u},{2704u,2704u,51284u},
+{2705u,2706u,51312u},{2707u,2707u,51316u},{2708u,2708u,51320u},{2709u,2709u,51322u},
+{2710u,2711u,51328u},{2712u,2712u,51331u},{2713u,2715u,51333u},{2716u,2718u,51339u},
+{2719u,2719u,51348u},{2720u,2720u,51357u},{2721u,2721u,51359u},{2722u,2722u,51361u},
+{2723u,2723u,51368u},{2724u,2725u,51388u},{2726u,2726u,51396u},{2727u,2727u,51400u},
+{2728u,2728u,51404u},{2729u,2730u,51412u},{2731u,2731u,51415u},{2732u,2732u,51417u},
+{2733u,2734u,51424u},{2735u,2735u,51428u},{2736u,2736u,51445u},{2737u,2738u,51452u},
+{2739u,2739u,51456u},{2740u,2742u,51460u},{2743u,2744u,51468u},{2745u,2745u,51471u},
+{2746u,2746u,51473u},{2747u,2747u,51480u},{2748u,2748u,51500u},{2749u,2749u,51508u},
+{2750u,2751u,51536u},{2752u,2752u,51540u},{2753u,2753u,51544u},{2754u,2755u,51552u},
+{2756u,2756u,51555u},{2757u,2757u,51564u},{2758u,2758u,51568u},{2759u,2759u,51572u},
+{2760u,2760u,51580u},{2761u,2762u,51592u},{2763u,2763u,51596u},{2764u,2764u,51600u},
+{2765u,2766u,51608u},{2767u,2767u,51611u},{2768u,2768u,51613u},{2769u,2770u,51648u},
+{2771u,2771u,51652u},{2772u,2773u,51655u},{2774u,2774u,51658u},{2775u,2776u,51664u},
+{2777u,2777u,51667u},{2778u,2779u,51669u},{2780u,2781u,51673u},{2782u,2783u,51676u},
+{2784u,2784u,51680u},{2785u,2785u,51682u},{2786u,2786u,51684u},{2787u,2787u,51687u},
+{2788u,2789u,51692u},{2790u,2792u,51695u},{2793u,2794u,51704u},{2795u,2795u,51708u},
+{2796u,2796u,51712u},{2797u,2798u,51720u},{2799u,2801u,51723u},{2802u,2802u,51732u},
+{2803u,2803u,51736u},{2804u,2804u,51753u},{2805u,2806u,51788u},{2807u,2807u,51792u},
+{2808u,2808u,51796u},{2809u,2810u,51804u},{2811u,2813u,51807u},{2814u,2814u,51816u},
+{2815u,2815u,51837u},{2816u,2816u,51844u},{2817u,2817u,51864u},{2818u,2819u,51900u},
+{2820u,2820u,51904u},{2821u,2821u,51908u},{2822u,2823u,51916u},{2824u,2824u,51919u},
+{2825u,2825u,51921u},{2826u,2826u,51923u},{2827u,2828u,51928u},{2829u,2829u,51936u},
+{2830u,2830u,51948u},{2831u,2831u,51956u},{2832u,2832u,51976u},{2833u,2833u,51984u},
+{2834u,2834u,51988u},{2835u,2835u,51992u},{2836u,2837u,52000u},{2838u,2838u,52033u},
+{2839u,2840u,52040u},{2841u,2841u,52044u},{2842u,2842u,52048u},{2843u,2844u,52056u},
+{2845u,2845u,52061u},{2846u,2846u,52068u},{2847u,2848u,52088u},{2849u,2849u,52124u},
+{2850u,2850u,52152u},{2851u,2851u,52180u},{2852u,2852u,52196u},{2853u,2853u,52199u},
+{2854u,2854u,52201u},{2855u,2856u,52236u},{2857u,2857u,52240u},{2858u,2858u,52244u},
+{2859u,2860u,52252u},{2861u,2862u,52257u},{2863u,2865u,52263u},{2866u,2866u,52268u},
+{2867u,2867u,52270u},{2868u,2868u,52272u},{2869u,2870u,52280u},{2871u,2874u,52283u},
+{2875u,2876u,52292u},{2877u,2877u,52296u},{2878u,2878u,52300u},{2879u,2880u,52308u},
+{2881u,2883u,52311u},{2884u,2884u,52320u},{2885u,2885u,52324u},{2886u,2886u,52326u},
+{2887u,2887u,52328u},{2888u,2888u,52336u},{2889u,2889u,52341u},{2890u,2891u,52376u},
+{2892u,2892u,52380u},{2893u,2893u,52384u},{2894u,2895u,52392u},{2896u,2898u,52395u},
+{2899u,2900u,52404u},{2901u,2901u,52408u},{2902u,2902u,52412u},{2903u,2904u,52420u},
+{2905u,2905u,52423u},{2906u,2906u,52425u},{2907u,2907u,52432u},{2908u,2908u,52436u},
+{2909u,2909u,52452u},{2910u,2910u,52460u},{2911u,2911u,52464u},{2912u,2912u,52481u},
+{2913u,2914u,52488u},{2915u,2915u,52492u},{2916u,2916u,52496u},{2917u,2918u,52504u},
+{2919u,2919u,52507u},{2920u,2920u,52509u},{2921u,2921u,52516u},{2922u,2922u,52520u},
+{2923u,2923u,52524u},{2924u,2924u,52537u},{2925u,2925u,52572u},{2926u,2926u,52576u},
+{2927u,2927u,52580u},{2928u,2929u,52588u},{2930u,2930u,52591u},{2931u,2931u,52593u},
+{2932u,2932u,52600u},{2933u,2933u,52616u},{2934u,2935u,52628u},{2936u,2936u,52632u},
+{2937u,2937u,52636u},{2938u,2939u,52644u},{2940u,2940u,52647u},{2941u,2941u,52649u},
+{2942u,2942u,52656u},{2943u,2943u,52676u},{2944u,2944u,52684u},{2945u,2945u,52688u},
+{2946u,2946u,52712u},{2947u,2947u,52716u},{2948u,2948u,52720u},{2949u,2950u,52728u},
+{2951u,2951u,52731u},{2952u,2952u,52733u},{2953u,2953u,52740u},{2954u,2954u,52744u},
+{2955u,2955u,52748u},{2956u,2956u,52756u},{2957u,2957u,52761u},{2958u,2959u,52768u},
+{2960u,2960u,52772u},{2961u,2961u,52776u},{2962u,2963u,52784u},{2964u,2964u,52787u},
+{2965u,2965u,52789u},{2966u,2967u,52824u},{2968u,2968u,52828u},{2969u,2971u,52831u},
+{2972u,2973u,52840u},{2974u,2974u,52843u},{2975u,2975u,52845u},{2976u,2977u,52852u},
+{2978u,2978u,52856u},{2979u,2979u,52860u},{2980u,2981u,52868u},{2982u,2982u,52871u},
+{2983u,2983u,52873u},{2984u,2985u,52880u},{2986u,2986u,52884u},{2987u,2987u,52888u},
+{2988u,2989u,52896u},{2990u,2992u,52899u},{2993u,2994u,52908u},{2995u,2995u,52929u},
+{2996u,2997u,52964u},{2998u,2998u,52968u},{2999u,3000u,52971u},{3001u,3002u,52980u},
+{3003u,3005u,52983u},{3006u,3007u,52992u},{3008u,3008u,52996u},{3009u,3009u,53000u},
+{3010u,3011u,53008u},{3012u,3012u,53011u},{3013u,3013u,53013u},{3014u,3014u,53020u},
+{3015u,3015u,53024u},{3016u,3016u,53028u},{3017u,3018u,53036u},{3019u,3021u,53039u},
+{3022u,3022u,53048u},{3023u,3024u,53076u},{3025u,3025u,53080u},{3026u,3026u,53084u},
+{3027u,3028u,53092u},{3029u,3029u,53095u},{3030u,3030u,53097u},{3031u,3032u,53104u},
+{3033u,3033u,53108u},{3034u,3034u,53112u},{3035u,3035u,53120u},{3036u,3036u,53125u},
+{3037u,3037u,53132u},{3038u,3038u,53153u},{3039u,3039u,53160u},{3040u,3040u,53168u},
+{3041u,3041u,53188u},{3042u,3043u,53216u},{3044u,3044u,53220u},{3045u,3045u,53224u},
+{3046u,3047u,53232u},{3048u,3048u,53235u},{3049u,3049u,53237u},{3050u,3050u,53244u},
+{3051u,3051u,53248u},{3052u,3052u,53252u},{3053u,3053u,53265u},{3054u,3054u,53272u},
+{3055u,3055u,53293u},{3056u,3057u,53300u},{3058u,3058u,53304u},{3059u,3059u,53308u},
+{3060u,3061u,53316u},{3062u,3062u,53319u},{3063u,3063u,53321u},{3064u,3064u,53328u},
+{3065u,3065u,53332u},{3066u,3066u,53336u},{3067u,3067u,53344u},{3068u,3069u,53356u},
+{3070u,3070u,53360u},{3071u,3071u,53364u},{3072u,3073u,53372u},{3074u,3074u,53377u},
+{3075u,3076u,53412u},{3077u,3077u,53416u},{3078u,3078u,53420u},{3079u,3080u,53428u},
+{3081u,3081u,53431u},{3082u,3082u,53433u},{3083u,3084u,53440u},{3085u,3085u,53444u},
+{3086u,3087u,53448u},{3088u,3089u,53456u},{3090u,3092u,53459u},{3093u,3094u,53468u},
+{3095u,3095u,53472u},{3096u,3096u,53476u},{3097u,3098u,53484u},{3099u,3101u,53487u},
+{3102u,3102u,53496u},{3103u,3103u,53517u},{3104u,3105u,53552u},{3106u,3106u,53556u},
+{3107u,3107u,53560u},{3108u,3108u,53562u},{3109u,3110u,53568u},{3111u,3113u,53571u},
+{3114u,3115u,53580u},{3116u,3116u,53584u},{3117u,3117u,53588u},{3118u,3119u,53596u},
+{3120u,3120u,53599u},{3121u,3121u,53601u},{3122u,3122u,53608u},{3123u,3123u,53612u},
+{3124u,3124u,53628u},{3125u,3125u,53636u},{3126u,3126u,53640u},{3127u,3128u,53664u},
+{3129u,3129u,53668u},{3130u,3130u,53672u},{3131u,3132u,53680u},{3133u,3133u,53683u},
+{3134u,3134u,53685u},{3135u,3135u,53690u},{3136u,3136u,53692u},{3137u,3137u,53696u},
+{3138u,3138u,53720u},{3139u,3139u,53748u},{3140u,3140u,53752u},{3141u,3141u,53767u},
+{3142u,3142u,53769u},{3143u,3143u,53776u},{3144u,3145u,53804u},{3146u,3146u,53808u},
+{3147u,3147u,53812u},{3148u,3149u,53820u},{3150u,3150u,53823u},{3151u,3151u,53825u},
+{3152u,3152u,53832u},{3153u,3153u,53852u},{3154u,3154u,53860u},{3155u,3156u,53888u},
+{3157u,3157u,53892u},{3158u,3158u,53896u},{3159u,3160u,53904u},{3161u,3161u,53909u},
+{3162u,3162u,53916u},{3163u,3163u,53920u},{3164u,3164u,53924u},{3165u,3165u,53932u},
+{3166u,3166u,53937u},{3167u,3168u,53944u},{3169u,3169u,53948u},{3170u,3171u,53951u},
+{3172u,3172u,53954u},{3173u,3174u,53960u},{3175u,3175u,53963u},{3176u,3176u,53972u},
+{3177u,3177u,53976u},{3178u,3178u,53980u},{3179u,3180u,53988u},{3181u,3182u,54000u},
+{3183u,3183u,54004u},{3184u,3184u,54008u},{3185u,3186u,54016u},{3187u,3187u,54019u},
+{3188u,3188u,54021u},{3189u,3191u,54028u},{3192u,3192u,54032u},{3193u,3193u,54036u},
+{3194u,3194u,54038u},{3195u,3196u,54044u},{3197u,3199u,54047u},{3200u,3200u,54053u},
+{3201u,3202u,54056u},{3203u,3203u,54060u},{3204u,3204u,54064u},{3205u,3206u,54072u},
+{3207u,3209u,54075u},{3210u,3211u,54084u},{3212u,3213u,54140u},{3214u,3214u,54144u},
+{3215u,3215u,54148u},{3216u,3217u,54156u},{3218u,3220u,54159u},{3221u,3222u,54168u},
+{3223u,3223u,54172u},{3224u,3224u,54176u},{3225u,3226u,54184u},{3227u,3227u,54187u},
+{3228u,3228u,54189u},{3229u,3229u,54196u},{3230u,3230u,54200u},{3231u,3231u,54204u},
+{3232u,3233u,54212u},{3234u,3235u,54216u},{3236u,3236u,54224u},{3237u,3237u,54232u},
+{3238u,3238u,54241u},{3239u,3239u,54243u},{3240u,3241u,54252u},{3242u,3242u,54256u},
+{3243u,3243u,54260u},{3244u,3245u,54268u},{3246u,3246u,54271u},{3247u,3247u,54273u},
+{3248u,3248u,54280u},{3249u,3249u,54301u},{3250u,3250u,54336u},{3251u,3251u,54340u},
+{3252u,3252u,54364u},{3253u,3253u,54368u},{3254u,3254u,54372u},{3255u,3255u,54381u},
+{3256u,3256u,54383u},{3257u,3258u,54392u},{3259u,3259u,54396u},{3260u,3261u,54399u},
+{3262u,3262u,54402u},{3263u,3264u,54408u},{3265u,3265u,54411u},{3266u,3266u,54413u},
+{3267u,3267u,54420u},{3268u,3268u,54441u},{3269u,3269u,54476u},{3270u,3270u,54480u},
+{3271u,3271u,54484u},{3272u,3272u,54492u},{3273u,3273u,54495u},{3274u,3274u,54504u},
+{3275u,3275u,54508u},{3276u,3276u,54512u},{3277u,3277u,54520u},{3278u,3278u,54523u},
+{3279u,3279u,54525u},{3280u,3280u,54532u},{3281u,3281u,54536u},{3282u,3282u,54540u},
+{3283u,3284u,54548u},{3285u,3285u,54551u},{3286u,3287u,54588u},{3288u,3288u,54592u},
+{3289u,3289u,54596u},{3290u,3291u,54604u},{3292u,3292u,54607u},{3293u,3293u,54609u},
+{3294u,3295u,54616u},{3296u,3296u,54620u},{3297u,3297u,54624u},{3298u,3298u,54629u},
+{3299u,3300u,54632u},{3301u,3301u,54635u},{3302u,3302u,54637u},{3303u,3304u,54644u},
+{3305u,3305u,54648u},{3306u,3306u,54652u},{3307u,3308u,54660u},{3309u,3311u,54663u},
+{3312u,3312u,54672u},{3313u,3313u,54693u},{3314u,3315u,54728u},{3316u,3316u,54732u},
+{3317u,3317u,54736u},{3318u,3318u,54738u},{3319u,3320u,54744u},{3321u,3321u,54747u},
+{3322u,3322u,54749u},{3323u,3324u,54756u},{3325u,3325u,54760u},{3326u,3326u,54764u},
+{3327u,3328u,54772u},{3329u,3329u,54775u},{3330u,3330u,54777u},{3331u,3332u,54784u},
+{3333u,3333u,54788u},{3334u,3334u,54792u},{3335u,3336u,54800u},{3337u,3339u,54803u},
+{3340u,3340u,54812u},{3341u,3341u,54816u},{3342u,3342u,54820u},{3343u,3343u,54829u},
+{3344u,3345u,54840u},{3346u,3346u,54844u},{3347u,3347u,54848u},{3348u,3348u,54853u},
+{3349u,3350u,54856u},{3351u,3351u,54859u},{3352u,3352u,54861u},{3353u,3353u,54865u},
+{3354u,3355u,54868u},{3356u,3356u,54872u},{3357u,3357u,54876u},{3358u,3358u,54887u},
+{3359u,3359u,54889u},{3360u,3361u,54896u},{3362u,3362u,54900u},{3363u,3363u,54915u},
+{3364u,3364u,54917u},{3365u,3366u,54924u},{3367u,3367u,54928u},{3368u,3368u,54932u},
+{3369u,3369u,54941u},{3370u,3370u,54943u},{3371u,3371u,54945u},{3372u,3372u,54952u},
+{3373u,3373u,54956u},{3374u,3374u,54960u},{3375u,3375u,54969u},{3376u,3376u,54971u},
+{3377u,3378u,54980u},{3379u,3379u,54984u},{3380u,3380u,54988u},{3381u,3381u,54993u},
+{3382u,3382u,54996u},{3383u,3383u,54999u},{3384u,3384u,55001u},{3385u,3385u,55008u},
+{3386u,3386u,55012u},{3387u,3387u,55016u},{3388u,3388u,55024u},{3389u,3389u,55029u},
+{3390u,3391u,55036u},{3392u,3392u,55040u},{3393u,3393u,55044u},{3394u,3394u,55057u},
+{3395u,3396u,55064u},{3397u,3397u,55068u},{3398u,3398u,55072u},{3399u,3400u,55080u},
+{3401u,3401u,55083u},{3402u,3402u,55085u},{3403u,3404u,55092u},{3405u,3405u,55096u},
+{3406u,3406u,55100u},{3407u,3407u,55108u},{3408u,3408u,55111u},{3409u,3409u,55113u},
+{3410u,3411u,55120u},{3412u,3412u,55124u},{3413u,3416u,55126u},{3417u,3418u,55136u},
+{3419u,3419u,55139u},{3420u,3420u,55141u},{3421u,3421u,55145u},{3422u,3422u,55148u},
+{3423u,3423u,55152u},{3424u,3424u,55156u},{3425u,3426u,55164u},{3427u,3427u,55169u},
+{3428u,3429u,55176u},{3430u,3430u,55180u},{3431u,3431u,55184u},{3432u,3433u,55192u},
+{3434u,3434u,55195u},{3435u,3435u,55197u},{3436u,3436u,20285u},{3437u,3437u,20339u},
+{3438u,3438u,20551u},{3439u,3439u,20729u},{3440u,3440u,21152u},{3441u,3441u,21487u},
+{3442u,3442u,21621u},{3443u,3443u,21733u},{3444u,3444u,22025u},{3445u,3445u,23233u},
+{3446u,3446u,23478u},{3447u,3447u,26247u},{3448u,3449u,26550u},{3450u,3450u,26607u},
+{3451u,3451u,27468u},{3452u,3452u,29634u},{3453u,3453u,30146u},{3454u,3454u,31292u},
+{3455u,3455u,33499u},{3456u,3456u,33540u},{3457u,3457u,34903u},{3458u,3458u,34952u},
+{3459u,3459u,35382u},{3460u,3460u,36040u},{3461u,3461u,36303u},{3462u,3462u,36603u},
+{3463u,3463u,36838u},{3464u,3464u,39381u},{3465u,3465u,21051u},{3466u,3466u,21364u},
+{3467u,3467u,21508u},{3468u,3468u,24682u},{3469u,3469u,24932u},{3470u,3470u,27580u},
+{3471u,3471u,29647u},{3472u,3472u,33050u},{3473u,3473u,35258u},{3474u,3474u,35282u},
+{3475u,3475u,38307u},{3476u,3476u,20355u},{3477u,3477u,21002u},{3478u,3478u,22718u},
+{3479u,3479u,22904u},{3480u,3480u,23014u},{3481u,3481u,24178u},{3482u,3482u,24185u},
+{3483u,3483u,25031u},{3484u,3484u,25536u},{3485u,3485u,26438u},{3486u,3486u,26604u},
+{3487u,3487u,26751u},{3488u,3488u,28567u},{3489u,3489u,30286u},{3490u,3490u,30475u},
+{3491u,3491u,30965u},{3492u,3492u,31240u},{3493u,3493u,31487u},{3494u,3494u,31777u},
+{3495u,3495u,32925u},{3496u,3496u,33390u},{3497u,3497u,33393u},{3498u,3498u,35563u},
+{3499u,3499u,38291u},{3500u,3500u,20075u},{3501u,3501u,21917u},{3502u,3502u,26359u},
+{3503u,3503u,28212u},{3504u,3504u,30883u},{3505u,3505u,31469u},{3506u,3506u,33883u},
+{3507u,3507u,35088u},{3508u,3508u,34638u},{3509u,3509u,38824u},{3510u,3510u,21208u},
+{3511u,3511u,22350u},{3512u,3512u,22570u},{3513u,3513u,23884u},{3514u,3514u,24863u},
+{3515u,3515u,25022u},{3516u,3516u,25121u},{3517u,3517u,25954u},{3518u,3518u,26577u},
+{3519u,3519u,27204u},{3520u,3520u,28187u},{3521u,3521u,29976u},{3522u,3522u,30131u},
+{3523u,3523u,30435u},{3524u,3524u,30640u},{3525u,3525u,32058u},{3526u,3526u,37039u},
+{3527u,3528u,37969u},{3529u,3529u,40853u},{3530u,3530u,21283u},{3531u,3531u,23724u},
+{3532u,3532u,30002u},{3533u,3533u,32987u},{3534u,3534u,37440u},{3535u,3535u,38296u},
+{3536u,3536u,21083u},{3537u,3537u,22536u},{3538u,3538u,23004u},{3539u,3539u,23713u},
+{3540u,3540u,23831u},{3541u,3541u,24247u},{3542u,3542u,24378u},{3543u,3543u,24394u},
+{3544u,3544u,24951u},{3545u,3545u,27743u},{3546u,3546u,30074u},{3547u,3547u,30086u},
+{3548u,3548u,31968u},{3549u,3549u,32115u},{3550u,3550u,32177u},{3551u,3551u,32652u},
+{3552u,3552u,33108u},{3553u,3553u,33313u},{3554u,3554u,34193u},{3555u,3555u,35137u},
+{3556u,3556u,35611u},{3557u,3557u,37628u},{3558u,3558u,38477u},{3559u,3559u,40007u},
+{3560u,3560u,20171u},{3561u,3561u,20215u},{3562u,3562u,20491u},{3563u,3563u,20977u},
+{3564u,3564u,22607u},{3565u,3565u,24887u},{3566u,3566u,24894u},{3567u,3567u,24936u},
+{3568u,3568u,25913u},{3569u,3569u,27114u},{3570u,3570u,28433u},{3571u,3571u,30117u},
+{3572u,3572u,30342u},{3573u,3573u,30422u},{3574u,3574u,31623u},{3575u,3575u,33445u},
+{3576u,3576u,33995u},{3577u,3577u,37799u},{3578u,3578u,38283u},{3579u,3579u,21888u},
+{3580u,3580u,23458u},{3581u,3581u,22353u},{3582u,3582u,31923u},{3583u,3583u,32697u},
+{3584u,3584u,37301u},{3585u,3585u,20520u},{3586u,3586u,21435u},{3587u,3587u,23621u},
+{3588u,3588u,24040u},{3589u,3589u,25298u},{3590u,3590u,25454u},{3591u,3591u,25818u},
+{3592u,3592u,25831u},{3593u,3593u,28192u},{3594u,3594u,28844u},{3595u,3595u,31067u},
+{3596u,3596u,36317u},{3597u,3597u,36382u},{3598u,3598u,36989u},{3599u,3599u,37445u},
+{3600u,3600u,37624u},{3601u,3601u,20094u},{3602u,3602u,20214u},{3603u,3603u,20581u},
+{3604u,3604u,24062u},{3605u,3605u,24314u},{3606u,3606u,24838u},{3607u,3607u,26967u},
+{3608u,3608u,33137u},{3609u,3609u,34388u},{3610u,3610u,36423u},{3611u,3611u,37749u},
+{3612u,3612u,39467u},{3613u,3613u,20062u},{3614u,3614u,20625u},{3615u,3615u,26480u},
+{3616u,3616u,26688u},{3617u,3617u,20745u},{3618u,3618u,21133u},{3619u,3619u,21138u},
+{3620u,3620u,27298u},{3621u,3621u,30652u},{3622u,3622u,37392u},{3623u,3623u,40660u},
+{3624u,3624u,21163u},{3625u,3625u,24623u},{3626u,3626u,36850u},{3627u,3627u,20552u},
+{3628u,3628u,25001u},{3629u,3629u,25581u},{3630u,3630u,25802u},{3631u,3631u,26684u},
+{3632u,3632u,27268u},{3633u,3633u,28608u},{3634u,3634u,33160u},{3635u,3635u,35233u},
+{3636u,3636u,38548u},{3637u,3637u,22533u},{3638u,3638u,29309u},{3639u,3639u,29356u},
+{3640u,3640u,29956u},{3641u,3641u,32121u},{3642u,3642u,32365u},{3643u,3643u,32937u},
+{3644u,3644u,35211u},{3645u,3645u,35700u},{3646u,3646u,36963u},{3647u,3647u,40273u},
+{3648u,3648u,25225u},{3649u,3649u,27770u},{3650u,3650u,28500u},{3651u,3651u,32080u},
+{3652u,3652u,32570u},{3653u,3653u,35363u},{3654u,3654u,20860u},{3655u,3655u,24906u},
+{3656u,3656u,31645u},{3657u,3657u,35609u},{3658u,3658u,37463u},{3659u,3659u,37772u},
+{3660u,3660u,20140u},{3661u,3661u,20435u},{3662u,3662u,20510u},{3663u,3663u,20670u},
+{3664u,3664u,20742u},{3665u,3665u,21185u},{3666u,3666u,21197u},{3667u,3667u,21375u},
+{3668u,3668u,22384u},{3669u,3669u,22659u},{3670u,3670u,24218u},{3671u,3671u,24465u},
+{3672u,3672u,24950u},{3673u,3673u,25004u},{3674u,3674u,25806u},{3675u,3675u,25964u},
+{3676u,3676u,26223u},{3677u,3677u,26299u},{3678u,3678u,26356u},{3679u,3679u,26775u},
+{3680u,3680u,28039u},{3681u,3681u,28805u},{3682u,3682u,28913u},{3683u,3683u,29855u},
+{3684u,3684u,29861u},{3685u,3685u,29898u},{3686u,3686u,30169u},{3687u,3687u,30828u},
+{3688u,3688u,30956u},{3689u,3689u,31455u},{3690u,3690u,31478u},{3691u,3691u,32069u},
+{3692u,3692u,32147u},{3693u,3693u,32789u},{3694u,3694u,32831u},{3695u,3695u,33051u},
+{3696u,3696u,33686u},{3697u,3697u,35686u},{3698u,3698u,36629u},{3699u,3699u,36885u},
+{3700u,3700u,37857u},{3701u,3701u,38915u},{3702u,3702u,38968u},{3703u,3703u,39514u},
+{3704u,3704u,39912u},{3705u,3705u,20418u},{3706u,3706u,21843u},{3707u,3707u,22586u},
+{3708u,3708u,22865u},{3709u,3709u,23395u},{3710u,3710u,23622u},{3711u,3711u,24760u},
+{3712u,3712u,25106u},{3713u,3713u,26690u},{3714u,3714u,26800u},{3715u,3715u,26856u},
+{3716u,3716u,28330u},{3717u,3717u,30028u},{3718u,3718u,30328u},{3719u,3719u,30926u},
+{3720u,3720u,31293u},{3721u,3721u,31995u},{3722u,3722u,32363u},{3723u,3723u,32380u},
+{3724u,3724u,35336u},{3725u,3725u,35489u},{3726u,3726u,35903u},{3727u,3727u,38542u},
+{3728u,3728u,40388u},{3729u,3729u,21476u},{3730u,3730u,21481u},{3731u,3731u,21578u},
+{3732u,3732u,21617u},{3733u,3733u,22266u},{3734u,3734u,22993u},{3735u,3735u,23396u},
+{3736u,3736u,23611u},{3737u,3737u,24235u},{3738u,3738u,25335u},{3739u,3739u,25911u},
+{3740u,3740u,25925u},{3741u,3741u,25970u},{3742u,3742u,26272u},{3743u,3743u,26543u},
+{3744u,3744u,27073u},{3745u,3745u,27837u},{3746u,3746u,30204u},{3747u,3747u,30352u},
+{3748u,3748u,30590u},{3749u,3749u,31295u},{3750u,3750u,32660u},{3751u,3751u,32771u},
+{3752u,3752u,32929u},{3753u,3753u,33167u},{3754u,3754u,33510u},{3755u,3755u,33533u},
+{3756u,3756u,33776u},{3757u,3757u,34241u},{3758u,3758u,34865u},{3759u,3759u,34996u},
+{3760u,3760u,35493u},{3761u,3761u,36764u},{3762u,3762u,37678u},{3763u,3763u,38599u},
+{3764u,3764u,39015u},{3765u,3765u,39640u},{3766u,3766u,40723u},{3767u,3767u,21741u},
+{3768u,3768u,26011u},{3769u,3769u,26354u},{3770u,3770u,26767u},{3771u,3771u,31296u},
+{3772u,3772u,35895u},{3773u,3773u,40288u},{3774u,3774u,22256u},{3775u,3775u,22372u},
+{3776u,3776u,23825u},{3777u,3777u,26118u},{3778u,3778u,26801u},{3779u,3779u,26829u},
+{3780u,3780u,28414u},{3781u,3781u,29736u},{3782u,3782u,34974u},{3783u,3783u,39908u},
+{3784u,3784u,27752u},{3785u,3785u,39592u},{3786u,3786u,20379u},{3787u,3787u,20844u},
+{3788u,3788u,20849u},{3789u,3789u,21151u},{3790u,3790u,23380u},{3791u,3791u,24037u},
+{3792u,3792u,24656u},{3793u,3793u,24685u},{3794u,3794u,25329u},{3795u,3795u,25511u},
+{3796u,3796u,25915u},{3797u,3797u,29657u},{3798u,3798u,31354u},{3799u,3799u,34467u},
+{3800u,3800u,36002u},{3801u,3801u,38799u},{3802u,3802u,20018u},{3803u,3803u,23521u},
+{3804u,3804u,25096u},{3805u,3805u,26524u},{3806u,3806u,29916u},{3807u,3807u,31185u},
+{3808u,3808u,33747u},{3809u,3809u,35463u},{3810u,3810u,35506u},{3811u,3811u,36328u},
+{3812u,3812u,36942u},{3813u,3813u,37707u},{3814u,3814u,38982u},{3815u,3815u,24275u},
+{3816u,3816u,27112u},{3817u,3817u,34303u},{3818u,3818u,37101u},{3819u,3819u,20896u},
+{3820u,3820u,23448u},{3821u,3821u,23532u},{3822u,3822u,24931u},{3823u,3823u,26874u},
+{3824u,3824u,27454u},{3825u,3825u,28748u},{3826u,3826u,29743u},{3827u,3827u,29912u},
+{3828u,3828u,31649u},{3829u,3829u,32592u},{3830u,3830u,33733u},{3831u,3831u,35264u},
+{3832u,3832u,36011u},{3833u,3833u,38364u},{3834u,3834u,39208u},{3835u,3835u,21038u},
+{3836u,3836u,24669u},{3837u,3837u,25324u},{3838u,3838u,36866u},{3839u,3839u,20362u},
+{3840u,3840u,20809u},{3841u,3841u,21281u},{3842u,3842u,22745u},{3843u,3843u,24291u},
+{3844u,3844u,26336u},{3845u,3845u,27960u},{3846u,3846u,28826u},{3847u,3847u,29378u},
+{3848u,3848u,29654u},{3849u,3849u,31568u},{3850u,3850u,33009u},{3851u,3851u,37979u},
+{3852u,3852u,21350u},{3853u,3853u,25499u},{3854u,3854u,32619u},{3855u,3855u,20054u},
+{3856u,3856u,20608u},{3857u,3857u,22602u},{3858u,3858u,22750u},{3859u,3859u,24618u},
+{3860u,3860u,24871u},{3861u,3861u,25296u},{3862u,3862u,27088u},{3863u,3863u,39745u},
+{3864u,3864u,23439u},{3865u,3865u,32024u},{3866u,3866u,32945u},{3867u,3867u,36703u},
+{3868u,3868u,20132u},{3869u,3869u,20689u},{3870u,3870u,21676u},{3871u,3871u,21932u},
+{3872u,3872u,23308u},{3873u,3873u,23968u},{3874u,3874u,24039u},{3875u,3875u,25898u},
+{3876u,3876u,25934u},{3877u,3877u,26657u},{3878u,3878u,27211u},{3879u,3879u,29409u},
+{3880u,3880u,30350u},{3881u,3881u,30703u},{3882u,3882u,32094u},{3883u,3883u,32761u},
+{3884u,3884u,33184u},{3885u,3885u,34126u},{3886u,3886u,34527u},{3887u,3887u,36611u},
+{3888u,3888u,36686u},{3889u,3889u,37066u},{3890u,3890u,39171u},{3891u,3891u,39509u},
+{3892u,3892u,39851u},{3893u,3893u,19992u},{3894u,3894u,20037u},{3895u,3895u,20061u},
+{3896u,3896u,20167u},{3897u,3897u,20465u},{3898u,3898u,20855u},{3899u,3899u,21246u},
+{3900u,3900u,21312u},{3901u,3901u,21475u},{3902u,3902u,21477u},{3903u,3903u,21646u},
+{3904u,3904u,22036u},{3905u,3905u,22389u},{3906u,3906u,22434u},{3907u,3907u,23495u},
+{3908u,3908u,23943u},{3909u,3909u,24272u},{3910u,3910u,25084u},{3911u,3911u,25304u},
+{3912u,3912u,25937u},{3913u,3913u,26552u},{3914u,3914u,26601u},{3915u,3915u,27083u},
+{3916u,3916u,27472u},{3917u,3917u,27590u},{3918u,3918u,27628u},{3919u,3919u,27714u},
+{3920u,3920u,28317u},{3921u,3921u,28792u},{3922u,3922u,29399u},{3923u,3923u,29590u},
+{3924u,3924u,29699u},{3925u,3925u,30655u},{3926u,3926u,30697u},{3927u,3927u,31350u},
+{3928u,3928u,32127u},{3929u,3929u,32777u},{3930u,3930u,33276u},{3931u,3931u,33285u},
+{3932u,3932u,33290u},{3933u,3933u,33503u},{3934u,3934u,34914u},{3935u,3935u,35635u},
+{3936u,3936u,36092u},{3937u,3937u,36544u},{3938u,3938u,36881u},{3939u,3939u,37041u},
+{3940u,3940u,37476u},{3941u,3941u,37558u},{3942u,3942u,39378u},{3943u,3943u,39493u},
+{3944u,3944u,40169u},{3945u,3945u,40407u},{3946u,3946u,40860u},{3947u,3947u,22283u},
+{3948u,3948u,23616u},{3949u,3949u,33738u},{3950u,3950u,38816u},{3951u,3951u,38827u},
+{3952u,3952u,40628u},{3953u,3953u,21531u},{3954u,3954u,31384u},{3955u,3955u,32676u},
+{3956u,3956u,35033u},{3957u,3957u,36557u},{3958u,3958u,37089u},{3959u,3959u,22528u},
+{3960u,3960u,23624u},{3961u,3961u,25496u},{3962u,3962u,31391u},{3963u,3963u,23470u},
+{3964u,3964u,24339u},{3965u,3965u,31353u},{3966u,3966u,31406u},{3967u,3967u,33422u},
+{3968u,3968u,36524u},{3969u,3969u,20518u},{3970u,3970u,21048u},{3971u,3971u,21240u},
+{3972u,3972u,21367u},{3973u,3973u,22280u},{3974u,3974u,25331u},{3975u,3975u,25458u},
+{3976u,3976u,27402u},{3977u,3977u,28099u},{3978u,3978u,30519u},{3979u,3979u,21413u},
+{3980u,3980u,29527u},{3981u,3981u,34152u},{3982u,3982u,36470u},{3983u,3983u,38357u},
+{3984u,3984u,26426u},{3985u,3985u,27331u},{3986u,3986u,28528u},{3987u,3987u,35437u},
+{3988u,3988u,36556u},{3989u,3989u,39243u},{3990u,3990u,26231u},{3991u,3991u,27512u},
+{3992u,3992u,36020u},{3993u,3993u,39740u},{3994u,3994u,21483u},{3995u,3995u,22317u},
+{3996u,3996u,22862u},{3997u,3997u,25542u},{3998u,3998u,27131u},{3999u,3999u,29674u},
+{4000u,4000u,30789u},{4001u,4001u,31418u},{4002u,4002u,31429u},{4003u,4003u,31998u},
+{4004u,4004u,33909u},{4005u,4005u,35215u},{4006u,4006u,36211u},{4007u,4007u,36917u},
+{4008u,4008u,38312u},{4009u,4009u,21243u},{4010u,4010u,22343u},{4011u,4011u,30023u},
+{4012u,4012u,31584u},{4013u,4013u,33740u},{4014u,4014u,37406u},{4015u,4015u,27224u},
+{4016u,4016u,20811u},{4017u,4017u,21067u},{4018u,4018u,21127u},{4019u,4019u,25119u},
+{4020u,4020u,26840u},{4021u,4021u,26997u},{4022u,4022u,38553u},{4023u,4023u,20677u},
+{4024u,4024u,21156u},{4025u,4025u,21220u},{4026u,4026u,25027u},{4027u,4027u,26020u},
+{4028u,4028u,26681u},{4029u,4029u,27135u},{4030u,4030u,29822u},{4031u,4031u,31563u},
+{4032u,4032u,33465u},{4033u,4033u,33771u},{4034u,4034u,35250u},{4035u,4035u,35641u},
+{4036u,4036u,36817u},{4037u,4037u,39241u},{4038u,4038u,20170u},{4039u,4039u,22935u},
+{4040u,4040u,25810u},{4041u,4041u,26129u},{4042u,4042u,27278u},{4043u,4043u,29748u},
+{4044u,4044u,31105u},{4045u,4045u,31165u},{4046u,4046u,33449u},{4047u,4048u,34942u},
+{4049u,4049u,35167u},{4050u,4050u,37670u},{4051u,4051u,20235u},{4052u,4052u,21450u},
+{4053u,4053u,24613u},{4054u,4054u,25201u},{4055u,4055u,27762u},{4056u,4056u,32026u},
+{4057u,4057u,32102u},{4058u,4058u,20120u},{4059u,4059u,20834u},{4060u,4060u,30684u},
+{4061u,4061u,32943u},{4062u,4062u,20225u},{4063u,4063u,20238u},{4064u,4064u,20854u},
+{4065u,4065u,20864u},{4066u,4066u,21980u},{4067u,4067u,22120u},{4068u,4068u,22331u},
+{4069u,4069u,22522u},{4070u,4070u,22524u},{4071u,4071u,22804u},{4072u,4072u,22855u},
+{4073u,4073u,22931u},{4074u,4074u,23492u},{4075u,4075u,23696u},{4076u,4076u,23822u},
+{4077u,4077u,24049u},{4078u,4078u,24190u},{4079u,4079u,24524u},{4080u,4080u,25216u},
+{4081u,4081u,26071u},{4082u,4082u,26083u},{4083u,4084u,26398u},{4085u,4085u,26462u},
+{4086u,4086u,26827u},{4087u,4087u,26820u},{4088u,4088u,27231u},{4089u,4089u,27450u},
+{4090u,4090u,27683u},{4091u,4091u,27773u},{4092u,4092u,27778u},{4093u,4093u,28103u},
+{4094u,4094u,29592u},{4095u,4095u,29734u},{4096u,4096u,29738u},{4097u,4097u,29826u},
+{4098u,4098u,29859u},{4099u,4099u,30072u},{4100u,4100u,30079u},{4101u,4101u,30849u},
+{4102u,4102u,30959u},{4103u,4103u,31041u},{4104u,4105u,31047u},{4106u,4106u,31098u},
+{4107u,4107u,31637u},{4108u,4108u,32000u},{4109u,4109u,32186u},{4110u,4110u,32648u},
+{4111u,4111u,32774u},{4112u,4112u,32813u},{4113u,4113u,32908u},{4114u,4114u,35352u},
+{4115u,4115u,35663u},{4116u,4116u,35912u},{4117u,4117u,36215u},{4118u,4118u,37665u},
+{4119u,4119u,37668u},{4120u,4120u,39138u},{4121u,4121u,39249u},{4122u,4123u,39438u},
+{4124u,4124u,39525u},{4125u,4125u,40594u},{4126u,4126u,32202u},{4127u,4127u,20342u},
+{4128u,4128u,21513u},{4129u,4129u,25326u},{4130u,4130u,26708u},{4131u,4131u,37329u},
+{4132u,4132u,21931u},{4133u,4133u,20794u},{4134u,4134u,23068u},{4135u,4135u,25062u},
+{4136u,4136u,25295u},{4137u,4137u,25343u},{4138u,4138u,37027u},{4139u,4139u,35582u},
+{4140u,4140u,26262u},{4141u,4141u,29014u},{4142u,4142u,38627u},{4143u,4143u,25423u},
+{4144u,4144u,25466u},{4145u,4145u,21335u},{4146u,4146u,26511u},{4147u,4147u,26976u},
+{4148u,4148u,28275u},{4149u,4149u,30007u},{4150u,4150u,32013u},{4151u,4151u,34930u},
+{4152u,4152u,22218u},{4153u,4153u,23064u},{4154u,4154u,20035u},{4155u,4155u,20839u},
+{4156u,4156u,22856u},{4157u,4157u,26608u},{4158u,4158u,32784u},{4159u,4159u,22899u},
+{4160u,4160u,24180u},{4161u,4161u,25754u},{4162u,4162u,31178u},{4163u,4163u,24565u},
+{4164u,4164u,24684u},{4165u,4165u,25288u},{4166u,4166u,25467u},{4167u,4167u,23527u},
+{4168u,4168u,23511u},{4169u,4169u,21162u},{4170u,4170u,22900u},{4171u,4171u,24361u},
+{4172u,4172u,24594u},{4173u,4173u,29785u},{4174u,4174u,39377u},{4175u,4175u,28611u},
+{4176u,4176u,33215u},{4177u,4177u,36786u},{4178u,4178u,24817u},{4179u,4179u,33126u},
+{4180u,4180u,23615u},{4181u,4181u,23273u},{4182u,4182u,35365u},{4183u,4183u,26491u},
+{4184u,4184u,32016u},{4185u,4185u,33021u},{4186u,4186u,23612u},{4187u,4187u,27877u},
+{4188u,4188u,21311u},{4189u,4189u,28346u},{4190u,4190u,22810u},{4191u,4191u,33590u},
+{4192u,4192u,20025u},{4193u,4193u,20150u},{4194u,4194u,20294u},{4195u,4195u,21934u},
+{4196u,4196u,22296u},{4197u,4197u,22727u},{4198u,4198u,24406u},{4199u,4199u,26039u},
+{4200u,4200u,26086u},{4201u,4201u,27264u},{4202u,4202u,27573u},{4203u,4203u,28237u},
+{4204u,4204u,30701u},{4205u,4205u,31471u},{4206u,4206u,31774u},{4207u,4207u,32222u},
+{4208u,4208u,34507u},{4209u,4209u,34962u},{4210u,4210u,37170u},{4211u,4211u,37723u},
+{4212u,4212u,25787u},{4213u,4213u,28606u},{4214u,4214u,29562u},{4215u,4215u,30136u},
+{4216u,4216u,36948u},{4217u,4217u,21846u},{4218u,4218u,22349u},{4219u,4219u,25018u},
+{4220u,4220u,25812u},{4221u,4221u,26311u},{4222u,4222u,28129u},{4223u,4223u,28251u},
+{4224u,4224u,28525u},{4225u,4225u,28601u},{4226u,4226u,30192u},{4227u,4227u,32835u},
+{4228u,4228u,33213u},{4229u,4229u,34113u},{4230u,4230u,35203u},{4231u,4231u,35527u},
+{4232u,4232u,35674u},{4233u,4233u,37663u},{4234u,4234u,27795u},{4235u,4235u,30035u},
+{4236u,4236u,31572u},{4237u,4237u,36367u},{4238u,4238u,36957u},{4239u,4239u,21776u},
+{4240u,4240u,22530u},{4241u,4241u,22616u},{4242u,4242u,24162u},{4243u,4243u,25095u},
+{4244u,4244u,25758u},{4245u,4245u,26848u},{4246u,4246u,30070u},{4247u,4247u,31958u},
+{4248u,4248u,34739u},{4249u,4249u,40680u},{4250u,4250u,20195u},{4251u,4251u,22408u},
+{4252u,4252u,22382u},{4253u,4253u,22823u},{4254u,4254u,23565u},{4255u,4255u,23729u},
+{4256u,4256u,24118u},{4257u,4257u,24453u},{4258u,4258u,25140u},{4259u,4259u,25825u},
+{4260u,4260u,29619u},{4261u,4261u,33274u},{4262u,4262u,34955u},{4263u,4263u,36024u},
+{4264u,4264u,38538u},{4265u,4265u,40667u},{4266u,4266u,23429u},{4267u,4267u,24503u},
+{4268u,4268u,24755u},{4269u,4269u,20498u},{4270u,4270u,20992u},{4271u,4271u,21040u},
+{4272u,4272u,22294u},{4273u,4273u,22581u},{4274u,4274u,22615u},{4275u,4275u,23566u},
+{4276u,4276u,23648u},{4277u,4277u,23798u},{4278u,4278u,23947u},{4279u,4279u,24230u},
+{4280u,4280u,24466u},{4281u,4281u,24764u},{4282u,4282u,25361u},{4283u,4283u,25481u},
+{4284u,4284u,25623u},{4285u,4285u,26691u},{4286u,4286u,26873u},{4287u,4287u,27330u},
+{4288u,4288u,28120u},{4289u,4289u,28193u},{4290u,4290u,28372u},{4291u,4291u,28644u},
+{4292u,4292u,29182u},{4293u,4293u,30428u},{4294u,4294u,30585u},{4295u,4295u,31153u},
+{4296u,4296u,31291u},{4297u,4297u,33796u},{4298u,4298u,35241u},{4299u,4299u,36077u},
+{4300u,4300u,36339u},{4301u,4301u,36424u},{4302u,4302u,36867u},{4303u,4303u,36884u},
+{4304u,4304u,36947u},{4305u,4305u,37117u},{4306u,4306u,37709u},{4307u,4307u,38518u},
+{4308u,4308u,38876u},{4309u,4309u,27602u},{4310u,4310u,28678u},{4311u,4311u,29272u},
+{4312u,4312u,29346u},{4313u,4313u,29544u},{4314u,4314u,30563u},{4315u,4315u,31167u},
+{4316u,4316u,31716u},{4317u,4317u,32411u},{4318u,4318u,35712u},{4319u,4319u,22697u},
+{4320u,4320u,24775u},{4321u,4321u,25958u},{4322u,4322u,26109u},{4323u,4323u,26302u},
+{4324u,4324u,27788u},{4325u,4325u,28958u},{4326u,4326u,29129u},{4327u,4327u,35930u},
+{4328u,4328u,38931u},{4329u,4329u,20077u},{4330u,4330u,31361u},{4331u,4331u,20189u},
+{4332u,4332u,20908u},{4333u,4333u,20941u},{4334u,4334u,21205u},{4335u,4335u,21516u},
+{4336u,4336u,24999u},{4337u,4337u,26481u},{4338u,4338u,26704u},{4339u,4339u,26847u},
+{4340u,4340u,27934u},{4341u,4341u,28540u},{4342u,4342u,30140u},{4343u,4343u,30643u},
+{4344u,4344u,31461u},{4345u,4345u,33012u},{4346u,4346u,33891u},{4347u,4347u,37509u},
+{4348u,4348u,20828u},{4349u,4349u,26007u},{4350u,4350u,26460u},{4351u,4351u,26515u},
+{4352u,4352u,30168u},{4353u,4353u,31431u},{4354u,4354u,33651u},{4355u,4355u,35910u},
+{4356u,4356u,36887u},{4357u,4357u,38957u},{4358u,4358u,23663u},{4359u,4359u,33216u},
+{4360u,4360u,33434u},{4361u,4361u,36929u},{4362u,4362u,36975u},{4363u,4363u,37389u},
+{4364u,4364u,24471u},{4365u,4365u,23965u},{4366u,4366u,27225u},{4367u,4367u,29128u},
+{4368u,4368u,30331u},{4369u,4369u,31561u},{4370u,4370u,34276u},{4371u,4371u,35588u},
+{4372u,4372u,37159u},{4373u,4373u,39472u},{4374u,4374u,21895u},{4375u,4375u,25078u},
+{4376u,4376u,30313u},{4377u,4377u,32645u},{4378u,4378u,34367u},{4379u,4379u,34746u},
+{4380u,4380u,35064u},{4381u,4381u,37007u},{4382u,4382u,27931u},{4383u,4383u,28889u},
+{4384u,4384u,29662u},{4385u,4385u,32097u},{4386u,4386u,33853u},{4387u,4387u,37226u},
+{4388u,4388u,39409u},{4389u,4389u,20098u},{4390u,4390u,21365u},{4391u,4391u,27396u},
+{4392u,4392u,27410u},{4393u,4393u,28734u},{4394u,4394u,29211u},{4395u,4395u,34349u},
+{4396u,4396u,40478u},{4397u,4397u,21068u},{4398u,4398u,36771u},{4399u,4399u,23888u},
+{4400u,4400u,25829u},{4401u,4401u,25900u},{4402u,4402u,27414u},{4403u,4403u,28651u},
+{4404u,4404u,31811u},{4405u,4405u,32412u},{4406u,4406u,34253u},{4407u,4407u,35172u},
+{4408u,4408u,35261u},{4409u,4409u,25289u},{4410u,4410u,33240u},{4411u,4411u,34847u},
+{4412u,4412u,24266u},{4413u,4413u,26391u},{4414u,4414u,28010u},{4415u,4415u,29436u},
+{4416u,4416u,29701u},{4417u,4417u,29807u},{4418u,4418u,34690u},{4419u,4419u,37086u},
+{4420u,4420u,20358u},{4421u,4421u,23821u},{4422u,4422u,24480u},{4423u,4423u,33802u},
+{4424u,4424u,20919u},{4425u,4425u,25504u},{4426u,4426u,30053u},{4427u,4427u,20142u},
+{4428u,4428u,20486u},{4429u,4429u,20841u},{4430u,4430u,20937u},{4431u,4431u,26753u},
+{4432u,4432u,27153u},{4433u,4433u,31918u},{4434u,4434u,31921u},{4435u,4435u,31975u},
+{4436u,4436u,33391u},{4437u,4437u,35538u},{4438u,4438u,36635u},{4439u,4439u,37327u},
+{4440u,4440u,20406u},{4441u,4441u,20791u},{4442u,4442u,21237u},{4443u,4443u,21570u},
+{4444u,4444u,24300u},{4445u,4445u,24942u},{4446u,4446u,25150u},{4447u,4447u,26053u},
+{4448u,4448u,27354u},{4449u,4449u,28670u},{4450u,4450u,31018u},{4451u,4451u,34268u},
+{4452u,4452u,34851u},{4453u,4453u,38317u},{4454u,4454u,39522u},{4455u,4455u,39530u},
+{4456u,4456u,40599u},{4457u,4457u,40654u},{4458u,4458u,21147u},{4459u,4459u,26310u},
+{4460u,4460u,27511u},{4461u,4461u,28701u},{4462u,4462u,31019u},{4463u,4463u,36706u},
+{4464u,4464u,38722u},{4465u,4465u,24976u},{4466u,4466u,25088u},{4467u,4467u,25891u},
+{4468u,4468u,28451u},{4469u,4469u,29001u},{4470u,4470u,29833u},{4471u,4471u,32244u},
+{4472u,4472u,32879u},{4473u,4473u,34030u},{4474u,4474u,36646u},{4475u,4475u,36899u},
+{4476u,4476u,37706u},{4477u,4477u,20925u},{4478u,4478u,21015u},{4479u,4479u,21155u},
+{4480u,4480u,27916u},{4481u,4481u,28872u},{4482u,4482u,35010u},{4483u,4483u,24265u},
+{4484u,4484u,25986u},{4485u,4485u,27566u},{4486u,4486u,28610u},{4487u,4487u,31806u},
+{4488u,4488u,29557u},{4489u,4489u,20196u},{4490u,4490u,20278u},{4491u,4491u,22265u},
+{4492u,4492u,23738u},{4493u,4493u,23994u},{4494u,4494u,24604u},{4495u,4495u,29618u},
+{4496u,4496u,31533u},{4497u,4497u,32666u},{4498u,4498u,32718u},{4499u,4499u,32838u},
+{4500u,4500u,36894u},{4501u,4501u,37428u},{4502u,4502u,38646u},{4503u,4503u,38728u},
+{4504u,4504u,38936u},{4505u,4505u,40801u},{4506u,4506u,20363u},{4507u,4507u,28583u},
+{4508u,4508u,31150u},{4509u,4509u,37300u},{4510u,4510u,38583u},{4511u,4511u,21214u},
+{4512u,4512u,25736u},{4513u,4513u,25796u},{4514u,4514u,27347u},{4515u,4515u,28510u},
+{4516u,4516u,28696u},{4517u,4517u,29200u},{4518u,4518u,30439u},{4519u,4519u,32769u},
+{4520u,4520u,34310u},{4521u,4521u,34396u},{4522u,4522u,36335u},{4523u,4523u,36613u},
+{4524u,4524u,38706u},{4525u,4525u,39791u},{4526u,4526u,40442u},{4527u,4527u,40565u},
+{4528u,4528u,30860u},{4529u,4529u,31103u},{4530u,4530u,32160u},{4531u,4531u,33737u},
+{4532u,4532u,37636u},{4533u,4533u,40575u},{4534u,4534u,40595u},{4535u,4535u,35542u},
+{4536u,4536u,22751u},{4537u,4537u,24324u},{4538u,4538u,26407u},{4539u,4539u,28711u},
+{4540u,4540u,29903u},{4541u,4541u,31840u},{4542u,4542u,32894u},{4543u,4543u,20769u},
+{4544u,4544u,28712u},{4545u,4545u,29282u},{4546u,4546u,30922u},{4547u,4547u,36034u},
+{4548u,4548u,36058u},{4549u,4549u,36084u},{4550u,4550u,38647u},{4551u,4551u,20102u},
+{4552u,4552u,20698u},{4553u,4553u,23534u},{4554u,4554u,24278u},{4555u,4555u,26009u},
+{4556u,4556u,29134u},{4557u,4557u,30274u},{4558u,4558u,30637u},{4559u,4559u,32842u},
+{4560u,4560u,34044u},{4561u,4561u,36988u},{4562u,4562u,39719u},{4563u,4563u,40845u},
+{4564u,4564u,22744u},{4565u,4565u,23105u},{4566u,4566u,23650u},{4567u,4567u,27155u},
+{4568u,4568u,28122u},{4569u,4569u,28431u},{4570u,4570u,30267u},{4571u,4571u,32047u},
+{4572u,4572u,32311u},{4573u,4573u,34078u},{4574u,4574u,35128u},{4575u,4575u,37860u},
+{4576u,4576u,38475u},{4577u,4577u,21129u},{4578u,4578u,26066u},{4579u,4579u,26611u},
+{4580u,4580u,27060u},{4581u,4581u,27969u},{4582u,4582u,28316u},{4583u,4583u,28687u},
+{4584u,4584u,29705u},{4585u,4585u,29792u},{4586u,4586u,30041u},{4587u,4587u,30244u},
+{4588u,4588u,30827u},{4589u,4589u,35628u},{4590u,4590u,39006u},{4591u,4591u,20845u},
+{4592u,4592u,25134u},{4593u,4593u,38520u},{4594u,4594u,20374u},{4595u,4595u,20523u},
+{4596u,4596u,23833u},{4597u,4597u,28138u},{4598u,4598u,32184u},{4599u,4599u,36650u},
+{4600u,4600u,24459u},{4601u,4601u,24900u},{4602u,4602u,26647u},{4603u,4603u,38534u},
+{4604u,4604u,21202u},{4605u,4605u,32907u},{4606u,4606u,20956u},{4607u,4607u,20940u},
+{4608u,4608u,26974u},{4609u,4609u,31260u},{4610u,4610u,32190u},{4611u,4611u,33777u},
+{4612u,4612u,38517u},{4613u,4613u,20442u},{4614u,4614u,21033u},{4615u,4615u,21400u},
+{4616u,4616u,21519u},{4617u,4617u,21774u},{4618u,4618u,23653u},{4619u,4619u,24743u},
+{4620u,4620u,26446u},{4621u,4621u,26792u},{4622u,4622u,28012u},{4623u,4623u,29313u},
+{4624u,4624u,29432u},{4625u,4625u,29702u},{4626u,4626u,29827u},{4627u,4627u,30178u},
+{4628u,4628u,31852u},{4629u,4629u,32633u},{4630u,4630u,32696u},{4631u,4631u,33673u},
+{4632u,4632u,35023u},{4633u,4633u,35041u},{4634u,4634u,37324u},{4635u,4635u,37328u},
+{4636u,4636u,38626u},{4637u,4637u,39881u},{4638u,4638u,21533u},{4639u,4639u,28542u},
+{4640u,4640u,29136u},{4641u,4641u,29848u},{4642u,4642u,34298u},{4643u,4643u,36522u},
+{4644u,4644u,38563u},{4645u,4645u,40023u},{4646u,4646u,40607u},{4647u,4647u,26519u},
+{4648u,4648u,28107u},{4649u,4649u,29747u},{4650u,4650u,33256u},{4651u,4651u,38678u},
+{4652u,4652u,30764u},{4653u,4653u,31435u},{4654u,4654u,31520u},{4655u,4655u,31890u},
+{4656u,4656u,25705u},{4657u,4657u,29802u},{4658u,4658u,30194u},{4659u,4659u,30908u},
+{4660u,4660u,30952u},{4661u,4661u,39340u},{4662u,4662u,39764u},{4663u,4663u,40635u},
+{4664u,4664u,23518u},{4665u,4665u,24149u},{4666u,4666u,28448u},{4667u,4667u,33180u},
+{4668u,4668u,33707u},{4669u,4669u,37000u},{4670u,4670u,19975u},{4671u,4671u,21325u},
+{4672u,4672u,23081u},{4673u,4673u,24018u},{4674u,4674u,24398u},{4675u,4675u,24930u},
+{4676u,4676u,25405u},{4677u,4677u,26217u},{4678u,4678u,26364u},{4679u,4679u,28415u},
+{4680u,4680u,28459u},{4681u,4681u,28771u},{4682u,4682u,30622u},{4683u,4683u,33836u},
+{4684u,4684u,34067u},{4685u,4685u,34875u},{4686u,4686u,36627u},{4687u,4687u,39237u},
+{4688u,4688u,39995u},{4689u,4689u,21788u},{4690u,4690u,25273u},{4691u,4691u,26411u},
+{4692u,4692u,27819u},{4693u,4693u,33545u},{4694u,4694u,35178u},{4695u,4695u,38778u},
+{4696u,4696u,20129u},{4697u,4697u,22916u},{4698u,4699u,24536u},{4700u,4700u,26395u},
+{4701u,4701u,32178u},{4702u,4702u,32596u},{4703u,4703u,33426u},{4704u,4704u,33579u},
+{4705u,4705u,33725u},{4706u,4706u,36638u},{4707u,4707u,37017u},{4708u,4708u,22475u},
+{4709u,4709u,22969u},{4710u,4710u,23186u},{4711u,4711u,23504u},{4712u,4712u,26151u},
+{4713u,4713u,26522u},{4714u,4714u,26757u},{4715u,4715u,27599u},{4716u,4716u,29028u},
+{4717u,4717u,32629u},{4718u,4718u,36023u},{4719u,4719u,36067u},{4720u,4720u,36993u},
+{4721u,4721u,39749u},{4722u,4722u,33032u},{4723u,4723u,35978u},{4724u,4724u,38476u},
+{4725u,4725u,39488u},{4726u,4726u,40613u},{4727u,4727u,23391u},{4728u,4728u,27667u},
+{4729u,4729u,29467u},{4730u,4730u,30450u},{4731u,4731u,30431u},{4732u,4732u,33804u},
+{4733u,4733u,20906u},{4734u,4734u,35219u},{4735u,4735u,20813u},{4736u,4736u,20885u},
+{4737u,4737u,21193u},{4738u,4738u,26825u},{4739u,4739u,27796u},{4740u,4740u,30468u},
+{4741u,4741u,30496u},{4742u,4742u,32191u},{4743u,4743u,32236u},{4744u,4744u,38754u},
+{4745u,4745u,40629u},{4746u,4746u,28357u},{4747u,4747u,34065u},{4748u,4748u,20901u},
+{4749u,4749u,21517u},{4750u,4750u,21629u},{4751u,4751u,26126u},{4752u,4752u,26269u},
+{4753u,4753u,26919u},{4754u,4754u,28319u},{4755u,4755u,30399u},{4756u,4756u,30609u},
+{4757u,4757u,33559u},{4758u,4758u,33986u},{4759u,4759u,34719u},{4760u,4760u,37225u},
+{4761u,4761u,37528u},{4762u,4762u,40180u},{4763u,4763u,34946u},{4764u,4764u,20398u},
+{4765u,4765u,20882u},{4766u,4766u,21215u},{4767u,4767u,22982u},{4768u,4768u,24125u},
+{4769u,4769u,24917u},{4770u,4771u,25720u},{4772u,4772u,26286u},{4773u,4773u,26576u},
+{4774u,4774u,27169u},{4775u,4775u,27597u},{4776u,4776u,27611u},{4777u,4777u,29279u},
+{4778u,4778u,29281u},{4779u,4779u,29761u},{4780u,4780u,30520u},{4781u,4781u,30683u},
+{4782u,4782u,32791u},{4783u,4783u,33468u},{4784u,4784u,33541u},{4785u,4785u,35584u},
+{4786u,4786u,35624u},{4787u,4787u,35980u},{4788u,4788u,26408u},{4789u,4789u,27792u},
+{4790u,4790u,29287u},{4791u,4791u,30446u},{4792u,4792u,30566u},{4793u,4793u,31302u},
+{4794u,4794u,40361u},{4795u,4795u,27519u},{4796u,4796u,27794u},{4797u,4797u,22818u},
+{4798u,4798u,26406u},{4799u,4799u,33945u},{4800u,4800u,21359u},{4801u,4801u,22675u},
+{4802u,4802u,22937u},{4803u,4803u,24287u},{4804u,4804u,25551u},{4805u,4805u,26164u},
+{4806u,4806u,26483u},{4807u,4807u,28218u},{4808u,4808u,29483u},{4809u,4809u,31447u},
+{4810u,4810u,33495u},{4811u,4811u,37672u},{4812u,4812u,21209u},{4813u,4813u,24043u},
+{4814u,4814u,25006u},{4815u,4815u,25035u},{4816u,4816u,25098u},{4817u,4817u,25287u},
+{4818u,4818u,25771u},{4819u,4819u,26080u},{4820u,4820u,26969u},{4821u,4821u,27494u},
+{4822u,4822u,27595u},{4823u,4823u,28961u},{4824u,4824u,29687u},{4825u,4825u,30045u},
+{4826u,4826u,32326u},{4827u,4827u,33310u},{4828u,4828u,33538u},{4829u,4829u,34154u},
+{4830u,4830u,35491u},{4831u,4831u,36031u},{4832u,4832u,38695u},{4833u,4833u,40289u},
+{4834u,4834u,22696u},{4835u,4835u,40664u},{4836u,4836u,20497u},{4837u,4837u,21006u},
+{4838u,4838u,21563u},{4839u,4839u,21839u},{4840u,4840u,25991u},{4841u,4841u,27766u},
+{4842u,4843u,32010u},{4844u,4844u,32862u},{4845u,4845u,34442u},{4846u,4846u,38272u},
+{4847u,4847u,38639u},{4848u,4848u,21247u},{4849u,4849u,27797u},{4850u,4850u,29289u},
+{4851u,4851u,21619u},{4852u,4852u,23194u},{4853u,4853u,23614u},{4854u,4854u,23883u},
+{4855u,4855u,24396u},{4856u,4856u,24494u},{4857u,4857u,26410u},{4858u,4858u,26806u},
+{4859u,4859u,26979u},{4860u,4860u,28220u},{4861u,4861u,28228u},{4862u,4862u,30473u},
+{4863u,4863u,31859u},{4864u,4864u,32654u},{4865u,4865u,34183u},{4866u,4866u,35598u},
+{4867u,4867u,36855u},{4868u,4868u,38753u},{4869u,4869u,40692u},{4870u,4870u,23735u},
+{4871u,4871u,24758u},{4872u,4872u,24845u},{4873u,4873u,25003u},{4874u,4874u,25935u},
+{4875u,4876u,26107u},{4877u,4877u,27665u},{4878u,4878u,27887u},{4879u,4879u,29599u},
+{4880u,4880u,29641u},{4881u,4881u,32225u},{4882u,4882u,38292u},{4883u,4883u,23494u},
+{4884u,4884u,34588u},{4885u,4885u,35600u},{4886u,4886u,21085u},{4887u,4887u,21338u},
+{4888u,4888u,25293u},{4889u,4889u,25615u},{4890u,4890u,25778u},{4891u,4891u,26420u},
+{4892u,4892u,27192u},{4893u,4893u,27850u},{4894u,4894u,29632u},{4895u,4895u,29854u},
+{4896u,4896u,31636u},{4897u,4897u,31893u},{4898u,4898u,32283u},{4899u,4899u,33162u},
+{4900u,4900u,33334u},{4901u,4901u,34180u},{4902u,4902u,36843u},{4903u,4903u,38649u},
+{4904u,4904u,39361u},{4905u,4905u,20276u},{4906u,4906u,21322u},{4907u,4907u,21453u},
+{4908u,4908u,21467u},{4909u,4909u,25292u},{4910u,4910u,25644u},{4911u,4911u,25856u},
+{4912u,4912u,26001u},{4913u,4913u,27075u},{4914u,4914u,27886u},{4915u,4915u,28504u},
+{4916u,4916u,29677u},{4917u,4917u,30036u},{4918u,4918u,30242u},{4919u,4919u,30436u},
+{4920u,4920u,30460u},{4921u,4921u,30928u},{4922u,4922u,30971u},{4923u,4923u,31020u},
+{4924u,4924u,32070u},{4925u,4925u,33324u},{4926u,4926u,34784u},{4927u,4927u,36820u},
+{4928u,4928u,38930u},{4929u,4929u,39151u},{4930u,4930u,21187u},{4931u,4931u,25300u},
+{4932u,4932u,25765u},{4933u,4933u,28196u},{4934u,4934u,28497u},{4935u,4935u,30332u},
+{4936u,4936u,36299u},{4937u,4937u,37297u},{4938u,4938u,37474u},{4939u,4939u,39662u},
+{4940u,4940u,39747u},{4941u,4941u,20515u},{4942u,4942u,20621u},{4943u,4943u,22346u},
+{4944u,4944u,22952u},{4945u,4945u,23592u},{4946u,4946u,24135u},{4947u,4947u,24439u},
+{4948u,4948u,25151u},{4949u,4949u,25918u},{4950u,4950u,26041u},{4951u,4951u,26049u},
+{4952u,4952u,26121u},{4953u,4953u,26507u},{4954u,4954u,27036u},{4955u,4955u,28354u},
+{4956u,4956u,30917u},{4957u,4957u,32033u},{4958u,4958u,32938u},{4959u,4959u,33152u},
+{4960u,4960u,33323u},{4961u,4961u,33459u},{4962u,4962u,33953u},{4963u,4963u,34444u},
+{4964u,4964u,35370u},{4965u,4965u,35607u},{4966u,4966u,37030u},{4967u,4967u,38450u},
+{4968u,4968u,40848u},{4969u,4969u,20493u},{4970u,4970u,20467u},{4971u,4971u,22521u},
+{4972u,4972u,24472u},{4973u,4973u,25308u},{4974u,4974u,25490u},{4975u,4975u,26479u},
+{4976u,4976u,28227u},{4977u,4977u,28953u},{4978u,4978u,30403u},{4979u,4979u,32972u},
+{4980u,4980u,32986u},{4981u,4982u,35060u},{4983u,4983u,35097u},{4984u,4984u,36064u},
+{4985u,4985u,36649u},{4986u,4986u,37197u},{4987u,4987u,38506u},{4988u,4988u,20271u},
+{4989u,4989u,20336u},{4990u,4990u,24091u},{4991u,4991u,26575u},{4992u,4992u,26658u},
+{4993u,4994u,30333u},{4995u,4995u,39748u},{4996u,4996u,24161u},{4997u,4997u,27146u},
+{4998u,4998u,29033u},{4999u,4999u,29140u},{5000u,5000u,30058u},{5001u,5001u,32321u},
+{5002u,5002u,34115u},{5003u,5003u,34281u},{5004u,5004u,39132u},{5005u,5005u,20240u},
+{5006u,5006u,31567u},{5007u,5007u,32624u},{5008u,5008u,38309u},{5009u,5009u,20961u},
+{5010u,5010u,24070u},{5011u,5011u,26805u},{5012u,5012u,27710u},{5013u,5013u,27726u},
+{5014u,5014u,27867u},{5015u,5015u,29359u},{5016u,5016u,31684u},{5017u,5017u,33539u},
+{5018u,5018u,27861u},{5019u,5019u,29754u},{5020u,5020u,20731u},{5021u,5021u,21128u},
+{5022u,5022u,22721u},{5023u,5023u,25816u},{5024u,5024u,27287u},{5025u,5025u,29863u},
+{5026u,5026u,30294u},{5027u,5027u,30887u},{5028u,5028u,34327u},{5029u,5029u,38370u},
+{5030u,5030u,38713u},{5031u,5031u,21342u},{5032u,5032u,24321u},{5033u,5033u,35722u},
+{5034u,5034u,36776u},{5035u,5035u,36783u},{5036u,5036u,37002u},{5037u,5037u,21029u},
+{5038u,5038u,30629u},{5039u,5039u,40009u},{5040u,5040u,40712u},{5041u,5041u,19993u},
+{5042u,5042u,20482u},{5043u,5043u,20853u},{5044u,5044u,23643u},{5045u,5045u,24183u},
+{5046u,5046u,26142u},{5047u,5047u,26170u},{5048u,5048u,26564u},{5049u,5049u,26821u},
+{5050u,5050u,28851u},{5051u,5051u,29953u},{5052u,5052u,30149u},{5053u,5053u,31177u},
+{5054u,5054u,31453u},{5055u,5055u,36647u},{5056u,5056u,39200u},{5057u,5057u,39432u},
+{5058u,5058u,20445u},{5059u,5059u,22561u},{5060u,5060u,22577u},{5061u,5061u,23542u},
+{5062u,5062u,26222u},{5063u,5063u,27493u},{5064u,5064u,27921u},{5065u,5065u,28282u},
+{5066u,5066u,28541u},{5067u,5067u,29668u},{5068u,5068u,29995u},{5069u,5069u,33769u},
+{5070u,5070u,35036u},{5071u,5071u,35091u},{5072u,5072u,35676u},{5073u,5073u,36628u},
+{5074u,5074u,20239u},{5075u,5075u,20693u},{5076u,5076u,21264u},{5077u,5077u,21340u},
+{5078u,5078u,23443u},{5079u,5079u,24489u},{5080u,5080u,26381u},{5081u,5081u,31119u},
+{5082u,5082u,33145u},{5083u,5083u,33583u},{5084u,5084u,34068u},{5085u,5085u,35079u},
+{5086u,5086u,35206u},{5087u,5087u,36665u},{5088u,5088u,36667u},{5089u,5089u,39333u},
+{5090u,5090u,39954u},{5091u,5091u,26412u},{5092u,5092u,20086u},{5093u,5093u,20472u},
+{5094u,5094u,22857u},{5095u,5095u,23553u},{5096u,5097u,23791u},{5098u,5098u,25447u},
+{5099u,5099u,26834u},{5100u,5100u,28925u},{5101u,5101u,29090u},{5102u,5102u,29739u},
+{5103u,5103u,32299u},{5104u,5104u,34028u},{5105u,5105u,34562u},{5106u,5106u,36898u},
+{5107u,5107u,37586u},{5108u,5108u,40179u},{5109u,5109u,19981u},{5110u,5110u,20184u},
+{5111u,5111u,20463u},{5112u,5112u,20613u},{5113u,5113u,21078u},{5114u,5114u,21103u},
+{5115u,5115u,21542u},{5116u,5116u,21648u},{5117u,5117u,22496u},{5118u,5118u,22827u},
+{5119u,5119u,23142u},{5120u,5120u,23386u},{5121u,5121u,23413u},{5122u,5122u,23500u},
+{5123u,5123u,24220u},{5124u,5124u,25206u},{5125u,5125u,25975u},{5126u,5126u,26023u},
+{5127u,5127u,28014u},{5128u,5128u,28325u},{5129u,5129u,29238u},{5130u,5130u,31526u},
+{5131u,5131u,31807u},{5132u,5132u,32566u},{5133u,5134u,33104u},{5135u,5135u,33178u},
+{5136u,5136u,33344u},{5137u,5137u,33433u},{5138u,5138u,33705u},{5139u,5139u,35331u},
+{5140u,5140u,36000u},{5141u,5141u,36070u},{5142u,5142u,36091u},{5143u,5143u,36212u},
+{5144u,5144u,36282u},{5145u,5145u,37096u},{5146u,5146u,37340u},{5147u,5147u,38428u},
+{5148u,5148u,38468u},{5149u,5149u,39385u},{5150u,5150u,40167u},{5151u,5151u,21271u},
+{5152u,5152u,20998u},{5153u,5153u,21545u},{5154u,5154u,22132u},{5155u,5155u,22707u},
+{5156u,5156u,22868u},{5157u,5157u,22894u},{5158u,5158u,24575u},{5159u,5159u,24996u},
+{5160u,5160u,25198u},{5161u,5161u,26128u},{5162u,5162u,27774u},{5163u,5163u,28954u},
+{5164u,5164u,30406u},{5165u,5165u,31881u},{5166u,5166u,31966u},{5167u,5167u,32027u},
+{5168u,5168u,33452u},{5169u,5169u,36033u},{5170u,5170u,38640u},{5171u,5171u,20315u},
+{5172u,5172u,24343u},{5173u,5173u,24447u},{5174u,5174u,25282u},{5175u,5175u,23849u},
+{5176u,5176u,26379u},{5177u,5177u,26842u},{5178u,5178u,30844u},{5179u,5179u,32323u},
+{5180u,5180u,40300u},{5181u,5181u,19989u},{5182u,5182u,20633u},{5183u,5183u,21269u},
+{5184u,5184u,21290u},{5185u,5185u,21329u},{5186u,5186u,22915u},{5187u,5187u,23138u},
+{5188u,5188u,24199u},{5189u,5189u,24754u},{5190u,5190u,24970u},{5191u,5191u,25161u},
+{5192u,5192u,25209u},{5193u,5193u,26000u},{5194u,5194u,26503u},{5195u,5195u,27047u},
+{5196u,5196u,27604u},{5197u,5199u,27606u},{5200u,5200u,27832u},{5201u,5201u,29749u},
+{5202u,5202u,30202u},{5203u,5203u,30738u},{5204u,5204u,30865u},{5205u,5205u,31189u},
+{5206u,5206u,31192u},{5207u,5207u,31875u},{5208u,5208u,32203u},{5209u,5209u,32737u},
+{5210u,5210u,32933u},{5211u,5211u,33086u},{5212u,5212u,33218u},{5213u,5213u,33778u},
+{5214u,5214u,34586u},{5215u,5215u,35048u},{5216u,5216u,35513u},{5217u,5217u,35692u},
+{5218u,5218u,36027u},{5219u,5219u,37145u},{5220u,5220u,38750u},{5221u,5221u,39131u},
+{5222u,5222u,40763u},{5223u,5223u,22188u},{5224u,5224u,23338u},{5225u,5225u,24428u},
+{5226u,5226u,25996u},{5227u,5227u,27315u},{5228u,5228u,27567u},{5229u,5229u,27996u},
+{5230u,5230u,28657u},{5231u,5231u,28693u},{5232u,5232u,29277u},{5233u,5233u,29613u},
+{5234u,5234u,36007u},{5235u,5235u,36051u},{5236u,5236u,38971u},{5237u,5237u,24977u},
+{5238u,5238u,27703u},{5239u,5239u,32856u},{5240u,5240u,39425u},{5241u,5241u,20045u},
+{5242u,5242u,20107u},{5243u,5243u,20123u},{5244u,5244u,20181u},{5245u,5245u,20282u},
+{5246u,5246u,20284u},{5247u,5247u,20351u},{5248u,5248u,20447u},{5249u,5249u,20735u},
+{5250u,5250u,21490u},{5251u,5251u,21496u},{5252u,5252u,21766u},{5253u,5253u,21987u},
+{5254u,5254u,22235u},{5255u,5255u,22763u},{5256u,5256u,22882u},{5257u,5257u,23057u},
+{5258u,5258u,23531u},{5259u,5259u,23546u},{5260u,5260u,23556u},{5261u,5261u,24051u},
+{5262u,5262u,24107u},{5263u,5263u,24473u},{5264u,5264u,24605u},{5265u,5265u,25448u},
+{5266u,5266u,26012u},{5267u,5267u,26031u},{5268u,5268u,26614u},{5269u,5269u,26619u},
+{5270u,5270u,26797u},{5271u,5271u,27515u},{5272u,5272u,27801u},{5273u,5273u,27863u},
+{5274u,5274u,28195u},{5275u,5275u,28681u},{5276u,5276u,29509u},{5277u,5277u,30722u},
+{5278u,5278u,31038u},{5279u,5279u,31040u},{5280u,5280u,31072u},{5281u,5281u,31169u},
+{5282u,5282u,31721u},{5283u,5283u,32023u},{5284u,5284u,32114u},{5285u,5285u,32902u},
+{5286u,5286u,33293u},{5287u,5287u,33678u},{5288u,5288u,34001u},{5289u,5289u,34503u},
+{5290u,5290u,35039u},{5291u,5291u,35408u},{5292u,5292u,35422u},{5293u,5293u,35613u},
+{5294u,5294u,36060u},{5295u,5295u,36198u},{5296u,5296u,36781u},{5297u,5297u,37034u},
+{5298u,5298u,39164u},{5299u,5299u,39391u},{5300u,5300u,40605u},{5301u,5301u,21066u},
+{5302u,5302u,26388u},{5303u,5303u,20632u},{5304u,5304u,21034u},{5305u,5305u,23665u},
+{5306u,5306u,25955u},{5307u,5307u,27733u},{5308u,5308u,29642u},{5309u,5309u,29987u},
+{5310u,5310u,30109u},{5311u,5311u,31639u},{5312u,5312u,33948u},{5313u,5313u,37240u},
+{5314u,5314u,38704u},{5315u,5315u,20087u},{5316u,5316u,25746u},{5317u,5317u,27578u},
+{5318u,5318u,29022u},{5319u,5319u,34217u},{5320u,5320u,19977u},{5321u,5321u,26441u},
+{5322u,5322u,26862u},{5323u,5323u,28183u},{5324u,5324u,33439u},{5325u,5325u,34072u},
+{5326u,5326u,34923u},{5327u,5327u,25591u},{5328u,5328u,28545u},{5329u,5329u,37394u},
+{5330u,5330u,39087u},{5331u,5331u,19978u},{5332u,5332u,20663u},{5333u,5333u,20687u},
+{5334u,5334u,20767u},{5335u,5335u,21830u},{5336u,5336u,21930u},{5337u,5337u,22039u},
+{5338u,5338u,23360u},{5339u,5339u,23577u},{5340u,5340u,23776u},{5341u,5341u,24120u},
+{5342u,5342u,24202u},{5343u,5343u,24224u},{5344u,5344u,24258u},{5345u,5345u,24819u},
+{5346u,5346u,26705u},{5347u,5347u,27233u},{5348u,5348u,28248u},{5349u,5349u,29245u},
+{5350u,5350u,29248u},{5351u,5351u,29376u},{5352u,5352u,30456u},{5353u,5353u,31077u},
+{5354u,5354u,31665u},{5355u,5355u,32724u},{5356u,5356u,35059u},{5357u,5357u,35316u},
+{5358u,5358u,35443u},{5359u,5359u,35937u},{5360u,5360u,36062u},{5361u,5361u,38684u},
+{5362u,5362u,22622u},{5363u,5363u,29885u},{5364u,5364u,36093u},{5365u,5365u,21959u},
+{5366u,5366u,31329u},{5367u,5367u,32034u},{5368u,5368u,33394u},{5369u,5369u,29298u},
+{5370u,5370u,29983u},{5371u,5371u,29989u},{5372u,5372u,31513u},{5373u,5373u,22661u},
+{5374u,5374u,22779u},{5375u,5375u,23996u},{5376u,5376u,24207u},{5377u,5377u,24246u},
+{5378u,5378u,24464u},{5379u,5379u,24661u},{5380u,5380u,25234u},{5381u,5381u,25471u},
+{5382u,5382u,25933u},{5383u,5383u,26257u},{5384u,5384u,26329u},{5385u,5385u,26360u},
+{5386u,5386u,26646u},{5387u,5387u,26866u},{5388u,5388u,29312u},{5389u,5389u,29790u},
+{5390u,5390u,31598u},{5391u,5391u,32110u},{5392u,5392u,32214u},{5393u,5393u,32626u},
+{5394u,5394u,32997u},{5395u,5395u,33298u},{5396u,5396u,34223u},{5397u,5397u,35199u},
+{5398u,5398u,35475u},{5399u,5399u,36893u},{5400u,5400u,37604u},{5401u,5401u,40653u},
+{5402u,5402u,40736u},{5403u,5403u,22805u},{5404u,5404u,22893u},{5405u,5405u,24109u},
+{5406u,5406u,24796u},{5407u,5407u,26132u},{5408u,5408u,26227u},{5409u,5409u,26512u},
+{5410u,5410u,27728u},{5411u,5411u,28101u},{5412u,5412u,28511u},{5413u,5413u,30707u},
+{5414u,5414u,30889u},{5415u,5415u,33990u},{5416u,5416u,37323u},{5417u,5417u,37675u},
+{5418u,5418u,20185u},{5419u,5419u,20682u},{5420u,5420u,20808u},{5421u,5421u,21892u},
+{5422u,5422u,23307u},{5423u,5423u,23459u},{5424u,5424u,25159u},{5425u,5425u,25982u},
+{5426u,5426u,26059u},{5427u,5427u,28210u},{5428u,5428u,29053u},{5429u,5429u,29697u},
+{5430u,5430u,29764u},{5431u,5431u,29831u},{5432u,5432u,29887u},{5433u,5433u,30316u},
+{5434u,5434u,31146u},{5435u,5435u,32218u},{5436u,5436u,32341u},{5437u,5437u,32680u},
+{5438u,5438u,33146u},{5439u,5439u,33203u},{5440u,5440u,33337u},{5441u,5441u,34330u},
+{5442u,5442u,34796u},{5443u,5443u,35445u},{5444u,5444u,36323u},{5445u,5445u,36984u},
+{5446u,5446u,37521u},{5447u,5447u,37925u},{5448u,5448u,39245u},{5449u,5449u,39854u},
+{5450u,5450u,21352u},{5451u,5451u,23633u},{5452u,5452u,26964u},{5453u,5453u,27844u},
+{5454u,5454u,27945u},{5455u,5455u,28203u},{5456u,5456u,33292u},{5457u,5457u,34203u},
+{5458u,5458u,35131u},{5459u,5459u,35373u},{5460u,5460u,35498u},{5461u,5461u,38634u},
+{5462u,5462u,40807u},{5463u,5463u,21089u},{5464u,5464u,26297u},{5465u,5465u,27570u},
+{5466u,5466u,32406u},{5467u,5467u,34814u},{5468u,5468u,36109u},{5469u,5469u,38275u},
+{5470u,5470u,38493u},{5471u,5471u,25885u},{5472u,5472u,28041u},{5473u,5473u,29166u},
+{5474u,5474u,22478u},{5475u,5475u,22995u},{5476u,5476u,23468u},{5477u,5477u,24615u},
+{5478u,5478u,24826u},{5479u,5479u,25104u},{5480u,5480u,26143u},{5481u,5481u,26207u},
+{5482u,5482u,29481u},{5483u,5483u,29689u},{5484u,5484u,30427u},{5485u,5485u,30465u},
+{5486u,5486u,31596u},{5487u,5487u,32854u},{5488u,5488u,32882u},{5489u,5489u,33125u},
+{5490u,5490u,35488u},{5491u,5491u,37266u},{5492u,5492u,19990u},{5493u,5493u,21218u},
+{5494u,5494u,27506u},{5495u,5495u,27927u},{5496u,5496u,31237u},{5497u,5497u,31545u},
+{5498u,5498u,32048u},{5499u,5499u,36016u},{5500u,5500u,21484u},{5501u,5501u,22063u},
+{5502u,5502u,22609u},{5503u,5503u,23477u},{5504u,5504u,23567u},{5505u,5505u,23569u},
+{5506u,5506u,24034u},{5507u,5507u,25152u},{5508u,5508u,25475u},{5509u,5509u,25620u},
+{5510u,5510u,26157u},{5511u,5511u,26803u},{5512u,5512u,27836u},{5513u,5513u,28040u},
+{5514u,5514u,28335u},{5515u,5515u,28703u},{5516u,5516u,28836u},{5517u,5517u,29138u},
+{5518u,5518u,29990u},{5519u,5519u,30095u},{5520u,5520u,30094u},{5521u,5521u,30233u},
+{5522u,5522u,31505u},{5523u,5523u,31712u},{5524u,5524u,31787u},{5525u,5525u,32032u},
+{5526u,5526u,32057u},{5527u,5527u,34092u},{5528u,5528u,34157u},{5529u,5529u,34311u},
+{5530u,5530u,35380u},{5531u,5531u,36877u},{5532u,5532u,36961u},{5533u,5533u,37045u},
+{5534u,5534u,37559u},{5535u,5535u,38902u},{5536u,5536u,39479u},{5537u,5537u,20439u},
+{5538u,5538u,23660u},{5539u,5539u,26463u},{5540u,5540u,28049u},{5541u,5541u,31903u},
+{5542u,5542u,32396u},{5543u,5543u,35606u},{5544u,5544u,36118u},{5545u,5545u,36895u},
+{5546u,5546u,23403u},{5547u,5547u,24061u},{5548u,5548u,25613u},{5549u,5549u,33984u},
+{5550u,5550u,36956u},{5551u,5551u,39137u},{5552u,5552u,29575u},{5553u,5553u,23435u},
+{5554u,5554u,24730u},{5555u,5555u,26494u},{5556u,5556u,28126u},{5557u,5557u,35359u},
+{5558u,5558u,35494u},{5559u,5559u,36865u},{5560u,5560u,38924u},{5561u,5561u,21047u},
+{5562u,5562u,28753u},{5563u,5563u,30862u},{5564u,5564u,37782u},{5565u,5565u,34928u},
+{5566u,5566u,37335u},{5567u,5567u,20462u},{5568u,5568u,21463u},{5569u,5569u,22013u},
+{5570u,5570u,22234u},{5571u,5571u,22402u},{5572u,5572u,22781u},{5573u,5573u,23234u},
+{5574u,5574u,23432u},{5575u,5575u,23723u},{5576u,5576u,23744u},{5577u,5577u,24101u},
+{5578u,5578u,24833u},{5579u,5579u,25101u},{5580u,5580u,25163u},{5581u,5581u,25480u},
+{5582u,5582u,25628u},{5583u,5583u,25910u},{5584u,5584u,25976u},{5585u,5585u,27193u},
+{5586u,5586u,27530u},{5587u,5587u,27700u},{5588u,5588u,27929u},{5589u,5589u,28465u},
+{5590u,5590u,29159u},{5591u,5591u,29417u},{5592u,5592u,29560u},{5593u,5593u,29703u},
+{5594u,5594u,29874u},{5595u,5595u,30246u},{5596u,5596u,30561u},{5597u,5597u,31168u},
+{5598u,5598u,31319u},{5599u,5599u,31466u},{5600u,5600u,31929u},{5601u,5601u,32143u},
+{5602u,5602u,32172u},{5603u,5603u,32353u},{5604u,5604u,32670u},{5605u,5605u,33065u},
+{5606u,5606u,33585u},{5607u,5607u,33936u},{5608u,5608u,34010u},{5609u,5609u,34282u},
+{5610u,5610u,34966u},{5611u,5611u,35504u},{5612u,5612u,35728u},{5613u,5613u,36664u},
+{5614u,5614u,36930u},{5615u,5615u,36995u},{5616u,5616u,37228u},{5617u,5617u,37526u},
+{5618u,5618u,37561u},{5619u,5619u,38539u},{5620u,5621u,38567u},{5622u,5622u,38614u},
+{5623u,5623u,38656u},{5624u,5624u,38920u},{5625u,5625u,39318u},{5626u,5626u,39635u},
+{5627u,5627u,39706u},{5628u,5628u,21460u},{5629u,5629u,22654u},{5630u,5630u,22809u},
+{5631u,5631u,23408u},{5632u,5632u,23487u},{5633u,5633u,28113u},{5634u,5634u,28506u},
+{5635u,5635u,29087u},{5636u,5636u,29729u},{5637u,5637u,29881u},{5638u,5638u,32901u},
+{5639u,5639u,33789u},{5640u,5640u,24033u},{5641u,5641u,24455u},{5642u,5642u,24490u},
+{5643u,5643u,24642u},{5644u,5644u,26092u},{5645u,5645u,26642u},{5646u,5646u,26991u},
+{5647u,5647u,27219u},{5648u,5648u,27529u},{5649u,5649u,27957u},{5650u,5650u,28147u},
+{5651u,5651u,29667u},{5652u,5652u,30462u},{5653u,5653u,30636u},{5654u,5654u,31565u},
+{5655u,5655u,32020u},{5656u,5656u,33059u},{5657u,5657u,33308u},{5658u,5658u,33600u},
+{5659u,5659u,34036u},{5660u,5660u,34147u},{5661u,5661u,35426u},{5662u,5662u,35524u},
+{5663u,5663u,37255u},{5664u,5664u,37662u},{5665u,5665u,38918u},{5666u,5666u,39348u},
+{5667u,5667u,25100u},{5668u,5668u,34899u},{5669u,5669u,36848u},{5670u,5670u,37477u},
+{5671u,5671u,23815u},{5672u,5672u,23847u},{5673u,5673u,23913u},{5674u,5674u,29791u},
+{5675u,5675u,33181u},{5676u,5676u,34664u},{5677u,5677u,28629u},{5678u,5678u,25342u},
+{5679u,5679u,32722u},{5680u,5680u,35126u},{5681u,5681u,35186u},{5682u,5682u,19998u},
+{5683u,5683u,20056u},{5684u,5684u,20711u},{5685u,5685u,21213u},{5686u,5686u,21319u},
+{5687u,5687u,25215u},{5688u,5688u,26119u},{5689u,5689u,32361u},{5690u,5690u,34821u},
+{5691u,5691u,38494u},{5692u,5692u,20365u},{5693u,5693u,21273u},{5694u,5694u,22070u},
+{5695u,5695u,22987u},{5696u,5696u,23204u},{5697u,5697u,23608u},{5698u,5698u,23630u},
+{5699u,5699u,23629u},{5700u,5700u,24066u},{5701u,5701u,24337u},{5702u,5702u,24643u},
+{5703u,5703u,26045u},{5704u,5704u,26159u},{5705u,5705u,26178u},{5706u,5706u,26558u},
+{5707u,5707u,26612u},{5708u,5708u,29468u},{5709u,5709u,30690u},{5710u,5710u,31034u},
+{5711u,5711u,32709u},{5712u,5712u,33940u},{5713u,5713u,33997u},{5714u,5714u,35222u},
+{5715u,5715u,35430u},{5716u,5716u,35433u},{5717u,5717u,35553u},{5718u,5718u,35925u},
+{5719u,5719u,35962u},{5720u,5720u,22516u},{5721u,5721u,23508u},{5722u,5722u,24335u},
+{5723u,5723u,24687u},{5724u,5724u,25325u},{5725u,5725u,26893u},{5726u,5726u,27542u},
+{5727u,5727u,28252u},{5728u,5728u,29060u},{5729u,5729u,31698u},{5730u,5730u,34645u},
+{5731u,5731u,35672u},{5732u,5732u,36606u},{5733u,5733u,39135u},{5734u,5734u,39166u},
+{5735u,5735u,20280u},{5736u,5736u,20353u},{5737u,5737u,20449u},{5738u,5738u,21627u},
+{5739u,5739u,23072u},{5740u,5740u,23480u},{5741u,5741u,24892u},{5742u,5742u,26032u},
+{5743u,5743u,26216u},{5744u,5744u,29180u},{5745u,5745u,30003u},{5746u,5746u,31070u},
+{5747u,5747u,32051u},{5748u,5748u,33102u},{5749u,5749u,33251u},{5750u,5750u,33688u},
+{5751u,5751u,34218u},{5752u,5752u,34254u},{5753u,5753u,34563u},{5754u,5754u,35338u},
+{5755u,5755u,36523u},{5756u,5756u,36763u},{5757u,5757u,36805u},{5758u,5758u,22833u},
+{5759u,5759u,23460u},{5760u,5760u,23526u},{5761u,5761u,24713u},{5762u,5762u,23529u},
+{5763u,5763u,23563u},{5764u,5764u,24515u},{5765u,5765u,27777u},{5766u,5766u,28145u},
+{5767u,5767u,28683u},{5768u,5768u,29978u},{5769u,5769u,33455u},{5770u,5770u,35574u},
+{5771u,5771u,20160u},{5772u,5772u,21313u},{5773u,5773u,38617u},{5774u,5774u,27663u},
+{5775u,5775u,20126u},{5776u,5776u,20420u},{5777u,5777u,20818u},{5778u,5778u,21854u},
+{5779u,5779u,23077u},{5780u,5780u,23784u},{5781u,5781u,25105u},{5782u,5782u,29273u},
+{5783u,5783u,33469u},{5784u,5784u,33706u},{5785u,5785u,34558u},{5786u,5786u,34905u},
+{5787u,5787u,35357u},{5788u,5788u,38463u},{5789u,5789u,38597u},{5790u,5790u,39187u},
+{5791u,5791u,40201u},{5792u,5792u,40285u},{5793u,5793u,22538u},{5794u,5794u,23731u},
+{5795u,5795u,23997u},{5796u,5796u,24132u},{5797u,5797u,24801u},{5798u,5798u,24853u},
+{5799u,5799u,25569u},{5800u,5800u,27138u},{5801u,5801u,28197u},{5802u,5802u,37122u},
+{5803u,5803u,37716u},{5804u,5804u,38990u},{5805u,5805u,39952u},{5806u,5806u,40823u},
+{5807u,5807u,23433u},{5808u,5808u,23736u},{5809u,5809u,25353u},{5810u,5810u,26191u},
+{5811u,5811u,26696u},{5812u,5812u,30524u},{5813u,5813u,38593u},{5814u,5814u,38797u},
+{5815u,5815u,38996u},{5816u,5816u,39839u},{5817u,5817u,26017u},{5818u,5818u,35585u},
+{5819u,5819u,36555u},{5820u,5820u,38332u},{5821u,5821u,21813u},{5822u,5822u,23721u},
+{5823u,5823u,24022u},{5824u,5824u,24245u},{5825u,5825u,26263u},{5826u,5826u,30284u},
+{5827u,5827u,33780u},{5828u,5828u,38343u},{5829u,5829u,22739u},{5830u,5830u,25276u},
+{5831u,5831u,29390u},{5832u,5832u,40232u},{5833u,5833u,20208u},{5834u,5834u,22830u},
+{5835u,5835u,24591u},{5836u,5836u,26171u},{5837u,5837u,27523u},{5838u,5838u,31207u},
+{5839u,5839u,40230u},{5840u,5840u,21395u},{5841u,5841u,21696u},{5842u,5842u,22467u},
+{5843u,5843u,23830u},{5844u,5844u,24859u},{5845u,5845u,26326u},{5846u,5846u,28079u},
+{5847u,5847u,30861u},{5848u,5848u,33406u},{5849u,5849u,38552u},{5850u,5850u,38724u},
+{5851u,5851u,21380u},{5852u,5852u,25212u},{5853u,5853u,25494u},{5854u,5854u,28082u},
+{5855u,5855u,32266u},{5856u,5856u,33099u},{5857u,5857u,38989u},{5858u,5858u,27387u},
+{5859u,5859u,32588u},{5860u,5860u,40367u},{5861u,5861u,40474u},{5862u,5862u,20063u},
+{5863u,5863u,20539u},{5864u,5864u,20918u},{5865u,5865u,22812u},{5866u,5866u,24825u},
+{5867u,5867u,25590u},{5868u,5868u,26928u},{5869u,5869u,29242u},{5870u,5870u,32822u},
+{5871u,5871u,37326u},{5872u,5872u,24369u},{5873u,5873u,32004u},{5874u,5874u,33509u},
+{5875u,5875u,33903u},{5876u,5876u,33979u},{5877u,5877u,34277u},{5878u,5878u,36493u},
+{5879u,5879u,20335u},{5880u,5880u,22756u},{5881u,5881u,23363u},{5882u,5882u,24665u},
+{5883u,5883u,25562u},{5884u,5884u,25880u},{5885u,5885u,25965u},{5886u,5886u,26264u},
+{5887u,5887u,26954u},{5888u,5888u,27171u},{5889u,5889u,27915u},{5890u,5890u,28673u},
+{5891u,5891u,29036u},{5892u,5892u,30162u},{5893u,5893u,30221u},{5894u,5894u,31155u},
+{5895u,5895u,31344u},{5896u,5896u,32650u},{5897u,5897u,35140u},{5898u,5898u,35731u},
+{5899u,5899u,37312u},{5900u,5900u,38525u},{5901u,5901u,39178u},{5902u,5902u,22276u},
+{5903u,5903u,24481u},{5904u,5904u,26044u},{5905u,5905u,28417u},{5906u,5906u,30208u},
+{5907u,5907u,31142u},{5908u,5908u,35486u},{5909u,5909u,39341u},{5910u,5910u,39770u},
+{5911u,5911u,40812u},{5912u,5912u,20740u},{5913u,5913u,25014u},{5914u,5914u,25233u},
+{5915u,5915u,27277u},{5916u,5916u,33222u},{5917u,5917u,20547u},{5918u,5918u,22576u},
+{5919u,5919u,24422u},{5920u,5920u,28937u},{5921u,5921u,35328u},{5922u,5922u,35578u},
+{5923u,5923u,23420u},{5924u,5924u,34326u},{5925u,5925u,20474u},{5926u,5926u,20796u},
+{5927u,5927u,22196u},{5928u,5928u,22852u},{5929u,5929u,25513u},{5930u,5930u,28153u},
+{5931u,5931u,23978u},{5932u,5932u,26989u},{5933u,5933u,20870u},{5934u,5934u,20104u},
+{5935u,5935u,20313u},{5936u,5936u,22914u},{5937u,5937u,27487u},{5938u,5938u,27741u},
+{5939u,5939u,29877u},{5940u,5940u,30998u},{5941u,5941u,33287u},{5942u,5942u,33349u},
+{5943u,5943u,33593u},{5944u,5944u,36671u},{5945u,5945u,36701u},{5946u,5946u,39192u},
+{5947u,5947u,20134u},{5948u,5948u,22495u},{5949u,5949u,24441u},{5950u,5950u,26131u},
+{5951u,5951u,30123u},{5952u,5952u,32377u},{5953u,5953u,35695u},{5954u,5954u,36870u},
+{5955u,5955u,39515u},{5956u,5956u,22181u},{5957u,5957u,22567u},{5958u,5958u,23032u},
+{5959u,5959u,23071u},{5960u,5960u,23476u},{5961u,5961u,24310u},{5962u,5962u,25424u},
+{5963u,5963u,25403u},{5964u,5964u,26941u},{5965u,5965u,27783u},{5966u,5966u,27839u},
+{5967u,5967u,28046u},{5968u,5968u,28051u},{5969u,5969u,28149u},{5970u,5970u,28436u},
+{5971u,5971u,28895u},{5972u,5972u,28982u},{5973u,5973u,29017u},{5974u,5974u,29123u},
+{5975u,5975u,29141u},{5976u,5976u,30799u},{5977u,5977u,30831u},{5978u,5978u,31605u},
+{5979u,5979u,32227u},{5980u,5980u,32303u},{5981u,5981u,34893u},{5982u,5982u,36575u},
+{5983u,5983u,37467u},{5984u,5984u,40182u},{5985u,5985u,24709u},{5986u,5986u,28037u},
+{5987u,5987u,29105u},{5988u,5988u,38321u},{5989u,5989u,21421u},{5990u,5990u,26579u},
+{5991u,5991u,28814u},{5992u,5992u,28976u},{5993u,5993u,29744u},{5994u,5994u,33398u},
+{5995u,5995u,33490u},{5996u,5996u,38331u},{5997u,5997u,39653u},{5998u,5998u,40573u},
+{5999u,5999u,26308u},{6000u,6000u,29121u},{6001u,6001u,33865u},{6002u,6002u,22603u},
+{6003u,6003u,23992u},{6004u,6004u,24433u},{6005u,6005u,26144u},{6006u,6006u,26254u},
+{6007u,6007u,27001u},{6008u,6008u,27054u},{6009u,6009u,27704u},{6010u,6010u,27891u},
+{6011u,6011u,28214u},{6012u,6012u,28481u},{6013u,6013u,28634u},{6014u,6014u,28699u},
+{6015u,6015u,28719u},{6016u,6016u,29008u},{6017u,6017u,29151u},{6018u,6018u,29552u},
+{6019u,6019u,29787u},{6020u,6020u,29908u},{6021u,6021u,30408u},{6022u,6022u,31310u},
+{6023u,6023u,32403u},{6024u,6024u,33521u},{6025u,6025u,35424u},{6026u,6026u,36814u},
+{6027u,6027u,37704u},{6028u,6028u,38681u},{6029u,6029u,20034u},{6030u,6030u,20522u},
+{6031u,6031u,21000u},{6032u,6032u,21473u},{6033u,6033u,26355u},{6034u,6034u,27757u},
+{6035u,6035u,28618u},{6036u,6036u,29450u},{6037u,6037u,30591u},{6038u,6038u,31330u},
+{6039u,6039u,33454u},{6040u,6040u,34269u},{6041u,6041u,34306u},{6042u,6042u,35028u},
+{6043u,6043u,35427u},{6044u,6044u,35709u},{6045u,6045u,35947u},{6046u,6046u,37555u},
+{6047u,6047u,38675u},{6048u,6048u,38928u},{6049u,6049u,20116u},{6050u,6050u,20237u},
+{6051u,6051u,20425u},{6052u,6052u,20658u},{6053u,6053u,21320u},{6054u,6054u,21566u},
+{6055u,6055u,21555u},{6056u,6056u,21978u},{6057u,6057u,22626u},{6058u,6058u,22714u},
+{6059u,6059u,22887u},{6060u,6060u,23067u},{6061u,6061u,23524u},{6062u,6062u,24735u},
+{6063u,6063u,25034u},{6064u,6064u,25942u},{6065u,6065u,26111u},{6066u,6066u,26212u},
+{6067u,6067u,26791u},{6068u,6068u,27738u},{6069u,6069u,28595u},{6070u,6070u,28879u},
+{6071u,6071u,29100u},{6072u,6072u,29522u},{6073u,6073u,31613u},{6074u,6074u,34568u},
+{6075u,6075u,35492u},{6076u,6076u,39986u},{6077u,6077u,40711u},{6078u,6078u,23627u},
+{6079u,6079u,27779u},{6080u,6080u,29508u},{6081u,6081u,29577u},{6082u,6082u,37434u},
+{6083u,6083u,28331u},{6084u,6084u,29797u},{6085u,6085u,30239u},{6086u,6086u,31337u},
+{6087u,6087u,32277u},{6088u,6088u,34314u},{6089u,6089u,20800u},{6090u,6090u,22725u},
+{6091u,6091u,25793u},{6092u,6092u,29934u},{6093u,6093u,29973u},{6094u,6094u,30320u},
+{6095u,6095u,32705u},{6096u,6096u,37013u},{6097u,6097u,38605u},{6098u,6098u,39252u},
+{6099u,6099u,28198u},{6100u,6100u,29926u},{6101u,6102u,31401u},{6103u,6103u,33253u},
+{6104u,6104u,34521u},{6105u,6105u,34680u},{6106u,6106u,35355u},{6107u,6107u,23113u},
+{6108u,6108u,23436u},{6109u,6109u,23451u},{6110u,6110u,26785u},{6111u,6111u,26880u},
+{6112u,6112u,28003u},{6113u,6113u,29609u},{6114u,6114u,29715u},{6115u,6115u,29740u},
+{6116u,6116u,30871u},{6117u,6117u,32233u},{6118u,6118u,32747u},{6119u,6119u,33048u},
+{6120u,6120u,33109u},{6121u,6121u,33694u},{6122u,6122u,35916u},{6123u,6123u,38446u},
+{6124u,6124u,38929u},{6125u,6125u,26352u},{6126u,6126u,24448u},{6127u,6127u,26106u},
+{6128u,6128u,26505u},{6129u,6129u,27754u},{6130u,6130u,29579u},{6131u,6131u,20525u},
+{6132u,6132u,23043u},{6133u,6133u,27498u},{6134u,6134u,30702u},{6135u,6135u,22806u},
+{6136u,6136u,23916u},{6137u,6137u,24013u},{6138u,6138u,29477u},{6139u,6139u,30031u},
+{6140u,6140u,20709u},{6141u,6141u,20985u},{6142u,6142u,22575u},{6143u,6143u,22829u},
+{6144u,6144u,22934u},{6145u,6145u,23002u},{6146u,6146u,23525u},{6147u,6147u,23970u},
+{6148u,6148u,25303u},{6149u,6149u,25622u},{6150u,6150u,25747u},{6151u,6151u,25854u},
+{6152u,6152u,26332u},{6153u,6153u,27208u},{6154u,6154u,29183u},{6155u,6155u,29796u},
+{6156u,6156u,31368u},{6157u,6157u,31407u},{6158u,6158u,32327u},{6159u,6159u,32350u},
+{6160u,6160u,32768u},{6161u,6161u,33136u},{6162u,6162u,34799u},{6163u,6163u,35201u},
+{6164u,6164u,35616u},{6165u,6165u,36953u},{6166u,6166u,36992u},{6167u,6167u,39250u},
+{6168u,6168u,24958u},{6169u,6169u,27442u},{6170u,6170u,28020u},{6171u,6171u,32287u},
+{6172u,6172u,35109u},{6173u,6173u,36785u},{6174u,6174u,20433u},{6175u,6175u,20653u},
+{6176u,6176u,20887u},{6177u,6177u,21191u},{6178u,6178u,22471u},{6179u,6179u,22665u},
+{6180u,6180u,23481u},{6181u,6181u,24248u},{6182u,6182u,24898u},{6183u,6183u,27029u},
+{6184u,6184u,28044u},{6185u,6185u,28263u},{6186u,6186u,28342u},{6187u,6187u,29076u},
+{6188u,6188u,29794u},{6189u,6189u,29992u},{6190u,6190u,29996u},{6191u,6191u,32883u},
+{6192u,6192u,33592u},{6193u,6193u,33993u},{6194u,6194u,36362u},{6195u,6195u,37780u},
+{6196u,6196u,37854u},{6197u,6197u,20110u},{6198u,6198u,20305u},{6199u,6199u,20598u},
+{6200u,6200u,20778u},{6201u,6201u,21448u},{6202u,6202u,21451u},{6203u,6203u,21491u},
+{6204u,6204u,23431u},{6205u,6205u,23507u},{6206u,6206u,23588u},{6207u,6207u,24858u},
+{6208u,6208u,24962u},{6209u,6209u,26100u},{6210u,6210u,29275u},{6211u,6211u,29591u},
+{6212u,6212u,29760u},{6213u,6213u,30402u},{6214u,6214u,31056u},{6215u,6215u,31121u},
+{6216u,6216u,31161u},{6217u,6217u,32006u},{6218u,6218u,32701u},{6219u,6219u,33419u},
+{6220u,6220u,34261u},{6221u,6221u,34398u},{6222u,6222u,36802u},{6223u,6223u,36935u},
+{6224u,6224u,37109u},{6225u,6225u,37354u},{6226u,6226u,38533u},{6227u,6228u,38632u},
+{6229u,6229u,21206u},{6230u,6230u,24423u},{6231u,6231u,26093u},{6232u,6232u,26161u},
+{6233u,6233u,26671u},{6234u,6234u,29020u},{6235u,6235u,31286u},{6236u,6236u,37057u},
+{6237u,6237u,38922u},{6238u,6238u,20113u},{6239u,6239u,27218u},{6240u,6240u,27550u},
+{6241u,6241u,28560u},{6242u,6242u,29065u},{6243u,6243u,32792u},{6244u,6244u,33464u},
+{6245u,6245u,34131u},{6246u,6246u,36939u},{6247u,6247u,38549u},{6248u,6248u,38642u},
+{6249u,6249u,38907u},{6250u,6250u,34074u},{6251u,6251u,39729u},{6252u,6252u,20112u},
+{6253u,6253u,29066u},{6254u,6254u,38596u},{6255u,6255u,20803u},{6256u,6256u,21407u},
+{6257u,6257u,21729u},{6258u,6258u,22291u},{6259u,6259u,22290u},{6260u,6260u,22435u},
+{6261u,6261u,23195u},{6262u,6262u,23236u},{6263u,6263u,23491u},{6264u,6264u,24616u},
+{6265u,6265u,24895u},{6266u,6266u,25588u},{6267u,6267u,27781u},{6268u,6268u,27961u},
+{6269u,6269u,28274u},{6270u,6270u,28304u},{6271u,6271u,29232u},{6272u,6272u,29503u},
+{6273u,6273u,29783u},{6274u,6274u,33489u},{6275u,6275u,34945u},{6276u,6276u,36677u},
+{6277u,6277u,36960u},{6278u,6278u,38498u},{6279u,6279u,39000u},{6280u,6280u,40219u},
+{6281u,6281u,26376u},{6282u,6282u,36234u},{6283u,6283u,37470u},{6284u,6284u,20301u},
+{6285u,6285u,20553u},{6286u,6286u,20702u},{6287u,6287u,21361u},{6288u,6288u,22285u},
+{6289u,6289u,22996u},{6290u,6290u,23041u},{6291u,6291u,23561u},{6292u,6292u,24944u},
+{6293u,6293u,26256u},{6294u,6294u,28205u},{6295u,6295u,29234u},{6296u,6296u,29771u},
+{6297u,6297u,32239u},{6298u,6298u,32963u},{6299u,6299u,33806u},{6300u,6300u,33894u},
+{6301u,6301u,34111u},{6302u,6302u,34655u},{6303u,6303u,34907u},{6304u,6304u,35096u},
+{6305u,6305u,35586u},{6306u,6306u,36949u},{6307u,6307u,38859u},{6308u,6308u,39759u},
+{6309u,6309u,20083u},{6310u,6310u,20369u},{6311u,6311u,20754u},{6312u,6312u,20842u},
+{6313u,6313u,21807u},{6314u,6314u,21929u},{6315u,6315u,23418u},{6316u,6316u,23461u},
+{6317u,6318u,24188u},{6319u,6319u,24254u},{6320u,6320u,24736u},{6321u,6321u,24799u},
+{6322u,6323u,24840u},{6324u,6324u,25540u},{6325u,6325u,25912u},{6326u,6326u,26377u},
+{6327u,6327u,26580u},{6328u,6328u,26586u},{6329u,6330u,26977u},{6331u,6331u,27833u},
+{6332u,6332u,27943u},{6333u,6333u,28216u},{6334u,6334u,28641u},{6335u,6336u,29494u},
+{6337u,6337u,29788u},{6338u,6338u,30001u},{6339u,6339u,30290u},{6340u,6340u,32173u},
+{6341u,6341u,33278u},{6342u,6342u,33848u},{6343u,6343u,35029u},{6344u,6344u,35480u},
+{6345u,6345u,35547u},{6346u,6346u,35565u},{6347u,6347u,36400u},{6348u,6348u,36418u},
+{6349u,6349u,36938u},{6350u,6350u,36926u},{6351u,6351u,36986u},{6352u,6352u,37193u},
+{6353u,6353u,37321u},{6354u,6354u,37742u},{6355u,6355u,22537u},{6356u,6356u,27603u},
+{6357u,6357u,32905u},{6358u,6358u,32946u},{6359u,6359u,20801u},{6360u,6360u,22891u},
+{6361u,6361u,23609u},{6362u,6362u,28516u},{6363u,6363u,29607u},{6364u,6364u,32996u},
+{6365u,6365u,36103u},{6366u,6366u,37399u},{6367u,6367u,38287u},{6368u,6368u,32895u},
+{6369u,6369u,25102u},{6370u,6370u,28700u},{6371u,6371u,32104u},{6372u,6372u,34701u},
+{6373u,6373u,22432u},{6374u,6374u,24681u},{6375u,6375u,24903u},{6376u,6376u,27575u},
+{6377u,6377u,35518u},{6378u,6378u,37504u},{6379u,6379u,38577u},{6380u,6380u,20057u},
+{6381u,6381u,21535u},{6382u,6382u,28139u},{6383u,6383u,34093u},{6384u,6384u,38512u},
+{6385u,6385u,38899u},{6386u,6386u,39150u},{6387u,6387u,25558u},{6388u,6388u,27875u},
+{6389u,6389u,37009u},{6390u,6390u,20957u},{6391u,6391u,25033u},{6392u,6392u,33210u},
+{6393u,6393u,40441u},{6394u,6394u,20381u},{6395u,6395u,20506u},{6396u,6396u,20736u},
+{6397u,6397u,23452u},{6398u,6398u,24847u},{6399u,6399u,25087u},{6400u,6400u,25836u},
+{6401u,6401u,26885u},{6402u,6402u,27589u},{6403u,6403u,30097u},{6404u,6404u,30691u},
+{6405u,6405u,32681u},{6406u,6406u,33380u},{6407u,6407u,34191u},{6408u,6408u,34811u},
+{6409u,6409u,34915u},{6410u,6410u,35516u},{6411u,6411u,35696u},{6412u,6412u,37291u},
+{6413u,6413u,20108u},{6414u,6414u,20197u},{6415u,6415u,20234u},{6416u,6416u,22839u},
+{6417u,6417u,23016u},{6418u,6418u,24050u},{6419u,6419u,24347u},{6420u,6420u,24411u},
+{6421u,6421u,24609u},{6422u,6422u,29246u},{6423u,6423u,29669u},{6424u,6424u,30064u},
+{6425u,6425u,30157u},{6426u,6426u,31227u},{6427u,6427u,32780u},{6428u,6428u,32819u},
+{6429u,6429u,32900u},{6430u,6430u,33505u},{6431u,6431u,33617u},{6432u,6432u,36029u},
+{6433u,6433u,36019u},{6434u,6434u,36999u},{6435u,6435u,39156u},{6436u,6436u,39180u},
+{6437u,6437u,28727u},{6438u,6438u,30410u},{6439u,6439u,32714u},{6440u,6440u,32716u},
+{6441u,6441u,32764u},{6442u,6442u,35610u},{6443u,6443u,20154u},{6444u,6444u,20161u},
+{6445u,6445u,20995u},{6446u,6446u,21360u},{6447u,6447u,21693u},{6448u,6448u,22240u},
+{6449u,6449u,23035u},{6450u,6450u,23493u},{6451u,6451u,24341u},{6452u,6452u,24525u},
+{6453u,6453u,28270u},{6454u,6454u,32106u},{6455u,6455u,33589u},{6456u,6456u,34451u},
+{6457u,6457u,35469u},{6458u,6458u,38765u},{6459u,6459u,38775u},{6460u,6460u,19968u},
+{6461u,6461u,20314u},{6462u,6462u,20350u},{6463u,6463u,22777u},{6464u,6464u,26085u},
+{6465u,6465u,28322u},{6466u,6466u,36920u},{6467u,6467u,37808u},{6468u,6468u,39353u},
+{6469u,6469u,20219u},{6470u,6470u,22764u},{6471u,6471u,22922u},{6472u,6472u,23001u},
+{6473u,6473u,24641u},{6474u,6474u,31252u},{6475u,6475u,33615u},{6476u,6476u,36035u},
+{6477u,6477u,20837u},{6478u,6478u,21316u},{6479u,6479u,20173u},{6480u,6480u,21097u},
+{6481u,6481u,23381u},{6482u,6482u,33471u},{6483u,6483u,20180u},{6484u,6484u,21050u},
+{6485u,6485u,21672u},{6486u,6486u,22985u},{6487u,6487u,23039u},{6488u,6488u,23376u},
+{6489u,6489u,23383u},{6490u,6490u,23388u},{6491u,6491u,24675u},{6492u,6492u,24904u},
+{6493u,6493u,28363u},{6494u,6494u,28825u},{6495u,6495u,29038u},{6496u,6496u,29574u},
+{6497u,6497u,29943u},{6498u,6498u,30133u},{6499u,6499u,30913u},{6500u,6500u,32043u},
+{6501u,6501u,32773u},{6502u,6502u,33258u},{6503u,6503u,33576u},{6504u,6504u,34071u},
+{6505u,6505u,34249u},{6506u,6506u,35566u},{6507u,6507u,36039u},{6508u,6508u,38604u},
+{6509u,6509u,20316u},{6510u,6510u,21242u},{6511u,6511u,22204u},{6512u,6512u,26027u},
+{6513u,6513u,26152u},{6514u,6514u,28796u},{6515u,6515u,28856u},{6516u,6516u,29237u},
+{6517u,6517u,32189u},{6518u,6518u,33421u},{6519u,6519u,37196u},{6520u,6520u,38592u},
+{6521u,6521u,40306u},{6522u,6522u,23409u},{6523u,6523u,26855u},{6524u,6524u,27544u},
+{6525u,6525u,28538u},{6526u,6526u,30430u},{6527u,6527u,23697u},{6528u,6528u,26283u},
+{6529u,6529u,28507u},{6530u,6530u,31668u},{6531u,6531u,31786u},{6532u,6532u,34870u},
+{6533u,6533u,38620u},{6534u,6534u,19976u},{6535u,6535u,20183u},{6536u,6536u,21280u},
+{6537u,6537u,22580u},{6538u,6538u,22715u},{6539u,6539u,22767u},{6540u,6540u,22892u},
+{6541u,6541u,23559u},{6542u,6542u,24115u},{6543u,6543u,24196u},{6544u,6544u,24373u},
+{6545u,6545u,25484u},{6546u,6546u,26290u},{6547u,6547u,26454u},{6548u,6548u,27167u},
+{6549u,6549u,27299u},{6550u,6550u,27404u},{6551u,6551u,28479u},{6552u,6552u,29254u},
+{6553u,6553u,29520u},{6554u,6554u,29835u},{6555u,6555u,31456u},{6556u,6556u,31911u},
+{6557u,6557u,33144u},{6558u,6558u,33247u},{6559u,6559u,33255u},{6560u,6560u,33674u},
+{6561u,6561u,33900u},{6562u,6562u,34083u},{6563u,6563u,34196u},{6564u,6564u,34255u},
+{6565u,6565u,35037u},{6566u,6566u,36115u},{6567u,6567u,37292u},{6568u,6568u,38263u},
+{6569u,6569u,38556u},{6570u,6570u,20877u},{6571u,6571u,21705u},{6572u,6572u,22312u},
+{6573u,6573u,23472u},{6574u,6574u,25165u},{6575u,6575u,26448u},{6576u,6576u,26685u},
+{6577u,6577u,26771u},{6578u,6578u,28221u},{6579u,6579u,28371u},{6580u,6580u,28797u},
+{6581u,6581u,32289u},{6582u,6582u,35009u},{6583u,6583u,36001u},{6584u,6584u,36617u},
+{6585u,6585u,40779u},{6586u,6586u,40782u},{6587u,6587u,29229u},{6588u,6588u,31631u},
+{6589u,6589u,35533u},{6590u,6590u,37658u},{6591u,6591u,20295u},{6592u,6592u,20302u},
+{6593u,6593u,20786u},{6594u,6594u,21632u},{6595u,6595u,22992u},{6596u,6596u,24213u},
+{6597u,6597u,25269u},{6598u,6598u,26485u},{6599u,6599u,26990u},{6600u,6600u,27159u},
+{6601u,6601u,27822u},{6602u,6602u,28186u},{6603u,6603u,29401u},{6604u,6604u,29482u},
+{6605u,6605u,30141u},{6606u,6606u,31672u},{6607u,6607u,32053u},{6608u,6608u,33511u},
+{6609u,6609u,33785u},{6610u,6610u,33879u},{6611u,6611u,34295u},{6612u,6612u,35419u},
+{6613u,6613u,36015u},{6614u,6614u,36487u},{6615u,6615u,36889u},{6616u,6616u,37048u},
+{6617u,6617u,38606u},{6618u,6618u,40799u},{6619u,6619u,21219u},{6620u,6620u,21514u},
+{6621u,6621u,23265u},{6622u,6622u,23490u},{6623u,6623u,25688u},{6624u,6624u,25973u},
+{6625u,6625u,28404u},{6626u,6626u,29380u},{6627u,6627u,30340u},{6628u,6628u,31309u},
+{6629u,6629u,31515u},{6630u,6630u,31821u},{6631u,6631u,32318u},{6632u,6632u,32735u},
+{6633u,6633u,33659u},{6634u,6634u,35627u},{6635u,6635u,36042u},{6636u,6636u,36196u},
+{6637u,6637u,36321u},{6638u,6638u,36447u},{6639u,6639u,36842u},{6640u,6640u,36857u},
+{6641u,6641u,36969u},{6642u,6642u,37841u},{6643u,6643u,20291u},{6644u,6644u,20346u},
+{6645u,6645u,20659u},{6646u,6646u,20840u},{6647u,6647u,20856u},{6648u,6648u,21069u},
+{6649u,6649u,21098u},{6650u,6650u,22625u},{6651u,6651u,22652u},{6652u,6652u,22880u},
+{6653u,6653u,23560u},{6654u,6654u,23637u},{6655u,6655u,24283u},{6656u,6656u,24731u},
+{6657u,6657u,25136u},{6658u,6658u,26643u},{6659u,6659u,27583u},{6660u,6660u,27656u},
+{6661u,6661u,28593u},{6662u,6662u,29006u},{6663u,6663u,29728u},{6664u,6664u,30000u},
+{6665u,6665u,30008u},{6666u,6666u,30033u},{6667u,6667u,30322u},{6668u,6668u,31564u},
+{6669u,6669u,31627u},{6670u,6670u,31661u},{6671u,6671u,31686u},{6672u,6672u,32399u},
+{6673u,6673u,35438u},{6674u,6674u,36670u},{6675u,6675u,36681u},{6676u,6676u,37439u},
+{6677u,6677u,37523u},{6678u,6678u,37666u},{6679u,6679u,37931u},{6680u,6680u,38651u},
+{6681u,6681u,39002u},{6682u,6682u,39019u},{6683u,6683u,39198u},{6684u,6684u,20999u},
+{6685u,6685u,25130u},{6686u,6686u,25240u},{6687u,6687u,27993u},{6688u,6688u,30308u},
+{6689u,6689u,31434u},{6690u,6690u,31680u},{6691u,6691u,32118u},{6692u,6692u,21344u},
+{6693u,6693u,23742u},{6694u,6694u,24215u},{6695u,6695u,28472u},{6696u,6696u,28857u},
+{6697u,6697u,31896u},{6698u,6698u,38673u},{6699u,6699u,39822u},{6700u,6700u,40670u},
+{6701u,6701u,25509u},{6702u,6702u,25722u},{6703u,6703u,34678u},{6704u,6704u,19969u},
+{6705u,6705u,20117u},{6706u,6706u,20141u},{6707u,6707u,20572u},{6708u,6708u,20597u},
+{6709u,6709u,21576u},{6710u,6710u,22979u},{6711u,6711u,23450u},{6712u,6712u,24128u},
+{6713u,6713u,24237u},{6714u,6714u,24311u},{6715u,6715u,24449u},{6716u,6716u,24773u},
+{6717u,6717u,25402u},{6718u,6718u,25919u},{6719u,6719u,25972u},{6720u,6720u,26060u},
+{6721u,6721u,26230u},{6722u,6722u,26232u},{6723u,6723u,26622u},{6724u,6724u,26984u},
+{6725u,6725u,27273u},{6726u,6726u,27491u},{6727u,6727u,27712u},{6728u,6728u,28096u},
+{6729u,6729u,28136u},{6730u,6730u,28191u},{6731u,6731u,28254u},{6732u,6732u,28702u},
+{6733u,6733u,28833u},{6734u,6734u,29582u},{6735u,6735u,29693u},{6736u,6736u,30010u},
+{6737u,6737u,30555u},{6738u,6738u,30855u},{6739u,6739u,31118u},{6740u,6740u,31243u},
+{6741u,6741u,31357u},{6742u,6742u,31934u},{6743u,6743u,32142u},{6744u,6744u,33351u},
+{6745u,6745u,35330u},{6746u,6746u,35562u},{6747u,6747u,35998u},{6748u,6748u,37165u},
+{6749u,6749u,37194u},{6750u,6750u,37336u},{6751u,6751u,37478u},{6752u,6752u,37580u},
+{6753u,6753u,37664u},{6754u,6754u,38662u},{6755u,6755u,38742u},{6756u,6756u,38748u},
+{6757u,6757u,38914u},{6758u,6758u,40718u},{6759u,6759u,21046u},{6760u,6760u,21137u},
+{6761u,6761u,21884u},{6762u,6762u,22564u},{6763u,6763u,24093u},{6764u,6764u,24351u},
+{6765u,6765u,24716u},{6766u,6766u,25552u},{6767u,6767u,26799u},{6768u,6768u,28639u},
+{6769u,6769u,31085u},{6770u,6770u,31532u},{6771u,6771u,33229u},{6772u,6772u,34234u},
+{6773u,6773u,35069u},{6774u,6774u,35576u},{6775u,6775u,36420u},{6776u,6776u,37261u},
+{6777u,6777u,38500u},{6778u,6778u,38555u},{6779u,6779u,38717u},{6780u,6780u,38988u},
+{6781u,6781u,40778u},{6782u,6782u,20430u},{6783u,6783u,20806u},{6784u,6784u,20939u},
+{6785u,6785u,21161u},{6786u,6786u,22066u},{6787u,6787u,24340u},{6788u,6788u,24427u},
+{6789u,6789u,25514u},{6790u,6790u,25805u},{6791u,6791u,26089u},{6792u,6792u,26177u},
+{6793u,6793u,26362u},{6794u,6794u,26361u},{6795u,6795u,26397u},{6796u,6796u,26781u},
+{6797u,6797u,26839u},{6798u,6798u,27133u},{6799u,6799u,28437u},{6800u,6800u,28526u},
+{6801u,6801u,29031u},{6802u,6802u,29157u},{6803u,6803u,29226u},{6804u,6804u,29866u},
+{6805u,6805u,30522u},{6806u,6806u,31062u},{6807u,6807u,31066u},{6808u,6808u,31199u},
+{6809u,6809u,31264u},{6810u,6810u,31381u},{6811u,6811u,31895u},{6812u,6812u,31967u},
+{6813u,6813u,32068u},{6814u,6814u,32368u},{6815u,6815u,32903u},{6816u,6816u,34299u},
+{6817u,6817u,34468u},{6818u,6818u,35412u},{6819u,6819u,35519u},{6820u,6820u,36249u},
+{6821u,6821u,36481u},{6822u,6822u,36896u},{6823u,6823u,36973u},{6824u,6824u,37347u},
+{6825u,6825u,38459u},{6826u,6826u,38613u},{6827u,6827u,40165u},{6828u,6828u,26063u},
+{6829u,6829u,31751u},{6830u,6830u,36275u},{6831u,6831u,37827u},{6832u,6832u,23384u},
+{6833u,6833u,23562u},{6834u,6834u,21330u},{6835u,6835u,25305u},{6836u,6836u,29469u},
+{6837u,6837u,20519u},{6838u,6838u,23447u},{6839u,6839u,24478u},{6840u,6840u,24752u},
+{6841u,6841u,24939u},{6842u,6842u,26837u},{6843u,6843u,28121u},{6844u,6844u,29742u},
+{6845u,6845u,31278u},{6846u,6846u,32066u},{6847u,6847u,32156u},{6848u,6848u,32305u},
+{6849u,6849u,33131u},{6850u,6850u,36394u},{6851u,6851u,36405u},{6852u,6852u,37758u},
+{6853u,6853u,37912u},{6854u,6854u,20304u},{6855u,6855u,22352u},{6856u,6856u,24038u},
+{6857u,6857u,24231u},{6858u,6858u,25387u},{6859u,6859u,32618u},{6860u,6860u,20027u},
+{6861u,6861u,20303u},{6862u,6862u,20367u},{6863u,6863u,20570u},{6864u,6864u,23005u},
+{6865u,6865u,32964u},{6866u,6866u,21610u},{6867u,6867u,21608u},{6868u,6868u,22014u},
+{6869u,6869u,22863u},{6870u,6870u,23449u},{6871u,6871u,24030u},{6872u,6872u,24282u},
+{6873u,6873u,26205u},{6874u,6874u,26417u},{6875u,6875u,26609u},{6876u,6876u,26666u},
+{6877u,6877u,27880u},{6878u,6878u,27954u},{6879u,6879u,28234u},{6880u,6880u,28557u},
+{6881u,6881u,28855u},{6882u,6882u,29664u},{6883u,6883u,30087u},{6884u,6884u,31820u},
+{6885u,6885u,32002u},{6886u,6886u,32044u},{6887u,6887u,32162u},{6888u,6888u,33311u},
+{6889u,6889u,34523u},{6890u,6890u,35387u},{6891u,6891u,35461u},{6892u,6892u,36208u},
+{6893u,6893u,36490u},{6894u,6894u,36659u},{6895u,6895u,36913u},{6896u,6896u,37198u},
+{6897u,6897u,37202u},{6898u,6898u,37956u},{6899u,6899u,39376u},{6900u,6900u,31481u},
+{6901u,6901u,31909u},{6902u,6902u,20426u},{6903u,6903u,20737u},{6904u,6904u,20934u},
+{6905u,6905u,22472u},{6906u,6906u,23535u},{6907u,6907u,23803u},{6908u,6908u,26201u},
+{6909u,6909u,27197u},{6910u,6910u,27994u},{6911u,6911u,28310u},{6912u,6912u,28652u},
+{6913u,6913u,28940u},{6914u,6914u,30063u},{6915u,6915u,31459u},{6916u,6916u,34850u},
+{6917u,6917u,36897u},{6918u,6918u,36981u},{6919u,6919u,38603u},{6920u,6920u,39423u},
+{6921u,6921u,33537u},{6922u,6922u,20013u},{6923u,6923u,20210u},{6924u,6924u,34886u},
+{6925u,6925u,37325u},{6926u,6926u,21373u},{6927u,6927u,27355u},{6928u,6928u,26987u},
+{6929u,6929u,27713u},{6930u,6930u,33914u},{6931u,6931u,22686u},{6932u,6932u,24974u},
+{6933u,6933u,26366u},{6934u,6934u,25327u},{6935u,6935u,28893u},{6936u,6936u,29969u},
+{6937u,6937u,30151u},{6938u,6938u,32338u},{6939u,6939u,33976u},{6940u,6940u,35657u},
+{6941u,6941u,36104u},{6942u,6942u,20043u},{6943u,6943u,21482u},{6944u,6944u,21675u},
+{6945u,6945u,22320u},{6946u,6946u,22336u},{6947u,6947u,24535u},{6948u,6948u,25345u},
+{6949u,6949u,25351u},{6950u,6950u,25711u},{6951u,6951u,25903u},{6952u,6952u,26088u},
+{6953u,6953u,26234u},{6954u,6954u,26525u},{6955u,6955u,26547u},{6956u,6956u,27490u},
+{6957u,6957u,27744u},{6958u,6958u,27802u},{6959u,6959u,28460u},{6960u,6960u,30693u},
+{6961u,6961u,30757u},{6962u,6962u,31049u},{6963u,6963u,31063u},{6964u,6964u,32025u},
+{6965u,6965u,32930u},{6966u,6966u,33026u},{6967u,6967u,33267u},{6968u,6968u,33437u},
+{6969u,6969u,33463u},{6970u,6970u,34584u},{6971u,6971u,35468u},{6972u,6972u,36100u},
+{6973u,6973u,36286u},{6974u,6974u,36978u},{6975u,6975u,30452u},{6976u,6976u,31257u},
+{6977u,6977u,31287u},{6978u,6978u,32340u},{6979u,6979u,32887u},{6980u,6980u,21767u},
+{6981u,6981u,21972u},{6982u,6982u,22645u},{6983u,6983u,25391u},{6984u,6984u,25634u},
+{6985u,6985u,26185u},{6986u,6986u,26187u},{6987u,6987u,26733u},{6988u,6988u,27035u},
+{6989u,6989u,27524u},{6990u,6990u,27941u},{6991u,6991u,28337u},{6992u,6992u,29645u},
+{6993u,6993u,29800u},{6994u,6994u,29857u},{6995u,6995u,30043u},{6996u,6996u,30137u},
+{6997u,6997u,30433u},{6998u,6998u,30494u},{6999u,6999u,30603u},{7000u,7000u,31206u},
+{7001u,7001u,32265u},{7002u,7002u,32285u},{7003u,7003u,33275u},{7004u,7004u,34095u},
+{7005u,7005u,34967u},{7006u,7006u,35386u},{7007u,7007u,36049u},{7008u,7008u,36587u},
+{7009u,7009u,36784u},{7010u,7010u,36914u},{7011u,7011u,37805u},{7012u,7012u,38499u},
+{7013u,7013u,38515u},{7014u,7014u,38663u},{7015u,7015u,20356u},{7016u,7016u,21489u},
+{7017u,7017u,23018u},{7018u,7018u,23241u},{7019u,7019u,24089u},{7020u,7020u,26702u},
+{7021u,7021u,29894u},{7022u,7022u,30142u},{7023u,7023u,31209u},{7024u,7024u,31378u},
+{7025u,7025u,33187u},{7026u,7026u,34541u},{7027u,7027u,36074u},{7028u,7028u,36300u},
+{7029u,7029u,36845u},{7030u,7030u,26015u},{7031u,7031u,26389u},{7032u,7032u,22519u},
+{7033u,7033u,28503u},{7034u,7034u,32221u},{7035u,7035u,36655u},{7036u,7036u,37878u},
+{7037u,7037u,38598u},{7038u,7038u,24501u},{7039u,7039u,25074u},{7040u,7040u,28548u},
+{7041u,7041u,19988u},{7042u,7042u,20376u},{7043u,7043u,20511u},{7044u,7044u,21449u},
+{7045u,7045u,21983u},{7046u,7046u,23919u},{7047u,7047u,24046u},{7048u,7048u,27425u},
+{7049u,7049u,27492u},{7050u,7050u,30923u},{7051u,7051u,31642u},{7052u,7052u,36425u},
+{7053u,7053u,36554u},{7054u,7054u,36974u},{7055u,7055u,25417u},{7056u,7056u,25662u},
+{7057u,7057u,30528u},{7058u,7058u,31364u},{7059u,7059u,37679u},{7060u,7060u,38015u},
+{7061u,7061u,40810u},{7062u,7062u,25776u},{7063u,7063u,28591u},{7064u,7064u,29158u},
+{7065u,7065u,29864u},{7066u,7066u,29914u},{7067u,7067u,31428u},{7068u,7068u,31762u},
+{7069u,7069u,32386u},{7070u,7070u,31922u},{7071u,7071u,32408u},{7072u,7072u,35738u},
+{7073u,7073u,36106u},{7074u,7074u,38013u},{7075u,7075u,39184u},{7076u,7076u,39244u},
+{7077u,7077u,21049u},{7078u,7078u,23519u},{7079u,7079u,25830u},{7080u,7080u,26413u},
+{7081u,7081u,32046u},{7082u,7082u,20717u},{7083u,7083u,21443u},{7084u,7084u,22649u},
+{7085u,7086u,24920u},{7087u,7087u,25082u},{7088u,7088u,26028u},{7089u,7089u,31449u},
+{7090u,7090u,35730u},{7091u,7091u,35734u},{7092u,7092u,20489u},{7093u,7093u,20513u},
+{7094u,7094u,21109u},{7095u,7095u,21809u},{7096u,7096u,23100u},{7097u,7097u,24288u},
+{7098u,7098u,24432u},{7099u,7099u,24884u},{7100u,7100u,25950u},{7101u,7101u,26124u},
+{7102u,7102u,26166u},{7103u,7103u,26274u},{7104u,7104u,27085u},{7105u,7105u,28356u},
+{7106u,7106u,28466u},{7107u,7107u,29462u},{7108u,7108u,30241u},{7109u,7109u,31379u},
+{7110u,7110u,33081u},{7111u,7111u,33369u},{7112u,7112u,33750u},{7113u,7113u,33980u},
+{7114u,7114u,20661u},{7115u,7115u,22512u},{7116u,7116u,23488u},{7117u,7117u,23528u},
+{7118u,7118u,24425u},{7119u,7119u,25505u},{7120u,7120u,30758u},{7121u,7121u,32181u},
+{7122u,7122u,33756u},{7123u,7123u,34081u},{7124u,7124u,37319u},{7125u,7125u,37365u},
+{7126u,7126u,20874u},{7127u,7127u,26613u},{7128u,7128u,31574u},{7129u,7129u,36012u},
+{7130u,7130u,20932u},{7131u,7131u,22971u},{7132u,7132u,24765u},{7133u,7133u,34389u},
+{7134u,7134u,20508u},{7135u,7135u,21076u},{7136u,7136u,23610u},{7137u,7137u,24957u},
+{7138u,7138u,25114u},{7139u,7139u,25299u},{7140u,7140u,25842u},{7141u,7141u,26021u},
+{7142u,7142u,28364u},{7143u,7143u,30240u},{7144u,7144u,33034u},{7145u,7145u,36448u},
+{7146u,7146u,38495u},{7147u,7147u,38587u},{7148u,7148u,20191u},{7149u,7149u,21315u},
+{7150u,7150u,21912u},{7151u,7151u,22825u},{7152u,7152u,24029u},{7153u,7153u,25797u},
+{7154u,7154u,27849u},{7155u,7155u,28154u},{7156u,7156u,29588u},{7157u,7157u,31359u},
+{7158u,7158u,33307u},{7159u,7159u,34214u},{7160u,7160u,36068u},{7161u,7161u,36368u},
+{7162u,7162u,36983u},{7163u,7163u,37351u},{7164u,7164u,38369u},{7165u,7165u,38433u},
+{7166u,7166u,38854u},{7167u,7167u,20984u},{7168u,7168u,21746u},{7169u,7169u,21894u},
+{7170u,7170u,24505u},{7171u,7171u,25764u},{7172u,7172u,28552u},{7173u,7173u,32180u},
+{7174u,7174u,36639u},{7175u,7175u,36685u},{7176u,7176u,37941u},{7177u,7177u,20681u},
+{7178u,7178u,23574u},{7179u,7179u,27838u},{7180u,7180u,28155u},{7181u,7181u,29979u},
+{7182u,7182u,30651u},{7183u,7183u,31805u},{7184u,7184u,31844u},{7185u,7185u,35449u},
+{7186u,7186u,35522u},{7187u,7187u,22558u},{7188u,7188u,22974u},{7189u,7189u,24086u},
+{7190u,7190u,25463u},{7191u,7191u,29266u},{7192u,7192u,30090u},{7193u,7193u,30571u},
+{7194u,7194u,35548u},{7195u,7195u,36028u},{7196u,7196u,36626u},{7197u,7197u,24307u},
+{7198u,7198u,26228u},{7199u,7199u,28152u},{7200u,7200u,32893u},{7201u,7201u,33729u},
+{7202u,7202u,35531u},{7203u,7203u,38737u},{7204u,7204u,39894u},{7205u,7205u,21059u},
+{7206u,7206u,26367u},{7207u,7207u,28053u},{7208u,7208u,28399u},{7209u,7209u,32224u},
+{7210u,7210u,35558u},{7211u,7211u,36910u},{7212u,7212u,36958u},{7213u,7213u,39636u},
+{7214u,7214u,21021u},{7215u,7215u,21119u},{7216u,7216u,21736u},{7217u,7217u,24980u},
+{7218u,7218u,25220u},{7219u,7219u,25307u},{7220u,7220u,26786u},{7221u,7221u,26898u},
+{7222u,7222u,26970u},{7223u,7223u,27189u},{7224u,7224u,28818u},{7225u,7225u,28966u},
+{7226u,7226u,30813u},{7227u,7227u,30977u},{7228u,7228u,30990u},{7229u,7229u,31186u},
+{7230u,7230u,31245u},{7231u,7231u,32918u},{7232u,7232u,33400u},{7233u,7233u,33493u},
+{7234u,7234u,33609u},{7235u,7235u,34121u},{7236u,7236u,35970u},{7237u,7237u,36229u},
+{7238u,7238u,37218u},{7239u,7239u,37259u},{7240u,7240u,37294u},{7241u,7241u,20419u},
+{7242u,7242u,22225u},{7243u,7243u,29165u},{7244u,7244u,30679u},{7245u,7245u,34560u},
+{7246u,7246u,35320u},{7247u,7247u,23544u},{7248u,7248u,24534u},{7249u,7249u,26449u},
+{7250u,7250u,37032u},{7251u,7251u,21474u},{7252u,7252u,22618u},{7253u,7253u,23541u},
+{7254u,7254u,24740u},{7255u,7255u,24961u},{7256u,7256u,25696u},{7257u,7257u,32317u},
+{7258u,7258u,32880u},{7259u,7259u,34085u},{7260u,7260u,37507u},{7261u,7261u,25774u},
+{7262u,7262u,20652u},{7263u,7263u,23828u},{7264u,7264u,26368u},{7265u,7265u,22684u},
+{7266u,7266u,25277u},{7267u,7267u,25512u},{7268u,7268u,26894u},{7269u,7269u,27000u},
+{7270u,7270u,27166u},{7271u,7271u,28267u},{7272u,7272u,30394u},{7273u,7273u,31179u},
+{7274u,7274u,33467u},{7275u,7275u,33833u},{7276u,7276u,35535u},{7277u,7277u,36264u},
+{7278u,7278u,36861u},{7279u,7279u,37138u},{7280u,7280u,37195u},{7281u,7281u,37276u},
+{7282u,7282u,37648u},{7283u,7283u,37656u},{7284u,7284u,37786u},{7285u,7285u,38619u},
+{7286u,7286u,39478u},{7287u,7287u,39949u},{7288u,7288u,19985u},{7289u,7289u,30044u},
+{7290u,7290u,31069u},{7291u,7291u,31482u},{7292u,7292u,31569u},{7293u,7293u,31689u},
+{7294u,7294u,32302u},{7295u,7295u,33988u},{7296u,7296u,36441u},{7297u,7297u,36468u},
+{7298u,7298u,36600u},{7299u,7299u,36880u},{7300u,7300u,26149u},{7301u,7301u,26943u},
+{7302u,7302u,29763u},{7303u,7303u,20986u},{7304u,7304u,26414u},{7305u,7305u,40668u},
+{7306u,7306u,20805u},{7307u,7307u,24544u},{7308u,7308u,27798u},{7309u,7309u,34802u},
+{7310u,7310u,34909u},{7311u,7311u,34935u},{7312u,7312u,24756u},{7313u,7313u,33205u},
+{7314u,7314u,33795u},{7315u,7315u,36101u},{7316u,7316u,21462u},{7317u,7317u,21561u},
+{7318u,7318u,22068u},{7319u,7319u,23094u},{7320u,7320u,23601u},{7321u,7321u,28810u},
+{7322u,7322u,32736u},{7323u,7323u,32858u},{7324u,7324u,33030u},{7325u,7325u,33261u},
+{7326u,7326u,36259u},{7327u,7327u,37257u},{7328u,7328u,39519u},{7329u,7329u,40434u},
+{7330u,7330u,20596u},{7331u,7331u,20164u},{7332u,7332u,21408u},{7333u,7333u,24827u},
+{7334u,7334u,28204u},{7335u,7335u,23652u},{7336u,7336u,20360u},{7337u,7337u,20516u},
+{7338u,7338u,21988u},{7339u,7339u,23769u},{7340u,7340u,24159u},{7341u,7341u,24677u},
+{7342u,7342u,26772u},{7343u,7343u,27835u},{7344u,7344u,28100u},{7345u,7345u,29118u},
+{7346u,7346u,30164u},{7347u,7347u,30196u},{7348u,7348u,30305u},{7349u,7349u,31258u},
+{7350u,7350u,31305u},{7351u,7351u,32199u},{7352u,7352u,32251u},{7353u,7353u,32622u},
+{7354u,7354u,33268u},{7355u,7355u,34473u},{7356u,7356u,36636u},{7357u,7357u,38601u},
+{7358u,7358u,39347u},{7359u,7359u,40786u},{7360u,7360u,21063u},{7361u,7361u,21189u},
+{7362u,7362u,39149u},{7363u,7363u,35242u},{7364u,7364u,19971u},{7365u,7365u,26578u},
+{7366u,7366u,28422u},{7367u,7367u,20405u},{7368u,7368u,23522u},{7369u,7369u,26517u},
+{7370u,7370u,27784u},{7371u,7371u,28024u},{7372u,7372u,29723u},{7373u,7373u,30759u},
+{7374u,7374u,37341u},{7375u,7375u,37756u},{7376u,7376u,34756u},{7377u,7377u,31204u},
+{7378u,7378u,31281u},{7379u,7379u,24555u},{7380u,7380u,20182u},{7381u,7381u,21668u},
+{7382u,7382u,21822u},{7383u,7383u,22702u},{7384u,7384u,22949u},{7385u,7385u,24816u},
+{7386u,7386u,25171u},{7387u,7387u,25302u},{7388u,7388u,26422u},{7389u,7389u,26965u},
+{7390u,7390u,33333u},{7391u,7391u,38464u},{7392u,7392u,39345u},{7393u,7393u,39389u},
+{7394u,7394u,20524u},{7395u,7395u,21331u},{7396u,7396u,21828u},{7397u,7397u,22396u},
+{7398u,7398u,25176u},{7399u,7399u,25826u},{7400u,7400u,26219u},{7401u,7401u,26589u},
+{7402u,7402u,28609u},{7403u,7403u,28655u},{7404u,7404u,29730u},{7405u,7405u,29752u},
+{7406u,7406u,35351u},{7407u,7407u,37944u},{7408u,7408u,21585u},{7409u,7409u,22022u},
+{7410u,7410u,22374u},{7411u,7411u,24392u},{7412u,7412u,24986u},{7413u,7413u,27470u},
+{7414u,7414u,28760u},{7415u,7415u,28845u},{7416u,7416u,32187u},{7417u,7417u,35477u},
+{7418u,7418u,22890u},{7419u,7419u,33067u},{7420u,7420u,25506u},{7421u,7421u,30472u},
+{7422u,7422u,32829u},{7423u,7423u,36010u},{7424u,7424u,22612u},{7425u,7425u,25645u},
+{7426u,7426u,27067u},{7427u,7427u,23445u},{7428u,7428u,24081u},{7429u,7429u,28271u},
+{7430u,7430u,34153u},{7431u,7431u,20812u},{7432u,7432u,21488u},{7433u,7433u,22826u},
+{7434u,7434u,24608u},{7435u,7435u,24907u},{7436u,7436u,27526u},{7437u,7437u,27760u},
+{7438u,7438u,27888u},{7439u,7439u,31518u},{7440u,7440u,32974u},{7441u,7441u,33492u},
+{7442u,7442u,36294u},{7443u,7443u,37040u},{7444u,7444u,39089u},{7445u,7445u,25799u},
+{7446u,7446u,28580u},{7447u,7447u,25745u},{7448u,7448u,25860u},{7449u,7449u,20814u},
+{7450u,7450u,21520u},{7451u,7451u,22303u},{7452u,7452u,35342u},{7453u,7453u,24927u},
+{7454u,7454u,26742u},{7455u,7455u,30171u},{7456u,7456u,31570u},{7457u,7457u,32113u},
+{7458u,7458u,36890u},{7459u,7459u,22534u},{7460u,7460u,27084u},{7461u,7461u,33151u},
+{7462u,7462u,35114u},{7463u,7463u,36864u},{7464u,7464u,38969u},{7465u,7465u,20600u},
+{7466u,7466u,22871u},{7467u,7467u,22956u},{7468u,7468u,25237u},{7469u,7469u,36879u},
+{7470u,7470u,39722u},{7471u,7471u,24925u},{7472u,7472u,29305u},{7473u,7473u,38358u},
+{7474u,7474u,22369u},{7475u,7475u,23110u},{7476u,7476u,24052u},{7477u,7477u,25226u},
+{7478u,7478u,25773u},{7479u,7479u,25850u},{7480u,7480u,26487u},{7481u,7481u,27874u},
+{7482u,7482u,27966u},{7483u,7483u,29228u},{7484u,7484u,29750u},{7485u,7485u,30772u},
+{7486u,7486u,32631u},{7487u,7487u,33453u},{7488u,7488u,36315u},{7489u,7489u,38935u},
+{7490u,7490u,21028u},{7491u,7491u,22338u},{7492u,7492u,26495u},{7493u,7493u,29256u},
+{7494u,7494u,29923u},{7495u,7495u,36009u},{7496u,7496u,36774u},{7497u,7497u,37393u},
+{7498u,7498u,38442u},{7499u,7499u,20843u},{7500u,7500u,21485u},{7501u,7501u,25420u},
+{7502u,7502u,20329u},{7503u,7503u,21764u},{7504u,7504u,24726u},{7505u,7505u,25943u},
+{7506u,7506u,27803u},{7507u,7507u,28031u},{7508u,7508u,29260u},{7509u,7509u,29437u},
+{7510u,7510u,31255u},{7511u,7511u,35207u},{7512u,7512u,35997u},{7513u,7513u,24429u},
+{7514u,7514u,28558u},{7515u,7515u,28921u},{7516u,7516u,33192u},{7517u,7517u,24846u},
+{7518u,7518u,20415u},{7519u,7519u,20559u},{7520u,7520u,25153u},{7521u,7521u,29255u},
+{7522u,7522u,31687u},{7523u,7523u,32232u},{7524u,7524u,32745u},{7525u,7525u,36941u},
+{7526u,7526u,38829u},{7527u,7527u,39449u},{7528u,7528u,36022u},{7529u,7529u,22378u},
+{7530u,7530u,24179u},{7531u,7531u,26544u},{7532u,7532u,33805u},{7533u,7533u,35413u},
+{7534u,7534u,21536u},{7535u,7535u,23318u},{7536u,7536u,24163u},{7537u,7537u,24290u},
+{7538u,7538u,24330u},{7539u,7539u,25987u},{7540u,7540u,32954u},{7541u,7541u,34109u},
+{7542u,7542u,38281u},{7543u,7543u,38491u},{7544u,7544u,20296u},{7545u,7545u,21253u},
+{7546u,7546u,21261u},{7547u,7547u,21263u},{7548u,7548u,21638u},{7549u,7549u,21754u},
+{7550u,7550u,22275u},{7551u,7551u,24067u},{7552u,7552u,24598u},{7553u,7553u,25243u},
+{7554u,7554u,25265u},{7555u,7555u,25429u},{7556u,7556u,27873u},{7557u,7557u,28006u},
+{7558u,7558u,30129u},{7559u,7559u,30770u},{7560u,7560u,32990u},{7561u,7561u,33071u},
+{7562u,7562u,33502u},{7563u,7563u,33889u},{7564u,7564u,33970u},{7565u,7565u,34957u},
+{7566u,7566u,35090u},{7567u,7567u,36875u},{7568u,7568u,37610u},{7569u,7569u,39165u},
+{7570u,7570u,39825u},{7571u,7571u,24133u},{7572u,7572u,26292u},{7573u,7573u,26333u},
+{7574u,7574u,28689u},{7575u,7575u,29190u},{7576u,7576u,20469u},{7577u,7577u,21117u},
+{7578u,7578u,24426u},{7579u,7579u,24915u},{7580u,7580u,26451u},{7581u,7581u,27161u},
+{7582u,7582u,28418u},{7583u,7583u,29922u},{7584u,7584u,31080u},{7585u,7585u,34920u},
+{7586u,7586u,35961u},{7587u,7587u,39111u},{7588u,7588u,39108u},{7589u,7589u,39491u},
+{7590u,7590u,21697u},{7591u,7591u,31263u},{7592u,7592u,26963u},{7593u,7593u,35575u},
+{7594u,7594u,35914u},{7595u,7595u,39080u},{7596u,7596u,39342u},{7597u,7597u,24444u},
+{7598u,7598u,25259u},{7599u,7599u,30130u},{7600u,7600u,30382u},{7601u,7601u,34987u},
+{7602u,7602u,36991u},{7603u,7603u,38466u},{7604u,7604u,21305u},{7605u,7605u,24380u},
+{7606u,7606u,24517u},{7607u,7607u,27852u},{7608u,7608u,29644u},{7609u,7609u,30050u},
+{7610u,7610u,30091u},{7611u,7611u,31558u},{7612u,7612u,33534u},{7613u,7613u,39325u},
+{7614u,7614u,20047u},{7615u,7615u,36924u},{7616u,7616u,19979u},{7617u,7617u,20309u},
+{7618u,7618u,21414u},{7619u,7619u,22799u},{7620u,7620u,24264u},{7621u,7621u,26160u},
+{7622u,7622u,27827u},{7623u,7623u,29781u},{7624u,7624u,33655u},{7625u,7625u,34662u},
+{7626u,7626u,36032u},{7627u,7627u,36944u},{7628u,7628u,38686u},{7629u,7629u,39957u},
+{7630u,7630u,22737u},{7631u,7631u,23416u},{7632u,7632u,34384u},{7633u,7633u,35604u},
+{7634u,7634u,40372u},{7635u,7635u,23506u},{7636u,7636u,24680u},{7637u,7637u,24717u},
+{7638u,7638u,26097u},{7639u,7639u,27735u},{7640u,7640u,28450u},{7641u,7641u,28579u},
+{7642u,7642u,28698u},{7643u,7643u,32597u},{7644u,7644u,32752u},{7645u,7646u,38289u},
+{7647u,7647u,38480u},{7648u,7648u,38867u},{7649u,7649u,21106u},{7650u,7650u,36676u},
+{7651u,7651u,20989u},{7652u,7652u,21547u},{7653u,7653u,21688u},{7654u,7654u,21859u},
+{7655u,7655u,21898u},{7656u,7656u,27323u},{7657u,7657u,28085u},{7658u,7658u,32216u},
+{7659u,7659u,33382u},{7660u,7660u,37532u},{7661u,7661u,38519u},{7662u,7662u,40569u},
+{7663u,7663u,21512u},{7664u,7664u,21704u},{7665u,7665u,30418u},{7666u,7666u,34532u},
+{7667u,7667u,38308u},{7668u,7668u,38356u},{7669u,7669u,38492u},{7670u,7670u,20130u},
+{7671u,7671u,20233u},{7672u,7672u,23022u},{7673u,7673u,23270u},{7674u,7674u,24055u},
+{7675u,7675u,24658u},{7676u,7676u,25239u},{7677u,7677u,26477u},{7678u,7678u,26689u},
+{7679u,7679u,27782u},{7680u,7680u,28207u},{7681u,7681u,32568u},{7682u,7682u,32923u},
+{7683u,7683u,33322u},{7684u,7684u,38917u},{7685u,7685u,20133u},{7686u,7686u,20565u},
+{7687u,7687u,21683u},{7688u,7688u,22419u},{7689u,7689u,22874u},{7690u,7690u,23401u},
+{7691u,7691u,23475u},{7692u,7692u,25032u},{7693u,7693u,26999u},{7694u,7694u,28023u},
+{7695u,7695u,28707u},{7696u,7696u,34809u},{7697u,7697u,35299u},{7698u,7698u,35442u},
+{7699u,7699u,35559u},{7700u,7700u,36994u},{7701u,7701u,39405u},{7702u,7702u,39608u},
+{7703u,7703u,21182u},{7704u,7704u,26680u},{7705u,7705u,20502u},{7706u,7706u,24184u},
+{7707u,7707u,26447u},{7708u,7708u,33607u},{7709u,7709u,34892u},{7710u,7710u,20139u},
+{7711u,7711u,21521u},{7712u,7712u,22190u},{7713u,7713u,29670u},{7714u,7714u,37141u},
+{7715u,7715u,38911u},{7716u,7716u,39177u},{7717u,7717u,39255u},{7718u,7718u,39321u},
+{7719u,7719u,22099u},{7720u,7720u,22687u},{7721u,7721u,34395u},{7722u,7722u,35377u},
+{7723u,7723u,25010u},{7724u,7724u,27382u},{7725u,7725u,29563u},{7726u,7726u,36562u},
+{7727u,7727u,27463u},{7728u,7728u,38570u},{7729u,7729u,39511u},{7730u,7730u,22869u},
+{7731u,7731u,29184u},{7732u,7732u,36203u},{7733u,7733u,38761u},{7734u,7734u,20436u},
+{7735u,7735u,23796u},{7736u,7736u,24358u},{7737u,7737u,25080u},{7738u,7738u,26203u},
+{7739u,7739u,27883u},{7740u,7740u,28843u},{7741u,7741u,29572u},{7742u,7742u,29625u},
+{7743u,7743u,29694u},{7744u,7744u,30505u},{7745u,7745u,30541u},{7746u,7746u,32067u},
+{7747u,7747u,32098u},{7748u,7748u,32291u},{7749u,7749u,33335u},{7750u,7750u,34898u},
+{7751u,7751u,36066u},{7752u,7752u,37449u},{7753u,7753u,39023u},{7754u,7754u,23377u},
+{7755u,7755u,31348u},{7756u,7756u,34880u},{7757u,7757u,38913u},{7758u,7758u,23244u},
+{7759u,7759u,20448u},{7760u,7760u,21332u},{7761u,7761u,22846u},{7762u,7762u,23805u},
+{7763u,7763u,25406u},{7764u,7764u,28025u},{7765u,7765u,29433u},{7766u,7766u,33029u},
+{7767u,7767u,33031u},{7768u,7768u,33698u},{7769u,7769u,37583u},{7770u,7770u,38960u},
+{7771u,7771u,20136u},{7772u,7772u,20804u},{7773u,7773u,21009u},{7774u,7774u,22411u},
+{7775u,7775u,24418u},{7776u,7776u,27842u},{7777u,7777u,28366u},{7778u,7778u,28677u},
+{7779u,7779u,28752u},{7780u,7780u,28847u},{7781u,7781u,29074u},{7782u,7782u,29673u},
+{7783u,7783u,29801u},{7784u,7784u,33610u},{7785u,7785u,34722u},{7786u,7786u,34913u},
+{7787u,7787u,36872u},{7788u,7788u,37026u},{7789u,7789u,37795u},{7790u,7790u,39336u},
+{7791u,7791u,20846u},{7792u,7792u,24407u},{7793u,7793u,24800u},{7794u,7794u,24935u},
+{7795u,7795u,26291u},{7796u,7796u,34137u},{7797u,7797u,36426u},{7798u,7798u,37295u},
+{7799u,7799u,38795u},{7800u,7800u,20046u},{7801u,7801u,20114u},{7802u,7802u,21628u},
+{7803u,7803u,22741u},{7804u,7804u,22778u},{7805u,7805u,22909u},{7806u,7806u,23733u},
+{7807u,7807u,24359u},{7808u,7808u,25142u},{7809u,7809u,25160u},{7810u,7810u,26122u},
+{7811u,7811u,26215u},{7812u,7812u,27627u},{7813u,7813u,28009u},{7814u,7814u,28111u},
+{7815u,7815u,28246u},{7816u,7816u,28408u},{7817u,7817u,28564u},{7818u,7818u,28640u},
+{7819u,7819u,28649u},{7820u,7820u,28765u},{7821u,7821u,29392u},{7822u,7822u,29733u},
+{7823u,7823u,29786u},{7824u,7824u,29920u},{7825u,7825u,30355u},{7826u,7826u,31068u},
+{7827u,7827u,31946u},{7828u,7828u,32286u},{7829u,7829u,32993u},{7830u,7830u,33446u},
+{7831u,7831u,33899u},{7832u,7832u,33983u},{7833u,7833u,34382u},{7834u,7834u,34399u},
+{7835u,7835u,34676u},{7836u,7836u,35703u},{7837u,7837u,35946u},{7838u,7838u,37804u},
+{7839u,7839u,38912u},{7840u,7840u,39013u},{7841u,7841u,24785u},{7842u,7842u,25110u},
+{7843u,7843u,37239u},{7844u,7844u,23130u},{7845u,7845u,26127u},{7846u,7846u,28151u},
+{7847u,7847u,28222u},{7848u,7848u,29759u},{7849u,7849u,39746u},{7850u,7850u,24573u},
+{7851u,7851u,24794u},{7852u,7852u,31503u},{7853u,7853u,21700u},{7854u,7854u,24344u},
+{7855u,7855u,27742u},{7856u,7856u,27859u},{7857u,7857u,27946u},{7858u,7858u,28888u},
+{7859u,7859u,32005u},{7860u,7860u,34425u},{7861u,7861u,35340u},{7862u,7862u,40251u},
+{7863u,7863u,21270u},{7864u,7864u,21644u},{7865u,7865u,23301u},{7866u,7866u,27194u},
+{7867u,7867u,28779u},{7868u,7868u,30069u},{7869u,7869u,31117u},{7870u,7870u,31166u},
+{7871u,7871u,33457u},{7872u,7872u,33775u},{7873u,7873u,35441u},{7874u,7874u,35649u},
+{7875u,7875u,36008u},{7876u,7876u,38772u},{7877u,7877u,25844u},{7878u,7878u,25899u},
+{7879u,7880u,30906u},{7881u,7881u,31339u},{7882u,7882u,20024u},{7883u,7883u,21914u},
+{7884u,7884u,22864u},{7885u,7885u,23462u},{7886u,7886u,24187u},{7887u,7887u,24739u},
+{7888u,7888u,25563u},{7889u,7889u,27489u},{7890u,7890u,26213u},{7891u,7891u,26707u},
+{7892u,7892u,28185u},{7893u,7893u,29029u},{7894u,7894u,29872u},{7895u,7895u,32008u},
+{7896u,7896u,36996u},{7897u,7897u,39529u},{7898u,7898u,39973u},{7899u,7899u,27963u},
+{7900u,7900u,28369u},{7901u,7901u,29502u},{7902u,7902u,35905u},{7903u,7903u,38346u},
+{7904u,7904u,20976u},{7905u,7905u,24140u},{7906u,7906u,24488u},{7907u,7907u,24653u},
+{7908u,7908u,24822u},{7909u,7909u,24880u},{7910u,7910u,24908u},{7911u,7912u,26179u},
+{7913u,7913u,27045u},{7914u,7914u,27841u},{7915u,7915u,28255u},{7916u,7916u,28361u},
+{7917u,7917u,28514u},{7918u,7918u,29004u},{7919u,7919u,29852u},{7920u,7920u,30343u},
+{7921u,7921u,31681u},{7922u,7922u,31783u},{7923u,7923u,33618u},{7924u,7924u,34647u},
+{7925u,7925u,36945u},{7926u,7926u,38541u},{7927u,7927u,40643u},{7928u,7928u,21295u},
+{7929u,7929u,22238u},{7930u,7930u,24315u},{7931u,7931u,24458u},{7932u,7932u,24674u},
+{7933u,7933u,24724u},{7934u,7934u,25079u},{7935u,7935u,26214u},{7936u,7936u,26371u},
+{7937u,7937u,27292u},{7938u,7938u,28142u},{7939u,7939u,28590u},{7940u,7940u,28784u},
+{7941u,7941u,29546u},{7942u,7942u,32362u},{7943u,7943u,33214u},{7944u,7944u,33588u},
+{7945u,7945u,34516u},{7946u,7946u,35496u},{7947u,7947u,36036u},{7948u,7948u,21123u},
+{7949u,7949u,29554u},{7950u,7950u,23446u},{7951u,7951u,27243u},{7952u,7952u,37892u},
+{7953u,7953u,21742u},{7954u,7954u,22150u},{7955u,7955u,23389u},{7956u,7956u,25928u},
+{7957u,7957u,25989u},{7958u,7958u,26313u},{7959u,7959u,26783u},{7960u,7960u,28045u},
+{7961u,7961u,28102u},{7962u,7962u,29243u},{7963u,7963u,32948u},{7964u,7964u,37237u},
+{7965u,7965u,39501u},{7966u,7966u,20399u},{7967u,7967u,20505u},{7968u,7968u,21402u},
+{7969u,7969u,21518u},{7970u,7970u,21564u},{7971u,7971u,21897u},{7972u,7972u,21957u},
+{7973u,7973u,24127u},{7974u,7974u,24460u},{7975u,7975u,26429u},{7976u,7976u,29030u},
+{7977u,7977u,29661u},{7978u,7978u,36869u},{7979u,7979u,21211u},{7980u,7980u,21235u},
+{7981u,7981u,22628u},{7982u,7982u,22734u},{7983u,7983u,28932u},{7984u,7984u,29071u},
+{7985u,7985u,29179u},{7986u,7986u,34224u},{7987u,7987u,35347u},{7988u,7988u,26248u},
+{7989u,7989u,34216u},{7990u,7990u,21927u},{7991u,7991u,26244u},{7992u,7992u,29002u},
+{7993u,7993u,33841u},{7994u,7994u,21321u},{7995u,7995u,21913u},{7996u,7996u,27585u},
+{7997u,7997u,24409u},{7998u,7998u,24509u},{7999u,7999u,25582u},{8000u,8000u,26249u},
+{8001u,8001u,28999u},{8002u,8002u,35569u},{8003u,8003u,36637u},{8004u,8004u,40638u},
+{8005u,8005u,20241u},{8006u,8006u,25658u},{8007u,8007u,28875u},{8008u,8008u,30054u},
+{8009u,8009u,34407u},{8010u,8010u,24676u},{8011u,8011u,35662u},{8012u,8012u,40440u},
+{8013u,8013u,20807u},{8014u,8014u,20982u},{8015u,8015u,21256u},{8016u,8016u,27958u},
+{8017u,8017u,33016u},{8018u,8018u,40657u},{8019u,8019u,26133u},{8020u,8020u,27427u},
+{8021u,8021u,28824u},{8022u,8022u,30165u},{8023u,8023u,21507u},{8024u,8024u,23673u},
+{8025u,8025u,32007u},{8026u,8026u,35350u},{8027u,8027u,27424u},{8028u,8028u,27453u},
+{8029u,8029u,27462u},{8030u,8030u,21560u},{8031u,8031u,24688u},{8032u,8032u,27965u},
+{8033u,8033u,32725u},{8034u,8034u,33288u},{8035u,8035u,20694u},{8036u,8036u,20958u},
+{8037u,8037u,21916u},{8038u,8038u,22123u},{8039u,8039u,22221u},{8040u,8040u,23020u},
+{8041u,8041u,23305u},{8042u,8042u,24076u},{8043u,8043u,24985u},{8044u,8044u,24984u},
+{8045u,8045u,25137u},{8046u,8046u,26206u},{8047u,8047u,26342u},{8048u,8048u,29081u},
+{8049u,8050u,29113u},{8051u,8051u,29351u},{8052u,8052u,31143u},{8053u,8053u,31232u},
+{8054u,8054u,32690u},{8055u,8055u,35440u},{8056u,8057u,12289u},{8058u,8058u,8229u},
+{8059u,8059u,173u},{8060u,8060u,8213u},{8061u,8061u,8741u},{8062u,8062u,65374u},
+{8063u,8064u,12308u},{8065u,8074u,12296u},{8075u,8075u,12307u},{8076u,8076u,65281u},
+{8077u,8078u,65288u},{8079u,8079u,65292u},{8080u,8080u,65294u},{8081u,8086u,65306u},
+{8087u,8087u,65339u},{8088u,8088u,65341u},{8089u,8089u,65343u},{8090u,8093u,65371u},
+{8094u,8187u,32u},{8188u,8188u,8254u},{8189u,8189u,126u},{8190u,8190u,92u},
+{8191u,8191u,8988u},{8192u,8192u,8991u},{8197u,8198u,12302u},{8199u,8200u,12298u},
+{8201u,8202u,12296u},{8203u,8204u,40u},{8213u,8214u,40u},{8217u,8218u,12310u},
+{8219u,8222u,12310u},{8223u,8223u,91u},{8224u,8224u,93u},{8227u,8227u,9790u},
+{8228u,8228u,9789u},{8229u,8229u,8225u},{8230u,8230u,8225u},{8231u,8232u,8224u},
+{8234u,8234u,8727u},{8237u,8237u,8223u},{8238u,8238u,8219u},{8239u,8240u,726u},
+{8241u,8241u,215u},{8242u,8242u,8734u},{8244u,8244u,177u},{8245u,8245u,8723u},
+{8246u,8246u,62u},{8247u,8248u,60u},{8249u,8249u,8800u},{8250u,8251u,8317u},
+{8252u,8252u,123u},{8253u,8253u,125u},{8256u,8257u,8745u},{8258u,8258u,8834u},
+{8259u,8259u,8712u},{8260u,8260u,931u},{8261u,8261u,33u},{8263u,8265u,12321u},
+{8269u,8269u,19971u},{8272u,8272u,21313u},{8275u,8275u,39u},{8276u,8277u,12308u},
+{8278u,8278u,42u},{8280u,8280u,8727u},{8281u,8281u,42u},{8283u,8284u,12289u},
+{8289u,8290u,40u},{8291u,8292u,12310u},{8293u,8294u,12304u},{8317u,8317u,182u},
+{8320u,8320u,8943u},{8321u,8321u,8759u},{8342u,8351u,10122u},{8388u,8413u,9398u},
+{8475u,8475u,8911u},{8476u,8477u,8910u},{8478u,8478u,8910u},{8479u,8480u,8832u},
+{8481u,8484u,8816u},{8486u,8486u,8842u},{8488u,8488u,8843u},{8489u,8490u,8822u},
+{8491u,8491u,8825u},{8492u,8493u,8922u},{8498u,8498u,8737u},{8499u,8499u,8773u},
+{8500u,8500u,8771u},{8501u,8501u,8776u},{8503u,8503u,8868u},{8504u,8504u,8875u},
+{8517u,8525u,9312u},{8578u,8578u,33u},{8579u,8579u,176u},{8580u,8580u,39u},
+{8581u,8581u,34u},{8582u,8582u,8244u},{8589u,8589u,8224u},{8593u,8593u,167u},
+{8594u,8594u,35u},{8595u,8595u,42u},{8596u,8596u,42u},{8599u,8599u,8258u},
+{8600u,8600u,42u},{8603u,8603u,8258u},{8604u,8604u,42u},{8607u,8607u,8226u},
+{8612u,8615u,12296u},{8616u,8616u,9756u},{8617u,8617u,9758u},{8630u,8630u,10010u},
+{8631u,8631u,10006u},{8633u,8633u,9711u},{8639u,8639u,9676u},{8661u,8661u,8361u},
+{8664u,8664u,9775u},{8666u,8666u,9775u},{8667u,8667u,9775u},{8671u,8671u,12320u},
+{8673u,8682u,10102u},{8699u,8699u,9794u},{8700u,8700u,8873u},{8701u,8701u,12342u},
+{8702u,8702u,9675u},{8703u,8703u,9683u},{8704u,8704u,9633u},{8705u,8705u,8962u},
+{8707u,8707u,9645u},{8708u,8708u,9645u},{8712u,8712u,9671u},{8715u,8715u,8710u},
+{8716u,8716u,8895u},{8717u,8717u,8990u},{8719u,8720u,8741u},{8722u,8722u,8787u},
+{8723u,8723u,8785u},{8724u,8725u,8806u},{8726u,8726u,8723u},{8727u,8729u,8853u},
+{8731u,8731u,8980u},{8734u,8734u,8802u},{8736u,8736u,9649u},{8738u,8738u,8738u},
+{8739u,8739u,8784u},{8740u,8740u,216u},{8741u,8741u,9034u},{8742u,8742u,8867u},
+{8745u,8746u,8814u},{8747u,8747u,8837u},{8748u,8748u,8836u},{8749u,8749u,8713u},
+{8750u,8750u,8716u},{8751u,8751u,8891u},{8752u,8752u,22u},{8753u,8753u,8794u},
+{8754u,8754u,8966u},{8755u,8755u,36u},{8761u,8761u,12958u},{8763u,8763u,8252u},
+{8767u,8767u,8900u},{8768u,8768u,9671u},{8769u,8769u,8900u},{8770u,8770u,9670u},
+{8771u,8771u,9643u},{8772u,8772u,9633u},{8773u,8773u,9643u},{8774u,8774u,9632u},
+{8775u,8775u,9702u},{8776u,8776u,9675u},{8777u,8777u,9702u},{8778u,8778u,9679u},
+{8779u,8779u,9661u},{8780u,8780u,9651u},{8781u,8781u,9655u},{8782u,8782u,9665u},
+{8783u,8783u,10022u},{8784u,8784u,9679u},{8785u,8785u,9632u},{8787u,8787u,9674u},
+{8788u,8788u,12849u},{8789u,8789u,12857u},{8790u,8790u,13259u},{8791u,8791u,9347u},
+{8792u,8795u,9364u},{8806u,8806u,8594u},{8807u,8808u,8592u},{8809u,8809u,8595u},
+{8810u,8813u,8598u},{8814u,8814u,8656u},{8815u,8815u,8655u},{8816u,8816u,8653u},
+{8817u,8817u,8660u},{8825u,8825u,10132u},{8837u,8837u,10140u},{8849u,8849u,10170u},
+{8854u,8854u,8657u},{8855u,8855u,8659u},{8857u,8857u,10142u},{8861u,8861u,10142u},
+{8864u,8864u,8629u},{8865u,8865u,8625u},{8867u,8867u,8628u},{8868u,8868u,8624u},
+{8869u,8869u,8627u},{8880u,8880u,8678u},{8881u,8881u,8680u},{8882u,8882u,8679u},
+{8883u,8883u,8681u},{8884u,8884u,8636u},{8885u,8885u,8640u},{8890u,8890u,8640u},
+{8891u,8891u,8636u},{8896u,8897u,8644u},{9042u,9046u,9347u},{9080u,9080u,12948u},
+{9096u,9096u,12965u},{9178u,9178u,10132u},{9190u,9193u,8672u},{9195u,9195u,10145u},
+{9198u,9198u,8678u},{9199u,9199u,8680u},{9200u,9200u,8679u},{9201u,9201u,8681u},
+{9222u,9222u,9757u},{9223u,9223u,9759u},{9300u,9300u,12944u},{9301u,9306u,12938u},
+{9314u,9317u,12300u},{9318u,9318u,8680u},{9319u,9320u,8678u},{9321u,9321u,8681u},
+{9322u,9322u,34u},{9323u,9323u,12319u},{9324u,9324u,12317u},{9325u,9325u,8246u},
+{9326u,9326u,96u},{9327u,9327u,12289u},{9329u,9329u,33u},{9330u,9330u,12321u},
+{9331u,9331u,44u},{9332u,9332u,12290u},{9333u,9334u,44034u},{9335u,9336u,44037u},
+{9337u,9341u,44043u},{9342u,9342u,44056u},{9343u,9344u,44062u},{9345u,9347u,44065u},
+{9348u,9354u,44069u},{9355u,9355u,44078u},{9356u,9361u,44082u},{9362u,9363u,44090u},
+{9364u,9366u,44093u},{9367u,9376u,44097u},{9377u,9377u,44108u},{9378u,9383u,44110u},
+{9384u,9386u,44117u},{9387u,9389u,44121u},{9390u,9408u,44125u},{9409u,9410u,44146u},
+{9411u,9412u,44149u},{9413u,9413u,44153u},{9414u,9418u,44155u},{9419u,9419u,44162u},
+{9420u,9421u,44167u},{9422u,9424u,44173u},{9425u,9427u,44177u},{9428u,9434u,44181u},
+{9435u,9435u,44190u},{9436u,9441u,44194u},{9442u,9442u,44203u},{9443u,9444u,44205u},
+{9445u,9451u,44209u},{9452u,9452u,44218u},{9453u,9455u,44222u},{9456u,9457u,44226u},
+{9458u,9460u,44229u},{9461u,9463u,44233u},{9464u,9471u,44237u},{9472u,9472u,44246u},
+{9473u,9480u,44248u},{9481u,9482u,44258u},{9483u,9484u,44261u},{9485u,9485u,44265u},
+{9486u,9486u,44267u},{9487u,9488u,44269u},{9489u,9489u,44274u},{9490u,9490u,44276u},
+{9491u,9495u,44279u},{9496u,9497u,44286u},{9498u,9500u,44289u},{9501u,9501u,44293u},
+{9502u,9506u,44295u},{9507u,9507u,44302u},{9508u,9508u,44304u},{9509u,9514u,44306u},
+{9515u,9517u,44313u},{9518u,9520u,44317u},{9521u,9528u,44321u},{9529u,9530u,44330u},
+{9531u,9536u,44334u},{9537u,9538u,44342u},{9539u,9541u,44345u},{9542u,9548u,44349u},
+{9549u,9549u,44358u},{9550u,9550u,44360u},{9551u,9556u,44362u},{9557u,9559u,44369u},
+{9560u,9562u,44373u},{9563u,9570u,44377u},{9571u,9571u,44386u},{9572u,9579u,44388u},
+{9580u,9581u,44398u},{9582u,9583u,44401u},{9584u,9587u,44407u},{9588u,9588u,44414u},
+{9589u,9589u,44416u},{9590u,9594u,44419u},{9595u,9596u,44426u},{9597u,9599u,44429u},
+{9600u,9610u,44433u},{9611u,9616u,44446u},{9617u,9634u,44453u},{9635u,9642u,44472u},
+{9643u,9644u,44482u},{9645u,9647u,44485u},{9648u,9654u,44489u},{9655u,9655u,44498u},
+{9656u,9663u,44500u},{9664u,9666u,44509u},{9667u,9669u,44513u},{9670u,9688u,44517u},
+{9689u,9690u,44538u},{9691u,9692u,44541u},{9693u,9698u,44546u},{9699u,9699u,44554u},
+{9700u,9700u,44556u},{9701u,9706u,44558u},{9707u,9733u,44565u},{9734u,9735u,44594u},
+{9736u,9737u,44597u},{9738u,9738u,44601u},{9739u,9743u,44603u},{9744u,9744u,44610u},
+{9745u,9745u,44612u},{9746u,9748u,44615u},{9749u,9749u,44619u},{9750u,9750u,44623u},
+{9751u,9753u,44625u},{9754u,9754u,44629u},{9755u,9759u,44631u},{9760u,9760u,44638u},
+{9761u,9763u,44642u},{9764u,9765u,44646u},{9766u,9767u,44650u},{9768u,9770u,44653u},
+{9771u,9777u,44657u},{9778u,9778u,44666u},{9779u,9784u,44670u},{9785u,9790u,44678u},
+{9791u,9837u,44685u},{9838u,9838u,44735u},{9839u,9841u,44737u},{9842u,9848u,44741u},
+{9849u,9849u,44750u},{9850u,9855u,44754u},{9856u,9857u,44762u},{9858u,9868u,44765u},
+{9869u,9870u,44777u},{9871u,9871u,44780u},{9872u,9877u,44782u},{9878u,9880u,44789u},
+{9881u,9883u,44793u},{9884u,9893u,44797u},{9894u,9897u,44809u},{9898u,9899u,44814u},
+{9900u,9926u,44817u},{9927u,9928u,44846u},{9929u,9929u,44849u},{9930u,9930u,44851u},
+{9931u,9937u,44853u},{9938u,9938u,44862u},{9939u,9939u,44864u},{9940u,9943u,44868u},
+{9944u,9949u,44874u},{9950u,9960u,44881u},{9961u,9966u,44894u},{9967u,9985u,44902u},
+{9986u,9991u,44922u},{9992u,9994u,44929u},{9995u,9997u,44933u},{9998u,10004u,44937u},
+{10005u,10007u,44946u},{10008u,10013u,44950u},{10014u,10040u,44957u},{10041u,10042u,44986u},
+{10043u,10045u,44989u},{10046u,10051u,44993u},{10052u,10052u,45002u},{10053u,10053u,45004u},
+{10054u,10058u,45007u},{10059u,10065u,45013u},{10066u,10076u,45021u},{10077u,10082u,45034u},
+{10083u,10084u,45042u},{10085u,10087u,45045u},{10088u,10094u,45049u},{10095u,10096u,45058u},
+{10097u,10103u,45061u},{10104u,10106u,45069u},{10107u,10109u,45073u},{10110u,10116u,45077u},
+{10117u,10126u,45086u},{10127u,10153u,45097u},{10154u,10155u,45126u},{10156u,10156u,45129u},
+{10157u,10157u,45131u},{10158u,10158u,45133u},{10159u,10162u,45135u},{10163u,10163u,45142u},
+{10164u,10164u,45144u},{10165u,10167u,45146u},{10168u,10197u,45150u},{10198u,10199u,45182u},
+{10200u,10202u,45185u},{10203u,10209u,45189u},{10210u,10210u,45198u},{10211u,10211u,45200u},
+{10212u,10217u,45202u},{10218u,10218u,45211u},{10219u,10220u,45213u},{10221u,10225u,45219u},
+{10226u,10226u,45226u},{10227u,10227u,45232u},{10228u,10228u,45234u},{10229u,10230u,45238u},
+{10231u,10233u,45241u},{10234u,10240u,45245u},{10241u,10241u,45254u},{10242u,10247u,45258u},
+{10248u,10249u,45266u},{10250u,10252u,45269u},{10253u,10259u,45273u},{10260u,10263u,45281u},
+{10264u,10297u,45286u},{10298u,10298u,45322u},{10299u,10301u,45325u},{10302u,10302u,45329u},
+{10303u,10306u,45332u},{10307u,10307u,45338u},{10308u,10312u,45342u},{10313u,10314u,45350u},
+{10315u,10317u,45353u},{10318u,10324u,45357u},{10325u,10325u,45366u},{10326u,10331u,45370u},
+{10332u,10333u,45378u},{10334u,10336u,45381u},{10337u,10343u,45385u},{10344u,10345u,45394u},
+{10346u,10347u,45398u},{10348u,10350u,45401u},{10351u,10353u,45405u},{10354u,10376u,45409u},
+{10377u,10378u,45434u},{10379u,10381u,45437u},{10382u,10382u,45441u},{10383u,10387u,45443u},
+{10388u,10388u,45450u},{10389u,10389u,45452u},{10390u,10393u,45454u},{10394u,10396u,45461u},
+{10397u,10399u,45465u},{10400u,10410u,45469u},{10411u,10445u,45481u},{10446u,10448u,45517u},
+{10449u,10451u,45521u},{10452u,10458u,45525u},{10459u,10459u,45534u},{10460u,10467u,45536u},
+{10468u,10469u,45546u},{10470u,10472u,45549u},{10473u,10480u,45553u},{10481u,10481u,45562u},
+{10482u,10482u,45564u},{10483u,10488u,45566u},{10489u,10490u,45574u},{10491u,10492u,45577u},
+{10493u,10499u,45581u},{10500u,10500u,45590u},{10501u,10501u,45592u},{10502u,10507u,45594u},
+{10508u,10526u,45601u},{10527u,10533u,45621u},{10534u,10560u,45629u},{10561u,10563u,45657u},
+{10564u,10566u,45661u},{10567u,10573u,45665u},{10574u,10583u,45674u},{10584u,10589u,45686u},
+{10590u,10596u,45693u},{10597u,10599u,45702u},{10600u,10605u,45706u},{10606u,10607u,45714u},
+{10608u,10610u,45717u},{10611u,10615u,45723u},{10616u,10616u,45730u},{10617u,10617u,45732u},
+{10618u,10620u,45735u},{10621u,10621u,45739u},{10622u,10624u,45741u},{10625u,10627u,45745u},
+{10628u,10646u,45749u},{10647u,10648u,45770u},{10649u,10651u,45773u},{10652u,10652u,45777u},
+{10653u,10657u,45779u},{10658u,10658u,45786u},{10659u,10659u,45788u},{10660u,10663u,45790u},
+{10664u,10664u,45795u},{10665u,10665u,45799u},{10666u,10667u,45801u},{10668u,10670u,45808u},
+{10671u,10671u,45814u},{10672u,10674u,45820u},{10675u,10676u,45826u},{10677u,10679u,45829u},
+{10680u,10686u,45833u},{10687u,10687u,45842u},{10688u,10693u,45846u},{10694u,10748u,45853u},
+{10749u,10749u,45911u},{10750u,10751u,45913u},{10752u,10752u,45917u},{10753u,10756u,45920u},
+{10757u,10757u,45926u},{10758u,10758u,45928u},{10759u,10759u,45930u},{10760u,10761u,45932u},
+{10762u,10762u,45935u},{10763u,10764u,45938u},{10765u,10767u,45941u},{10768u,10774u,45945u},
+{10775u,10775u,45954u},{10776u,10781u,45958u},{10782u,10784u,45965u},{10785u,10787u,45969u},
+{10788u,10798u,45973u},{10799u,10804u,45986u},{10805u,10807u,45993u},{10808u,10830u,45997u},
+{10831u,10832u,46022u},{10833u,10834u,46025u},{10835u,10835u,46029u},{10836u,10836u,46031u},
+{10837u,10839u,46033u},{10840u,10840u,46038u},{10841u,10841u,46040u},{10842u,10842u,46042u},
+{10843u,10843u,46044u},{10844u,10845u,46046u},{10846u,10848u,46049u},{10849u,10851u,46053u},
+{10852u,10870u,46057u},{10871u,10889u,46077u},{10890u,10896u,46097u},{10897u,10899u,46105u},
+{10900u,10902u,46109u},{10903u,10909u,46113u},{10910u,10910u,46122u},{10911u,10918u,46124u},
+{10919u,10945u,46133u},{10946u,10947u,46162u},{10948u,10950u,46165u},{10951u,10957u,46169u},
+{10958u,10958u,46178u},{10959u,10959u,46180u},{10960u,10965u,46182u},{10966u,10984u,46189u},
+{10985u,10991u,46209u},{10992u,11011u,46217u},{11012u,11017u,46238u},{11018u,11020u,46245u},
+{11021u,11023u,46249u},{11024u,11031u,46253u},{11032u,11032u,46262u},{11033u,11033u,46264u},
+{11034u,11039u,46266u},{11040u,11042u,46273u},{11043u,11045u,46277u},{11046u,11052u,46281u},
+{11053u,11056u,46289u},{11057u,11062u,46294u},{11063u,11064u,46302u},{11065u,11066u,46305u},
+{11067u,11067u,46309u},{11068u,11072u,46311u},{11073u,11073u,46318u},{11074u,11074u,46320u},
+{11075u,11080u,46322u},{11081u,11107u,46329u},{11108u,11109u,46358u},{11110u,11111u,46361u},
+{11112u,11118u,46365u},{11119u,11119u,46374u},{11120u,11124u,46379u},{11125u,11126u,46386u},
+{11127u,11129u,46389u},{11130u,11136u,46393u},{11137u,11137u,46402u},{11138u,11142u,46406u},
+{11143u,11144u,46414u},{11145u,11147u,46417u},{11148u,11154u,46421u},{11155u,11155u,46430u},
+{11156u,11217u,46434u},{11218u,11219u,46498u},{11220u,11222u,46501u},{11223u,11223u,46505u},
+{11224u,11227u,46508u},{11228u,11228u,46514u},{11229u,11233u,46518u},{11234u,11235u,46526u},
+{11236u,11238u,46529u},{11239u,11245u,46533u},{11246u,11246u,46542u},{11247u,11252u,46546u},
+{11253u,11271u,46553u},{11272u,11306u,46573u},{11307u,11308u,46610u},{11309u,11311u,46613u},
+{11312u,11323u,46617u},{11324u,11329u,46630u},{11330u,11336u,46637u},{11337u,11355u,46645u},
+{11356u,11382u,46665u},{11383u,11385u,46693u},{11386u,11436u,46697u},{11437u,11438u,46750u},
+{11439u,11441u,46753u},{11442u,11447u,46757u},{11448u,11451u,46765u},{11452u,11485u,46770u},
+{11486u,11512u,46805u},{11513u,11515u,46833u},{11516u,11518u,46837u},{11519u,11525u,46841u},
+{11526u,11528u,46850u},{11529u,11562u,46854u},{11563u,11564u,46890u},{11565u,11566u,46893u},
+{11567u,11573u,46897u},{11574u,11574u,46906u},{11575u,11582u,46908u},{11583u,11585u,46917u},
+{11586u,11588u,46921u},{11589u,11595u,46925u},{11596u,11605u,46934u},{11606u,11608u,46945u},
+{11609u,11611u,46949u},{11612u,11618u,46953u},{11619u,11619u,46962u},{11620u,11620u,46964u},
+{11621u,11626u,46966u},{11627u,11628u,46974u},{11629u,11631u,46977u},{11632u,11638u,46981u},
+{11639u,11639u,46990u},{11640u,11642u,46995u},{11643u,11644u,47002u},{11645u,11647u,47005u},
+{11648u,11654u,47009u},{11655u,11655u,47018u},{11656u,11661u,47022u},{11662u,11663u,47030u},
+{11664u,11677u,47033u},{11678u,11678u,47048u},{11679u,11712u,47050u},{11713u,11714u,47086u},
+{11715u,11717u,47089u},{11718u,11724u,47093u},{11725u,11725u,47102u},{11726u,11730u,47106u},
+{11731u,11732u,47114u},{11733u,11735u,47117u},{11736u,11742u,47121u},{11743u,11743u,47130u},
+{11744u,11744u,47132u},{11745u,11750u,47134u},{11751u,11752u,47142u},{11753u,11755u,47145u},
+{11756u,11762u,47149u},{11763u,11763u,47158u},{11764u,11769u,47162u},{11770u,11772u,47169u},
+{11773u,11784u,47173u},{11785u,11785u,47186u},{11786u,11793u,47188u},{11794u,11795u,47198u},
+{11796u,11798u,47201u},{11799u,11805u,47205u},{11806u,11806u,47214u},{11807u,11807u,47216u},
+{11808u,11813u,47218u},{11814u,11816u,47225u},{11817u,11832u,47229u},{11833u,11858u,47246u},
+{11859u,11865u,47273u},{11866u,11868u,47281u},{11869u,11871u,47285u},{11872u,11878u,47289u},
+{11879u,11879u,47298u},{11880u,11880u,47300u},{11881u,11886u,47302u},{11887u,11889u,47309u},
+{11890u,11892u,47313u},{11893u,11900u,47317u},{11901u,11901u,47326u},{11902u,11902u,47328u},
+{11903u,11908u,47330u},{11909u,11910u,47338u},{11911u,11913u,47341u},{11914u,11920u,47345u},
+{11921u,11921u,47354u},{11922u,11922u,47356u},{11923u,11928u,47358u},{11929u,11947u,47365u},
+{11948u,11954u,47385u},{11955u,11981u,47393u},{11982u,11983u,47422u},{11984u,11986u,47425u},
+{11987u,11993u,47429u},{11994u,11995u,47437u},{11996u,11996u,47440u},{11997u,12002u,47442u},
+{12003u,12004u,47450u},{12005u,12007u,47453u},{12008u,12014u,47457u},{12015u,12015u,47466u},
+{12016u,12016u,47468u},{12017u,12022u,47470u},{12023u,12024u,47478u},{12025u,12027u,47481u},
+{12028u,12034u,47485u},{12035u,12035u,47494u},{12036u,12036u,47496u},{12037u,12038u,47499u},
+{12039u,12067u,47503u},{12068u,12069u,47534u},{12070u,12072u,47537u},{12073u,12079u,47541u},
+{12080u,12080u,47550u},{12081u,12081u,47552u},{12082u,12087u,47554u},{12088u,12089u,47562u},
+{12090u,12090u,47565u},{12091u,12095u,47571u},{12096u,12096u,47578u},{12097u,12097u,47580u},
+{12098u,12099u,47583u},{12100u,12100u,47586u},{12101u,12102u,47590u},{12103u,12105u,47593u},
+{12106u,12112u,47597u},{12113u,12113u,47606u},{12114u,12118u,47611u},{12119u,12124u,47618u},
+{12125u,12136u,47625u},{12137u,12170u,47638u},{12171u,12172u,47674u},{12173u,12175u,47677u},
+{12176u,12176u,47681u},{12177u,12181u,47683u},{12182u,12182u,47690u},{12183u,12183u,47692u},
+{12184u,12187u,47695u},{12188u,12189u,47702u},{12190u,12192u,47705u},{12193u,12199u,47709u},
+{12200u,12200u,47718u},{12201u,12206u,47722u},{12207u,12208u,47730u},{12209u,12211u,47733u},
+{12212u,12221u,47737u},{12222u,12222u,47750u},{12223u,12226u,47752u},{12227u,12253u,47757u},
+{12254u,12254u,47786u},{12255u,12257u,47789u},{12258u,12258u,47793u},{12259u,12263u,47795u},
+{12264u,12264u,47802u},{12265u,12265u,47804u},{12266u,12271u,47806u},{12272u,12274u,47813u},
+{12275u,12289u,47817u},{12290u,12323u,47834u},{12324u,12326u,47869u},{12327u,12329u,47873u},
+{12330u,12337u,47877u},{12338u,12338u,47886u},{12339u,12339u,47888u},{12340u,12345u,47890u},
+{12346u,12348u,47897u},{12349u,12351u,47901u},{12352u,12359u,47905u},{12360u,12360u,47914u},
+{12361u,12368u,47916u},{12369u,12369u,47927u},{12370u,12371u,47929u},{12372u,12376u,47935u},
+{12377u,12377u,47942u},{12378u,12378u,47944u},{12379u,12381u,47946u},{12382u,12382u,47950u},
+{12383u,12385u,47953u},{12386u,12388u,47957u},{12389u,12396u,47961u},{12397u,12397u,47970u},
+{12398u,12405u,47972u},{12406u,12432u,47981u},{12433u,12435u,48009u},{12436u,12438u,48013u},
+{12439u,12457u,48017u},{12458u,12460u,48037u},{12461u,12463u,48041u},{12464u,12470u,48045u},
+{12471u,12472u,48053u},{12473u,12480u,48056u},{12481u,12483u,48065u},{12484u,12486u,48069u},
+{12487u,12493u,48073u},{12494u,12495u,48081u},{12496u,12531u,48084u},{12532u,12533u,48122u},
+{12534u,12535u,48125u},{12536u,12536u,48129u},{12537u,12541u,48131u},{12542u,12542u,48138u},
+{12543u,12543u,48142u},{12544u,12544u,48144u},{12545u,12546u,48146u},{12547u,12548u,48153u},
+{12549u,12552u,48160u},{12553u,12553u,48166u},{12554u,12554u,48168u},{12555u,12557u,48170u},
+{12558u,12559u,48174u},{12560u,12561u,48178u},{12562u,12564u,48181u},{12565u,12571u,48185u},
+{12572u,12572u,48194u},{12573u,12575u,48198u},{12576u,12577u,48202u},{12578u,12579u,48206u},
+{12580u,12591u,48209u},{12592u,12629u,48222u},{12630u,12631u,48262u},{12632u,12633u,48265u},
+{12634u,12634u,48269u},{12635u,12639u,48271u},{12640u,12640u,48278u},{12641u,12641u,48280u},
+{12642u,12646u,48283u},{12647u,12648u,48290u},{12649u,12650u,48293u},{12651u,12657u,48297u},
+{12658u,12658u,48306u},{12659u,12664u,48310u},{12665u,12666u,48318u},{12667u,12669u,48321u},
+{12670u,12677u,48325u},{12678u,12678u,48334u},{12679u,12681u,48338u},{12682u,12683u,48342u},
+{12684u,12686u,48345u},{12687u,12709u,48349u},{12710u,12710u,48375u},{12711u,12713u,48377u},
+{12714u,12720u,48381u},{12721u,12721u,48390u},{12722u,12722u,48392u},{12723u,12728u,48394u},
+{12729u,12731u,48401u},{12732u,12746u,48405u},{12747u,12753u,48421u},{12754u,12772u,48429u},
+{12773u,12779u,48449u},{12780u,12781u,48458u},{12782u,12784u,48461u},{12785u,12791u,48465u},
+{12792u,12801u,48474u},{12802u,12804u,48485u},{12805u,12827u,48489u},{12828u,12829u,48514u},
+{12830u,12831u,48517u},{12832u,12836u,48523u},{12837u,12837u,48530u},{12838u,12838u,48532u},
+{12839u,12841u,48534u},{12842u,12842u,48539u},{12843u,12849u,48541u},{12850u,12860u,48549u},
+{12861u,12867u,48561u},{12868u,12894u,48569u},{12895u,12896u,48598u},{12897u,12899u,48601u},
+{12900u,12911u,48605u},{12912u,12917u,48618u},{12918u,12920u,48625u},{12921u,12923u,48629u},
+{12924u,12930u,48633u},{12931u,12932u,48641u},{12933u,12933u,48644u},{12934u,12939u,48646u},
+{12940u,12941u,48654u},{12942u,12944u,48657u},{12945u,12951u,48661u},{12952u,12952u,48670u},
+{12953u,12988u,48672u},{12989u,12990u,48710u},{12991u,12993u,48713u},{12994u,12994u,48717u},
+{12995u,12999u,48719u},{13000u,13000u,48726u},{13001u,13001u,48728u},{13002u,13005u,48732u},
+{13006u,13007u,48738u},{13008u,13010u,48741u},{13011u,13011u,48745u},{13012u,13016u,48747u},
+{13017u,13017u,48754u},{13018u,13022u,48758u},{13023u,13024u,48766u},{13025u,13027u,48769u},
+{13028u,13034u,48773u},{13035u,13035u,48782u},{13036u,13041u,48786u},{13042u,13055u,48794u},
+{13056u,13094u,48809u},{13095u,13096u,48850u},{13097u,13098u,48853u},{13099u,13105u,48857u},
+{13106u,13107u,48865u},{13108u,13113u,48870u},{13114u,13133u,48877u},{13134u,13139u,48898u},
+{13140u,13153u,48906u},{13154u,13154u,48922u},{13155u,13188u,48926u},{13189u,13190u,48962u},
+{13191u,13193u,48965u},{13194u,13200u,48969u},{13201u,13203u,48978u},{13204u,13265u,48982u},
+{13266u,13292u,49045u},{13293u,13312u,49073u},{13313u,13318u,49094u},{13319u,13320u,49102u},
+{13321u,13323u,49105u},{13324u,13330u,49109u},{13331u,13332u,49117u},{13333u,13333u,49120u},
+{13334u,13423u,49122u},{13424u,13443u,49213u},{13444u,13449u,49234u},{13450u,13452u,49241u},
+{13453u,13455u,49245u},{13456u,13462u,49249u},{13463u,13500u,49258u},{13501u,13502u,49298u},
+{13503u,13505u,49301u},{13506u,13512u,49305u},{13513u,13513u,49314u},{13514u,13514u,49316u},
+{13515u,13520u,49318u},{13521u,13521u,49326u},{13522u,13523u,49329u},{13524u,13528u,49335u},
+{13529u,13529u,49342u},{13530u,13532u,49346u},{13533u,13534u,49350u},{13535u,13536u,49354u},
+{13537u,13539u,49357u},{13540u,13546u,49361u},{13547u,13547u,49370u},{13548u,13553u,49374u},
+{13554u,13555u,49382u},{13556u,13558u,49385u},{13559u,13565u,49389u},{13566u,13566u,49398u},
+{13567u,13567u,49400u},{13568u,13573u,49402u},{13574u,13576u,49409u},{13577u,13579u,49413u},
+{13580u,13586u,49417u},{13587u,13590u,49425u},{13591u,13596u,49430u},{13597u,13598u,49441u},
+{13599u,13599u,49445u},{13600u,13603u,49448u},{13604u,13604u,49454u},{13605u,13608u,49458u},
+{13609u,13609u,49463u},{13610u,13611u,49466u},{13612u,13614u,49469u},{13615u,13621u,49473u},
+{13622u,13622u,49482u},{13623u,13628u,49486u},{13629u,13630u,49494u},{13631u,13633u,49497u},
+{13634u,13640u,49501u},{13641u,13641u,49510u},{13642u,13647u,49514u},{13648u,13650u,49521u},
+{13651u,13653u,49525u},{13654u,13665u,49529u},{13666u,13671u,49542u},{13672u,13672u,49551u},
+{13673u,13675u,49553u},{13676u,13676u,49557u},{13677u,13681u,49559u},{13682u,13682u,49566u},
+{13683u,13683u,49568u},{13684u,13686u,49570u},{13687u,13688u,49574u},{13689u,13690u,49578u},
+{13691u,13693u,49581u},{13694u,13705u,49585u},{13706u,13711u,49598u},{13712u,13714u,49605u},
+{13715u,13717u,49609u},{13718u,13724u,49613u},{13725u,13726u,49621u},{13727u,13733u,49625u},
+{13734u,13736u,49633u},{13737u,13739u,49637u},{13740u,13746u,49641u},{13747u,13747u,49650u},
+{13748u,13755u,49652u},{13756u,13757u,49662u},{13758u,13760u,49665u},{13761u,13767u,49669u},
+{13768u,13768u,49678u},{13769u,13769u,49680u},{13770u,13775u,49682u},{13776u,13777u,49690u},
+{13778u,13779u,49693u},{13780u,13786u,49697u},{13787u,13787u,49706u},{13788u,13788u,49708u},
+{13789u,13789u,49710u},{13790u,13790u,49712u},{13791u,13791u,49715u},{13792u,13810u,49717u},
+{13811u,13817u,49737u},{13818u,13819u,49746u},{13820u,13822u,49749u},{13823u,13829u,49753u},
+{13830u,13833u,49761u},{13834u,13839u,49766u},{13840u,13841u,49774u},{13842u,13844u,49777u},
+{13845u,13851u,49781u},{13852u,13852u,49790u},{13853u,13853u,49792u},{13854u,13859u,49794u},
+{13860u,13865u,49802u},{13866u,13872u,49809u},{13873u,13874u,49817u},{13875u,13875u,49820u},
+{13876u,13881u,49822u},{13882u,13883u,49830u},{13884u,13886u,49833u},{13887u,13892u,49838u},
+{13893u,13893u,49846u},{13894u,13894u,49848u},{13895u,13928u,49850u},{13929u,13930u,49886u},
+{13931u,13932u,49889u},{13933u,13938u,49893u},{13939u,13939u,49902u},{13940u,13940u,49904u},
+{13941u,13944u,49906u},{13945u,13945u,49911u},{13946u,13946u,49914u},{13947u,13949u,49917u},
+{13950u,13956u,49921u},{13957u,13958u,49930u},{13959u,13963u,49934u},{13964u,13965u,49942u},
+{13966u,13968u,49945u},{13969u,13975u,49949u},{13976u,13977u,49958u},{13978u,14004u,49962u},
+{14005u,14038u,49990u},{14039u,14040u,50026u},{14041u,14043u,50029u},{14044u,14044u,50033u},
+{14045u,14049u,50035u},{14050u,14051u,50042u},{14052u,14057u,50046u},{14058u,14060u,50053u},
+{14061u,14063u,50057u},{14064u,14114u,50061u},{14115u,14137u,50113u},{14138u,14139u,50138u},
+{14140u,14141u,50141u},{14142u,14142u,50145u},{14143u,14147u,50147u},{14148u,14150u,50154u},
+{14151u,14156u,50158u},{14157u,14158u,50166u},{14159u,14173u,50169u},{14174u,14180u,50185u},
+{14181u,14199u,50193u},{14200u,14206u,50213u},{14207u,14209u,50221u},{14210u,14212u,50225u},
+{14213u,14219u,50229u},{14220u,14229u,50238u},{14230u,14256u,50249u},{14257u,14258u,50278u},
+{14259u,14261u,50281u},{14262u,14268u,50285u},{14269u,14271u,50294u},{14272u,14277u,50298u},
+{14278u,14296u,50305u},{14297u,14303u,50325u},{14304u,14330u,50333u},{14331u,14333u,50361u},
+{14334u,14377u,50365u},{14378u,14383u,50410u},{14384u,14385u,50418u},{14386u,14388u,50421u},
+{14389u,14389u,50425u},{14390u,14393u,50427u},{14394u,14403u,50434u},{14404u,14406u,50445u},
+{14407u,14409u,50449u},{14410u,14416u,50453u},{14417u,14427u,50461u},{14428u,14429u,50474u},
+{14430u,14432u,50477u},{14433u,14439u,50481u},{14440u,14440u,50490u},{14441u,14441u,50492u},
+{14442u,14447u,50494u},{14448u,14449u,50502u},{14450u,14450u,50507u},{14451u,14454u,50511u},
+{14455u,14455u,50518u},{14456u,14458u,50522u},{14459u,14459u,50527u},{14460u,14461u,50530u},
+{14462u,14464u,50533u},{14465u,14471u,50537u},{14472u,14472u,50546u},{14473u,14478u,50550u},
+{14479u,14480u,50558u},{14481u,14483u,50561u},{14484u,14485u,50565u},{14486u,14489u,50568u},
+{14490u,14490u,50574u},{14491u,14491u,50576u},{14492u,14494u,50578u},{14495u,14495u,50582u},
+{14496u,14498u,50585u},{14499u,14501u,50589u},{14502u,14509u,50593u},{14510u,14519u,50602u},
+{14520u,14521u,50614u},{14522u,14522u,50618u},{14523u,14527u,50623u},{14528u,14528u,50635u},
+{14529u,14529u,50637u},{14530u,14530u,50639u},{14531u,14532u,50642u},{14533u,14535u,50645u},
+{14536u,14542u,50649u},{14543u,14543u,50658u},{14544u,14544u,50660u},{14545u,14550u,50662u},
+{14551u,14551u,50671u},{14552u,14554u,50673u},{14555u,14555u,50677u},{14556u,14559u,50680u},
+{14560u,14562u,50690u},{14563u,14565u,50697u},{14566u,14568u,50701u},{14569u,14575u,50705u},
+{14576u,14576u,50714u},{14577u,14583u,50717u},{14584u,14585u,50726u},{14586u,14588u,50729u},
+{14589u,14589u,50735u},{14590u,14591u,50737u},{14592u,14592u,50742u},{14593u,14593u,50744u},
+{14594u,14594u,50746u},{14595u,14598u,50748u},{14599u,14600u,50754u},{14601u,14603u,50757u},
+{14604u,14610u,50761u},{14611u,14611u,50770u},{14612u,14617u,50774u},{14618u,14619u,50782u},
+{14620u,14630u,50785u},{14631u,14632u,50797u},{14633u,14633u,50800u},{14634u,14639u,50802u},
+{14640u,14641u,50810u},{14642u,14644u,50813u},{14645u,14651u,50817u},{14652u,14652u,50826u},
+{14653u,14653u,50828u},{14654u,14659u,50830u},{14660u,14661u,50838u},{14662u,14664u,50841u},
+{14665u,14671u,50845u},{14672u,14672u,50854u},{14673u,14673u,50856u},{14674u,14679u,50858u},
+{14680u,14681u,50866u},{14682u,14684u,50869u},{14685u,14689u,50875u},{14690u,14690u,50882u},
+{14691u,14691u,50884u},{14692u,14697u,50886u},{14698u,14699u,50894u},{14700u,14702u,50897u},
+{14703u,14709u,50901u},{14710u,14711u,50910u},{14712u,14717u,50914u},{14718u,14719u,50922u},
+{14720u,14722u,50925u},{14723u,14729u,50929u},{14730u,14732u,50938u},{14733u,14738u,50942u},
+{14739u,14740u,50950u},{14741u,14743u,50953u},{14744u,14750u,50957u},{14751u,14751u,50966u},
+{14752u,14752u,50968u},{14753u,14758u,50970u},{14759u,14760u,50978u},{14761u,14763u,50981u},
+{14764u,14770u,50985u},{14771u,14771u,50994u},{14772u,14772u,50996u},{14773u,14773u,50998u},
+{14774u,14777u,51000u},{14778u,14779u,51006u},{14780u,14782u,51009u},{14783u,14787u,51013u},
+{14788u,14788u,51019u},{14789u,14789u,51022u},{14790u,14790u,51024u},{14791u,14793u,51033u},
+{14794u,14796u,51037u},{14797u,14803u,51041u},{14804u,14805u,51049u},{14806u,14813u,51052u},
+{14814u,14815u,51062u},{14816u,14818u,51065u},{14819u,14822u,51071u},{14823u,14823u,51078u},
+{14824u,14826u,51083u},{14827u,14827u,51087u},{14828u,14829u,51090u},{14830u,14830u,51093u},
+{14831u,14831u,51097u},{14832u,14836u,51099u},{14837u,14837u,51106u},{14838u,14842u,51111u},
+{14843u,14844u,51118u},{14845u,14847u,51121u},{14848u,14854u,51125u},{14855u,14855u,51134u},
+{14856u,14861u,51138u},{14862u,14863u,51146u},{14864u,14864u,51149u},{14865u,14865u,51151u},
+{14866u,14872u,51153u},{14873u,14876u,51161u},{14877u,14882u,51166u},{14883u,14885u,51173u},
+{14886u,14888u,51177u},{14889u,14907u,51181u},{14908u,14909u,51202u},{14910u,14912u,51205u},
+{14913u,14913u,51209u},{14914u,14918u,51211u},{14919u,14919u,51218u},{14920u,14920u,51220u},
+{14921u,14925u,51223u},{14926u,14927u,51230u},{14928u,14930u,51233u},{14931u,14937u,51237u},
+{14938u,14938u,51246u},{14939u,14939u,51248u},{14940u,14945u,51250u},{14946u,14948u,51257u},
+{14949u,14951u,51261u},{14952u,14958u,51265u},{14959u,14960u,51274u},{14961u,14966u,51278u},
+{14967u,14993u,51285u},{14994u,14995u,51314u},{14996u,14998u,51317u},{14999u,14999u,51321u},
+{15000u,15004u,51323u},{15005u,15005u,51330u},{15006u,15006u,51332u},{15007u,15009u,51336u},
+{15010u,15015u,51342u},{15016u,15023u,51349u},{15024u,15024u,51358u},{15025u,15025u,51360u},
+{15026u,15031u,51362u},{15032u,15050u,51369u},{15051u,15056u,51390u},{15057u,15059u,51397u},
+{15060u,15062u,51401u},{15063u,15069u,51405u},{15070u,15070u,51414u},{15071u,15071u,51416u},
+{15072u,15077u,51418u},{15078u,15079u,51426u},{15080u,15095u,51429u},{15096u,15101u,51446u},
+{15102u,15103u,51454u},{15104u,15106u,51457u},{15107u,15111u,51463u},{15112u,15112u,51470u},
+{15113u,15113u,51472u},{15114u,15119u,51474u},{15120u,15138u,51481u},{15139u,15145u,51501u},
+{15146u,15172u,51509u},{15173u,15174u,51538u},{15175u,15177u,51541u},{15178u,15184u,51545u},
+{15185u,15185u,51554u},{15186u,15193u,51556u},{15194u,15196u,51565u},{15197u,15199u,51569u},
+{15200u,15206u,51573u},{15207u,15217u,51581u},{15218u,15219u,51594u},{15220u,15222u,51597u},
+{15223u,15229u,51601u},{15230u,15230u,51610u},{15231u,15231u,51612u},{15232u,15265u,51614u},
+{15266u,15267u,51650u},{15268u,15269u,51653u},{15270u,15270u,51657u},{15271u,15275u,51659u},
+{15276u,15276u,51666u},{15277u,15277u,51668u},{15278u,15279u,51671u},{15280u,15280u,51675u},
+{15281u,15282u,51678u},{15283u,15283u,51681u},{15284u,15284u,51683u},{15285u,15286u,51685u},
+{15287u,15290u,51688u},{15291u,15291u,51694u},{15292u,15297u,51698u},{15298u,15299u,51706u},
+{15300u,15302u,51709u},{15303u,15309u,51713u},{15310u,15310u,51722u},{15311u,15316u,51726u},
+{15317u,15319u,51733u},{15320u,15335u,51737u},{15336u,15369u,51754u},{15370u,15371u,51790u},
+{15372u,15374u,51793u},{15375u,15381u,51797u},{15382u,15382u,51806u},{15383u,15388u,51810u},
+{15389u,15408u,51817u},{15409u,15414u,51838u},{15415u,15433u,51845u},{15434u,15468u,51865u},
+{15469u,15470u,51902u},{15471u,15473u,51905u},{15474u,15480u,51909u},{15481u,15481u,51918u},
+{15482u,15482u,51920u},{15483u,15483u,51922u},{15484u,15487u,51924u},{15488u,15493u,51930u},
+{15494u,15504u,51937u},{15505u,15511u,51949u},{15512u,15530u,51957u},{15531u,15537u,51977u},
+{15538u,15540u,51985u},{15541u,15543u,51989u},{15544u,15550u,51993u},{15551u,15581u,52002u},
+{15582u,15587u,52034u},{15588u,15589u,52042u},{15590u,15592u,52045u},{15593u,15599u,52049u},
+{15600u,15602u,52058u},{15603u,15608u,52062u},{15609u,15627u,52069u},{15628u,15661u,52090u},
+{15662u,15688u,52125u},{15689u,15715u,52153u},{15716u,15730u,52181u},{15731u,15732u,52197u},
+{15733u,15733u,52200u},{15734u,15767u,52202u},{15768u,15769u,52238u},{15770u,15772u,52241u},
+{15773u,15779u,52245u},{15780u,15782u,52254u},{15783u,15786u,52259u},{15787u,15788u,52266u},
+{15789u,15789u,52269u},{15790u,15790u,52271u},{15791u,15797u,52273u},{15798u,15798u,52282u},
+{15799u,15803u,52287u},{15804u,15805u,52294u},{15806u,15808u,52297u},{15809u,15815u,52301u},
+{15816u,15816u,52310u},{15817u,15822u,52314u},{15823u,15825u,52321u},{15826u,15826u,52325u},
+{15827u,15827u,52327u},{15828u,15834u,52329u},{15835u,15838u,52337u},{15839u,15872u,52342u},
+{15873u,15874u,52378u},{15875u,15877u,52381u},{15878u,15884u,52385u},{15885u,15885u,52394u},
+{15886u,15891u,52398u},{15892u,15893u,52406u},{15894u,15896u,52409u},{15897u,15903u,52413u},
+{15904u,15904u,52422u},{15905u,15905u,52424u},{15906u,15911u,52426u},{15912u,15914u,52433u},
+{15915u,15929u,52437u},{15930u,15936u,52453u},{15937u,15939u,52461u},{15940u,15955u,52465u},
+{15956u,15961u,52482u},{15962u,15963u,52490u},{15964u,15966u,52493u},{15967u,15973u,52497u},
+{15974u,15974u,52506u},{15975u,15975u,52508u},{15976u,15981u,52510u},{15982u,15984u,52517u},
+{15985u,15987u,52521u},{15988u,15999u,52525u},{16000u,16033u,52538u},{16034u,16036u,52573u},
+{16037u,16039u,52577u},{16040u,16046u,52581u},{16047u,16047u,52590u},{16048u,16048u,52592u},
+{16049u,16054u,52594u},{16055u,16069u,52601u},{16070u,16080u,52617u},{16081u,16082u,52630u},
+{16083u,16085u,52633u},{16086u,16092u,52637u},{16093u,16093u,52646u},{16094u,16094u,52648u},
+{16095u,16100u,52650u},{16101u,16119u,52657u},{16120u,16126u,52677u},{16127u,16129u,52685u},
+{16130u,16152u,52689u},{16153u,16155u,52713u},{16156u,16158u,52717u},{16159u,16165u,52721u},
+{16166u,16166u,52730u},{16167u,16167u,52732u},{16168u,16173u,52734u},{16174u,16176u,52741u},
+{16177u,16179u,52745u},{16180u,16186u,52749u},{16187u,16190u,52757u},{16191u,16196u,52762u},
+{16197u,16198u,52770u},{16199u,16201u,52773u},{16202u,16208u,52777u},{16209u,16209u,52786u},
+{16210u,16210u,52788u},{16211u,16244u,52790u},{16245u,16246u,52826u},{16247u,16248u,52829u},
+{16249u,16254u,52834u},{16255u,16255u,52842u},{16256u,16256u,52844u},{16257u,16262u,52846u},
+{16263u,16264u,52854u},{16265u,16267u,52857u},{16268u,16274u,52861u},{16275u,16275u,52870u},
+{16276u,16276u,52872u},{16277u,16282u,52874u},{16283u,16284u,52882u},{16285u,16287u,52885u},
+{16288u,16294u,52889u},{16295u,16295u,52898u},{16296u,16301u,52902u},{16302u,16320u,52910u},
+{16321u,16354u,52930u},{16355u,16356u,52966u},{16357u,16358u,52969u},{16359u,16365u,52973u},
+{16366u,16366u,52982u},{16367u,16372u,52986u},{16373u,16374u,52994u},{16375u,16377u,52997u},
+{16378u,16384u,53001u},{16385u,16385u,53010u},{16386u,16386u,53012u},{16387u,16392u,53014u},
+{16393u,16395u,53021u},{16396u,16398u,53025u},{16399u,16405u,53029u},{16406u,16406u,53038u},
+{16407u,16412u,53042u},{16413u,16439u,53049u},{16440u,16441u,53078u},{16442u,16444u,53081u},
+{16445u,16451u,53085u},{16452u,16452u,53094u},{16453u,16453u,53096u},{16454u,16459u,53098u},
+{16460u,16461u,53106u},{16462u,16464u,53109u},{16465u,16471u,53113u},{16472u,16475u,53121u},
+{16476u,16481u,53126u},{16482u,16501u,53133u},{16502u,16507u,53154u},{16508u,16514u,53161u},
+{16515u,16533u,53169u},{16534u,16560u,53189u},{16561u,16562u,53218u},{16563u,16565u,53221u},
+{16566u,16572u,53225u},{16573u,16573u,53234u},{16574u,16574u,53236u},{16575u,16580u,53238u},
+{16581u,16583u,53245u},{16584u,16586u,53249u},{16587u,16598u,53253u},{16599u,16604u,53266u},
+{16605u,16624u,53273u},{16625u,16630u,53294u},{16631u,16632u,53302u},{16633u,16635u,53305u},
+{16636u,16642u,53309u},{16643u,16643u,53318u},{16644u,16644u,53320u},{16645u,16650u,53322u},
+{16651u,16653u,53329u},{16654u,16656u,53333u},{16657u,16663u,53337u},{16664u,16674u,53345u},
+{16675u,16676u,53358u},{16677u,16679u,53361u},{16680u,16686u,53365u},{16687u,16689u,53374u},
+{16690u,16723u,53378u},{16724u,16725u,53414u},{16726u,16728u,53417u},{16729u,16735u,53421u},
+{16736u,16736u,53430u},{16737u,16737u,53432u},{16738u,16743u,53434u},{16744u,16745u,53442u},
+{16746u,16748u,53445u},{16749u,16754u,53450u},{16755u,16755u,53458u},{16756u,16761u,53462u},
+{16762u,16763u,53470u},{16764u,16766u,53473u},{16767u,16773u,53477u},{16774u,16774u,53486u},
+{16775u,16780u,53490u},{16781u,16800u,53497u},{16801u,16834u,53518u},{16835u,16836u,53554u},
+{16837u,16839u,53557u},{16840u,16840u,53561u},{16841u,16845u,53563u},{16846u,16846u,53570u},
+{16847u,16852u,53574u},{16853u,16854u,53582u},{16855u,16857u,53585u},{16858u,16864u,53589u},
+{16865u,16865u,53598u},{16866u,16866u,53600u},{16867u,16872u,53602u},{16873u,16875u,53609u},
+{16876u,16890u,53613u},{16891u,16897u,53629u},{16898u,16900u,53637u},{16901u,16923u,53641u},
+{16924u,16925u,53666u},{16926u,16928u,53669u},{16929u,16935u,53673u},{16936u,16936u,53682u},
+{16937u,16937u,53684u},{16938u,16941u,53686u},{16942u,16942u,53691u},{16943u,16945u,53693u},
+{16946u,16968u,53697u},{16969u,16995u,53721u},{16996u,16998u,53749u},{16999u,17012u,53753u},
+{17013u,17013u,53768u},{17014u,17019u,53770u},{17020u,17046u,53777u},{17047u,17048u,53806u},
+{17049u,17051u,53809u},{17052u,17058u,53813u},{17059u,17059u,53822u},{17060u,17060u,53824u},
+{17061u,17066u,53826u},{17067u,17085u,53833u},{17086u,17092u,53853u},{17093u,17119u,53861u},
+{17120u,17121u,53890u},{17122u,17124u,53893u},{17125u,17131u,53897u},{17132u,17134u,53906u},
+{17135u,17140u,53910u},{17141u,17143u,53917u},{17144u,17146u,53921u},{17147u,17153u,53925u},
+{17154u,17157u,53933u},{17158u,17163u,53938u},{17164u,17165u,53946u},{17166u,17167u,53949u},
+{17168u,17168u,53953u},{17169u,17173u,53955u},{17174u,17174u,53962u},{17175u,17182u,53964u},
+{17183u,17185u,53973u},{17186u,17188u,53977u},{17189u,17195u,53981u},{17196u,17205u,53990u},
+{17206u,17207u,54002u},{17208u,17210u,54005u},{17211u,17217u,54009u},{17218u,17218u,54018u},
+{17219u,17219u,54020u},{17220u,17225u,54022u},{17226u,17226u,54031u},{17227u,17229u,54033u},
+{17230u,17230u,54037u},{17231u,17235u,54039u},{17236u,17236u,54046u},{17237u,17239u,54050u},
+{17240u,17241u,54054u},{17242u,17243u,54058u},{17244u,17246u,54061u},{17247u,17253u,54065u},
+{17254u,17254u,54074u},{17255u,17260u,54078u},{17261u,17314u,54086u},{17315u,17316u,54142u},
+{17317u,17319u,54145u},{17320u,17326u,54149u},{17327u,17327u,54158u},{17328u,17333u,54162u},
+{17334u,17335u,54170u},{17336u,17338u,54173u},{17339u,17345u,54177u},{17346u,17346u,54186u},
+{17347u,17347u,54188u},{17348u,17353u,54190u},{17354u,17356u,54197u},{17357u,17359u,54201u},
+{17360u,17366u,54205u},{17367u,17368u,54214u},{17369u,17374u,54218u},{17375u,17381u,54225u},
+{17382u,17389u,54233u},{17390u,17390u,54242u},{17391u,17398u,54244u},{17399u,17400u,54254u},
+{17401u,17403u,54257u},{17404u,17410u,54261u},{17411u,17411u,54270u},{17412u,17412u,54272u},
+{17413u,17418u,54274u},{17419u,17438u,54281u},{17439u,17472u,54302u},{17473u,17475u,54337u},
+{17476u,17498u,54341u},{17499u,17501u,54365u},{17502u,17504u,54369u},{17505u,17512u,54373u},
+{17513u,17513u,54382u},{17514u,17521u,54384u},{17522u,17523u,54394u},{17524u,17525u,54397u},
+{17526u,17526u,54401u},{17527u,17531u,54403u},{17532u,17532u,54410u},{17533u,17533u,54412u},
+{17534u,17539u,54414u},{17540u,17559u,54421u},{17560u,17593u,54442u},{17594u,17596u,54477u},
+{17597u,17599u,54481u},{17600u,17606u,54485u},{17607u,17608u,54493u},{17609u,17616u,54496u},
+{17617u,17619u,54505u},{17620u,17622u,54509u},{17623u,17629u,54513u},{17630u,17631u,54521u},
+{17632u,17632u,54524u},{17633u,17638u,54526u},{17639u,17641u,54533u},{17642u,17644u,54537u},
+{17645u,17651u,54541u},{17652u,17652u,54550u},{17653u,17688u,54552u},{17689u,17690u,54590u},
+{17691u,17693u,54593u},{17694u,17700u,54597u},{17701u,17701u,54606u},{17702u,17702u,54608u},
+{17703u,17708u,54610u},{17709u,17710u,54618u},{17711u,17713u,54621u},{17714u,17717u,54625u},
+{17718u,17719u,54630u},{17720u,17720u,54634u},{17721u,17721u,54636u},{17722u,17727u,54638u},
+{17728u,17729u,54646u},{17730u,17732u,54649u},{17733u,17739u,54653u},{17740u,17740u,54662u},
+{17741u,17746u,54666u},{17747u,17766u,54673u},{17767u,17800u,54694u},{17801u,17802u,54730u},
+{17803u,17805u,54733u},{17806u,17806u,54737u},{17807u,17811u,54739u},{17812u,17812u,54746u},
+{17813u,17813u,54748u},{17814u,17819u,54750u},{17820u,17821u,54758u},{17822u,17824u,54761u},
+{17825u,17831u,54765u},{17832u,17832u,54774u},{17833u,17833u,54776u},{17834u,17839u,54778u},
+{17840u,17841u,54786u},{17842u,17844u,54789u},{17845u,17851u,54793u},{17852u,17852u,54802u},
+{17853u,17858u,54806u},{17859u,17861u,54813u},{17862u,17864u,54817u},{17865u,17872u,54821u},
+{17873u,17882u,54830u},{17883u,17884u,54842u},{17885u,17887u,54845u},{17888u,17891u,54849u},
+{17892u,17893u,54854u},{17894u,17894u,54858u},{17895u,17895u,54860u},{17896u,17898u,54862u},
+{17899u,17900u,54866u},{17901u,17902u,54870u},{17903u,17905u,54873u},{17906u,17915u,54877u},
+{17916u,17916u,54888u},{17917u,17922u,54890u},{17923u,17924u,54898u},{17925u,17938u,54901u},
+{17939u,17939u,54916u},{17940u,17945u,54918u},{17946u,17947u,54926u},{17948u,17950u,54929u},
+{17951u,17958u,54933u},{17959u,17959u,54942u},{17960u,17960u,54944u},{17961u,17966u,54946u},
+{17967u,17969u,54953u},{17970u,17972u,54957u},{17973u,17980u,54961u},{17981u,17981u,54970u},
+{17982u,17989u,54972u},{17990u,17991u,54982u},{17992u,17994u,54985u},{17995u,17998u,54989u},
+{17999u,18000u,54994u},{18001u,18002u,54997u},{18003u,18003u,55000u},{18004u,18009u,55002u},
+{18010u,18012u,55009u},{18013u,18015u,55013u},{18016u,18022u,55017u},{18023u,18026u,55025u},
+{18027u,18032u,55030u},{18033u,18034u,55038u},{18035u,18037u,55041u},{18038u,18049u,55045u},
+{18050u,18055u,55058u},{18056u,18057u,55066u},{18058u,18060u,55069u},{18061u,18067u,55073u},
+{18068u,18068u,55082u},{18069u,18069u,55084u},{18070u,18075u,55086u},{18076u,18077u,55094u},
+{18078u,18080u,55097u},{18081u,18087u,55101u},{18088u,18089u,55109u},{18090u,18090u,55112u},
+{18091u,18096u,55114u},{18097u,18098u,55122u},{18099u,18099u,55125u},{18100u,18105u,55130u},
+{18106u,18106u,55138u},{18107u,18107u,55140u},{18108u,18110u,55142u},{18111u,18112u,55146u},
+{18113u,18115u,55149u},{18116u,18118u,55153u},{18119u,18125u,55157u},{18126u,18128u,55166u},
+{18129u,18134u,55170u},{18135u,18136u,55178u},{18137u,18139u,55181u},{18140u,18146u,55185u},
+{18147u,18147u,55194u},{18148u,18148u,55196u},{18149u,18154u,55198u},{18155u,18249u,32u},
+{18250u,18250u,8361u},{18251u,18251u,8208u},{18252u,18252u,169u},{18253u,18253u,8482u},
+{18254u,18254u,8943u},{18255u,18348u,32u},{18349u,18349u,8254u},{18350u,18350u,126u},
+{18351u,18351u,92u},
+};
+
+static const pdf_mrange cmap_Adobe_Korea1_UCS2_mranges[] = {
+{8207u,2u,{40u,40u,0u,0u,0u,0u,0u,0u,}},
+{8208u,2u,{41u,41u,0u,0u,0u,0u,0u,0u,}},
+{8209u,2u,{40u,40u,0u,0u,0u,0u,0u,0u,}},
+{8210u,2u,{41u,41u,0u,0u,0u,0u,0u,0u,}},
+{8282u,2u,{52685u,52685u,0u,0u,0u,0u,0u,0u,}},
+{8285u,2u,{40u,40u,0u,0u,0u,0u,0u,0u,}},
+{8286u,2u,{41u,41u,0u,0u,0u,0u,0u,0u,}},
+{8287u,2u,{40u,40u,0u,0u,0u,0u,0u,0u,}},
+{8288u,2u,{41u,41u,0u,0u,0u,0u,0u,0u,}},
+{8297u,2u,{49u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8298u,2u,{50u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8299u,2u,{51u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8300u,2u,{52u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8301u,2u,{53u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8302u,2u,{54u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8303u,2u,{55u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8304u,2u,{56u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8305u,2u,{57u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8306u,4u,{91u,49u,48u,93u,0u,0u,0u,0u,}},
+{8307u,4u,{91u,49u,49u,93u,0u,0u,0u,0u,}},
+{8308u,4u,{91u,49u,50u,93u,0u,0u,0u,0u,}},
+{8309u,4u,{91u,49u,51u,93u,0u,0u,0u,0u,}},
+{8310u,4u,{91u,49u,52u,93u,0u,0u,0u,0u,}},
+{8311u,4u,{91u,49u,53u,93u,0u,0u,0u,0u,}},
+{8312u,4u,{91u,49u,54u,93u,0u,0u,0u,0u,}},
+{8313u,4u,{91u,49u,55u,93u,0u,0u,0u,0u,}},
+{8314u,4u,{91u,49u,56u,93u,0u,0u,0u,0u,}},
+{8315u,4u,{91u,49u,57u,93u,0u,0u,0u,0u,}},
+{8316u,4u,{91u,50u,48u,93u,0u,0u,0u,0u,}},
+{8322u,2u,{49u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8323u,2u,{50u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8324u,2u,{51u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8325u,2u,{52u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8326u,2u,{53u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8327u,2u,{54u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8328u,2u,{55u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8329u,2u,{56u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8330u,2u,{57u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8331u,4u,{91u,49u,48u,93u,0u,0u,0u,0u,}},
+{8332u,4u,{91u,49u,49u,93u,0u,0u,0u,0u,}},
+{8333u,4u,{91u,49u,50u,93u,0u,0u,0u,0u,}},
+{8334u,4u,{91u,49u,51u,93u,0u,0u,0u,0u,}},
+{8335u,4u,{91u,49u,52u,93u,0u,0u,0u,0u,}},
+{8336u,4u,{91u,49u,53u,93u,0u,0u,0u,0u,}},
+{8337u,4u,{91u,49u,54u,93u,0u,0u,0u,0u,}},
+{8338u,4u,{91u,49u,55u,93u,0u,0u,0u,0u,}},
+{8339u,4u,{91u,49u,56u,93u,0u,0u,0u,0u,}},
+{8340u,4u,{91u,49u,57u,93u,0u,0u,0u,0u,}},
+{8341u,4u,{91u,50u,48u,93u,0u,0u,0u,0u,}},
+{8362u,3u,{40u,65u,41u,0u,0u,0u,0u,0u,}},
+{8363u,3u,{40u,66u,41u,0u,0u,0u,0u,0u,}},
+{8364u,3u,{40u,67u,41u,0u,0u,0u,0u,0u,}},
+{8365u,3u,{40u,68u,41u,0u,0u,0u,0u,0u,}},
+{8366u,3u,{40u,69u,41u,0u,0u,0u,0u,0u,}},
+{8367u,3u,{40u,70u,41u,0u,0u,0u,0u,0u,}},
+{8368u,3u,{40u,71u,41u,0u,0u,0u,0u,0u,}},
+{8369u,3u,{40u,72u,41u,0u,0u,0u,0u,0u,}},
+{8370u,3u,{40u,73u,41u,0u,0u,0u,0u,0u,}},
+{8371u,3u,{40u,74u,41u,0u,0u,0u,0u,0u,}},
+{8372u,3u,{40u,75u,41u,0u,0u,0u,0u,0u,}},
+{8373u,3u,{40u,76u,41u,0u,0u,0u,0u,0u,}},
+{8374u,3u,{40u,77u,41u,0u,0u,0u,0u,0u,}},
+{8375u,3u,{40u,78u,41u,0u,0u,0u,0u,0u,}},
+{8376u,3u,{40u,79u,41u,0u,0u,0u,0u,0u,}},
+{8377u,3u,{40u,80u,41u,0u,0u,0u,0u,0u,}},
+{8378u,3u,{40u,81u,41u,0u,0u,0u,0u,0u,}},
+{8379u,3u,{40u,82u,41u,0u,0u,0u,0u,0u,}},
+{8380u,3u,{40u,83u,41u,0u,0u,0u,0u,0u,}},
+{8381u,3u,{40u,84u,41u,0u,0u,0u,0u,0u,}},
+{8382u,3u,{40u,85u,41u,0u,0u,0u,0u,0u,}},
+{8383u,3u,{40u,86u,41u,0u,0u,0u,0u,0u,}},
+{8384u,3u,{40u,87u,41u,0u,0u,0u,0u,0u,}},
+{8385u,3u,{40u,88u,41u,0u,0u,0u,0u,0u,}},
+{8386u,3u,{40u,89u,41u,0u,0u,0u,0u,0u,}},
+{8387u,3u,{40u,90u,41u,0u,0u,0u,0u,0u,}},
+{8414u,2u,{49u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8415u,2u,{50u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8416u,2u,{51u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8417u,2u,{52u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8418u,2u,{53u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8419u,2u,{54u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8420u,2u,{55u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8421u,2u,{56u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8422u,2u,{57u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8423u,4u,{91u,49u,48u,93u,0u,0u,0u,0u,}},
+{8424u,4u,{91u,49u,49u,93u,0u,0u,0u,0u,}},
+{8425u,4u,{91u,49u,50u,93u,0u,0u,0u,0u,}},
+{8426u,4u,{91u,49u,51u,93u,0u,0u,0u,0u,}},
+{8427u,4u,{91u,49u,52u,93u,0u,0u,0u,0u,}},
+{8428u,4u,{91u,49u,53u,93u,0u,0u,0u,0u,}},
+{8429u,4u,{91u,49u,54u,93u,0u,0u,0u,0u,}},
+{8430u,4u,{91u,49u,55u,93u,0u,0u,0u,0u,}},
+{8431u,4u,{91u,49u,56u,93u,0u,0u,0u,0u,}},
+{8432u,4u,{91u,49u,57u,93u,0u,0u,0u,0u,}},
+{8433u,4u,{91u,50u,48u,93u,0u,0u,0u,0u,}},
+{8434u,2u,{49u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8435u,2u,{50u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8436u,2u,{51u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8437u,2u,{52u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8438u,2u,{53u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8439u,2u,{54u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8440u,2u,{55u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8441u,2u,{56u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8442u,2u,{57u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8443u,4u,{91u,49u,48u,93u,0u,0u,0u,0u,}},
+{8444u,4u,{91u,49u,49u,93u,0u,0u,0u,0u,}},
+{8445u,4u,{91u,49u,50u,93u,0u,0u,0u,0u,}},
+{8446u,4u,{91u,49u,51u,93u,0u,0u,0u,0u,}},
+{8447u,4u,{91u,49u,52u,93u,0u,0u,0u,0u,}},
+{8448u,4u,{91u,49u,53u,93u,0u,0u,0u,0u,}},
+{8449u,4u,{91u,49u,54u,93u,0u,0u,0u,0u,}},
+{8450u,4u,{91u,49u,55u,93u,0u,0u,0u,0u,}},
+{8451u,4u,{91u,49u,56u,93u,0u,0u,0u,0u,}},
+{8452u,4u,{91u,49u,57u,93u,0u,0u,0u,0u,}},
+{8453u,4u,{91u,50u,48u,93u,0u,0u,0u,0u,}},
+{8506u,2u,{48u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8507u,2u,{49u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8508u,2u,{50u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8509u,2u,{51u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8510u,2u,{52u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8511u,2u,{53u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8512u,2u,{54u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8513u,2u,{55u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8514u,2u,{56u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8515u,2u,{57u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8526u,2u,{65u,41u,0u,0u,0u,0u,0u,0u,}},
+{8527u,2u,{66u,41u,0u,0u,0u,0u,0u,0u,}},
+{8528u,2u,{67u,41u,0u,0u,0u,0u,0u,0u,}},
+{8529u,2u,{68u,41u,0u,0u,0u,0u,0u,0u,}},
+{8530u,2u,{69u,41u,0u,0u,0u,0u,0u,0u,}},
+{8531u,2u,{70u,41u,0u,0u,0u,0u,0u,0u,}},
+{8532u,2u,{71u,41u,0u,0u,0u,0u,0u,0u,}},
+{8533u,2u,{72u,41u,0u,0u,0u,0u,0u,0u,}},
+{8534u,2u,{73u,41u,0u,0u,0u,0u,0u,0u,}},
+{8535u,2u,{74u,41u,0u,0u,0u,0u,0u,0u,}},
+{8536u,2u,{75u,41u,0u,0u,0u,0u,0u,0u,}},
+{8537u,2u,{76u,41u,0u,0u,0u,0u,0u,0u,}},
+{8538u,2u,{77u,41u,0u,0u,0u,0u,0u,0u,}},
+{8539u,2u,{78u,41u,0u,0u,0u,0u,0u,0u,}},
+{8540u,2u,{79u,41u,0u,0u,0u,0u,0u,0u,}},
+{8541u,2u,{80u,41u,0u,0u,0u,0u,0u,0u,}},
+{8542u,2u,{81u,41u,0u,0u,0u,0u,0u,0u,}},
+{8543u,2u,{82u,41u,0u,0u,0u,0u,0u,0u,}},
+{8544u,2u,{83u,41u,0u,0u,0u,0u,0u,0u,}},
+{8545u,2u,{84u,41u,0u,0u,0u,0u,0u,0u,}},
+{8546u,2u,{85u,41u,0u,0u,0u,0u,0u,0u,}},
+{8547u,2u,{86u,41u,0u,0u,0u,0u,0u,0u,}},
+{8548u,2u,{87u,41u,0u,0u,0u,0u,0u,0u,}},
+{8549u,2u,{88u,41u,0u,0u,0u,0u,0u,0u,}},
+{8550u,2u,{89u,41u,0u,0u,0u,0u,0u,0u,}},
+{8551u,2u,{90u,41u,0u,0u,0u,0u,0u,0u,}},
+{8552u,2u,{97u,41u,0u,0u,0u,0u,0u,0u,}},
+{8553u,2u,{98u,41u,0u,0u,0u,0u,0u,0u,}},
+{8554u,2u,{99u,41u,0u,0u,0u,0u,0u,0u,}},
+{8555u,2u,{100u,41u,0u,0u,0u,0u,0u,0u,}},
+{8556u,2u,{101u,41u,0u,0u,0u,0u,0u,0u,}},
+{8557u,2u,{102u,41u,0u,0u,0u,0u,0u,0u,}},
+{8558u,2u,{103u,41u,0u,0u,0u,0u,0u,0u,}},
+{8559u,2u,{104u,41u,0u,0u,0u,0u,0u,0u,}},
+{8560u,2u,{105u,41u,0u,0u,0u,0u,0u,0u,}},
+{8561u,2u,{106u,41u,0u,0u,0u,0u,0u,0u,}},
+{8562u,2u,{107u,41u,0u,0u,0u,0u,0u,0u,}},
+{8563u,2u,{108u,41u,0u,0u,0u,0u,0u,0u,}},
+{8564u,2u,{109u,41u,0u,0u,0u,0u,0u,0u,}},
+{8565u,2u,{110u,41u,0u,0u,0u,0u,0u,0u,}},
+{8566u,2u,{111u,41u,0u,0u,0u,0u,0u,0u,}},
+{8567u,2u,{112u,41u,0u,0u,0u,0u,0u,0u,}},
+{8568u,2u,{113u,41u,0u,0u,0u,0u,0u,0u,}},
+{8569u,2u,{114u,41u,0u,0u,0u,0u,0u,0u,}},
+{8570u,2u,{115u,41u,0u,0u,0u,0u,0u,0u,}},
+{8571u,2u,{116u,41u,0u,0u,0u,0u,0u,0u,}},
+{8572u,2u,{117u,41u,0u,0u,0u,0u,0u,0u,}},
+{8573u,2u,{118u,41u,0u,0u,0u,0u,0u,0u,}},
+{8574u,2u,{119u,41u,0u,0u,0u,0u,0u,0u,}},
+{8575u,2u,{120u,41u,0u,0u,0u,0u,0u,0u,}},
+{8576u,2u,{121u,41u,0u,0u,0u,0u,0u,0u,}},
+{8577u,2u,{122u,41u,0u,0u,0u,0u,0u,0u,}},
+{8583u,4u,{40u,50u,55u,41u,0u,0u,0u,0u,}},
+{8584u,4u,{40u,50u,56u,41u,0u,0u,0u,0u,}},
+{8585u,4u,{40u,50u,57u,41u,0u,0u,0u,0u,}},
+{8586u,4u,{40u,51u,48u,41u,0u,0u,0u,0u,}},
+{8590u,2u,{8224u,8224u,0u,0u,0u,0u,0u,0u,}},
+{8591u,2u,{8225u,8225u,0u,0u,0u,0u,0u,0u,}},
+{8592u,3u,{8224u,8224u,8224u,0u,0u,0u,0u,0u,}},
+{8608u,2u,{9632u,8415u,0u,0u,0u,0u,0u,0u,}},
+{8609u,2u,{9671u,8415u,0u,0u,0u,0u,0u,0u,}},
+{8611u,2u,{9633u,8415u,0u,0u,0u,0u,0u,0u,}},
+{8620u,2u,{9671u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8622u,2u,{9633u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8623u,2u,{9670u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8628u,2u,{9651u,8413u,0u,0u,0u,0u,0u,0u,}},
+{8629u,2u,{9650u,8413u,0u,0u,0u,0u,0u,0u,}},
+{8693u,4u,{40u,50u,49u,41u,0u,0u,0u,0u,}},
+{8694u,4u,{40u,50u,50u,41u,0u,0u,0u,0u,}},
+{8695u,4u,{40u,50u,51u,41u,0u,0u,0u,0u,}},
+{8696u,4u,{40u,50u,52u,41u,0u,0u,0u,0u,}},
+{8697u,4u,{40u,50u,53u,41u,0u,0u,0u,0u,}},
+{8698u,4u,{40u,50u,54u,41u,0u,0u,0u,0u,}},
+{8730u,2u,{247u,8413u,0u,0u,0u,0u,0u,0u,}},
+{8743u,2u,{8869u,824u,0u,0u,0u,0u,0u,0u,}},
+{8764u,2u,{33u,63u,0u,0u,0u,0u,0u,0u,}},
+{8766u,2u,{63u,63u,0u,0u,0u,0u,0u,0u,}},
+{8796u,4u,{40u,50u,49u,41u,0u,0u,0u,0u,}},
+{8797u,4u,{40u,50u,50u,41u,0u,0u,0u,0u,}},
+{8798u,4u,{40u,50u,51u,41u,0u,0u,0u,0u,}},
+{8799u,4u,{40u,50u,52u,41u,0u,0u,0u,0u,}},
+{8800u,4u,{40u,50u,53u,41u,0u,0u,0u,0u,}},
+{8801u,4u,{40u,50u,54u,41u,0u,0u,0u,0u,}},
+{8802u,4u,{40u,50u,55u,41u,0u,0u,0u,0u,}},
+{8803u,4u,{40u,50u,56u,41u,0u,0u,0u,0u,}},
+{8804u,4u,{40u,50u,57u,41u,0u,0u,0u,0u,}},
+{8805u,4u,{40u,51u,48u,41u,0u,0u,0u,0u,}},
+{8898u,2u,{65u,46u,0u,0u,0u,0u,0u,0u,}},
+{8899u,2u,{66u,46u,0u,0u,0u,0u,0u,0u,}},
+{8900u,2u,{67u,46u,0u,0u,0u,0u,0u,0u,}},
+{8901u,2u,{68u,46u,0u,0u,0u,0u,0u,0u,}},
+{8902u,2u,{69u,46u,0u,0u,0u,0u,0u,0u,}},
+{8903u,2u,{70u,46u,0u,0u,0u,0u,0u,0u,}},
+{8904u,2u,{71u,46u,0u,0u,0u,0u,0u,0u,}},
+{8905u,2u,{72u,46u,0u,0u,0u,0u,0u,0u,}},
+{8906u,2u,{73u,46u,0u,0u,0u,0u,0u,0u,}},
+{8907u,2u,{74u,46u,0u,0u,0u,0u,0u,0u,}},
+{8908u,2u,{75u,46u,0u,0u,0u,0u,0u,0u,}},
+{8909u,2u,{76u,46u,0u,0u,0u,0u,0u,0u,}},
+{8910u,2u,{77u,46u,0u,0u,0u,0u,0u,0u,}},
+{8911u,2u,{78u,46u,0u,0u,0u,0u,0u,0u,}},
+{8912u,2u,{79u,46u,0u,0u,0u,0u,0u,0u,}},
+{8913u,2u,{80u,46u,0u,0u,0u,0u,0u,0u,}},
+{8914u,2u,{81u,46u,0u,0u,0u,0u,0u,0u,}},
+{8915u,2u,{82u,46u,0u,0u,0u,0u,0u,0u,}},
+{8916u,2u,{83u,46u,0u,0u,0u,0u,0u,0u,}},
+{8917u,2u,{84u,46u,0u,0u,0u,0u,0u,0u,}},
+{8918u,2u,{85u,46u,0u,0u,0u,0u,0u,0u,}},
+{8919u,2u,{86u,46u,0u,0u,0u,0u,0u,0u,}},
+{8920u,2u,{87u,46u,0u,0u,0u,0u,0u,0u,}},
+{8921u,2u,{88u,46u,0u,0u,0u,0u,0u,0u,}},
+{8922u,2u,{89u,46u,0u,0u,0u,0u,0u,0u,}},
+{8923u,2u,{90u,46u,0u,0u,0u,0u,0u,0u,}},
+{8924u,2u,{97u,46u,0u,0u,0u,0u,0u,0u,}},
+{8925u,2u,{98u,46u,0u,0u,0u,0u,0u,0u,}},
+{8926u,2u,{99u,46u,0u,0u,0u,0u,0u,0u,}},
+{8927u,2u,{100u,46u,0u,0u,0u,0u,0u,0u,}},
+{8928u,2u,{101u,46u,0u,0u,0u,0u,0u,0u,}},
+{8929u,2u,{102u,46u,0u,0u,0u,0u,0u,0u,}},
+{8930u,2u,{103u,46u,0u,0u,0u,0u,0u,0u,}},
+{8931u,2u,{104u,46u,0u,0u,0u,0u,0u,0u,}},
+{8932u,2u,{105u,46u,0u,0u,0u,0u,0u,0u,}},
+{8933u,2u,{106u,46u,0u,0u,0u,0u,0u,0u,}},
+{8934u,2u,{107u,46u,0u,0u,0u,0u,0u,0u,}},
+{8935u,2u,{108u,46u,0u,0u,0u,0u,0u,0u,}},
+{8936u,2u,{109u,46u,0u,0u,0u,0u,0u,0u,}},
+{8937u,2u,{110u,46u,0u,0u,0u,0u,0u,0u,}},
+{8938u,2u,{111u,46u,0u,0u,0u,0u,0u,0u,}},
+{8939u,2u,{112u,46u,0u,0u,0u,0u,0u,0u,}},
+{8940u,2u,{113u,46u,0u,0u,0u,0u,0u,0u,}},
+{8941u,2u,{114u,46u,0u,0u,0u,0u,0u,0u,}},
+{8942u,2u,{115u,46u,0u,0u,0u,0u,0u,0u,}},
+{8943u,2u,{116u,46u,0u,0u,0u,0u,0u,0u,}},
+{8944u,2u,{117u,46u,0u,0u,0u,0u,0u,0u,}},
+{8945u,2u,{118u,46u,0u,0u,0u,0u,0u,0u,}},
+{8946u,2u,{119u,46u,0u,0u,0u,0u,0u,0u,}},
+{8947u,2u,{120u,46u,0u,0u,0u,0u,0u,0u,}},
+{8948u,2u,{121u,46u,0u,0u,0u,0u,0u,0u,}},
+{8949u,2u,{122u,46u,0u,0u,0u,0u,0u,0u,}},
+{8950u,2u,{50868u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8951u,2u,{45813u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8952u,2u,{51452u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8953u,2u,{47749u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8954u,2u,{45824u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8955u,2u,{54805u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8956u,2u,{48512u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8957u,2u,{51204u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8958u,2u,{51217u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8959u,2u,{49688u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8960u,2u,{46041u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8961u,2u,{48708u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8962u,2u,{48152u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8963u,2u,{51088u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8964u,2u,{53440u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8965u,2u,{44048u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8966u,2u,{50557u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8967u,2u,{51064u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8968u,2u,{46907u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8969u,2u,{21360u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8970u,2u,{35387u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8971u,2u,{50696u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8972u,2u,{24863u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8973u,2u,{20896u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8974u,2u,{31572u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8975u,2u,{20195u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8976u,2u,{38957u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8977u,2u,{21205u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8978u,2u,{21517u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8979u,2u,{30446u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8980u,2u,{21453u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8981u,2u,{35036u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8982u,2u,{26412u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8983u,2u,{21103u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8984u,2u,{24207u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8985u,2u,{36899u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8986u,2u,{24433u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8987u,2u,{20363u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8988u,2u,{28304u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8989u,2u,{23376u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8990u,2u,{21069u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8991u,2u,{31680u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8992u,2u,{25509u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8993u,2u,{21161u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8994u,2u,{25351u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8995u,2u,{20182u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8996u,2u,{27966u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8997u,2u,{24418u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8998u,2u,{51312u,8414u,0u,0u,0u,0u,0u,0u,}},
+{8999u,2u,{47928u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9000u,2u,{45813u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9001u,2u,{51452u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9002u,2u,{46907u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9003u,2u,{35387u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9004u,2u,{44368u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9005u,2u,{50669u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9006u,2u,{51020u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9007u,2u,{51221u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9008u,2u,{54644u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9009u,2u,{50696u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9010u,2u,{51316u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9011u,2u,{46972u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9012u,2u,{47560u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9013u,2u,{48148u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9014u,2u,{49324u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9015u,2u,{50500u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9016u,2u,{51088u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9017u,2u,{52264u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9018u,2u,{52852u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9019u,2u,{53440u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9020u,2u,{54028u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9021u,2u,{45458u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9022u,2u,{45230u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9023u,2u,{47749u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9024u,2u,{45824u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9025u,2u,{54805u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9026u,2u,{48512u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9027u,2u,{51204u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9028u,2u,{51217u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9029u,2u,{49688u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9030u,2u,{46041u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9031u,2u,{48708u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9032u,2u,{44172u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9033u,2u,{48152u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9034u,2u,{49549u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9035u,2u,{51064u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9036u,2u,{48376u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9037u,2u,{50557u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9038u,2u,{49689u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9039u,2u,{50976u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9040u,2u,{44288u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9041u,2u,{20896u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9047u,4u,{40u,50u,49u,41u,0u,0u,0u,0u,}},
+{9048u,4u,{40u,50u,50u,41u,0u,0u,0u,0u,}},
+{9049u,4u,{40u,50u,51u,41u,0u,0u,0u,0u,}},
+{9050u,4u,{40u,50u,52u,41u,0u,0u,0u,0u,}},
+{9051u,4u,{40u,50u,53u,41u,0u,0u,0u,0u,}},
+{9052u,4u,{40u,50u,54u,41u,0u,0u,0u,0u,}},
+{9053u,2u,{51312u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9054u,2u,{44397u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9055u,2u,{44048u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9056u,2u,{21360u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9057u,2u,{34915u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9058u,2u,{26411u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9059u,2u,{44144u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9060u,2u,{45813u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9061u,2u,{48320u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9062u,2u,{49345u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9063u,2u,{49468u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9064u,2u,{49888u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9065u,2u,{50668u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9066u,2u,{50696u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9067u,2u,{50896u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9068u,2u,{51089u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9069u,2u,{51456u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9070u,2u,{53433u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9071u,2u,{50808u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9072u,2u,{54876u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9073u,2u,{44036u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9074u,2u,{44057u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9075u,2u,{49892u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9076u,2u,{24863u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9077u,2u,{24931u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9078u,2u,{20195u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9079u,2u,{21205u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9081u,2u,{21453u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9082u,2u,{21103u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9083u,2u,{33258u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9084u,2u,{21069u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9085u,2u,{38651u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9086u,2u,{25509u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9087u,2u,{21161u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9088u,2u,{27880u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9089u,2u,{21443u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9090u,2u,{26412u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9091u,2u,{26032u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9092u,2u,{29694u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9093u,2u,{24418u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9094u,2u,{38291u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9095u,2u,{22283u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9097u,2u,{20182u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9098u,2u,{48736u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9099u,2u,{49884u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9100u,2u,{51077u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9101u,2u,{51004u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9102u,2u,{51020u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9103u,2u,{51649u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9104u,2u,{54364u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9105u,2u,{44032u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9106u,2u,{45208u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9107u,2u,{45796u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9108u,2u,{54616u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9109u,2u,{47560u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9110u,2u,{48148u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9111u,2u,{49324u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9112u,2u,{50500u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9113u,2u,{51088u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9114u,2u,{52264u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9115u,2u,{52852u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9116u,2u,{53440u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9117u,2u,{54028u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9118u,2u,{54616u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9119u,2u,{48708u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9120u,2u,{45813u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9121u,2u,{48736u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9122u,2u,{48376u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9123u,2u,{45800u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9124u,2u,{49468u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9125u,2u,{49884u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9126u,2u,{50668u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9127u,2u,{50696u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9128u,2u,{51004u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9129u,2u,{51020u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9130u,2u,{51077u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9131u,2u,{51228u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9132u,2u,{51316u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9133u,2u,{51456u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9134u,2u,{54364u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9135u,2u,{54644u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9136u,2u,{45712u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9137u,2u,{45458u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9138u,2u,{45230u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9139u,2u,{48152u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9140u,2u,{44032u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9141u,2u,{45208u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9142u,2u,{45796u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9143u,2u,{46972u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9144u,2u,{50808u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9145u,4u,{40u,50u,55u,41u,0u,0u,0u,0u,}},
+{9146u,4u,{40u,50u,56u,41u,0u,0u,0u,0u,}},
+{9147u,4u,{40u,50u,57u,41u,0u,0u,0u,0u,}},
+{9148u,4u,{40u,51u,48u,41u,0u,0u,0u,0u,}},
+{9226u,2u,{45800u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9227u,2u,{52280u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9228u,2u,{49548u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9229u,2u,{51473u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9230u,2u,{51068u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9231u,2u,{51060u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9232u,2u,{55092u,8413u,0u,0u,0u,0u,0u,0u,}},
+{9233u,2u,{49u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9234u,2u,{50u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9235u,2u,{51u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9236u,2u,{52u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9237u,2u,{53u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9238u,2u,{54u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9239u,2u,{55u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9240u,2u,{56u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9241u,2u,{57u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9242u,4u,{91u,49u,48u,93u,0u,0u,0u,0u,}},
+{9243u,4u,{91u,49u,49u,93u,0u,0u,0u,0u,}},
+{9244u,4u,{91u,49u,50u,93u,0u,0u,0u,0u,}},
+{9245u,4u,{91u,49u,51u,93u,0u,0u,0u,0u,}},
+{9246u,4u,{91u,49u,52u,93u,0u,0u,0u,0u,}},
+{9247u,4u,{91u,49u,53u,93u,0u,0u,0u,0u,}},
+{9248u,4u,{91u,49u,54u,93u,0u,0u,0u,0u,}},
+{9249u,4u,{91u,49u,55u,93u,0u,0u,0u,0u,}},
+{9250u,4u,{91u,49u,56u,93u,0u,0u,0u,0u,}},
+{9251u,4u,{91u,49u,57u,93u,0u,0u,0u,0u,}},
+{9252u,4u,{91u,50u,48u,93u,0u,0u,0u,0u,}},
+{9253u,2u,{19968u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9254u,2u,{20108u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9255u,2u,{19977u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9256u,2u,{22235u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9257u,2u,{20116u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9258u,2u,{20845u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9259u,2u,{19971u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9260u,2u,{20843u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9261u,2u,{20061u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9262u,2u,{21313u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9263u,4u,{91u,21313u,19968u,93u,0u,0u,0u,0u,}},
+{9264u,4u,{91u,21313u,20108u,93u,0u,0u,0u,0u,}},
+{9265u,4u,{91u,21313u,19977u,93u,0u,0u,0u,0u,}},
+{9266u,4u,{91u,21313u,22235u,93u,0u,0u,0u,0u,}},
+{9267u,4u,{91u,21313u,20116u,93u,0u,0u,0u,0u,}},
+{9268u,4u,{91u,21313u,20845u,93u,0u,0u,0u,0u,}},
+{9269u,4u,{91u,21313u,19971u,93u,0u,0u,0u,0u,}},
+{9270u,4u,{91u,21313u,20843u,93u,0u,0u,0u,0u,}},
+{9271u,4u,{91u,21313u,20061u,93u,0u,0u,0u,0u,}},
+{9272u,4u,{91u,20108u,21313u,93u,0u,0u,0u,0u,}},
+{9273u,2u,{19968u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9274u,2u,{20108u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9275u,2u,{19977u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9276u,2u,{22235u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9277u,2u,{20116u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9278u,2u,{20845u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9279u,2u,{19971u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9280u,2u,{20843u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9281u,2u,{20061u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9282u,2u,{21313u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9283u,4u,{91u,21313u,19968u,93u,0u,0u,0u,0u,}},
+{9284u,4u,{91u,21313u,20108u,93u,0u,0u,0u,0u,}},
+{9285u,4u,{91u,21313u,19977u,93u,0u,0u,0u,0u,}},
+{9286u,4u,{91u,21313u,22235u,93u,0u,0u,0u,0u,}},
+{9287u,4u,{91u,21313u,20116u,93u,0u,0u,0u,0u,}},
+{9288u,4u,{91u,21313u,20845u,93u,0u,0u,0u,0u,}},
+{9289u,4u,{91u,21313u,19971u,93u,0u,0u,0u,0u,}},
+{9290u,4u,{91u,21313u,20843u,93u,0u,0u,0u,0u,}},
+{9291u,4u,{91u,21313u,20061u,93u,0u,0u,0u,0u,}},
+{9292u,4u,{91u,20108u,21313u,93u,0u,0u,0u,0u,}},
+{9293u,2u,{26085u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9294u,2u,{26376u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9295u,2u,{28779u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9296u,2u,{27700u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9297u,2u,{26408u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9298u,2u,{37329u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9299u,2u,{22303u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9307u,2u,{26085u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9308u,2u,{26376u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9309u,2u,{28779u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9310u,2u,{27700u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9311u,2u,{26408u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9312u,2u,{37329u,8414u,0u,0u,0u,0u,0u,0u,}},
+{9313u,2u,{22303u,8414u,0u,0u,0u,0u,0u,0u,}},
+};
+
+static pdf_cmap cmap_Adobe_Korea1_UCS2 = {
+	{-1, pdf_free_cmap_imp}, "Adobe-Korea1-UCS2", "", 0, 0, 1,
+	{ {2,0u,65535u}, },
+	8353, 8353, (pdf_range*) cmap_Adobe_Korea1_UCS2_ranges,
+	0, 0, NULL,
+	537, 537, (pdf_mrange*) cmap_Adobe_Korea1_UCS2_mranges,
+};
+
+/* KSC-EUC-H */
+
+static const pdf_range cmap_KSC_EUC_H_ranges[] = {
+{32u,126u,8094u},{41377u,41470u,101u},{41633u,41701u,195u},{41889u,41982u,264u},
+{42145u,42195u,358u},{42197u,42238u,409u},{42401u,42410u,451u},{42416u,42425u,461u},
+{42433u,42456u,471u},{42465u,42488u,495u},{42657u,42724u,519u},{42913u,42991u,587u},
+{43169u,43172u,666u},{43174u,43174u,670u},{43176u,43183u,671u},{43185u,43262u,679u},
+{43425u,43518u,757u},{43681u,43763u,851u},{43937u,44022u,934u},{44193u,44225u,1020u},
+{44241u,44273u,1053u},{45217u,45310u,1086u},{45473u,45566u,1180u},{45729u,45822u,1274u},
+{45985u,46078u,1368u},{46241u,46334u,1462u},{46497u,46590u,1556u},{46753u,46846u,1650u},
+{47009u,47102u,1744u},{47265u,47358u,1838u},{47521u,47614u,1932u},{47777u,47870u,2026u},
+{48033u,48126u,2120u},{48289u,48382u,2214u},{48545u,48638u,2308u},{48801u,48894u,2402u},
+{49057u,49150u,2496u},{49313u,49406u,2590u},{49569u,49662u,2684u},{49825u,49918u,2778u},
+{50081u,50174u,2872u},{50337u,50430u,2966u},{50593u,50686u,3060u},{50849u,50942u,3154u},
+{51105u,51198u,3248u},{51361u,51454u,3342u},{51873u,51966u,3436u},{52129u,52175u,3530u},
+{52176u,52176u,4116u},{52177u,52181u,3577u},{52182u,52182u,3678u},{52183u,52198u,3582u},
+{52199u,52199u,7053u},{52200u,52222u,3598u},{52385u,52478u,3621u},{52641u,52686u,3715u},
+{52687u,52687u,3460u},{52688u,52711u,3761u},{52712u,52712u,7900u},{52713u,52734u,3785u},
+{52897u,52908u,3807u},{52909u,52909u,3802u},{52910u,52990u,3819u},{53153u,53242u,3900u},
+{53243u,53243u,3902u},{53244u,53246u,3990u},{53409u,53409u,3993u},{53410u,53410u,3946u},
+{53411u,53431u,3994u},{53432u,53432u,3946u},{53433u,53455u,4015u},{53456u,53456u,3708u},
+{53457u,53468u,4038u},{53469u,53469u,4131u},{53470u,53502u,4050u},{53665u,53715u,4083u},
+{53716u,53716u,4374u},{53717u,53717u,4156u},{53718u,53719u,4134u},{53720u,53720u,4375u},
+{53721u,53722u,4136u},{53723u,53728u,4376u},{53729u,53729u,4138u},{53730u,53730u,5800u},
+{53731u,53733u,4382u},{53734u,53734u,4386u},{53735u,53735u,4139u},{53736u,53739u,4387u},
+{53740u,53740u,4140u},{53741u,53741u,4391u},{53742u,53742u,4141u},{53743u,53744u,4394u},
+{53745u,53745u,4142u},{53746u,53746u,4396u},{53747u,53749u,4143u},{53750u,53750u,4399u},
+{53751u,53753u,4146u},{53754u,53754u,4403u},{53755u,53755u,4149u},{53756u,53757u,4406u},
+{53758u,53758u,4409u},{53921u,53921u,4150u},{53922u,53923u,4410u},{53924u,53926u,4151u},
+{53927u,53930u,4412u},{53931u,53931u,4419u},{53932u,53932u,4154u},{53933u,53933u,4420u},
+{53934u,53937u,4155u},{53938u,53938u,4424u},{53939u,53949u,4159u},{53950u,53950u,4511u},
+{53951u,53953u,4170u},{53954u,53955u,4513u},{53956u,53956u,4517u},{53957u,53957u,4173u},
+{53958u,53962u,4518u},{53963u,53963u,4524u},{53964u,53964u,4174u},{53965u,53966u,4525u},
+{53967u,53972u,4528u},{53973u,53975u,4535u},{53976u,53976u,4175u},{53977u,53978u,4541u},
+{53979u,53981u,4176u},{53982u,53983u,4545u},{53984u,53984u,4179u},{53985u,53985u,4547u},
+{53986u,53986u,4550u},{53987u,53987u,4180u},{53988u,53988u,4564u},{53989u,53992u,4566u},
+{53993u,53994u,4571u},{53995u,53995u,4576u},{53996u,53999u,4181u},{54000u,54003u,4604u},
+{54004u,54005u,4609u},{54006u,54006u,4185u},{54007u,54008u,4611u},{54009u,54014u,4186u},
+{54177u,54270u,4192u},{54433u,54501u,4286u},{54502u,54502u,4318u},{54503u,54523u,4355u},
+{54524u,54524u,4136u},{54525u,54526u,4376u},{54689u,54692u,4378u},{54693u,54693u,5800u},
+{54694u,54698u,4382u},{54699u,54699u,4139u},{54700u,54701u,4387u},{54702u,54702u,4192u},
+{54703u,54782u,4389u},{54945u,54967u,4469u},{54968u,54968u,4167u},{54969u,54988u,4492u},
+{54989u,54989u,4172u},{54990u,55038u,4512u},{55201u,55242u,4561u},{55243u,55243u,5552u},
+{55244u,55267u,4603u},{55268u,55268u,6424u},{55269u,55294u,4627u},{55457u,55550u,4653u},
+{55713u,55806u,4747u},{55969u,56062u,4841u},{56225u,56260u,4935u},{56261u,56261u,5151u},
+{56262u,56291u,4971u},{56292u,56292u,4922u},{56293u,56318u,5001u},{56481u,56484u,5027u},
+{56485u,56485u,7518u},{56486u,56574u,5031u},{56737u,56740u,5120u},{56741u,56741u,5079u},
+{56742u,56788u,5124u},{56789u,56789u,5109u},{56790u,56819u,5171u},{56820u,56820u,7607u},
+{56821u,56830u,5201u},{56993u,57083u,5211u},{57084u,57084u,5584u},{57085u,57085u,5302u},
+{57086u,57086u,5367u},{57249u,57266u,5303u},{57267u,57267u,7083u},{57268u,57312u,5321u},
+{57313u,57313u,5362u},{57314u,57319u,5366u},{57320u,57320u,5485u},{57321u,57342u,5372u},
+{57505u,57584u,5394u},{57585u,57585u,6001u},{57586u,57598u,5474u},{57761u,57772u,5487u},
+{57773u,57773u,5460u},{57774u,57836u,5499u},{57837u,57837u,5317u},{57838u,57854u,5562u},
+{58017u,58110u,5579u},{58273u,58356u,5673u},{58357u,58357u,7009u},{58358u,58366u,5757u},
+{58529u,58529u,7370u},{58530u,58536u,5766u},{58537u,58537u,5678u},{58538u,58622u,5773u},
+{58785u,58797u,5858u},{58798u,58798u,5874u},{58799u,58800u,5871u},{58801u,58802u,4425u},
+{58803u,58808u,5873u},{58809u,58809u,4427u},{58810u,58810u,5879u},{58811u,58812u,4429u},
+{58813u,58819u,5880u},{58820u,58820u,4431u},{58821u,58829u,5887u},{58830u,58830u,4435u},
+{58831u,58831u,5896u},{58832u,58832u,4436u},{58833u,58833u,5897u},{58834u,58834u,4437u},
+{58835u,58837u,5898u},{58838u,58838u,4439u},{58839u,58873u,5901u},{58874u,58875u,4442u},
+{58876u,58876u,4159u},{58877u,58877u,5936u},{58878u,58878u,4444u},{59041u,59041u,4447u},
+{59042u,59043u,5937u},{59044u,59044u,4449u},{59045u,59046u,5939u},{59047u,59047u,4450u},
+{59048u,59052u,5941u},{59053u,59053u,4453u},{59054u,59054u,5946u},{59055u,59057u,4455u},
+{59058u,59058u,5947u},{59059u,59059u,4458u},{59060u,59062u,5948u},{59063u,59064u,4459u},
+{59065u,59067u,5951u},{59068u,59068u,4463u},{59069u,59075u,5954u},{59076u,59076u,4160u},
+{59077u,59077u,5961u},{59078u,59079u,4465u},{59080u,59081u,5962u},{59082u,59082u,4161u},
+{59083u,59089u,5964u},{59090u,59090u,4468u},{59091u,59093u,5971u},{59094u,59094u,4469u},
+{59095u,59096u,5974u},{59097u,59097u,4470u},{59098u,59099u,5976u},{59100u,59100u,4162u},
+{59101u,59102u,5978u},{59103u,59103u,4471u},{59104u,59104u,5980u},{59105u,59105u,4472u},
+{59106u,59107u,5981u},{59108u,59108u,4474u},{59109u,59109u,4473u},{59110u,59110u,4475u},
+{59111u,59111u,5983u},{59112u,59112u,4476u},{59113u,59113u,5984u},{59114u,59115u,4478u},
+{59116u,59116u,6447u},{59117u,59118u,5985u},{59119u,59119u,4481u},{59120u,59120u,5987u},
+{59121u,59121u,4482u},{59122u,59122u,5460u},{59123u,59124u,5988u},{59125u,59125u,4483u},
+{59126u,59126u,4163u},{59127u,59127u,4166u},{59128u,59128u,5990u},{59129u,59129u,4485u},
+{59130u,59134u,5991u},{59297u,59297u,4487u},{59298u,59301u,5996u},{59302u,59302u,4488u},
+{59303u,59304u,6000u},{59305u,59305u,4489u},{59306u,59306u,4491u},{59307u,59307u,6002u},
+{59308u,59308u,4167u},{59309u,59309u,4493u},{59310u,59311u,6003u},{59312u,59312u,4494u},
+{59313u,59326u,6005u},{59327u,59327u,4495u},{59328u,59328u,6019u},{59329u,59329u,7783u},
+{59330u,59333u,6020u},{59334u,59334u,4497u},{59335u,59335u,4499u},{59336u,59338u,6024u},
+{59339u,59339u,4501u},{59340u,59340u,6027u},{59341u,59341u,4502u},{59342u,59342u,6028u},
+{59343u,59344u,4503u},{59345u,59346u,6029u},{59347u,59347u,4506u},{59348u,59358u,6031u},
+{59359u,59359u,4508u},{59360u,59363u,6042u},{59364u,59364u,4509u},{59365u,59365u,6046u},
+{59366u,59366u,4510u},{59367u,59382u,6047u},{59383u,59383u,5797u},{59384u,59390u,6063u},
+{59553u,59622u,6070u},{59623u,59624u,4551u},{59625u,59631u,6140u},{59632u,59632u,4553u},
+{59633u,59633u,4180u},{59634u,59638u,6147u},{59639u,59639u,4555u},{59640u,59640u,6152u},
+{59641u,59641u,5800u},{59642u,59642u,6153u},{59643u,59643u,4556u},{59644u,59645u,6154u},
+{59646u,59646u,4557u},{59809u,59814u,6156u},{59815u,59815u,4560u},{59816u,59819u,6162u},
+{59820u,59820u,4561u},{59821u,59851u,6166u},{59852u,59852u,4563u},{59853u,59894u,6197u},
+{59895u,59895u,7988u},{59896u,59902u,6239u},{60065u,60096u,6246u},{60097u,60097u,6123u},
+{60098u,60132u,6278u},{60133u,60133u,4577u},{60134u,60147u,6313u},{60148u,60148u,4183u},
+{60149u,60150u,6327u},{60151u,60151u,4579u},{60152u,60155u,6329u},{60156u,60156u,4581u},
+{60157u,60157u,6333u},{60158u,60158u,4582u},{60321u,60323u,6334u},{60324u,60324u,4584u},
+{60325u,60326u,6337u},{60327u,60327u,4586u},{60328u,60328u,6339u},{60329u,60329u,4588u},
+{60330u,60330u,4184u},{60331u,60345u,6340u},{60346u,60347u,4590u},{60348u,60348u,6355u},
+{60349u,60349u,4592u},{60350u,60352u,6356u},{60353u,60353u,4593u},{60354u,60354u,4595u},
+{60355u,60357u,6359u},{60358u,60359u,4596u},{60360u,60363u,6362u},{60364u,60364u,4599u},
+{60365u,60366u,6366u},{60367u,60369u,4600u},{60370u,60370u,5552u},{60371u,60375u,6368u},
+{60376u,60376u,4603u},{60377u,60414u,6373u},{60577u,60581u,6411u},{60582u,60582u,4614u},
+{60583u,60583u,4616u},{60584u,60585u,6416u},{60586u,60586u,4618u},{60587u,60590u,6418u},
+{60591u,60591u,5950u},{60592u,60593u,4620u},{60594u,60594u,4187u},{60595u,60596u,6422u},
+{60597u,60597u,4625u},{60598u,60599u,6424u},{60600u,60600u,4627u},{60601u,60601u,6426u},
+{60602u,60602u,4629u},{60603u,60607u,6427u},{60608u,60609u,4632u},{60610u,60612u,6432u},
+{60613u,60613u,4634u},{60614u,60614u,4636u},{60615u,60616u,6435u},{60617u,60618u,4188u},
+{60619u,60628u,6437u},{60629u,60629u,4638u},{60630u,60636u,6447u},{60637u,60638u,4640u},
+{60639u,60640u,6454u},{60641u,60641u,4642u},{60642u,60643u,6456u},{60644u,60644u,4644u},
+{60645u,60646u,6458u},{60647u,60648u,4645u},{60649u,60662u,6460u},{60663u,60664u,4647u},
+{60665u,60665u,6474u},{60666u,60666u,4650u},{60667u,60670u,6475u},{60833u,60835u,4653u},
+{60836u,60909u,6479u},{60910u,60910u,5351u},{60911u,60926u,6553u},{61089u,61146u,6569u},
+{61147u,61147u,6494u},{61148u,61182u,6627u},{61345u,61438u,6662u},{61601u,61694u,6756u},
+{61857u,61950u,6850u},{62113u,62140u,6944u},{62141u,62141u,5731u},{62142u,62201u,6972u},
+{62202u,62202u,5771u},{62203u,62206u,7032u},{62369u,62384u,7036u},{62385u,62385u,4191u},
+{62386u,62462u,7052u},{62625u,62630u,7129u},{62631u,62631u,6484u},{62632u,62701u,7135u},
+{62702u,62702u,6684u},{62703u,62718u,7205u},{62881u,62974u,7221u},{63137u,63219u,7315u},
+{63220u,63220u,4279u},{63221u,63221u,7398u},{63222u,63222u,7139u},{63223u,63230u,7399u},
+{63393u,63415u,7407u},{63416u,63416u,4247u},{63417u,63431u,7430u},{63432u,63432u,4266u},
+{63433u,63442u,7445u},{63443u,63443u,4340u},{63444u,63486u,7455u},{63649u,63706u,7498u},
+{63707u,63707u,7572u},{63708u,63727u,7556u},{63728u,63728u,5088u},{63729u,63742u,7576u},
+{63905u,63998u,7590u},{64161u,64161u,7709u},{64162u,64162u,3558u},{64163u,64229u,7684u},
+{64230u,64230u,3644u},{64231u,64254u,7751u},{64417u,64510u,7775u},{64673u,64680u,7869u},
+{64681u,64681u,3815u},{64682u,64766u,7877u},{64929u,65022u,7962u},
+};
+
+static pdf_cmap cmap_KSC_EUC_H = {
+	{-1, pdf_free_cmap_imp}, "KSC-EUC-H", "", 0, 0, 2,
+	{ {1,0u,128u},{2,41377u,65278u}, },
+	467, 467, (pdf_range*) cmap_KSC_EUC_H_ranges,
+	0, 0, NULL,
+	0, 0, NULL,
+};
+
+/* KSC-EUC-V */
+
+static const pdf_range cmap_KSC_EUC_V_ranges[] = {
+{41378u,41379u,8056u},{41381u,41381u,8058u},{41382u,41382u,8320u},{41385u,41387u,8059u},
+{41389u,41389u,8062u},{41394u,41405u,8063u},{41451u,41451u,8075u},{41889u,41889u,8076u},
+{41896u,41897u,8077u},{41900u,41900u,8079u},{41902u,41902u,8080u},{41914u,41919u,8081u},
+{41947u,41947u,8087u},{41949u,41949u,8088u},{41951u,41951u,8089u},{41979u,41982u,8090u},
+};
+
+static pdf_cmap cmap_KSC_EUC_V = {
+	{-1, pdf_free_cmap_imp}, "KSC-EUC-V", "KSC-EUC-H", 0, 1, 0,
+	{ {0,0,0}, },
+	16, 16, (pdf_range*) cmap_KSC_EUC_V_ranges,
+	0, 0, NULL,
+	0, 0, NULL,
+};
+
+/* KSC-H */
+
+static const pdf_range cmap_KSC_H_ranges[] = {
+{8481u,8574u,101u},{8737u,8805u,195u},{8993u,9086u,264u},{9249u,9299u,358u},
+{9301u,9342u,409u},{9505u,9514u,451u},{9520u,9529u,461u},{9537u,9560u,471u},
+{9569u,9592u,495u},{9761u,9828u,519u},{10017u,10095u,587u},{10273u,10276u,666u},
+{10278u,10278u,670u},{10280u,10287u,671u},{10289u,10366u,679u},{10529u,10622u,757u},
+{10785u,10867u,851u},{11041u,11126u,934u},{11297u,11329u,1020u},{11345u,11377u,1053u},
+{12321u,12414u,1086u},{12577u,12670u,1180u},{12833u,12926u,1274u},{13089u,13182u,1368u},
+{13345u,13438u,1462u},{13601u,13694u,1556u},{13857u,13950u,1650u},{14113u,14206u,1744u},
+{14369u,14462u,1838u},{14625u,14718u,1932u},{14881u,14974u,2026u},{15137u,15230u,2120u},
+{15393u,15486u,2214u},{15649u,15742u,2308u},{15905u,15998u,2402u},{16161u,16254u,2496u},
+{16417u,16510u,2590u},{16673u,16766u,2684u},{16929u,17022u,2778u},{17185u,17278u,2872u},
+{17441u,17534u,2966u},{17697u,17790u,3060u},{17953u,18046u,3154u},{18209u,18302u,3248u},
+{18465u,18558u,3342u},{18977u,19070u,3436u},{19233u,19279u,3530u},{19280u,19280u,4116u},
+{19281u,19285u,3577u},{19286u,19286u,3678u},{19287u,19302u,3582u},{19303u,19303u,7053u},
+{19304u,19326u,3598u},{19489u,19582u,3621u},{19745u,19790u,3715u},{19791u,19791u,3460u},
+{19792u,19815u,3761u},{19816u,19816u,7900u},{19817u,19838u,3785u},{20001u,20012u,3807u},
+{20013u,20013u,3802u},{20014u,20094u,3819u},{20257u,20346u,3900u},{20347u,20347u,3902u},
+{20348u,20350u,3990u},{20513u,20513u,3993u},{20514u,20514u,3946u},{20515u,20535u,3994u},
+{20536u,20536u,3946u},{20537u,20559u,4015u},{20560u,20560u,3708u},{20561u,20572u,4038u},
+{20573u,20573u,4131u},{20574u,20606u,4050u},{20769u,20819u,4083u},{20820u,20820u,4374u},
+{20821u,20821u,4156u},{20822u,20823u,4134u},{20824u,20824u,4375u},{20825u,20826u,4136u},
+{20827u,20832u,4376u},{20833u,20833u,4138u},{20834u,20834u,5800u},{20835u,20837u,4382u},
+{20838u,20838u,4386u},{20839u,20839u,4139u},{20840u,20843u,4387u},{20844u,20844u,4140u},
+{20845u,20845u,4391u},{20846u,20846u,4141u},{20847u,20848u,4394u},{20849u,20849u,4142u},
+{20850u,20850u,4396u},{20851u,20853u,4143u},{20854u,20854u,4399u},{20855u,20857u,4146u},
+{20858u,20858u,4403u},{20859u,20859u,4149u},{20860u,20861u,4406u},{20862u,20862u,4409u},
+{21025u,21025u,4150u},{21026u,21027u,4410u},{21028u,21030u,4151u},{21031u,21034u,4412u},
+{21035u,21035u,4419u},{21036u,21036u,4154u},{21037u,21037u,4420u},{21038u,21041u,4155u},
+{21042u,21042u,4424u},{21043u,21053u,4159u},{21054u,21054u,4511u},{21055u,21057u,4170u},
+{21058u,21059u,4513u},{21060u,21060u,4517u},{21061u,21061u,4173u},{21062u,21066u,4518u},
+{21067u,21067u,4524u},{21068u,21068u,4174u},{21069u,21070u,4525u},{21071u,21076u,4528u},
+{21077u,21079u,4535u},{21080u,21080u,4175u},{21081u,21082u,4541u},{21083u,21085u,4176u},
+{21086u,21087u,4545u},{21088u,21088u,4179u},{21089u,21089u,4547u},{21090u,21090u,4550u},
+{21091u,21091u,4180u},{21092u,21092u,4564u},{21093u,21096u,4566u},{21097u,21098u,4571u},
+{21099u,21099u,4576u},{21100u,21103u,4181u},{21104u,21107u,4604u},{21108u,21109u,4609u},
+{21110u,21110u,4185u},{21111u,21112u,4611u},{21113u,21118u,4186u},{21281u,21374u,4192u},
+{21537u,21605u,4286u},{21606u,21606u,4318u},{21607u,21627u,4355u},{21628u,21628u,4136u},
+{21629u,21630u,4376u},{21793u,21796u,4378u},{21797u,21797u,5800u},{21798u,21802u,4382u},
+{21803u,21803u,4139u},{21804u,21805u,4387u},{21806u,21806u,4192u},{21807u,21886u,4389u},
+{22049u,22071u,4469u},{22072u,22072u,4167u},{22073u,22092u,4492u},{22093u,22093u,4172u},
+{22094u,22142u,4512u},{22305u,22346u,4561u},{22347u,22347u,5552u},{22348u,22371u,4603u},
+{22372u,22372u,6424u},{22373u,22398u,4627u},{22561u,22654u,4653u},{22817u,22910u,4747u},
+{23073u,23166u,4841u},{23329u,23364u,4935u},{23365u,23365u,5151u},{23366u,23395u,4971u},
+{23396u,23396u,4922u},{23397u,23422u,5001u},{23585u,23588u,5027u},{23589u,23589u,7518u},
+{23590u,23678u,5031u},{23841u,23844u,5120u},{23845u,23845u,5079u},{23846u,23892u,5124u},
+{23893u,23893u,5109u},{23894u,23923u,5171u},{23924u,23924u,7607u},{23925u,23934u,5201u},
+{24097u,24187u,5211u},{24188u,24188u,5584u},{24189u,24189u,5302u},{24190u,24190u,5367u},
+{24353u,24370u,5303u},{24371u,24371u,7083u},{24372u,24416u,5321u},{24417u,24417u,5362u},
+{24418u,24423u,5366u},{24424u,24424u,5485u},{24425u,24446u,5372u},{24609u,24688u,5394u},
+{24689u,24689u,6001u},{24690u,24702u,5474u},{24865u,24876u,5487u},{24877u,24877u,5460u},
+{24878u,24940u,5499u},{24941u,24941u,5317u},{24942u,24958u,5562u},{25121u,25214u,5579u},
+{25377u,25460u,5673u},{25461u,25461u,7009u},{25462u,25470u,5757u},{25633u,25633u,7370u},
+{25634u,25640u,5766u},{25641u,25641u,5678u},{25642u,25726u,5773u},{25889u,25901u,5858u},
+{25902u,25902u,5874u},{25903u,25904u,5871u},{25905u,25906u,4425u},{25907u,25912u,5873u},
+{25913u,25913u,4427u},{25914u,25914u,5879u},{25915u,25916u,4429u},{25917u,25923u,5880u},
+{25924u,25924u,4431u},{25925u,25933u,5887u},{25934u,25934u,4435u},{25935u,25935u,5896u},
+{25936u,25936u,4436u},{25937u,25937u,5897u},{25938u,25938u,4437u},{25939u,25941u,5898u},
+{25942u,25942u,4439u},{25943u,25977u,5901u},{25978u,25979u,4442u},{25980u,25980u,4159u},
+{25981u,25981u,5936u},{25982u,25982u,4444u},{26145u,26145u,4447u},{26146u,26147u,5937u},
+{26148u,26148u,4449u},{26149u,26150u,5939u},{26151u,26151u,4450u},{26152u,26156u,5941u},
+{26157u,26157u,4453u},{26158u,26158u,5946u},{26159u,26161u,4455u},{26162u,26162u,5947u},
+{26163u,26163u,4458u},{26164u,26166u,5948u},{26167u,26168u,4459u},{26169u,26171u,5951u},
+{26172u,26172u,4463u},{26173u,26179u,5954u},{26180u,26180u,4160u},{26181u,26181u,5961u},
+{26182u,26183u,4465u},{26184u,26185u,5962u},{26186u,26186u,4161u},{26187u,26193u,5964u},
+{26194u,26194u,4468u},{26195u,26197u,5971u},{26198u,26198u,4469u},{26199u,26200u,5974u},
+{26201u,26201u,4470u},{26202u,26203u,5976u},{26204u,26204u,4162u},{26205u,26206u,5978u},
+{26207u,26207u,4471u},{26208u,26208u,5980u},{26209u,26209u,4472u},{26210u,26211u,5981u},
+{26212u,26212u,4474u},{26213u,26213u,4473u},{26214u,26214u,4475u},{26215u,26215u,5983u},
+{26216u,26216u,4476u},{26217u,26217u,5984u},{26218u,26219u,4478u},{26220u,26220u,6447u},
+{26221u,26222u,5985u},{26223u,26223u,4481u},{26224u,26224u,5987u},{26225u,26225u,4482u},
+{26226u,26226u,5460u},{26227u,26228u,5988u},{26229u,26229u,4483u},{26230u,26230u,4163u},
+{26231u,26231u,4166u},{26232u,26232u,5990u},{26233u,26233u,4485u},{26234u,26238u,5991u},
+{26401u,26401u,4487u},{26402u,26405u,5996u},{26406u,26406u,4488u},{26407u,26408u,6000u},
+{26409u,26409u,4489u},{26410u,26410u,4491u},{26411u,26411u,6002u},{26412u,26412u,4167u},
+{26413u,26413u,4493u},{26414u,26415u,6003u},{26416u,26416u,4494u},{26417u,26430u,6005u},
+{26431u,26431u,4495u},{26432u,26432u,6019u},{26433u,26433u,7783u},{26434u,26437u,6020u},
+{26438u,26438u,4497u},{26439u,26439u,4499u},{26440u,26442u,6024u},{26443u,26443u,4501u},
+{26444u,26444u,6027u},{26445u,26445u,4502u},{26446u,26446u,6028u},{26447u,26448u,4503u},
+{26449u,26450u,6029u},{26451u,26451u,4506u},{26452u,26462u,6031u},{26463u,26463u,4508u},
+{26464u,26467u,6042u},{26468u,26468u,4509u},{26469u,26469u,6046u},{26470u,26470u,4510u},
+{26471u,26486u,6047u},{26487u,26487u,5797u},{26488u,26494u,6063u},{26657u,26726u,6070u},
+{26727u,26728u,4551u},{26729u,26735u,6140u},{26736u,26736u,4553u},{26737u,26737u,4180u},
+{26738u,26742u,6147u},{26743u,26743u,4555u},{26744u,26744u,6152u},{26745u,26745u,5800u},
+{26746u,26746u,6153u},{26747u,26747u,4556u},{26748u,26749u,6154u},{26750u,26750u,4557u},
+{26913u,26918u,6156u},{26919u,26919u,4560u},{26920u,26923u,6162u},{26924u,26924u,4561u},
+{26925u,26955u,6166u},{26956u,26956u,4563u},{26957u,26998u,6197u},{26999u,26999u,7988u},
+{27000u,27006u,6239u},{27169u,27200u,6246u},{27201u,27201u,6123u},{27202u,27236u,6278u},
+{27237u,27237u,4577u},{27238u,27251u,6313u},{27252u,27252u,4183u},{27253u,27254u,6327u},
+{27255u,27255u,4579u},{27256u,27259u,6329u},{27260u,27260u,4581u},{27261u,27261u,6333u},
+{27262u,27262u,4582u},{27425u,27427u,6334u},{27428u,27428u,4584u},{27429u,27430u,6337u},
+{27431u,27431u,4586u},{27432u,27432u,6339u},{27433u,27433u,4588u},{27434u,27434u,4184u},
+{27435u,27449u,6340u},{27450u,27451u,4590u},{27452u,27452u,6355u},{27453u,27453u,4592u},
+{27454u,27456u,6356u},{27457u,27457u,4593u},{27458u,27458u,4595u},{27459u,27461u,6359u},
+{27462u,27463u,4596u},{27464u,27467u,6362u},{27468u,27468u,4599u},{27469u,27470u,6366u},
+{27471u,27473u,4600u},{27474u,27474u,5552u},{27475u,27479u,6368u},{27480u,27480u,4603u},
+{27481u,27518u,6373u},{27681u,27685u,6411u},{27686u,27686u,4614u},{27687u,27687u,4616u},
+{27688u,27689u,6416u},{27690u,27690u,4618u},{27691u,27694u,6418u},{27695u,27695u,5950u},
+{27696u,27697u,4620u},{27698u,27698u,4187u},{27699u,27700u,6422u},{27701u,27701u,4625u},
+{27702u,27703u,6424u},{27704u,27704u,4627u},{27705u,27705u,6426u},{27706u,27706u,4629u},
+{27707u,27711u,6427u},{27712u,27713u,4632u},{27714u,27716u,6432u},{27717u,27717u,4634u},
+{27718u,27718u,4636u},{27719u,27720u,6435u},{27721u,27722u,4188u},{27723u,27732u,6437u},
+{27733u,27733u,4638u},{27734u,27740u,6447u},{27741u,27742u,4640u},{27743u,27744u,6454u},
+{27745u,27745u,4642u},{27746u,27747u,6456u},{27748u,27748u,4644u},{27749u,27750u,6458u},
+{27751u,27752u,4645u},{27753u,27766u,6460u},{27767u,27768u,4647u},{27769u,27769u,6474u},
+{27770u,27770u,4650u},{27771u,27774u,6475u},{27937u,27939u,4653u},{27940u,28013u,6479u},
+{28014u,28014u,5351u},{28015u,28030u,6553u},{28193u,28250u,6569u},{28251u,28251u,6494u},
+{28252u,28286u,6627u},{28449u,28542u,6662u},{28705u,28798u,6756u},{28961u,29054u,6850u},
+{29217u,29244u,6944u},{29245u,29245u,5731u},{29246u,29305u,6972u},{29306u,29306u,5771u},
+{29307u,29310u,7032u},{29473u,29488u,7036u},{29489u,29489u,4191u},{29490u,29566u,7052u},
+{29729u,29734u,7129u},{29735u,29735u,6484u},{29736u,29805u,7135u},{29806u,29806u,6684u},
+{29807u,29822u,7205u},{29985u,30078u,7221u},{30241u,30323u,7315u},{30324u,30324u,4279u},
+{30325u,30325u,7398u},{30326u,30326u,7139u},{30327u,30334u,7399u},{30497u,30519u,7407u},
+{30520u,30520u,4247u},{30521u,30535u,7430u},{30536u,30536u,4266u},{30537u,30546u,7445u},
+{30547u,30547u,4340u},{30548u,30590u,7455u},{30753u,30810u,7498u},{30811u,30811u,7572u},
+{30812u,30831u,7556u},{30832u,30832u,5088u},{30833u,30846u,7576u},{31009u,31102u,7590u},
+{31265u,31265u,7709u},{31266u,31266u,3558u},{31267u,31333u,7684u},{31334u,31334u,3644u},
+{31335u,31358u,7751u},{31521u,31614u,7775u},{31777u,31784u,7869u},{31785u,31785u,3815u},
+{31786u,31870u,7877u},{32033u,32126u,7962u},
+};
+
+static pdf_cmap cmap_KSC_H = {
+	{-1, pdf_free_cmap_imp}, "KSC-H", "", 0, 0, 1,
+	{ {2,8481u,32382u}, },
+	466, 466, (pdf_range*) cmap_KSC_H_ranges,
+	0, 0, NULL,
+	0, 0, NULL,
+};
+
+/* KSC-Johab-H */
+
+static const pdf_range cmap_KSC_Johab_H_ranges[] = {
+{32u,126u,1u},{33858u,33864u,358u},{33865u,33873u,366u},{33875u,33875u,375u},
+{33876u,33880u,377u},{33881u,33885u,383u},{33889u,33889u,388u},{33921u,33921u,389u},
+{33953u,33953u,390u},{33985u,33985u,391u},{34017u,34017u,392u},{34113u,34113u,393u},
+{34145u,34145u,394u},{34177u,34177u,395u},{34209u,34209u,396u},{34241u,34241u,397u},
+{34273u,34273u,398u},{34369u,34369u,399u},{34401u,34401u,400u},{34433u,34433u,401u},
+{34465u,34465u,402u},{34497u,34497u,403u},{34529u,34529u,404u},{34625u,34625u,405u},
+{34657u,34657u,406u},{34689u,34689u,407u},{34721u,34721u,408u},{34881u,34881u,358u},
+{34913u,34914u,1086u},{34915u,34916u,9333u},{34917u,34917u,1088u},{34918u,34919u,9335u},
+{34920u,34923u,1089u},{34924u,34928u,9337u},{34929u,34929u,1093u},{34931u,34937u,1094u},
+{34938u,34938u,9342u},{34939u,34941u,1101u},{34945u,34946u,1104u},{34947u,34948u,9343u},
+{34949u,34949u,1106u},{34950u,34952u,9345u},{34953u,34953u,1107u},{34954u,34960u,9348u},
+{34961u,34961u,1108u},{34963u,34963u,1109u},{34964u,34964u,9355u},{34965u,34967u,1110u},
+{34968u,34973u,9356u},{34977u,34978u,1113u},{34979u,34980u,9362u},{34981u,34981u,1115u},
+{34982u,34984u,9364u},{34985u,34985u,1116u},{34986u,34993u,9367u},{34995u,34996u,9375u},
+{34997u,34997u,1117u},{34998u,34998u,9377u},{34999u,34999u,1118u},{35000u,35005u,9378u},
+{35009u,35009u,1119u},{35010u,35012u,9384u},{35013u,35013u,1120u},{35014u,35016u,9387u},
+{35017u,35017u,1121u},{35018u,35025u,9390u},{35027u,35037u,9398u},{35041u,35042u,1122u},
+{35043u,35044u,9409u},{35045u,35045u,1124u},{35046u,35047u,9411u},{35048u,35049u,1125u},
+{35050u,35050u,9413u},{35051u,35051u,1127u},{35052u,35056u,9414u},{35057u,35057u,1128u},
+{35059u,35059u,1129u},{35060u,35060u,9419u},{35061u,35064u,1130u},{35065u,35066u,9420u},
+{35067u,35069u,1134u},{35137u,35137u,1137u},{35138u,35140u,9422u},{35141u,35141u,1138u},
+{35142u,35144u,9425u},{35145u,35145u,1139u},{35146u,35152u,9428u},{35153u,35153u,1140u},
+{35155u,35155u,1141u},{35156u,35156u,9435u},{35157u,35159u,1142u},{35160u,35165u,9436u},
+{35169u,35171u,1145u},{35172u,35172u,9442u},{35173u,35173u,1148u},{35174u,35175u,9443u},
+{35176u,35177u,1149u},{35178u,35184u,9445u},{35185u,35185u,1151u},{35187u,35187u,1152u},
+{35188u,35188u,9452u},{35189u,35191u,1153u},{35192u,35194u,9453u},{35195u,35195u,1156u},
+{35196u,35197u,9456u},{35201u,35201u,1157u},{35202u,35204u,9458u},{35205u,35205u,1158u},
+{35206u,35208u,9461u},{35209u,35209u,1159u},{35210u,35217u,9464u},{35219u,35219u,1160u},
+{35220u,35220u,9472u},{35221u,35221u,1161u},{35222u,35229u,9473u},{35233u,35234u,1162u},
+{35235u,35236u,9481u},{35237u,35237u,1164u},{35238u,35239u,9483u},{35240u,35241u,1165u},
+{35242u,35242u,9485u},{35243u,35243u,1167u},{35244u,35244u,9486u},{35245u,35245u,1168u},
+{35246u,35247u,9487u},{35248u,35249u,1169u},{35251u,35251u,1171u},{35252u,35252u,9489u},
+{35253u,35253u,1172u},{35254u,35254u,9490u},{35255u,35256u,1173u},{35257u,35261u,9491u},
+{35265u,35266u,1175u},{35267u,35268u,9496u},{35269u,35269u,1177u},{35270u,35272u,9498u},
+{35273u,35273u,1178u},{35274u,35274u,9501u},{35275u,35275u,1179u},{35276u,35280u,9502u},
+{35281u,35281u,1180u},{35283u,35283u,1181u},{35284u,35284u,9507u},{35285u,35285u,1182u},
+{35286u,35286u,9508u},{35287u,35287u,1183u},{35288u,35293u,9509u},{35297u,35297u,1184u},
+{35298u,35300u,9515u},{35301u,35301u,1185u},{35302u,35304u,9518u},{35305u,35305u,1186u},
+{35306u,35313u,9521u},{35315u,35315u,1187u},{35316u,35317u,9529u},{35318u,35319u,1188u},
+{35320u,35325u,9531u},{35393u,35394u,1190u},{35395u,35396u,9537u},{35397u,35397u,1192u},
+{35398u,35400u,9539u},{35401u,35401u,1193u},{35402u,35408u,9542u},{35409u,35409u,1194u},
+{35411u,35411u,1195u},{35412u,35412u,9549u},{35413u,35413u,1196u},{35414u,35414u,9550u},
+{35415u,35415u,1197u},{35416u,35421u,9551u},{35425u,35425u,1198u},{35426u,35428u,9557u},
+{35429u,35429u,1199u},{35430u,35432u,9560u},{35433u,35433u,1200u},{35434u,35441u,9563u},
+{35443u,35443u,1201u},{35444u,35444u,9571u},{35445u,35445u,1202u},{35446u,35453u,9572u},
+{35457u,35458u,1203u},{35459u,35460u,9580u},{35461u,35461u,1205u},{35462u,35463u,9582u},
+{35464u,35467u,1206u},{35468u,35471u,9584u},{35472u,35473u,1210u},{35475u,35475u,1212u},
+{35476u,35476u,9588u},{35477u,35477u,1213u},{35478u,35478u,9589u},{35479u,35480u,1214u},
+{35481u,35485u,9590u},{35489u,35490u,1216u},{35491u,35492u,9595u},{35493u,35493u,1218u},
+{35494u,35496u,9597u},{35497u,35497u,1219u},{35498u,35505u,9600u},{35507u,35509u,9608u},
+{35510u,35511u,1220u},{35512u,35517u,9611u},{35521u,35521u,1222u},{35522u,35537u,9617u},
+{35539u,35540u,9633u},{35541u,35541u,1223u},{35542u,35549u,9635u},{35553u,35554u,1224u},
+{35555u,35556u,9643u},{35557u,35557u,1226u},{35558u,35560u,9645u},{35561u,35561u,1227u},
+{35562u,35568u,9648u},{35569u,35569u,1228u},{35571u,35571u,1229u},{35572u,35572u,9655u},
+{35573u,35573u,1230u},{35574u,35581u,9656u},{35649u,35649u,1231u},{35650u,35652u,9664u},
+{35653u,35653u,1232u},{35654u,35656u,9667u},{35657u,35657u,1233u},{35658u,35665u,9670u},
+{35667u,35677u,9678u},{35681u,35682u,1234u},{35683u,35684u,9689u},{35685u,35685u,1236u},
+{35686u,35687u,9691u},{35688u,35690u,1237u},{35691u,35696u,9693u},{35697u,35697u,1240u},
+{35699u,35699u,1241u},{35700u,35700u,9699u},{35701u,35701u,1242u},{35702u,35702u,9700u},
+{35703u,35703u,1243u},{35704u,35709u,9701u},{35713u,35713u,1244u},{35714u,35729u,9707u},
+{35731u,35741u,9723u},{35745u,35746u,1245u},{35747u,35748u,9734u},{35749u,35749u,1247u},
+{35750u,35751u,9736u},{35752u,35753u,1248u},{35754u,35754u,9738u},{35755u,35755u,1250u},
+{35756u,35760u,9739u},{35761u,35761u,1251u},{35763u,35763u,1252u},{35764u,35764u,9744u},
+{35765u,35765u,1253u},{35766u,35766u,9745u},{35767u,35768u,1254u},{35769u,35771u,9746u},
+{35772u,35772u,1256u},{35773u,35773u,9749u},{35905u,35905u,359u},{35937u,35939u,1257u},
+{35940u,35940u,9750u},{35941u,35941u,1260u},{35942u,35944u,9751u},{35945u,35945u,1261u},
+{35946u,35946u,9754u},{35947u,35947u,1262u},{35948u,35952u,9755u},{35953u,35953u,1263u},
+{35955u,35955u,1264u},{35956u,35956u,9760u},{35957u,35959u,1265u},{35960u,35962u,9761u},
+{35963u,35963u,1268u},{35964u,35965u,9764u},{35969u,35970u,1269u},{35971u,35972u,9766u},
+{35973u,35973u,1271u},{35974u,35976u,9768u},{35977u,35977u,1272u},{35978u,35984u,9771u},
+{35985u,35985u,1273u},{35987u,35987u,1274u},{35988u,35988u,9778u},{35989u,35991u,1275u},
+{35992u,35997u,9779u},{36001u,36002u,1278u},{36003u,36008u,9785u},{36009u,36009u,1280u},
+{36010u,36017u,9791u},{36019u,36029u,9799u},{36033u,36049u,9810u},{36051u,36061u,9827u},
+{36065u,36067u,1281u},{36068u,36068u,9838u},{36069u,36069u,1284u},{36070u,36072u,9839u},
+{36073u,36073u,1285u},{36074u,36080u,9842u},{36081u,36081u,1286u},{36083u,36083u,1287u},
+{36084u,36084u,9849u},{36085u,36087u,1288u},{36088u,36093u,9850u},{36161u,36162u,1291u},
+{36163u,36164u,9856u},{36165u,36165u,1293u},{36166u,36176u,9858u},{36177u,36177u,1294u},
+{36179u,36180u,9869u},{36181u,36181u,1295u},{36182u,36182u,9871u},{36183u,36183u,1296u},
+{36184u,36189u,9872u},{36193u,36193u,1297u},{36194u,36196u,9878u},{36197u,36197u,1298u},
+{36198u,36200u,9881u},{36201u,36201u,1299u},{36202u,36209u,9884u},{36211u,36212u,9892u},
+{36213u,36214u,1300u},{36215u,36218u,9894u},{36219u,36219u,1302u},{36220u,36221u,9898u},
+{36225u,36225u,1303u},{36226u,36241u,9900u},{36243u,36253u,9916u},{36257u,36258u,1304u},
+{36259u,36260u,9927u},{36261u,36261u,1306u},{36262u,36262u,9929u},{36263u,36263u,1307u},
+{36264u,36264u,9930u},{36265u,36265u,1308u},{36266u,36272u,9931u},{36273u,36273u,1309u},
+{36275u,36275u,1310u},{36276u,36276u,9938u},{36277u,36277u,1311u},{36278u,36278u,9939u},
+{36279u,36281u,1312u},{36282u,36285u,9940u},{36289u,36290u,1315u},{36291u,36296u,9944u},
+{36297u,36297u,1317u},{36298u,36305u,9950u},{36307u,36309u,9958u},{36310u,36311u,1318u},
+{36312u,36317u,9961u},{36321u,36322u,1320u},{36323u,36337u,9967u},{36339u,36342u,9982u},
+{36343u,36343u,1322u},{36344u,36349u,9986u},{36417u,36417u,1323u},{36418u,36420u,9992u},
+{36421u,36421u,1324u},{36422u,36424u,9995u},{36425u,36425u,1325u},{36426u,36432u,9998u},
+{36433u,36433u,1326u},{36435u,36435u,1327u},{36436u,36438u,10005u},{36439u,36439u,1328u},
+{36440u,36445u,10008u},{36449u,36449u,1329u},{36450u,36465u,10014u},{36467u,36477u,10030u},
+{36481u,36482u,1330u},{36483u,36484u,10041u},{36485u,36485u,1332u},{36486u,36488u,10043u},
+{36489u,36489u,1333u},{36490u,36495u,10046u},{36496u,36497u,1334u},{36499u,36499u,1336u},
+{36500u,36500u,10052u},{36501u,36501u,1337u},{36502u,36502u,10053u},{36503u,36504u,1338u},
+{36505u,36509u,10054u},{36513u,36513u,1340u},{36514u,36520u,10059u},{36521u,36521u,1341u},
+{36522u,36529u,10066u},{36531u,36533u,10074u},{36534u,36535u,1342u},{36536u,36541u,10077u},
+{36545u,36546u,1344u},{36547u,36548u,10083u},{36549u,36549u,1346u},{36550u,36552u,10085u},
+{36553u,36553u,1347u},{36554u,36560u,10088u},{36561u,36561u,1348u},{36563u,36563u,1349u},
+{36564u,36565u,10095u},{36566u,36566u,1350u},{36567u,36573u,10097u},{36577u,36577u,1351u},
+{36578u,36580u,10104u},{36581u,36581u,1352u},{36582u,36584u,10107u},{36585u,36585u,1353u},
+{36586u,36592u,10110u},{36593u,36593u,1354u},{36595u,36595u,1355u},{36596u,36605u,10117u},
+{36673u,36673u,1356u},{36674u,36689u,10127u},{36691u,36701u,10143u},{36705u,36706u,1357u},
+{36707u,36708u,10154u},{36709u,36709u,1359u},{36710u,36710u,10156u},{36711u,36711u,1360u},
+{36712u,36712u,10157u},{36713u,36713u,1361u},{36714u,36714u,10158u},{36715u,36715u,1362u},
+{36716u,36719u,10159u},{36720u,36721u,1363u},{36723u,36723u,1365u},{36724u,36724u,10163u},
+{36725u,36725u,1366u},{36726u,36726u,10164u},{36727u,36727u,1367u},{36728u,36730u,10165u},
+{36731u,36731u,1368u},{36732u,36733u,10168u},{36737u,36753u,10170u},{36755u,36765u,10187u},
+{36769u,36770u,1369u},{36771u,36772u,10198u},{36773u,36773u,1371u},{36774u,36776u,10200u},
+{36777u,36777u,1372u},{36778u,36784u,10203u},{36785u,36785u,1373u},{36787u,36787u,1374u},
+{36788u,36788u,10210u},{36789u,36789u,1375u},{36790u,36790u,10211u},{36791u,36791u,1376u},
+{36792u,36797u,10212u},{36929u,36929u,361u},{36961u,36963u,1377u},{36964u,36964u,10218u},
+{36965u,36965u,1380u},{36966u,36967u,10219u},{36968u,36971u,1381u},{36972u,36976u,10221u},
+{36977u,36977u,1385u},{36979u,36979u,1386u},{36980u,36980u,10226u},{36981u,36985u,1387u},
+{36986u,36986u,10227u},{36987u,36987u,1392u},{36988u,36988u,10228u},{36989u,36989u,1393u},
+{36993u,36994u,1394u},{36995u,36996u,10229u},{36997u,36997u,1396u},{36998u,37000u,10231u},
+{37001u,37001u,1397u},{37002u,37008u,10234u},{37009u,37009u,1398u},{37011u,37011u,1399u},
+{37012u,37012u,10241u},{37013u,37015u,1400u},{37016u,37021u,10242u},{37025u,37026u,1403u},
+{37027u,37028u,10248u},{37029u,37029u,1405u},{37030u,37032u,10250u},{37033u,37033u,1406u},
+{37034u,37040u,10253u},{37041u,37041u,1407u},{37043u,37046u,10260u},{37047u,37047u,1408u},
+{37048u,37053u,10264u},{37057u,37073u,10270u},{37075u,37085u,10287u},{37089u,37090u,1409u},
+{37091u,37091u,10298u},{37092u,37093u,1411u},{37094u,37096u,10299u},{37097u,37097u,1413u},
+{37098u,37098u,10302u},{37099u,37100u,1414u},{37101u,37104u,10303u},{37105u,37105u,1416u},
+{37107u,37107u,1417u},{37108u,37108u,10307u},{37109u,37111u,1418u},{37112u,37116u,10308u},
+{37117u,37117u,1421u},{37185u,37186u,1422u},{37187u,37188u,10313u},{37189u,37189u,1424u},
+{37190u,37192u,10315u},{37193u,37193u,1425u},{37194u,37200u,10318u},{37201u,37201u,1426u},
+{37203u,37203u,1427u},{37204u,37204u,10325u},{37205u,37207u,1428u},{37208u,37213u,10326u},
+{37217u,37218u,1431u},{37219u,37220u,10332u},{37221u,37221u,1433u},{37222u,37224u,10334u},
+{37225u,37225u,1434u},{37226u,37232u,10337u},{37233u,37233u,1435u},{37235u,37235u,1436u},
+{37236u,37237u,10344u},{37238u,37239u,1437u},{37240u,37241u,10346u},{37242u,37242u,1439u},
+{37243u,37245u,10348u},{37249u,37249u,1440u},{37250u,37252u,10351u},{37253u,37253u,1441u},
+{37254u,37265u,10354u},{37267u,37277u,10366u},{37281u,37282u,1442u},{37283u,37284u,10377u},
+{37285u,37285u,1444u},{37286u,37288u,10379u},{37289u,37289u,1445u},{37290u,37290u,10382u},
+{37291u,37291u,1446u},{37292u,37296u,10383u},{37297u,37297u,1447u},{37299u,37299u,1448u},
+{37300u,37300u,10388u},{37301u,37301u,1449u},{37302u,37302u,10389u},{37303u,37303u,1450u},
+{37304u,37307u,10390u},{37308u,37309u,1451u},{37313u,37313u,1453u},{37314u,37316u,10394u},
+{37317u,37317u,1454u},{37318u,37320u,10397u},{37321u,37321u,1455u},{37322u,37329u,10400u},
+{37331u,37333u,10408u},{37334u,37334u,1456u},{37335u,37341u,10411u},{37345u,37361u,10418u},
+{37363u,37373u,10435u},{37441u,37441u,1457u},{37442u,37444u,10446u},{37445u,37445u,1458u},
+{37446u,37448u,10449u},{37449u,37449u,1459u},{37450u,37456u,10452u},{37457u,37457u,1460u},
+{37459u,37459u,1461u},{37460u,37460u,10459u},{37461u,37461u,1462u},{37462u,37469u,10460u},
+{37473u,37474u,1463u},{37475u,37476u,10468u},{37477u,37477u,1465u},{37478u,37480u,10470u},
+{37481u,37481u,1466u},{37482u,37489u,10473u},{37491u,37491u,1467u},{37492u,37492u,10481u},
+{37493u,37493u,1468u},{37494u,37494u,10482u},{37495u,37495u,1469u},{37496u,37501u,10483u},
+{37505u,37506u,1470u},{37507u,37508u,10489u},{37509u,37509u,1472u},{37510u,37511u,10491u},
+{37512u,37513u,1473u},{37514u,37520u,10493u},{37521u,37521u,1475u},{37523u,37523u,1476u},
+{37524u,37524u,10500u},{37525u,37525u,1477u},{37526u,37526u,10501u},{37527u,37527u,1478u},
+{37528u,37533u,10502u},{37537u,37537u,1479u},{37538u,37553u,10508u},{37555u,37557u,10524u},
+{37558u,37558u,1480u},{37559u,37565u,10527u},{37569u,37569u,1481u},{37570u,37585u,10534u},
+{37587u,37597u,10550u},{37601u,37601u,1482u},{37602u,37604u,10561u},{37605u,37605u,1483u},
+{37606u,37608u,10564u},{37609u,37609u,1484u},{37610u,37616u,10567u},{37617u,37617u,1485u},
+{37619u,37619u,1486u},{37620u,37629u,10574u},{37697u,37698u,1487u},{37699u,37704u,10584u},
+{37705u,37705u,1489u},{37706u,37712u,10590u},{37713u,37713u,1490u},{37715u,37715u,1491u},
+{37716u,37718u,10597u},{37719u,37719u,1492u},{37720u,37725u,10600u},{37729u,37730u,1493u},
+{37731u,37732u,10606u},{37733u,37733u,1495u},{37734u,37736u,10608u},{37737u,37739u,1496u},
+{37740u,37744u,10611u},{37745u,37745u,1499u},{37747u,37747u,1500u},{37748u,37748u,10616u},
+{37749u,37749u,1501u},{37750u,37750u,10617u},{37751u,37752u,1502u},{37753u,37755u,10618u},
+{37756u,37756u,1504u},{37757u,37757u,10621u},{37761u,37761u,1505u},{37762u,37764u,10622u},
+{37765u,37765u,1506u},{37766u,37768u,10625u},{37769u,37769u,1507u},{37770u,37777u,10628u},
+{37779u,37789u,10636u},{37793u,37794u,1508u},{37795u,37796u,10647u},{37797u,37797u,1510u},
+{37798u,37800u,10649u},{37801u,37801u,1511u},{37802u,37802u,10652u},{37803u,37803u,1512u},
+{37804u,37808u,10653u},{37809u,37809u,1513u},{37811u,37811u,1514u},{37812u,37812u,10658u},
+{37813u,37813u,1515u},{37814u,37814u,10659u},{37815u,37815u,1516u},{37816u,37819u,10660u},
+{37820u,37820u,1517u},{37821u,37821u,10664u},{37953u,37953u,364u},{37985u,37987u,1518u},
+{37988u,37988u,10665u},{37989u,37989u,1521u},{37990u,37991u,10666u},{37992u,37996u,1522u},
+{37997u,37999u,10668u},{38000u,38001u,1527u},{38003u,38003u,1529u},{38004u,38004u,10671u},
+{38005u,38009u,1530u},{38010u,38012u,10672u},{38013u,38013u,1535u},{38017u,38018u,1536u},
+{38019u,38020u,10675u},{38021u,38021u,1538u},{38022u,38024u,10677u},{38025u,38025u,1539u},
+{38026u,38032u,10680u},{38033u,38033u,1540u},{38035u,38035u,1541u},{38036u,38036u,10687u},
+{38037u,38039u,1542u},{38040u,38045u,10688u},{38049u,38049u,1545u},{38050u,38065u,10694u},
+{38067u,38077u,10710u},{38081u,38097u,10721u},{38099u,38109u,10738u},{38113u,38115u,1546u},
+{38116u,38116u,10749u},{38117u,38117u,1549u},{38118u,38119u,10750u},{38120u,38121u,1550u},
+{38122u,38122u,10752u},{38123u,38124u,1552u},{38125u,38128u,10753u},{38129u,38129u,1554u},
+{38131u,38131u,1555u},{38132u,38132u,10757u},{38133u,38133u,1556u},{38134u,38134u,10758u},
+{38135u,38135u,1557u},{38136u,38136u,10759u},{38137u,38137u,1558u},{38138u,38139u,10760u},
+{38140u,38140u,1559u},{38141u,38141u,10762u},{38209u,38210u,1560u},{38211u,38212u,10763u},
+{38213u,38213u,1562u},{38214u,38216u,10765u},{38217u,38217u,1563u},{38218u,38224u,10768u},
+{38225u,38225u,1564u},{38227u,38227u,1565u},{38228u,38228u,10775u},{38229u,38231u,1566u},
+{38232u,38237u,10776u},{38241u,38241u,1569u},{38242u,38244u,10782u},{38245u,38245u,1570u},
+{38246u,38248u,10785u},{38249u,38249u,1571u},{38250u,38257u,10788u},{38259u,38261u,10796u},
+{38262u,38263u,1572u},{38264u,38269u,10799u},{38273u,38273u,1574u},{38274u,38276u,10805u},
+{38277u,38277u,1575u},{38278u,38289u,10808u},{38291u,38301u,10820u},{38305u,38306u,1576u},
+{38307u,38308u,10831u},{38309u,38309u,1578u},{38310u,38311u,10833u},{38312u,38313u,1579u},
+{38314u,38314u,10835u},{38315u,38315u,1581u},{38316u,38316u,10836u},{38317u,38317u,1582u},
+{38318u,38320u,10837u},{38321u,38321u,1583u},{38323u,38323u,1584u},{38324u,38324u,10840u},
+{38325u,38325u,1585u},{38326u,38326u,10841u},{38327u,38327u,1586u},{38328u,38328u,10842u},
+{38329u,38329u,1587u},{38330u,38330u,10843u},{38331u,38331u,1588u},{38332u,38333u,10844u},
+{38337u,38337u,1589u},{38338u,38340u,10846u},{38341u,38341u,1590u},{38342u,38344u,10849u},
+{38345u,38345u,1591u},{38346u,38353u,10852u},{38355u,38365u,10860u},{38369u,38369u,1592u},
+{38370u,38385u,10871u},{38387u,38389u,10887u},{38390u,38390u,1593u},{38391u,38397u,10890u},
+{38465u,38465u,1594u},{38466u,38468u,10897u},{38469u,38469u,1595u},{38470u,38472u,10900u},
+{38473u,38473u,1596u},{38474u,38480u,10903u},{38481u,38481u,1597u},{38483u,38483u,1598u},
+{38484u,38484u,10910u},{38485u,38485u,1599u},{38486u,38493u,10911u},{38497u,38497u,1600u},
+{38498u,38513u,10919u},{38515u,38525u,10935u},{38529u,38530u,1601u},{38531u,38532u,10946u},
+{38533u,38533u,1603u},{38534u,38536u,10948u},{38537u,38537u,1604u},{38538u,38544u,10951u},
+{38545u,38545u,1605u},{38547u,38547u,1606u},{38548u,38548u,10958u},{38549u,38549u,1607u},
+{38550u,38550u,10959u},{38551u,38551u,1608u},{38552u,38557u,10960u},{38561u,38561u,1609u},
+{38562u,38577u,10966u},{38579u,38581u,10982u},{38582u,38582u,1610u},{38583u,38589u,10985u},
+{38593u,38593u,1611u},{38594u,38609u,10992u},{38611u,38614u,11008u},{38615u,38615u,1612u},
+{38616u,38621u,11012u},{38625u,38625u,1613u},{38626u,38628u,11018u},{38629u,38629u,1614u},
+{38630u,38632u,11021u},{38633u,38633u,1615u},{38634u,38641u,11024u},{38643u,38643u,1616u},
+{38644u,38644u,11032u},{38645u,38645u,1617u},{38646u,38646u,11033u},{38647u,38647u,1618u},
+{38648u,38653u,11034u},{38721u,38721u,1619u},{38722u,38724u,11040u},{38725u,38725u,1620u},
+{38726u,38728u,11043u},{38729u,38729u,1621u},{38730u,38736u,11046u},{38737u,38737u,1622u},
+{38739u,38742u,11053u},{38743u,38743u,1623u},{38744u,38749u,11057u},{38753u,38754u,1624u},
+{38755u,38756u,11063u},{38757u,38757u,1626u},{38758u,38759u,11065u},{38760u,38761u,1627u},
+{38762u,38762u,11067u},{38763u,38763u,1629u},{38764u,38768u,11068u},{38769u,38769u,1630u},
+{38771u,38771u,1631u},{38772u,38772u,11073u},{38773u,38773u,1632u},{38774u,38774u,11074u},
+{38775u,38775u,1633u},{38776u,38781u,11075u},{38785u,38785u,1634u},{38786u,38801u,11081u},
+{38803u,38813u,11097u},{38817u,38818u,1635u},{38819u,38820u,11108u},{38821u,38821u,1637u},
+{38822u,38823u,11110u},{38824u,38825u,1638u},{38826u,38832u,11112u},{38833u,38833u,1640u},
+{38835u,38835u,1641u},{38836u,38836u,11119u},{38837u,38840u,1642u},{38841u,38845u,11120u},
+{38977u,38977u,365u},{39009u,39010u,1646u},{39011u,39012u,11125u},{39013u,39013u,1648u},
+{39014u,39016u,11127u},{39017u,39017u,1649u},{39018u,39024u,11130u},{39025u,39025u,1650u},
+{39027u,39027u,1651u},{39028u,39028u,11137u},{39029u,39031u,1652u},{39032u,39036u,11138u},
+{39037u,39037u,1655u},{39041u,39042u,1656u},{39043u,39044u,11143u},{39045u,39045u,1658u},
+{39046u,39048u,11145u},{39049u,39049u,1659u},{39050u,39056u,11148u},{39057u,39057u,1660u},
+{39059u,39059u,1661u},{39060u,39060u,11155u},{39061u,39063u,1662u},{39064u,39069u,11156u},
+{39073u,39089u,11162u},{39091u,39101u,11179u},{39105u,39121u,11190u},{39123u,39133u,11207u},
+{39137u,39138u,1665u},{39139u,39140u,11218u},{39141u,39141u,1667u},{39142u,39144u,11220u},
+{39145u,39145u,1668u},{39146u,39146u,11223u},{39147u,39148u,1669u},{39149u,39152u,11224u},
+{39153u,39153u,1671u},{39155u,39155u,1672u},{39156u,39156u,11228u},{39157u,39159u,1673u},
+{39160u,39164u,11229u},{39165u,39165u,1676u},{39233u,39234u,1677u},{39235u,39236u,11234u},
+{39237u,39237u,1679u},{39238u,39240u,11236u},{39241u,39241u,1680u},{39242u,39248u,11239u},
+{39249u,39249u,1681u},{39251u,39251u,1682u},{39252u,39252u,11246u},{39253u,39255u,1683u},
+{39256u,39261u,11247u},{39265u,39265u,1686u},{39266u,39281u,11253u},{39283u,39285u,11269u},
+{39286u,39286u,1687u},{39287u,39293u,11272u},{39297u,39313u,11279u},{39315u,39325u,11296u},
+{39329u,39330u,1688u},{39331u,39332u,11307u},{39333u,39333u,1690u},{39334u,39336u,11309u},
+{39337u,39337u,1691u},{39338u,39345u,11312u},{39347u,39350u,11320u},{39351u,39351u,1692u},
+{39352u,39357u,11324u},{39361u,39361u,1693u},{39362u,39368u,11330u},{39369u,39369u,1694u},
+{39370u,39377u,11337u},{39379u,39389u,11345u},{39393u,39393u,1695u},{39394u,39409u,11356u},
+{39411u,39421u,11372u},{39489u,39489u,1696u},{39490u,39492u,11383u},{39493u,39493u,1697u},
+{39494u,39505u,11386u},{39507u,39517u,11398u},{39521u,39537u,11409u},{39539u,39549u,11426u},
+{39553u,39554u,1698u},{39555u,39556u,11437u},{39557u,39557u,1700u},{39558u,39560u,11439u},
+{39561u,39561u,1701u},{39562u,39567u,11442u},{39568u,39569u,1702u},{39571u,39574u,11448u},
+{39575u,39575u,1704u},{39576u,39581u,11452u},{39585u,39601u,11458u},{39603u,39613u,11475u},
+{39617u,39617u,1705u},{39618u,39633u,11486u},{39635u,39645u,11502u},{39649u,39649u,1706u},
+{39650u,39652u,11513u},{39653u,39653u,1707u},{39654u,39656u,11516u},{39657u,39657u,1708u},
+{39658u,39664u,11519u},{39665u,39665u,1709u},{39667u,39667u,1710u},{39668u,39670u,11526u},
+{39671u,39671u,1711u},{39672u,39677u,11529u},{39745u,39761u,11535u},{39763u,39773u,11552u},
+{39777u,39778u,1712u},{39779u,39780u,11563u},{39781u,39781u,1714u},{39782u,39783u,11565u},
+{39784u,39785u,1715u},{39786u,39792u,11567u},{39793u,39793u,1717u},{39795u,39795u,1718u},
+{39796u,39796u,11574u},{39797u,39797u,1719u},{39798u,39805u,11575u},{39809u,39809u,1720u},
+{39810u,39812u,11583u},{39813u,39813u,1721u},{39814u,39816u,11586u},{39817u,39817u,1722u},
+{39818u,39824u,11589u},{39825u,39825u,1723u},{39827u,39827u,1724u},{39828u,39837u,11596u},
+{39841u,39841u,1725u},{39842u,39844u,11606u},{39845u,39845u,1726u},{39846u,39848u,11609u},
+{39849u,39849u,1727u},{39850u,39856u,11612u},{39857u,39857u,1728u},{39859u,39859u,1729u},
+{39860u,39860u,11619u},{39861u,39861u,1730u},{39862u,39862u,11620u},{39863u,39863u,1731u},
+{39864u,39869u,11621u},{40001u,40001u,366u},{40033u,40034u,1732u},{40035u,40036u,11627u},
+{40037u,40037u,1734u},{40038u,40040u,11629u},{40041u,40041u,1735u},{40042u,40048u,11632u},
+{40049u,40049u,1736u},{40051u,40051u,1737u},{40052u,40052u,11639u},{40053u,40056u,1738u},
+{40057u,40059u,11640u},{40060u,40061u,1742u},{40065u,40066u,1744u},{40067u,40068u,11643u},
+{40069u,40069u,1746u},{40070u,40072u,11645u},{40073u,40073u,1747u},{40074u,40080u,11648u},
+{40081u,40081u,1748u},{40083u,40083u,1749u},{40084u,40084u,11655u},{40085u,40087u,1750u},
+{40088u,40093u,11656u},{40097u,40098u,1753u},{40099u,40100u,11662u},{40101u,40101u,1755u},
+{40102u,40113u,11664u},{40115u,40116u,11676u},{40117u,40117u,1756u},{40118u,40118u,11678u},
+{40119u,40119u,1757u},{40120u,40125u,11679u},{40129u,40145u,11685u},{40147u,40157u,11702u},
+{40161u,40162u,1758u},{40163u,40164u,11713u},{40165u,40165u,1760u},{40166u,40168u,11715u},
+{40169u,40169u,1761u},{40170u,40176u,11718u},{40177u,40177u,1762u},{40179u,40179u,1763u},
+{40180u,40180u,11725u},{40181u,40183u,1764u},{40184u,40188u,11726u},{40189u,40189u,1767u},
+{40257u,40258u,1768u},{40259u,40260u,11731u},{40261u,40261u,1770u},{40262u,40264u,11733u},
+{40265u,40265u,1771u},{40266u,40272u,11736u},{40273u,40273u,1772u},{40275u,40275u,1773u},
+{40276u,40276u,11743u},{40277u,40277u,1774u},{40278u,40278u,11744u},{40279u,40279u,1775u},
+{40280u,40285u,11745u},{40289u,40290u,1776u},{40291u,40292u,11751u},{40293u,40293u,1778u},
+{40294u,40296u,11753u},{40297u,40297u,1779u},{40298u,40304u,11756u},{40305u,40305u,1780u},
+{40307u,40307u,1781u},{40308u,40308u,11763u},{40309u,40311u,1782u},{40312u,40317u,11764u},
+{40321u,40321u,1785u},{40322u,40324u,11770u},{40325u,40325u,1786u},{40326u,40337u,11773u},
+{40339u,40339u,1787u},{40340u,40340u,11785u},{40341u,40341u,1788u},{40342u,40349u,11786u},
+{40353u,40354u,1789u},{40355u,40356u,11794u},{40357u,40357u,1791u},{40358u,40360u,11796u},
+{40361u,40361u,1792u},{40362u,40368u,11799u},{40369u,40369u,1793u},{40371u,40371u,1794u},
+{40372u,40372u,11806u},{40373u,40373u,1795u},{40374u,40374u,11807u},{40375u,40375u,1796u},
+{40376u,40381u,11808u},{40385u,40385u,1797u},{40386u,40388u,11814u},{40389u,40389u,1798u},
+{40390u,40401u,11817u},{40403u,40406u,11829u},{40407u,40407u,1799u},{40408u,40413u,11833u},
+{40417u,40433u,11839u},{40435u,40437u,11856u},{40438u,40438u,1800u},{40439u,40445u,11859u},
+{40513u,40513u,1801u},{40514u,40516u,11866u},{40517u,40517u,1802u},{40518u,40520u,11869u},
+{40521u,40521u,1803u},{40522u,40528u,11872u},{40529u,40529u,1804u},{40531u,40531u,1805u},
+{40532u,40532u,11879u},{40533u,40533u,1806u},{40534u,40534u,11880u},{40535u,40535u,1807u},
+{40536u,40541u,11881u},{40545u,40545u,1808u},{40546u,40548u,11887u},{40549u,40549u,1809u},
+{40550u,40552u,11890u},{40553u,40553u,1810u},{40554u,40561u,11893u},{40563u,40563u,1811u},
+{40564u,40564u,11901u},{40565u,40565u,1812u},{40566u,40566u,11902u},{40567u,40567u,1813u},
+{40568u,40573u,11903u},{40577u,40578u,1814u},{40579u,40580u,11909u},{40581u,40581u,1816u},
+{40582u,40584u,11911u},{40585u,40585u,1817u},{40586u,40592u,11914u},{40593u,40593u,1818u},
+{40595u,40595u,1819u},{40596u,40596u,11921u},{40597u,40597u,1820u},{40598u,40598u,11922u},
+{40599u,40599u,1821u},{40600u,40605u,11923u},{40609u,40609u,1822u},{40610u,40625u,11929u},
+{40627u,40629u,11945u},{40630u,40630u,1823u},{40631u,40637u,11948u},{40641u,40641u,1824u},
+{40642u,40657u,11955u},{40659u,40669u,11971u},{40673u,40674u,1825u},{40675u,40676u,11982u},
+{40677u,40677u,1827u},{40678u,40680u,11984u},{40681u,40681u,1828u},{40682u,40688u,11987u},
+{40689u,40689u,1829u},{40691u,40692u,11994u},{40693u,40693u,1830u},{40694u,40694u,11996u},
+{40695u,40695u,1831u},{40696u,40701u,11997u},{40769u,40770u,1832u},{40771u,40772u,12003u},
+{40773u,40773u,1834u},{40774u,40776u,12005u},{40777u,40777u,1835u},{40778u,40784u,12008u},
+{40785u,40785u,1836u},{40787u,40787u,1837u},{40788u,40788u,12015u},{40789u,40789u,1838u},
+{40790u,40790u,12016u},{40791u,40791u,1839u},{40792u,40797u,12017u},{40801u,40802u,1840u},
+{40803u,40804u,12023u},{40805u,40805u,1842u},{40806u,40808u,12025u},{40809u,40809u,1843u},
+{40810u,40816u,12028u},{40817u,40817u,1844u},{40819u,40819u,1845u},{40820u,40820u,12035u},
+{40821u,40821u,1846u},{40822u,40822u,12036u},{40823u,40824u,1847u},{40825u,40826u,12037u},
+{40827u,40828u,1849u},{40829u,40829u,12039u},{40833u,40849u,12040u},{40851u,40861u,12057u},
+{40865u,40866u,1851u},{40867u,40868u,12068u},{40869u,40869u,1853u},{40870u,40872u,12070u},
+{40873u,40873u,1854u},{40874u,40880u,12073u},{40881u,40881u,1855u},{40883u,40883u,1856u},
+{40884u,40884u,12080u},{40885u,40885u,1857u},{40886u,40886u,12081u},{40887u,40887u,1858u},
+{40888u,40893u,12082u},{41025u,41025u,374u},{41057u,41058u,1859u},{41059u,41060u,12088u},
+{41061u,41061u,1861u},{41062u,41062u,12090u},{41063u,41067u,1862u},{41068u,41072u,12091u},
+{41073u,41073u,1867u},{41075u,41075u,1868u},{41076u,41076u,12096u},{41077u,41077u,1869u},
+{41078u,41078u,12097u},{41079u,41080u,1870u},{41081u,41082u,12098u},{41083u,41083u,1872u},
+{41084u,41084u,12100u},{41085u,41085u,1873u},{41089u,41090u,1874u},{41091u,41092u,12101u},
+{41093u,41093u,1876u},{41094u,41096u,12103u},{41097u,41097u,1877u},{41098u,41104u,12106u},
+{41105u,41105u,1878u},{41107u,41107u,1879u},{41108u,41108u,12113u},{41109u,41112u,1880u},
+{41113u,41117u,12114u},{41121u,41122u,1884u},{41123u,41128u,12119u},{41129u,41129u,1886u},
+{41130u,41137u,12125u},{41139u,41142u,12133u},{41143u,41143u,1887u},{41144u,41149u,12137u},
+{41153u,41169u,12143u},{41171u,41181u,12160u},{41185u,41186u,1888u},{41187u,41188u,12171u},
+{41189u,41189u,1890u},{41190u,41192u,12173u},{41193u,41193u,1891u},{41194u,41194u,12176u},
+{41195u,41195u,1892u},{41196u,41200u,12177u},{41201u,41201u,1893u},{41203u,41203u,1894u},
+{41204u,41204u,12182u},{41205u,41205u,1895u},{41206u,41206u,12183u},{41207u,41208u,1896u},
+{41209u,41212u,12184u},{41213u,41213u,1898u},{41281u,41282u,1899u},{41283u,41284u,12188u},
+{41285u,41285u,1901u},{41286u,41288u,12190u},{41289u,41289u,1902u},{41290u,41296u,12193u},
+{41297u,41297u,1903u},{41299u,41299u,1904u},{41300u,41300u,12200u},{41301u,41303u,1905u},
+{41304u,41309u,12201u},{41313u,41314u,1908u},{41315u,41316u,12207u},{41317u,41317u,1910u},
+{41318u,41320u,12209u},{41321u,41321u,1911u},{41322u,41329u,12212u},{41331u,41332u,12220u},
+{41333u,41335u,1912u},{41336u,41336u,12222u},{41337u,41337u,1915u},{41338u,41341u,12223u},
+{41345u,41345u,1916u},{41346u,41361u,12227u},{41363u,41373u,12243u},{41377u,41378u,1917u},
+{41379u,41379u,12254u},{41380u,41381u,1919u},{41382u,41384u,12255u},{41385u,41385u,1921u},
+{41386u,41386u,12258u},{41387u,41387u,1922u},{41388u,41392u,12259u},{41393u,41393u,1923u},
+{41395u,41395u,1924u},{41396u,41396u,12264u},{41397u,41397u,1925u},{41398u,41398u,12265u},
+{41399u,41399u,1926u},{41400u,41405u,12266u},{41409u,41409u,1927u},{41410u,41412u,12272u},
+{41413u,41413u,1928u},{41414u,41425u,12275u},{41427u,41429u,12287u},{41430u,41431u,1929u},
+{41432u,41437u,12290u},{41441u,41457u,12296u},{41459u,41469u,12313u},{41537u,41537u,1931u},
+{41538u,41540u,12324u},{41541u,41541u,1932u},{41542u,41544u,12327u},{41545u,41545u,1933u},
+{41546u,41553u,12330u},{41555u,41555u,1934u},{41556u,41556u,12338u},{41557u,41557u,1935u},
+{41558u,41558u,12339u},{41559u,41559u,1936u},{41560u,41565u,12340u},{41569u,41569u,1937u},
+{41570u,41572u,12346u},{41573u,41573u,1938u},{41574u,41576u,12349u},{41577u,41577u,1939u},
+{41578u,41585u,12352u},{41587u,41587u,1940u},{41588u,41588u,12360u},{41589u,41589u,1941u},
+{41590u,41597u,12361u},{41601u,41603u,1942u},{41604u,41604u,12369u},{41605u,41605u,1945u},
+{41606u,41607u,12370u},{41608u,41611u,1946u},{41612u,41616u,12372u},{41617u,41617u,1950u},
+{41619u,41619u,1951u},{41620u,41620u,12377u},{41621u,41621u,1952u},{41622u,41622u,12378u},
+{41623u,41623u,1953u},{41624u,41626u,12379u},{41627u,41627u,1954u},{41628u,41628u,12382u},
+{41629u,41629u,1955u},{41633u,41633u,1956u},{41634u,41636u,12383u},{41637u,41637u,1957u},
+{41638u,41640u,12386u},{41641u,41641u,1958u},{41642u,41649u,12389u},{41651u,41651u,1959u},
+{41652u,41652u,12397u},{41653u,41653u,1960u},{41654u,41661u,12398u},{41665u,41665u,1961u},
+{41666u,41681u,12406u},{41683u,41693u,12422u},{41697u,41697u,1962u},{41698u,41700u,12433u},
+{41701u,41701u,1963u},{41702u,41704u,12436u},{41705u,41705u,1964u},{41706u,41713u,12439u},
+{41715u,41725u,12447u},{41793u,41793u,1965u},{41794u,41796u,12458u},{41797u,41797u,1966u},
+{41798u,41800u,12461u},{41801u,41801u,1967u},{41802u,41808u,12464u},{41809u,41809u,1968u},
+{41811u,41812u,12471u},{41813u,41813u,1969u},{41814u,41821u,12473u},{41825u,41825u,1970u},
+{41826u,41828u,12481u},{41829u,41829u,1971u},{41830u,41832u,12484u},{41833u,41833u,1972u},
+{41834u,41840u,12487u},{41841u,41841u,1973u},{41843u,41844u,12494u},{41845u,41845u,1974u},
+{41846u,41853u,12496u},{41857u,41873u,12504u},{41875u,41885u,12521u},{41889u,41890u,1975u},
+{41891u,41892u,12532u},{41893u,41893u,1977u},{41894u,41895u,12534u},{41896u,41897u,1978u},
+{41898u,41898u,12536u},{41899u,41899u,1980u},{41900u,41904u,12537u},{41905u,41905u,1981u},
+{41907u,41907u,1982u},{41908u,41908u,12542u},{41909u,41911u,1983u},{41912u,41912u,12543u},
+{41913u,41913u,1986u},{41914u,41914u,12544u},{41915u,41915u,1987u},{41916u,41917u,12545u},
+{42049u,42049u,375u},{42081u,42085u,1988u},{42086u,42087u,12547u},{42088u,42092u,1993u},
+{42093u,42096u,12549u},{42097u,42097u,1998u},{42099u,42099u,1999u},{42100u,42100u,12553u},
+{42101u,42101u,2000u},{42102u,42102u,12554u},{42103u,42103u,2001u},{42104u,42106u,12555u},
+{42107u,42107u,2002u},{42108u,42109u,12558u},{42113u,42114u,2003u},{42115u,42116u,12560u},
+{42117u,42117u,2005u},{42118u,42120u,12562u},{42121u,42121u,2006u},{42122u,42128u,12565u},
+{42129u,42129u,2007u},{42131u,42131u,2008u},{42132u,42132u,12572u},{42133u,42135u,2009u},
+{42136u,42138u,12573u},{42139u,42139u,2012u},{42140u,42141u,12576u},{42145u,42146u,2013u},
+{42147u,42148u,12578u},{42149u,42149u,2015u},{42150u,42161u,12580u},{42163u,42163u,2016u},
+{42164u,42173u,12592u},{42177u,42193u,12602u},{42195u,42205u,12619u},{42209u,42210u,2017u},
+{42211u,42212u,12630u},{42213u,42213u,2019u},{42214u,42215u,12632u},{42216u,42217u,2020u},
+{42218u,42218u,12634u},{42219u,42219u,2022u},{42220u,42224u,12635u},{42225u,42225u,2023u},
+{42227u,42227u,2024u},{42228u,42228u,12640u},{42229u,42229u,2025u},{42230u,42230u,12641u},
+{42231u,42232u,2026u},{42233u,42237u,12642u},{42305u,42306u,2028u},{42307u,42308u,12647u},
+{42309u,42309u,2030u},{42310u,42311u,12649u},{42312u,42313u,2031u},{42314u,42320u,12651u},
+{42321u,42321u,2033u},{42323u,42323u,2034u},{42324u,42324u,12658u},{42325u,42327u,2035u},
+{42328u,42333u,12659u},{42337u,42338u,2038u},{42339u,42340u,12665u},{42341u,42341u,2040u},
+{42342u,42344u,12667u},{42345u,42345u,2041u},{42346u,42353u,12670u},{42355u,42355u,2042u},
+{42356u,42356u,12678u},{42357u,42359u,2043u},{42360u,42362u,12679u},{42363u,42363u,2046u},
+{42364u,42365u,12682u},{42369u,42369u,2047u},{42370u,42372u,12684u},{42373u,42373u,2048u},
+{42374u,42385u,12687u},{42387u,42397u,12699u},{42401u,42403u,2049u},{42404u,42404u,12710u},
+{42405u,42405u,2052u},{42406u,42408u,12711u},{42409u,42409u,2053u},{42410u,42416u,12714u},
+{42417u,42417u,2054u},{42419u,42419u,2055u},{42420u,42420u,12721u},{42421u,42421u,2056u},
+{42422u,42422u,12722u},{42423u,42423u,2057u},{42424u,42429u,12723u},{42433u,42433u,2058u},
+{42434u,42436u,12729u},{42437u,42437u,2059u},{42438u,42449u,12732u},{42451u,42453u,12744u},
+{42454u,42454u,2060u},{42455u,42461u,12747u},{42465u,42465u,2061u},{42466u,42481u,12754u},
+{42483u,42485u,12770u},{42486u,42486u,2062u},{42487u,42493u,12773u},{42561u,42562u,2063u},
+{42563u,42564u,12780u},{42565u,42565u,2065u},{42566u,42568u,12782u},{42569u,42569u,2066u},
+{42570u,42576u,12785u},{42577u,42577u,2067u},{42579u,42579u,2068u},{42580u,42589u,12792u},
+{42593u,42593u,2069u},{42594u,42596u,12802u},{42597u,42597u,2070u},{42598u,42609u,12805u},
+{42611u,42621u,12817u},{42625u,42626u,2071u},{42627u,42628u,12828u},{42629u,42629u,2073u},
+{42630u,42631u,12830u},{42632u,42635u,2074u},{42636u,42640u,12832u},{42641u,42641u,2078u},
+{42643u,42643u,2079u},{42644u,42644u,12837u},{42645u,42645u,2080u},{42646u,42646u,12838u},
+{42647u,42647u,2081u},{42648u,42650u,12839u},{42651u,42652u,2082u},{42653u,42653u,12842u},
+{42657u,42657u,2084u},{42658u,42664u,12843u},{42665u,42665u,2085u},{42666u,42673u,12850u},
+{42675u,42677u,12858u},{42678u,42678u,2086u},{42679u,42685u,12861u},{42689u,42689u,2087u},
+{42690u,42705u,12868u},{42707u,42717u,12884u},{42721u,42722u,2088u},{42723u,42724u,12895u},
+{42725u,42725u,2090u},{42726u,42728u,12897u},{42729u,42729u,2091u},{42730u,42737u,12900u},
+{42739u,42742u,12908u},{42743u,42743u,2092u},{42744u,42749u,12912u},{42817u,42817u,2093u},
+{42818u,42820u,12918u},{42821u,42821u,2094u},{42822u,42824u,12921u},{42825u,42825u,2095u},
+{42826u,42832u,12924u},{42833u,42833u,2096u},{42835u,42836u,12931u},{42837u,42837u,2097u},
+{42838u,42838u,12933u},{42839u,42839u,2098u},{42840u,42845u,12934u},{42849u,42850u,2099u},
+{42851u,42852u,12940u},{42853u,42853u,2101u},{42854u,42856u,12942u},{42857u,42857u,2102u},
+{42858u,42864u,12945u},{42865u,42865u,2103u},{42867u,42867u,2104u},{42868u,42868u,12952u},
+{42869u,42869u,2105u},{42870u,42877u,12953u},{42881u,42897u,12961u},{42899u,42909u,12978u},
+{42913u,42914u,2106u},{42915u,42916u,12989u},{42917u,42917u,2108u},{42918u,42920u,12991u},
+{42921u,42921u,2109u},{42922u,42922u,12994u},{42923u,42923u,2110u},{42924u,42928u,12995u},
+{42929u,42929u,2111u},{42931u,42931u,2112u},{42932u,42932u,13000u},{42933u,42933u,2113u},
+{42934u,42934u,13001u},{42935u,42937u,2114u},{42938u,42941u,13002u},{43073u,43073u,376u},
+{43105u,43106u,2117u},{43107u,43108u,13006u},{43109u,43109u,2119u},{43110u,43112u,13008u},
+{43113u,43113u,2120u},{43114u,43114u,13011u},{43115u,43115u,2121u},{43116u,43120u,13012u},
+{43121u,43121u,2122u},{43123u,43123u,2123u},{43124u,43124u,13017u},{43125u,43127u,2124u},
+{43128u,43132u,13018u},{43133u,43133u,2127u},{43137u,43138u,2128u},{43139u,43140u,13023u},
+{43141u,43141u,2130u},{43142u,43144u,13025u},{43145u,43145u,2131u},{43146u,43152u,13028u},
+{43153u,43153u,2132u},{43155u,43155u,2133u},{43156u,43156u,13035u},{43157u,43159u,2134u},
+{43160u,43165u,13036u},{43169u,43170u,2137u},{43171u,43184u,13042u},{43185u,43185u,2139u},
+{43187u,43197u,13056u},{43201u,43217u,13067u},{43219u,43229u,13084u},{43233u,43234u,2140u},
+{43235u,43236u,13095u},{43237u,43237u,2142u},{43238u,43239u,13097u},{43240u,43241u,2143u},
+{43242u,43248u,13099u},{43249u,43249u,2145u},{43251u,43252u,13106u},{43253u,43255u,2146u},
+{43256u,43261u,13108u},{43329u,43329u,2149u},{43330u,43345u,13114u},{43347u,43350u,13130u},
+{43351u,43351u,2150u},{43352u,43357u,13134u},{43361u,43362u,2151u},{43363u,43376u,13140u},
+{43377u,43377u,2153u},{43379u,43379u,2154u},{43380u,43380u,13154u},{43381u,43383u,2155u},
+{43384u,43389u,13155u},{43393u,43409u,13161u},{43411u,43421u,13178u},{43425u,43426u,2158u},
+{43427u,43428u,13189u},{43429u,43429u,2160u},{43430u,43432u,13191u},{43433u,43433u,2161u},
+{43434u,43440u,13194u},{43441u,43441u,2162u},{43443u,43443u,2163u},{43444u,43446u,13201u},
+{43447u,43447u,2164u},{43448u,43453u,13204u},{43457u,43473u,13210u},{43475u,43485u,13227u},
+{43489u,43505u,13238u},{43507u,43517u,13255u},{43585u,43585u,2165u},{43586u,43601u,13266u},
+{43603u,43613u,13282u},{43617u,43617u,2166u},{43618u,43633u,13293u},{43635u,43638u,13309u},
+{43639u,43639u,2167u},{43640u,43645u,13313u},{43649u,43650u,2168u},{43651u,43652u,13319u},
+{43653u,43653u,2170u},{43654u,43656u,13321u},{43657u,43657u,2171u},{43658u,43664u,13324u},
+{43665u,43665u,2172u},{43667u,43668u,13331u},{43669u,43669u,2173u},{43670u,43670u,13333u},
+{43671u,43671u,2174u},{43672u,43677u,13334u},{43681u,43697u,13340u},{43699u,43709u,13357u},
+{43713u,43729u,13368u},{43731u,43741u,13385u},{43745u,43761u,13396u},{43763u,43773u,13413u},
+{43841u,43841u,2175u},{43842u,43857u,13424u},{43859u,43862u,13440u},{43863u,43863u,2176u},
+{43864u,43869u,13444u},{43873u,43873u,2177u},{43874u,43876u,13450u},{43877u,43877u,2178u},
+{43878u,43880u,13453u},{43881u,43881u,2179u},{43882u,43888u,13456u},{43889u,43889u,2180u},
+{43891u,43891u,2181u},{43892u,43901u,13463u},{43905u,43921u,13473u},{43923u,43933u,13490u},
+{43937u,43938u,2182u},{43939u,43940u,13501u},{43941u,43941u,2184u},{43942u,43944u,13503u},
+{43945u,43945u,2185u},{43946u,43952u,13506u},{43953u,43953u,2186u},{43955u,43955u,2187u},
+{43956u,43956u,13513u},{43957u,43957u,2188u},{43958u,43958u,13514u},{43959u,43959u,2189u},
+{43960u,43965u,13515u},{44097u,44097u,378u},{44129u,44130u,2190u},{44131u,44131u,13521u},
+{44132u,44133u,2192u},{44134u,44135u,13522u},{44136u,44139u,2194u},{44140u,44144u,13524u},
+{44145u,44145u,2198u},{44147u,44147u,2199u},{44148u,44148u,13529u},{44149u,44151u,2200u},
+{44152u,44154u,13530u},{44155u,44155u,2203u},{44156u,44157u,13533u},{44161u,44162u,2204u},
+{44163u,44164u,13535u},{44165u,44165u,2206u},{44166u,44168u,13537u},{44169u,44169u,2207u},
+{44170u,44176u,13540u},{44177u,44177u,2208u},{44179u,44179u,2209u},{44180u,44180u,13547u},
+{44181u,44183u,2210u},{44184u,44189u,13548u},{44193u,44194u,2213u},{44195u,44196u,13554u},
+{44197u,44197u,2215u},{44198u,44200u,13556u},{44201u,44201u,2216u},{44202u,44208u,13559u},
+{44209u,44209u,2217u},{44211u,44211u,2218u},{44212u,44212u,13566u},{44213u,44213u,2219u},
+{44214u,44214u,13567u},{44215u,44215u,2220u},{44216u,44221u,13568u},{44225u,44225u,2221u},
+{44226u,44228u,13574u},{44229u,44229u,2222u},{44230u,44232u,13577u},{44233u,44233u,2223u},
+{44234u,44240u,13580u},{44241u,44241u,2224u},{44243u,44246u,13587u},{44247u,44247u,2225u},
+{44248u,44253u,13591u},{44257u,44261u,2226u},{44262u,44263u,13597u},{44264u,44265u,2231u},
+{44266u,44266u,13599u},{44267u,44268u,2233u},{44269u,44272u,13600u},{44273u,44273u,2235u},
+{44275u,44275u,2236u},{44276u,44276u,13604u},{44277u,44279u,2237u},{44280u,44283u,13605u},
+{44284u,44284u,2240u},{44285u,44285u,13609u},{44353u,44354u,2241u},{44355u,44356u,13610u},
+{44357u,44357u,2243u},{44358u,44360u,13612u},{44361u,44361u,2244u},{44362u,44368u,13615u},
+{44369u,44369u,2245u},{44371u,44371u,2246u},{44372u,44372u,13622u},{44373u,44375u,2247u},
+{44376u,44381u,13623u},{44385u,44386u,2250u},{44387u,44388u,13629u},{44389u,44389u,2252u},
+{44390u,44392u,13631u},{44393u,44393u,2253u},{44394u,44400u,13634u},{44401u,44401u,2254u},
+{44403u,44403u,2255u},{44404u,44404u,13641u},{44405u,44407u,2256u},{44408u,44413u,13642u},
+{44417u,44417u,2259u},{44418u,44420u,13648u},{44421u,44421u,2260u},{44422u,44424u,13651u},
+{44425u,44425u,2261u},{44426u,44433u,13654u},{44435u,44438u,13662u},{44439u,44439u,2262u},
+{44440u,44445u,13666u},{44449u,44451u,2263u},{44452u,44452u,13672u},{44453u,44453u,2266u},
+{44454u,44456u,13673u},{44457u,44457u,2267u},{44458u,44458u,13676u},{44459u,44459u,2268u},
+{44460u,44464u,13677u},{44465u,44465u,2269u},{44467u,44467u,2270u},{44468u,44468u,13682u},
+{44469u,44469u,2271u},{44470u,44470u,13683u},{44471u,44471u,2272u},{44472u,44474u,13684u},
+{44475u,44475u,2273u},{44476u,44477u,13687u},{44481u,44482u,2274u},{44483u,44484u,13689u},
+{44485u,44485u,2276u},{44486u,44488u,13691u},{44489u,44489u,2277u},{44490u,44497u,13694u},
+{44499u,44502u,13702u},{44503u,44503u,2278u},{44504u,44509u,13706u},{44513u,44513u,2279u},
+{44514u,44516u,13712u},{44517u,44517u,2280u},{44518u,44520u,13715u},{44521u,44521u,2281u},
+{44522u,44528u,13718u},{44529u,44529u,2282u},{44531u,44532u,13725u},{44533u,44534u,2283u},
+{44535u,44541u,13727u},{44609u,44609u,2285u},{44610u,44612u,13734u},{44613u,44613u,2286u},
+{44614u,44616u,13737u},{44617u,44617u,2287u},{44618u,44624u,13740u},{44625u,44625u,2288u},
+{44627u,44627u,2289u},{44628u,44628u,13747u},{44629u,44629u,2290u},{44630u,44637u,13748u},
+{44641u,44642u,2291u},{44643u,44644u,13756u},{44645u,44645u,2293u},{44646u,44648u,13758u},
+{44649u,44649u,2294u},{44650u,44656u,13761u},{44657u,44657u,2295u},{44659u,44659u,2296u},
+{44660u,44660u,13768u},{44661u,44661u,2297u},{44662u,44662u,13769u},{44663u,44663u,2298u},
+{44664u,44669u,13770u},{44673u,44674u,2299u},{44675u,44676u,13776u},{44677u,44677u,2301u},
+{44678u,44679u,13778u},{44680u,44681u,2302u},{44682u,44688u,13780u},{44689u,44689u,2304u},
+{44691u,44691u,2305u},{44692u,44692u,13787u},{44693u,44693u,2306u},{44694u,44694u,13788u},
+{44695u,44695u,2307u},{44696u,44696u,13789u},{44697u,44697u,2308u},{44698u,44698u,13790u},
+{44699u,44700u,2309u},{44701u,44701u,13791u},{44705u,44705u,2311u},{44706u,44721u,13792u},
+{44723u,44725u,13808u},{44726u,44726u,2312u},{44727u,44733u,13811u},{44737u,44738u,2313u},
+{44739u,44740u,13818u},{44741u,44741u,2315u},{44742u,44744u,13820u},{44745u,44745u,2316u},
+{44746u,44752u,13823u},{44753u,44753u,2317u},{44755u,44758u,13830u},{44759u,44759u,2318u},
+{44760u,44765u,13834u},{44769u,44770u,2319u},{44771u,44772u,13840u},{44773u,44773u,2321u},
+{44774u,44776u,13842u},{44777u,44777u,2322u},{44778u,44784u,13845u},{44785u,44785u,2323u},
+{44787u,44787u,2324u},{44788u,44788u,13852u},{44789u,44789u,2325u},{44790u,44790u,13853u},
+{44791u,44791u,2326u},{44792u,44797u,13854u},{44865u,44866u,2327u},{44867u,44872u,13860u},
+{44873u,44873u,2329u},{44874u,44880u,13866u},{44881u,44881u,2330u},{44883u,44884u,13873u},
+{44885u,44885u,2331u},{44886u,44886u,13875u},{44887u,44887u,2332u},{44888u,44893u,13876u},
+{44897u,44898u,2333u},{44899u,44900u,13882u},{44901u,44901u,2335u},{44902u,44904u,13884u},
+{44905u,44906u,2336u},{44907u,44912u,13887u},{44913u,44913u,2338u},{44915u,44915u,2339u},
+{44916u,44916u,13893u},{44917u,44917u,2340u},{44918u,44918u,13894u},{44919u,44919u,2341u},
+{44920u,44925u,13895u},{44929u,44945u,13901u},{44947u,44957u,13918u},{44961u,44962u,2342u},
+{44963u,44964u,13929u},{44965u,44965u,2344u},{44966u,44967u,13931u},{44968u,44969u,2345u},
+{44970u,44975u,13933u},{44976u,44977u,2347u},{44979u,44979u,2349u},{44980u,44980u,13939u},
+{44981u,44981u,2350u},{44982u,44982u,13940u},{44983u,44983u,2351u},{44984u,44987u,13941u},
+{44988u,44988u,2352u},{44989u,44989u,13945u},{45121u,45121u,379u},{45153u,45154u,2353u},
+{45155u,45155u,13946u},{45156u,45157u,2355u},{45158u,45160u,13947u},{45161u,45161u,2357u},
+{45162u,45168u,13950u},{45169u,45169u,2358u},{45171u,45171u,2359u},{45172u,45173u,13957u},
+{45174u,45175u,2360u},{45176u,45180u,13959u},{45181u,45181u,2362u},{45185u,45186u,2363u},
+{45187u,45188u,13964u},{45189u,45189u,2365u},{45190u,45192u,13966u},{45193u,45193u,2366u},
+{45194u,45200u,13969u},{45201u,45201u,2367u},{45203u,45203u,2368u},{45204u,45205u,13976u},
+{45206u,45207u,2369u},{45208u,45213u,13978u},{45217u,45233u,13984u},{45235u,45238u,14001u},
+{45239u,45239u,2371u},{45240u,45245u,14005u},{45249u,45265u,14011u},{45267u,45277u,14028u},
+{45281u,45282u,2372u},{45283u,45284u,14039u},{45285u,45285u,2374u},{45286u,45288u,14041u},
+{45289u,45289u,2375u},{45290u,45290u,14044u},{45291u,45291u,2376u},{45292u,45296u,14045u},
+{45297u,45297u,2377u},{45299u,45299u,2378u},{45300u,45301u,14050u},{45302u,45303u,2379u},
+{45304u,45309u,14052u},{45377u,45377u,2381u},{45378u,45380u,14058u},{45381u,45381u,2382u},
+{45382u,45384u,14061u},{45385u,45385u,2383u},{45386u,45393u,14064u},{45395u,45405u,14072u},
+{45409u,45425u,14083u},{45427u,45437u,14100u},{45441u,45444u,14111u},{45445u,45445u,2384u},
+{45446u,45457u,14115u},{45459u,45469u,14127u},{45473u,45474u,2385u},{45475u,45476u,14138u},
+{45477u,45477u,2387u},{45478u,45479u,14140u},{45480u,45481u,2388u},{45482u,45482u,14142u},
+{45483u,45483u,2390u},{45484u,45488u,14143u},{45489u,45489u,2391u},{45491u,45491u,2392u},
+{45492u,45494u,14148u},{45495u,45495u,2393u},{45496u,45501u,14151u},{45505u,45506u,2394u},
+{45507u,45508u,14157u},{45509u,45509u,2396u},{45510u,45521u,14159u},{45523u,45525u,14171u},
+{45526u,45526u,2397u},{45527u,45533u,14174u},{45537u,45537u,2398u},{45538u,45553u,14181u},
+{45555u,45557u,14197u},{45558u,45558u,2399u},{45559u,45565u,14200u},{45633u,45633u,2400u},
+{45634u,45636u,14207u},{45637u,45637u,2401u},{45638u,45640u,14210u},{45641u,45641u,2402u},
+{45642u,45648u,14213u},{45649u,45649u,2403u},{45651u,45651u,2404u},{45652u,45661u,14220u},
+{45665u,45665u,2405u},{45666u,45681u,14230u},{45683u,45693u,14246u},{45697u,45698u,2406u},
+{45699u,45700u,14257u},{45701u,45701u,2408u},{45702u,45704u,14259u},{45705u,45705u,2409u},
+{45706u,45712u,14262u},{45713u,45713u,2410u},{45715u,45715u,2411u},{45716u,45718u,14269u},
+{45719u,45719u,2412u},{45720u,45725u,14272u},{45729u,45729u,2413u},{45730u,45745u,14278u},
+{45747u,45749u,14294u},{45750u,45750u,2414u},{45751u,45757u,14297u},{45761u,45761u,2415u},
+{45762u,45777u,14304u},{45779u,45789u,14320u},{45793u,45793u,2416u},{45794u,45796u,14331u},
+{45797u,45797u,2417u},{45798u,45809u,14334u},{45811u,45821u,14346u},{45889u,45905u,14357u},
+{45907u,45910u,14374u},{45911u,45911u,2418u},{45912u,45917u,14378u},{45921u,45922u,2419u},
+{45923u,45924u,14384u},{45925u,45925u,2421u},{45926u,45928u,14386u},{45929u,45929u,2422u},
+{45930u,45930u,14389u},{45931u,45931u,2423u},{45932u,45935u,14390u},{45936u,45937u,2424u},
+{45939u,45939u,2426u},{45940u,45949u,14394u},{45953u,45953u,2427u},{45954u,45956u,14404u},
+{45957u,45957u,2428u},{45958u,45960u,14407u},{45961u,45961u,2429u},{45962u,45968u,14410u},
+{45969u,45969u,2430u},{45971u,45981u,14417u},{45985u,45986u,2431u},{45987u,45988u,14428u},
+{45989u,45989u,2433u},{45990u,45992u,14430u},{45993u,45993u,2434u},{45994u,46000u,14433u},
+{46001u,46001u,2435u},{46003u,46003u,2436u},{46004u,46004u,14440u},{46005u,46005u,2437u},
+{46006u,46006u,14441u},{46007u,46007u,2438u},{46008u,46013u,14442u},{46145u,46145u,380u},
+{46177u,46178u,2439u},{46179u,46180u,14448u},{46181u,46183u,2441u},{46184u,46184u,14450u},
+{46185u,46187u,2444u},{46188u,46191u,14451u},{46192u,46193u,2447u},{46195u,46195u,2449u},
+{46196u,46196u,14455u},{46197u,46199u,2450u},{46200u,46202u,14456u},{46203u,46204u,2453u},
+{46205u,46205u,14459u},{46209u,46210u,2455u},{46211u,46212u,14460u},{46213u,46213u,2457u},
+{46214u,46216u,14462u},{46217u,46217u,2458u},{46218u,46224u,14465u},{46225u,46225u,2459u},
+{46227u,46227u,2460u},{46228u,46228u,14472u},{46229u,46231u,2461u},{46232u,46237u,14473u},
+{46241u,46242u,2464u},{46243u,46244u,14479u},{46245u,46245u,2466u},{46246u,46248u,14481u},
+{46249u,46249u,2467u},{46250u,46251u,14484u},{46252u,46252u,2468u},{46253u,46256u,14486u},
+{46257u,46257u,2469u},{46259u,46259u,2470u},{46260u,46260u,14490u},{46261u,46261u,2471u},
+{46262u,46262u,14491u},{46263u,46263u,2472u},{46264u,46266u,14492u},{46267u,46267u,2473u},
+{46268u,46268u,14495u},{46269u,46269u,2474u},{46273u,46273u,2475u},{46274u,46276u,14496u},
+{46277u,46277u,2476u},{46278u,46280u,14499u},{46281u,46281u,2477u},{46282u,46289u,14502u},
+{46291u,46291u,2478u},{46292u,46301u,14510u},{46305u,46306u,2479u},{46307u,46308u,14520u},
+{46309u,46310u,2481u},{46311u,46311u,14522u},{46312u,46315u,2483u},{46316u,46320u,14523u},
+{46321u,46321u,2487u},{46323u,46328u,2488u},{46329u,46329u,14528u},{46330u,46330u,2494u},
+{46331u,46331u,14529u},{46332u,46332u,2495u},{46333u,46333u,14530u},{46401u,46402u,2496u},
+{46403u,46404u,14531u},{46405u,46405u,2498u},{46406u,46408u,14533u},{46409u,46409u,2499u},
+{46410u,46416u,14536u},{46417u,46417u,2500u},{46419u,46419u,2501u},{46420u,46420u,14543u},
+{46421u,46421u,2502u},{46422u,46422u,14544u},{46423u,46423u,2503u},{46424u,46429u,14545u},
+{46433u,46435u,2504u},{46436u,46436u,14551u},{46437u,46437u,2507u},{46438u,46440u,14552u},
+{46441u,46441u,2508u},{46442u,46442u,14555u},{46443u,46444u,2509u},{46445u,46448u,14556u},
+{46449u,46449u,2511u},{46451u,46455u,2512u},{46456u,46458u,14560u},{46459u,46461u,2517u},
+{46465u,46465u,2520u},{46466u,46468u,14563u},{46469u,46469u,2521u},{46470u,46472u,14566u},
+{46473u,46473u,2522u},{46474u,46480u,14569u},{46481u,46481u,2523u},{46483u,46483u,2524u},
+{46484u,46484u,14576u},{46485u,46486u,2525u},{46487u,46493u,14577u},{46497u,46498u,2527u},
+{46499u,46500u,14584u},{46501u,46501u,2529u},{46502u,46504u,14586u},{46505u,46507u,2530u},
+{46508u,46508u,14589u},{46509u,46509u,2533u},{46510u,46511u,14590u},{46512u,46513u,2534u},
+{46515u,46515u,2536u},{46516u,46516u,14592u},{46517u,46517u,2537u},{46518u,46518u,14593u},
+{46519u,46519u,2538u},{46520u,46520u,14594u},{46521u,46521u,2539u},{46522u,46525u,14595u},
+{46529u,46530u,2540u},{46531u,46532u,14599u},{46533u,46533u,2542u},{46534u,46536u,14601u},
+{46537u,46537u,2543u},{46538u,46544u,14604u},{46545u,46545u,2544u},{46547u,46547u,2545u},
+{46548u,46548u,14611u},{46549u,46551u,2546u},{46552u,46557u,14612u},{46561u,46562u,2549u},
+{46563u,46564u,14618u},{46565u,46565u,2551u},{46566u,46576u,14620u},{46577u,46577u,2552u},
+{46579u,46580u,14631u},{46581u,46581u,2553u},{46582u,46582u,14633u},{46583u,46583u,2554u},
+{46584u,46589u,14634u},{46657u,46658u,2555u},{46659u,46660u,14640u},{46661u,46661u,2557u},
+{46662u,46664u,14642u},{46665u,46665u,2558u},{46666u,46672u,14645u},{46673u,46673u,2559u},
+{46675u,46675u,2560u},{46676u,46676u,14652u},{46677u,46677u,2561u},{46678u,46678u,14653u},
+{46679u,46679u,2562u},{46680u,46685u,14654u},{46689u,46690u,2563u},{46691u,46692u,14660u},
+{46693u,46693u,2565u},{46694u,46696u,14662u},{46697u,46697u,2566u},{46698u,46704u,14665u},
+{46705u,46705u,2567u},{46707u,46707u,2568u},{46708u,46708u,14672u},{46709u,46709u,2569u},
+{46710u,46710u,14673u},{46711u,46711u,2570u},{46712u,46717u,14674u},{46721u,46722u,2571u},
+{46723u,46724u,14680u},{46725u,46725u,2573u},{46726u,46728u,14682u},{46729u,46731u,2574u},
+{46732u,46736u,14685u},{46737u,46737u,2577u},{46739u,46739u,2578u},{46740u,46740u,14690u},
+{46741u,46741u,2579u},{46742u,46742u,14691u},{46743u,46743u,2580u},{46744u,46749u,14692u},
+{46753u,46754u,2581u},{46755u,46756u,14698u},{46757u,46757u,2583u},{46758u,46760u,14700u},
+{46761u,46761u,2584u},{46762u,46768u,14703u},{46769u,46769u,2585u},{46771u,46771u,2586u},
+{46772u,46773u,14710u},{46774u,46775u,2587u},{46776u,46781u,14712u},{46785u,46786u,2589u},
+{46787u,46788u,14718u},{46789u,46789u,2591u},{46790u,46792u,14720u},{46793u,46793u,2592u},
+{46794u,46800u,14723u},{46801u,46801u,2593u},{46803u,46803u,2594u},{46804u,46806u,14730u},
+{46807u,46807u,2595u},{46808u,46813u,14733u},{46817u,46818u,2596u},{46819u,46820u,14739u},
+{46821u,46821u,2598u},{46822u,46824u,14741u},{46825u,46825u,2599u},{46826u,46832u,14744u},
+{46833u,46833u,2600u},{46835u,46835u,2601u},{46836u,46836u,14751u},{46837u,46837u,2602u},
+{46838u,46838u,14752u},{46839u,46839u,2603u},{46840u,46845u,14753u},{46913u,46914u,2604u},
+{46915u,46916u,14759u},{46917u,46917u,2606u},{46918u,46920u,14761u},{46921u,46921u,2607u},
+{46922u,46928u,14764u},{46929u,46929u,2608u},{46931u,46931u,2609u},{46932u,46932u,14771u},
+{46933u,46933u,2610u},{46934u,46934u,14772u},{46935u,46935u,2611u},{46936u,46936u,14773u},
+{46937u,46937u,2612u},{46938u,46941u,14774u},{46945u,46946u,2613u},{46947u,46948u,14778u},
+{46949u,46949u,2615u},{46950u,46952u,14780u},{46953u,46953u,2616u},{46954u,46958u,14783u},
+{46959u,46959u,2617u},{46960u,46960u,14788u},{46961u,46961u,2618u},{46963u,46963u,2619u},
+{46964u,46964u,14789u},{46965u,46965u,2620u},{46966u,46966u,14790u},{46967u,46973u,2621u},
+{46977u,46977u,2628u},{46978u,46980u,14791u},{46981u,46981u,2629u},{46982u,46984u,14794u},
+{46985u,46985u,2630u},{46986u,46992u,14797u},{46993u,46993u,2631u},{46995u,46996u,14804u},
+{46997u,46997u,2632u},{46998u,47005u,14806u},{47009u,47010u,2633u},{47011u,47012u,14814u},
+{47013u,47013u,2635u},{47014u,47016u,14816u},{47017u,47019u,2636u},{47020u,47023u,14819u},
+{47024u,47025u,2639u},{47027u,47027u,2641u},{47028u,47028u,14823u},{47029u,47032u,2642u},
+{47033u,47035u,14824u},{47036u,47036u,2646u},{47037u,47037u,14827u},{47169u,47169u,381u},
+{47201u,47202u,2647u},{47203u,47204u,14828u},{47205u,47205u,2649u},{47206u,47206u,14830u},
+{47207u,47209u,2650u},{47210u,47210u,14831u},{47211u,47211u,2653u},{47212u,47216u,14832u},
+{47217u,47217u,2654u},{47219u,47219u,2655u},{47220u,47220u,14837u},{47221u,47224u,2656u},
+{47225u,47229u,14838u},{47233u,47234u,2660u},{47235u,47236u,14843u},{47237u,47237u,2662u},
+{47238u,47240u,14845u},{47241u,47241u,2663u},{47242u,47248u,14848u},{47249u,47249u,2664u},
+{47251u,47251u,2665u},{47252u,47252u,14855u},{47253u,47255u,2666u},{47256u,47261u,14856u},
+{47265u,47266u,2669u},{47267u,47268u,14862u},{47269u,47269u,2671u},{47270u,47270u,14864u},
+{47271u,47271u,2672u},{47272u,47272u,14865u},{47273u,47273u,2673u},{47274u,47280u,14866u},
+{47281u,47281u,2674u},{47283u,47286u,14873u},{47287u,47287u,2675u},{47288u,47293u,14877u},
+{47297u,47297u,2676u},{47298u,47300u,14883u},{47301u,47301u,2677u},{47302u,47304u,14886u},
+{47305u,47305u,2678u},{47306u,47313u,14889u},{47315u,47325u,14897u},{47329u,47330u,2679u},
+{47331u,47332u,14908u},{47333u,47333u,2681u},{47334u,47336u,14910u},{47337u,47337u,2682u},
+{47338u,47338u,14913u},{47339u,47339u,2683u},{47340u,47344u,14914u},{47345u,47345u,2684u},
+{47347u,47347u,2685u},{47348u,47348u,14919u},{47349u,47349u,2686u},{47350u,47350u,14920u},
+{47351u,47352u,2687u},{47353u,47357u,14921u},{47425u,47426u,2689u},{47427u,47428u,14926u},
+{47429u,47429u,2691u},{47430u,47432u,14928u},{47433u,47433u,2692u},{47434u,47440u,14931u},
+{47441u,47441u,2693u},{47443u,47443u,2694u},{47444u,47444u,14938u},{47445u,47445u,2695u},
+{47446u,47446u,14939u},{47447u,47447u,2696u},{47448u,47453u,14940u},{47457u,47457u,2697u},
+{47458u,47460u,14946u},{47461u,47461u,2698u},{47462u,47464u,14949u},{47465u,47465u,2699u},
+{47466u,47472u,14952u},{47473u,47473u,2700u},{47475u,47475u,2701u},{47476u,47477u,14959u},
+{47478u,47479u,2702u},{47480u,47485u,14961u},{47489u,47489u,2704u},{47490u,47505u,14967u},
+{47507u,47517u,14983u},{47521u,47522u,2705u},{47523u,47524u,14994u},{47525u,47525u,2707u},
+{47526u,47528u,14996u},{47529u,47529u,2708u},{47530u,47530u,14999u},{47531u,47531u,2709u},
+{47532u,47536u,15000u},{47537u,47537u,2710u},{47539u,47539u,2711u},{47540u,47540u,15005u},
+{47541u,47541u,2712u},{47542u,47542u,15006u},{47543u,47545u,2713u},{47546u,47548u,15007u},
+{47549u,47549u,2716u},{47553u,47554u,2717u},{47555u,47560u,15010u},{47561u,47561u,2719u},
+{47562u,47569u,15016u},{47571u,47571u,2720u},{47572u,47572u,15024u},{47573u,47573u,2721u},
+{47574u,47574u,15025u},{47575u,47575u,2722u},{47576u,47581u,15026u},{47585u,47585u,2723u},
+{47586u,47601u,15032u},{47603u,47605u,15048u},{47606u,47607u,2724u},{47608u,47613u,15051u},
+{47681u,47681u,2726u},{47682u,47684u,15057u},{47685u,47685u,2727u},{47686u,47688u,15060u},
+{47689u,47689u,2728u},{47690u,47696u,15063u},{47697u,47697u,2729u},{47699u,47699u,2730u},
+{47700u,47700u,15070u},{47701u,47701u,2731u},{47702u,47702u,15071u},{47703u,47703u,2732u},
+{47704u,47709u,15072u},{47713u,47714u,2733u},{47715u,47716u,15078u},{47717u,47717u,2735u},
+{47718u,47729u,15080u},{47731u,47734u,15092u},{47735u,47735u,2736u},{47736u,47741u,15096u},
+{47745u,47746u,2737u},{47747u,47748u,15102u},{47749u,47749u,2739u},{47750u,47752u,15104u},
+{47753u,47755u,2740u},{47756u,47760u,15107u},{47761u,47761u,2743u},{47763u,47763u,2744u},
+{47764u,47764u,15112u},{47765u,47765u,2745u},{47766u,47766u,15113u},{47767u,47767u,2746u},
+{47768u,47773u,15114u},{47777u,47777u,2747u},{47778u,47793u,15120u},{47795u,47797u,15136u},
+{47798u,47798u,2748u},{47799u,47805u,15139u},{47809u,47809u,2749u},{47810u,47825u,15146u},
+{47827u,47837u,15162u},{47841u,47842u,2750u},{47843u,47844u,15173u},{47845u,47845u,2752u},
+{47846u,47848u,15175u},{47849u,47849u,2753u},{47850u,47856u,15178u},{47857u,47857u,2754u},
+{47859u,47859u,2755u},{47860u,47860u,15185u},{47861u,47861u,2756u},{47862u,47869u,15186u},
+{47937u,47937u,2757u},{47938u,47940u,15194u},{47941u,47941u,2758u},{47942u,47944u,15197u},
+{47945u,47945u,2759u},{47946u,47952u,15200u},{47953u,47953u,2760u},{47955u,47965u,15207u},
+{47969u,47970u,2761u},{47971u,47972u,15218u},{47973u,47973u,2763u},{47974u,47976u,15220u},
+{47977u,47977u,2764u},{47978u,47984u,15223u},{47985u,47985u,2765u},{47987u,47987u,2766u},
+{47988u,47988u,15230u},{47989u,47989u,2767u},{47990u,47990u,15231u},{47991u,47991u,2768u},
+{47992u,47997u,15232u},{48001u,48017u,15238u},{48019u,48029u,15255u},{48033u,48034u,2769u},
+{48035u,48036u,15266u},{48037u,48037u,2771u},{48038u,48039u,15268u},{48040u,48041u,2772u},
+{48042u,48042u,15270u},{48043u,48043u,2774u},{48044u,48048u,15271u},{48049u,48049u,2775u},
+{48051u,48051u,2776u},{48052u,48052u,15276u},{48053u,48053u,2777u},{48054u,48054u,15277u},
+{48055u,48056u,2778u},{48057u,48058u,15278u},{48059u,48060u,2780u},{48061u,48061u,15280u},
+{48193u,48193u,382u},{48225u,48226u,2782u},{48227u,48228u,15281u},{48229u,48229u,2784u},
+{48230u,48230u,15283u},{48231u,48231u,2785u},{48232u,48232u,15284u},{48233u,48233u,2786u},
+{48234u,48235u,15285u},{48236u,48236u,2787u},{48237u,48240u,15287u},{48241u,48241u,2788u},
+{48243u,48243u,2789u},{48244u,48244u,15291u},{48245u,48247u,2790u},{48248u,48253u,15292u},
+{48257u,48258u,2793u},{48259u,48260u,15298u},{48261u,48261u,2795u},{48262u,48264u,15300u},
+{48265u,48265u,2796u},{48266u,48272u,15303u},{48273u,48273u,2797u},{48275u,48275u,2798u},
+{48276u,48276u,15310u},{48277u,48279u,2799u},{48280u,48285u,15311u},{48289u,48289u,2802u},
+{48290u,48292u,15317u},{48293u,48293u,2803u},{48294u,48305u,15320u},{48307u,48310u,15332u},
+{48311u,48311u,2804u},{48312u,48317u,15336u},{48321u,48337u,15342u},{48339u,48349u,15359u},
+{48353u,48354u,2805u},{48355u,48356u,15370u},{48357u,48357u,2807u},{48358u,48360u,15372u},
+{48361u,48361u,2808u},{48362u,48368u,15375u},{48369u,48369u,2809u},{48371u,48371u,2810u},
+{48372u,48372u,15382u},{48373u,48375u,2811u},{48376u,48381u,15383u},{48449u,48449u,2814u},
+{48450u,48465u,15389u},{48467u,48470u,15405u},{48471u,48471u,2815u},{48472u,48477u,15409u},
+{48481u,48481u,2816u},{48482u,48497u,15415u},{48499u,48501u,15431u},{48502u,48502u,2817u},
+{48503u,48509u,15434u},{48513u,48529u,15441u},{48531u,48541u,15458u},{48545u,48546u,2818u},
+{48547u,48548u,15469u},{48549u,48549u,2820u},{48550u,48552u,15471u},{48553u,48553u,2821u},
+{48554u,48560u,15474u},{48561u,48561u,2822u},{48563u,48563u,2823u},{48564u,48564u,15481u},
+{48565u,48565u,2824u},{48566u,48566u,15482u},{48567u,48567u,2825u},{48568u,48568u,15483u},
+{48569u,48569u,2826u},{48570u,48573u,15484u},{48577u,48578u,2827u},{48579u,48584u,15488u},
+{48585u,48585u,2829u},{48586u,48593u,15494u},{48595u,48597u,15502u},{48598u,48598u,2830u},
+{48599u,48605u,15505u},{48609u,48609u,2831u},{48610u,48625u,15512u},{48627u,48629u,15528u},
+{48630u,48630u,2832u},{48631u,48637u,15531u},{48705u,48705u,2833u},{48706u,48708u,15538u},
+{48709u,48709u,2834u},{48710u,48712u,15541u},{48713u,48713u,2835u},{48714u,48720u,15544u},
+{48721u,48721u,2836u},{48723u,48723u,2837u},{48724u,48733u,15551u},{48737u,48753u,15561u},
+{48755u,48758u,15578u},{48759u,48759u,2838u},{48760u,48765u,15582u},{48769u,48770u,2839u},
+{48771u,48772u,15588u},{48773u,48773u,2841u},{48774u,48776u,15590u},{48777u,48777u,2842u},
+{48778u,48784u,15593u},{48785u,48785u,2843u},{48787u,48787u,2844u},{48788u,48790u,15600u},
+{48791u,48791u,2845u},{48792u,48797u,15603u},{48801u,48801u,2846u},{48802u,48817u,15609u},
+{48819u,48821u,15625u},{48822u,48823u,2847u},{48824u,48829u,15628u},{48833u,48849u,15634u},
+{48851u,48861u,15651u},{48865u,48865u,2849u},{48866u,48881u,15662u},{48883u,48893u,15678u},
+{48961u,48961u,2850u},{48962u,48977u,15689u},{48979u,48989u,15705u},{48993u,48993u,2851u},
+{48994u,49008u,15716u},{49009u,49009u,2852u},{49011u,49012u,15731u},{49013u,49013u,2853u},
+{49014u,49014u,15733u},{49015u,49015u,2854u},{49016u,49021u,15734u},{49025u,49041u,15740u},
+{49043u,49053u,15757u},{49057u,49058u,2855u},{49059u,49060u,15768u},{49061u,49061u,2857u},
+{49062u,49064u,15770u},{49065u,49065u,2858u},{49066u,49072u,15773u},{49073u,49073u,2859u},
+{49075u,49075u,2860u},{49076u,49078u,15780u},{49079u,49080u,2861u},{49081u,49084u,15783u},
+{49085u,49085u,2863u},{49217u,49217u,383u},{49249u,49250u,2864u},{49251u,49252u,15787u},
+{49253u,49253u,2866u},{49254u,49254u,15789u},{49255u,49255u,2867u},{49256u,49256u,15790u},
+{49257u,49257u,2868u},{49258u,49264u,15791u},{49265u,49265u,2869u},{49267u,49267u,2870u},
+{49268u,49268u,15798u},{49269u,49272u,2871u},{49273u,49277u,15799u},{49281u,49282u,2875u},
+{49283u,49284u,15804u},{49285u,49285u,2877u},{49286u,49288u,15806u},{49289u,49289u,2878u},
+{49290u,49296u,15809u},{49297u,49297u,2879u},{49299u,49299u,2880u},{49300u,49300u,15816u},
+{49301u,49303u,2881u},{49304u,49309u,15817u},{49313u,49313u,2884u},{49314u,49316u,15823u},
+{49317u,49317u,2885u},{49318u,49318u,15826u},{49319u,49319u,2886u},{49320u,49320u,15827u},
+{49321u,49321u,2887u},{49322u,49328u,15828u},{49329u,49329u,2888u},{49331u,49334u,15835u},
+{49335u,49335u,2889u},{49336u,49341u,15839u},{49345u,49361u,15845u},{49363u,49373u,15862u},
+{49377u,49378u,2890u},{49379u,49380u,15873u},{49381u,49381u,2892u},{49382u,49384u,15875u},
+{49385u,49385u,2893u},{49386u,49392u,15878u},{49393u,49393u,2894u},{49395u,49395u,2895u},
+{49396u,49396u,15885u},{49397u,49399u,2896u},{49400u,49405u,15886u},{49473u,49474u,2899u},
+{49475u,49476u,15892u},{49477u,49477u,2901u},{49478u,49480u,15894u},{49481u,49481u,2902u},
+{49482u,49488u,15897u},{49489u,49489u,2903u},{49491u,49491u,2904u},{49492u,49492u,15904u},
+{49493u,49493u,2905u},{49494u,49494u,15905u},{49495u,49495u,2906u},{49496u,49501u,15906u},
+{49505u,49505u,2907u},{49506u,49508u,15912u},{49509u,49509u,2908u},{49510u,49521u,15915u},
+{49523u,49525u,15927u},{49526u,49526u,2909u},{49527u,49533u,15930u},{49537u,49537u,2910u},
+{49538u,49540u,15937u},{49541u,49541u,2911u},{49542u,49553u,15940u},{49555u,49558u,15952u},
+{49559u,49559u,2912u},{49560u,49565u,15956u},{49569u,49570u,2913u},{49571u,49572u,15962u},
+{49573u,49573u,2915u},{49574u,49576u,15964u},{49577u,49577u,2916u},{49578u,49584u,15967u},
+{49585u,49585u,2917u},{49587u,49587u,2918u},{49588u,49588u,15974u},{49589u,49589u,2919u},
+{49590u,49590u,15975u},{49591u,49591u,2920u},{49592u,49597u,15976u},{49601u,49601u,2921u},
+{49602u,49604u,15982u},{49605u,49605u,2922u},{49606u,49608u,15985u},{49609u,49609u,2923u},
+{49610u,49617u,15988u},{49619u,49622u,15996u},{49623u,49623u,2924u},{49624u,49629u,16000u},
+{49633u,49649u,16006u},{49651u,49661u,16023u},{49729u,49729u,2925u},{49730u,49732u,16034u},
+{49733u,49733u,2926u},{49734u,49736u,16037u},{49737u,49737u,2927u},{49738u,49744u,16040u},
+{49745u,49745u,2928u},{49747u,49747u,2929u},{49748u,49748u,16047u},{49749u,49749u,2930u},
+{49750u,49750u,16048u},{49751u,49751u,2931u},{49752u,49757u,16049u},{49761u,49761u,2932u},
+{49762u,49776u,16055u},{49777u,49777u,2933u},{49779u,49789u,16070u},{49793u,49794u,2934u},
+{49795u,49796u,16081u},{49797u,49797u,2936u},{49798u,49800u,16083u},{49801u,49801u,2937u},
+{49802u,49808u,16086u},{49809u,49809u,2938u},{49811u,49811u,2939u},{49812u,49812u,16093u},
+{49813u,49813u,2940u},{49814u,49814u,16094u},{49815u,49815u,2941u},{49816u,49821u,16095u},
+{49825u,49825u,2942u},{49826u,49841u,16101u},{49843u,49845u,16117u},{49846u,49846u,2943u},
+{49847u,49853u,16120u},{49857u,49857u,2944u},{49858u,49860u,16127u},{49861u,49861u,2945u},
+{49862u,49873u,16130u},{49875u,49885u,16142u},{49889u,49889u,2946u},{49890u,49892u,16153u},
+{49893u,49893u,2947u},{49894u,49896u,16156u},{49897u,49897u,2948u},{49898u,49904u,16159u},
+{49905u,49905u,2949u},{49907u,49907u,2950u},{49908u,49908u,16166u},{49909u,49909u,2951u},
+{49910u,49910u,16167u},{49911u,49911u,2952u},{49912u,49917u,16168u},{49985u,49985u,2953u},
+{49986u,49988u,16174u},{49989u,49989u,2954u},{49990u,49992u,16177u},{49993u,49993u,2955u},
+{49994u,50000u,16180u},{50001u,50001u,2956u},{50003u,50006u,16187u},{50007u,50007u,2957u},
+{50008u,50013u,16191u},{50017u,50018u,2958u},{50019u,50020u,16197u},{50021u,50021u,2960u},
+{50022u,50024u,16199u},{50025u,50025u,2961u},{50026u,50032u,16202u},{50033u,50033u,2962u},
+{50035u,50035u,2963u},{50036u,50036u,16209u},{50037u,50037u,2964u},{50038u,50038u,16210u},
+{50039u,50039u,2965u},{50040u,50045u,16211u},{50049u,50065u,16217u},{50067u,50077u,16234u},
+{50081u,50082u,2966u},{50083u,50084u,16245u},{50085u,50085u,2968u},{50086u,50087u,16247u},
+{50088u,50090u,2969u},{50091u,50096u,16249u},{50097u,50097u,2972u},{50099u,50099u,2973u},
+{50100u,50100u,16255u},{50101u,50101u,2974u},{50102u,50102u,16256u},{50103u,50103u,2975u},
+{50104u,50109u,16257u},{50241u,50241u,384u},{50273u,50274u,2976u},{50275u,50276u,16263u},
+{50277u,50277u,2978u},{50278u,50280u,16265u},{50281u,50281u,2979u},{50282u,50288u,16268u},
+{50289u,50289u,2980u},{50291u,50291u,2981u},{50292u,50292u,16275u},{50293u,50293u,2982u},
+{50294u,50294u,16276u},{50295u,50295u,2983u},{50296u,50301u,16277u},{50305u,50306u,2984u},
+{50307u,50308u,16283u},{50309u,50309u,2986u},{50310u,50312u,16285u},{50313u,50313u,2987u},
+{50314u,50320u,16288u},{50321u,50321u,2988u},{50323u,50323u,2989u},{50324u,50324u,16295u},
+{50325u,50327u,2990u},{50328u,50333u,16296u},{50337u,50338u,2993u},{50339u,50353u,16302u},
+{50355u,50358u,16317u},{50359u,50359u,2995u},{50360u,50365u,16321u},{50369u,50385u,16327u},
+{50387u,50397u,16344u},{50401u,50402u,2996u},{50403u,50404u,16355u},{50405u,50405u,2998u},
+{50406u,50407u,16357u},{50408u,50409u,2999u},{50410u,50416u,16359u},{50417u,50417u,3001u},
+{50419u,50419u,3002u},{50420u,50420u,16366u},{50421u,50423u,3003u},{50424u,50429u,16367u},
+{50497u,50498u,3006u},{50499u,50500u,16373u},{50501u,50501u,3008u},{50502u,50504u,16375u},
+{50505u,50505u,3009u},{50506u,50512u,16378u},{50513u,50513u,3010u},{50515u,50515u,3011u},
+{50516u,50516u,16385u},{50517u,50517u,3012u},{50518u,50518u,16386u},{50519u,50519u,3013u},
+{50520u,50525u,16387u},{50529u,50529u,3014u},{50530u,50532u,16393u},{50533u,50533u,3015u},
+{50534u,50536u,16396u},{50537u,50537u,3016u},{50538u,50544u,16399u},{50545u,50545u,3017u},
+{50547u,50547u,3018u},{50548u,50548u,16406u},{50549u,50551u,3019u},{50552u,50557u,16407u},
+{50561u,50561u,3022u},{50562u,50577u,16413u},{50579u,50589u,16429u},{50593u,50594u,3023u},
+{50595u,50596u,16440u},{50597u,50597u,3025u},{50598u,50600u,16442u},{50601u,50601u,3026u},
+{50602u,50608u,16445u},{50609u,50609u,3027u},{50611u,50611u,3028u},{50612u,50612u,16452u},
+{50613u,50613u,3029u},{50614u,50614u,16453u},{50615u,50615u,3030u},{50616u,50621u,16454u},
+{50625u,50626u,3031u},{50627u,50628u,16460u},{50629u,50629u,3033u},{50630u,50632u,16462u},
+{50633u,50633u,3034u},{50634u,50640u,16465u},{50641u,50641u,3035u},{50643u,50646u,16472u},
+{50647u,50647u,3036u},{50648u,50653u,16476u},{50657u,50657u,3037u},{50658u,50673u,16482u},
+{50675u,50678u,16498u},{50679u,50679u,3038u},{50680u,50685u,16502u},{50753u,50753u,3039u},
+{50754u,50760u,16508u},{50761u,50761u,3040u},{50762u,50769u,16515u},{50771u,50781u,16523u},
+{50785u,50785u,3041u},{50786u,50801u,16534u},{50803u,50813u,16550u},{50817u,50818u,3042u},
+{50819u,50820u,16561u},{50821u,50821u,3044u},{50822u,50824u,16563u},{50825u,50825u,3045u},
+{50826u,50832u,16566u},{50833u,50833u,3046u},{50835u,50835u,3047u},{50836u,50836u,16573u},
+{50837u,50837u,3048u},{50838u,50838u,16574u},{50839u,50839u,3049u},{50840u,50845u,16575u},
+{50849u,50849u,3050u},{50850u,50852u,16581u},{50853u,50853u,3051u},{50854u,50856u,16584u},
+{50857u,50857u,3052u},{50858u,50865u,16587u},{50867u,50870u,16595u},{50871u,50871u,3053u},
+{50872u,50877u,16599u},{50881u,50881u,3054u},{50882u,50897u,16605u},{50899u,50902u,16621u},
+{50903u,50903u,3055u},{50904u,50909u,16625u},{50913u,50914u,3056u},{50915u,50916u,16631u},
+{50917u,50917u,3058u},{50918u,50920u,16633u},{50921u,50921u,3059u},{50922u,50928u,16636u},
+{50929u,50929u,3060u},{50931u,50931u,3061u},{50932u,50932u,16643u},{50933u,50933u,3062u},
+{50934u,50934u,16644u},{50935u,50935u,3063u},{50936u,50941u,16645u},{51009u,51009u,3064u},
+{51010u,51012u,16651u},{51013u,51013u,3065u},{51014u,51016u,16654u},{51017u,51017u,3066u},
+{51018u,51024u,16657u},{51025u,51025u,3067u},{51027u,51037u,16664u},{51041u,51042u,3068u},
+{51043u,51044u,16675u},{51045u,51045u,3070u},{51046u,51048u,16677u},{51049u,51049u,3071u},
+{51050u,51056u,16680u},{51057u,51057u,3072u},{51059u,51059u,3073u},{51060u,51062u,16687u},
+{51063u,51063u,3074u},{51064u,51069u,16690u},{51073u,51089u,16696u},{51091u,51101u,16713u},
+{51105u,51106u,3075u},{51107u,51108u,16724u},{51109u,51109u,3077u},{51110u,51112u,16726u},
+{51113u,51113u,3078u},{51114u,51120u,16729u},{51121u,51121u,3079u},{51123u,51123u,3080u},
+{51124u,51124u,16736u},{51125u,51125u,3081u},{51126u,51126u,16737u},{51127u,51127u,3082u},
+{51128u,51133u,16738u},{51265u,51265u,385u},{51297u,51298u,3083u},{51299u,51300u,16744u},
+{51301u,51301u,3085u},{51302u,51304u,16746u},{51305u,51306u,3086u},{51307u,51312u,16749u},
+{51313u,51313u,3088u},{51315u,51315u,3089u},{51316u,51316u,16755u},{51317u,51319u,3090u},
+{51320u,51325u,16756u},{51329u,51330u,3093u},{51331u,51332u,16762u},{51333u,51333u,3095u},
+{51334u,51336u,16764u},{51337u,51337u,3096u},{51338u,51344u,16767u},{51345u,51345u,3097u},
+{51347u,51347u,3098u},{51348u,51348u,16774u},{51349u,51351u,3099u},{51352u,51357u,16775u},
+{51361u,51361u,3102u},{51362u,51377u,16781u},{51379u,51382u,16797u},{51383u,51383u,3103u},
+{51384u,51389u,16801u},{51393u,51409u,16807u},{51411u,51421u,16824u},{51425u,51426u,3104u},
+{51427u,51428u,16835u},{51429u,51429u,3106u},{51430u,51432u,16837u},{51433u,51433u,3107u},
+{51434u,51434u,16840u},{51435u,51435u,3108u},{51436u,51440u,16841u},{51441u,51441u,3109u},
+{51443u,51443u,3110u},{51444u,51444u,16846u},{51445u,51447u,3111u},{51448u,51453u,16847u},
+{51521u,51522u,3114u},{51523u,51524u,16853u},{51525u,51525u,3116u},{51526u,51528u,16855u},
+{51529u,51529u,3117u},{51530u,51536u,16858u},{51537u,51537u,3118u},{51539u,51539u,3119u},
+{51540u,51540u,16865u},{51541u,51541u,3120u},{51542u,51542u,16866u},{51543u,51543u,3121u},
+{51544u,51549u,16867u},{51553u,51553u,3122u},{51554u,51556u,16873u},{51557u,51557u,3123u},
+{51558u,51569u,16876u},{51571u,51573u,16888u},{51574u,51574u,3124u},{51575u,51581u,16891u},
+{51585u,51585u,3125u},{51586u,51588u,16898u},{51589u,51589u,3126u},{51590u,51601u,16901u},
+{51603u,51613u,16913u},{51617u,51618u,3127u},{51619u,51620u,16924u},{51621u,51621u,3129u},
+{51622u,51624u,16926u},{51625u,51625u,3130u},{51626u,51632u,16929u},{51633u,51633u,3131u},
+{51635u,51635u,3132u},{51636u,51636u,16936u},{51637u,51637u,3133u},{51638u,51638u,16937u},
+{51639u,51639u,3134u},{51640u,51643u,16938u},{51644u,51644u,3135u},{51645u,51645u,16942u},
+{51649u,51649u,3136u},{51650u,51652u,16943u},{51653u,51653u,3137u},{51654u,51665u,16946u},
+{51667u,51677u,16958u},{51681u,51681u,3138u},{51682u,51697u,16969u},{51699u,51709u,16985u},
+{51777u,51777u,3139u},{51778u,51780u,16996u},{51781u,51781u,3140u},{51782u,51793u,16999u},
+{51795u,51796u,17011u},{51797u,51797u,3141u},{51798u,51798u,17013u},{51799u,51799u,3142u},
+{51800u,51805u,17014u},{51809u,51809u,3143u},{51810u,51825u,17020u},{51827u,51837u,17036u},
+{51841u,51842u,3144u},{51843u,51844u,17047u},{51845u,51845u,3146u},{51846u,51848u,17049u},
+{51849u,51849u,3147u},{51850u,51856u,17052u},{51857u,51857u,3148u},{51859u,51859u,3149u},
+{51860u,51860u,17059u},{51861u,51861u,3150u},{51862u,51862u,17060u},{51863u,51863u,3151u},
+{51864u,51869u,17061u},{51873u,51873u,3152u},{51874u,51889u,17067u},{51891u,51893u,17083u},
+{51894u,51894u,3153u},{51895u,51901u,17086u},{51905u,51905u,3154u},{51906u,51921u,17093u},
+{51923u,51933u,17109u},{51937u,51938u,3155u},{51939u,51940u,17120u},{51941u,51941u,3157u},
+{51942u,51944u,17122u},{51945u,51945u,3158u},{51946u,51952u,17125u},{51953u,51953u,3159u},
+{51955u,51955u,3160u},{51956u,51958u,17132u},{51959u,51959u,3161u},{51960u,51965u,17135u},
+{52033u,52033u,3162u},{52034u,52036u,17141u},{52037u,52037u,3163u},{52038u,52040u,17144u},
+{52041u,52041u,3164u},{52042u,52048u,17147u},{52049u,52049u,3165u},{52051u,52054u,17154u},
+{52055u,52055u,3166u},{52056u,52061u,17158u},{52065u,52066u,3167u},{52067u,52068u,17164u},
+{52069u,52069u,3169u},{52070u,52071u,17166u},{52072u,52073u,3170u},{52074u,52074u,17168u},
+{52075u,52075u,3172u},{52076u,52080u,17169u},{52081u,52081u,3173u},{52083u,52083u,3174u},
+{52084u,52084u,17174u},{52085u,52085u,3175u},{52086u,52093u,17175u},{52097u,52097u,3176u},
+{52098u,52100u,17183u},{52101u,52101u,3177u},{52102u,52104u,17186u},{52105u,52105u,3178u},
+{52106u,52112u,17189u},{52113u,52113u,3179u},{52115u,52115u,3180u},{52116u,52125u,17196u},
+{52129u,52130u,3181u},{52131u,52132u,17206u},{52133u,52133u,3183u},{52134u,52136u,17208u},
+{52137u,52137u,3184u},{52138u,52144u,17211u},{52145u,52145u,3185u},{52147u,52147u,3186u},
+{52148u,52148u,17218u},{52149u,52149u,3187u},{52150u,52150u,17219u},{52151u,52151u,3188u},
+{52152u,52157u,17220u},{52289u,52289u,386u},{52321u,52323u,3189u},{52324u,52324u,17226u},
+{52325u,52325u,3192u},{52326u,52328u,17227u},{52329u,52329u,3193u},{52330u,52330u,17230u},
+{52331u,52331u,3194u},{52332u,52336u,17231u},{52337u,52337u,3195u},{52339u,52339u,3196u},
+{52340u,52340u,17236u},{52341u,52343u,3197u},{52344u,52346u,17237u},{52347u,52347u,3200u},
+{52348u,52349u,17240u},{52353u,52354u,3201u},{52355u,52356u,17242u},{52357u,52357u,3203u},
+{52358u,52360u,17244u},{52361u,52361u,3204u},{52362u,52368u,17247u},{52369u,52369u,3205u},
+{52371u,52371u,3206u},{52372u,52372u,17254u},{52373u,52375u,3207u},{52376u,52381u,17255u},
+{52385u,52386u,3210u},{52387u,52401u,17261u},{52403u,52413u,17276u},{52417u,52433u,17287u},
+{52435u,52445u,17304u},{52449u,52450u,3212u},{52451u,52452u,17315u},{52453u,52453u,3214u},
+{52454u,52456u,17317u},{52457u,52457u,3215u},{52458u,52464u,17320u},{52465u,52465u,3216u},
+{52467u,52467u,3217u},{52468u,52468u,17327u},{52469u,52471u,3218u},{52472u,52477u,17328u},
+{52545u,52546u,3221u},{52547u,52548u,17334u},{52549u,52549u,3223u},{52550u,52552u,17336u},
+{52553u,52553u,3224u},{52554u,52560u,17339u},{52561u,52561u,3225u},{52563u,52563u,3226u},
+{52564u,52564u,17346u},{52565u,52565u,3227u},{52566u,52566u,17347u},{52567u,52567u,3228u},
+{52568u,52573u,17348u},{52577u,52577u,3229u},{52578u,52580u,17354u},{52581u,52581u,3230u},
+{52582u,52584u,17357u},{52585u,52585u,3231u},{52586u,52592u,17360u},{52593u,52593u,3232u},
+{52595u,52595u,3233u},{52596u,52597u,17367u},{52598u,52599u,3234u},{52600u,52605u,17369u},
+{52609u,52609u,3236u},{52610u,52616u,17375u},{52617u,52617u,3237u},{52618u,52625u,17382u},
+{52627u,52627u,3238u},{52628u,52628u,17390u},{52629u,52629u,3239u},{52630u,52637u,17391u},
+{52641u,52642u,3240u},{52643u,52644u,17399u},{52645u,52645u,3242u},{52646u,52648u,17401u},
+{52649u,52649u,3243u},{52650u,52656u,17404u},{52657u,52657u,3244u},{52659u,52659u,3245u},
+{52660u,52660u,17411u},{52661u,52661u,3246u},{52662u,52662u,17412u},{52663u,52663u,3247u},
+{52664u,52669u,17413u},{52673u,52673u,3248u},{52674u,52689u,17419u},{52691u,52694u,17435u},
+{52695u,52695u,3249u},{52696u,52701u,17439u},{52705u,52721u,17445u},{52723u,52733u,17462u},
+{52801u,52801u,3250u},{52802u,52804u,17473u},{52805u,52805u,3251u},{52806u,52817u,17476u},
+{52819u,52829u,17488u},{52833u,52833u,3252u},{52834u,52836u,17499u},{52837u,52837u,3253u},
+{52838u,52840u,17502u},{52841u,52841u,3254u},{52842u,52849u,17505u},{52851u,52851u,3255u},
+{52852u,52852u,17513u},{52853u,52853u,3256u},{52854u,52861u,17514u},{52865u,52866u,3257u},
+{52867u,52868u,17522u},{52869u,52869u,3259u},{52870u,52871u,17524u},{52872u,52873u,3260u},
+{52874u,52874u,17526u},{52875u,52875u,3262u},{52876u,52880u,17527u},{52881u,52881u,3263u},
+{52883u,52883u,3264u},{52884u,52884u,17532u},{52885u,52885u,3265u},{52886u,52886u,17533u},
+{52887u,52887u,3266u},{52888u,52893u,17534u},{52897u,52897u,3267u},{52898u,52913u,17540u},
+{52915u,52918u,17556u},{52919u,52919u,3268u},{52920u,52925u,17560u},{52929u,52945u,17566u},
+{52947u,52957u,17583u},{52961u,52961u,3269u},{52962u,52964u,17594u},{52965u,52965u,3270u},
+{52966u,52968u,17597u},{52969u,52969u,3271u},{52970u,52976u,17600u},{52977u,52977u,3272u},
+{52979u,52980u,17607u},{52981u,52981u,3273u},{52982u,52989u,17609u},{53057u,53057u,3274u},
+{53058u,53060u,17617u},{53061u,53061u,3275u},{53062u,53064u,17620u},{53065u,53065u,3276u},
+{53066u,53072u,17623u},{53073u,53073u,3277u},{53075u,53076u,17630u},{53077u,53077u,3278u},
+{53078u,53078u,17632u},{53079u,53079u,3279u},{53080u,53085u,17633u},{53089u,53089u,3280u},
+{53090u,53092u,17639u},{53093u,53093u,3281u},{53094u,53096u,17642u},{53097u,53097u,3282u},
+{53098u,53104u,17645u},{53105u,53105u,3283u},{53107u,53107u,3284u},{53108u,53108u,17652u},
+{53109u,53109u,3285u},{53110u,53117u,17653u},{53121u,53137u,17661u},{53139u,53149u,17678u},
+{53153u,53154u,3286u},{53155u,53156u,17689u},{53157u,53157u,3288u},{53158u,53160u,17691u},
+{53161u,53161u,3289u},{53162u,53168u,17694u},{53169u,53169u,3290u},{53171u,53171u,3291u},
+{53172u,53172u,17701u},{53173u,53173u,3292u},{53174u,53174u,17702u},{53175u,53175u,3293u},
+{53176u,53181u,17703u},{53313u,53313u,387u},{53345u,53346u,3294u},{53347u,53348u,17709u},
+{53349u,53349u,3296u},{53350u,53352u,17711u},{53353u,53353u,3297u},{53354u,53357u,17714u},
+{53358u,53358u,3298u},{53359u,53360u,17718u},{53361u,53361u,3299u},{53363u,53363u,3300u},
+{53364u,53364u,17720u},{53365u,53365u,3301u},{53366u,53366u,17721u},{53367u,53367u,3302u},
+{53368u,53373u,17722u},{53377u,53378u,3303u},{53379u,53380u,17728u},{53381u,53381u,3305u},
+{53382u,53384u,17730u},{53385u,53385u,3306u},{53386u,53392u,17733u},{53393u,53393u,3307u},
+{53395u,53395u,3308u},{53396u,53396u,17740u},{53397u,53399u,3309u},{53400u,53405u,17741u},
+{53409u,53409u,3312u},{53410u,53425u,17747u},{53427u,53430u,17763u},{53431u,53431u,3313u},
+{53432u,53437u,17767u},{53441u,53457u,17773u},{53459u,53469u,17790u},{53473u,53474u,3314u},
+{53475u,53476u,17801u},{53477u,53477u,3316u},{53478u,53480u,17803u},{53481u,53481u,3317u},
+{53482u,53482u,17806u},{53483u,53483u,3318u},{53484u,53488u,17807u},{53489u,53489u,3319u},
+{53491u,53491u,3320u},{53492u,53492u,17812u},{53493u,53493u,3321u},{53494u,53494u,17813u},
+{53495u,53495u,3322u},{53496u,53501u,17814u},{53569u,53570u,3323u},{53571u,53572u,17820u},
+{53573u,53573u,3325u},{53574u,53576u,17822u},{53577u,53577u,3326u},{53578u,53584u,17825u},
+{53585u,53585u,3327u},{53587u,53587u,3328u},{53588u,53588u,17832u},{53589u,53589u,3329u},
+{53590u,53590u,17833u},{53591u,53591u,3330u},{53592u,53597u,17834u},{53601u,53602u,3331u},
+{53603u,53604u,17840u},{53605u,53605u,3333u},{53606u,53608u,17842u},{53609u,53609u,3334u},
+{53610u,53616u,17845u},{53617u,53617u,3335u},{53619u,53619u,3336u},{53620u,53620u,17852u},
+{53621u,53623u,3337u},{53624u,53629u,17853u},{53633u,53633u,3340u},{53634u,53636u,17859u},
+{53637u,53637u,3341u},{53638u,53640u,17862u},{53641u,53641u,3342u},{53642u,53649u,17865u},
+{53651u,53651u,3343u},{53652u,53661u,17873u},{53665u,53666u,3344u},{53667u,53668u,17883u},
+{53669u,53669u,3346u},{53670u,53672u,17885u},{53673u,53673u,3347u},{53674u,53677u,17888u},
+{53678u,53678u,3348u},{53679u,53680u,17892u},{53681u,53681u,3349u},{53683u,53683u,3350u},
+{53684u,53684u,17894u},{53685u,53685u,3351u},{53686u,53686u,17895u},{53687u,53687u,3352u},
+{53688u,53690u,17896u},{53691u,53691u,3353u},{53692u,53693u,17899u},{53697u,53698u,3354u},
+{53699u,53700u,17901u},{53701u,53701u,3356u},{53702u,53704u,17903u},{53705u,53705u,3357u},
+{53706u,53713u,17906u},{53715u,53716u,17914u},{53717u,53717u,3358u},{53718u,53718u,17916u},
+{53719u,53719u,3359u},{53720u,53725u,17917u},{53729u,53730u,3360u},{53731u,53732u,17923u},
+{53733u,53733u,3362u},{53734u,53745u,17925u},{53747u,53748u,17937u},{53749u,53749u,3363u},
+{53750u,53750u,17939u},{53751u,53751u,3364u},{53752u,53757u,17940u},{53825u,53826u,3365u},
+{53827u,53828u,17946u},{53829u,53829u,3367u},{53830u,53832u,17948u},{53833u,53833u,3368u},
+{53834u,53841u,17951u},{53843u,53843u,3369u},{53844u,53844u,17959u},{53845u,53845u,3370u},
+{53846u,53846u,17960u},{53847u,53847u,3371u},{53848u,53853u,17961u},{53857u,53857u,3372u},
+{53858u,53860u,17967u},{53861u,53861u,3373u},{53862u,53864u,17970u},{53865u,53865u,3374u},
+{53866u,53873u,17973u},{53875u,53875u,3375u},{53876u,53876u,17981u},{53877u,53877u,3376u},
+{53878u,53885u,17982u},{53889u,53890u,3377u},{53891u,53892u,17990u},{53893u,53893u,3379u},
+{53894u,53896u,17992u},{53897u,53897u,3380u},{53898u,53901u,17995u},{53902u,53902u,3381u},
+{53903u,53904u,17999u},{53905u,53905u,3382u},{53907u,53908u,18001u},{53909u,53909u,3383u},
+{53910u,53910u,18003u},{53911u,53911u,3384u},{53912u,53917u,18004u},{53921u,53921u,3385u},
+{53922u,53924u,18010u},{53925u,53925u,3386u},{53926u,53928u,18013u},{53929u,53929u,3387u},
+{53930u,53936u,18016u},{53937u,53937u,3388u},{53939u,53942u,18023u},{53943u,53943u,3389u},
+{53944u,53949u,18027u},{53953u,53954u,3390u},{53955u,53956u,18033u},{53957u,53957u,3392u},
+{53958u,53960u,18035u},{53961u,53961u,3393u},{53962u,53969u,18038u},{53971u,53974u,18046u},
+{53975u,53975u,3394u},{53976u,53981u,18050u},{53985u,53986u,3395u},{53987u,53988u,18056u},
+{53989u,53989u,3397u},{53990u,53992u,18058u},{53993u,53993u,3398u},{53994u,54000u,18061u},
+{54001u,54001u,3399u},{54003u,54003u,3400u},{54004u,54004u,18068u},{54005u,54005u,3401u},
+{54006u,54006u,18069u},{54007u,54007u,3402u},{54008u,54013u,18070u},{54081u,54082u,3403u},
+{54083u,54084u,18076u},{54085u,54085u,3405u},{54086u,54088u,18078u},{54089u,54089u,3406u},
+{54090u,54096u,18081u},{54097u,54097u,3407u},{54099u,54100u,18088u},{54101u,54101u,3408u},
+{54102u,54102u,18090u},{54103u,54103u,3409u},{54104u,54109u,18091u},{54113u,54114u,3410u},
+{54115u,54116u,18097u},{54117u,54117u,3412u},{54118u,54118u,18099u},{54119u,54122u,3413u},
+{54123u,54128u,18100u},{54129u,54129u,3417u},{54131u,54131u,3418u},{54132u,54132u,18106u},
+{54133u,54133u,3419u},{54134u,54134u,18107u},{54135u,54135u,3420u},{54136u,54138u,18108u},
+{54139u,54139u,3421u},{54140u,54141u,18111u},{54145u,54145u,3422u},{54146u,54148u,18113u},
+{54149u,54149u,3423u},{54150u,54152u,18116u},{54153u,54153u,3424u},{54154u,54160u,18119u},
+{54161u,54161u,3425u},{54163u,54163u,3426u},{54164u,54166u,18126u},{54167u,54167u,3427u},
+{54168u,54173u,18129u},{54177u,54178u,3428u},{54179u,54180u,18135u},{54181u,54181u,3430u},
+{54182u,54184u,18137u},{54185u,54185u,3431u},{54186u,54192u,18140u},{54193u,54193u,3432u},
+{54195u,54195u,3433u},{54196u,54196u,18147u},{54197u,54197u,3434u},{54198u,54198u,18148u},
+{54199u,54199u,3435u},{54200u,54205u,18149u},{55601u,55678u,101u},{55697u,55781u,179u},
+{55857u,55934u,264u},{55953u,55968u,342u},{56021u,56062u,409u},{56113u,56122u,451u},
+{56128u,56137u,461u},{56145u,56168u,471u},{56177u,56190u,495u},{56209u,56218u,509u},
+{56225u,56292u,519u},{56369u,56446u,587u},{56465u,56465u,665u},{56481u,56484u,666u},
+{56486u,56486u,670u},{56488u,56495u,671u},{56497u,56574u,679u},{56625u,56702u,757u},
+{56721u,56819u,835u},{56881u,56958u,934u},{56977u,56984u,1012u},{56993u,57025u,1020u},
+{57041u,57073u,1053u},{57393u,57470u,3436u},{57489u,57551u,3514u},{57552u,57552u,4116u},
+{57553u,57557u,3577u},{57558u,57558u,3678u},{57559u,57574u,3582u},{57575u,57575u,7053u},
+{57576u,57598u,3598u},{57649u,57726u,3621u},{57745u,57806u,3699u},{57807u,57807u,3460u},
+{57808u,57831u,3761u},{57832u,57832u,7900u},{57833u,57854u,3785u},{57905u,57916u,3807u},
+{57917u,57917u,3802u},{57918u,57982u,3819u},{58001u,58106u,3884u},{58107u,58107u,3902u},
+{58108u,58110u,3990u},{58161u,58161u,3993u},{58162u,58162u,3946u},{58163u,58183u,3994u},
+{58184u,58184u,3946u},{58185u,58207u,4015u},{58208u,58208u,3708u},{58209u,58220u,4038u},
+{58221u,58221u,4131u},{58222u,58238u,4050u},{58257u,58323u,4067u},{58324u,58324u,4374u},
+{58325u,58325u,4156u},{58326u,58327u,4134u},{58328u,58328u,4375u},{58329u,58330u,4136u},
+{58331u,58336u,4376u},{58337u,58337u,4138u},{58338u,58338u,5800u},{58339u,58341u,4382u},
+{58342u,58342u,4386u},{58343u,58343u,4139u},{58344u,58347u,4387u},{58348u,58348u,4140u},
+{58349u,58349u,4391u},{58350u,58350u,4141u},{58351u,58352u,4394u},{58353u,58353u,4142u},
+{58354u,58354u,4396u},{58355u,58357u,4143u},{58358u,58358u,4399u},{58359u,58361u,4146u},
+{58362u,58362u,4403u},{58363u,58363u,4149u},{58364u,58365u,4406u},{58366u,58366u,4409u},
+{58417u,58417u,4150u},{58418u,58419u,4410u},{58420u,58422u,4151u},{58423u,58426u,4412u},
+{58427u,58427u,4419u},{58428u,58428u,4154u},{58429u,58429u,4420u},{58430u,58433u,4155u},
+{58434u,58434u,4424u},{58435u,58445u,4159u},{58446u,58446u,4511u},{58447u,58449u,4170u},
+{58450u,58451u,4513u},{58452u,58452u,4517u},{58453u,58453u,4173u},{58454u,58458u,4518u},
+{58459u,58459u,4524u},{58460u,58460u,4174u},{58461u,58462u,4525u},{58463u,58468u,4528u},
+{58469u,58471u,4535u},{58472u,58472u,4175u},{58473u,58474u,4541u},{58475u,58477u,4176u},
+{58478u,58479u,4545u},{58480u,58480u,4179u},{58481u,58481u,4547u},{58482u,58482u,4550u},
+{58483u,58483u,4180u},{58484u,58484u,4564u},{58485u,58488u,4566u},{58489u,58490u,4571u},
+{58491u,58491u,4576u},{58492u,58494u,4181u},{58513u,58513u,4184u},{58514u,58517u,4604u},
+{58518u,58519u,4609u},{58520u,58520u,4185u},{58521u,58522u,4611u},{58523u,58622u,4186u},
+{58673u,58741u,4286u},{58742u,58742u,4318u},{58743u,58750u,4355u},{58769u,58781u,4363u},
+{58782u,58782u,4136u},{58783u,58788u,4376u},{58789u,58789u,5800u},{58790u,58794u,4382u},
+{58795u,58795u,4139u},{58796u,58797u,4387u},{58798u,58798u,4192u},{58799u,58878u,4389u},
+{58929u,58951u,4469u},{58952u,58952u,4167u},{58953u,58972u,4492u},{58973u,58973u,4172u},
+{58974u,59006u,4512u},{59025u,59082u,4545u},{59083u,59083u,5552u},{59084u,59107u,4603u},
+{59108u,59108u,6424u},{59109u,59134u,4627u},{59185u,59262u,4653u},{59281u,59390u,4731u},
+{59441u,59518u,4841u},{59537u,59588u,4919u},{59589u,59589u,5151u},{59590u,59619u,4971u},
+{59620u,59620u,4922u},{59621u,59646u,5001u},{59697u,59700u,5027u},{59701u,59701u,7518u},
+{59702u,59774u,5031u},{59793u,59812u,5104u},{59813u,59813u,5079u},{59814u,59860u,5124u},
+{59861u,59861u,5109u},{59862u,59891u,5171u},{59892u,59892u,7607u},{59893u,59902u,5201u},
+{59953u,60030u,5211u},{60049u,60061u,5289u},{60062u,60062u,5584u},{60063u,60063u,5302u},
+{60064u,60064u,5367u},{60065u,60082u,5303u},{60083u,60083u,7083u},{60084u,60128u,5321u},
+{60129u,60129u,5362u},{60130u,60135u,5366u},{60136u,60136u,5485u},{60137u,60158u,5372u},
+{60209u,60286u,5394u},{60305u,60306u,5472u},{60307u,60307u,6001u},{60308u,60332u,5474u},
+{60333u,60333u,5460u},{60334u,60396u,5499u},{60397u,60397u,5317u},{60398u,60414u,5562u},
+{60465u,60542u,5579u},{60561u,60660u,5657u},{60661u,60661u,7009u},{60662u,60670u,5757u},
+{60721u,60721u,7370u},{60722u,60728u,5766u},{60729u,60729u,5678u},{60730u,60798u,5773u},
+{60817u,60845u,5842u},{60846u,60846u,5874u},{60847u,60848u,5871u},{60849u,60850u,4425u},
+{60851u,60856u,5873u},{60857u,60857u,4427u},{60858u,60858u,5879u},{60859u,60860u,4429u},
+{60861u,60867u,5880u},{60868u,60868u,4431u},{60869u,60877u,5887u},{60878u,60878u,4435u},
+{60879u,60879u,5896u},{60880u,60880u,4436u},{60881u,60881u,5897u},{60882u,60882u,4437u},
+{60883u,60885u,5898u},{60886u,60886u,4439u},{60887u,60921u,5901u},{60922u,60923u,4442u},
+{60924u,60924u,4159u},{60925u,60925u,5936u},{60926u,60926u,4444u},{60977u,60977u,4447u},
+{60978u,60979u,5937u},{60980u,60980u,4449u},{60981u,60982u,5939u},{60983u,60983u,4450u},
+{60984u,60988u,5941u},{60989u,60989u,4453u},{60990u,60990u,5946u},{60991u,60993u,4455u},
+{60994u,60994u,5947u},{60995u,60995u,4458u},{60996u,60998u,5948u},{60999u,61000u,4459u},
+{61001u,61003u,5951u},{61004u,61004u,4463u},{61005u,61011u,5954u},{61012u,61012u,4160u},
+{61013u,61013u,5961u},{61014u,61015u,4465u},{61016u,61017u,5962u},{61018u,61018u,4161u},
+{61019u,61025u,5964u},{61026u,61026u,4468u},{61027u,61029u,5971u},{61030u,61030u,4469u},
+{61031u,61032u,5974u},{61033u,61033u,4470u},{61034u,61035u,5976u},{61036u,61036u,4162u},
+{61037u,61038u,5978u},{61039u,61039u,4471u},{61040u,61040u,5980u},{61041u,61041u,4472u},
+{61042u,61043u,5981u},{61044u,61044u,4474u},{61045u,61045u,4473u},{61046u,61046u,4475u},
+{61047u,61047u,5983u},{61048u,61048u,4476u},{61049u,61049u,5984u},{61050u,61051u,4478u},
+{61052u,61052u,6447u},{61053u,61054u,5985u},{61073u,61073u,4481u},{61074u,61074u,5987u},
+{61075u,61075u,4482u},{61076u,61076u,5460u},{61077u,61078u,5988u},{61079u,61079u,4483u},
+{61080u,61080u,4163u},{61081u,61081u,4166u},{61082u,61082u,5990u},{61083u,61083u,4485u},
+{61084u,61088u,5991u},{61089u,61089u,4487u},{61090u,61093u,5996u},{61094u,61094u,4488u},
+{61095u,61096u,6000u},{61097u,61097u,4489u},{61098u,61098u,4491u},{61099u,61099u,6002u},
+{61100u,61100u,4167u},{61101u,61101u,4493u},{61102u,61103u,6003u},{61104u,61104u,4494u},
+{61105u,61118u,6005u},{61119u,61119u,4495u},{61120u,61120u,6019u},{61121u,61121u,7783u},
+{61122u,61125u,6020u},{61126u,61126u,4497u},{61127u,61127u,4499u},{61128u,61130u,6024u},
+{61131u,61131u,4501u},{61132u,61132u,6027u},{61133u,61133u,4502u},{61134u,61134u,6028u},
+{61135u,61136u,4503u},{61137u,61138u,6029u},{61139u,61139u,4506u},{61140u,61150u,6031u},
+{61151u,61151u,4508u},{61152u,61155u,6042u},{61156u,61156u,4509u},{61157u,61157u,6046u},
+{61158u,61158u,4510u},{61159u,61174u,6047u},{61175u,61175u,5797u},{61176u,61182u,6063u},
+{61233u,61302u,6070u},{61303u,61304u,4551u},{61305u,61310u,6140u},{61329u,61329u,6146u},
+{61330u,61330u,4553u},{61331u,61331u,4180u},{61332u,61336u,6147u},{61337u,61337u,4555u},
+{61338u,61338u,6152u},{61339u,61339u,5800u},{61340u,61340u,6153u},{61341u,61341u,4556u},
+{61342u,61343u,6154u},{61344u,61344u,4557u},{61345u,61350u,6156u},{61351u,61351u,4560u},
+{61352u,61355u,6162u},{61356u,61356u,4561u},{61357u,61387u,6166u},{61388u,61388u,4563u},
+{61389u,61430u,6197u},{61431u,61431u,7988u},{61432u,61438u,6239u},{61489u,61520u,6246u},
+{61521u,61521u,6123u},{61522u,61556u,6278u},{61557u,61557u,4577u},{61558u,61566u,6313u},
+{61585u,61589u,6322u},{61590u,61590u,4183u},{61591u,61592u,6327u},{61593u,61593u,4579u},
+{61594u,61597u,6329u},{61598u,61598u,4581u},{61599u,61599u,6333u},{61600u,61600u,4582u},
+{61601u,61603u,6334u},{61604u,61604u,4584u},{61605u,61606u,6337u},{61607u,61607u,4586u},
+{61608u,61608u,6339u},{61609u,61609u,4588u},{61610u,61610u,4184u},{61611u,61625u,6340u},
+{61626u,61627u,4590u},{61628u,61628u,6355u},{61629u,61629u,4592u},{61630u,61632u,6356u},
+{61633u,61633u,4593u},{61634u,61634u,4595u},{61635u,61637u,6359u},{61638u,61639u,4596u},
+{61640u,61643u,6362u},{61644u,61644u,4599u},{61645u,61646u,6366u},{61647u,61649u,4600u},
+{61650u,61650u,5552u},{61651u,61655u,6368u},{61656u,61656u,4603u},{61657u,61694u,6373u},
+{61745u,61749u,6411u},{61750u,61750u,4614u},{61751u,61751u,4616u},{61752u,61753u,6416u},
+{61754u,61754u,4618u},{61755u,61758u,6418u},{61759u,61759u,5950u},{61760u,61761u,4620u},
+{61762u,61762u,4187u},{61763u,61764u,6422u},{61765u,61765u,4625u},{61766u,61767u,6424u},
+{61768u,61768u,4627u},{61769u,61769u,6426u},{61770u,61770u,4629u},{61771u,61775u,6427u},
+{61776u,61777u,4632u},{61778u,61780u,6432u},{61781u,61781u,4634u},{61782u,61782u,4636u},
+{61783u,61784u,6435u},{61785u,61786u,4188u},{61787u,61796u,6437u},{61797u,61797u,4638u},
+{61798u,61804u,6447u},{61805u,61806u,4640u},{61807u,61808u,6454u},{61809u,61809u,4642u},
+{61810u,61811u,6456u},{61812u,61812u,4644u},{61813u,61814u,6458u},{61815u,61816u,4645u},
+{61817u,61822u,6460u},{61841u,61848u,6466u},{61849u,61850u,4647u},{61851u,61851u,6474u},
+{61852u,61852u,4650u},{61853u,61856u,6475u},{61857u,61859u,4653u},{61860u,61933u,6479u},
+{61934u,61934u,5351u},{61935u,61950u,6553u},{62001u,62058u,6569u},{62059u,62059u,6494u},
+{62060u,62078u,6627u},{62097u,62206u,6646u},{62257u,62334u,6756u},{62353u,62462u,6834u},
+{62513u,62540u,6944u},{62541u,62541u,5731u},{62542u,62590u,6972u},{62609u,62619u,7021u},
+{62620u,62620u,5771u},{62621u,62640u,7032u},{62641u,62641u,4191u},{62642u,62718u,7052u},
+{62769u,62774u,7129u},{62775u,62775u,6484u},{62776u,62845u,7135u},{62846u,62846u,6684u},
+{62865u,62974u,7205u},{63025u,63102u,7315u},{63121u,63125u,7393u},{63126u,63126u,4279u},
+{63127u,63127u,7398u},{63128u,63128u,7139u},{63129u,63159u,7399u},{63160u,63160u,4247u},
+{63161u,63175u,7430u},{63176u,63176u,4266u},{63177u,63186u,7445u},{63187u,63187u,4340u},
+{63188u,63230u,7455u},{63281u,63338u,7498u},{63339u,63339u,7572u},{63340u,63358u,7556u},
+{63377u,63377u,7575u},{63378u,63378u,5088u},{63379u,63486u,7576u},{63537u,63537u,7709u},
+{63538u,63538u,3558u},{63539u,63605u,7684u},{63606u,63606u,3644u},{63607u,63614u,7751u},
+{63633u,63742u,7759u},{63793u,63800u,7869u},{63801u,63801u,3815u},{63802u,63870u,7877u},
+{63889u,63998u,7946u},
+};
+
+static pdf_cmap cmap_KSC_Johab_H = {
+	{-1, pdf_free_cmap_imp}, "KSC-Johab-H", "", 0, 0, 4,
+	{ {1,0u,128u},{2,33857u,54270u},{2,55345u,57086u},{2,57393u,63998u}, },
+	4137, 4137, (pdf_range*) cmap_KSC_Johab_H_ranges,
+	0, 0, NULL,
+	0, 0, NULL,
+};
+
+/* KSC-Johab-V */
+
+static const pdf_range cmap_KSC_Johab_V_ranges[] = {
+{55602u,55603u,8056u},{55605u,55605u,8058u},{55606u,55606u,8320u},{55609u,55611u,8059u},
+{55613u,55613u,8062u},{55618u,55629u,8063u},{55675u,55675u,8075u},{55857u,55857u,8076u},
+{55864u,55865u,8077u},{55868u,55868u,8079u},{55870u,55870u,8080u},{55882u,55887u,8081u},
+{55915u,55915u,8087u},{55917u,55917u,8088u},{55919u,55919u,8089u},{55965u,55968u,8090u},
+};
+
+static pdf_cmap cmap_KSC_Johab_V = {
+	{-1, pdf_free_cmap_imp}, "KSC-Johab-V", "KSC-Johab-H", 0, 1, 0,
+	{ {0,0,0}, },
+	16, 16, (pdf_range*) cmap_KSC_Johab_V_ranges,
+	0, 0, NULL,
+	0, 0, NULL,
+};
+
+/* KSC-V */
+
+static const pdf_range cmap_KSC_V_ranges[] = {
+{8482u,8483u,8056u},{8485u,8485u,8058u},{8486u,8486u,8320u},{8489u,8491u,8059u},
+{8493u,8493u,8062u},{8498u,8509u,8063u},{8555u,8555u,8075u},{8993u,8993u,8076u},
+{9000u,9001u,8077u},{9004u,9004u,8079u},{9006u,9006u,8080u},{9018u,9023u,8081u},
+{9051u,9051u,8087u},{9053u,9053u,8088u},{9055u,9055u,8089u},{9083u,9086u,8090u},
+};
+
+static pdf_cmap cmap_KSC_V = {
+	{-1, pdf_free_cmap_imp}, "KSC-V", "KSC-H", 0, 1, 0,
+	{ {0,0,0}, },
+	16, 16, (pdf_range*) cmap_KSC_V_ranges,
+	0, 0, NULL,
+	0, 0, NULL,
+};
+
+/* KSCms-UHC-H */
+
+static const pdf_range cmap_KSCms_UHC_H_ranges[] = {
+{32u,126u,1u},{33089u,33114u,9333u},{33121u,33146u,9359u},{33153u,33278u,9385u},
+{33345u,33370u,9511u},{33377u,33402u,9537u},{33409u,33534u,9563u},{33601u,33626u,9689u},
+{33633u,33658u,9715u},{33665u,33790u,9741u},{33857u,33882u,9867u},{33889u,33914u,9893u},
+{33921u,34046u,9919u},{34113u,34138u,10045u},{34145u,34170u,10071u},{34177u,34302u,10097u},
+{34369u,34394u,10223u},{34401u,34426u,10249u},{34433u,34558u,10275u},{34625u,34650u,10401u},
+{34657u,34682u,10427u},{34689u,34814u,10453u},{34881u,34906u,10579u},{34913u,34938u,10605u},
+{34945u,35070u,10631u},{35137u,35162u,10757u},{35169u,35194u,10783u},{35201u,35326u,10809u},
+{35393u,35418u,10935u},{35425u,35450u,10961u},{35457u,35582u,10987u},{35649u,35674u,11113u},
+{35681u,35706u,11139u},{35713u,35838u,11165u},{35905u,35930u,11291u},{35937u,35962u,11317u},
+{35969u,36094u,11343u},{36161u,36186u,11469u},{36193u,36218u,11495u},{36225u,36350u,11521u},
+{36417u,36442u,11647u},{36449u,36474u,11673u},{36481u,36606u,11699u},{36673u,36698u,11825u},
+{36705u,36730u,11851u},{36737u,36862u,11877u},{36929u,36954u,12003u},{36961u,36986u,12029u},
+{36993u,37118u,12055u},{37185u,37210u,12181u},{37217u,37242u,12207u},{37249u,37374u,12233u},
+{37441u,37466u,12359u},{37473u,37498u,12385u},{37505u,37630u,12411u},{37697u,37722u,12537u},
+{37729u,37754u,12563u},{37761u,37886u,12589u},{37953u,37978u,12715u},{37985u,38010u,12741u},
+{38017u,38142u,12767u},{38209u,38234u,12893u},{38241u,38266u,12919u},{38273u,38398u,12945u},
+{38465u,38490u,13071u},{38497u,38522u,13097u},{38529u,38654u,13123u},{38721u,38746u,13249u},
+{38753u,38778u,13275u},{38785u,38910u,13301u},{38977u,39002u,13427u},{39009u,39034u,13453u},
+{39041u,39166u,13479u},{39233u,39258u,13605u},{39265u,39290u,13631u},{39297u,39422u,13657u},
+{39489u,39514u,13783u},{39521u,39546u,13809u},{39553u,39678u,13835u},{39745u,39770u,13961u},
+{39777u,39802u,13987u},{39809u,39934u,14013u},{40001u,40026u,14139u},{40033u,40058u,14165u},
+{40065u,40190u,14191u},{40257u,40282u,14317u},{40289u,40314u,14343u},{40321u,40446u,14369u},
+{40513u,40538u,14495u},{40545u,40570u,14521u},{40577u,40702u,14547u},{40769u,40794u,14673u},
+{40801u,40826u,14699u},{40833u,40958u,14725u},{41025u,41050u,14851u},{41057u,41082u,14877u},
+{41089u,41214u,14903u},{41281u,41306u,15029u},{41313u,41338u,15055u},{41345u,41376u,15081u},
+{41377u,41470u,101u},{41537u,41562u,15113u},{41569u,41594u,15139u},{41601u,41632u,15165u},
+{41633u,41701u,195u},{41793u,41818u,15197u},{41825u,41850u,15223u},{41857u,41888u,15249u},
+{41889u,41982u,264u},{42049u,42074u,15281u},{42081u,42106u,15307u},{42113u,42144u,15333u},
+{42145u,42195u,358u},{42197u,42238u,409u},{42305u,42330u,15365u},{42337u,42362u,15391u},
+{42369u,42400u,15417u},{42401u,42410u,451u},{42416u,42425u,461u},{42433u,42456u,471u},
+{42465u,42488u,495u},{42561u,42586u,15449u},{42593u,42618u,15475u},{42625u,42656u,15501u},
+{42657u,42724u,519u},{42817u,42842u,15533u},{42849u,42874u,15559u},{42881u,42912u,15585u},
+{42913u,42991u,587u},{43073u,43098u,15617u},{43105u,43130u,15643u},{43137u,43168u,15669u},
+{43169u,43172u,666u},{43174u,43174u,670u},{43176u,43183u,671u},{43185u,43262u,679u},
+{43329u,43354u,15701u},{43361u,43386u,15727u},{43393u,43424u,15753u},{43425u,43518u,757u},
+{43585u,43610u,15785u},{43617u,43642u,15811u},{43649u,43680u,15837u},{43681u,43763u,851u},
+{43841u,43866u,15869u},{43873u,43898u,15895u},{43905u,43936u,15921u},{43937u,44022u,934u},
+{44097u,44122u,15953u},{44129u,44154u,15979u},{44161u,44192u,16005u},{44193u,44225u,1020u},
+{44241u,44273u,1053u},{44353u,44378u,16037u},{44385u,44410u,16063u},{44417u,44448u,16089u},
+{44609u,44634u,16121u},{44641u,44666u,16147u},{44673u,44704u,16173u},{44865u,44890u,16205u},
+{44897u,44922u,16231u},{44929u,44960u,16257u},{45121u,45146u,16289u},{45153u,45178u,16315u},
+{45185u,45216u,16341u},{45217u,45310u,1086u},{45377u,45402u,16373u},{45409u,45434u,16399u},
+{45441u,45472u,16425u},{45473u,45566u,1180u},{45633u,45658u,16457u},{45665u,45690u,16483u},
+{45697u,45728u,16509u},{45729u,45822u,1274u},{45889u,45914u,16541u},{45921u,45946u,16567u},
+{45953u,45984u,16593u},{45985u,46078u,1368u},{46145u,46170u,16625u},{46177u,46202u,16651u},
+{46209u,46240u,16677u},{46241u,46334u,1462u},{46401u,46426u,16709u},{46433u,46458u,16735u},
+{46465u,46496u,16761u},{46497u,46590u,1556u},{46657u,46682u,16793u},{46689u,46714u,16819u},
+{46721u,46752u,16845u},{46753u,46846u,1650u},{46913u,46938u,16877u},{46945u,46970u,16903u},
+{46977u,47008u,16929u},{47009u,47102u,1744u},{47169u,47194u,16961u},{47201u,47226u,16987u},
+{47233u,47264u,17013u},{47265u,47358u,1838u},{47425u,47450u,17045u},{47457u,47482u,17071u},
+{47489u,47520u,17097u},{47521u,47614u,1932u},{47681u,47706u,17129u},{47713u,47738u,17155u},
+{47745u,47776u,17181u},{47777u,47870u,2026u},{47937u,47962u,17213u},{47969u,47994u,17239u},
+{48001u,48032u,17265u},{48033u,48126u,2120u},{48193u,48218u,17297u},{48225u,48250u,17323u},
+{48257u,48288u,17349u},{48289u,48382u,2214u},{48449u,48474u,17381u},{48481u,48506u,17407u},
+{48513u,48544u,17433u},{48545u,48638u,2308u},{48705u,48730u,17465u},{48737u,48762u,17491u},
+{48769u,48800u,17517u},{48801u,48894u,2402u},{48961u,48986u,17549u},{48993u,49018u,17575u},
+{49025u,49056u,17601u},{49057u,49150u,2496u},{49217u,49242u,17633u},{49249u,49274u,17659u},
+{49281u,49312u,17685u},{49313u,49406u,2590u},{49473u,49498u,17717u},{49505u,49530u,17743u},
+{49537u,49568u,17769u},{49569u,49662u,2684u},{49729u,49754u,17801u},{49761u,49786u,17827u},
+{49793u,49824u,17853u},{49825u,49918u,2778u},{49985u,50010u,17885u},{50017u,50042u,17911u},
+{50049u,50080u,17937u},{50081u,50174u,2872u},{50241u,50266u,17969u},{50273u,50298u,17995u},
+{50305u,50336u,18021u},{50337u,50430u,2966u},{50497u,50522u,18053u},{50529u,50554u,18079u},
+{50561u,50592u,18105u},{50593u,50686u,3060u},{50753u,50770u,18137u},{50849u,50942u,3154u},
+{51105u,51198u,3248u},{51361u,51454u,3342u},{51873u,51966u,3436u},{52129u,52175u,3530u},
+{52176u,52176u,4116u},{52177u,52181u,3577u},{52182u,52182u,3678u},{52183u,52198u,3582u},
+{52199u,52199u,7053u},{52200u,52222u,3598u},{52385u,52478u,3621u},{52641u,52686u,3715u},
+{52687u,52687u,3460u},{52688u,52711u,3761u},{52712u,52712u,7900u},{52713u,52734u,3785u},
+{52897u,52908u,3807u},{52909u,52909u,3802u},{52910u,52990u,3819u},{53153u,53242u,3900u},
+{53243u,53243u,3902u},{53244u,53246u,3990u},{53409u,53409u,3993u},{53410u,53410u,3946u},
+{53411u,53431u,3994u},{53432u,53432u,3946u},{53433u,53455u,4015u},{53456u,53456u,3708u},
+{53457u,53468u,4038u},{53469u,53469u,4131u},{53470u,53502u,4050u},{53665u,53715u,4083u},
+{53716u,53716u,4374u},{53717u,53717u,4156u},{53718u,53719u,4134u},{53720u,53720u,4375u},
+{53721u,53722u,4136u},{53723u,53728u,4376u},{53729u,53729u,4138u},{53730u,53730u,5800u},
+{53731u,53733u,4382u},{53734u,53734u,4386u},{53735u,53735u,4139u},{53736u,53739u,4387u},
+{53740u,53740u,4140u},{53741u,53741u,4391u},{53742u,53742u,4141u},{53743u,53744u,4394u},
+{53745u,53745u,4142u},{53746u,53746u,4396u},{53747u,53749u,4143u},{53750u,53750u,4399u},
+{53751u,53753u,4146u},{53754u,53754u,4403u},{53755u,53755u,4149u},{53756u,53757u,4406u},
+{53758u,53758u,4409u},{53921u,53921u,4150u},{53922u,53923u,4410u},{53924u,53926u,4151u},
+{53927u,53930u,4412u},{53931u,53931u,4419u},{53932u,53932u,4154u},{53933u,53933u,4420u},
+{53934u,53937u,4155u},{53938u,53938u,4424u},{53939u,53949u,4159u},{53950u,53950u,4511u},
+{53951u,53953u,4170u},{53954u,53955u,4513u},{53956u,53956u,4517u},{53957u,53957u,4173u},
+{53958u,53962u,4518u},{53963u,53963u,4524u},{53964u,53964u,4174u},{53965u,53966u,4525u},
+{53967u,53972u,4528u},{53973u,53975u,4535u},{53976u,53976u,4175u},{53977u,53978u,4541u},
+{53979u,53981u,4176u},{53982u,53983u,4545u},{53984u,53984u,4179u},{53985u,53985u,4547u},
+{53986u,53986u,4550u},{53987u,53987u,4180u},{53988u,53988u,4564u},{53989u,53992u,4566u},
+{53993u,53994u,4571u},{53995u,53995u,4576u},{53996u,53999u,4181u},{54000u,54003u,4604u},
+{54004u,54005u,4609u},{54006u,54006u,4185u},{54007u,54008u,4611u},{54009u,54014u,4186u},
+{54177u,54270u,4192u},{54433u,54501u,4286u},{54502u,54502u,4318u},{54503u,54523u,4355u},
+{54524u,54524u,4136u},{54525u,54526u,4376u},{54689u,54692u,4378u},{54693u,54693u,5800u},
+{54694u,54698u,4382u},{54699u,54699u,4139u},{54700u,54701u,4387u},{54702u,54702u,4192u},
+{54703u,54782u,4389u},{54945u,54967u,4469u},{54968u,54968u,4167u},{54969u,54988u,4492u},
+{54989u,54989u,4172u},{54990u,55038u,4512u},{55201u,55242u,4561u},{55243u,55243u,5552u},
+{55244u,55267u,4603u},{55268u,55268u,6424u},{55269u,55294u,4627u},{55457u,55550u,4653u},
+{55713u,55806u,4747u},{55969u,56062u,4841u},{56225u,56260u,4935u},{56261u,56261u,5151u},
+{56262u,56291u,4971u},{56292u,56292u,4922u},{56293u,56318u,5001u},{56481u,56484u,5027u},
+{56485u,56485u,7518u},{56486u,56574u,5031u},{56737u,56740u,5120u},{56741u,56741u,5079u},
+{56742u,56788u,5124u},{56789u,56789u,5109u},{56790u,56819u,5171u},{56820u,56820u,7607u},
+{56821u,56830u,5201u},{56993u,57083u,5211u},{57084u,57084u,5584u},{57085u,57085u,5302u},
+{57086u,57086u,5367u},{57249u,57266u,5303u},{57267u,57267u,7083u},{57268u,57312u,5321u},
+{57313u,57313u,5362u},{57314u,57319u,5366u},{57320u,57320u,5485u},{57321u,57342u,5372u},
+{57505u,57584u,5394u},{57585u,57585u,6001u},{57586u,57598u,5474u},{57761u,57772u,5487u},
+{57773u,57773u,5460u},{57774u,57836u,5499u},{57837u,57837u,5317u},{57838u,57854u,5562u},
+{58017u,58110u,5579u},{58273u,58356u,5673u},{58357u,58357u,7009u},{58358u,58366u,5757u},
+{58529u,58529u,7370u},{58530u,58536u,5766u},{58537u,58537u,5678u},{58538u,58622u,5773u},
+{58785u,58797u,5858u},{58798u,58798u,5874u},{58799u,58800u,5871u},{58801u,58802u,4425u},
+{58803u,58808u,5873u},{58809u,58809u,4427u},{58810u,58810u,5879u},{58811u,58812u,4429u},
+{58813u,58819u,5880u},{58820u,58820u,4431u},{58821u,58829u,5887u},{58830u,58830u,4435u},
+{58831u,58831u,5896u},{58832u,58832u,4436u},{58833u,58833u,5897u},{58834u,58834u,4437u},
+{58835u,58837u,5898u},{58838u,58838u,4439u},{58839u,58873u,5901u},{58874u,58875u,4442u},
+{58876u,58876u,4159u},{58877u,58877u,5936u},{58878u,58878u,4444u},{59041u,59041u,4447u},
+{59042u,59043u,5937u},{59044u,59044u,4449u},{59045u,59046u,5939u},{59047u,59047u,4450u},
+{59048u,59052u,5941u},{59053u,59053u,4453u},{59054u,59054u,5946u},{59055u,59057u,4455u},
+{59058u,59058u,5947u},{59059u,59059u,4458u},{59060u,59062u,5948u},{59063u,59064u,4459u},
+{59065u,59067u,5951u},{59068u,59068u,4463u},{59069u,59075u,5954u},{59076u,59076u,4160u},
+{59077u,59077u,5961u},{59078u,59079u,4465u},{59080u,59081u,5962u},{59082u,59082u,4161u},
+{59083u,59089u,5964u},{59090u,59090u,4468u},{59091u,59093u,5971u},{59094u,59094u,4469u},
+{59095u,59096u,5974u},{59097u,59097u,4470u},{59098u,59099u,5976u},{59100u,59100u,4162u},
+{59101u,59102u,5978u},{59103u,59103u,4471u},{59104u,59104u,5980u},{59105u,59105u,4472u},
+{59106u,59107u,5981u},{59108u,59108u,4474u},{59109u,59109u,4473u},{59110u,59110u,4475u},
+{59111u,59111u,5983u},{59112u,59112u,4476u},{59113u,59113u,5984u},{59114u,59115u,4478u},
+{59116u,59116u,6447u},{59117u,59118u,5985u},{59119u,59119u,4481u},{59120u,59120u,5987u},
+{59121u,59121u,4482u},{59122u,59122u,5460u},{59123u,59124u,5988u},{59125u,59125u,4483u},
+{59126u,59126u,4163u},{59127u,59127u,4166u},{59128u,59128u,5990u},{59129u,59129u,4485u},
+{59130u,59134u,5991u},{59297u,59297u,4487u},{59298u,59301u,5996u},{59302u,59302u,4488u},
+{59303u,59304u,6000u},{59305u,59305u,4489u},{59306u,59306u,4491u},{59307u,59307u,6002u},
+{59308u,59308u,4167u},{59309u,59309u,4493u},{59310u,59311u,6003u},{59312u,59312u,4494u},
+{59313u,59326u,6005u},{59327u,59327u,4495u},{59328u,59328u,6019u},{59329u,59329u,7783u},
+{59330u,59333u,6020u},{59334u,59334u,4497u},{59335u,59335u,4499u},{59336u,59338u,6024u},
+{59339u,59339u,4501u},{59340u,59340u,6027u},{59341u,59341u,4502u},{59342u,59342u,6028u},
+{59343u,59344u,4503u},{59345u,59346u,6029u},{59347u,59347u,4506u},{59348u,59358u,6031u},
+{59359u,59359u,4508u},{59360u,59363u,6042u},{59364u,59364u,4509u},{59365u,59365u,6046u},
+{59366u,59366u,4510u},{59367u,59382u,6047u},{59383u,59383u,5797u},{59384u,59390u,6063u},
+{59553u,59622u,6070u},{59623u,59624u,4551u},{59625u,59631u,6140u},{59632u,59632u,4553u},
+{59633u,59633u,4180u},{59634u,59638u,6147u},{59639u,59639u,4555u},{59640u,59640u,6152u},
+{59641u,59641u,5800u},{59642u,59642u,6153u},{59643u,59643u,4556u},{59644u,59645u,6154u},
+{59646u,59646u,4557u},{59809u,59814u,6156u},{59815u,59815u,4560u},{59816u,59819u,6162u},
+{59820u,59820u,4561u},{59821u,59851u,6166u},{59852u,59852u,4563u},{59853u,59894u,6197u},
+{59895u,59895u,7988u},{59896u,59902u,6239u},{60065u,60096u,6246u},{60097u,60097u,6123u},
+{60098u,60132u,6278u},{60133u,60133u,4577u},{60134u,60147u,6313u},{60148u,60148u,4183u},
+{60149u,60150u,6327u},{60151u,60151u,4579u},{60152u,60155u,6329u},{60156u,60156u,4581u},
+{60157u,60157u,6333u},{60158u,60158u,4582u},{60321u,60323u,6334u},{60324u,60324u,4584u},
+{60325u,60326u,6337u},{60327u,60327u,4586u},{60328u,60328u,6339u},{60329u,60329u,4588u},
+{60330u,60330u,4184u},{60331u,60345u,6340u},{60346u,60347u,4590u},{60348u,60348u,6355u},
+{60349u,60349u,4592u},{60350u,60352u,6356u},{60353u,60353u,4593u},{60354u,60354u,4595u},
+{60355u,60357u,6359u},{60358u,60359u,4596u},{60360u,60363u,6362u},{60364u,60364u,4599u},
+{60365u,60366u,6366u},{60367u,60369u,4600u},{60370u,60370u,5552u},{60371u,60375u,6368u},
+{60376u,60376u,4603u},{60377u,60414u,6373u},{60577u,60581u,6411u},{60582u,60582u,4614u},
+{60583u,60583u,4616u},{60584u,60585u,6416u},{60586u,60586u,4618u},{60587u,60590u,6418u},
+{60591u,60591u,5950u},{60592u,60593u,4620u},{60594u,60594u,4187u},{60595u,60596u,6422u},
+{60597u,60597u,4625u},{60598u,60599u,6424u},{60600u,60600u,4627u},{60601u,60601u,6426u},
+{60602u,60602u,4629u},{60603u,60607u,6427u},{60608u,60609u,4632u},{60610u,60612u,6432u},
+{60613u,60613u,4634u},{60614u,60614u,4636u},{60615u,60616u,6435u},{60617u,60618u,4188u},
+{60619u,60628u,6437u},{60629u,60629u,4638u},{60630u,60636u,6447u},{60637u,60638u,4640u},
+{60639u,60640u,6454u},{60641u,60641u,4642u},{60642u,60643u,6456u},{60644u,60644u,4644u},
+{60645u,60646u,6458u},{60647u,60648u,4645u},{60649u,60662u,6460u},{60663u,60664u,4647u},
+{60665u,60665u,6474u},{60666u,60666u,4650u},{60667u,60670u,6475u},{60833u,60835u,4653u},
+{60836u,60909u,6479u},{60910u,60910u,5351u},{60911u,60926u,6553u},{61089u,61146u,6569u},
+{61147u,61147u,6494u},{61148u,61182u,6627u},{61345u,61438u,6662u},{61601u,61694u,6756u},
+{61857u,61950u,6850u},{62113u,62140u,6944u},{62141u,62141u,5731u},{62142u,62201u,6972u},
+{62202u,62202u,5771u},{62203u,62206u,7032u},{62369u,62384u,7036u},{62385u,62385u,4191u},
+{62386u,62462u,7052u},{62625u,62630u,7129u},{62631u,62631u,6484u},{62632u,62701u,7135u},
+{62702u,62702u,6684u},{62703u,62718u,7205u},{62881u,62974u,7221u},{63137u,63219u,7315u},
+{63220u,63220u,4279u},{63221u,63221u,7398u},{63222u,63222u,7139u},{63223u,63230u,7399u},
+{63393u,63415u,7407u},{63416u,63416u,4247u},{63417u,63431u,7430u},{63432u,63432u,4266u},
+{63433u,63442u,7445u},{63443u,63443u,4340u},{63444u,63486u,7455u},{63649u,63706u,7498u},
+{63707u,63707u,7572u},{63708u,63727u,7556u},{63728u,63728u,5088u},{63729u,63742u,7576u},
+{63905u,63998u,7590u},{64161u,64161u,7709u},{64162u,64162u,3558u},{64163u,64229u,7684u},
+{64230u,64230u,3644u},{64231u,64254u,7751u},{64417u,64510u,7775u},{64673u,64680u,7869u},
+{64681u,64681u,3815u},{64682u,64766u,7877u},{64929u,65022u,7962u},
+};
+
+static pdf_cmap cmap_KSCms_UHC_H = {
+	{-1, pdf_free_cmap_imp}, "KSCms-UHC-H", "", 0, 0, 2,
+	{ {1,0u,128u},{2,33089u,65278u}, },
+	675, 675, (pdf_range*) cmap_KSCms_UHC_H_ranges,
+	0, 0, NULL,
+	0, 0, NULL,
+};
+
+/* KSCms-UHC-HW-H */
+
+static const pdf_range cmap_KSCms_UHC_HW_H_ranges[] = {
+{32u,126u,8094u},{33089u,33114u,9333u},{33121u,33146u,9359u},{33153u,33278u,9385u},
+{33345u,33370u,9511u},{33377u,33402u,9537u},{33409u,33534u,9563u},{33601u,33626u,9689u},
+{33633u,33658u,9715u},{33665u,33790u,9741u},{33857u,33882u,9867u},{33889u,33914u,9893u},
+{33921u,34046u,9919u},{34113u,34138u,10045u},{34145u,34170u,10071u},{34177u,34302u,10097u},
+{34369u,34394u,10223u},{34401u,34426u,10249u},{34433u,34558u,10275u},{34625u,34650u,10401u},
+{34657u,34682u,10427u},{34689u,34814u,10453u},{34881u,34906u,10579u},{34913u,34938u,10605u},
+{34945u,35070u,10631u},{35137u,35162u,10757u},{35169u,35194u,10783u},{35201u,35326u,10809u},
+{35393u,35418u,10935u},{35425u,35450u,10961u},{35457u,35582u,10987u},{35649u,35674u,11113u},
+{35681u,35706u,11139u},{35713u,35838u,11165u},{35905u,35930u,11291u},{35937u,35962u,11317u},
+{35969u,36094u,11343u},{36161u,36186u,11469u},{36193u,36218u,11495u},{36225u,36350u,11521u},
+{36417u,36442u,11647u},{36449u,36474u,11673u},{36481u,36606u,11699u},{36673u,36698u,11825u},
+{36705u,36730u,11851u},{36737u,36862u,11877u},{36929u,36954u,12003u},{36961u,36986u,12029u},
+{36993u,37118u,12055u},{37185u,37210u,12181u},{37217u,37242u,12207u},{37249u,37374u,12233u},
+{37441u,37466u,12359u},{37473u,37498u,12385u},{37505u,37630u,12411u},{37697u,37722u,12537u},
+{37729u,37754u,12563u},{37761u,37886u,12589u},{37953u,37978u,12715u},{37985u,38010u,12741u},
+{38017u,38142u,12767u},{38209u,38234u,12893u},{38241u,38266u,12919u},{38273u,38398u,12945u},
+{38465u,38490u,13071u},{38497u,38522u,13097u},{38529u,38654u,13123u},{38721u,38746u,13249u},
+{38753u,38778u,13275u},{38785u,38910u,13301u},{38977u,39002u,13427u},{39009u,39034u,13453u},
+{39041u,39166u,13479u},{39233u,39258u,13605u},{39265u,39290u,13631u},{39297u,39422u,13657u},
+{39489u,39514u,13783u},{39521u,39546u,13809u},{39553u,39678u,13835u},{39745u,39770u,13961u},
+{39777u,39802u,13987u},{39809u,39934u,14013u},{40001u,40026u,14139u},{40033u,40058u,14165u},
+{40065u,40190u,14191u},{40257u,40282u,14317u},{40289u,40314u,14343u},{40321u,40446u,14369u},
+{40513u,40538u,14495u},{40545u,40570u,14521u},{40577u,40702u,14547u},{40769u,40794u,14673u},
+{40801u,40826u,14699u},{40833u,40958u,14725u},{41025u,41050u,14851u},{41057u,41082u,14877u},
+{41089u,41214u,14903u},{41281u,41306u,15029u},{41313u,41338u,15055u},{41345u,41376u,15081u},
+{41377u,41470u,101u},{41537u,41562u,15113u},{41569u,41594u,15139u},{41601u,41632u,15165u},
+{41633u,41701u,195u},{41793u,41818u,15197u},{41825u,41850u,15223u},{41857u,41888u,15249u},
+{41889u,41982u,264u},{42049u,42074u,15281u},{42081u,42106u,15307u},{42113u,42144u,15333u},
+{42145u,42195u,358u},{42197u,42238u,409u},{42305u,42330u,15365u},{42337u,42362u,15391u},
+{42369u,42400u,15417u},{42401u,42410u,451u},{42416u,42425u,461u},{42433u,42456u,471u},
+{42465u,42488u,495u},{42561u,42586u,15449u},{42593u,42618u,15475u},{42625u,42656u,15501u},
+{42657u,42724u,519u},{42817u,42842u,15533u},{42849u,42874u,15559u},{42881u,42912u,15585u},
+{42913u,42991u,587u},{43073u,43098u,15617u},{43105u,43130u,15643u},{43137u,43168u,15669u},
+{43169u,43172u,666u},{43174u,43174u,670u},{43176u,43183u,671u},{43185u,43262u,679u},
+{43329u,43354u,15701u},{43361u,43386u,15727u},{43393u,43424u,15753u},{43425u,43518u,757u},
+{43585u,43610u,15785u},{43617u,43642u,15811u},{43649u,43680u,15837u},{43681u,43763u,851u},
+{43841u,43866u,15869u},{43873u,43898u,15895u},{43905u,43936u,15921u},{43937u,44022u,934u},
+{44097u,44122u,15953u},{44129u,44154u,15979u},{44161u,44192u,16005u},{44193u,44225u,1020u},
+{44241u,44273u,1053u},{44353u,44378u,16037u},{44385u,44410u,16063u},{44417u,44448u,16089u},
+{44609u,44634u,16121u},{44641u,44666u,16147u},{44673u,44704u,16173u},{44865u,44890u,16205u},
+{44897u,44922u,16231u},{44929u,44960u,16257u},{45121u,45146u,16289u},{45153u,45178u,16315u},
+{45185u,45216u,16341u},{45217u,45310u,1086u},{45377u,45402u,16373u},{45409u,45434u,16399u},
+{45441u,45472u,16425u},{45473u,45566u,1180u},{45633u,45658u,16457u},{45665u,45690u,16483u},
+{45697u,45728u,16509u},{45729u,45822u,1274u},{45889u,45914u,16541u},{45921u,45946u,16567u},
+{45953u,45984u,16593u},{45985u,46078u,1368u},{46145u,46170u,16625u},{46177u,46202u,16651u},
+{46209u,46240u,16677u},{46241u,46334u,1462u},{46401u,46426u,16709u},{46433u,46458u,16735u},
+{46465u,46496u,16761u},{46497u,46590u,1556u},{46657u,46682u,16793u},{46689u,46714u,16819u},
+{46721u,46752u,16845u},{46753u,46846u,1650u},{46913u,46938u,16877u},{46945u,46970u,16903u},
+{46977u,47008u,16929u},{47009u,47102u,1744u},{47169u,47194u,16961u},{47201u,47226u,16987u},
+{47233u,47264u,17013u},{47265u,47358u,1838u},{47425u,47450u,17045u},{47457u,47482u,17071u},
+{47489u,47520u,17097u},{47521u,47614u,1932u},{47681u,47706u,17129u},{47713u,47738u,17155u},
+{47745u,47776u,17181u},{47777u,47870u,2026u},{47937u,47962u,17213u},{47969u,47994u,17239u},
+{48001u,48032u,17265u},{48033u,48126u,2120u},{48193u,48218u,17297u},{48225u,48250u,17323u},
+{48257u,48288u,17349u},{48289u,48382u,2214u},{48449u,48474u,17381u},{48481u,48506u,17407u},
+{48513u,48544u,17433u},{48545u,48638u,2308u},{48705u,48730u,17465u},{48737u,48762u,17491u},
+{48769u,48800u,17517u},{48801u,48894u,2402u},{48961u,48986u,17549u},{48993u,49018u,17575u},
+{49025u,49056u,17601u},{49057u,49150u,2496u},{49217u,49242u,17633u},{49249u,49274u,17659u},
+{49281u,49312u,17685u},{49313u,49406u,2590u},{49473u,49498u,17717u},{49505u,49530u,17743u},
+{49537u,49568u,17769u},{49569u,49662u,2684u},{49729u,49754u,17801u},{49761u,49786u,17827u},
+{49793u,49824u,17853u},{49825u,49918u,2778u},{49985u,50010u,17885u},{50017u,50042u,17911u},
+{50049u,50080u,17937u},{50081u,50174u,2872u},{50241u,50266u,17969u},{50273u,50298u,17995u},
+{50305u,50336u,18021u},{50337u,50430u,2966u},{50497u,50522u,18053u},{50529u,50554u,18079u},
+{50561u,50592u,18105u},{50593u,50686u,3060u},{50753u,50770u,18137u},{50849u,50942u,3154u},
+{51105u,51198u,3248u},{51361u,51454u,3342u},{51873u,51966u,3436u},{52129u,52175u,3530u},
+{52176u,52176u,4116u},{52177u,52181u,3577u},{52182u,52182u,3678u},{52183u,52198u,3582u},
+{52199u,52199u,7053u},{52200u,52222u,3598u},{52385u,52478u,3621u},{52641u,52686u,3715u},
+{52687u,52687u,3460u},{52688u,52711u,3761u},{52712u,52712u,7900u},{52713u,52734u,3785u},
+{52897u,52908u,3807u},{52909u,52909u,3802u},{52910u,52990u,3819u},{53153u,53242u,3900u},
+{53243u,53243u,3902u},{53244u,53246u,3990u},{53409u,53409u,3993u},{53410u,53410u,3946u},
+{53411u,53431u,3994u},{53432u,53432u,3946u},{53433u,53455u,4015u},{53456u,53456u,3708u},
+{53457u,53468u,4038u},{53469u,53469u,4131u},{53470u,53502u,4050u},{53665u,53715u,4083u},
+{53716u,53716u,4374u},{53717u,53717u,4156u},{53718u,53719u,4134u},{53720u,53720u,4375u},
+{53721u,53722u,4136u},{53723u,53728u,4376u},{53729u,53729u,4138u},{53730u,53730u,5800u},
+{53731u,53733u,4382u},{53734u,53734u,4386u},{53735u,53735u,4139u},{53736u,53739u,4387u},
+{53740u,53740u,4140u},{53741u,53741u,4391u},{53742u,53742u,4141u},{53743u,53744u,4394u},
+{53745u,53745u,4142u},{53746u,53746u,4396u},{53747u,53749u,4143u},{53750u,53750u,4399u},
+{53751u,53753u,4146u},{53754u,53754u,4403u},{53755u,53755u,4149u},{53756u,53757u,4406u},
+{53758u,53758u,4409u},{53921u,53921u,4150u},{53922u,53923u,4410u},{53924u,53926u,4151u},
+{53927u,53930u,4412u},{53931u,53931u,4419u},{53932u,53932u,4154u},{53933u,53933u,4420u},
+{53934u,53937u,4155u},{53938u,53938u,4424u},{53939u,53949u,4159u},{53950u,53950u,4511u},
+{53951u,53953u,4170u},{53954u,53955u,4513u},{53956u,53956u,4517u},{53957u,53957u,4173u},
+{53958u,53962u,4518u},{53963u,53963u,4524u},{53964u,53964u,4174u},{53965u,53966u,4525u},
+{53967u,53972u,4528u},{53973u,53975u,4535u},{53976u,53976u,4175u},{53977u,53978u,4541u},
+{53979u,53981u,4176u},{53982u,53983u,4545u},{53984u,53984u,4179u},{53985u,53985u,4547u},
+{53986u,53986u,4550u},{53987u,53987u,4180u},{53988u,53988u,4564u},{53989u,53992u,4566u},
+{53993u,53994u,4571u},{53995u,53995u,4576u},{53996u,53999u,4181u},{54000u,54003u,4604u},
+{54004u,54005u,4609u},{54006u,54006u,4185u},{54007u,54008u,4611u},{54009u,54014u,4186u},
+{54177u,54270u,4192u},{54433u,54501u,4286u},{54502u,54502u,4318u},{54503u,54523u,4355u},
+{54524u,54524u,4136u},{54525u,54526u,4376u},{54689u,54692u,4378u},{54693u,54693u,5800u},
+{54694u,54698u,4382u},{54699u,54699u,4139u},{54700u,54701u,4387u},{54702u,54702u,4192u},
+{54703u,54782u,4389u},{54945u,54967u,4469u},{54968u,54968u,4167u},{54969u,54988u,4492u},
+{54989u,54989u,4172u},{54990u,55038u,4512u},{55201u,55242u,4561u},{55243u,55243u,5552u},
+{55244u,55267u,4603u},{55268u,55268u,6424u},{55269u,55294u,4627u},{55457u,55550u,4653u},
+{55713u,55806u,4747u},{55969u,56062u,4841u},{56225u,56260u,4935u},{56261u,56261u,5151u},
+{56262u,56291u,4971u},{56292u,56292u,4922u},{56293u,56318u,5001u},{56481u,56484u,5027u},
+{56485u,56485u,7518u},{56486u,56574u,5031u},{56737u,56740u,5120u},{56741u,56741u,5079u},
+{56742u,56788u,5124u},{56789u,56789u,5109u},{56790u,56819u,5171u},{56820u,56820u,7607u},
+{56821u,56830u,5201u},{56993u,57083u,5211u},{57084u,57084u,5584u},{57085u,57085u,5302u},
+{57086u,57086u,5367u},{57249u,57266u,5303u},{57267u,57267u,7083u},{57268u,57312u,5321u},
+{57313u,57313u,5362u},{57314u,57319u,5366u},{57320u,57320u,5485u},{57321u,57342u,5372u},
+{57505u,57584u,5394u},{57585u,57585u,6001u},{57586u,57598u,5474u},{57761u,57772u,5487u},
+{57773u,57773u,5460u},{57774u,57836u,5499u},{57837u,57837u,5317u},{57838u,57854u,5562u},
+{58017u,58110u,5579u},{58273u,58356u,5673u},{58357u,58357u,7009u},{58358u,58366u,5757u},
+{58529u,58529u,7370u},{58530u,58536u,5766u},{58537u,58537u,5678u},{58538u,58622u,5773u},
+{58785u,58797u,5858u},{58798u,58798u,5874u},{58799u,58800u,5871u},{58801u,58802u,4425u},
+{58803u,58808u,5873u},{58809u,58809u,4427u},{58810u,58810u,5879u},{58811u,58812u,4429u},
+{58813u,58819u,5880u},{58820u,58820u,4431u},{58821u,58829u,5887u},{58830u,58830u,4435u},
+{58831u,58831u,5896u},{58832u,58832u,4436u},{58833u,58833u,5897u},{58834u,58834u,4437u},
+{58835u,58837u,5898u},{58838u,58838u,4439u},{58839u,58873u,5901u},{58874u,58875u,4442u},
+{58876u,58876u,4159u},{58877u,58877u,5936u},{58878u,58878u,4444u},{59041u,59041u,4447u},
+{59042u,59043u,5937u},{59044u,59044u,4449u},{59045u,59046u,5939u},{59047u,59047u,4450u},
+{59048u,59052u,5941u},{59053u,59053u,4453u},{59054u,59054u,5946u},{59055u,59057u,4455u},
+{59058u,59058u,5947u},{59059u,59059u,4458u},{59060u,59062u,5948u},{59063u,59064u,4459u},
+{59065u,59067u,5951u},{59068u,59068u,4463u},{59069u,59075u,5954u},{59076u,59076u,4160u},
+{59077u,59077u,5961u},{59078u,59079u,4465u},{59080u,59081u,5962u},{59082u,59082u,4161u},
+{59083u,59089u,5964u},{59090u,59090u,4468u},{59091u,59093u,5971u},{59094u,59094u,4469u},
+{59095u,59096u,5974u},{59097u,59097u,4470u},{59098u,59099u,5976u},{59100u,59100u,4162u},
+{59101u,59102u,5978u},{59103u,59103u,4471u},{59104u,59104u,5980u},{59105u,59105u,4472u},
+{59106u,59107u,5981u},{59108u,59108u,4474u},{59109u,59109u,4473u},{59110u,59110u,4475u},
+{59111u,59111u,5983u},{59112u,59112u,4476u},{59113u,59113u,5984u},{59114u,59115u,4478u},
+{59116u,59116u,6447u},{59117u,59118u,5985u},{59119u,59119u,4481u},{59120u,59120u,5987u},
+{59121u,59121u,4482u},{59122u,59122u,5460u},{59123u,59124u,5988u},{59125u,59125u,4483u},
+{59126u,59126u,4163u},{59127u,59127u,4166u},{59128u,59128u,5990u},{59129u,59129u,4485u},
+{59130u,59134u,5991u},{59297u,59297u,4487u},{59298u,59301u,5996u},{59302u,59302u,4488u},
+{59303u,59304u,6000u},{59305u,59305u,4489u},{59306u,59306u,4491u},{59307u,59307u,6002u},
+{59308u,59308u,4167u},{59309u,59309u,4493u},{59310u,59311u,6003u},{59312u,59312u,4494u},
+{59313u,59326u,6005u},{59327u,59327u,4495u},{59328u,59328u,6019u},{59329u,59329u,7783u},
+{59330u,59333u,6020u},{59334u,59334u,4497u},{59335u,59335u,4499u},{59336u,59338u,6024u},
+{59339u,59339u,4501u},{59340u,59340u,6027u},{59341u,59341u,4502u},{59342u,59342u,6028u},
+{59343u,59344u,4503u},{59345u,59346u,6029u},{59347u,59347u,4506u},{59348u,59358u,6031u},
+{59359u,59359u,4508u},{59360u,59363u,6042u},{59364u,59364u,4509u},{59365u,59365u,6046u},
+{59366u,59366u,4510u},{59367u,59382u,6047u},{59383u,59383u,5797u},{59384u,59390u,6063u},
+{59553u,59622u,6070u},{59623u,59624u,4551u},{59625u,59631u,6140u},{59632u,59632u,4553u},
+{59633u,59633u,4180u},{59634u,59638u,6147u},{59639u,59639u,4555u},{59640u,59640u,6152u},
+{59641u,59641u,5800u},{59642u,59642u,6153u},{59643u,59643u,4556u},{59644u,59645u,6154u},
+{59646u,59646u,4557u},{59809u,59814u,6156u},{59815u,59815u,4560u},{59816u,59819u,6162u},
+{59820u,59820u,4561u},{59821u,59851u,6166u},{59852u,59852u,4563u},{59853u,59894u,6197u},
+{59895u,59895u,7988u},{59896u,59902u,6239u},{60065u,60096u,6246u},{60097u,60097u,6123u},
+{60098u,60132u,6278u},{60133u,60133u,4577u},{60134u,60147u,6313u},{60148u,60148u,4183u},
+{60149u,60150u,6327u},{60151u,60151u,4579u},{60152u,60155u,6329u},{60156u,60156u,4581u},
+{60157u,60157u,6333u},{60158u,60158u,4582u},{60321u,60323u,6334u},{60324u,60324u,4584u},
+{60325u,60326u,6337u},{60327u,60327u,4586u},{60328u,60328u,6339u},{60329u,60329u,4588u},
+{60330u,60330u,4184u},{60331u,60345u,6340u},{60346u,60347u,4590u},{60348u,60348u,6355u},
+{60349u,60349u,4592u},{60350u,60352u,6356u},{60353u,60353u,4593u},{60354u,60354u,4595u},
+{60355u,60357u,6359u},{60358u,60359u,4596u},{60360u,60363u,6362u},{60364u,60364u,4599u},
+{60365u,60366u,6366u},{60367u,60369u,4600u},{60370u,60370u,5552u},{60371u,60375u,6368u},
+{60376u,60376u,4603u},{60377u,60414u,6373u},{60577u,60581u,6411u},{60582u,60582u,4614u},
+{60583u,60583u,4616u},{60584u,60585u,6416u},{60586u,60586u,4618u},{60587u,60590u,6418u},
+{60591u,60591u,5950u},{60592u,60593u,4620u},{60594u,60594u,4187u},{60595u,60596u,6422u},
+{60597u,60597u,4625u},{60598u,60599u,6424u},{60600u,60600u,4627u},{60601u,60601u,6426u},
+{60602u,60602u,4629u},{60603u,60607u,6427u},{60608u,60609u,4632u},{60610u,60612u,6432u},
+{60613u,60613u,4634u},{60614u,60614u,4636u},{60615u,60616u,6435u},{60617u,60618u,4188u},
+{60619u,60628u,6437u},{60629u,60629u,4638u},{60630u,60636u,6447u},{60637u,60638u,4640u},
+{60639u,60640u,6454u},{60641u,60641u,4642u},{60642u,60643u,6456u},{60644u,60644u,4644u},
+{60645u,60646u,6458u},{60647u,60648u,4645u},{60649u,60662u,6460u},{60663u,60664u,4647u},
+{60665u,60665u,6474u},{60666u,60666u,4650u},{60667u,60670u,6475u},{60833u,60835u,4653u},
+{60836u,60909u,6479u},{60910u,60910u,5351u},{60911u,60926u,6553u},{61089u,61146u,6569u},
+{61147u,61147u,6494u},{61148u,61182u,6627u},{61345u,61438u,6662u},{61601u,61694u,6756u},
+{61857u,61950u,6850u},{62113u,62140u,6944u},{62141u,62141u,5731u},{62142u,62201u,6972u},
+{62202u,62202u,5771u},{62203u,62206u,7032u},{62369u,62384u,7036u},{62385u,62385u,4191u},
+{62386u,62462u,7052u},{62625u,62630u,7129u},{62631u,62631u,6484u},{62632u,62701u,7135u},
+{62702u,62702u,6684u},{62703u,62718u,7205u},{62881u,62974u,7221u},{63137u,63219u,7315u},
+{63220u,63220u,4279u},{63221u,63221u,7398u},{63222u,63222u,7139u},{63223u,63230u,7399u},
+{63393u,63415u,7407u},{63416u,63416u,4247u},{63417u,63431u,7430u},{63432u,63432u,4266u},
+{63433u,63442u,7445u},{63443u,63443u,4340u},{63444u,63486u,7455u},{63649u,63706u,7498u},
+{63707u,63707u,7572u},{63708u,63727u,7556u},{63728u,63728u,5088u},{63729u,63742u,7576u},
+{63905u,63998u,7590u},{64161u,64161u,7709u},{64162u,64162u,3558u},{64163u,64229u,7684u},
+{64230u,64230u,3644u},{64231u,64254u,7751u},{64417u,64510u,7775u},{64673u,64680u,7869u},
+{64681u,64681u,3815u},{64682u,64766u,7877u},{64929u,65022u,7962u},
+};
+
+static pdf_cmap cmap_KSCms_UHC_HW_H = {
+	{-1, pdf_free_cmap_imp}, "KSCms-UHC-HW-H", "", 0, 0, 2,
+	{ {1,0u,128u},{2,33089u,65278u}, },
+	675, 675, (pdf_range*) cmap_KSCms_UHC_HW_H_ranges,
+	0, 0, NULL,
+	0, 0, NULL,
+};
+
+/* KSCms-UHC-HW-V */
+
+static const pdf_range cmap_KSCms_UHC_HW_V_ranges[] = {
+{41378u,41379u,8056u},{41381u,41381u,8058u},{41382u,41382u,8320u},{41385u,41387u,8059u},
+{41389u,41389u,8062u},{41394u,41405u,8063u},{41451u,41451u,8075u},{41889u,41889u,8076u},
+{41896u,41897u,8077u},{41900u,41900u,8079u},{41902u,41902u,8080u},{41914u,41919u,8081u},
+{41947u,41947u,8087u},{41949u,41949u,8088u},{41951u,41951u,8089u},{41979u,41982u,8090u},
+};
+
+static pdf_cmap cmap_KSCms_UHC_HW_V = {
+	{-1, pdf_free_cmap_imp}, "KSCms-UHC-HW-V", "KSCms-UHC-HW-H", 0, 1, 0,
+	{ {0,0,0}, },
+	16, 16, (pdf_range*) cmap_KSCms_UHC_HW_V_ranges,
+	0, 0, NULL,
+	0, 0, NULL,
+};
+
+/* KSCms-UHC-V */
+
+static const pdf_range cmap_KSCms_UHC_V_ranges[] = {
+{41378u,41379u,8056u},{41381u,41381u,8058u},{41382u,41382u,8320u},{41385u,41387u,8059u},
+{41389u,41389u,8062u},{41394u,41405u,8063u},{41451u,41451u,8075u},{41889u,41889u,8076u},
+{41896u,41897u,8077u},{41900u,41900u,8079u},{41902u,41902u,8080u},{41914u,41919u,8081u},
+{41947u,41947u,8087u},{41949u,41949u,8088u},{41951u,41951u,8089u},{41979u,41982u,8090u},
+};
+
+static pdf_cmap cmap_KSCms_UHC_V = {
+	{-1, pdf_free_cmap_imp}, "KSCms-UHC-V", "KSCms-UHC-H", 0, 1, 0,
+	{ {0,0,0}, },
+	16, 16, (pdf_range*) cmap_KSCms_UHC_V_ranges,
+	0, 0, NULL,
+	0, 0, NULL,
+};
+
+/* KSCpc-EUC-H */
+
+static const pdf_range cmap_KSCpc_EUC_H_ranges[] = {
+{32u,126u,1u},{129u,131u,96u},{254u,255u,99u},{41281u,41341u,8191u},
+{41345u,41370u,8252u},{41372u,41376u,8278u},{41377u,41377u,101u},{41378u,41379u,8283u},
+{41380u,41470u,104u},{41537u,41548u,8285u},{41633u,41701u,195u},{41702u,41726u,8297u},
+{41793u,41853u,8322u},{41857u,41887u,8383u},{41889u,41982u,264u},{42049u,42109u,8414u},
+{42113u,42143u,8475u},{42145u,42195u,358u},{42197u,42238u,409u},{42305u,42365u,8506u},
+{42369u,42379u,8567u},{42401u,42410u,451u},{42416u,42425u,461u},{42433u,42456u,471u},
+{42458u,42462u,8578u},{42465u,42488u,495u},{42489u,42492u,8583u},{42561u,42621u,8587u},
+{42625u,42634u,8648u},{42637u,42643u,8658u},{42646u,42651u,8665u},{42654u,42655u,8671u},
+{42657u,42724u,519u},{42725u,42750u,8673u},{42817u,42877u,8699u},{42881u,42911u,8760u},
+{42913u,42991u,587u},{42992u,43006u,8791u},{43073u,43133u,8806u},{43137u,43167u,8867u},
+{43169u,43172u,666u},{43174u,43174u,670u},{43176u,43183u,671u},{43185u,43262u,679u},
+{43329u,43380u,8898u},{43425u,43518u,757u},{43585u,43645u,8950u},{43649u,43679u,9011u},
+{43681u,43763u,851u},{43764u,43774u,9042u},{43841u,43901u,9053u},{43905u,43935u,9114u},
+{43937u,44022u,934u},{44023u,44026u,9145u},{44027u,44029u,9330u},{44097u,44157u,9149u},
+{44161u,44183u,9210u},{44193u,44225u,1020u},{44226u,44240u,9233u},{44241u,44273u,1053u},
+{44274u,44278u,9248u},{44353u,44413u,9253u},{44449u,44464u,9314u},{45217u,45310u,1086u},
+{45473u,45566u,1180u},{45729u,45822u,1274u},{45985u,46078u,1368u},{46241u,46334u,1462u},
+{46497u,46590u,1556u},{46753u,46846u,1650u},{47009u,47102u,1744u},{47265u,47358u,1838u},
+{47521u,47614u,1932u},{47777u,47870u,2026u},{48033u,48126u,2120u},{48289u,48382u,2214u},
+{48545u,48638u,2308u},{48801u,48894u,2402u},{49057u,49150u,2496u},{49313u,49406u,2590u},
+{49569u,49662u,2684u},{49825u,49918u,2778u},{50081u,50174u,2872u},{50337u,50430u,2966u},
+{50593u,50686u,3060u},{50849u,50942u,3154u},{51105u,51198u,3248u},{51361u,51454u,3342u},
+{51873u,51966u,3436u},{52129u,52175u,3530u},{52176u,52176u,4116u},{52177u,52181u,3577u},
+{52182u,52182u,3678u},{52183u,52198u,3582u},{52199u,52199u,7053u},{52200u,52222u,3598u},
+{52385u,52478u,3621u},{52641u,52686u,3715u},{52687u,52687u,3460u},{52688u,52711u,3761u},
+{52712u,52712u,7900u},{52713u,52734u,3785u},{52897u,52908u,3807u},{52909u,52909u,3802u},
+{52910u,52990u,3819u},{53153u,53242u,3900u},{53243u,53243u,3902u},{53244u,53246u,3990u},
+{53409u,53409u,3993u},{53410u,53410u,3946u},{53411u,53431u,3994u},{53432u,53432u,3946u},
+{53433u,53455u,4015u},{53456u,53456u,3708u},{53457u,53468u,4038u},{53469u,53469u,4131u},
+{53470u,53502u,4050u},{53665u,53715u,4083u},{53716u,53716u,4374u},{53717u,53717u,4156u},
+{53718u,53719u,4134u},{53720u,53720u,4375u},{53721u,53722u,4136u},{53723u,53728u,4376u},
+{53729u,53729u,4138u},{53730u,53730u,5800u},{53731u,53733u,4382u},{53734u,53734u,4386u},
+{53735u,53735u,4139u},{53736u,53739u,4387u},{53740u,53740u,4140u},{53741u,53741u,4391u},
+{53742u,53742u,4141u},{53743u,53744u,4394u},{53745u,53745u,4142u},{53746u,53746u,4396u},
+{53747u,53749u,4143u},{53750u,53750u,4399u},{53751u,53753u,4146u},{53754u,53754u,4403u},
+{53755u,53755u,4149u},{53756u,53757u,4406u},{53758u,53758u,4409u},{53921u,53921u,4150u},
+{53922u,53923u,4410u},{53924u,53926u,4151u},{53927u,53930u,4412u},{53931u,53931u,4419u},
+{53932u,53932u,4154u},{53933u,53933u,4420u},{53934u,53937u,4155u},{53938u,53938u,4424u},
+{53939u,53949u,4159u},{53950u,53950u,4511u},{53951u,53953u,4170u},{53954u,53955u,4513u},
+{53956u,53956u,4517u},{53957u,53957u,4173u},{53958u,53962u,4518u},{53963u,53963u,4524u},
+{53964u,53964u,4174u},{53965u,53966u,4525u},{53967u,53972u,4528u},{53973u,53975u,4535u},
+{53976u,53976u,4175u},{53977u,53978u,4541u},{53979u,53981u,4176u},{53982u,53983u,4545u},
+{53984u,53984u,4179u},{53985u,53985u,4547u},{53986u,53986u,4550u},{53987u,53987u,4180u},
+{53988u,53988u,4564u},{53989u,53992u,4566u},{53993u,53994u,4571u},{53995u,53995u,4576u},
+{53996u,53999u,4181u},{54000u,54003u,4604u},{54004u,54005u,4609u},{54006u,54006u,4185u},
+{54007u,54008u,4611u},{54009u,54014u,4186u},{54177u,54270u,4192u},{54433u,54501u,4286u},
+{54502u,54502u,4318u},{54503u,54523u,4355u},{54524u,54524u,4136u},{54525u,54526u,4376u},
+{54689u,54692u,4378u},{54693u,54693u,5800u},{54694u,54698u,4382u},{54699u,54699u,4139u},
+{54700u,54701u,4387u},{54702u,54702u,4192u},{54703u,54782u,4389u},{54945u,54967u,4469u},
+{54968u,54968u,4167u},{54969u,54988u,4492u},{54989u,54989u,4172u},{54990u,55038u,4512u},
+{55201u,55242u,4561u},{55243u,55243u,5552u},{55244u,55267u,4603u},{55268u,55268u,6424u},
+{55269u,55294u,4627u},{55457u,55550u,4653u},{55713u,55806u,4747u},{55969u,56062u,4841u},
+{56225u,56260u,4935u},{56261u,56261u,5151u},{56262u,56291u,4971u},{56292u,56292u,4922u},
+{56293u,56318u,5001u},{56481u,56484u,5027u},{56485u,56485u,7518u},{56486u,56574u,5031u},
+{56737u,56740u,5120u},{56741u,56741u,5079u},{56742u,56788u,5124u},{56789u,56789u,5109u},
+{56790u,56819u,5171u},{56820u,56820u,7607u},{56821u,56830u,5201u},{56993u,57083u,5211u},
+{57084u,57084u,5584u},{57085u,57085u,5302u},{57086u,57086u,5367u},{57249u,57266u,5303u},
+{57267u,57267u,7083u},{57268u,57312u,5321u},{57313u,57313u,5362u},{57314u,57319u,5366u},
+{57320u,57320u,5485u},{57321u,57342u,5372u},{57505u,57584u,5394u},{57585u,57585u,6001u},
+{57586u,57598u,5474u},{57761u,57772u,5487u},{57773u,57773u,5460u},{57774u,57836u,5499u},
+{57837u,57837u,5317u},{57838u,57854u,5562u},{58017u,58110u,5579u},{58273u,58356u,5673u},
+{58357u,58357u,7009u},{58358u,58366u,5757u},{58529u,58529u,7370u},{58530u,58536u,5766u},
+{58537u,58537u,5678u},{58538u,58622u,5773u},{58785u,58797u,5858u},{58798u,58798u,5874u},
+{58799u,58800u,5871u},{58801u,58802u,4425u},{58803u,58808u,5873u},{58809u,58809u,4427u},
+{58810u,58810u,5879u},{58811u,58812u,4429u},{58813u,58819u,5880u},{58820u,58820u,4431u},
+{58821u,58829u,5887u},{58830u,58830u,4435u},{58831u,58831u,5896u},{58832u,58832u,4436u},
+{58833u,58833u,5897u},{58834u,58834u,4437u},{58835u,58837u,5898u},{58838u,58838u,4439u},
+{58839u,58873u,5901u},{58874u,58875u,4442u},{58876u,58876u,4159u},{58877u,58877u,5936u},
+{58878u,58878u,4444u},{59041u,59041u,4447u},{59042u,59043u,5937u},{59044u,59044u,4449u},
+{59045u,59046u,5939u},{59047u,59047u,4450u},{59048u,59052u,5941u},{59053u,59053u,4453u},
+{59054u,59054u,5946u},{59055u,59057u,4455u},{59058u,59058u,5947u},{59059u,59059u,4458u},
+{59060u,59062u,5948u},{59063u,59064u,4459u},{59065u,59067u,5951u},{59068u,59068u,4463u},
+{59069u,59075u,5954u},{59076u,59076u,4160u},{59077u,59077u,5961u},{59078u,59079u,4465u},
+{59080u,59081u,5962u},{59082u,59082u,4161u},{59083u,59089u,5964u},{59090u,59090u,4468u},
+{59091u,59093u,5971u},{59094u,59094u,4469u},{59095u,59096u,5974u},{59097u,59097u,4470u},
+{59098u,59099u,5976u},{59100u,59100u,4162u},{59101u,59102u,5978u},{59103u,59103u,4471u},
+{59104u,59104u,5980u},{59105u,59105u,4472u},{59106u,59107u,5981u},{59108u,59108u,4474u},
+{59109u,59109u,4473u},{59110u,59110u,4475u},{59111u,59111u,5983u},{59112u,59112u,4476u},
+{59113u,59113u,5984u},{59114u,59115u,4478u},{59116u,59116u,6447u},{59117u,59118u,5985u},
+{59119u,59119u,4481u},{59120u,59120u,5987u},{59121u,59121u,4482u},{59122u,59122u,5460u},
+{59123u,59124u,5988u},{59125u,59125u,4483u},{59126u,59126u,4163u},{59127u,59127u,4166u},
+{59128u,59128u,5990u},{59129u,59129u,4485u},{59130u,59134u,5991u},{59297u,59297u,4487u},
+{59298u,59301u,5996u},{59302u,59302u,4488u},{59303u,59304u,6000u},{59305u,59305u,4489u},
+{59306u,59306u,4491u},{59307u,59307u,6002u},{59308u,59308u,4167u},{59309u,59309u,4493u},
+{59310u,59311u,6003u},{59312u,59312u,4494u},{59313u,59326u,6005u},{59327u,59327u,4495u},
+{59328u,59328u,6019u},{59329u,59329u,7783u},{59330u,59333u,6020u},{59334u,59334u,4497u},
+{59335u,59335u,4499u},{59336u,59338u,6024u},{59339u,59339u,4501u},{59340u,59340u,6027u},
+{59341u,59341u,4502u},{59342u,59342u,6028u},{59343u,59344u,4503u},{59345u,59346u,6029u},
+{59347u,59347u,4506u},{59348u,59358u,6031u},{59359u,59359u,4508u},{59360u,59363u,6042u},
+{59364u,59364u,4509u},{59365u,59365u,6046u},{59366u,59366u,4510u},{59367u,59382u,6047u},
+{59383u,59383u,5797u},{59384u,59390u,6063u},{59553u,59622u,6070u},{59623u,59624u,4551u},
+{59625u,59631u,6140u},{59632u,59632u,4553u},{59633u,59633u,4180u},{59634u,59638u,6147u},
+{59639u,59639u,4555u},{59640u,59640u,6152u},{59641u,59641u,5800u},{59642u,59642u,6153u},
+{59643u,59643u,4556u},{59644u,59645u,6154u},{59646u,59646u,4557u},{59809u,59814u,6156u},
+{59815u,59815u,4560u},{59816u,59819u,6162u},{59820u,59820u,4561u},{59821u,59851u,6166u},
+{59852u,59852u,4563u},{59853u,59894u,6197u},{59895u,59895u,7988u},{59896u,59902u,6239u},
+{60065u,60096u,6246u},{60097u,60097u,6123u},{60098u,60132u,6278u},{60133u,60133u,4577u},
+{60134u,60147u,6313u},{60148u,60148u,4183u},{60149u,60150u,6327u},{60151u,60151u,4579u},
+{60152u,60155u,6329u},{60156u,60156u,4581u},{60157u,60157u,6333u},{60158u,60158u,4582u},
+{60321u,60323u,6334u},{60324u,60324u,4584u},{60325u,60326u,6337u},{60327u,60327u,4586u},
+{60328u,60328u,6339u},{60329u,60329u,4588u},{60330u,60330u,4184u},{60331u,60345u,6340u},
+{60346u,60347u,4590u},{60348u,60348u,6355u},{60349u,60349u,4592u},{60350u,60352u,6356u},
+{60353u,60353u,4593u},{60354u,60354u,4595u},{60355u,60357u,6359u},{60358u,60359u,4596u},
+{60360u,60363u,6362u},{60364u,60364u,4599u},{60365u,60366u,6366u},{60367u,60369u,4600u},
+{60370u,60370u,5552u},{60371u,60375u,6368u},{60376u,60376u,4603u},{60377u,60414u,6373u},
+{60577u,60581u,6411u},{60582u,60582u,4614u},{60583u,60583u,4616u},{60584u,60585u,6416u},
+{60586u,60586u,4618u},{60587u,60590u,6418u},{60591u,60591u,5950u},{60592u,60593u,4620u},
+{60594u,60594u,4187u},{60595u,60596u,6422u},{60597u,60597u,4625u},{60598u,60599u,6424u},
+{60600u,60600u,4627u},{60601u,60601u,6426u},{60602u,60602u,4629u},{60603u,60607u,6427u},
+{60608u,60609u,4632u},{60610u,60612u,6432u},{60613u,60613u,4634u},{60614u,60614u,4636u},
+{60615u,60616u,6435u},{60617u,60618u,4188u},{60619u,60628u,6437u},{60629u,60629u,4638u},
+{60630u,60636u,6447u},{60637u,60638u,4640u},{60639u,60640u,6454u},{60641u,60641u,4642u},
+{60642u,60643u,6456u},{60644u,60644u,4644u},{60645u,60646u,6458u},{60647u,60648u,4645u},
+{60649u,60662u,6460u},{60663u,60664u,4647u},{60665u,60665u,6474u},{60666u,60666u,4650u},
+{60667u,60670u,6475u},{60833u,60835u,4653u},{60836u,60909u,6479u},{60910u,60910u,5351u},
+{60911u,60926u,6553u},{61089u,61146u,6569u},{61147u,61147u,6494u},{61148u,61182u,6627u},
+{61345u,61438u,6662u},{61601u,61694u,6756u},{61857u,61950u,6850u},{62113u,62140u,6944u},
+{62141u,62141u,5731u},{62142u,62201u,6972u},{62202u,62202u,5771u},{62203u,62206u,7032u},
+{62369u,62384u,7036u},{62385u,62385u,4191u},{62386u,62462u,7052u},{62625u,62630u,7129u},
+{62631u,62631u,6484u},{62632u,62701u,7135u},{62702u,62702u,6684u},{62703u,62718u,7205u},
+{62881u,62974u,7221u},{63137u,63219u,7315u},{63220u,63220u,4279u},{63221u,63221u,7398u},
+{63222u,63222u,7139u},{63223u,63230u,7399u},{63393u,63415u,7407u},{63416u,63416u,4247u},
+{63417u,63431u,7430u},{63432u,63432u,4266u},{63433u,63442u,7445u},{63443u,63443u,4340u},
+{63444u,63486u,7455u},{63649u,63706u,7498u},{63707u,63707u,7572u},{63708u,63727u,7556u},
+{63728u,63728u,5088u},{63729u,63742u,7576u},{63905u,63998u,7590u},{64161u,64161u,7709u},
+{64162u,64162u,3558u},{64163u,64229u,7684u},{64230u,64230u,3644u},{64231u,64254u,7751u},
+{64417u,64510u,7775u},{64673u,64680u,7869u},{64681u,64681u,3815u},{64682u,64766u,7877u},
+{64929u,65022u,7962u},
+};
+
+static pdf_cmap cmap_KSCpc_EUC_H = {
+	{-1, pdf_free_cmap_imp}, "KSCpc-EUC-H", "", 0, 0, 3,
+	{ {1,0u,132u},{2,41281u,65022u},{1,254u,255u}, },
+	509, 509, (pdf_range*) cmap_KSCpc_EUC_H_ranges,
+	0, 0, NULL,
+	0, 0, NULL,
+};
+
+/* KSCpc-EUC-V */
+
+static const pdf_range cmap_KSCpc_EUC_V_ranges[] = {
+{41378u,41379u,8056u},{41381u,41381u,8058u},{41382u,41382u,8320u},{41385u,41387u,8059u},
+{41389u,41389u,8062u},{41394u,41405u,8063u},{41451u,41451u,8075u},{41889u,41889u,8076u},
+{41896u,41897u,8077u},{41900u,41900u,8079u},{41902u,41902u,8080u},{41914u,41919u,8081u},
+{41947u,41947u,8087u},{41949u,41949u,8088u},{41951u,41951u,8089u},{41979u,41982u,8090u},
+};
+
+static pdf_cmap cmap_KSCpc_EUC_V = {
+	{-1, pdf_free_cmap_imp}, "KSCpc-EUC-V", "KSCpc-EUC-H", 0, 1, 0,
+	{ {0,0,0}, },
+	16, 16, (pdf_range*) cmap_KSCpc_EUC_V_ranges,
+	0, 0, NULL,
+	0, 0, NULL,
+};
+
+/* UniKS-UCS2-H */
+
+static pdf_cmap cmap_UniKS_UCS2_H = {
+	{-1, pdf_free_cmap_imp}, "UniKS-UCS2-H", "UniKS-X", 0, 0, 2,
+	{ {2,0u,55295u},{2,57344u,65535u}, },
+	0, 0, NULL,
+	0, 0, NULL,
+	0, 0, NULL,
+};
+
+/* UniKS-UCS2-V */
+
+static const pdf_range cmap_UniKS_UCS2_V_ranges[] = {
+{8211u,8212u,8059u},{8214u,8214u,8061u},{8229u,8229u,8058u},{12289u,12290u,8056u},
+{12296u,12305u,8065u},{12307u,12307u,8075u},{12308u,12309u,8063u},{65281u,65281u,8076u},
+{65288u,65289u,8077u},{65292u,65292u,8079u},{65294u,65294u,8080u},{65306u,65311u,8081u},
+{65339u,65339u,8087u},{65341u,65341u,8088u},{65343u,65343u,8089u},{65371u,65373u,8090u},
+{65374u,65374u,8062u},{65507u,65507u,8093u},
+};
+
+static pdf_cmap cmap_UniKS_UCS2_V = {
+	{-1, pdf_free_cmap_imp}, "UniKS-UCS2-V", "UniKS-UCS2-H", 0, 1, 0,
+	{ {0,0,0}, },
+	18, 18, (pdf_range*) cmap_UniKS_UCS2_V_ranges,
+	0, 0, NULL,
+	0, 0, NULL,
+};
+
+/* UniKS-UTF16-H */
+
+static const pdf_range cmap_UniKS_UTF16_H_ranges[] = {
+{160u,160u,1u},{169u,169u,98u},{183u,183u,104u},{8208u,8208u,97u},
+{8361u,8361u,96u},{12032u,12032u,6460u},{12036u,12036u,6380u},{12038u,12038u,6413u},
+{12040u,12040u,6443u},{12042u,12042u,6477u},{12043u,12043u,7499u},{12049u,12049u,4270u},
+{12050u,12050u,4458u},{12052u,12052u,5183u},{12055u,12055u,5772u},{12056u,12056u,5077u},
+{12060u,12060u,6201u},{12061u,12061u,3901u},{12063u,12063u,7451u},{12064u,12064u,5255u},
+{12067u,12067u,5403u},{12068u,12068u,4253u},{12069u,12069u,4159u},{12070u,12070u,6488u},
+{12072u,12072u,7247u},{12073u,12073u,5504u},{12075u,12075u,5697u},{12077u,12077u,5305u},
+{12079u,12079u,3791u},{12080u,12080u,4077u},{12081u,12081u,3604u},{12082u,12082u,3481u},
+{12088u,12088u,3964u},{12092u,12092u,5764u},{12093u,12093u,3804u},{12094u,12094u,7808u},
+{12095u,12095u,5580u},{12096u,12096u,6951u},{12098u,12098u,4840u},{12099u,12099u,4349u},
+{12100u,12100u,4027u},{12101u,12101u,4950u},{12102u,12102u,4819u},{12103u,12103u,6464u},
+{12104u,12104u,6125u},{12105u,12105u,6281u},{12106u,12106u,4788u},{12107u,12107u,8027u},
+{12108u,12108u,6956u},{12111u,12111u,4822u},{12112u,12112u,5196u},{12113u,12113u,4776u},
+{12114u,12114u,5774u},{12116u,12116u,5587u},{12117u,12117u,7867u},{12118u,12118u,6803u},
+{12119u,12119u,5129u},{12120u,12120u,7962u},{12122u,12122u,7521u},{12123u,12123u,5782u},
+{12124u,12124u,6210u},{12125u,12125u,3639u},{12126u,12126u,7741u},{12127u,12127u,6081u},
+{12128u,12128u,3806u},{12129u,12129u,6100u},{12130u,12130u,3521u},{12131u,12131u,5370u},
+{12132u,12132u,6189u},{12133u,12133u,6664u},{12134u,12134u,7610u},{12137u,12137u,4993u},
+{12138u,12138u,7600u},{12139u,12139u,4755u},{12140u,12140u,4791u},{12141u,12141u,4781u},
+{12142u,12142u,5709u},{12143u,12143u,5413u},{12144u,12144u,5710u},{12146u,12146u,7870u},
+{12147u,12147u,7755u},{12148u,12148u,4653u},{12149u,12149u,6900u},{12150u,12150u,4863u},
+{12152u,12152u,5132u},{12154u,12154u,5896u},{12155u,12155u,6218u},{12156u,12156u,4519u},
+{12157u,12157u,6427u},{12159u,12159u,6428u},{12160u,12160u,6368u},{12161u,12161u,6357u},
+{12162u,12162u,5749u},{12163u,12163u,6502u},{12164u,12164u,6967u},{12165u,12165u,3930u},
+{12166u,12166u,5456u},{12167u,12167u,7158u},{12168u,12168u,6888u},{12169u,12169u,3496u},
+{12170u,12170u,5368u},{12171u,12171u,7232u},{12174u,12174u,7756u},{12175u,12175u,7709u},
+{12176u,12176u,6409u},{12178u,12178u,3644u},{12179u,12179u,3474u},{12180u,12180u,5921u},
+{12181u,12181u,3772u},{12182u,12182u,4355u},{12183u,12183u,5718u},{12185u,12185u,7512u},
+{12186u,12186u,6636u},{12187u,12187u,6892u},{12188u,12188u,6830u},{12189u,12189u,5755u},
+{12190u,12190u,7053u},{12191u,12191u,5756u},{12192u,12192u,7009u},{12194u,12194u,6389u},
+{12195u,12195u,6352u},{12197u,12197u,4634u},{12198u,12198u,4131u},{12199u,12199u,6568u},
+{12200u,12200u,4846u},{12201u,12201u,5147u},{12204u,12204u,6227u},{12205u,12205u,7203u},
+{12206u,12206u,5220u},{12207u,12207u,4744u},{12208u,12208u,7733u},{12209u,12209u,6307u},
+{12211u,12211u,6385u},{12212u,12212u,7757u},{12213u,12213u,7595u},{12214u,12214u,5221u},
+{12215u,12215u,5733u},{12216u,12216u,5625u},{12217u,12217u,7718u},{12218u,12218u,4661u},
+{12219u,12219u,3785u},{12220u,12220u,3765u},{12225u,12225u,3993u},{12226u,12226u,5910u},
+{12227u,12227u,6827u},{12228u,12228u,4527u},{12229u,12229u,4533u},{12230u,12230u,4726u},
+{12231u,12231u,4663u},{12232u,12232u,7927u},{12233u,12233u,5401u},{12234u,12234u,8018u},
+{12237u,12237u,6758u},{12238u,12238u,3766u},{12239u,12239u,5402u},{12240u,12240u,5222u},
+{12241u,12241u,6781u},{12242u,12242u,7359u},{12243u,12243u,4563u},{12244u,12244u,3946u},
+{64046u,64046u,4419u},{64047u,64047u,4510u},
+};
+
+static pdf_cmap cmap_UniKS_UTF16_H = {
+	{-1, pdf_free_cmap_imp}, "UniKS-UTF16-H", "UniKS-X", 0, 0, 3,
+	{ {2,0u,55295u},{4,3623934976u,3690979327u},{2,57344u,65535u}, },
+	162, 162, (pdf_range*) cmap_UniKS_UTF16_H_ranges,
+	0, 0, NULL,
+	0, 0, NULL,
+};
+
+/* UniKS-UTF16-V */
+
+static const pdf_range cmap_UniKS_UTF16_V_ranges[] = {
+{8211u,8212u,8059u},{8214u,8214u,8061u},{8229u,8229u,8058u},{12289u,12290u,8056u},
+{12296u,12305u,8065u},{12307u,12307u,8075u},{12308u,12309u,8063u},{65281u,65281u,8076u},
+{65288u,65289u,8077u},{65292u,65292u,8079u},{65294u,65294u,8080u},{65306u,65311u,8081u},
+{65339u,65339u,8087u},{65341u,65341u,8088u},{65343u,65343u,8089u},{65371u,65373u,8090u},
+{65374u,65374u,8062u},{65507u,65507u,8093u},
+};
+
+static pdf_cmap cmap_UniKS_UTF16_V = {
+	{-1, pdf_free_cmap_imp}, "UniKS-UTF16-V", "UniKS-UTF16-H", 0, 1, 0,
+	{ {0,0,0}, },
+	18, 18, (pdf_range*) cmap_UniKS_UTF16_V_ranges,
+	0, 0, NULL,
+	0, 0, NULL,
+};
+
+/* UniKS-UTF32-H */
+
+static const pdf_range cmap_UniKS_UTF32_H_ranges[] = {
+{160u,160u,1u},{169u,169u,98u},{183u,183u,104u},{8208u,8208u,97u},
+{8361u,8361u,96u},{12032u,12032u,6460u},{12036u,12036u,6380u},{12038u,12038u,6413u},
+{12040u,12040u,6443u},{12042u,12042u,6477u},{12043u,12043u,7499u},{12049u,12049u,4270u},
+{12050u,12050u,4458u},{12052u,12052u,5183u},{12055u,12055u,5772u},{12056u,12056u,5077u},
+{12060u,12060u,6201u},{12061u,12061u,3901u},{12063u,12063u,7451u},{12064u,12064u,5255u},
+{12067u,12067u,5403u},{12068u,12068u,4253u},{12069u,12069u,4159u},{12070u,12070u,6488u},
+{12072u,12072u,7247u},{12073u,12073u,5504u},{12075u,12075u,5697u},{12077u,12077u,5305u},
+{12079u,12079u,3791u},{12080u,12080u,4077u},{12081u,12081u,3604u},{12082u,12082u,3481u},
+{12088u,12088u,3964u},{12092u,12092u,5764u},{12093u,12093u,3804u},{12094u,12094u,7808u},
+{12095u,12095u,5580u},{12096u,12096u,6951u},{12098u,12098u,4840u},{12099u,12099u,4349u},
+{12100u,12100u,4027u},{12101u,12101u,4950u},{12102u,12102u,4819u},{12103u,12103u,6464u},
+{12104u,12104u,6125u},{12105u,12105u,6281u},{12106u,12106u,4788u},{12107u,12107u,8027u},
+{12108u,12108u,6956u},{12111u,12111u,4822u},{12112u,12112u,5196u},{12113u,12113u,4776u},
+{12114u,12114u,5774u},{12116u,12116u,5587u},{12117u,12117u,7867u},{12118u,12118u,6803u},
+{12119u,12119u,5129u},{12120u,12120u,7962u},{12122u,12122u,7521u},{12123u,12123u,5782u},
+{12124u,12124u,6210u},{12125u,12125u,3639u},{12126u,12126u,7741u},{12127u,12127u,6081u},
+{12128u,12128u,3806u},{12129u,12129u,6100u},{12130u,12130u,3521u},{12131u,12131u,5370u},
+{12132u,12132u,6189u},{12133u,12133u,6664u},{12134u,12134u,7610u},{12137u,12137u,4993u},
+{12138u,12138u,7600u},{12139u,12139u,4755u},{12140u,12140u,4791u},{12141u,12141u,4781u},
+{12142u,12142u,5709u},{12143u,12143u,5413u},{12144u,12144u,5710u},{12146u,12146u,7870u},
+{12147u,12147u,7755u},{12148u,12148u,4653u},{12149u,12149u,6900u},{12150u,12150u,4863u},
+{12152u,12152u,5132u},{12154u,12154u,5896u},{12155u,12155u,6218u},{12156u,12156u,4519u},
+{12157u,12157u,6427u},{12159u,12159u,6428u},{12160u,12160u,6368u},{12161u,12161u,6357u},
+{12162u,12162u,5749u},{12163u,12163u,6502u},{12164u,12164u,6967u},{12165u,12165u,3930u},
+{12166u,12166u,5456u},{12167u,12167u,7158u},{12168u,12168u,6888u},{12169u,12169u,3496u},
+{12170u,12170u,5368u},{12171u,12171u,7232u},{12174u,12174u,7756u},{12175u,12175u,7709u},
+{12176u,12176u,6409u},{12178u,12178u,3644u},{12179u,12179u,3474u},{12180u,12180u,5921u},
+{12181u,12181u,3772u},{12182u,12182u,4355u},{12183u,12183u,5718u},{12185u,12185u,7512u},
+{12186u,12186u,6636u},{12187u,12187u,6892u},{12188u,12188u,6830u},{12189u,12189u,5755u},
+{12190u,12190u,7053u},{12191u,12191u,5756u},{12192u,12192u,7009u},{12194u,12194u,6389u},
+{12195u,12195u,6352u},{12197u,12197u,4634u},{12198u,12198u,4131u},{12199u,12199u,6568u},
+{12200u,12200u,4846u},{12201u,12201u,5147u},{12204u,12204u,6227u},{12205u,12205u,7203u},
+{12206u,12206u,5220u},{12207u,12207u,4744u},{12208u,12208u,7733u},{12209u,12209u,6307u},
+{12211u,12211u,6385u},{12212u,12212u,7757u},{12213u,12213u,7595u},{12214u,12214u,5221u},
+{12215u,12215u,5733u},{12216u,12216u,5625u},{12217u,12217u,7718u},{12218u,12218u,4661u},
+{12219u,12219u,3785u},{12220u,12220u,3765u},{12225u,12225u,3993u},{12226u,12226u,5910u},
+{12227u,12227u,6827u},{12228u,12228u,4527u},{12229u,12229u,4533u},{12230u,12230u,4726u},
+{12231u,12231u,4663u},{12232u,12232u,7927u},{12233u,12233u,5401u},{12234u,12234u,8018u},
+{12237u,12237u,6758u},{12238u,12238u,3766u},{12239u,12239u,5402u},{12240u,12240u,5222u},
+{12241u,12241u,6781u},{12242u,12242u,7359u},{12243u,12243u,4563u},{12244u,12244u,3946u},
+{64046u,64046u,4419u},{64047u,64047u,4510u},
+};
+
+static pdf_cmap cmap_UniKS_UTF32_H = {
+	{-1, pdf_free_cmap_imp}, "UniKS-UTF32-H", "UniKS-X", 0, 0, 1,
+	{ {4,0u,1114111u}, },
+	162, 162, (pdf_range*) cmap_UniKS_UTF32_H_ranges,
+	0, 0, NULL,
+	0, 0, NULL,
+};
+
+/* UniKS-UTF32-V */
+
+static const pdf_range cmap_UniKS_UTF32_V_ranges[] = {
+{8211u,8212u,8059u},{8214u,8214u,8061u},{8229u,8229u,8058u},{12289u,12290u,8056u},
+{12296u,12305u,8065u},{12307u,12307u,8075u},{12308u,12309u,8063u},{65281u,65281u,8076u},
+{65288u,65289u,8077u},{65292u,65292u,8079u},{65294u,65294u,8080u},{65306u,65311u,8081u},
+{65339u,65339u,8087u},{65341u,65341u,8088u},{65343u,65343u,8089u},{65371u,65373u,8090u},
+{65374u,65374u,8062u},{65507u,65507u,8093u},
+};
+
+static pdf_cmap cmap_UniKS_UTF32_V = {
+	{-1, pdf_free_cmap_imp}, "UniKS-UTF32-V", "UniKS-UTF32-H", 0, 1, 0,
+	{ {0,0,0}, },
+	18, 18, (pdf_range*) cmap_UniKS_UTF32_V_ranges,
+	0, 0, NULL,
+	0, 0, NULL,
+};
+
+/* UniKS-UTF8-H */
+
+static const pdf_range cmap_UniKS_UTF8_H_ranges[] = {
+{32u,126u,1u},{49824u,49824u,1u},{49825u,49825u,208u},{49828u,49828u,214u},
+{49831u,49831u,155u},{49832u,49832u,107u},{49833u,49833u,98u},{49834u,49834u,668u},
+{49835u,49835u,176u},{49840u,49840u,138u},{49841u,49841u,130u},{49842u,49843u,843u},
+{49844u,49844u,199u},{49846u,49846u,244u},{49847u,49847u,104u},{49848u,49848u,206u},
+{49849u,49849u,842u},{49850u,49850u,675u},{49851u,49851u,177u},{49852u,49852u,751u},
+{49853u,49853u,748u},{49854u,49854u,752u},{49855u,49855u,209u},{50054u,50054u,666u},
+{50064u,50064u,667u},{50071u,50071u,131u},{50072u,50072u,673u},{50078u,50078u,676u},
+{50079u,50079u,768u},{50086u,50086u,757u},{50096u,50096u,759u},{50103u,50103u,132u},
+{50104u,50104u,766u},{50110u,50110u,769u},{50321u,50321u,758u},{50342u,50342u,669u},
+{50343u,50343u,760u},{50353u,50353u,761u},{50354u,50354u,670u},{50355u,50355u,762u},
+{50360u,50360u,763u},{50367u,50367u,671u},{50560u,50560u,764u},{50561u,50561u,672u},
+{50562u,50562u,765u},{50569u,50569u,772u},{50570u,50570u,678u},{50571u,50571u,771u},
+{50578u,50578u,674u},{50579u,50579u,767u},{50598u,50598u,677u},{50599u,50599u,770u},
+{51900u,51900u,8275u},{52103u,52103u,201u},{52120u,52120u,202u},{52121u,52121u,205u},
+{52122u,52122u,204u},{52123u,52123u,207u},{52124u,52124u,200u},{52125u,52125u,203u},
+{52881u,52897u,471u},{52899u,52905u,488u},{52913u,52927u,495u},{53120u,53121u,510u},
+{53123u,53129u,512u},{53377u,53377u,1026u},{53392u,53397u,1020u},{53398u,53429u,1027u},
+{53430u,53439u,1060u},{53632u,53647u,1070u},{53649u,53649u,1059u},
+};
+
+static const pdf_xrange cmap_UniKS_UTF8_H_xranges[] = {
+{14844048u,14844048u,97u},{14844051u,14844052u,109u},{14844054u,14844054u,111u},{14844056u,14844057u,114u},
+{14844059u,14844059u,8238u},{14844060u,14844061u,116u},{14844063u,14844063u,8237u},{14844064u,14844065u,245u},
+{14844066u,14844066u,8607u},{14844069u,14844070u,105u},{14844080u,14844080u,216u},{14844082u,14844083u,139u},
+{14844084u,14844084u,8582u},{14844085u,14844085u,9326u},{14844086u,14844086u,9324u},{14844089u,14844090u,8612u},
+{14844091u,14844091u,156u},{14844092u,14844092u,8763u},{14844290u,14844290u,8599u},{14844340u,14844340u,845u},
+{14844346u,14844347u,8239u},{14844348u,14844348u,8248u},{14844349u,14844350u,8250u},{14844351u,14844351u,846u},
+{14844545u,14844548u,847u},{14844585u,14844585u,96u},{14845059u,14845059u,141u},{14845065u,14845065u,215u},
+{14845075u,14845075u,590u},{14845078u,14845078u,258u},{14845089u,14845089u,263u},{14845090u,14845090u,260u},
+{14845094u,14845094u,643u},{14845099u,14845099u,142u},{14845331u,14845332u,749u},{14845339u,14845342u,753u},
+{14845344u,14845353u,461u},{14845360u,14845369u,451u},{14845584u,14845585u,171u},{14845586u,14845586u,170u},
+{14845587u,14845588u,173u},{14845589u,14845589u,247u},{14845590u,14845590u,250u},{14845591u,14845591u,248u},
+{14845592u,14845592u,251u},{14845593u,14845593u,249u},{14845616u,14845616u,8868u},{14845617u,14845617u,8865u},
+{14845618u,14845618u,8864u},{14845619u,14845619u,8869u},{14845620u,14845620u,8867u},{14845628u,14845628u,8884u},
+{14845824u,14845824u,8885u},{14845828u,14845829u,8896u},{14845837u,14845837u,8816u},{14845839u,14845839u,8815u},
+{14845840u,14845840u,8814u},{14845841u,14845841u,8854u},{14845842u,14845842u,195u},{14845843u,14845843u,8855u},
+{14845844u,14845844u,196u},{14845856u,14845856u,9190u},{14845857u,14845857u,9192u},{14845858u,14845858u,9191u},
+{14845859u,14845859u,9193u},{14845862u,14845862u,9198u},{14845863u,14845863u,9200u},{14845864u,14845864u,9199u},
+{14845865u,14845865u,9201u},{14846080u,14846080u,197u},{14846082u,14846082u,151u},{14846083u,14846083u,198u},
+{14846086u,14846086u,8715u},{14846087u,14846087u,152u},{14846088u,14846088u,184u},{14846089u,14846089u,8749u},
+{14846091u,14846091u,185u},{14846092u,14846092u,8750u},{14846095u,14846095u,213u},{14846097u,14846097u,212u},
+{14846099u,14846099u,8726u},{14846106u,14846106u,178u},{14846109u,14846109u,180u},{14846110u,14846110u,136u},
+{14846111u,14846111u,8717u},{14846112u,14846112u,148u},{14846114u,14846114u,8738u},{14846117u,14846118u,8719u},
+{14846119u,14846120u,192u},{14846121u,14846121u,191u},{14846122u,14846122u,190u},{14846123u,14846124u,182u},
+{14846126u,14846126u,211u},{14846132u,14846132u,137u},{14846133u,14846133u,181u},{14846134u,14846134u,210u},
+{14846135u,14846135u,8321u},{14846141u,14846141u,179u},{14846339u,14846339u,8500u},{14846341u,14846341u,8499u},
+{14846344u,14846344u,8501u},{14846352u,14846352u,8739u},{14846353u,14846353u,8723u},{14846354u,14846354u,154u},
+{14846355u,14846355u,8722u},{14846362u,14846362u,8753u},{14846368u,14846368u,133u},{14846369u,14846369u,153u},
+{14846370u,14846370u,8734u},{14846372u,14846373u,134u},{14846374u,14846375u,8724u},{14846382u,14846383u,8745u},
+{14846384u,14846387u,8481u},{14846390u,14846391u,8489u},{14846393u,14846393u,8491u},{14846394u,14846395u,8475u},
+{14846592u,14846593u,8479u},{14846594u,14846595u,188u},{14846596u,14846596u,8748u},{14846597u,14846597u,8747u},
+{14846598u,14846599u,186u},{14846602u,14846602u,8486u},{14846603u,14846603u,8488u},{14846613u,14846615u,8727u},
+{14846627u,14846627u,8742u},{14846628u,14846628u,8503u},{14846629u,14846629u,149u},{14846651u,14846652u,8751u},
+{14846862u,14846863u,8477u},{14846874u,14846875u,8492u},{14846894u,14846894u,8320u},{14846895u,14846895u,106u},
+{14847110u,14847110u,8754u},{14847122u,14847122u,150u},{14847124u,14847124u,8731u},{14848416u,14848430u,733u},
+{14848431u,14848435u,8791u},{14848436u,14848447u,827u},{14848640u,14848642u,839u},{14848643u,14848647u,9042u},
+{14848668u,14848693u,801u},{14848694u,14848703u,8388u},{14848896u,14848911u,8398u},{14848912u,14848937u,707u},
+{14849152u,14849152u,519u},{14849153u,14849153u,530u},{14849154u,14849154u,520u},{14849155u,14849155u,531u},
+{14849164u,14849164u,521u},{14849165u,14849165u,558u},{14849166u,14849166u,557u},{14849167u,14849167u,532u},
+{14849168u,14849168u,522u},{14849169u,14849169u,552u},{14849170u,14849170u,551u},{14849171u,14849171u,533u},
+{14849172u,14849172u,524u},{14849173u,14849173u,556u},{14849174u,14849174u,555u},{14849175u,14849175u,535u},
+{14849176u,14849176u,523u},{14849177u,14849177u,554u},{14849178u,14849178u,553u},{14849179u,14849179u,534u},
+{14849180u,14849180u,525u},{14849181u,14849181u,546u},{14849182u,14849183u,559u},{14849184u,14849184u,541u},
+{14849185u,14849186u,561u},{14849187u,14849187u,536u},{14849188u,14849188u,527u},{14849189u,14849189u,548u},
+{14849190u,14849191u,563u},{14849192u,14849192u,543u},{14849193u,14849194u,565u},{14849195u,14849195u,538u},
+{14849196u,14849196u,526u},{14849197u,14849198u,567u},{14849199u,14849199u,542u},{14849200u,14849200u,547u},
+{14849201u,14849202u,569u},{14849203u,14849203u,537u},{14849204u,14849204u,528u},{14849205u,14849206u,571u},
+{14849207u,14849207u,544u},{14849208u,14849208u,549u},{14849209u,14849210u,573u},{14849211u,14849211u,539u},
+{14849212u,14849212u,529u},{14849213u,14849214u,575u},{14849215u,14849215u,545u},{14849408u,14849409u,577u},
+{14849410u,14849410u,550u},{14849411u,14849418u,579u},{14849419u,14849419u,540u},{14849682u,14849682u,232u},
+{14849696u,14849696u,165u},{14849697u,14849697u,164u},{14849699u,14849699u,229u},{14849700u,14849701u,233u},
+{14849702u,14849702u,237u},{14849703u,14849703u,236u},{14849704u,14849704u,235u},{14849705u,14849705u,238u},
+{14849713u,14849713u,8736u},{14849714u,14849714u,167u},{14849715u,14849715u,166u},{14849717u,14849717u,8780u},
+{14849718u,14849718u,220u},{14849719u,14849719u,219u},{14849721u,14849721u,8781u},{14849724u,14849724u,169u},
+{14849725u,14849725u,168u},{14849727u,14849727u,8779u},{14849920u,14849920u,218u},{14849921u,14849921u,217u},
+{14849923u,14849923u,8782u},{14849926u,14849926u,163u},{14849927u,14849927u,162u},{14849928u,14849928u,228u},
+{14849929u,14849929u,227u},{14849930u,14849930u,8787u},{14849931u,14849931u,159u},{14849932u,14849932u,8639u},
+{14849934u,14849934u,161u},{14849935u,14849935u,160u},{14849936u,14849937u,230u},{14849958u,14849958u,8775u},
+{14849967u,14849967u,8633u},{14850181u,14850181u,158u},{14850182u,14850182u,157u},{14850190u,14850190u,241u},
+{14850191u,14850191u,240u},{14850204u,14850204u,242u},{14850205u,14850205u,9222u},{14850206u,14850206u,243u},
+{14850207u,14850207u,9223u},{14850223u,14850223u,8664u},{14850432u,14850432u,147u},{14850434u,14850434u,146u},
+{14850464u,14850465u,222u},{14850467u,14850467u,226u},{14850468u,14850468u,221u},{14850469u,14850469u,224u},
+{14850471u,14850471u,225u},{14850472u,14850472u,239u},{14850473u,14850474u,253u},{14850476u,14850476u,255u},
+{14850477u,14850477u,252u},{14850479u,14850479u,8594u},{14851222u,14851222u,8631u},{14851226u,14851226u,8630u},
+{14851261u,14851261u,8604u},{14851478u,14851478u,8637u},{14851510u,14851519u,8673u},{14851722u,14851731u,8342u},
+{14859392u,14859392u,6460u},{14859396u,14859396u,6380u},{14859398u,14859398u,6413u},{14859400u,14859400u,6443u},
+{14859402u,14859402u,6477u},{14859403u,14859403u,7499u},{14859409u,14859409u,4270u},{14859410u,14859410u,4458u},
+{14859412u,14859412u,5183u},{14859415u,14859415u,5772u},{14859416u,14859416u,5077u},{14859420u,14859420u,6201u},
+{14859421u,14859421u,3901u},{14859423u,14859423u,7451u},{14859424u,14859424u,5255u},{14859427u,14859427u,5403u},
+{14859428u,14859428u,4253u},{14859429u,14859429u,4159u},{14859430u,14859430u,6488u},{14859432u,14859432u,7247u},
+{14859433u,14859433u,5504u},{14859435u,14859435u,5697u},{14859437u,14859437u,5305u},{14859439u,14859439u,3791u},
+{14859440u,14859440u,4077u},{14859441u,14859441u,3604u},{14859442u,14859442u,3481u},{14859448u,14859448u,3964u},
+{14859452u,14859452u,5764u},{14859453u,14859453u,3804u},{14859454u,14859454u,7808u},{14859455u,14859455u,5580u},
+{14859648u,14859648u,6951u},{14859650u,14859650u,4840u},{14859651u,14859651u,4349u},{14859652u,14859652u,4027u},
+{14859653u,14859653u,4950u},{14859654u,14859654u,4819u},{14859655u,14859655u,6464u},{14859656u,14859656u,6125u},
+{14859657u,14859657u,6281u},{14859658u,14859658u,4788u},{14859659u,14859659u,8027u},{14859660u,14859660u,6956u},
+{14859663u,14859663u,4822u},{14859664u,14859664u,5196u},{14859665u,14859665u,4776u},{14859666u,14859666u,5774u},
+{14859668u,14859668u,5587u},{14859669u,14859669u,7867u},{14859670u,14859670u,6803u},{14859671u,14859671u,5129u},
+{14859672u,14859672u,7962u},{14859674u,14859674u,7521u},{14859675u,14859675u,5782u},{14859676u,14859676u,6210u},
+{14859677u,14859677u,3639u},{14859678u,14859678u,7741u},{14859679u,14859679u,6081u},{14859680u,14859680u,3806u},
+{14859681u,14859681u,6100u},{14859682u,14859682u,3521u},{14859683u,14859683u,5370u},{14859684u,14859684u,6189u},
+{14859685u,14859685u,6664u},{14859686u,14859686u,7610u},{14859689u,14859689u,4993u},{14859690u,14859690u,7600u},
+{14859691u,14859691u,4755u},{14859692u,14859692u,4791u},{14859693u,14859693u,4781u},{14859694u,14859694u,5709u},
+{14859695u,14859695u,5413u},{14859696u,14859696u,5710u},{14859698u,14859698u,7870u},{14859699u,14859699u,7755u},
+{14859700u,14859700u,4653u},{14859701u,14859701u,6900u},{14859702u,14859702u,4863u},{14859704u,14859704u,5132u},
+{14859706u,14859706u,5896u},{14859707u,14859707u,6218u},{14859708u,14859708u,4519u},{14859709u,14859709u,6427u},
+{14859711u,14859711u,6428u},{14859904u,14859904u,6368u},{14859905u,14859905u,6357u},{14859906u,14859906u,5749u},
+{14859907u,14859907u,6502u},{14859908u,14859908u,6967u},{14859909u,14859909u,3930u},{14859910u,14859910u,5456u},
+{14859911u,14859911u,7158u},{14859912u,14859912u,6888u},{14859913u,14859913u,3496u},{14859914u,14859914u,5368u},
+{14859915u,14859915u,7232u},{14859918u,14859918u,7756u},{14859919u,14859919u,7709u},{14859920u,14859920u,6409u},
+{14859922u,14859922u,3644u},{14859923u,14859923u,3474u},{14859924u,14859924u,5921u},{14859925u,14859925u,3772u},
+{14859926u,14859926u,4355u},{14859927u,14859927u,5718u},{14859929u,14859929u,7512u},{14859930u,14859930u,6636u},
+{14859931u,14859931u,6892u},{14859932u,14859932u,6830u},{14859933u,14859933u,5755u},{14859934u,14859934u,7053u},
+{14859935u,14859935u,5756u},{14859936u,14859936u,7009u},{14859938u,14859938u,6389u},{14859939u,14859939u,6352u},
+{14859941u,14859941u,4634u},{14859942u,14859942u,4131u},{14859943u,14859943u,6568u},{14859944u,14859944u,4846u},
+{14859945u,14859945u,5147u},{14859948u,14859948u,6227u},{14859949u,14859949u,7203u},{14859950u,14859950u,5220u},
+{14859951u,14859951u,4744u},{14859952u,14859952u,7733u},{14859953u,14859953u,6307u},{14859955u,14859955u,6385u},
+{14859956u,14859956u,7757u},{14859957u,14859957u,7595u},{14859958u,14859958u,5221u},{14859959u,14859959u,5733u},
+{14859960u,14859960u,5625u},{14859961u,14859961u,7718u},{14859962u,14859962u,4661u},{14859963u,14859963u,3785u},
+{14859964u,14859964u,3765u},{14860161u,14860161u,3993u},{14860162u,14860162u,5910u},{14860163u,14860163u,6827u},
+{14860164u,14860164u,4527u},{14860165u,14860165u,4533u},{14860166u,14860166u,4726u},{14860167u,14860167u,4663u},
+{14860168u,14860168u,7927u},{14860169u,14860169u,5401u},{14860170u,14860170u,8018u},{14860173u,14860173u,6758u},
+{14860174u,14860174u,3766u},{14860175u,14860175u,5402u},{14860176u,14860176u,5222u},{14860177u,14860177u,6781u},
+{14860178u,14860178u,7359u},{14860179u,14860179u,4563u},{14860180u,14860180u,3946u},{14909568u,14909570u,101u},
+{14909571u,14909571u,108u},{14909576u,14909585u,120u},{14909586u,14909586u,8700u},{14909587u,14909587u,175u},
+{14909588u,14909589u,118u},{14909590u,14909593u,8219u},{14909598u,14909599u,9322u},{14909600u,14909600u,8671u},
+{14909622u,14909622u,8701u},{14909825u,14909887u,851u},{14910080u,14910099u,914u},{14910113u,14910143u,934u},
+{14910336u,14910390u,965u},{14910395u,14910395u,104u},{14910396u,14910396u,9330u},{14910641u,14910655u,358u},
+{14910848u,14910883u,373u},{14910884u,14910884u,101u},{14910885u,14910911u,409u},{14911104u,14911118u,436u},
+{14911616u,14911643u,773u},{14911644u,14911644u,257u},{14911665u,14911665u,8788u},{14911673u,14911673u,8789u},
+{14911904u,14911931u,679u},{14911935u,14911935u,256u},{14912138u,14912143u,9301u},{14912144u,14912144u,9300u},
+{14912148u,14912148u,9080u},{14912158u,14912158u,8761u},{14912165u,14912165u,9096u},{14913152u,14913156u,627u},
+{14913160u,14913161u,612u},{14913162u,14913164u,646u},{14913165u,14913167u,608u},{14913168u,14913172u,638u},
+{14913173u,14913175u,587u},{14913176u,14913176u,591u},{14913177u,14913186u,597u},{14913187u,14913190u,593u},
+{14913191u,14913192u,615u},{14913193u,14913196u,655u},{14913197u,14913199u,651u},{14913200u,14913209u,617u},
+{14913210u,14913215u,632u},{14913408u,14913409u,644u},{14913410u,14913410u,261u},{14913411u,14913411u,662u},
+{14913412u,14913412u,592u},{14913413u,14913413u,650u},{14913414u,14913414u,665u},{14913415u,14913415u,259u},
+{14913416u,14913416u,614u},{14913417u,14913417u,663u},{14913418u,14913418u,607u},{14913419u,14913419u,8790u},
+{14913423u,14913423u,611u},{14913424u,14913424u,660u},{14913427u,14913427u,661u},{14913430u,14913430u,649u},
+{14913432u,14913432u,262u},{14913435u,14913435u,654u},{14913436u,14913436u,664u},{14913437u,14913437u,659u},
+{14989440u,14989440u,6460u},{14989441u,14989441u,6704u},{14989443u,14989443u,7364u},{14989447u,14989447u,4670u},
+{14989448u,14989448u,6534u},{14989449u,14989449u,5320u},{14989450u,14989450u,5331u},{14989451u,14989451u,7616u},
+{14989453u,14989453u,5109u},{14989457u,14989457u,7288u},{14989460u,14989460u,7041u},{14989461u,14989461u,5181u},
+{14989462u,14989462u,5492u},{14989464u,14989464u,3893u},{14989465u,14989465u,5041u},{14989470u,14989470u,5682u},
+{14989485u,14989485u,6922u},{14989490u,14989490u,3802u},{14989496u,14989496u,7882u},{14989497u,14989497u,4192u},
+{14989499u,14989499u,6860u},{14989698u,14989698u,6029u},{14989699u,14989699u,4154u},{14989701u,14989701u,3894u},
+{14989707u,14989707u,6942u},{14989709u,14989709u,5241u},{14989710u,14989710u,7800u},{14989711u,14989711u,7614u},
+{14989718u,14989718u,3855u},{14989720u,14989720u,5683u},{14989721u,14989721u,6380u},{14989725u,14989725u,3895u},
+{14989726u,14989726u,3613u},{14989727u,14989727u,5862u},{14989739u,14989739u,3500u},{14989741u,14989741u,4329u},
+{14989747u,14989747u,6309u},{14989750u,14989750u,5092u},{14989751u,14989751u,5315u},{14989758u,14989758u,3601u},
+{14989954u,14989954u,4389u},{14989958u,14989958u,4551u},{14989960u,14989960u,5934u},{14989963u,14989963u,5242u},
+{14989964u,14989964u,6413u},{14989966u,14989966u,6197u},{14989968u,14989968u,6252u},{14989969u,14989969u,6238u},
+{14989970u,14989970u,7801u},{14989972u,14989972u,6049u},{14989973u,14989973u,6705u},{14989976u,14989976u,4058u},
+{14989979u,14989979u,5243u},{14989982u,14989982u,5775u},{14989985u,14989985u,4696u},{14989986u,14989986u,7670u},
+{14989988u,14989988u,3868u},{14989989u,14989989u,7685u},{14989990u,14989990u,5947u},{14989992u,14989992u,7771u},
+{14989995u,14989995u,7710u},{14989996u,14989996u,3660u},{14989997u,14989997u,6706u},{14989998u,14989998u,4427u},
+{14990006u,14990006u,4193u},{14990010u,14990010u,6443u},{14990208u,14990208u,5771u},{14990209u,14990209u,6444u},
+{14990212u,14990212u,7331u},{14990215u,14990215u,3896u},{14990218u,14990218u,4038u},{14990219u,14990219u,3560u},
+{14990221u,14990221u,6479u},{14990228u,14990228u,6483u},{14990229u,14990229u,5244u},{14990230u,14990230u,7380u},
+{14990231u,14990231u,6535u},{14990232u,14990232u,5110u},{14990233u,14990233u,5418u},{14990237u,14990237u,4331u},
+{14990239u,14990239u,7148u},{14990243u,14990243u,4250u},{14990244u,14990244u,4489u},{14990245u,14990245u,6414u},
+{14990256u,14990256u,5833u},{14990258u,14990258u,6923u},{14990262u,14990262u,3602u},{14990263u,14990263u,3561u},
+{14990267u,14990267u,6469u},{14990465u,14990465u,4062u},{14990473u,14990473u,7671u},{14990474u,14990474u,6415u},
+{14990475u,14990475u,4051u},{14990477u,14990477u,6050u},{14990478u,14990478u,4063u},{14990479u,14990479u,5074u},
+{14990480u,14990480u,5005u},{14990481u,14990481u,8005u},{14990511u,14990511u,4988u},{14990516u,14990516u,4905u},
+{14990518u,14990518u,4490u},{14990520u,14990520u,5735u},{14990522u,14990522u,5245u},{14990524u,14990524u,5246u},
+{14990525u,14990525u,3436u},{14990723u,14990723u,6643u},{14990726u,14990726u,4194u},{14990727u,14990727u,6591u},
+{14990728u,14990728u,7544u},{14990733u,14990733u,6284u},{14990734u,14990734u,6592u},{14990735u,14990735u,6861u},
+{14990736u,14990736u,6854u},{14990737u,14990737u,6198u},{14990741u,14990741u,7617u},{14990745u,14990745u,5935u},
+{14990746u,14990746u,6461u},{14990747u,14990747u,5171u},{14990748u,14990748u,6509u},{14990761u,14990761u,7502u},
+{14990767u,14990767u,5879u},{14990768u,14990768u,4989u},{14990771u,14990771u,3437u},{14990774u,14990774u,4127u},
+{14990778u,14990778u,6644u},{14990782u,14990782u,6462u},{14990783u,14990783u,5247u},{14990977u,14990977u,5736u},
+{14990979u,14990979u,3476u},{14990980u,14990980u,7015u},{14990982u,14990982u,4420u},{14990984u,14990984u,7336u},
+{14990986u,14990986u,3839u},{14990987u,14990987u,4506u},{14990989u,14990989u,5692u},{14990991u,14990991u,6862u},
+{14990993u,14990993u,6310u},{14990998u,14990998u,4594u},{14991000u,14991000u,7042u},{14991003u,14991003u,3786u},
+{14991005u,14991005u,6394u},{14991022u,14991022u,4764u},{14991023u,14991023u,7966u},{14991029u,14991029u,7367u},
+{14991030u,14991030u,4440u},{14991039u,14991039u,7518u},{14991234u,14991234u,3705u},{14991235u,14991235u,7241u},
+{14991236u,14991236u,5776u},{14991241u,14991241u,6051u},{14991242u,14991242u,6902u},{14991246u,14991246u,6782u},
+{14991249u,14991249u,6174u},{14991251u,14991251u,3661u},{14991252u,14991252u,7734u},{14991255u,14991255u,5537u},
+{14991258u,14991258u,4613u},{14991261u,14991261u,5058u},{14991263u,14991263u,5248u},{14991264u,14991264u,7759u},
+{14991265u,14991265u,5737u},{14991278u,14991278u,5567u},{14991279u,14991279u,5111u},{14991281u,14991281u,3897u},
+{14991283u,14991283u,4970u},{14991285u,14991285u,7576u},{14991288u,14991288u,5093u},{14991290u,14991290u,5925u},
+{15040642u,15040642u,5042u},{15040646u,15040646u,4428u},{15040649u,15040649u,7092u},{15040651u,15040651u,3562u},
+{15040653u,15040653u,4969u},{15040657u,15040657u,4836u},{15040658u,15040658u,4269u},{15040662u,15040662u,7705u},
+{15040665u,15040665u,7967u},{15040666u,15040666u,6395u},{15040668u,15040668u,7134u},{15040670u,15040670u,3662u},
+{15040671u,15040671u,7043u},{15040673u,15040673u,7093u},{15040675u,15040675u,4941u},{15040676u,15040676u,7337u},
+{15040678u,15040678u,3969u},{15040679u,15040679u,6837u},{15040680u,15040680u,3585u},{15040682u,15040682u,6030u},
+{15040683u,15040683u,4595u},{15040684u,15040684u,7394u},{15040685u,15040685u,6131u},{15040699u,15040699u,5863u},
+{15040899u,15040899u,5917u},{15040903u,15040903u,3438u},{15040904u,15040904u,3627u},{15040905u,15040905u,6285u},
+{15040911u,15040911u,7519u},{15040917u,15040917u,7686u},{15040922u,15040922u,6863u},{15040924u,15040924u,6707u},
+{15040933u,15040933u,3603u},{15040948u,15040948u,7330u},{15040949u,15040949u,6708u},{15040950u,15040950u,6199u},
+{15040952u,15040952u,7465u},{15041152u,15041152u,3856u},{15041157u,15041157u,5112u},{15041165u,15041165u,4942u},
+{15041169u,15041169u,3614u},{15041176u,15041176u,5303u},{15041177u,15041177u,5182u},{15041196u,15041196u,7262u},
+{15041197u,15041197u,6175u},{15041202u,15041202u,6052u},{15041203u,15041203u,6645u},{15041205u,15041205u,7114u},
+{15041207u,15041207u,5332u},{15041214u,15041214u,3663u},{15041413u,15041413u,4023u},{15041417u,15041417u,7177u},
+{15041418u,15041418u,5419u},{15041423u,15041423u,5333u},{15041425u,15041425u,3869u},{15041429u,15041429u,5075u},
+{15041430u,15041430u,8035u},{15041434u,15041434u,4552u},{15041438u,15041438u,6286u},{15041445u,15041445u,6140u},
+{15041447u,15041447u,5684u},{15041453u,15041453u,7082u},{15041465u,15041465u,3439u},{15041467u,15041467u,5020u},
+{15041471u,15041471u,5249u},{15041664u,15041664u,6396u},{15041665u,15041665u,6903u},{15041668u,15041668u,5912u},
+{15041670u,15041670u,3664u},{15041673u,15041673u,3617u},{15041682u,15041682u,6311u},{15041695u,15041695u,5334u},
+{15041697u,15041697u,4543u},{15041706u,15041706u,6200u},{15041714u,15041714u,6593u},{15041719u,15041719u,4441u},
+{15041722u,15041722u,4133u},{15041724u,15041724u,5926u},{15041920u,15041920u,6089u},{15041921u,15041921u,6359u},
+{15041923u,15041923u,6255u},{15041924u,15041924u,7772u},{15041925u,15041925u,7306u},{15041926u,15041926u,6783u},
+{15041927u,15041927u,8013u},{15041928u,15041928u,5420u},{15041929u,15041929u,3840u},{15041931u,15041931u,4016u},
+{15041932u,15041932u,7431u},{15041933u,15041933u,4735u},{15041934u,15041934u,7449u},{15041938u,15041938u,5777u},
+{15041948u,15041948u,4348u},{15041954u,15041954u,4059u},{15041957u,15041957u,6477u},{15041959u,15041959u,4155u},
+{15041960u,15041960u,6646u},{15041961u,15041961u,4429u},{15041962u,15041962u,6312u},{15041963u,15041963u,7499u},
+{15041964u,15041964u,3787u},{15041965u,15041965u,4591u},{15041966u,15041966u,7791u},{15041969u,15041969u,3788u},
+{15041973u,15041973u,5043u},{15041974u,15041974u,4064u},{15041975u,15041975u,3898u},{15041976u,15041976u,6647u},
+{15041980u,15041980u,3654u},{15042176u,15042176u,4065u},{15042182u,15042182u,5933u},{15042186u,15042186u,7126u},
+{15042189u,15042189u,6570u},{15042194u,15042194u,4765u},{15042197u,15042197u,4736u},{15042199u,15042199u,6176u},
+{15042208u,15042208u,3819u},{15042213u,15042213u,4748u},{15042218u,15042218u,4733u},{15042220u,15042220u,4332u},
+{15042230u,15042230u,5864u},{15042231u,15042231u,4424u},{15042237u,15042237u,4477u},{15042436u,15042436u,7130u},
+{15042438u,15042438u,6904u},{15042441u,15042441u,4430u},{15042443u,15042443u,6784u},{15042444u,15042444u,4607u},
+{15042445u,15042445u,4333u},{15042460u,15042460u,4606u},{15042461u,15042461u,6390u},{15042462u,15042462u,8036u},
+{15042465u,15042465u,5009u},{15042480u,15042480u,7904u},{15042481u,15042481u,3563u},{15042486u,15042486u,8014u},
+{15042488u,15042488u,7167u},{15042489u,15042489u,6141u},{15042490u,15042490u,7303u},{15042493u,15042493u,7651u},
+{15042688u,15042688u,4270u},{15042691u,15042691u,6445u},{15042694u,15042694u,5152u},{15042695u,15042695u,6684u},
+{15042696u,15042696u,6031u},{15042698u,15042698u,3477u},{15042702u,15042702u,4837u},{15042705u,15042705u,7773u},
+{15042711u,15042711u,4478u},{15042717u,15042717u,7214u},{15042724u,15042724u,7490u},{15042725u,15042725u,5037u},
+{15042729u,15042729u,4614u},{15042730u,15042730u,5304u},{15042734u,15042734u,3835u},{15042736u,15042736u,4271u},
+{15042742u,15042742u,6759u},{15042743u,15042743u,5561u},{15042744u,15042744u,3970u},{15042745u,15042745u,7077u},
+{15042746u,15042746u,6484u},{15042747u,15042747u,3465u},{15042947u,15042947u,7205u},{15042951u,15042951u,7360u},
+{15042954u,15042954u,5301u},{15042955u,15042955u,4017u},{15042956u,15042956u,4397u},{15042957u,15042957u,6648u},
+{15042964u,15042964u,7135u},{15042966u,15042966u,5113u},{15042971u,15042971u,3536u},{15042973u,15042973u,4886u},
+{15042977u,15042977u,5463u},{15042985u,15042985u,6480u},{15042986u,15042986u,6649u},{15042991u,15042991u,5114u},
+{15042994u,15042994u,7649u},{15042997u,15042997u,7094u},{15043005u,15043005u,7577u},{15043007u,15043007u,7215u},
+{15043203u,15043203u,7948u},{15043207u,15043207u,4018u},{15043208u,15043208u,5021u},{15043209u,15043209u,4577u},
+{15043213u,15043213u,3618u},{15043217u,15043217u,6760u},{15043218u,15043218u,3619u},{15043227u,15043227u,4458u},
+{15043231u,15043231u,3789u},{15043232u,15043232u,3440u},{15043235u,15043235u,4479u},{15043236u,15043236u,4024u},
+{15043241u,15043241u,6785u},{15043242u,15043242u,4169u},{15043243u,15043243u,3624u},{15043262u,15043262u,7703u},
+{15043457u,15043457u,3665u},{15043459u,15043459u,4930u},{15043461u,15043461u,7361u},{15043463u,15043463u,6177u},
+{15043465u,15043465u,4737u},{15043469u,15043469u,3666u},{15043474u,15043474u,4604u},{15043477u,15043477u,4334u},
+{15043478u,15043478u,6229u},{15043480u,15043480u,3510u},{15043481u,15043481u,4812u},{15043483u,15043483u,7979u},
+{15043485u,15043485u,5685u},{15043486u,15043486u,4511u},{15043487u,15043487u,4766u},{15043490u,15043490u,5493u},
+{15043491u,15043491u,6619u},{15043492u,15043492u,4025u},{15043507u,15043507u,7980u},{15043509u,15043509u,4442u},
+{15043512u,15043512u,3971u},{15043514u,15043514u,6510u},{15043515u,15043515u,4009u},{15043518u,15043518u,3899u},
+{15043519u,15043519u,4848u},{15043717u,15043717u,7545u},{15043720u,15043720u,8015u},{15043725u,15043725u,7546u},
+{15043727u,15043727u,7547u},{15043728u,15043728u,5076u},{15043733u,15043733u,5183u},{15043734u,15043734u,7863u},
+{15043735u,15043735u,5151u},{15043737u,15043737u,5693u},{15043744u,15043744u,6536u},{15043745u,15043745u,3841u},
+{15043747u,15043747u,3530u},{15043754u,15043754u,5184u},{15043759u,15043759u,7928u},{15043769u,15043769u,7604u},
+{15043775u,15043775u,4188u},{15043968u,15043968u,3900u},{15043969u,15043969u,5772u},{15043971u,15043971u,7149u},
+{15043972u,15043972u,6478u},{15043975u,15043975u,5686u},{15043976u,15043976u,6053u},{15043977u,15043977u,7994u},
+{15043978u,15043978u,4906u},{15043981u,15043981u,4671u},{15043985u,15043985u,5185u},{15043986u,15043986u,6834u},
+{15043987u,15043987u,7395u},{15043988u,15043988u,7760u},{15043991u,15043991u,4145u},{15043994u,15043994u,4887u},
+{15043996u,15043996u,5077u},{15043998u,15043998u,5031u},{15044000u,15044000u,6692u},{15044006u,15044006u,3852u},
+{15044008u,15044008u,5450u},{15044015u,15044015u,4800u},{15044016u,15044016u,6446u},{15044017u,15044017u,6287u},
+{15044020u,15044020u,3466u},{15044021u,15044021u,4390u},{15044023u,15044023u,3972u},{15044029u,15044029u,6926u},
+{15044031u,15044031u,3667u},{15044228u,15044228u,5851u},{15044243u,15044243u,5840u},{15044248u,15044248u,4615u},
+{15044250u,15044250u,7968u},{15044255u,15044255u,6256u},{15044256u,15044256u,7332u},{15044261u,15044261u,3979u},
+{15044262u,15044262u,7618u},{15044269u,15044269u,5989u},{15044283u,15044283u,3586u},{15044483u,15044483u,7083u},
+{15044488u,15044488u,6201u},{15044489u,15044489u,7044u},{15044490u,15044490u,4052u},{15044491u,15044491u,6202u},
+{15044493u,15044493u,4907u},{15044500u,15044500u,5628u},{15044502u,15044502u,7316u},{15044503u,15044503u,5568u},
+{15044507u,15044507u,4908u},{15044513u,15044513u,6032u},{15044514u,15044514u,7251u},{15044515u,15044515u,3901u},
+{15044516u,15044516u,3729u},{15044517u,15044517u,3902u},{15044521u,15044521u,3730u},{15044522u,15044522u,6943u},
+{15044523u,15044523u,3994u},{15044524u,15044524u,5500u},{15044525u,15044525u,7500u},{15044527u,15044527u,3441u},
+{15044528u,15044528u,7432u},{15044529u,15044529u,7016u},{15044530u,15044530u,5250u},{15044531u,15044531u,6203u},
+{15044536u,15044536u,5251u},{15044739u,15044739u,8023u},{15044740u,15044740u,3467u},{15044744u,15044744u,7663u},
+{15044745u,15044745u,4128u},{15044746u,15044746u,6620u},{15044748u,15044748u,4335u},{15044749u,15044749u,4749u},
+{15044750u,15044750u,7969u},{15044751u,15044751u,4616u},{15044752u,15044752u,7450u},{15044753u,15044753u,7711u},
+{15044763u,15044763u,3953u},{15044765u,15044765u,4638u},{15044767u,15044767u,6381u},{15044768u,15044768u,7534u},
+{15044774u,15044774u,5115u},{15044777u,15044777u,5153u},{15044779u,15044779u,7652u},{15044787u,15044787u,6055u},
+{15044792u,15044792u,8030u},{15044793u,15044793u,7317u},{15044795u,15044795u,4838u},{15044796u,15044796u,7970u},
+{15044798u,15044798u,6054u},{15044994u,15044994u,4443u},{15045000u,15045000u,6709u},{15045002u,15045002u,3731u},
+{15045009u,15045009u,7408u},{15045032u,15045032u,6867u},{15045034u,15045034u,6866u},{15045041u,15045041u,3732u},
+{15045043u,15045043u,4851u},{15045045u,15045045u,3442u},{15045051u,15045051u,5738u},{15045052u,15045052u,7802u},
+{15045053u,15045053u,4750u},{15045248u,15045248u,6594u},{15045254u,15045254u,7548u},{15045260u,15045260u,7864u},
+{15045262u,15045262u,3903u},{15045264u,15045264u,5116u},{15045284u,15045284u,7381u},{15045288u,15045288u,6485u},
+{15045291u,15045291u,6944u},{15045292u,15045292u,3870u},{15045299u,15045299u,7687u},{15045304u,15045304u,7653u},
+{15045309u,15045309u,6447u},{15045504u,15045504u,5841u},{15045505u,15045505u,7590u},{15045508u,15045508u,7853u},
+{15045512u,15045512u,7664u},{15045513u,15045513u,6571u},{15045537u,15045537u,6257u},{15045541u,15045541u,3443u},
+{15045544u,15045544u,7216u},{15045549u,15045549u,3767u},{15045550u,15045550u,7953u},{15045554u,15045554u,7168u},
+{15045562u,15045562u,7549u},{15045764u,15045764u,7503u},{15045766u,15045766u,5252u},{15045767u,15045767u,6980u},
+{15045774u,15045774u,4617u},{15045776u,15045776u,4239u},{15045788u,15045788u,4689u},{15045807u,15045807u,6313u},
+{15045809u,15045809u,7095u},{15045813u,15045813u,5821u},{15045822u,15045822u,7382u},{15046020u,15046020u,7396u},
+{15046022u,15046022u,5335u},{15046031u,15046031u,4839u},{15046035u,15046035u,3706u},{15046038u,15046038u,4217u},
+{15046046u,15046046u,5778u},{15046051u,15046051u,7654u},{15046076u,15046076u,6761u},{15046272u,15046272u,3579u},
+{15046276u,15046276u,5421u},{15046278u,15046278u,7169u},{15046279u,15046279u,4374u},{15046281u,15046281u,7971u},
+{15046282u,15046282u,7655u},{15046296u,15046296u,7150u},{15046297u,15046297u,7995u},{15046298u,15046298u,7883u},
+{15046300u,15046300u,8037u},{15046301u,15046301u,3501u},{15046311u,15046311u,7990u},{15046313u,15046313u,6314u},
+{15046314u,15046314u,5336u},{15046315u,15046315u,4132u},{15046316u,15046316u,3871u},{15046318u,15046318u,4195u},
+{15046533u,15046533u,7972u},{15046535u,15046535u,5365u},{15046548u,15046548u,6981u},{15046554u,15046554u,6056u},
+{15046556u,15046556u,4066u},{15046559u,15046559u,7045u},{15046563u,15046563u,5253u},{15046564u,15046564u,7338u},
+{15046589u,15046589u,5569u},{15046590u,15046590u,6868u},{15046790u,15046790u,7409u},{15046793u,15046793u,3444u},
+{15046804u,15046804u,3904u},{15046807u,15046807u,5337u},{15046831u,15046831u,5501u},{15046834u,15046834u,6786u},
+{15046836u,15046836u,7318u},{15046838u,15046838u,5694u},{15047059u,15047059u,7719u},{15047080u,15047080u,4067u},
+{15047083u,15047083u,8038u},{15047092u,15047092u,5154u},{15047302u,15047302u,7954u},{15047333u,15047333u,5956u},
+{15047340u,15047340u,5223u},{15047342u,15047342u,7712u},{15047348u,15047348u,5927u},{15047356u,15047356u,6511u},
+{15047562u,15047562u,4152u},{15047565u,15047565u,8039u},{15047569u,15047569u,7242u},{15047578u,15047578u,5570u},
+{15047579u,15047579u,5254u},{15047582u,15047582u,7929u},{15047584u,15047584u,6448u},{15047600u,15047600u,3774u},
+{15047609u,15047609u,4491u},{15047610u,15047610u,3733u},{15047811u,15047811u,7550u},{15047812u,15047812u,5902u},
+{15047816u,15047816u,3973u},{15047819u,15047819u,3947u},{15047821u,15047821u,6288u},{15047826u,15047826u,6259u},
+{15047827u,15047827u,6258u},{15047830u,15047830u,4272u},{15047832u,15047832u,4196u},{15047839u,15047839u,7451u},
+{15047848u,15047848u,6572u},{15047853u,15047853u,3995u},{15047856u,15047856u,6945u},{15047867u,15047867u,4068u},
+{15048064u,15048064u,6946u},{15048066u,15048066u,7491u},{15048071u,15048071u,4010u},{15048074u,15048074u,4943u},
+{15048077u,15048077u,4218u},{15048078u,15048078u,3511u},{15048080u,15048080u,6855u},{15048081u,15048081u,3581u},
+{15048097u,15048097u,7474u},{15048100u,15048100u,3775u},{15048102u,15048102u,7410u},{15048106u,15048106u,7529u},
+{15048110u,15048110u,4252u},{15048112u,15048112u,3668u},{15048117u,15048117u,3905u},{15048124u,15048124u,7397u},
+{15048322u,15048322u,5571u},{15048328u,15048328u,4251u},{15048331u,15048331u,7774u},{15048339u,15048339u,7688u},
+{15048352u,15048352u,6373u},{15048354u,15048354u,3906u},{15048355u,15048355u,6260u},{15048579u,15048579u,5842u},
+{15048583u,15048583u,6178u},{15048584u,15048584u,6905u},{15048587u,15048587u,4708u},{15048590u,15048590u,5474u},
+{15048607u,15048607u,5948u},{15048608u,15048608u,5117u},{15048624u,15048624u,7115u},{15048628u,15048628u,5720u},
+{15048631u,15048631u,7032u},{15048633u,15048633u,4971u},{15048634u,15048634u,4069u},{15048636u,15048636u,4070u},
+{15048832u,15048832u,3959u},{15048834u,15048834u,4240u},{15048837u,15048837u,3637u},{15048838u,15048838u,7459u},
+{15048840u,15048840u,3537u},{15048841u,15048841u,6355u},{15048842u,15048842u,5793u},{15048862u,15048862u,7187u},
+{15048865u,15048865u,5059u},{15048868u,15048868u,6762u},{15048871u,15048871u,5957u},{15048874u,15048874u,3512u},
+{15048879u,15048879u,6142u},{15048880u,15048880u,5918u},{15048881u,15048881u,5060u},{15048884u,15048884u,6537u},
+{15048885u,15048885u,4273u},{15048890u,15048890u,3707u},{15049098u,15049098u,3857u},{15049099u,15049099u,6002u},
+{15049103u,15049103u,3564u},{15049105u,15049105u,5502u},{15049108u,15049108u,7424u},{15049111u,15049111u,4274u},
+{15049112u,15049112u,4241u},{15049114u,15049114u,7252u},{15049118u,15049118u,5362u},{15049121u,15049121u,6650u},
+{15049122u,15049122u,6057u},{15049124u,15049124u,7981u},{15049141u,15049141u,6982u},{15049145u,15049145u,7084u},
+{15049148u,15049148u,6651u},{15049150u,15049150u,5629u},{15049347u,15049347u,3669u},{15049349u,15049349u,5373u},
+{15049353u,15049353u,6179u},{15049363u,15049363u,4801u},{15049372u,15049372u,7265u},{15049374u,15049374u,6931u},
+{15049375u,15049375u,7720u},{15049384u,15049384u,4834u},{15049385u,15049385u,4319u},{15049390u,15049390u,7383u},
+{15049395u,15049395u,5155u},{15049402u,15049402u,6058u},{15049403u,15049403u,6538u},{15049406u,15049406u,3478u},
+{15049601u,15049601u,5022u},{15049605u,15049605u,6090u},{15049607u,15049607u,4197u},{15049614u,15049614u,7982u},
+{15049617u,15049617u,7630u},{15049619u,15049619u,5829u},{15049621u,15049621u,7803u},{15049624u,15049624u,4564u},
+{15049625u,15049625u,3842u},{15049630u,15049630u,3858u},{15049631u,15049631u,4536u},{15049636u,15049636u,5880u},
+{15049643u,15049643u,5255u},{15049644u,15049644u,6470u},{15049647u,15049647u,6539u},{15049657u,15049657u,6463u},
+{15049658u,15049658u,7804u},{15049659u,15049659u,5374u},{15049661u,15049661u,5572u},{15049871u,15049871u,7619u},
+{15049876u,15049876u,4071u},{15049877u,15049877u,5403u},{15049878u,15049878u,6135u},{15049881u,15049881u,5630u},
+{15049882u,15049882u,4190u},{15049884u,15049884u,5865u},{15049890u,15049890u,4797u},{15049895u,15049895u,4253u},
+{15049897u,15049897u,7151u},{15049898u,15049898u,7433u},{15049899u,15049899u,5118u},{15049901u,15049901u,6143u},
+{15049902u,15049902u,5834u},{15049905u,15049905u,5758u},{15049911u,15049911u,6416u},{15049918u,15049918u,7761u},
+{15050116u,15050116u,5928u},{15050119u,15050119u,4072u},{15050120u,15050120u,4156u},{15050121u,15050121u,5094u},
+{15050126u,15050126u,3996u},{15050127u,15050127u,6869u},{15050128u,15050128u,7884u},{15050129u,15050129u,3708u},
+{15050132u,15050132u,5156u},{15050133u,15050133u,7730u},{15050135u,15050135u,7466u},{15050138u,15050138u,7689u},
+{15050144u,15050144u,6652u},{15050146u,15050146u,5256u},{15050151u,15050151u,6059u},{15050154u,15050154u,7418u},
+{15050155u,15050155u,6360u},{15050156u,15050156u,6540u},{15050157u,15050157u,5404u},{15050158u,15050158u,5157u},
+{15050163u,15050163u,4159u},{15050164u,15050164u,4170u},{15050168u,15050168u,3479u},{15050173u,15050173u,7805u},
+{15050370u,15050370u,5936u},{15050371u,15050371u,5186u},{15050372u,15050372u,4697u},{15050378u,15050378u,6471u},
+{15050387u,15050387u,4073u},{15050390u,15050390u,6144u},{15050391u,15050391u,4039u},{15050393u,15050393u,4802u},
+{15050405u,15050405u,7384u},{15050408u,15050408u,4944u},{15050412u,15050412u,7467u},{15050425u,15050425u,4709u},
+{15050427u,15050427u,7131u},{15050430u,15050430u,7188u},{15050627u,15050627u,6710u},{15050630u,15050630u,4767u},
+{15050633u,15050633u,6486u},{15050635u,15050635u,5695u},{15050640u,15050640u,6595u},{15050641u,15050641u,3734u},
+{15050643u,15050643u,5475u},{15050644u,15050644u,6289u},{15050649u,15050649u,6472u},{15050650u,15050650u,6145u},
+{15050652u,15050652u,3538u},{15050653u,15050653u,6864u},{15050662u,15050662u,3480u},{15050664u,15050664u,6417u},
+{15050666u,15050666u,7017u},{15050668u,15050668u,8040u},{15050670u,15050670u,7672u},{15050680u,15050680u,5958u},
+{15050683u,15050683u,6449u},{15050687u,15050687u,6487u},{15050881u,15050881u,6290u},{15050883u,15050883u,6132u},
+{15050897u,15050897u,5257u},{15050904u,15050904u,4153u},{15050907u,15050907u,6060u},{15050908u,15050908u,4134u},
+{15050911u,15050911u,5959u},{15050912u,15050912u,5739u},{15050917u,15050917u,5779u},{15050921u,15050921u,4672u},
+{15050934u,15050934u,7319u},{15050940u,15050940u,7096u},{15051137u,15051137u,4565u},{15051142u,15051142u,7475u},
+{15051145u,15051145u,6107u},{15051162u,15051162u,7844u},{15051170u,15051170u,5187u},{15051174u,15051174u,5119u},
+{15051410u,15051410u,4710u},{15051418u,15051418u,4852u},{15051419u,15051419u,6261u},{15051428u,15051428u,5696u},
+{15051649u,15051649u,3445u},{15051650u,15051650u,5573u},{15051652u,15051652u,6262u},{15051657u,15051657u,7018u},
+{15051660u,15051660u,7758u},{15051681u,15051681u,6621u},{15051686u,15051686u,7673u},{15051689u,15051689u,4181u},
+{15051909u,15051909u,7865u},{15051913u,15051913u,8041u},{15051915u,15051915u,5422u},{15051916u,15051916u,3872u},
+{15051926u,15051926u,7535u},{15051946u,15051946u,5224u},{15052160u,15052160u,5338u},{15052163u,15052163u,5881u},
+{15052176u,15052176u,6488u},{15052177u,15052177u,7754u},{15052180u,15052180u,3790u},{15052181u,15052181u,6481u},
+{15052183u,15052183u,6489u},{15052184u,15052184u,6832u},{15052186u,15052186u,5120u},{15052188u,15052188u,6490u},
+{15052189u,15052189u,7955u},{15052191u,15052191u,4727u},{15052195u,15052195u,3709u},{15052196u,15052196u,3735u},
+{15052201u,15052201u,7690u},{15052203u,15052203u,5546u},{15052208u,15052208u,5631u},{15052209u,15052209u,6522u},
+{15052213u,15052213u,5121u},{15052216u,15052216u,7631u},{15052218u,15052218u,6315u},{15052220u,15052220u,5923u},
+{15052421u,15052421u,4266u},{15052423u,15052423u,6204u},{15052424u,15052424u,5574u},{15052425u,15052425u,5807u},
+{15052427u,15052427u,5553u},{15052428u,15052428u,6108u},{15052431u,15052431u,3864u},{15052435u,15052435u,5078u},
+{15052437u,15052437u,7427u},{15052438u,15052438u,7950u},{15052439u,15052439u,6838u},{15052440u,15052440u,3820u},
+{15052441u,15052441u,6870u},{15052442u,15052442u,6711u},{15052443u,15052443u,6109u},{15052444u,15052444u,6397u},
+{15052450u,15052450u,3580u},{15052451u,15052451u,5423u},{15052452u,15052452u,5759u},{15052453u,15052453u,6316u},
+{15052454u,15052454u,7885u},{15052460u,15052460u,5476u},{15052462u,15052462u,3963u},{15052464u,15052464u,6573u},
+{15052467u,15052467u,7691u},{15052468u,15052468u,5960u},{15052469u,15052469u,5503u},{15052470u,15052470u,3446u},
+{15052472u,15052472u,5740u},{15052473u,15052473u,6180u},{15052479u,15052479u,5632u},{15052672u,15052672u,7116u},
+{15052674u,15052674u,6622u},{15052675u,15052675u,6263u},{15052676u,15052676u,4074u},{15052677u,15052677u,6450u},
+{15052678u,15052678u,4883u},{15052679u,15052679u,3907u},{15052684u,15052684u,5122u},{15052688u,15052688u,4711u},
+{15052690u,15052690u,7635u},{15052691u,15052691u,6205u},{15052692u,15052692u,5721u},{15052695u,15052695u,4168u},
+{15052702u,15052702u,4664u},{15052703u,15052703u,7078u},{15052705u,15052705u,3803u},{15052706u,15052706u,7368u},
+{15052708u,15052708u,6061u},{15052709u,15052709u,6146u},{15052710u,15052710u,5760u},{15052711u,15052711u,4167u},
+{15052712u,15052712u,7117u},{15052713u,15052713u,5762u},{15052715u,15052715u,5258u},{15052716u,15052716u,3821u},
+{15052718u,15052718u,4553u},{15052719u,15052719u,6906u},{15052725u,15052725u,7253u},{15052726u,15052726u,5061u},
+{15052728u,15052728u,7247u},{15052730u,15052730u,5259u},{15052929u,15052929u,5095u},{15052932u,15052932u,5260u},
+{15052935u,15052935u,6541u},{15052936u,15052936u,6653u},{15052937u,15052937u,6291u},{15052938u,15052938u,6833u},
+{15052939u,15052939u,5763u},{15052941u,15052941u,4254u},{15052942u,15052942u,4275u},{15052943u,15052943u,5504u},
+{15052945u,15052945u,5505u},{15052950u,15052950u,7178u},{15052953u,15052953u,5339u},{15052964u,15052964u,6206u},
+{15052968u,15052968u,4945u},{15052977u,15052977u,7320u},{15052984u,15052984u,5697u},{15052985u,15052985u,6361u},
+{15052986u,15052986u,7136u},{15052987u,15052987u,3736u},{15052988u,15052988u,4186u},{15052990u,15052990u,4853u},
+{15052991u,15052991u,4180u},{15053184u,15053184u,3948u},{15053189u,15053189u,3587u},{15053190u,15053190u,3710u},
+{15053192u,15053192u,3960u},{15053195u,15053195u,6078u},{15053197u,15053197u,5699u},{15053198u,15053198u,5698u},
+{15053201u,15053201u,5451u},{15053205u,15053205u,6654u},{15053211u,15053211u,5044u},{15053216u,15053216u,4276u},
+{15053218u,15053218u,4566u},{15053220u,15053220u,7335u},{15053221u,15053221u,4618u},{15053228u,15053228u,5538u},
+{15053231u,15053231u,4358u},{15053233u,15053233u,5305u},{15053241u,15053241u,8024u},{15053456u,15053456u,4075u},
+{15053457u,15053457u,6527u},{15053473u,15053473u,3539u},{15053481u,15053481u,5822u},{15053483u,15053483u,5575u},
+{15053484u,15053484u,3531u},{15053489u,15053489u,4255u},{15053491u,15053491u,5794u},{15053493u,15053493u,7806u},
+{15053495u,15053495u,4870u},{15053496u,15053496u,5808u},{15053498u,15053498u,4492u},{15053502u,15053502u,6693u},
+{15053696u,15053696u,5576u},{15053721u,15053721u,7339u},{15053728u,15053728u,5340u},{15053736u,15053736u,5780u},
+{15053743u,15053744u,5096u},{15053748u,15053748u,7735u},{15053750u,15053750u,4277u},{15053755u,15053755u,6907u},
+{15053757u,15053757u,7762u},{15053959u,15053959u,5671u},{15053965u,15053965u,4421u},{15053966u,15053966u,4076u},
+{15053969u,15053969u,3776u},{15053972u,15053972u,7263u},{15053974u,15053974u,5843u},{15053975u,15053975u,3540u},
+{15053977u,15053977u,4596u},{15053991u,15053991u,5672u},{15053993u,15053993u,5175u},{15054219u,15054219u,4854u},
+{15054220u,15054220u,3513u},{15054224u,15054224u,4399u},{15054249u,15054249u,5673u},{15054252u,15054252u,6136u},
+{15054255u,15054255u,7046u},{15054471u,15054471u,3908u},{15054475u,15054475u,4278u},{15054493u,15054493u,4365u},
+{15054496u,15054496u,3873u},{15054498u,15054498u,6147u},{15054506u,15054506u,5931u},{15054520u,15054520u,6003u},
+{15054522u,15054522u,4493u},{15054524u,15054524u,5375u},{15054525u,15054525u,5795u},{15054733u,15054733u,6137u},
+{15054738u,15054738u,4673u},{15054742u,15054742u,5823u},{15054749u,15054749u,7152u},{15054750u,15054750u,6871u},
+{15054753u,15054753u,5640u},{15054754u,15054754u,5506u},{15054757u,15054757u,3791u},{15054758u,15054758u,6856u},
+{15054759u,15054759u,3874u},{15054760u,15054760u,3588u},{15054763u,15054763u,4813u},{15054766u,15054766u,7047u},
+{15054769u,15054769u,4077u},{15054770u,15054770u,6418u},{15054771u,15054771u,5261u},{15054772u,15054772u,7476u},
+{15054775u,15054775u,7674u},{15054781u,15054781u,5547u},{15054782u,15054782u,3604u},{15054978u,15054978u,5700u},
+{15054979u,15054979u,7551u},{15054982u,15054982u,5010u},{15054988u,15054988u,8042u},{15054993u,15054993u,7428u},
+{15054998u,15054998u,7189u},{15055001u,15055001u,7019u},{15055003u,15055003u,4990u},{15055005u,15055005u,6763u},
+{15055013u,15055013u,5577u},{15055019u,15055019u,5262u},{15055021u,15055021u,5405u},{15055027u,15055027u,6542u},
+{15055030u,15055030u,4256u},{15055032u,15055032u,5341u},{15055037u,15055037u,4768u},{15055039u,15055039u,7973u},
+{15055232u,15055232u,6712u},{15055236u,15055236u,5796u},{15055237u,15055237u,7571u},{15055239u,15055239u,4946u},
+{15055244u,15055244u,7905u},{15055253u,15055253u,4665u},{15055263u,15055263u,7340u},{15055265u,15055265u,4996u},
+{15055266u,15055266u,4242u},{15055267u,15055267u,7536u},{15055282u,15055282u,3481u},{15055283u,15055283u,7530u},
+{15055284u,15055284u,4160u},{15055287u,15055287u,5045u},{15055288u,15055288u,7706u},{15055289u,15055289u,3482u},
+{15055291u,15055291u,7886u},{15055292u,15055293u,6317u},{15055294u,15055294u,4078u},{15055492u,15055492u,6543u},
+{15055495u,15055495u,5188u},{15055498u,15055498u,5342u},{15055503u,15055503u,5376u},{15055509u,15055509u,6596u},
+{15055511u,15055511u,6694u},{15055514u,15055514u,3670u},{15055516u,15055516u,5123u},{15055520u,15055520u,5343u},
+{15055526u,15055526u,4279u},{15055527u,15055527u,6857u},{15055531u,15055531u,3737u},{15055533u,15055533u,6713u},
+{15055541u,15055541u,5824u},{15055542u,15055542u,5377u},{15055543u,15055543u,3541u},{15055544u,15055544u,6181u},
+{15055550u,15055550u,6319u},{15055746u,15055746u,5344u},{15055752u,15055752u,7620u},{15055753u,15055753u,4483u},
+{15055754u,15055754u,4412u},{15055760u,15055760u,3909u},{15055763u,15055763u,3815u},{15055766u,15055766u,4554u},
+{15055770u,15055770u,6872u},{15055771u,15055771u,6655u},{15055775u,15055775u,4803u},{15055776u,15055776u,7097u},
+{15055778u,15055778u,7537u},{15055779u,15055779u,3843u},{15055788u,15055788u,4444u},{15055795u,15055795u,7197u},
+{15055798u,15055798u,5961u},{15055799u,15055799u,6714u},{15055802u,15055802u,3605u},{15055803u,15055803u,7930u},
+{15056001u,15056001u,5032u},{15056004u,15056004u,4537u},{15056010u,15056010u,7538u},{15056015u,15056015u,5722u},
+{15056017u,15056017u,5701u},{15056019u,15056019u,3964u},{15056020u,15056020u,6787u},{15056021u,15056021u,6451u},
+{15056023u,15056023u,5172u},{15056024u,15056024u,7854u},{15056027u,15056027u,6419u},{15056031u,15056031u,6764u},
+{15056038u,15056038u,7736u},{15056039u,15056039u,7807u},{15056041u,15056041u,4171u},{15056049u,15056049u,5872u},
+{15056053u,15056053u,6544u},{15056058u,15056058u,3542u},{15056060u,15056060u,7605u},{15056264u,15056264u,7411u},
+{15056266u,15056266u,3543u},{15056268u,15056268u,4855u},{15056270u,15056270u,4674u},{15056278u,15056278u,4198u},
+{15056279u,15056279u,7792u},{15056281u,15056281u,7997u},{15056283u,15056283u,6420u},{15056290u,15056290u,7775u},
+{15056294u,15056294u,5919u},{15056295u,15056295u,6230u},{15056297u,15056297u,7118u},{15056298u,15056298u,7578u},
+{15056299u,15056299u,6788u},{15056300u,15056300u,5225u},{15056301u,15056301u,7513u},{15056304u,15056304u,7098u},
+{15056305u,15056305u,6004u},{15056311u,15056311u,4947u},{15056313u,15056313u,5949u},{15056316u,15056316u,7597u},
+{15056319u,15056319u,5173u},{15056512u,15056512u,6126u},{15056513u,15056513u,6715u},{15056517u,15056517u,4257u},
+{15056519u,15056519u,5641u},{15056522u,15056522u,7931u},{15056523u,15056523u,4600u},{15056524u,15056524u,7974u},
+{15056528u,15056528u,5378u},{15056529u,15056529u,3671u},{15056530u,15056530u,4280u},{15056535u,15056535u,4364u},
+{15056536u,15056536u,4972u},{15056537u,15056537u,5263u},{15056542u,15056542u,6839u},{15056544u,15056544u,4422u},
+{15056545u,15056545u,5903u},{15056552u,15056552u,7906u},{15056553u,15056553u,5079u},{15056554u,15056554u,5642u},
+{15056558u,15056558u,4856u},{15056565u,15056565u,7038u},{15056567u,15056567u,4267u},{15056569u,15056569u,7170u},
+{15056573u,15056573u,7998u},{15056771u,15056771u,5764u},{15056773u,15056773u,7606u},{15056780u,15056780u,4079u},
+{15056781u,15056781u,6452u},{15056790u,15056790u,7248u},{15056791u,15056791u,6947u},{15056792u,15056793u,4698u},
+{15056800u,15056800u,7307u},{15056811u,15056811u,7379u},{15056821u,15056821u,4163u},{15056829u,15056829u,7850u},
+{15056831u,15056831u,5158u},{15106191u,15106191u,5835u},{15106194u,15106194u,4172u},{15106198u,15106198u,7552u},
+{15106204u,15106204u,4494u},{15106205u,15106205u,5264u},{15106208u,15106208u,7434u},{15106209u,15106209u,6421u},
+{15106213u,15106213u,4053u},{15106215u,15106215u,5477u},{15106216u,15106216u,6264u},{15106218u,15106218u,3859u},
+{15106223u,15106223u,3625u},{15106433u,15106433u,6473u},{15106434u,15106434u,5643u},{15106435u,15106435u,5702u},
+{15106445u,15106445u,7907u},{15106448u,15106448u,3792u},{15106450u,15106450u,7675u},{15106453u,15106453u,5379u},
+{15106457u,15106457u,5882u},{15106461u,15106461u,3836u},{15106466u,15106466u,7932u},{15106467u,15106467u,6491u},
+{15106468u,15106468u,8010u},{15106469u,15106469u,7341u},{15106472u,15106472u,7636u},{15106473u,15106473u,6374u},
+{15106474u,15106474u,3468u},{15106476u,15106476u,4164u},{15106477u,15106477u,3793u},{15106479u,15106479u,5723u},
+{15106480u,15106480u,8031u},{15106693u,15106693u,5985u},{15106697u,15106697u,5761u},{15106700u,15106700u,6765u},
+{15106701u,15106701u,7637u},{15106708u,15106708u,7933u},{15106710u,15106710u,7504u},{15106714u,15106714u,5554u},
+{15106715u,15106715u,6656u},{15106719u,15106719u,6062u},{15106720u,15106720u,6320u},{15106723u,15106723u,7887u},
+{15106724u,15106724u,7254u},{15106727u,15106727u,4619u},{15106736u,15106736u,6840u},{15106738u,15106738u,5189u},
+{15106739u,15106739u,4268u},{15106740u,15106740u,7312u},{15106742u,15106742u,4871u},{15106744u,15106744u,3711u},
+{15106748u,15106748u,4281u},{15106749u,15106749u,7132u},{15106949u,15106949u,6716u},{15106951u,15106951u,4320u},
+{15106961u,15106961u,7841u},{15106970u,15106970u,7851u},{15106972u,15106972u,5406u},{15106975u,15106975u,6321u},
+{15106976u,15106976u,7793u},{15106977u,15106977u,5797u},{15106992u,15106992u,7385u},{15106993u,15106993u,4178u},
+{15106995u,15106995u,5345u},{15106998u,15106998u,7908u},{15107001u,15107001u,5866u},{15107002u,15107002u,5478u},
+{15107003u,15107003u,7333u},{15107201u,15107201u,5578u},{15107206u,15107206u,3606u},{15107208u,15107209u,6322u},
+{15107213u,15107213u,4872u},{15107214u,15107214u,7517u},{15107215u,15107215u,6398u},{15107221u,15107221u,5798u},
+{15107226u,15107226u,6207u},{15107227u,15107227u,5844u},{15107231u,15107231u,3514u},{15107239u,15107239u,3860u},
+{15107248u,15107248u,7909u},{15107252u,15107252u,7099u},{15107255u,15107255u,3565u},{15107260u,15107260u,5741u},
+{15107262u,15107262u,3566u},{15107263u,15107263u,6265u},{15107458u,15107458u,6182u},{15107460u,15107460u,4601u},
+{15107463u,15107463u,6375u},{15107464u,15107464u,6492u},{15107466u,15107466u,3655u},{15107467u,15107467u,7435u},
+{15107468u,15107468u,7910u},{15107475u,15107475u,7579u},{15107477u,15107477u,4769u},{15107480u,15107481u,7085u},
+{15107485u,15107485u,7471u},{15107487u,15107487u,7453u},{15107490u,15107490u,4675u},{15107491u,15107491u,3822u},
+{15107492u,15107492u,3469u},{15107495u,15107495u,7794u},{15107496u,15107496u,3567u},{15107499u,15107499u,6841u},
+{15107502u,15107502u,4445u},{15107504u,15107504u,6292u},{15107510u,15107510u,3672u},{15107511u,15107511u,3544u},
+{15107517u,15107517u,7137u},{15107518u,15107518u,6168u},{15107713u,15107713u,7255u},{15107714u,15107714u,6208u},
+{15107722u,15107722u,5190u},{15107726u,15107726u,6932u},{15107728u,15107728u,4465u},{15107729u,15107729u,5237u},
+{15107732u,15107732u,7217u},{15107736u,15107736u,8044u},{15107737u,15107737u,8043u},{15107738u,15107738u,7412u},
+{15107748u,15107748u,5159u},{15107751u,15107751u,4336u},{15107753u,15107753u,3628u},{15107755u,15107755u,4873u},
+{15107756u,15107756u,3673u},{15107758u,15107758u,4814u},{15107762u,15107762u,7723u},{15107766u,15107766u,5913u},
+{15107770u,15107770u,4219u},{15107774u,15107774u,3515u},{15107971u,15107971u,4026u},{15107975u,15107975u,3483u},
+{15107976u,15107976u,7692u},{15107977u,15107977u,6391u},{15107978u,15107978u,6063u},{15107979u,15107979u,4815u},
+{15108006u,15108006u,4135u},{15108018u,15108018u,7039u},{15108022u,15108022u,4375u},{15108023u,15108023u,7934u},
+{15108024u,15108024u,7737u},{15108026u,15108026u,7087u},{15108028u,15108028u,3910u},{15108031u,15108031u,6399u},
+{15108224u,15108224u,4466u},{15108231u,15108231u,4243u},{15108232u,15108232u,3804u},{15108234u,15108234u,4816u},
+{15108236u,15108236u,5667u},{15108237u,15108237u,5579u},{15108238u,15108238u,6369u},{15108240u,15108240u,5479u},
+{15108241u,15108241u,5781u},{15108242u,15108242u,3712u},{15108246u,15108246u,7842u},{15108250u,15108250u,7138u},
+{15108255u,15108255u,4019u},{15108257u,15108257u,3516u},{15108266u,15108266u,6685u},{15108270u,15108270u,4592u},
+{15108272u,15108272u,6657u},{15108273u,15108273u,8045u},{15108276u,15108276u,4258u},{15108278u,15108278u,7808u},
+{15108286u,15108286u,4446u},{15108287u,15108287u,4948u},{15108480u,15108480u,5507u},{15108481u,15108481u,7520u},
+{15108487u,15108487u,5424u},{15108488u,15108488u,7809u},{15108489u,15108489u,5191u},{15108491u,15108491u,5580u},
+{15108493u,15108493u,6574u},{15108499u,15108499u,7386u},{15108504u,15108504u,7398u},{15108526u,15108526u,5160u},
+{15108529u,15108529u,4054u},{15108534u,15108534u,5124u},{15108537u,15108537u,5192u},{15108540u,15108540u,5852u},
+{15108543u,15108543u,5687u},{15108736u,15108736u,4080u},{15108740u,15108740u,7218u},{15108745u,15108745u,3648u},
+{15108746u,15108746u,7477u},{15108753u,15108753u,5914u},{15108754u,15108754u,5380u},{15108757u,15108757u,7468u},
+{15108759u,15108759u,7676u},{15108760u,15108760u,6686u},{15108763u,15108763u,7553u},{15108779u,15108779u,7598u},
+{15108785u,15108785u,7554u},{15108789u,15108789u,6597u},{15108793u,15108793u,4690u},{15108796u,15108796u,5830u},
+{15108797u,15108797u,7266u},{15108994u,15108994u,5174u},{15108999u,15108999u,4817u},{15109000u,15109000u,4165u},
+{15109001u,15109001u,4409u},{15109004u,15109004u,4909u},{15109005u,15109005u,4888u},{15109007u,15109007u,4136u},
+{15109008u,15109008u,3861u},{15109010u,15109010u,3589u},{15109011u,15109011u,7139u},{15109012u,15109012u,4931u},
+{15109014u,15109014u,7387u},{15109015u,15109015u,6148u},{15109016u,15109016u,3911u},{15109017u,15109017u,6835u},
+{15109019u,15109019u,7219u},{15109020u,15109020u,4973u},{15109036u,15109036u,3837u},{15109037u,15109037u,5724u},
+{15109038u,15109038u,4129u},{15109039u,15109039u,6934u},{15109041u,15109041u,3794u},{15109043u,15109043u,3974u},
+{15109047u,15109047u,3738u},{15109054u,15109054u,5678u},{15109055u,15109055u,4137u},{15109249u,15109249u,6948u},
+{15109255u,15109255u,6949u},{15109257u,15109257u,5809u},{15109265u,15109265u,4282u},{15109291u,15109291u,6858u},
+{15109295u,15109295u,6983u},{15109306u,15109306u,6717u},{15109307u,15109307u,5963u},{15109309u,15109309u,4676u},
+{15109310u,15109310u,7763u},{15109513u,15109513u,7055u},{15109516u,15109516u,7501u},{15109519u,15109519u,4143u},
+{15109520u,15109520u,5962u},{15109525u,15109525u,7555u},{15109543u,15109543u,5098u},{15109544u,15109544u,5265u},
+{15109550u,15109550u,3590u},{15109554u,15109554u,3975u},{15109559u,15109559u,7190u},{15109562u,15109562u,4144u},
+{15109563u,15109563u,4166u},{15109567u,15109567u,5381u},{15109763u,15109763u,5508u},{15109768u,15109768u,5581u},
+{15109769u,15109769u,4283u},{15109772u,15109772u,6545u},{15109778u,15109778u,4974u},{15109782u,15109782u,5853u},
+{15109784u,15109784u,3961u},{15109787u,15109787u,3853u},{15109792u,15109792u,4425u},{15109793u,15109793u,7119u},
+{15109794u,15109794u,7420u},{15109797u,15109797u,6701u},{15109799u,15109799u,3795u},{15109800u,15109800u,7267u},
+{15109801u,15109801u,5929u},{15109802u,15109802u,6789u},{15110016u,15110016u,3484u},{15110020u,15110020u,6324u},
+{15110022u,15110022u,3997u},{15110031u,15110031u,4804u},{15110032u,15110032u,6766u},{15110038u,15110038u,6387u},
+{15110042u,15110042u,5883u},{15110043u,15110043u,7888u},{15110049u,15110049u,5799u},{15110061u,15110061u,3629u},
+{15110062u,15110062u,7999u},{15110068u,15110068u,6266u},{15110070u,15110070u,5867u},{15110071u,15110071u,5327u},
+{15110285u,15110285u,5548u},{15110287u,15110287u,4889u},{15110292u,15110292u,5509u},{15110294u,15110294u,6149u},
+{15110295u,15110295u,4284u},{15110300u,15110300u,5582u},{15110306u,15110306u,6984u},{15110316u,15110316u,4910u},
+{15110317u,15110317u,7425u},{15110330u,15110330u,8006u},{15110334u,15110334u,7056u},{15110552u,15110552u,6623u},
+{15110560u,15110560u,7256u},{15110569u,15110569u,4656u},{15110575u,15110575u,6950u},{15110584u,15110585u,4770u},
+{15110586u,15110586u,6702u},{15110792u,15110792u,4512u},{15110801u,15110801u,7447u},{15110802u,15110802u,5316u},
+{15110803u,15110803u,6150u},{15110810u,15110810u,4161u},{15110814u,15110814u,4244u},{15110820u,15110820u,7171u},
+{15110821u,15110821u,4932u},{15110827u,15110827u,4818u},{15110829u,15110829u,7478u},{15110830u,15110830u,7261u},
+{15110832u,15110832u,7062u},{15110834u,15110834u,4890u},{15110843u,15110843u,4212u},{15111041u,15111041u,6091u},
+{15111044u,15111044u,4513u},{15111045u,15111045u,7153u},{15111047u,15111047u,7445u},{15111050u,15111050u,3630u},
+{15111053u,15111053u,6790u},{15111054u,15111054u,3674u},{15111058u,15111058u,4040u},{15111060u,15111060u,4220u},
+{15111064u,15111064u,5023u},{15111066u,15111066u,3591u},{15111073u,15111073u,4259u},{15111074u,15111074u,7399u},
+{15111077u,15111077u,4400u},{15111078u,15111078u,7079u},{15111079u,15111079u,3592u},{15111084u,15111084u,6400u},
+{15111090u,15111090u,7140u},{15111092u,15111092u,7877u},{15111098u,15111098u,7479u},{15111102u,15111102u,6151u},
+{15111296u,15111296u,4911u},{15111300u,15111300u,7448u},{15111320u,15111320u,5884u},{15111325u,15111325u,5471u},
+{15111331u,15111331u,4467u},{15111338u,15111338u,3875u},{15111339u,15111339u,7878u},{15111340u,15111340u,4401u},
+{15111343u,15111343u,6951u},{15111350u,15111350u,5583u},{15111351u,15111351u,3739u},{15111352u,15111352u,6325u},
+{15111353u,15111353u,3568u},{15111355u,15111355u,3796u},{15111358u,15111358u,4949u},{15111359u,15111359u,6718u},
+{15111557u,15111557u,3740u},{15111560u,15111560u,7956u},{15111565u,15111565u,5382u},{15111566u,15111566u,3876u},
+{15111567u,15111567u,4874u},{15111569u,15111569u,3912u},{15111574u,15111574u,6064u},{15111575u,15111575u,7505u},
+{15111582u,15111582u,7100u},{15111586u,15111586u,3517u},{15111587u,15111587u,5306u},{15111590u,15111590u,4321u},
+{15111596u,15111596u,3675u},{15111597u,15111597u,5885u},{15111602u,15111602u,3741u},{15111604u,15111604u,6719u},
+{15111605u,15111605u,6624u},{15111607u,15111607u,5125u},{15111608u,15111608u,5584u},{15111614u,15111614u,5425u},
+{15111810u,15111810u,4484u},{15111811u,15111811u,7539u},{15111813u,15111813u,7957u},{15111815u,15111815u,4840u},
+{15111820u,15111820u,5226u},{15111824u,15111824u,5193u},{15111825u,15111825u,4912u},{15111831u,15111831u,4349u},
+{15111833u,15111833u,4555u},{15111835u,15111835u,3768u},{15111836u,15111836u,5266u},{15111839u,15111839u,7030u},
+{15111841u,15111841u,5817u},{15111844u,15111844u,4027u},{15111845u,15111845u,7141u},{15111847u,15111847u,5126u},
+{15111851u,15111851u,6512u},{15111852u,15111852u,7088u},{15111855u,15111855u,5267u},{15111856u,15111856u,5742u},
+{15111863u,15111863u,4199u},{15111865u,15111865u,4950u},{15111868u,15111868u,5904u},{15111869u,15111869u,5703u},
+{15112065u,15112065u,4951u},{15112069u,15112069u,4447u},{15112075u,15112075u,5426u},{15112076u,15112076u,6720u},
+{15112079u,15112079u,6828u},{15112082u,15112082u,4578u},{15112087u,15112087u,4081u},{15112096u,15112096u,4819u},
+{15112099u,15112099u,4082u},{15112101u,15112101u,6464u},{15112102u,15112102u,4200u},{15112104u,15112104u,6952u},
+{15112105u,15112105u,6791u},{15112108u,15112108u,5644u},{15112109u,15112109u,6231u},{15112113u,15112113u,7638u},
+{15112116u,15112116u,6209u},{15112122u,15112122u,6127u},{15112123u,15112124u,4875u},{15112125u,15112125u,4322u},
+{15112127u,15112127u,6065u},{15112326u,15112326u,3777u},{15112327u,15112327u,5688u},{15112329u,15112329u,4952u},
+{15112330u,15112330u,7810u},{15112332u,15112332u,7101u},{15112334u,15112334u,4751u},{15112335u,15112335u,7845u},
+{15112336u,15112336u,5161u},{15112337u,15112337u,4041u},{15112339u,15112339u,5950u},{15112340u,15112340u,5407u},
+{15112341u,15112341u,8019u},{15112350u,15112350u,5046u},{15112351u,15112351u,5480u},{15112352u,15112352u,6005u},
+{15112357u,15112357u,7300u},{15112359u,15112359u,4712u},{15112360u,15112360u,6513u},{15112365u,15112365u,5510u},
+{15112367u,15112367u,5704u},{15112368u,15112368u,7621u},{15112369u,15112369u,6232u},{15112372u,15112372u,4805u},
+{15112374u,15112374u,7102u},{15112378u,15112378u,5047u},{15112379u,15112379u,5836u},{15112577u,15112577u,6792u},
+{15112578u,15112578u,5705u},{15112579u,15112580u,7911u},{15112585u,15112585u,6985u},{15112587u,15112587u,6986u},
+{15112591u,15112591u,5810u},{15112601u,15112601u,6908u},{15112603u,15112603u,7738u},{15112605u,15112605u,6873u},
+{15112606u,15112606u,8046u},{15112607u,15112607u,5481u},{15112612u,15112612u,6066u},{15112613u,15112613u,7890u},
+{15112614u,15112614u,7935u},{15112615u,15112615u,7811u},{15112616u,15112616u,5743u},{15112617u,15112617u,4677u},
+{15112619u,15112619u,7400u},{15112622u,15112622u,5062u},{15112623u,15112623u,3676u},{15112627u,15112627u,5408u},
+{15112628u,15112628u,7198u},{15112630u,15112630u,6721u},{15112631u,15112631u,3990u},{15112632u,15112632u,6722u},
+{15112634u,15112634u,6953u},{15112836u,15112836u,7991u},{15112839u,15112839u,3447u},{15112840u,15112840u,7988u},
+{15112841u,15112841u,8000u},{15112846u,15112846u,6006u},{15112848u,15112848u,6293u},{15112849u,15112849u,5383u},
+{15112854u,15112854u,4140u},{15112855u,15112855u,5825u},{15112856u,15112856u,5886u},{15112861u,15112861u,4752u},
+{15112864u,15112864u,3742u},{15112866u,15112866u,7103u},{15112875u,15112875u,6528u},{15112878u,15112878u,4772u},
+{15112882u,15112882u,6546u},{15112883u,15112883u,7795u},{15112884u,15112884u,7572u},{15112889u,15112889u,5464u},
+{15112891u,15112891u,3677u},{15112894u,15112894u,4323u},{15113092u,15113092u,5999u},{15113094u,15113094u,4459u},
+{15113095u,15113095u,4221u},{15113097u,15113097u,7958u},{15113110u,15113110u,5845u},{15113113u,15113113u,5384u},
+{15113116u,15113116u,6152u},{15113117u,15113117u,7573u},{15113120u,15113120u,3844u},{15113126u,15113126u,8047u},
+{15113136u,15113136u,6125u},{15113138u,15113138u,3769u},{15113139u,15113139u,6033u},{15113140u,15113140u,3678u},
+{15113143u,15113143u,3502u},{15113144u,15113144u,5385u},{15113145u,15113145u,6794u},{15113146u,15113146u,6793u},
+{15113148u,15113148u,4678u},{15113150u,15113150u,6933u},{15113151u,15113151u,7206u},{15113344u,15113344u,7264u},
+{15113347u,15113347u,7936u},{15113352u,15113352u,6281u},{15113353u,15113353u,6326u},{15113355u,15113355u,5176u},
+{15113357u,15113357u,5080u},{15113364u,15113364u,5302u},{15113365u,15113365u,7031u},{15113367u,15113367u,4413u},
+{15113371u,15113371u,4700u},{15113373u,15113373u,6795u},{15113374u,15113375u,4083u},{15113382u,15113382u,4798u},
+{15113383u,15113383u,4538u},{15113384u,15113384u,4788u},{15113386u,15113386u,4857u},{15113387u,15113387u,4691u},
+{15113388u,15113388u,5091u},{15113389u,15113389u,7080u},{15113390u,15113390u,7304u},{15113393u,15113393u,6874u},
+{15113396u,15113396u,4891u},{15113398u,15113398u,7388u},{15113402u,15113402u,3984u},{15113405u,15113405u,7975u},
+{15113606u,15113606u,3485u},{15113609u,15113609u,5321u},{15113614u,15113614u,4620u},{15113615u,15113615u,7707u},
+{15113616u,15113616u,6575u},{15113617u,15113617u,7249u},{15113619u,15113619u,7580u},{15113622u,15113622u,6547u},
+{15113628u,15113628u,4350u},{15113630u,15113630u,4085u},{15113631u,15113631u,5539u},{15113645u,15113645u,7677u},
+{15113647u,15113647u,4975u},{15113648u,15113648u,3615u},{15113649u,15113649u,4337u},{15113651u,15113651u,4806u},
+{15113653u,15113653u,6598u},{15113655u,15113655u,7480u},{15113659u,15113659u,4183u},{15113662u,15113662u,5555u},
+{15113663u,15113663u,7492u},{15113863u,15113863u,5194u},{15113865u,15113865u,6128u},{15113867u,15113867u,4953u},
+{15113871u,15113871u,4146u},{15113872u,15113872u,5409u},{15113875u,15113875u,4351u},{15113877u,15113877u,7369u},
+{15113879u,15113879u,4647u},{15113882u,15113882u,4713u},{15113884u,15113884u,3805u},{15113885u,15113885u,6954u},
+{15113903u,15113903u,3743u},{15113904u,15113904u,7531u},{15113907u,15113907u,6955u},{15113910u,15113911u,3448u},
+{15113912u,15113912u,3913u},{15113918u,15113918u,5706u},{15114116u,15114116u,5048u},{15114127u,15114127u,4991u},
+{15114128u,15114128u,4773u},{15114129u,15114129u,3518u},{15114130u,15114130u,7365u},{15114131u,15114131u,5990u},
+{15114132u,15114132u,6327u},{15114138u,15114138u,6328u},{15114141u,15114141u,7401u},{15114153u,15114153u,3914u},
+{15114156u,15114156u,3486u},{15114159u,15114159u,3450u},{15114160u,15114160u,4157u},{15114161u,15114161u,6875u},
+{15114163u,15114163u,4579u},{15114164u,15114164u,5707u},{15114165u,15114165u,7127u},{15114166u,15114166u,5268u},
+{15114171u,15114171u,5269u},{15114174u,15114174u,6723u},{15114386u,15114386u,5645u},{15114387u,15114387u,6658u},
+{15114390u,15114390u,5386u},{15114391u,15114391u,4602u},{15114401u,15114401u,3877u},{15114402u,15114402u,4992u},
+{15114410u,15114410u,6876u},{15114415u,15114415u,6233u},{15114424u,15114424u,7704u},{15114425u,15114425u,4028u},
+{15114428u,15114428u,3631u},{15114429u,15114429u,6576u},{15114624u,15114624u,3616u},{15114625u,15114625u,7678u},
+{15114626u,15114626u,3713u},{15114627u,15114627u,4285u},{15114632u,15114632u,5811u},{15114638u,15114638u,7020u},
+{15114640u,15114640u,4338u},{15114641u,15114641u,5346u},{15114643u,15114643u,7891u},{15114644u,15114644u,4130u},
+{15114669u,15114669u,6987u},{15114678u,15114678u,7454u},{15114687u,15114687u,3487u},{15114881u,15114881u,4431u},
+{15114885u,15114885u,4714u},{15114895u,15114895u,3770u},{15114899u,15114899u,6577u},{15114900u,15114900u,7342u},
+{15114903u,15114903u,3679u},{15114909u,15114909u,6796u},{15114911u,15114911u,7959u},{15114913u,15114913u,6110u},
+{15114914u,15114914u,7220u},{15114919u,15114919u,6067u},{15114920u,15114920u,4621u},{15114925u,15114925u,5270u},
+{15114927u,15114927u,6767u},{15114928u,15114928u,3714u},{15114929u,15114929u,3778u},{15114931u,15114931u,5511u},
+{15114933u,15114933u,5011u},{15114934u,15114934u,4858u},{15115140u,15115140u,4087u},{15115141u,15115141u,5049u},
+{15115145u,15115145u,4738u},{15115147u,15115147u,4086u},{15115149u,15115149u,3779u},{15115154u,15115154u,5099u},
+{15115157u,15115157u,6842u},{15115159u,15115159u,6797u},{15115160u,15115160u,4020u},{15115162u,15115162u,5177u},
+{15115167u,15115167u,4339u},{15115168u,15115168u,4245u},{15115175u,15115175u,6523u},{15115176u,15115176u,3715u},
+{15115182u,15115182u,5322u},{15115186u,15115186u,5387u},{15115193u,15115193u,4286u},{15115194u,15115194u,3823u},
+{15115392u,15115392u,6111u},{15115397u,15115397u,6401u},{15115405u,15115405u,5725u},{15115406u,15115406u,7268u},
+{15115410u,15115410u,7221u},{15115431u,15115431u,4753u},{15115440u,15115440u,5868u},{15115453u,15115453u,5964u},
+{15115455u,15115455u,7301u},{15115658u,15115658u,5887u},{15115667u,15115667u,7592u},{15115668u,15115668u,5452u},
+{15115669u,15115669u,7389u},{15115671u,15115671u,3607u},{15115673u,15115673u,4820u},{15115674u,15115674u,7222u},
+{15115678u,15115678u,4608u},{15115680u,15115680u,4147u},{15115681u,15115682u,6329u},{15115683u,15115683u,4859u},
+{15115688u,15115688u,6724u},{15115691u,15115691u,6928u},{15115693u,15115693u,5932u},{15115694u,15115694u,6599u},
+{15115695u,15115695u,5646u},{15115701u,15115701u,4021u},{15115703u,15115703u,7693u},{15115704u,15115704u,7269u},
+{15115705u,15115705u,6007u},{15115925u,15115925u,6183u},{15115931u,15115931u,6988u},{15115932u,15115932u,4954u},
+{15115941u,15115941u,7913u},{15115943u,15115943u,5195u},{15115950u,15115950u,6008u},{15115956u,15115956u,4580u},
+{15115963u,15115963u,7426u},{15116161u,15116161u,3744u},{15116163u,15116163u,4913u},{15116171u,15116171u,3915u},
+{15116172u,15116172u,7460u},{15116173u,15116173u,7104u},{15116176u,15116176u,3862u},{15116200u,15116200u,3816u},
+{15116202u,15116202u,3569u},{15116219u,15116219u,3998u},{15116221u,15116221u,6798u},{15116223u,15116223u,4029u},
+{15116418u,15116418u,5800u},{15116426u,15116426u,4997u},{15116433u,15116433u,4432u},{15116435u,15116435u,4567u},
+{15116439u,15116439u,6600u},{15116441u,15116441u,7581u},{15116446u,15116446u,7270u},{15116447u,15116447u,6548u},
+{15116449u,15116449u,4774u},{15116451u,15116451u,5888u},{15116469u,15116469u,7223u},{15116472u,15116472u,4892u},
+{15116473u,15116473u,5585u},{15116474u,15116474u,7866u},{15116477u,15116477u,6909u},{15116676u,15116676u,3519u},
+{15116680u,15116680u,6153u},{15116683u,15116683u,3878u},{15116690u,15116690u,6239u},{15116691u,15116691u,5647u},
+{15116696u,15116696u,4015u},{15116697u,15116697u,4366u},{15116703u,15116703u,4088u},{15116705u,15116705u,5347u},
+{15116715u,15116715u,7951u},{15116928u,15116928u,4201u},{15116932u,15116932u,3632u},{15116937u,15116937u,6725u},
+{15116941u,15116941u,5915u},{15116942u,15116942u,4042u},{15116951u,15116951u,5024u},{15116956u,15116956u,7937u},
+{15116962u,15116962u,3620u},{15116963u,15116963u,6549u},{15116979u,15116979u,5227u},{15116987u,15116987u,7656u},
+{15117186u,15117186u,4287u},{15117187u,15117187u,3985u},{15117203u,15117203u,4514u},{15117210u,15117210u,4448u},
+{15117211u,15117211u,6927u},{15117238u,15117238u,7724u},{15117243u,15117243u,5858u},{15117444u,15117444u,4391u},
+{15117450u,15117450u,3976u},{15117452u,15117452u,6550u},{15117458u,15117458u,4392u},{15117462u,15117462u,4402u},
+{15117472u,15117472u,8027u},{15117473u,15117473u,7048u},{15117475u,15117475u,8020u},{15117490u,15117490u,6169u},
+{15117498u,15117498u,4089u},{15117501u,15117501u,8028u},{15117502u,15117502u,3824u},{15117702u,15117702u,8029u},
+{15117703u,15117703u,7727u},{15117708u,15117708u,3451u},{15117710u,15117710u,7413u},{15117712u,15117712u,3916u},
+{15117727u,15117727u,5937u},{15117729u,15117729u,7889u},{15117730u,15117730u,6956u},{15117731u,15117731u,6726u},
+{15117732u,15117732u,7049u},{15117733u,15117733u,5063u},{15117734u,15117734u,4821u},{15117738u,15117738u,6133u},
+{15117746u,15117746u,5494u},{15117751u,15117751u,4460u},{15117752u,15117752u,3991u},{15117755u,15117755u,5271u},
+{15117759u,15117759u,4795u},{15117955u,15117955u,5837u},{15117956u,15117956u,6989u},{15117958u,15117958u,7436u},
+{15117961u,15117961u,5648u},{15117962u,15117962u,5586u},{15117974u,15117974u,5726u},{15117976u,15117976u,6524u},
+{15117982u,15117982u,6240u},{15117998u,15117998u,4485u},{15117999u,15117999u,5228u},{15118002u,15118002u,5465u},
+{15118005u,15118005u,4202u},{15118007u,15118007u,6376u},{15118010u,15118010u,5317u},{15118012u,15118012u,3470u},
+{15118015u,15118015u,6659u},{15118209u,15118209u,7996u},{15118213u,15118213u,6402u},{15118214u,15118214u,3917u},
+{15118219u,15118219u,4822u},{15118221u,15118221u,4775u},{15118223u,15118223u,4715u},{15118226u,15118226u,4309u},
+{15118227u,15118227u,6356u},{15118228u,15118228u,5196u},{15118230u,15118232u,5197u},{15118235u,15118235u,4776u},
+{15118251u,15118251u,7812u},{15118252u,15118252u,3918u},{15118472u,15118472u,6660u},{15118479u,15118479u,5774u},
+{15118481u,15118481u,4877u},{15118483u,15118483u,4728u},{15118499u,15118499u,4090u},{15118516u,15118516u,5587u},
+{15118519u,15118519u,5238u},{15118520u,15118520u,6009u},{15118526u,15118526u,5012u},{15118720u,15118720u,6727u},
+{15118721u,15118721u,6929u},{15118722u,15118722u,3919u},{15118734u,15118734u,5013u},{15118736u,15118736u,5410u},
+{15118741u,15118741u,5307u},{15118743u,15118743u,7639u},{15118746u,15118746u,6068u},{15118749u,15118749u,5938u},
+{15118750u,15118750u,7855u},{15118751u,15118751u,3545u},{15118752u,15118752u,6957u},{15118760u,15118760u,3784u},
+{15118762u,15118762u,6129u},{15118765u,15118765u,6034u},{15118768u,15118768u,7437u},{15118770u,15118770u,4055u},
+{15118774u,15118774u,4841u},{15118778u,15118778u,3649u},{15118781u,15118781u,4091u},{15118782u,15118782u,5162u},
+{15118977u,15118977u,5765u},{15118978u,15118978u,4092u},{15118979u,15118979u,6079u},{15118981u,15118981u,6267u},
+{15118982u,15118982u,7679u},{15118983u,15118983u,5965u},{15118984u,15118984u,7370u},{15118988u,15118988u,4324u},
+{15118992u,15118992u,4789u},{15118994u,15118994u,4796u},{15118995u,15118995u,4234u},{15118996u,15118996u,4739u},
+{15118997u,15118997u,4849u},{15118998u,15118998u,7308u},{15119001u,15119001u,5272u},{15119002u,15119002u,6958u},
+{15119003u,15119003u,7506u},{15119019u,15119019u,4692u},{15119022u,15119022u,6601u},{15119027u,15119027u,7622u},
+{15119032u,15119032u,5200u},{15119033u,15119033u,6331u},{15119035u,15119035u,7343u},{15119036u,15119036u,5512u},
+{15119037u,15119037u,3745u},{15119038u,15119038u,7179u},{15119039u,15119039u,5966u},{15119233u,15119233u,7914u},
+{15119234u,15119234u,7776u},{15119236u,15119236u,5453u},{15119241u,15119241u,7154u},{15119242u,15119242u,4893u},
+{15119244u,15119244u,7607u},{15119251u,15119251u,7856u},{15119253u,15119253u,5018u},{15119255u,15119255u,5273u},
+{15119259u,15119259u,5014u},{15119265u,15119265u,7556u},{15119266u,15119266u,7481u},{15119267u,15119267u,6388u},
+{15119269u,15119269u,4187u},{15119272u,15119272u,6877u},{15119275u,15119275u,7739u},{15119278u,15119278u,4914u},
+{15119279u,15119279u,4878u},{15119280u,15119280u,7438u},{15119283u,15119283u,6010u},{15119499u,15119499u,5889u},
+{15119500u,15119500u,4480u},{15119505u,15119505u,5064u},{15119511u,15119511u,5495u},{15119513u,15119513u,5588u},
+{15119515u,15119515u,4382u},{15119518u,15119518u,4340u},{15119525u,15119525u,6990u},{15119527u,15119527u,6332u},
+{15119529u,15119529u,5454u},{15119530u,15119530u,7857u},{15119538u,15119538u,6878u},{15119541u,15119541u,5649u},
+{15119542u,15119542u,8016u},{15119544u,15119544u,3845u},{15119545u,15119545u,6268u},{15119547u,15119547u,7899u},
+{15119549u,15119549u,8032u},{15119550u,15119550u,7482u},{15119745u,15119745u,4581u},{15119769u,15119769u,6687u},
+{15119770u,15119770u,6910u},{15119772u,15119772u,5229u},{15119779u,15119779u,6112u},{15119782u,15119782u,7557u},
+{15119785u,15119785u,7813u},{15119786u,15119786u,4414u},{15119788u,15119788u,4622u},{15119790u,15119790u,5127u},
+{15119796u,15119796u,6170u},{15119799u,15119799u,7694u},{15119800u,15119800u,7371u},{15119801u,15119801u,7764u},
+{15119807u,15119807u,7507u},{15120005u,15120005u,5986u},{15120007u,15120007u,3680u},{15120008u,15120008u,5513u},
+{15120009u,15120009u,5472u},{15120012u,15120012u,6184u},{15120013u,15120013u,7960u},{15120014u,15120014u,5967u},
+{15120017u,15120017u,5540u},{15120019u,15120019u,5968u},{15120021u,15120021u,7207u},{15120047u,15120047u,5846u},
+{15120050u,15120050u,5854u},{15120053u,15120053u,7657u},{15120256u,15120256u,6728u},{15120259u,15120259u,3977u},
+{15120260u,15120260u,7344u},{15120261u,15120261u,5411u},{15120262u,15120262u,7961u},{15120263u,15120263u,4093u},
+{15120267u,15120267u,4648u},{15120271u,15120271u,7814u},{15120273u,15120273u,5633u},{15120280u,15120280u,4288u},
+{15120281u,15120281u,6843u},{15120282u,15120282u,4568u},{15120286u,15120286u,5556u},{15120289u,15120289u,4222u},
+{15120296u,15120296u,6729u},{15120298u,15120298u,4597u},{15120299u,15120299u,6382u},{15120302u,15120302u,7938u},
+{15120305u,15120305u,5766u},{15120307u,15120307u,5650u},{15120309u,15120309u,5969u},{15120311u,15120311u,7846u},
+{15120312u,15120312u,7199u},{15120313u,15120313u,5930u},{15120314u,15120314u,7155u},{15120315u,15120315u,7180u},
+{15120535u,15120535u,5323u},{15120537u,15120537u,7892u},{15120538u,15120538u,6602u},{15120539u,15120539u,3520u},
+{15120543u,15120543u,6730u},{15120544u,15120544u,3593u},{15120545u,15120545u,4289u},{15120547u,15120547u,5274u},
+{15120548u,15120548u,4933u},{15120549u,15120549u,5801u},{15120550u,15120550u,6099u},{15120555u,15120555u,5455u},
+{15120556u,15120556u,7334u},{15120557u,15120557u,6294u},{15120559u,15120559u,7680u},{15120562u,15120562u,5427u},
+{15120564u,15120564u,3503u},{15120566u,15120566u,6011u},{15120568u,15120568u,6333u},{15120570u,15120570u,4807u},
+{15120572u,15120572u,4860u},{15120573u,15120573u,6578u},{15120574u,15120574u,7847u},{15120771u,15120771u,4976u},
+{15120772u,15120772u,4861u},{15120778u,15120778u,6879u},{15120781u,15120781u,4203u},{15120790u,15120790u,7815u},
+{15120792u,15120792u,5348u},{15120795u,15120795u,4223u},{15120796u,15120796u,5727u},{15120798u,15120798u,6731u},
+{15120799u,15120799u,7915u},{15120807u,15120807u,6185u},{15120811u,15120811u,7271u},{15120814u,15120814u,6453u},
+{15120815u,15120815u,7429u},{15120818u,15120818u,6269u},{15120819u,15120819u,4148u},{15120826u,15120826u,5065u},
+{15121040u,15121040u,6270u},{15121046u,15121046u,6911u},{15121052u,15121052u,4582u},{15121053u,15121053u,3920u},
+{15121055u,15121055u,4754u},{15121058u,15121058u,6465u},{15121061u,15121061u,5128u},{15121066u,15121066u,3716u},
+{15121067u,15121067u,6083u},{15121071u,15121071u,5514u},{15121073u,15121073u,6991u},{15121078u,15121078u,6186u},
+{15121082u,15121082u,4189u},{15121282u,15121282u,4955u},{15121284u,15121284u,7105u},{15121285u,15121285u,4746u},
+{15121289u,15121289u,7916u},{15121291u,15121291u,6493u},{15121292u,15121292u,7142u},{15121294u,15121294u,7777u},
+{15121297u,15121297u,7900u},{15121299u,15121299u,6579u},{15121300u,15121300u,4290u},{15121327u,15121327u,7208u},
+{15121332u,15121332u,6625u},{15121336u,15121336u,7816u},{15121342u,15121342u,3780u},{15121343u,15121343u,4679u},
+{15121537u,15121537u,5905u},{15121538u,15121538u,7582u},{15121542u,15121542u,7366u},{15121551u,15121551u,4569u},
+{15121553u,15121553u,3570u},{15121556u,15121556u,5970u},{15121557u,15121557u,6799u},{15121568u,15121568u,4666u},
+{15121570u,15121570u,7640u},{15121571u,15121571u,4468u},{15121579u,15121579u,4680u},{15121580u,15121580u,6959u},
+{15121585u,15121585u,5589u},{15121586u,15121586u,7106u},{15121592u,15121592u,6695u},{15121599u,15121599u,6551u},
+{15121793u,15121793u,6012u},{15121809u,15121809u,4934u},{15121812u,15121812u,3650u},{15121815u,15121815u,7033u},
+{15121816u,15121816u,4915u},{15121818u,15121818u,5634u},{15121819u,15121819u,6529u},{15121822u,15121822u,4515u},
+{15121823u,15121823u,5412u},{15121826u,15121826u,7917u},{15121828u,15121828u,6362u},{15121837u,15121837u,4224u},
+{15121838u,15121838u,6800u},{15121840u,15121840u,3986u},{15121850u,15121850u,6525u},{15121852u,15121852u,4341u},
+{15121853u,15121853u,5066u},{15121854u,15121854u,4639u},{15122049u,15122049u,5328u},{15122052u,15122052u,7040u},
+{15122056u,15122056u,7172u},{15122061u,15122061u,6880u},{15122062u,15122062u,7514u},{15122064u,15122064u,6241u},
+{15122068u,15122068u,7817u},{15122071u,15122071u,3488u},{15122083u,15122083u,7641u},{15122084u,15122084u,7446u},
+{15122087u,15122087u,4507u},{15122094u,15122094u,7939u},{15122095u,15122095u,7063u},{15122097u,15122097u,6661u},
+{15122099u,15122099u,6069u},{15122105u,15122105u,4225u},{15122110u,15122110u,4213u},{15122304u,15122304u,3633u},
+{15122305u,15122305u,7402u},{15122306u,15122306u,4486u},{15122307u,15122307u,4175u},{15122314u,15122314u,6035u},
+{15122325u,15122325u,5677u},{15122330u,15122330u,6013u},{15122335u,15122335u,6768u},{15122336u,15122336u,7818u},
+{15122337u,15122337u,6334u},{15122340u,15122340u,4291u},{15122345u,15122345u,7819u},{15122347u,15122347u,4403u},
+{15122348u,15122348u,6912u},{15122351u,15122351u,7403u},{15122353u,15122353u,5230u},{15122366u,15122366u,4449u},
+{15171713u,15171713u,5890u},{15171717u,15171717u,7778u},{15171718u,15171718u,4310u},{15171721u,15171721u,5275u},
+{15171723u,15171723u,5767u},{15171727u,15171727u,4583u},{15171729u,15171729u,7574u},{15171733u,15171733u,5231u},
+{15171736u,15171736u,4516u},{15171738u,15171738u,7642u},{15171739u,15171739u,6014u},{15171740u,15171740u,6370u},
+{15171741u,15171741u,4461u},{15171742u,15171742u,6732u},{15171743u,15171743u,5515u},{15171747u,15171747u,7695u},
+{15171751u,15171751u,4539u},{15171752u,15171752u,4544u},{15171759u,15171759u,6015u},{15171767u,15171767u,6437u},
+{15171774u,15171774u,4393u},{15171980u,15171980u,3825u},{15171984u,15171984u,7779u},{15171985u,15171985u,5562u},
+{15171992u,15171992u,7414u},{15171997u,15171997u,7820u},{15172003u,15172003u,4681u},{15172011u,15172011u,7867u},
+{15172016u,15172016u,7940u},{15172024u,15172024u,3921u},{15172028u,15172028u,6514u},{15172029u,15172029u,6580u},
+{15172229u,15172229u,3681u},{15172234u,15172234u,7321u},{15172238u,15172238u,5991u},{15172242u,15172242u,7224u},
+{15172248u,15172248u,8021u},{15172249u,15172249u,6494u},{15172250u,15172250u,3846u},{15172257u,15172257u,6733u},
+{15172260u,15172260u,5516u},{15172267u,15172267u,7740u},{15172268u,15172268u,3594u},{15172269u,15172269u,7415u},
+{15172271u,15172271u,7780u},{15172275u,15172275u,5050u},{15172279u,15172279u,6881u},{15172280u,15172280u,6515u},
+{15172281u,15172281u,6696u},{15172488u,15172488u,4481u},{15172491u,15172491u,8007u},{15172495u,15172495u,6070u},
+{15172504u,15172504u,7858u},{15172505u,15172505u,4383u},{15172509u,15172509u,6935u},{15172511u,15172511u,5971u},
+{15172529u,15172529u,3682u},{15172537u,15172537u,7515u},{15172541u,15172541u,5100u},{15172740u,15172740u,7983u},
+{15172745u,15172745u,5920u},{15172748u,15172748u,6913u},{15172761u,15172761u,4977u},{15172762u,15172762u,5163u},
+{15172766u,15172766u,4325u},{15172769u,15172769u,4823u},{15172774u,15172774u,7225u},{15172784u,15172784u,5992u},
+{15172790u,15172790u,5972u},{15172999u,15172999u,8001u},{15173001u,15173001u,4469u},{15173002u,15173002u,7992u},
+{15173004u,15173004u,7918u},{15173006u,15173006u,6662u},{15173008u,15173008u,6016u},{15173014u,15173014u,4141u},
+{15173017u,15173017u,5973u},{15173020u,15173020u,6234u},{15173022u,15173022u,5318u},{15173028u,15173028u,4716u},
+{15173029u,15173029u,7893u},{15173030u,15173030u,7976u},{15173031u,15173031u,6801u},{15173033u,15173033u,4998u},
+{15173036u,15173036u,5891u},{15173038u,15173038u,6495u},{15173053u,15173053u,5428u},{15173252u,15173252u,5728u},
+{15173257u,15173257u,6242u},{15173258u,15173258u,6253u},{15173263u,15173263u,7984u},{15173266u,15173266u,7781u},
+{15173268u,15173268u,6187u},{15173273u,15173273u,8048u},{15173279u,15173279u,5635u},{15173282u,15173282u,5101u},
+{15173292u,15173292u,6071u},{15173297u,15173297u,5987u},{15173305u,15173306u,8049u},{15173310u,15173310u,7345u},
+{15173505u,15173505u,6000u},{15173507u,15173507u,5974u},{15173512u,15173512u,4367u},{15173513u,15173513u,4326u},
+{15173518u,15173518u,4556u},{15173520u,15173520u,4640u},{15173522u,15173522u,5517u},{15173524u,15173524u,4999u},
+{15173525u,15173525u,5975u},{15173535u,15173535u,6017u},{15173541u,15173541u,6802u},{15173542u,15173542u,7064u},
+{15173543u,15173543u,5590u},{15173549u,15173549u,7243u},{15173550u,15173550u,5473u},{15173563u,15173563u,7985u},
+{15173564u,15173564u,5744u},{15173566u,15173566u,4292u},{15173567u,15173567u,6154u},{15173760u,15173760u,7731u},
+{15173766u,15173766u,7575u},{15173776u,15173776u,4517u},{15173787u,15173787u,4394u},{15173802u,15173802u,6803u},
+{15173804u,15173804u,7483u},{15173805u,15173805u,6587u},{15173808u,15173808u,6271u},{15173810u,15173810u,6295u},
+{15173813u,15173813u,6516u},{15173814u,15173814u,5129u},{15173818u,15173818u,5869u},{15173819u,15173819u,7962u},
+{15173821u,15173821u,5349u},{15173822u,15173822u,6422u},{15174016u,15174016u,5350u},{15174022u,15174022u,6552u},
+{15174023u,15174023u,7521u},{15174024u,15174024u,7493u},{15174028u,15174028u,7508u},{15174034u,15174034u,7191u},
+{15174040u,15174040u,4311u},{15174041u,15174041u,5782u},{15174043u,15174043u,6210u},{15174045u,15174045u,5232u},
+{15174047u,15174047u,4777u},{15174049u,15174049u,4778u},{15174050u,15174050u,4545u},{15174055u,15174055u,4790u},
+{15174057u,15174057u,4850u},{15174066u,15174066u,5369u},{15174073u,15174073u,7472u},{15174077u,15174077u,3638u},
+{15174272u,15174272u,5388u},{15174273u,15174273u,4623u},{15174306u,15174306u,4312u},{15174311u,15174311u,8051u},
+{15174316u,15174316u,3639u},{15174319u,15174319u,5015u},{15174528u,15174528u,5351u},{15174530u,15174530u,3847u},
+{15174532u,15174532u,6626u},{15174542u,15174542u,5831u},{15174544u,15174544u,7821u},{15174551u,15174551u,3922u},
+{15174553u,15174553u,6603u},{15174561u,15174561u,3879u},{15174569u,15174569u,5591u},{15174584u,15174584u,4624u},
+{15174585u,15174585u,7765u},{15174588u,15174588u,4415u},{15174589u,15174589u,7509u},{15174794u,15174794u,6036u},
+{15174806u,15174806u,7107u},{15174811u,15174811u,4729u},{15174812u,15174812u,5708u},{15174813u,15174813u,6836u},
+{15174821u,15174821u,6138u},{15174825u,15174825u,5482u},{15174826u,15174826u,6604u},{15174827u,15174827u,4808u},
+{15174838u,15174839u,6335u},{15174846u,15174846u,7901u},{15174847u,15174847u,6272u},{15175044u,15175044u,6080u},
+{15175045u,15175045u,5276u},{15175056u,15175056u,6553u},{15175058u,15175058u,6072u},{15175063u,15175063u,3980u},
+{15175080u,15175080u,4313u},{15175082u,15175082u,7941u},{15175088u,15175088u,6018u},{15175090u,15175090u,7949u},
+{15175093u,15175093u,4488u},{15175096u,15175096u,5592u},{15175098u,15175098u,4214u},{15175099u,15175099u,7725u},
+{15175300u,15175300u,7741u},{15175302u,15175302u,6496u},{15175303u,15175303u,5552u},{15175305u,15175305u,6081u},
+{15175307u,15175307u,6130u},{15175310u,15175310u,6734u},{15175316u,15175316u,7156u},{15175318u,15175318u,3923u},
+{15175319u,15175319u,6211u},{15175320u,15175320u,4094u},{15175327u,15175327u,4879u},{15175335u,15175335u,6363u},
+{15175337u,15175337u,6113u},{15175341u,15175341u,5233u},{15175346u,15175346u,4495u},{15175347u,15175347u,4260u},
+{15175353u,15175353u,7742u},{15175552u,15175552u,4894u},{15175554u,15175554u,3452u},{15175561u,15175561u,4880u},
+{15175562u,15175562u,5308u},{15175564u,15175564u,7608u},{15175565u,15175565u,6992u},{15175567u,15175567u,3471u},
+{15175574u,15175574u,3848u},{15175577u,15175577u,3797u},{15175581u,15175581u,7977u},{15175582u,15175582u,4384u},
+{15175584u,15175584u,6882u},{15175587u,15175587u,5651u},{15175588u,15175588u,5067u},{15175589u,15175589u,6423u},
+{15175590u,15175590u,7713u},{15175593u,15175593u,7782u},{15175594u,15175594u,3999u},{15175597u,15175597u,4916u},
+{15175607u,15175607u,4824u},{15175609u,15175609u,5483u},{15175613u,15175613u,6735u},{15175614u,15175614u,7743u},
+{15175809u,15175809u,5429u},{15175811u,15175811u,3924u},{15175813u,15175813u,4416u},{15175814u,15175814u,4625u},
+{15175815u,15175815u,5593u},{15175817u,15175817u,4584u},{15175827u,15175827u,6114u},{15175835u,15175835u,7372u},
+{15175840u,15175840u,6663u},{15175841u,15175841u,5636u},{15175842u,15175842u,7404u},{15175845u,15175845u,7822u},
+{15175846u,15175846u,4095u},{15175848u,15175848u,3781u},{15175850u,15175850u,4096u},{15175851u,15175851u,5102u},
+{15175852u,15175852u,6115u},{15175854u,15175854u,6844u},{15175855u,15175855u,3826u},{15175856u,15175856u,5993u},
+{15175859u,15175859u,4649u},{15175860u,15175860u,4043u},{15175861u,15175861u,5201u},{15175862u,15175862u,7484u},
+{15175864u,15175864u,7405u},{15175866u,15175866u,5019u},{15175871u,15175871u,7848u},{15176064u,15176064u,6212u},
+{15176065u,15176065u,4779u},{15176067u,15176067u,7302u},{15176068u,15176068u,5430u},{15176075u,15176075u,6296u},
+{15176085u,15176085u,7623u},{15176087u,15176087u,6273u},{15176089u,15176089u,4173u},{15176090u,15176090u,7823u},
+{15176091u,15176091u,6019u},{15176092u,15176092u,6337u},{15176094u,15176094u,5389u},{15176095u,15176095u,5674u},
+{15176096u,15176096u,4585u},{15176098u,15176098u,6188u},{15176100u,15176100u,6155u},{15176101u,15176101u,6084u},
+{15176104u,15176104u,6993u},{15176105u,15176105u,7783u},{15176106u,15176106u,4657u},{15176111u,15176111u,4417u},
+{15176126u,15176126u,4030u},{15176322u,15176322u,4097u},{15176323u,15176323u,4626u},{15176327u,15176327u,5431u},
+{15176329u,15176329u,4470u},{15176331u,15176331u,6554u},{15176344u,15176344u,4641u},{15176348u,15176348u,7919u},
+{15176350u,15176350u,4895u},{15176351u,15176351u,3683u},{15176353u,15176353u,6994u},{15176355u,15176355u,4098u},
+{15176357u,15176357u,3684u},{15176359u,15176359u,5025u},{15176360u,15176360u,7065u},{15176362u,15176362u,6804u},
+{15176368u,15176368u,7894u},{15176370u,15176370u,5594u},{15176373u,15176373u,5939u},{15176377u,15176377u,5637u},
+{15176381u,15176381u,5363u},{15176383u,15176383u,5432u},{15176582u,15176582u,7021u},{15176586u,15176586u,3685u},
+{15176591u,15176591u,4540u},{15176596u,15176596u,6020u},{15176600u,15176600u,3827u},{15176602u,15176602u,7066u},
+{15176604u,15176604u,3806u},{15176608u,15176608u,7824u},{15176610u,15176610u,7583u},{15176611u,15176611u,7494u},
+{15176614u,15176614u,6100u},{15176622u,15176622u,6092u},{15176631u,15176631u,6497u},{15176833u,15176833u,5051u},
+{15176836u,15176836u,3640u},{15176849u,15176849u,6936u},{15176853u,15176853u,6093u},{15176856u,15176856u,3521u},
+{15176858u,15176858u,5768u},{15176859u,15176859u,7181u},{15176863u,15176863u,5370u},{15176867u,15176867u,5309u},
+{15176869u,15176869u,5371u},{15176870u,15176870u,5518u},{15176872u,15176872u,6189u},{15176875u,15176875u,5068u},
+{15176876u,15176876u,6190u},{15176880u,15176880u,6664u},{15176881u,15176881u,6338u},{15176882u,15176882u,3532u},
+{15176883u,15176883u,5745u},{15176887u,15176887u,4149u},{15176888u,15176888u,6665u},{15176890u,15176890u,6736u},
+{15177095u,15177095u,4011u},{15177100u,15177100u,3717u},{15177103u,15177103u,6139u},{15177105u,15177105u,6666u},
+{15177107u,15177107u,4235u},{15177108u,15177108u,4917u},{15177113u,15177113u,4586u},{15177115u,15177115u,6995u},
+{15177116u,15177116u,7289u},{15177117u,15177117u,4825u},{15177122u,15177122u,7609u},{15177125u,15177125u,4426u},
+{15177126u,15177126u,8008u},{15177130u,15177130u,5000u},{15177135u,15177135u,6914u},{15177136u,15177136u,6424u},
+{15177141u,15177141u,7868u},{15177142u,15177142u,4246u},{15177144u,15177144u,4099u},{15177146u,15177146u,3546u},
+{15177151u,15177151u,4100u},{15177350u,15177350u,3547u},{15177351u,15177351u,6883u},{15177354u,15177354u,7192u},
+{15177355u,15177355u,7610u},{15177358u,15177358u,5520u},{15177359u,15177359u,5519u},{15177361u,15177361u,6403u},
+{15177373u,15177373u,5310u},{15177381u,15177381u,3571u},{15177387u,15177387u,5951u},{15177393u,15177393u,7558u},
+{15177394u,15177394u,7599u},{15177395u,15177395u,3522u},{15177397u,15177397u,6498u},{15177400u,15177400u,4215u},
+{15177401u,15177401u,6996u},{15177404u,15177404u,4342u},{15177405u,15177405u,6605u},{15177406u,15177406u,7022u},
+{15177602u,15177602u,3453u},{15177605u,15177605u,5052u},{15177607u,15177607u,6937u},{15177613u,15177613u,6425u},
+{15177618u,15177618u,5892u},{15177620u,15177620u,7346u},{15177621u,15177621u,8022u},{15177624u,15177624u,4352u},
+{15177625u,15177625u,3686u},{15177627u,15177627u,7455u},{15177634u,15177634u,4627u},{15177648u,15177648u,4226u},
+{15177650u,15177650u,4658u},{15177652u,15177652u,7347u},{15177658u,15177658u,5202u},{15177660u,15177660u,3746u},
+{15177856u,15177856u,5906u},{15177869u,15177869u,5893u},{15177881u,15177881u,5521u},{15177887u,15177887u,6085u},
+{15177888u,15177888u,7143u},{15177889u,15177889u,7108u},{15177890u,15177890u,4918u},{15177892u,15177892u,4587u},
+{15177894u,15177894u,5595u},{15177915u,15177915u,4570u},{15178114u,15178114u,4557u},{15178124u,15178124u,5826u},
+{15178126u,15178126u,3489u},{15178130u,15178130u,6339u},{15178134u,15178134u,5026u},{15178145u,15178145u,7348u},
+{15178148u,15178148u,6688u},{15178153u,15178153u,4376u},{15178156u,15178156u,5433u},{15178160u,15178160u,6094u},
+{15178162u,15178162u,6667u},{15178168u,15178168u,3718u},{15178171u,15178171u,4368u},{15178172u,15178172u,4935u},
+{15178173u,15178174u,4993u},{15178372u,15178372u,6627u},{15178374u,15178374u,3572u},{15178375u,15178375u,7920u},
+{15178382u,15178382u,3880u},{15178384u,15178384u,3747u},{15178387u,15178387u,7825u},{15178414u,15178414u,7600u},
+{15178426u,15178426u,7272u},{15178431u,15178431u,4755u},{15178626u,15178626u,6213u},{15178627u,15178627u,4978u},
+{15178630u,15178630u,5164u},{15178632u,15178632u,6021u},{15178634u,15178634u,6438u},{15178642u,15178642u,7665u},
+{15178646u,15178646u,3573u},{15178651u,15178651u,5484u},{15178652u,15178652u,4293u},{15178654u,15178654u,6526u},
+{15178655u,15178655u,4731u},{15178657u,15178657u,6997u},{15178659u,15178659u,3523u},{15178660u,15178660u,4919u},
+{15178663u,15178663u,4518u},{15178670u,15178670u,4791u},{15178674u,15178674u,4730u},{15178676u,15178676u,6975u},
+{15178680u,15178680u,5352u},{15178684u,15178684u,4920u},{15178686u,15178686u,5652u},{15178881u,15178881u,5485u},
+{15178884u,15178884u,4740u},{15178888u,15178888u,7421u},{15178889u,15178889u,4862u},{15178891u,15178891u,3490u},
+{15178910u,15178910u,6998u},{15178912u,15178912u,4741u},{15178921u,15178921u,7744u},{15178935u,15178935u,3978u},
+{15178936u,15178936u,4780u},{15178938u,15178938u,6805u},{15178940u,15178940u,5812u},{15179136u,15179136u,7057u},
+{15179149u,15179149u,7745u},{15179163u,15179163u,6737u},{15179169u,15179169u,5596u},{15179171u,15179171u,4314u},
+{15179174u,15179174u,4792u},{15179179u,15179179u,7193u},{15179193u,15179193u,4294u},{15179198u,15179198u,3748u},
+{15179199u,15179199u,6037u},{15179403u,15179403u,6999u},{15179409u,15179409u,4756u},{15179422u,15179422u,4682u},
+{15179429u,15179429u,5038u},{15179436u,15179436u,5653u},{15179437u,15179437u,4558u},{15179440u,15179440u,3524u},
+{15179443u,15179443u,4343u},{15179451u,15179451u,7182u},{15179452u,15179452u,3621u},{15179455u,15179455u,3925u},
+{15179671u,15179671u,7244u},{15179675u,15179675u,4781u},{15179676u,15179676u,4060u},{15179682u,15179682u,5709u},
+{15179683u,15179683u,6404u},{15179685u,15179685u,6960u},{15179689u,15179689u,3926u},{15179693u,15179693u,4204u},
+{15179694u,15179694u,6134u},{15179695u,15179695u,3881u},{15179699u,15179699u,5413u},{15179906u,15179906u,5277u},
+{15179922u,15179922u,5203u},{15179941u,15179941u,6961u},{15179942u,15179942u,7120u},{15179943u,15179943u,7373u},
+{15179948u,15179948u,4652u},{15179954u,15179954u,7559u},{15179956u,15179956u,7485u},{15180165u,15180165u,4000u},
+{15180175u,15180175u,5976u},{15180189u,15180189u,7226u},{15180203u,15180203u,4588u},{15180204u,15180204u,3687u},
+{15180207u,15180207u,5977u},{15180220u,15180220u,5178u},{15180417u,15180417u,4101u},{15180423u,15180423u,6738u},
+{15180428u,15180428u,4528u},{15180429u,15180429u,5847u},{15180430u,15180430u,5563u},{15180433u,15180433u,5204u},
+{15180439u,15180439u,6116u},{15180451u,15180451u,3504u},{15180455u,15180455u,5027u},{15180457u,15180457u,5414u},
+{15180474u,15180475u,7879u},{15180476u,15180476u,4659u},{15180673u,15180673u,6499u},{15180677u,15180677u,4956u},
+{15180682u,15180682u,4546u},{15180683u,15180683u,7050u},{15180686u,15180686u,3719u},{15180688u,15180688u,4921u},
+{15180712u,15180712u,4660u},{15180716u,15180716u,3688u},{15180719u,15180719u,4102u},{15180725u,15180725u,3491u},
+{15180731u,15180731u,4922u},{15180929u,15180929u,7227u},{15180942u,15180942u,7228u},{15180950u,15180950u,5940u},
+{15180970u,15180970u,4450u},{15180971u,15180971u,4462u},{15180972u,15180972u,4923u},{15180986u,15180986u,5710u},
+{15180990u,15180990u,5278u},{15181184u,15181184u,5279u},{15181185u,15181185u,4103u},{15181191u,15181192u,4104u},
+{15181193u,15181193u,6962u},{15181200u,15181200u,6214u},{15181206u,15181206u,6806u},{15181207u,15181207u,6963u},
+{15181210u,15181210u,6807u},{15181211u,15181211u,3595u},{15181212u,15181212u,7826u},{15181213u,15181213u,7290u},
+{15181214u,15181214u,5746u},{15181216u,15181216u,5280u},{15181221u,15181221u,5353u},{15181224u,15181224u,7584u},
+{15181229u,15181229u,6769u},{15181242u,15181242u,4106u},{15181247u,15181247u,4529u},{15181441u,15181441u,4044u},
+{15181453u,15181453u,7869u},{15181454u,15181454u,6739u},{15181455u,15181455u,5081u},{15181457u,15181457u,6215u},
+{15181478u,15181478u,5907u},{15181479u,15181479u,8052u},{15181482u,15181482u,5434u},{15181486u,15181486u,4508u},
+{15181489u,15181489u,4295u},{15181491u,15181491u,5894u},{15181497u,15181497u,6216u},{15181501u,15181501u,4045u},
+{15181502u,15181502u,7870u},{15181503u,15181503u,4315u},{15181696u,15181696u,5597u},{15181697u,15181697u,5281u},
+{15181705u,15181705u,5053u},{15181706u,15181706u,4162u},{15181707u,15181707u,7273u},{15181713u,15181713u,3807u},
+{15181714u,15181714u,7229u},{15181717u,15181717u,5205u},{15181720u,15181720u,5206u},{15181727u,15181727u,6808u},
+{15181732u,15181732u,7377u},{15181734u,15181734u,7000u},{15181735u,15181735u,5838u},{15181737u,15181737u,7023u},
+{15181755u,15181755u,6426u},{15181952u,15181952u,8053u},{15181957u,15181957u,5496u},{15181960u,15181960u,3492u},
+{15181963u,15181963u,6740u},{15181965u,15181965u,7230u},{15181972u,15181972u,6474u},{15181975u,15181975u,7510u},
+{15181977u,15181977u,6976u},{15181978u,15181978u,7349u},{15181980u,15181980u,4609u},{15181983u,15181983u,7591u},
+{15181984u,15181984u,6809u},{15181998u,15181998u,6845u},{15182001u,15182001u,7378u},{15182006u,15182006u,6235u},
+{15182007u,15182007u,6977u},{15182011u,15182011u,4296u},{15182012u,15182012u,3454u},{15182013u,15182013u,3720u},
+{15182015u,15182015u,3749u},{15182208u,15182208u,3771u},{15182214u,15182214u,4793u},{15182217u,15182217u,7350u},
+{15182221u,15182221u,6628u},{15182222u,15182222u,6022u},{15182231u,15182231u,5598u},{15182241u,15182241u,5366u},
+{15182242u,15182242u,6038u},{15182249u,15182249u,6086u},{15182251u,15182251u,7881u},{15182256u,15182256u,5895u},
+{15182260u,15182260u,7755u},{15182262u,15182262u,3927u},{15182265u,15182265u,3965u},{15182266u,15182266u,3798u},
+{15182269u,15182269u,6741u},{15182271u,15182271u,7157u},{15182465u,15182465u,4330u},{15182468u,15182468u,7058u},
+{15182472u,15182472u,6156u},{15182482u,15182482u,7024u},{15182483u,15182483u,7109u},{15182485u,15182485u,6810u},
+{15182488u,15182488u,3954u},{15182495u,15182495u,3962u},{15182505u,15182506u,6101u},{15182510u,15182510u,3966u},
+{15182511u,15182511u,6157u},{15182522u,15182522u,4001u},{15182724u,15182724u,7067u},{15182725u,15182725u,4002u},
+{15182727u,15182727u,4353u},{15182730u,15182730u,6689u},{15182731u,15182731u,4653u},{15182743u,15182743u,4809u},
+{15182745u,15182745u,7089u},{15182749u,15182749u,5054u},{15182751u,15182751u,3689u},{15182752u,15182752u,6555u},
+{15182755u,15182755u,6915u},{15182757u,15182757u,4344u},{15182762u,15182762u,5599u},{15182765u,15182765u,3505u},
+{15182767u,15182767u,4205u},{15182774u,15182774u,3690u},{15182777u,15182777u,6900u},{15182778u,15182778u,7291u},
+{15182783u,15182783u,3493u},{15182991u,15182991u,7852u},{15182993u,15182993u,5522u},{15183001u,15183001u,5372u},
+{15183003u,15183003u,6629u},{15183006u,15183006u,7439u},{15183008u,15183008u,4654u},{15183014u,15183014u,5130u},
+{15183020u,15183020u,6770u},{15183021u,15183021u,4496u},{15183033u,15183033u,5497u},{15183238u,15183238u,7611u},
+{15183241u,15183241u,4369u},{15183243u,15183243u,4031u},{15183244u,15183244u,6668u},{15183245u,15183245u,5654u},
+{15183247u,15183247u,5006u},{15183248u,15183248u,3849u},{15183249u,15183249u,7292u},{15183250u,15183250u,7456u},
+{15183252u,15183252u,4236u},{15183254u,15183254u,7128u},{15183264u,15183264u,4012u},{15183276u,15183276u,5486u},
+{15183278u,15183278u,5390u},{15183285u,15183285u,5978u},{15183293u,15183293u,6073u},{15183495u,15183495u,3574u},
+{15183499u,15183499u,6669u},{15183503u,15183503u,6588u},{15183508u,15183508u,4896u},{15183509u,15183509u,4107u},
+{15183511u,15183511u,5311u},{15183514u,15183514u,7051u},{15183517u,15183517u,3656u},{15183521u,15183521u,3828u},
+{15183533u,15183533u,6670u},{15183537u,15183537u,5354u},{15183540u,15183540u,6530u},{15183544u,15183544u,6606u},
+{15183744u,15183744u,6690u},{15183745u,15183745u,7921u},{15183748u,15183748u,5016u},{15183750u,15183750u,6671u},
+{15183751u,15183751u,7522u},{15183753u,15183753u,7293u},{15183762u,15183762u,5729u},{15183776u,15183776u,5523u},
+{15183780u,15183780u,4316u},{15183785u,15183785u,5282u},{15184007u,15184007u,6829u},{15184018u,15184018u,7068u},
+{15184030u,15184030u,4206u},{15184033u,15184033u,3494u},{15184039u,15184039u,7922u},{15184042u,15184042u,6531u},
+{15184043u,15184043u,5524u},{15184061u,15184061u,7183u},{15184062u,15184062u,4487u},{15184063u,15184063u,5131u},
+{15184259u,15184259u,4404u},{15184268u,15184268u,6884u},{15184269u,15184269u,6630u},{15184288u,15184288u,4541u},
+{15184292u,15184292u,7184u},{15184300u,15184300u,4628u},{15184307u,15184307u,4863u},{15184515u,15184515u,5207u},
+{15184521u,15184521u,5165u},{15184530u,15184530u,4655u},{15184533u,15184533u,4897u},{15184535u,15184535u,6811u},
+{15184536u,15184536u,6697u},{15184543u,15184543u,5541u},{15184549u,15184549u,6901u},{15184551u,15184551u,6556u},
+{15184558u,15184558u,4433u},{15184561u,15184561u,4434u},{15184562u,15184562u,7070u},{15184563u,15184563u,3582u},
+{15184569u,15184569u,5600u},{15184574u,15184574u,6742u},{15184778u,15184778u,7827u},{15184790u,15184790u,4247u},
+{15184798u,15184798u,5166u},{15184799u,15184799u,6812u},{15184800u,15184800u,3548u},{15184807u,15184807u,4435u},
+{15184827u,15184827u,3721u},{15184830u,15184830u,4003u},{15185024u,15185024u,4108u},{15185026u,15185026u,6885u},
+{15185028u,15185028u,5873u},{15185029u,15185029u,7859u},{15185030u,15185030u,6217u},{15185031u,15185031u,8025u},
+{15185032u,15185032u,7895u},{15185034u,15185035u,4842u},{15185037u,15185037u,4150u},{15185040u,15185040u,4184u},
+{15185044u,15185044u,5655u},{15185047u,15185047u,5283u},{15185048u,15185048u,3865u},{15185049u,15185049u,6964u},
+{15185050u,15185050u,4056u},{15185051u,15185051u,5167u},{15185056u,15185056u,5525u},{15185057u,15185057u,4957u},
+{15185058u,15185058u,5367u},{15185067u,15185067u,6500u},{15185068u,15185068u,6886u},{15185070u,15185070u,7081u},
+{15185071u,15185071u,4571u},{15185072u,15185072u,5498u},{15185075u,15185075u,5747u},{15185077u,15185077u,6607u},
+{15185081u,15185081u,5526u},{15185082u,15185082u,3525u},{15185282u,15185282u,6846u},{15185283u,15185283u,7746u},
+{15185284u,15185284u,6813u},{15185285u,15185285u,3691u},{15185286u,15185286u,4924u},{15185296u,15185296u,3651u},
+{15185310u,15185310u,3882u},{15185313u,15185313u,4385u},{15185314u,15185314u,7747u},{15185318u,15185318u,4057u},
+{15185320u,15185320u,6371u},{15185322u,15185322u,6454u},{15185326u,15185326u,5391u},{15185329u,15185329u,7457u},
+{15185330u,15185330u,5284u},{15185331u,15185331u,3549u},{15185334u,15185334u,6691u},{15185337u,15185337u,3641u},
+{15185343u,15185343u,3928u},{15185550u,15185550u,6743u},{15185551u,15185551u,5601u},{15185555u,15185555u,3692u},
+{15185564u,15185564u,6847u},{15185568u,15185568u,4530u},{15185570u,15185570u,6887u},{15185580u,15185580u,5602u},
+{15185581u,15185581u,6340u},{15185585u,15185585u,3550u},{15185586u,15185586u,4701u},{15185588u,15185588u,7173u},
+{15185589u,15185589u,7121u},{15185592u,15185592u,4598u},{15185594u,15185594u,4109u},{15185595u,15185595u,7416u},
+{15185597u,15185597u,6517u},{15185598u,15185598u,4610u},{15185599u,15185599u,4742u},{15185799u,15185799u,7351u},
+{15185802u,15185802u,4126u},{15185803u,15185803u,5208u},{15185814u,15185814u,5392u},{15185816u,15185816u,7658u},
+{15185818u,15185818u,5435u},{15185821u,15185821u,7034u},{15185822u,15185822u,4207u},{15185824u,15185824u,7209u},
+{15185825u,15185825u,4881u},{15185827u,15185827u,5979u},{15185832u,15185832u,7523u},{15185833u,15185833u,6117u},
+{15185836u,15185836u,4743u},{15185839u,15185839u,6297u},{15185844u,15185844u,4471u},{15185851u,15185851u,7352u},
+{15186057u,15186057u,7001u},{15186058u,15186058u,5855u},{15186069u,15186069u,6087u},{15186075u,15186075u,4898u},
+{15186077u,15186077u,7002u},{15186078u,15186078u,7828u},{15186079u,15186079u,6171u},{15186081u,15186081u,6581u},
+{15186083u,15186083u,7748u},{15186091u,15186091u,5103u},{15186094u,15186094u,7294u},{15186095u,15186095u,5980u},
+{15186097u,15186097u,6848u},{15186103u,15186103u,4572u},{15186109u,15186109u,7257u},{15186110u,15186110u,6631u},
+{15186305u,15186305u,5001u},{15186307u,15186307u,5179u},{15186310u,15186310u,4826u},{15186311u,15186311u,6158u},
+{15186322u,15186322u,6938u},{15186324u,15186324u,6978u},{15186325u,15186325u,5436u},{15186334u,15186334u,6159u},
+{15186337u,15186337u,5603u},{15186345u,15186345u,5689u},{15186346u,15186346u,7942u},{15186347u,15186347u,3722u},
+{15186349u,15186349u,3642u},{15186352u,15186352u,6814u},{15186361u,15186361u,5952u},{15186364u,15186364u,3723u},
+{15186562u,15186562u,7069u},{15186572u,15186572u,5542u},{15186575u,15186575u,6672u},{15186579u,15186579u,6023u},
+{15186582u,15186582u,5466u},{15186584u,15186584u,7071u},{15186587u,15186587u,4317u},{15186588u,15186588u,4405u},
+{15187126u,15187126u,5132u},{15187128u,15187128u,7681u},{15187130u,15187130u,3652u},{15187340u,15187340u,5859u},
+{15187344u,15187344u,3829u},{15187348u,15187348u,4702u},{15187349u,15187349u,7643u},{15187370u,15187370u,6859u},
+{15187371u,15187371u,3854u},{15187374u,15187374u,7353u},{15187376u,15187376u,5007u},{15187378u,15187378u,5393u},
+{15187381u,15187381u,4717u},{15187383u,15187383u,7486u},{15187385u,15187385u,4629u},{15187589u,15187589u,4377u},
+{15187592u,15187592u,4110u},{15187594u,15187594u,5896u},{15187596u,15187596u,3551u},{15187598u,15187598u,4864u},
+{15187604u,15187604u,3750u},{15187610u,15187610u,4497u},{15187614u,15187614u,5604u},{15187620u,15187620u,3955u},
+{15187624u,15187624u,5437u},{15187625u,15187625u,6405u},{15187634u,15187634u,8054u},{15187640u,15187640u,4630u},
+{15187641u,15187641u,3583u},{15187645u,15187645u,6218u},{15187841u,15187841u,6095u},{15187845u,15187845u,5711u},
+{15187850u,15187850u,6439u},{15187852u,15187852u,6440u},{15187854u,15187854u,4498u},{15187858u,15187858u,5679u},
+{15187860u,15187860u,5355u},{15187861u,15187861u,8033u},{15187871u,15187871u,6632u},{15187872u,15187872u,7322u},
+{15187873u,15187873u,5209u},{15187881u,15187881u,7524u},{15187883u,15187883u,6118u},{15187888u,15187888u,7644u},
+{15187897u,15187897u,3883u},{15187900u,15187900u,6441u},{15237248u,15237248u,6160u},{15237249u,15237249u,4519u},
+{15237251u,15237251u,3751u},{15237253u,15237253u,6501u},{15237254u,15237254u,4111u},{15237257u,15237257u,3929u},
+{15237260u,15237260u,6427u},{15237264u,15237264u,4158u},{15237269u,15237269u,3693u},{15237271u,15237271u,4782u},
+{15237272u,15237272u,6243u},{15237293u,15237293u,4112u},{15237299u,15237299u,6428u},{15237302u,15237302u,5870u},
+{15237309u,15237309u,7422u},{15237311u,15237311u,3694u},{15237507u,15237507u,4227u},{15237510u,15237510u,4499u},
+{15237514u,15237514u,4559u},{15237526u,15237526u,5487u},{15237528u,15237528u,5239u},{15237530u,15237530u,7323u},
+{15237534u,15237534u,4844u},{15237551u,15237551u,4472u},{15237552u,15237552u,7258u},{15237554u,15237554u,5488u},
+{15237555u,15237555u,6191u},{15237559u,15237559u,6979u},{15237565u,15237565u,7200u},{15237566u,15237566u,4542u},
+{15237567u,15237567u,6368u},{15237764u,15237764u,6429u},{15237765u,15237765u,5638u},{15237766u,15237766u,5285u},
+{15237767u,15237767u,6815u},{15237769u,15237769u,6357u},{15237771u,15237771u,4605u},{15237772u,15237772u,4113u},
+{15237782u,15237782u,7231u},{15237787u,15237787u,7682u},{15237789u,15237789u,3495u},{15237793u,15237793u,3752u},
+{15237794u,15237794u,6965u},{15237797u,15237797u,5210u},{15237801u,15237801u,3643u},{15237802u,15237802u,4958u},
+{15237807u,15237807u,4061u},{15237809u,15237809u,3866u},{15237810u,15237810u,6358u},{15237812u,15237812u,7963u},
+{15237818u,15237818u,7540u},{15238019u,15238019u,6298u},{15238020u,15238020u,6865u},{15238028u,15238028u,4979u},
+{15238030u,15238030u,7440u},{15238042u,15238042u,4980u},{15238043u,15238043u,3533u},{15238046u,15238046u,7560u},
+{15238049u,15238049u,7829u},{15238052u,15238052u,6364u},{15238053u,15238053u,5394u},{15238065u,15238065u,3850u},
+{15238068u,15238068u,4345u},{15238072u,15238072u,8017u},{15238077u,15238077u,4185u},{15238274u,15238274u,6966u},
+{15238277u,15238277u,7766u},{15238278u,15238278u,7324u},{15238279u,15238279u,7767u},{15238280u,15238280u,4722u},
+{15238282u,15238282u,7144u},{15238296u,15238296u,6119u},{15238298u,15238298u,3472u},{15238299u,15238299u,3695u},
+{15238307u,15238307u,5656u},{15238313u,15238313u,5605u},{15238315u,15238315u,7419u},{15238319u,15238319u,7561u},
+{15238329u,15238329u,7110u},{15238334u,15238334u,5211u},{15238539u,15238539u,5856u},{15238542u,15238542u,5748u},
+{15238544u,15238545u,5133u},{15238548u,15238548u,3552u},{15238549u,15238549u,6120u},{15238565u,15238565u,5489u},
+{15238566u,15238566u,4179u},{15238571u,15238571u,6849u},{15238576u,15238576u,6161u},{15238577u,15238577u,3608u},
+{15238584u,15238584u,6557u},{15238585u,15238585u,5082u},{15238586u,15238586u,5438u},{15238591u,15238591u,7461u},
+{15238784u,15238784u,4959u},{15238792u,15238792u,3634u},{15238794u,15238794u,4899u},{15238799u,15238799u,3753u},
+{15238810u,15238810u,5135u},{15238812u,15238812u,4667u},{15238813u,15238813u,5675u},{15238816u,15238816u,3884u},
+{15238819u,15238819u,7025u},{15238824u,15238824u,7516u},{15238835u,15238835u,5439u},{15238837u,15238837u,7313u},
+{15238842u,15238842u,6392u},{15238845u,15238845u,4228u},{15238846u,15238846u,7943u},{15238847u,15238847u,4176u},
+{15239040u,15239040u,4359u},{15239042u,15239042u,5212u},{15239046u,15239046u,5916u},{15239053u,15239053u,6771u},
+{15239064u,15239064u,4410u},{15239071u,15239071u,6558u},{15239075u,15239075u,5749u},{15239077u,15239077u,6103u},
+{15239079u,15239079u,6559u},{15239080u,15239080u,4650u},{15239082u,15239082u,6502u},{15239085u,15239085u,7325u},
+{15239091u,15239091u,6967u},{15239092u,15239092u,7354u},{15239098u,15239098u,4261u},{15239099u,15239099u,7003u},
+{15239100u,15239100u,3930u},{15239102u,15239102u,6341u},{15239301u,15239301u,3931u},{15239303u,15239303u,5941u},
+{15239304u,15239304u,8034u},{15239306u,15239306u,3932u},{15239308u,15239308u,5456u},{15239309u,15239309u,5286u},
+{15239314u,15239314u,5395u},{15239323u,15239323u,7158u},{15239324u,15239324u,5657u},{15239326u,15239326u,4827u},
+{15239327u,15239327u,6888u},{15239329u,15239329u,3553u},{15239338u,15239338u,7683u},{15239339u,15239339u,4960u},
+{15239340u,15239340u,4925u},{15239349u,15239349u,7390u},{15239350u,15239350u,4900u},{15239351u,15239351u,7749u},
+{15239353u,15239353u,5440u},{15239552u,15239552u,5136u},{15239557u,15239557u,5942u},{15239559u,15239559u,6744u},
+{15239577u,15239577u,7111u},{15239588u,15239588u,6406u},{15239590u,15239590u,7659u},{15239598u,15239598u,3496u},
+{15239599u,15239599u,4436u},{15239601u,15239601u,3497u},{15239602u,15239602u,5368u},{15239606u,15239606u,5994u},
+{15239608u,15239608u,7232u},{15239614u,15239614u,5848u},{15239819u,15239819u,6219u},{15239821u,15239821u,6518u},
+{15239822u,15239822u,3967u},{15239826u,15239826u,4703u},{15239833u,15239833u,5137u},{15239834u,15239834u,4360u},
+{15239837u,15239837u,6968u},{15239839u,15239839u,5324u},{15239845u,15239845u,3575u},{15239846u,15239846u,7830u},
+{15239849u,15239849u,4046u},{15239852u,15239852u,5168u},{15239853u,15239853u,7487u},{15239854u,15239854u,6039u},
+{15239855u,15239855u,5769u},{15239857u,15239857u,7871u},{15239859u,15239859u,4961u},{15239863u,15239863u,6969u},
+{15239864u,15239864u,6244u},{15239865u,15239865u,4032u},{15239867u,15239867u,7274u},{15239868u,15239868u,4783u},
+{15239869u,15239869u,5783u},{15239871u,15239871u,6482u},{15240081u,15240081u,6274u},{15240082u,15240082u,5995u},
+{15240084u,15240084u,7441u},{15240085u,15240085u,7233u},{15240087u,15240087u,4810u},{15240091u,15240091u,3455u},
+{15240094u,15240094u,7562u},{15240095u,15240095u,3933u},{15240097u,15240097u,6430u},{15240101u,15240101u,5874u},
+{15240102u,15240102u,3754u},{15240103u,15240103u,6608u},{15240113u,15240113u,6024u},{15240125u,15240125u,3755u},
+{15240126u,15240126u,7612u},{15240321u,15240321u,6921u},{15240322u,15240322u,4828u},{15240323u,15240323u,5017u},
+{15240324u,15240324u,3456u},{15240325u,15240325u,4784u},{15240329u,15240329u,4693u},{15240343u,15240343u,4757u},
+{15240360u,15240360u,6503u},{15240363u,15240363u,4704u},{15240367u,15240367u,5083u},{15240369u,15240369u,5606u},
+{15240372u,15240372u,7944u},{15240373u,15240373u,6455u},{15240374u,15240374u,4191u},{15240376u,15240376u,6192u},
+{15240377u,15240377u,5943u},{15240576u,15240576u,5658u},{15240583u,15240583u,7708u},{15240585u,15240585u,7234u},
+{15240586u,15240586u,7784u},{15240591u,15240591u,6475u},{15240593u,15240593u,6431u},{15240594u,15240594u,7923u},
+{15240627u,15240627u,4354u},{15240631u,15240631u,7624u},{15240635u,15240635u,6633u},{15240841u,15240841u,4631u},
+{15240842u,15240842u,6560u},{15240846u,15240846u,5287u},{15240854u,15240854u,3696u},{15240856u,15240856u,5750u},
+{15240862u,15240862u,6121u},{15240866u,15240866u,7768u},{15240873u,15240873u,5138u},{15240874u,15240874u,5784u},
+{15240875u,15240875u,4668u},{15240893u,15240893u,4705u},{15241089u,15241089u,7201u},{15241093u,15241093u,3830u},
+{15241097u,15241097u,4531u},{15241098u,15241098u,3949u},{15241100u,15241100u,4013u},{15241107u,15241107u,3808u},
+{15241110u,15241110u,7112u},{15241116u,15241116u,7122u},{15241129u,15241129u,5069u},{15241131u,15241131u,4033u},
+{15241135u,15241135u,7872u},{15241136u,15241136u,3756u},{15241137u,15241137u,4611u},{15241138u,15241138u,5213u},
+{15241140u,15241140u,5827u},{15241145u,15241145u,6609u},{15241149u,15241149u,5639u},{15241347u,15241347u,7314u},
+{15241348u,15241348u,4297u},{15241354u,15241354u,4423u},{15241356u,15241356u,4732u},{15241357u,15241357u,7532u},
+{15241358u,15241358u,6299u},{15241385u,15241385u,7275u},{15241388u,15241388u,4683u},{15241393u,15241393u,7993u},
+{15241400u,15241400u,6342u},{15241405u,15241405u,4386u},{15241609u,15241609u,6001u},{15241623u,15241623u,6610u},
+{15241627u,15241627u,3506u},{15241633u,15241633u,7563u},{15241635u,15241635u,4346u},{15241638u,15241638u,6300u},
+{15241643u,15241643u,7831u},{15241644u,15241644u,6561u},{15241647u,15241647u,5875u},{15241653u,15241653u,4004u},
+{15241658u,15241658u,6930u},{15241872u,15241872u,5607u},{15241876u,15241876u,5712u},{15241881u,15241881u,4799u},
+{15241884u,15241884u,5312u},{15241889u,15241889u,4962u},{15241906u,15241906u,7564u},{15241912u,15241912u,6939u},
+{15241915u,15241915u,5876u},{15241916u,15241916u,7113u},{15241919u,15241919u,7832u},{15242112u,15242112u,5549u},
+{15242114u,15242114u,4758u},{15242116u,15242116u,7295u},{15242118u,15242118u,5415u},{15242121u,15242121u,6193u},
+{15242123u,15242123u,3576u},{15242125u,15242125u,5713u},{15242129u,15242129u,5288u},{15242138u,15242138u,5608u},
+{15242156u,15242156u,5104u},{15242158u,15242158u,4473u},{15242164u,15242164u,5659u},{15242172u,15242172u,4560u},
+{15242385u,15242385u,4747u},{15242387u,15242387u,4684u},{15242388u,15242388u,5084u},{15242391u,15242391u,6504u},
+{15242392u,15242392u,5325u},{15242394u,15242394u,6250u},{15242398u,15242398u,4573u},{15242401u,15242401u,7123u},
+{15242403u,15242403u,6562u},{15242405u,15242405u,7259u},{15242412u,15242412u,5527u},{15242413u,15242413u,6383u},
+{15242415u,15242415u,7004u},{15242429u,15242429u,7541u},{15242431u,15242431u,6301u},{15242625u,15242625u,4229u},
+{15242627u,15242627u,5002u},{15242633u,15242633u,7235u},{15242638u,15242638u,3885u},{15242643u,15242643u,6245u},
+{15242649u,15242649u,7796u},{15242659u,15242659u,5660u},{15242664u,15242664u,3981u},{15242665u,15242665u,7430u},
+{15242666u,15242666u,4829u},{15242669u,15242669u,5528u},{15242884u,15242884u,4901u},{15242887u,15242887u,4865u},
+{15242895u,15242895u,6407u},{15242897u,15242897u,3554u},{15242900u,15242900u,6563u},{15242907u,15242907u,5457u},
+{15242918u,15242918u,7159u},{15242920u,15242920u,7989u},{15242921u,15242921u,5319u},{15242922u,15242922u,5751u},
+{15242927u,15242927u,5396u},{15242928u,15242928u,7986u},{15242938u,15242938u,6772u},{15243137u,15243137u,3757u},
+{15243145u,15243145u,6505u},{15243149u,15243149u,4406u},{15243150u,15243150u,5752u},{15243151u,15243151u,6564u},
+{15243157u,15243157u,6220u},{15243164u,15243164u,4451u},{15243165u,15243165u,6040u},{15243172u,15243172u,4370u},
+{15243173u,15243173u,5877u},{15243177u,15243177u,5003u},{15243178u,15243178u,5609u},{15243191u,15243191u,6611u},
+{15243194u,15243194u,4642u},{15243195u,15243195u,6816u},{15243199u,15243199u,3817u},{15243394u,15243394u,6041u},
+{15243398u,15243398u,4520u},{15243399u,15243399u,5529u},{15243402u,15243402u,6088u},{15243414u,15243414u,5924u},
+{15243415u,15243415u,5028u},{15243418u,15243418u,5441u},{15243437u,15243437u,4395u},{15243455u,15243455u,4378u},
+{15243662u,15243662u,7833u},{15243664u,15243664u,7632u},{15243668u,15243668u,3609u},{15243669u,15243669u,7133u},
+{15243675u,15243675u,7721u},{15243676u,15243676u,4521u},{15243678u,15243678u,6221u},{15243679u,15243679u,7834u},
+{15243687u,15243687u,8009u},{15243705u,15243705u,7860u},{15243914u,15243914u,4845u},{15243916u,15243916u,4963u},
+{15243923u,15243923u,6456u},{15243939u,15243939u,3799u},{15243940u,15243940u,6817u},{15243945u,15243945u,7355u},
+{15244167u,15244167u,5289u},{15244171u,15244171u,4208u},{15244180u,15244180u,7945u},{15244185u,15244185u,6104u},
+{15244187u,15244187u,6889u},{15244191u,15244191u,3886u},{15244196u,15244196u,7666u},{15244205u,15244205u,7026u},
+{15244222u,15244222u,5785u},{15244416u,15244416u,7245u},{15244418u,15244418u,5105u},{15244419u,15244419u,5753u},
+{15244424u,15244424u,6074u},{15244440u,15244440u,6970u},{15244442u,15244442u,5214u},{15244444u,15244444u,4884u},
+{15244686u,15244686u,3508u},{15244693u,15244693u,5730u},{15244695u,15244695u,7924u},{15244703u,15244703u,6302u},
+{15244710u,15244710u,7625u},{15244712u,15244712u,5676u},{15244724u,15244724u,7835u},{15244726u,15244726u,6703u},
+{15244728u,15244728u,6105u},{15244930u,15244930u,4418u},{15244941u,15244941u,6372u},{15244959u,15244959u,4759u},
+{15244962u,15244962u,7785u},{15244979u,15244979u,4248u},{15244986u,15244986u,4379u},{15245188u,15245188u,7376u},
+{15245216u,15245216u,4926u},{15245228u,15245228u,5442u},{15245231u,15245231u,6162u},{15245234u,15245234u,7309u},
+{15245241u,15245241u,7696u},{15245243u,15245243u,6408u},{15245246u,15245246u,5467u},{15245445u,15245445u,5690u},
+{15245471u,15245471u,4411u},{15245474u,15245474u,6916u},{15245475u,15245475u,4452u},{15245489u,15245489u,3758u},
+{15245494u,15245494u,6532u},{15245499u,15245499u,4685u},{15245696u,15245696u,7756u},{15245702u,15245702u,6924u},
+{15245708u,15245708u,7709u},{15245709u,15245709u,5981u},{15245714u,15245714u,7750u},{15245715u,15245715u,5668u},
+{15245719u,15245719u,3457u},{15245721u,15245721u,5786u},{15245723u,15245723u,6303u},{15245725u,15245725u,7310u},
+{15245729u,15245729u,7786u},{15245730u,15245730u,3934u},{15245731u,15245731u,6409u},{15245736u,15245736u,7585u},
+{15245739u,15245739u,5326u},{15245744u,15245744u,5565u},{15245746u,15245746u,4151u},{15245751u,15245751u,7311u},
+{15245758u,15245759u,4047u},{15245953u,15245953u,6275u},{15245954u,15245954u,4763u},{15245960u,15245960u,3458u},
+{15245963u,15245963u,4262u},{15245965u,15245965u,7565u},{15245970u,15245970u,4209u},{15245974u,15245974u,5610u},
+{15245975u,15245975u,7005u},{15245982u,15245982u,3782u},{15245995u,15245995u,7601u},{15246004u,15246004u,3759u},
+{15246209u,15246209u,6582u},{15246210u,15246210u,4482u},{15246223u,15246223u,4632u},{15246228u,15246228u,6042u},
+{15246229u,15246229u,6343u},{15246233u,15246233u,3956u},{15246236u,15246236u,5070u},{15246237u,15246237u,6565u},
+{15246239u,15246239u,5290u},{15246241u,15246241u,4633u},{15246248u,15246248u,5215u},{15246259u,15246259u,5356u},
+{15246260u,15246261u,4981u},{15246264u,15246264u,4380u},{15246269u,15246269u,6773u},{15246471u,15246471u,5085u},
+{15246480u,15246480u,3507u},{15246482u,15246482u,7566u},{15246483u,15246483u,5071u},{15246488u,15246488u,6304u},
+{15246489u,15246489u,4983u},{15246501u,15246501u,6172u},{15246506u,15246506u,7462u},{15246518u,15246518u,5680u},
+{15246520u,15246520u,4574u},{15246523u,15246523u,5458u},{15246721u,15246721u,3555u},{15246724u,15246724u,5897u},
+{15246751u,15246751u,4049u},{15246756u,15246756u,4407u},{15246762u,15246762u,4694u},{15246770u,15246770u,5681u},
+{15246783u,15246783u,5397u},{15246977u,15246977u,6163u},{15246979u,15246979u,4230u},{15246982u,15246982u,5086u},
+{15246983u,15246983u,7511u},{15246987u,15246987u,3644u},{15246991u,15246991u,4005u},{15246995u,15246995u,4734u},
+{15246998u,15246998u,5714u},{15247009u,15247009u,3635u},{15247017u,15247017u,4298u},{15247018u,15247018u,7363u},
+{15247026u,15247026u,4034u},{15247034u,15247034u,3473u},{15247037u,15247037u,4408u},{15247232u,15247232u,3831u},
+{15247250u,15247250u,3474u},{15247267u,15247267u,7697u},{15247284u,15247284u,5357u},{15247288u,15247288u,7246u},
+{15247488u,15247488u,5921u},{15247490u,15247490u,6745u},{15247491u,15247491u,5139u},{15247496u,15247496u,3724u},
+{15247498u,15247498u,5754u},{15247500u,15247500u,7861u},{15247502u,15247502u,7452u},{15247507u,15247507u,7987u},
+{15247510u,15247510u,8026u},{15247511u,15247511u,7406u},{15247512u,15247512u,4114u},{15247515u,15247515u,6106u},
+{15247517u,15247517u,5787u},{15247519u,15247519u,5557u},{15247523u,15247523u,3653u},{15247525u,15247525u,4182u},
+{15247530u,15247530u,4964u},{15247533u,15247533u,5459u},{15247537u,15247537u,7722u},{15247540u,15247540u,5530u},
+{15247542u,15247542u,3459u},{15247546u,15247546u,7006u},{15247547u,15247547u,6890u},{15247760u,15247760u,5291u},
+{15247764u,15247764u,6818u},{15247765u,15247765u,7533u},{15247771u,15247771u,6612u},{15247774u,15247774u,5292u},
+{15247776u,15247776u,6025u},{15247778u,15247778u,5661u},{15247779u,15247779u,6043u},{15247782u,15247782u,5715u},
+{15247785u,15247785u,5716u},{15247789u,15247789u,3987u},{15247790u,15247790u,6673u},{15247792u,15247792u,8055u},
+{15247793u,15247793u,7873u},{15247794u,15247794u,7698u},{15247795u,15247795u,5358u},{15247797u,15247797u,5443u},
+{15247801u,15247801u,7185u},{15248005u,15248005u,6891u},{15248007u,15248007u,3809u},{15248012u,15248012u,6971u},
+{15248013u,15248013u,6457u},{15248019u,15248019u,5398u},{15248021u,15248021u,7417u},{15248024u,15248024u,6344u},
+{15248030u,15248030u,5908u},{15248032u,15248032u,5490u},{15248033u,15248033u,3725u},{15248035u,15248035u,4830u},
+{15248036u,15248036u,6075u},{15248037u,15248037u,3760u},{15248038u,15248038u,5558u},{15248040u,15248040u,7946u},
+{15248042u,15248042u,5460u},{15248048u,15248048u,5611u},{15248050u,15248050u,3810u},{15248057u,15248057u,5216u},
+{15248060u,15248060u,6410u},{15248062u,15248062u,6377u},{15248063u,15248063u,6819u},{15248258u,15248258u,7186u},
+{15248260u,15248260u,5662u},{15248263u,15248263u,4231u},{15248267u,15248267u,7202u},{15248269u,15248269u,6589u},
+{15248271u,15248271u,7276u},{15248274u,15248274u,4437u},{15248278u,15248278u,4535u},{15248283u,15248283u,6345u},
+{15248284u,15248284u,7194u},{15248289u,15248289u,5717u},{15248294u,15248294u,7210u},{15248295u,15248295u,7699u},
+{15248298u,15248298u,6746u},{15248299u,15248299u,3498u},{15248301u,15248301u,6346u},{15248302u,15248302u,6506u},
+{15248305u,15248305u,8002u},{15248310u,15248310u,5770u},{15248311u,15248311u,7593u},{15248312u,15248312u,6774u},
+{15248314u,15248314u,5922u},{15248318u,15248318u,4139u},{15248512u,15248512u,4785u},{15248513u,15248513u,5818u},
+{15248514u,15248514u,6305u},{15248516u,15248516u,4371u},{15248526u,15248526u,4866u},{15248528u,15248528u,4885u},
+{15248532u,15248532u,7633u},{15248534u,15248534u,5543u},{15248535u,15248535u,4965u},{15248537u,15248537u,3657u},
+{15248538u,15248538u,6442u},{15248539u,15248539u,3556u},{15248541u,15248541u,5293u},{15248544u,15248544u,6164u},
+{15248552u,15248552u,4786u},{15248555u,15248555u,6634u},{15248556u,15248556u,4589u},{15248563u,15248563u,3935u},
+{15248569u,15248569u,4035u},{15248769u,15248769u,7874u},{15248777u,15248777u,6940u},{15248782u,15248782u,8011u},
+{15248783u,15248783u,4115u},{15248792u,15248792u,5731u},{15248794u,15248794u,4232u},{15248796u,15248796u,5072u},
+{15248806u,15248806u,3697u},{15248812u,15248812u,5217u},{15248815u,15248815u,5953u},{15248816u,15248816u,6411u},
+{15248820u,15248820u,3645u},{15248823u,15248823u,7836u},{15248829u,15248829u,6044u},{15249024u,15249024u,4318u},
+{15249034u,15249034u,5033u},{15249040u,15249040u,5612u},{15249042u,15249042u,7090u},{15249043u,15249043u,5898u},
+{15249046u,15249046u,7091u},{15249050u,15249050u,7072u},{15249591u,15249591u,3772u},{15249599u,15249599u,3726u},
+{15249793u,15249793u,7902u},{15249798u,15249798u,4355u},{15249800u,15249800u,4116u},{15249802u,15249802u,7594u},
+{15249804u,15249804u,6122u},{15249813u,15249813u,5718u},{15249818u,15249818u,4327u},{15249825u,15249825u,5359u},
+{15249834u,15249834u,7837u},{15249835u,15249835u,6045u},{15249849u,15249849u,7586u},{15249850u,15249850u,5719u},
+{15250050u,15250050u,7236u},{15250058u,15250058u,4723u},{15250060u,15250060u,4787u},{15250077u,15250077u,7512u},
+{15250078u,15250078u,6747u},{15250080u,15250080u,5140u},{15250081u,15250081u,6583u},{15250082u,15250082u,3800u},
+{15250087u,15250087u,5234u},{15250088u,15250088u,7875u},{15250089u,15250089u,7495u},{15250090u,15250090u,7423u},
+{15250091u,15250091u,3832u},{15250092u,15250092u,7129u},{15250095u,15250095u,6613u},{15250096u,15250096u,5499u},
+{15250099u,15250099u,6433u},{15250100u,15250100u,3992u},{15250102u,15250102u,7528u},{15250103u,15250103u,4718u},
+{15250104u,15250104u,4263u},{15250107u,15250107u,5218u},{15250108u,15250108u,7195u},{15250109u,15250109u,6432u},
+{15250111u,15250111u,4831u},{15250304u,15250304u,7626u},{15250305u,15250305u,5169u},{15250306u,15250306u,4547u},
+{15250307u,15250307u,6476u},{15250308u,15250308u,7947u},{15250311u,15250311u,6507u},{15250312u,15250312u,3460u},
+{15250314u,15250314u,6635u},{15250321u,15250321u,7007u},{15250323u,15250323u,5235u},{15250330u,15250330u,4548u},
+{15250332u,15250332u,5294u},{15250334u,15250334u,5360u},{15250336u,15250336u,4984u},{15250338u,15250338u,7751u},
+{15250339u,15250339u,4719u},{15250340u,15250340u,7160u},{15250342u,15250342u,5141u},{15250346u,15250346u,7027u},
+{15250349u,15250349u,4299u},{15250356u,15250356u,4549u},{15250363u,15250363u,5142u},{15250364u,15250364u,3936u},
+{15250365u,15250365u,5364u},{15250564u,15250564u,6972u},{15250565u,15250565u,7315u},{15250567u,15250567u,6365u},
+{15250568u,15250568u,6941u},{15250570u,15250570u,7073u},{15250573u,15250573u,5468u},{15250579u,15250579u,6566u},
+{15250582u,15250582u,5544u},{15250852u,15250852u,6636u},{15250854u,15250854u,5295u},{15250859u,15250859u,7732u},
+{15250864u,15250864u,6892u},{15250867u,15250867u,4006u},{15250868u,15250868u,5143u},{15250871u,15250871u,4117u},
+{15251077u,15251077u,7237u},{15251082u,15251082u,6282u},{15251097u,15251097u,6820u},{15251107u,15251107u,7326u},
+{15251112u,15251112u,7277u},{15251123u,15251123u,6830u},{15251130u,15251130u,5144u},{15251134u,15251134u,6973u},
+{15251334u,15251334u,7442u},{15251339u,15251339u,4936u},{15251340u,15251340u,7028u},{15251343u,15251343u,3461u},
+{15251355u,15251355u,7488u},{15251357u,15251357u,3596u},{15251361u,15251361u,6637u},{15251363u,15251363u,5444u},
+{15251368u,15251368u,3811u},{15251375u,15251375u,4522u},{15251379u,15251379u,4300u},{15251594u,15251594u,6194u},
+{15251599u,15251599u,4237u},{15251600u,15251600u,7161u},{15251614u,15251614u,3597u},{15251626u,15251626u,6850u},
+{15251632u,15251632u,6347u},{15251637u,15251637u,6851u},{15251842u,15251842u,6348u},{15251844u,15251844u,6775u},
+{15251847u,15251847u,3610u},{15251848u,15251848u,4301u},{15251849u,15251849u,7052u},{15251850u,15251850u,7797u},
+{15251865u,15251865u,7296u},{15251871u,15251871u,6638u},{15251872u,15251872u,7145u},{15251892u,15251892u,7297u},
+{15251894u,15251894u,3982u},{15252097u,15252097u,6821u},{15252103u,15252103u,6614u},{15252106u,15252106u,6893u},
+{15252109u,15252109u,5878u},{15252138u,15252138u,4643u},{15252139u,15252139u,5755u},{15252140u,15252140u,3968u},
+{15252352u,15252352u,3937u},{15252362u,15252362u,7053u},{15252363u,15252363u,5819u},{15252364u,15252364u,3988u},
+{15252365u,15252365u,3957u},{15252370u,15252370u,7726u},{15252383u,15252383u,5982u},{15252395u,15252395u,7008u},
+{15252408u,15252408u,7298u},{15252411u,15252411u,3462u},{15252414u,15252414u,5732u},{15252611u,15252611u,3887u},
+{15252613u,15252613u,4523u},{15252617u,15252617u,6584u},{15252626u,15252626u,7196u},{15252627u,15252627u,4686u},
+{15252628u,15252628u,5073u},{15252629u,15252629u,3698u},{15252635u,15252635u,4438u},{15252636u,15252636u,7356u},
+{15252637u,15252637u,8003u},{15252638u,15252638u,4706u},{15252639u,15252639u,7174u},{15252646u,15252646u,4474u},
+{15252647u,15252647u,5055u},{15252649u,15252649u,4985u},{15252650u,15252650u,4599u},{15252655u,15252655u,7035u},
+{15252659u,15252659u,6894u},{15252664u,15252664u,5613u},{15252665u,15252665u,5087u},{15252667u,15252667u,5088u},
+{15252670u,15252670u,6674u},{15252671u,15252671u,5944u},{15252868u,15252868u,7650u},{15252869u,15252869u,6276u},
+{15252873u,15252873u,6675u},{15252877u,15252877u,7175u},{15252878u,15252878u,3888u},{15252893u,15252893u,5945u},
+{15252895u,15252895u,3867u},{15252898u,15252898u,4463u},{15253147u,15253147u,5756u},{15253148u,15253148u,3761u},
+{15253155u,15253155u,4398u},{15253158u,15253158u,7496u},{15253160u,15253160u,5034u},{15253165u,15253165u,5296u},
+{15253167u,15253167u,5035u},{15253168u,15253168u,7009u},{15253169u,15253169u,6173u},{15253170u,15253170u,4177u},
+{15253378u,15253378u,6222u},{15253381u,15253381u,5757u},{15253390u,15253390u,6026u},{15253393u,15253393u,4036u},
+{15253396u,15253396u,4927u},{15253414u,15253414u,3463u},{15253418u,15253418u,6639u},{15253419u,15253419u,4902u},
+{15253421u,15253421u,7029u},{15253424u,15253424u,5669u},{15253426u,15253426u,3626u},{15253431u,15253431u,4867u},
+{15253433u,15253433u,6640u},{15253437u,15253437u,7278u},{15302784u,15302784u,7463u},{15302785u,15302785u,5559u},
+{15302786u,15302786u,3838u},{15302787u,15302787u,4302u},{15302789u,15302789u,7978u},{15302790u,15302790u,5954u},
+{15302792u,15302792u,7787u},{15302795u,15302795u,7567u},{15302797u,15302797u,5531u},{15302799u,15302799u,7469u},
+{15302800u,15302800u,7299u},{15302801u,15302801u,3938u},{15302804u,15302804u,4303u},{15302805u,15302805u,3699u},
+{15302807u,15302807u,4356u},{15302809u,15302809u,6615u},{15302810u,15302810u,7458u},{15302813u,15302813u,5399u},
+{15302814u,15302814u,4500u},{15302815u,15302815u,5545u},{15302816u,15302816u,6822u},{15302817u,15302817u,6917u},
+{15302818u,15302818u,5106u},{15302819u,15302819u,4475u},{15302830u,15302830u,7211u},{15302833u,15302833u,6895u},
+{15302834u,15302834u,7010u},{15302837u,15302837u,4007u},{15302840u,15302840u,6466u},{15302844u,15302844u,7615u},
+{15302846u,15302846u,6350u},{15303041u,15303041u,4361u},{15303042u,15303042u,5614u},{15303047u,15303047u,6223u},
+{15303050u,15303050u,6349u},{15303051u,15303051u,6246u},{15303053u,15303053u,7525u},{15303054u,15303054u,3812u},
+{15303056u,15303056u,7627u},{15303057u,15303057u,7925u},{15303059u,15303059u,4304u},{15303060u,15303060u,4216u},
+{15303061u,15303061u,6306u},{15303065u,15303065u,6165u},{15303068u,15303068u,5550u},{15303069u,15303069u,4238u},
+{15303070u,15303070u,7212u},{15303072u,15303072u,6277u},{15303073u,15303073u,5532u},{15303075u,15303075u,3646u},
+{15303081u,15303081u,6641u},{15303085u,15303085u,6823u},{15303086u,15303086u,7054u},{15303087u,15303087u,4362u},
+{15303090u,15303090u,6974u},{15303093u,15303093u,6918u},{15303095u,15303095u,7162u},{15303096u,15303096u,5445u},
+{15303098u,15303098u,6351u},{15303100u,15303100u,4561u},{15303101u,15303101u,3598u},{15303103u,15303103u,7602u},
+{15303296u,15303296u,6166u},{15303297u,15303297u,4720u},{15303298u,15303298u,7700u},{15303299u,15303299u,5615u},
+{15303300u,15303300u,7896u},{15303303u,15303303u,6434u},{15303304u,15303304u,4669u},{15303306u,15303306u,5036u},
+{15303311u,15303311u,4381u},{15303313u,15303313u,6389u},{15303317u,15303317u,6096u},{15303321u,15303321u,4707u},
+{15303330u,15303330u,7788u},{15303331u,15303331u,4138u},{15303334u,15303334u,4966u},{15303336u,15303336u,7250u},
+{15303338u,15303338u,5297u},{15303343u,15303343u,3526u},{15303344u,15303344u,7443u},{15303345u,15303345u,3939u},
+{15303349u,15303349u,5533u},{15303352u,15303352u,6616u},{15303553u,15303553u,6236u},{15303562u,15303562u,3889u},
+{15303582u,15303582u,4419u},{15303585u,15303585u,3958u},{15303592u,15303592u,5145u},{15303597u,15303597u,3818u},
+{15303605u,15303605u,6224u},{15303613u,15303613u,4305u},{15303810u,15303810u,5802u},{15303826u,15303826u,7279u},
+{15303829u,15303829u,7714u},{15303833u,15303833u,5219u},{15303847u,15303847u,4372u},{15303853u,15303853u,6748u},
+{15303858u,15303858u,4210u},{15304073u,15304073u,6352u},{15304074u,15304074u,6749u},{15304075u,15304075u,7280u},
+{15304076u,15304076u,6519u},{15304077u,15304077u,4986u},{15304078u,15304078u,6896u},{15304082u,15304082u,6897u},
+{15304098u,15304098u,7238u},{15304105u,15304105u,4760u},{15304106u,15304106u,4387u},{15304108u,15304108u,5616u},
+{15304117u,15304117u,7964u},{15304119u,15304119u,7843u},{15304120u,15304120u,5313u},{15304327u,15304327u,5663u},
+{15304329u,15304329u,7327u},{15304331u,15304331u,7239u},{15304333u,15304333u,6776u},{15304338u,15304338u,5491u},
+{15304348u,15304348u,7281u},{15304363u,15304363u,6412u},{15304364u,15304364u,6567u},{15304366u,15304366u,7240u},
+{15304367u,15304367u,7798u},{15304369u,15304369u,4937u},{15304372u,15304372u,4509u},{15304373u,15304373u,3584u},
+{15304576u,15304576u,5899u},{15304583u,15304583u,7124u},{15304585u,15304585u,6353u},{15304587u,15304587u,5416u},
+{15304588u,15304588u,4634u},{15304589u,15304589u,6925u},{15304590u,15304590u,5871u},{15304591u,15304591u,4439u},
+{15304592u,15304592u,4635u},{15304593u,15304593u,4131u},{15304599u,15304599u,5566u},{15304600u,15304600u,6750u},
+{15304604u,15304604u,5146u},{15304605u,15304605u,7374u},{15304611u,15304611u,6824u},{15304615u,15304615u,7163u},
+{15304618u,15304618u,6225u},{15304629u,15304629u,7125u},{15304845u,15304845u,4363u},{15304848u,15304848u,3622u},
+{15304849u,15304849u,7497u},{15304850u,15304850u,5329u},{15304855u,15304855u,6366u},{15304862u,15304862u,4014u},
+{15304884u,15304884u,4501u},{15304890u,15304890u,6082u},{15304895u,15304895u,6676u},{15305088u,15305088u,3534u},
+{15305093u,15305093u,3599u},{15305097u,15305097u,7752u},{15305111u,15305111u,3658u},{15305115u,15305115u,5983u},
+{15305118u,15305118u,6283u},{15305122u,15305122u,4938u},{15305124u,15305124u,3940u},{15305125u,15305125u,5670u},
+{15305126u,15305126u,6751u},{15305344u,15305344u,6378u},{15305347u,15305347u,7260u},{15305349u,15305349u,4347u},
+{15305361u,15305361u,5446u},{15305363u,15305363u,6677u},{15305366u,15305366u,5617u},{15305368u,15305368u,4761u},
+{15305372u,15305372u,7660u},{15305395u,15305395u,6046u},{15305398u,15305398u,3941u},{15305399u,15305399u,5534u},
+{15305401u,15305401u,5618u},{15305612u,15305612u,6752u},{15305615u,15305615u,7769u},{15305618u,15305618u,5107u},
+{15305636u,15305636u,5400u},{15305642u,15305642u,7568u},{15305656u,15305656u,3600u},{15305660u,15305660u,3557u},
+{15305860u,15305860u,4532u},{15305872u,15305872u,7282u},{15305880u,15305880u,7283u},{15305882u,15305882u,6590u},
+{15305886u,15305886u,5664u},{15305887u,15305887u,4233u},{15305888u,15305888u,6753u},{15305889u,15305889u,4118u},
+{15305890u,15305890u,6678u},{15305892u,15305892u,4119u},{15305894u,15305894u,4050u},{15305896u,15305896u,4811u},
+{15305899u,15305899u,5417u},{15305902u,15305902u,3762u},{15305903u,15305903u,7059u},{15306120u,15306120u,6027u},
+{15306122u,15306122u,4476u},{15306123u,15306123u,3813u},{15306125u,15306125u,4306u},{15306132u,15306132u,5803u},
+{15306139u,15306139u,4211u},{15306158u,15306158u,6354u},{15306165u,15306165u,3611u},{15306172u,15306172u,7375u},
+{15306174u,15306174u,6852u},{15306380u,15306380u,3659u},{15306388u,15306388u,6195u},{15306390u,15306390u,5564u},
+{15306394u,15306394u,7284u},{15306403u,15306403u,7789u},{15306407u,15306407u,3577u},{15306412u,15306412u,7838u},
+{15306413u,15306413u,7011u},{15306416u,15306416u,6467u},{15306627u,15306627u,6831u},{15306641u,15306641u,6642u},
+{15306654u,15306654u,6196u},{15306657u,15306657u,3700u},{15306660u,15306660u,4575u},{15306678u,15306678u,7036u},
+{15306884u,15306884u,7952u},{15306904u,15306904u,6853u},{15306917u,15306917u,5447u},{15306923u,15306923u,6679u},
+{15306933u,15306933u,7176u},{15306936u,15306936u,7407u},{15307140u,15307140u,6898u},{15307153u,15307154u,3527u},
+{15307163u,15307163u,3851u},{15307197u,15307197u,7074u},{15307199u,15307199u,7060u},{15308215u,15308215u,6568u},
+{15308416u,15308416u,4846u},{15308419u,15308419u,5469u},{15308425u,15308425u,7542u},{15308427u,15308427u,3578u},
+{15308431u,15308431u,6367u},{15308433u,15308434u,7645u},{15308435u,15308435u,3499u},{15308436u,15308436u,4882u},
+{15308440u,15308440u,3535u},{15308451u,15308451u,3475u},{15308452u,15308452u,7667u},{15308453u,15308453u,5008u},
+{15308456u,15308456u,4008u},{15308461u,15308461u,4453u},{15308465u,15308465u,5988u},{15308475u,15308475u,5996u},
+{15308476u,15308476u,5820u},{15308679u,15308679u,5828u},{15308682u,15308682u,7903u},{15308692u,15308692u,7668u},
+{15308693u,15308693u,3983u},{15308694u,15308694u,7473u},{15308700u,15308700u,3833u},{15308705u,15308705u,7164u},
+{15308706u,15308706u,5029u},{15308956u,15308956u,5147u},{15308961u,15308961u,7165u},{15308970u,15308970u,7498u},
+{15308974u,15308974u,6123u},{15308978u,15308978u,4967u},{15308987u,15308987u,6825u},{15308991u,15308991u,5788u},
+{15309184u,15309184u,7391u},{15309186u,15309186u,7603u},{15309188u,15309188u,5148u},{15309195u,15309195u,4576u},
+{15309196u,15309196u,4724u},{15309197u,15309197u,3558u},{15309200u,15309200u,7647u},{15309211u,15309211u,7543u},
+{15309212u,15309212u,7669u},{15309213u,15309213u,5470u},{15309214u,15309214u,5691u},{15309215u,15309215u,7146u},
+{15309218u,15309218u,6278u},{15309219u,15309219u,7012u},{15309220u,15309220u,6777u},{15309226u,15309226u,4987u},
+{15309232u,15309232u,6384u},{15309235u,15309235u,7013u},{15309237u,15309237u,4612u},{15309238u,15309238u,4307u},
+{15309239u,15309239u,7661u},{15309240u,15309240u,4593u},{15309245u,15309245u,5900u},{15309445u,15309445u,6226u},
+{15309446u,15309446u,4603u},{15309450u,15309450u,4264u},{15309451u,15309451u,5619u},{15309453u,15309453u,7926u},
+{15309454u,15309454u,3727u},{15309460u,15309460u,3636u},{15309461u,15309461u,6247u},{15309464u,15309464u,5849u},
+{15309465u,15309465u,4022u},{15309467u,15309467u,6778u},{15309468u,15309468u,6569u},{15309475u,15309475u,4644u},
+{15309479u,15309480u,5620u},{15309482u,15309482u,7728u},{15309489u,15309489u,6379u},{15309495u,15309495u,4510u},
+{15309499u,15309499u,7147u},{15309696u,15309696u,6520u},{15309697u,15309697u,5813u},{15309700u,15309700u,6254u},
+{15309701u,15309701u,5789u},{15309702u,15309702u,7037u},{15309703u,15309703u,3763u},{15309705u,15309705u,7357u},
+{15309707u,15309707u,6919u},{15309708u,15309708u,6508u},{15309709u,15309709u,6097u},{15309710u,15309710u,6617u},
+{15309717u,15309717u,6826u},{15309718u,15309718u,5622u},{15309721u,15309721u,5773u},{15309723u,15309723u,7285u},
+{15309724u,15309724u,6533u},{15309730u,15309730u,4636u},{15309731u,15309731u,4142u},{15309736u,15309737u,6227u},
+{15309738u,15309738u,5461u},{15309743u,15309743u,4847u},{15309744u,15309744u,5170u},{15309746u,15309746u,6248u},
+{15309750u,15309750u,4502u},{15309751u,15309751u,4550u},{15309753u,15309753u,4903u},{15309755u,15309755u,6680u},
+{15309952u,15309952u,5623u},{15309958u,15309958u,6754u},{15309959u,15309959u,7014u},{15309969u,15309969u,6698u},
+{15309971u,15309971u,6047u},{15309974u,15309974u,4651u},{15309977u,15309977u,6028u},{15309980u,15309980u,5361u},
+{15309982u,15309982u,7628u},{15309991u,15309991u,4832u},{15310000u,15310000u,5314u},{15310002u,15310002u,4524u},
+{15310009u,15310009u,5030u},{15310013u,15310013u,6779u},{15310210u,15310210u,4464u},{15310212u,15310212u,5850u},
+{15310216u,15310216u,4503u},{15310225u,15310225u,7203u},{15310230u,15310230u,6755u},{15310236u,15310236u,6756u},
+{15310238u,15310238u,5220u},{15310241u,15310241u,4868u},{15310242u,15310242u,4744u},{15310249u,15310249u,7733u},
+{15310253u,15310253u,6458u},{15310260u,15310260u,7876u},{15310263u,15310263u,6459u},{15310266u,15310266u,4695u},
+{15310475u,15310475u,7799u},{15310477u,15310477u,5814u},{15310479u,15310479u,3801u},{15310496u,15310496u,3950u},
+{15310504u,15310504u,3509u},{15310507u,15310507u,3951u},{15310509u,15310509u,7526u},{15310726u,15310726u,7166u},
+{15310731u,15310731u,6307u},{15310739u,15310739u,7648u},{15310748u,15310748u,4308u},{15310771u,15310771u,6385u},
+{15310774u,15310774u,5535u},{15310779u,15310779u,6249u},{15310783u,15310783u,7715u},{15310976u,15310976u,7839u},
+{15310977u,15310977u,7757u},{15310978u,15310978u,6757u},{15310979u,15310979u,3701u},{15310981u,15310981u,7684u},
+{15310982u,15310982u,5665u},{15310984u,15310984u,5624u},{15310986u,15310986u,6237u},{15310988u,15310988u,5560u},
+{15310992u,15310992u,6048u},{15310993u,15310993u,6124u},{15310994u,15310994u,4928u},{15310995u,15310995u,4328u},
+{15310999u,15310999u,7489u},{15311000u,15311000u,4504u},{15311021u,15311021u,4357u},{15311024u,15311024u,7770u},
+{15311032u,15311032u,3702u},{15311033u,15311033u,7464u},{15311035u,15311035u,5236u},{15311238u,15311238u,3814u},
+{15311244u,15311244u,6780u},{15311245u,15311245u,5857u},{15311246u,15311246u,5804u},{15311252u,15311252u,5815u},
+{15311256u,15311256u,6279u},{15311258u,15311258u,6681u},{15311262u,15311262u,4590u},{15311269u,15311269u,7840u},
+{15311271u,15311271u,3764u},{15311275u,15311275u,6682u},{15311279u,15311279u,7753u},{15311528u,15311528u,7595u},
+{15311535u,15311535u,5330u},{15311537u,15311537u,7444u},{15311748u,15311748u,7588u},{15311751u,15311751u,7587u},
+{15311771u,15311771u,5221u},{15311772u,15311772u,5004u},{15311775u,15311775u,5733u},{15311777u,15311777u,5551u},
+{15311778u,15311778u,4120u},{15311789u,15311789u,7362u},{15311790u,15311790u,6386u},{15311791u,15311791u,4929u},
+{15311796u,15311796u,6435u},{15311804u,15311804u,5298u},{15311805u,15311805u,7569u},{15311806u,15311806u,5734u},
+{15312003u,15312003u,3890u},{15312009u,15312009u,7716u},{15312010u,15312010u,5901u},{15312012u,15312012u,6436u},
+{15312016u,15312016u,7075u},{15312019u,15312019u,5790u},{15312024u,15312024u,5946u},{15312030u,15312030u,6683u},
+{15312032u,15312032u,5056u},{15312040u,15312040u,3834u},{15312261u,15312261u,4687u},{15312265u,15312265u,4037u},
+{15312267u,15312267u,3989u},{15312268u,15312268u,7076u},{15312269u,15312269u,5448u},{15312273u,15312273u,4121u},
+{15312274u,15312274u,6167u},{15312276u,15312276u,6098u},{15312279u,15312279u,7717u},{15312534u,15312534u,5625u},
+{15312537u,15312537u,7718u},{15312541u,15312541u,7613u},{15312549u,15312549u,5089u},{15312552u,15312552u,7790u},
+{15312556u,15312556u,4661u},{15312557u,15312557u,5909u},{15312558u,15312558u,7596u},{15312561u,15312561u,7392u},
+{15312563u,15312563u,7358u},{15312564u,15312564u,5666u},{15312569u,15312569u,6468u},{15312769u,15312769u,4904u},
+{15312784u,15312784u,6899u},{15312785u,15312785u,4174u},{15312786u,15312786u,3942u},{15312789u,15312789u,3464u},
+{15312793u,15312793u,5149u},{15312797u,15312797u,7393u},{15312799u,15312799u,5299u},{15312813u,15312813u,7701u},
+{15312817u,15312817u,4388u},{15312831u,15312831u,6920u},{15313025u,15313025u,5240u},{15313032u,15313032u,5057u},
+{15313038u,15313039u,4122u},{15313049u,15313049u,7527u},{15313067u,15313067u,3612u},{15313072u,15313072u,4373u},
+{15313078u,15313078u,7286u},{15313079u,15313079u,5536u},{15313280u,15313280u,4725u},{15313283u,15313283u,7589u},
+{15313285u,15313285u,3943u},{15313293u,15313293u,7965u},{15313301u,15313301u,3891u},{15313303u,15313303u,7729u},
+{15313306u,15313306u,3703u},{15313307u,15313307u,5955u},{15313311u,15313311u,7328u},{15313314u,15313314u,4454u},
+{15313317u,15313317u,4124u},{15313321u,15313321u,7897u},{15313322u,15313322u,4455u},{15313576u,15313576u,3785u},
+{15313592u,15313592u,7702u},{15313811u,15313811u,5626u},{15313812u,15313812u,7213u},{15313816u,15313816u,3765u},
+{15313829u,15313829u,5997u},{15313838u,15313838u,4939u},{15314074u,15314074u,5627u},{15314087u,15314087u,4562u},
+{15314090u,15314090u,7470u},{15314097u,15314097u,6251u},{15314108u,15314108u,3993u},{15314305u,15314305u,3863u},
+{15314306u,15314306u,7849u},{15314307u,15314307u,4940u},{15314308u,15314308u,4995u},{15314309u,15314309u,4721u},
+{15314319u,15314319u,6308u},{15314324u,15314324u,4662u},{15314330u,15314330u,5910u},{15314351u,15314351u,4525u},
+{15314574u,15314574u,6699u},{15314577u,15314577u,7570u},{15314591u,15314591u,5816u},{15314603u,15314603u,3892u},
+{15314606u,15314606u,5449u},{15314825u,15314825u,4637u},{15314838u,15314838u,7204u},{15314852u,15314852u,3783u},
+{15314856u,15314856u,3704u},{15315085u,15315085u,7287u},{15315088u,15315088u,5805u},{15315090u,15315090u,5090u},
+{15315093u,15315093u,7629u},{15315109u,15315109u,7898u},{15315122u,15315122u,6076u},{15315131u,15315131u,4688u},
+{15315335u,15315335u,3559u},{15315337u,15315337u,5039u},{15315351u,15315351u,4645u},{15315877u,15315877u,6827u},
+{15315879u,15315879u,5150u},{15315881u,15315881u,3944u},{15315891u,15315891u,5108u},{15315892u,15315892u,4762u},
+{15315894u,15315894u,5984u},{15316105u,15316105u,5791u},{15316123u,15316123u,6280u},{15316134u,15316134u,5839u},
+{15316136u,15316136u,5832u},{15316155u,15316155u,7862u},{15316369u,15316369u,3647u},{15316381u,15316381u,5792u},
+{15316384u,15316384u,3773u},{15316385u,15316385u,4833u},{15316396u,15316396u,5180u},{15316402u,15316402u,6521u},
+{15316649u,15316649u,4794u},{15316655u,15316655u,5860u},{15316660u,15316660u,7634u},{15316868u,15316868u,3728u},
+{15316887u,15316887u,3945u},{15316914u,15316914u,7329u},{15316920u,15316920u,8012u},{15316921u,15316921u,6393u},
+{15316922u,15316922u,4526u},{15317146u,15317146u,5861u},{15317150u,15317150u,4396u},{15317429u,15317429u,4527u},
+{15317433u,15317433u,7662u},{15317437u,15317437u,5998u},{15317439u,15317439u,4533u},{15317650u,15317650u,4125u},
+{15317651u,15317651u,4534u},{15317655u,15317655u,4456u},{15317661u,15317661u,5300u},{15317663u,15317663u,4646u},
+{15317669u,15317669u,4726u},{15317684u,15317684u,3952u},{15317685u,15317685u,4745u},{15317691u,15317691u,4663u},
+{15317694u,15317694u,8004u},{15317891u,15317891u,7927u},{15317901u,15317901u,5401u},{15317902u,15317902u,4457u},
+{15317905u,15317905u,8018u},{15317908u,15317908u,3623u},{15317912u,15317912u,4835u},{15317915u,15317915u,4265u},
+{15317916u,15317916u,7305u},{15317918u,15317918u,6700u},{15317928u,15317928u,4249u},{15317940u,15317940u,4869u},
+{15318151u,15318151u,6077u},{15318152u,15318152u,5040u},{15318158u,15318158u,6758u},{15318163u,15318163u,3766u},
+{15318176u,15318176u,5402u},{15318203u,15318203u,5222u},{15318410u,15318410u,6781u},{15318411u,15318411u,6585u},
+{15318414u,15318414u,6586u},{15318418u,15318418u,7359u},{15318431u,15318431u,6618u},{15318433u,15318433u,4505u},
+{15318439u,15318439u,5462u},{15318442u,15318442u,7061u},{15318444u,15318444u,5911u},{15318455u,15318455u,5806u},
+{15318669u,15318669u,4563u},{15318672u,15318672u,4968u},{15318677u,15318677u,3529u},{15318684u,15318684u,3946u},
+{15380608u,15380609u,1086u},{15380610u,15380611u,9333u},{15380612u,15380612u,1088u},{15380613u,15380614u,9335u},
+{15380615u,15380618u,1089u},{15380619u,15380623u,9337u},{15380624u,15380631u,1093u},{15380632u,15380632u,9342u},
+{15380633u,15380637u,1101u},{15380638u,15380639u,9343u},{15380640u,15380640u,1106u},{15380641u,15380643u,9345u},
+{15380644u,15380644u,1107u},{15380645u,15380651u,9348u},{15380652u,15380653u,1108u},{15380654u,15380654u,9355u},
+{15380655u,15380657u,1110u},{15380658u,15380663u,9356u},{15380664u,15380665u,1113u},{15380666u,15380667u,9362u},
+{15380668u,15380668u,1115u},{15380669u,15380671u,9364u},{15380864u,15380864u,1116u},{15380865u,15380874u,9367u},
+{15380875u,15380875u,1117u},{15380876u,15380876u,9377u},{15380877u,15380877u,1118u},{15380878u,15380883u,9378u},
+{15380884u,15380884u,1119u},{15380885u,15380887u,9384u},{15380888u,15380888u,1120u},{15380889u,15380891u,9387u},
+{15380892u,15380892u,1121u},{15380893u,15380911u,9390u},{15380912u,15380913u,1122u},{15380914u,15380915u,9409u},
+{15380916u,15380916u,1124u},{15380917u,15380918u,9411u},{15380919u,15380920u,1125u},{15380921u,15380921u,9413u},
+{15380922u,15380922u,1127u},{15380923u,15380927u,9414u},{15381120u,15381121u,1128u},{15381122u,15381122u,9419u},
+{15381123u,15381126u,1130u},{15381127u,15381128u,9420u},{15381129u,15381132u,1134u},{15381133u,15381135u,9422u},
+{15381136u,15381136u,1138u},{15381137u,15381139u,9425u},{15381140u,15381140u,1139u},{15381141u,15381147u,9428u},
+{15381148u,15381149u,1140u},{15381150u,15381150u,9435u},{15381151u,15381153u,1142u},{15381154u,15381159u,9436u},
+{15381160u,15381162u,1145u},{15381163u,15381163u,9442u},{15381164u,15381164u,1148u},{15381165u,15381166u,9443u},
+{15381167u,15381168u,1149u},{15381169u,15381175u,9445u},{15381176u,15381177u,1151u},{15381178u,15381178u,9452u},
+{15381179u,15381181u,1153u},{15381182u,15381183u,9453u},{15381376u,15381376u,9455u},{15381377u,15381377u,1156u},
+{15381378u,15381379u,9456u},{15381380u,15381380u,1157u},{15381381u,15381383u,9458u},{15381384u,15381384u,1158u},
+{15381385u,15381387u,9461u},{15381388u,15381388u,1159u},{15381389u,15381396u,9464u},{15381397u,15381397u,1160u},
+{15381398u,15381398u,9472u},{15381399u,15381399u,1161u},{15381400u,15381407u,9473u},{15381408u,15381409u,1162u},
+{15381410u,15381411u,9481u},{15381412u,15381412u,1164u},{15381413u,15381414u,9483u},{15381415u,15381416u,1165u},
+{15381417u,15381417u,9485u},{15381418u,15381418u,1167u},{15381419u,15381419u,9486u},{15381420u,15381420u,1168u},
+{15381421u,15381422u,9487u},{15381423u,15381425u,1169u},{15381426u,15381426u,9489u},{15381427u,15381427u,1172u},
+{15381428u,15381428u,9490u},{15381429u,15381430u,1173u},{15381431u,15381435u,9491u},{15381436u,15381437u,1175u},
+{15381438u,15381439u,9496u},{15381632u,15381632u,1177u},{15381633u,15381635u,9498u},{15381636u,15381636u,1178u},
+{15381637u,15381637u,9501u},{15381638u,15381638u,1179u},{15381639u,15381643u,9502u},{15381644u,15381645u,1180u},
+{15381646u,15381646u,9507u},{15381647u,15381647u,1182u},{15381648u,15381648u,9508u},{15381649u,15381649u,1183u},
+{15381650u,15381655u,9509u},{15381656u,15381656u,1184u},{15381657u,15381659u,9515u},{15381660u,15381660u,1185u},
+{15381661u,15381663u,9518u},{15381664u,15381664u,1186u},{15381665u,15381672u,9521u},{15381673u,15381673u,1187u},
+{15381674u,15381675u,9529u},{15381676u,15381677u,1188u},{15381678u,15381683u,9531u},{15381684u,15381685u,1190u},
+{15381686u,15381687u,9537u},{15381688u,15381688u,1192u},{15381689u,15381691u,9539u},{15381692u,15381692u,1193u},
+{15381693u,15381695u,9542u},{15381888u,15381891u,9545u},{15381892u,15381893u,1194u},{15381894u,15381894u,9549u},
+{15381895u,15381895u,1196u},{15381896u,15381896u,9550u},{15381897u,15381897u,1197u},{15381898u,15381903u,9551u},
+{15381904u,15381904u,1198u},{15381905u,15381907u,9557u},{15381908u,15381908u,1199u},{15381909u,15381911u,9560u},
+{15381912u,15381912u,1200u},{15381913u,15381920u,9563u},{15381921u,15381921u,1201u},{15381922u,15381922u,9571u},
+{15381923u,15381923u,1202u},{15381924u,15381931u,9572u},{15381932u,15381933u,1203u},{15381934u,15381935u,9580u},
+{15381936u,15381936u,1205u},{15381937u,15381938u,9582u},{15381939u,15381942u,1206u},{15381943u,15381946u,9584u},
+{15381947u,15381949u,1210u},{15381950u,15381950u,9588u},{15381951u,15381951u,1213u},{15382144u,15382144u,9589u},
+{15382145u,15382146u,1214u},{15382147u,15382151u,9590u},{15382152u,15382153u,1216u},{15382154u,15382155u,9595u},
+{15382156u,15382156u,1218u},{15382157u,15382159u,9597u},{15382160u,15382160u,1219u},{15382161u,15382171u,9600u},
+{15382172u,15382173u,1220u},{15382174u,15382179u,9611u},{15382180u,15382180u,1222u},{15382181u,15382198u,9617u},
+{15382199u,15382199u,1223u},{15382200u,15382207u,9635u},{15382400u,15382401u,1224u},{15382402u,15382403u,9643u},
+{15382404u,15382404u,1226u},{15382405u,15382407u,9645u},{15382408u,15382408u,1227u},{15382409u,15382415u,9648u},
+{15382416u,15382417u,1228u},{15382418u,15382418u,9655u},{15382419u,15382419u,1230u},{15382420u,15382427u,9656u},
+{15382428u,15382428u,1231u},{15382429u,15382431u,9664u},{15382432u,15382432u,1232u},{15382433u,15382435u,9667u},
+{15382436u,15382436u,1233u},{15382437u,15382455u,9670u},{15382456u,15382457u,1234u},{15382458u,15382459u,9689u},
+{15382460u,15382460u,1236u},{15382461u,15382462u,9691u},{15382463u,15382463u,1237u},{15382656u,15382657u,1238u},
+{15382658u,15382663u,9693u},{15382664u,15382665u,1240u},{15382666u,15382666u,9699u},{15382667u,15382667u,1242u},
+{15382668u,15382668u,9700u},{15382669u,15382669u,1243u},{15382670u,15382675u,9701u},{15382676u,15382676u,1244u},
+{15382677u,15382703u,9707u},{15382704u,15382705u,1245u},{15382706u,15382707u,9734u},{15382708u,15382708u,1247u},
+{15382709u,15382710u,9736u},{15382711u,15382712u,1248u},{15382713u,15382713u,9738u},{15382714u,15382714u,1250u},
+{15382715u,15382719u,9739u},{15382912u,15382913u,1251u},{15382914u,15382914u,9744u},{15382915u,15382915u,1253u},
+{15382916u,15382916u,9745u},{15382917u,15382918u,1254u},{15382919u,15382921u,9746u},{15382922u,15382922u,1256u},
+{15382923u,15382923u,9749u},{15382924u,15382926u,1257u},{15382927u,15382927u,9750u},{15382928u,15382928u,1260u},
+{15382929u,15382931u,9751u},{15382932u,15382932u,1261u},{15382933u,15382933u,9754u},{15382934u,15382934u,1262u},
+{15382935u,15382939u,9755u},{15382940u,15382941u,1263u},{15382942u,15382942u,9760u},{15382943u,15382945u,1265u},
+{15382946u,15382948u,9761u},{15382949u,15382949u,1268u},{15382950u,15382951u,9764u},{15382952u,15382953u,1269u},
+{15382954u,15382955u,9766u},{15382956u,15382956u,1271u},{15382957u,15382959u,9768u},{15382960u,15382960u,1272u},
+{15382961u,15382967u,9771u},{15382968u,15382969u,1273u},{15382970u,15382970u,9778u},{15382971u,15382973u,1275u},
+{15382974u,15382975u,9779u},{15383168u,15383171u,9781u},{15383172u,15383173u,1278u},{15383174u,15383179u,9785u},
+{15383180u,15383180u,1280u},{15383181u,15383227u,9791u},{15383228u,15383230u,1281u},{15383231u,15383231u,9838u},
+{15383424u,15383424u,1284u},{15383425u,15383427u,9839u},{15383428u,15383428u,1285u},{15383429u,15383435u,9842u},
+{15383436u,15383437u,1286u},{15383438u,15383438u,9849u},{15383439u,15383441u,1288u},{15383442u,15383447u,9850u},
+{15383448u,15383449u,1291u},{15383450u,15383451u,9856u},{15383452u,15383452u,1293u},{15383453u,15383463u,9858u},
+{15383464u,15383464u,1294u},{15383465u,15383466u,9869u},{15383467u,15383467u,1295u},{15383468u,15383468u,9871u},
+{15383469u,15383469u,1296u},{15383470u,15383475u,9872u},{15383476u,15383476u,1297u},{15383477u,15383479u,9878u},
+{15383480u,15383480u,1298u},{15383481u,15383483u,9881u},{15383484u,15383484u,1299u},{15383485u,15383487u,9884u},
+{15383680u,15383686u,9887u},{15383687u,15383688u,1300u},{15383689u,15383692u,9894u},{15383693u,15383693u,1302u},
+{15383694u,15383695u,9898u},{15383696u,15383696u,1303u},{15383697u,15383723u,9900u},{15383724u,15383725u,1304u},
+{15383726u,15383727u,9927u},{15383728u,15383728u,1306u},{15383729u,15383729u,9929u},{15383730u,15383730u,1307u},
+{15383731u,15383731u,9930u},{15383732u,15383732u,1308u},{15383733u,15383739u,9931u},{15383740u,15383741u,1309u},
+{15383742u,15383742u,9938u},{15383743u,15383743u,1311u},{15383936u,15383936u,9939u},{15383937u,15383939u,1312u},
+{15383940u,15383943u,9940u},{15383944u,15383945u,1315u},{15383946u,15383951u,9944u},{15383952u,15383952u,1317u},
+{15383953u,15383963u,9950u},{15383964u,15383965u,1318u},{15383966u,15383971u,9961u},{15383972u,15383973u,1320u},
+{15383974u,15383992u,9967u},{15383993u,15383993u,1322u},{15383994u,15383999u,9986u},{15384192u,15384192u,1323u},
+{15384193u,15384195u,9992u},{15384196u,15384196u,1324u},{15384197u,15384199u,9995u},{15384200u,15384200u,1325u},
+{15384201u,15384207u,9998u},{15384208u,15384209u,1326u},{15384210u,15384212u,10005u},{15384213u,15384213u,1328u},
+{15384214u,15384219u,10008u},{15384220u,15384220u,1329u},{15384221u,15384247u,10014u},{15384248u,15384249u,1330u},
+{15384250u,15384251u,10041u},{15384252u,15384252u,1332u},{15384253u,15384255u,10043u},{15384448u,15384448u,1333u},
+{15384449u,15384454u,10046u},{15384455u,15384457u,1334u},{15384458u,15384458u,10052u},{15384459u,15384459u,1337u},
+{15384460u,15384460u,10053u},{15384461u,15384462u,1338u},{15384463u,15384467u,10054u},{15384468u,15384468u,1340u},
+{15384469u,15384475u,10059u},{15384476u,15384476u,1341u},{15384477u,15384487u,10066u},{15384488u,15384489u,1342u},
+{15384490u,15384495u,10077u},{15384496u,15384497u,1344u},{15384498u,15384499u,10083u},{15384500u,15384500u,1346u},
+{15384501u,15384503u,10085u},{15384504u,15384504u,1347u},{15384505u,15384511u,10088u},{15433856u,15433857u,1348u},
+{15433858u,15433859u,10095u},{15433860u,15433860u,1350u},{15433861u,15433867u,10097u},{15433868u,15433868u,1351u},
+{15433869u,15433871u,10104u},{15433872u,15433872u,1352u},{15433873u,15433875u,10107u},{15433876u,15433876u,1353u},
+{15433877u,15433883u,10110u},{15433884u,15433885u,1354u},{15433886u,15433895u,10117u},{15433896u,15433896u,1356u},
+{15433897u,15433919u,10127u},{15434112u,15434115u,10150u},{15434116u,15434117u,1357u},{15434118u,15434119u,10154u},
+{15434120u,15434120u,1359u},{15434121u,15434121u,10156u},{15434122u,15434122u,1360u},{15434123u,15434123u,10157u},
+{15434124u,15434124u,1361u},{15434125u,15434125u,10158u},{15434126u,15434126u,1362u},{15434127u,15434130u,10159u},
+{15434131u,15434133u,1363u},{15434134u,15434134u,10163u},{15434135u,15434135u,1366u},{15434136u,15434136u,10164u},
+{15434137u,15434137u,1367u},{15434138u,15434140u,10165u},{15434141u,15434141u,1368u},{15434142u,15434171u,10168u},
+{15434172u,15434173u,1369u},{15434174u,15434175u,10198u},{15434368u,15434368u,1371u},{15434369u,15434371u,10200u},
+{15434372u,15434372u,1372u},{15434373u,15434379u,10203u},{15434380u,15434381u,1373u},{15434382u,15434382u,10210u},
+{15434383u,15434383u,1375u},{15434384u,15434384u,10211u},{15434385u,15434385u,1376u},{15434386u,15434391u,10212u},
+{15434392u,15434394u,1377u},{15434395u,15434395u,10218u},{15434396u,15434396u,1380u},{15434397u,15434398u,10219u},
+{15434399u,15434402u,1381u},{15434403u,15434407u,10221u},{15434408u,15434409u,1385u},{15434410u,15434410u,10226u},
+{15434411u,15434415u,1387u},{15434416u,15434416u,10227u},{15434417u,15434417u,1392u},{15434418u,15434418u,10228u},
+{15434419u,15434421u,1393u},{15434422u,15434423u,10229u},{15434424u,15434424u,1396u},{15434425u,15434427u,10231u},
+{15434428u,15434428u,1397u},{15434429u,15434431u,10234u},{15434624u,15434627u,10237u},{15434628u,15434629u,1398u},
+{15434630u,15434630u,10241u},{15434631u,15434633u,1400u},{15434634u,15434639u,10242u},{15434640u,15434641u,1403u},
+{15434642u,15434643u,10248u},{15434644u,15434644u,1405u},{15434645u,15434647u,10250u},{15434648u,15434648u,1406u},
+{15434649u,15434655u,10253u},{15434656u,15434656u,1407u},{15434657u,15434660u,10260u},{15434661u,15434661u,1408u},
+{15434662u,15434687u,10264u},{15434880u,15434887u,10290u},{15434888u,15434889u,1409u},{15434890u,15434890u,10298u},
+{15434891u,15434892u,1411u},{15434893u,15434895u,10299u},{15434896u,15434896u,1413u},{15434897u,15434897u,10302u},
+{15434898u,15434899u,1414u},{15434900u,15434903u,10303u},{15434904u,15434905u,1416u},{15434906u,15434906u,10307u},
+{15434907u,15434909u,1418u},{15434910u,15434914u,10308u},{15434915u,15434917u,1421u},{15434918u,15434919u,10313u},
+{15434920u,15434920u,1424u},{15434921u,15434923u,10315u},{15434924u,15434924u,1425u},{15434925u,15434931u,10318u},
+{15434932u,15434933u,1426u},{15434934u,15434934u,10325u},{15434935u,15434937u,1428u},{15434938u,15434943u,10326u},
+{15435136u,15435137u,1431u},{15435138u,15435139u,10332u},{15435140u,15435140u,1433u},{15435141u,15435143u,10334u},
+{15435144u,15435144u,1434u},{15435145u,15435151u,10337u},{15435152u,15435153u,1435u},{15435154u,15435155u,10344u},
+{15435156u,15435157u,1437u},{15435158u,15435159u,10346u},{15435160u,15435160u,1439u},{15435161u,15435163u,10348u},
+{15435164u,15435164u,1440u},{15435165u,15435167u,10351u},{15435168u,15435168u,1441u},{15435169u,15435191u,10354u},
+{15435192u,15435193u,1442u},{15435194u,15435195u,10377u},{15435196u,15435196u,1444u},{15435197u,15435199u,10379u},
+{15435392u,15435392u,1445u},{15435393u,15435393u,10382u},{15435394u,15435394u,1446u},{15435395u,15435399u,10383u},
+{15435400u,15435401u,1447u},{15435402u,15435402u,10388u},{15435403u,15435403u,1449u},{15435404u,15435404u,10389u},
+{15435405u,15435405u,1450u},{15435406u,15435409u,10390u},{15435410u,15435412u,1451u},{15435413u,15435415u,10394u},
+{15435416u,15435416u,1454u},{15435417u,15435419u,10397u},{15435420u,15435420u,1455u},{15435421u,15435431u,10400u},
+{15435432u,15435432u,1456u},{15435433u,15435455u,10411u},{15435648u,15435659u,10434u},{15435660u,15435660u,1457u},
+{15435661u,15435663u,10446u},{15435664u,15435664u,1458u},{15435665u,15435667u,10449u},{15435668u,15435668u,1459u},
+{15435669u,15435675u,10452u},{15435676u,15435677u,1460u},{15435678u,15435678u,10459u},{15435679u,15435679u,1462u},
+{15435680u,15435687u,10460u},{15435688u,15435689u,1463u},{15435690u,15435691u,10468u},{15435692u,15435692u,1465u},
+{15435693u,15435695u,10470u},{15435696u,15435696u,1466u},{15435697u,15435704u,10473u},{15435705u,15435705u,1467u},
+{15435706u,15435706u,10481u},{15435707u,15435707u,1468u},{15435708u,15435708u,10482u},{15435709u,15435709u,1469u},
+{15435710u,15435711u,10483u},{15435904u,15435907u,10485u},{15435908u,15435909u,1470u},{15435910u,15435911u,10489u},
+{15435912u,15435912u,1472u},{15435913u,15435914u,10491u},{15435915u,15435916u,1473u},{15435917u,15435923u,10493u},
+{15435924u,15435925u,1475u},{15435926u,15435926u,10500u},{15435927u,15435927u,1477u},{15435928u,15435928u,10501u},
+{15435929u,15435929u,1478u},{15435930u,15435935u,10502u},{15435936u,15435936u,1479u},{15435937u,15435955u,10508u},
+{15435956u,15435956u,1480u},{15435957u,15435963u,10527u},{15435964u,15435964u,1481u},{15435965u,15435967u,10534u},
+{15436160u,15436183u,10537u},{15436184u,15436184u,1482u},{15436185u,15436187u,10561u},{15436188u,15436188u,1483u},
+{15436189u,15436191u,10564u},{15436192u,15436192u,1484u},{15436193u,15436199u,10567u},{15436200u,15436201u,1485u},
+{15436202u,15436211u,10574u},{15436212u,15436213u,1487u},{15436214u,15436219u,10584u},{15436220u,15436220u,1489u},
+{15436221u,15436223u,10590u},{15436416u,15436419u,10593u},{15436420u,15436421u,1490u},{15436422u,15436424u,10597u},
+{15436425u,15436425u,1492u},{15436426u,15436431u,10600u},{15436432u,15436433u,1493u},{15436434u,15436435u,10606u},
+{15436436u,15436436u,1495u},{15436437u,15436439u,10608u},{15436440u,15436442u,1496u},{15436443u,15436447u,10611u},
+{15436448u,15436449u,1499u},{15436450u,15436450u,10616u},{15436451u,15436451u,1501u},{15436452u,15436452u,10617u},
+{15436453u,15436454u,1502u},{15436455u,15436457u,10618u},{15436458u,15436458u,1504u},{15436459u,15436459u,10621u},
+{15436460u,15436460u,1505u},{15436461u,15436463u,10622u},{15436464u,15436464u,1506u},{15436465u,15436467u,10625u},
+{15436468u,15436468u,1507u},{15436469u,15436479u,10628u},{15436672u,15436679u,10639u},{15436680u,15436681u,1508u},
+{15436682u,15436683u,10647u},{15436684u,15436684u,1510u},{15436685u,15436687u,10649u},{15436688u,15436688u,1511u},
+{15436689u,15436689u,10652u},{15436690u,15436690u,1512u},{15436691u,15436695u,10653u},{15436696u,15436697u,1513u},
+{15436698u,15436698u,10658u},{15436699u,15436699u,1515u},{15436700u,15436700u,10659u},{15436701u,15436701u,1516u},
+{15436702u,15436705u,10660u},{15436706u,15436706u,1517u},{15436707u,15436707u,10664u},{15436708u,15436710u,1518u},
+{15436711u,15436711u,10665u},{15436712u,15436712u,1521u},{15436713u,15436714u,10666u},{15436715u,15436719u,1522u},
+{15436720u,15436722u,10668u},{15436723u,15436725u,1527u},{15436726u,15436726u,10671u},{15436727u,15436731u,1530u},
+{15436732u,15436734u,10672u},{15436735u,15436735u,1535u},{15436928u,15436929u,1536u},{15436930u,15436931u,10675u},
+{15436932u,15436932u,1538u},{15436933u,15436935u,10677u},{15436936u,15436936u,1539u},{15436937u,15436943u,10680u},
+{15436944u,15436945u,1540u},{15436946u,15436946u,10687u},{15436947u,15436949u,1542u},{15436950u,15436955u,10688u},
+{15436956u,15436956u,1545u},{15436957u,15436991u,10694u},{15437184u,15437203u,10729u},{15437204u,15437206u,1546u},
+{15437207u,15437207u,10749u},{15437208u,15437208u,1549u},{15437209u,15437210u,10750u},{15437211u,15437212u,1550u},
+{15437213u,15437213u,10752u},{15437214u,15437215u,1552u},{15437216u,15437219u,10753u},{15437220u,15437221u,1554u},
+{15437222u,15437222u,10757u},{15437223u,15437223u,1556u},{15437224u,15437224u,10758u},{15437225u,15437225u,1557u},
+{15437226u,15437226u,10759u},{15437227u,15437227u,1558u},{15437228u,15437229u,10760u},{15437230u,15437230u,1559u},
+{15437231u,15437231u,10762u},{15437232u,15437233u,1560u},{15437234u,15437235u,10763u},{15437236u,15437236u,1562u},
+{15437237u,15437239u,10765u},{15437240u,15437240u,1563u},{15437241u,15437247u,10768u},{15437440u,15437441u,1564u},
+{15437442u,15437442u,10775u},{15437443u,15437445u,1566u},{15437446u,15437451u,10776u},{15437452u,15437452u,1569u},
+{15437453u,15437455u,10782u},{15437456u,15437456u,1570u},{15437457u,15437459u,10785u},{15437460u,15437460u,1571u},
+{15437461u,15437471u,10788u},{15437472u,15437473u,1572u},{15437474u,15437479u,10799u},{15437480u,15437480u,1574u},
+{15437481u,15437483u,10805u},{15437484u,15437484u,1575u},{15437485u,15437503u,10808u},{15437696u,15437699u,10827u},
+{15437700u,15437701u,1576u},{15437702u,15437703u,10831u},{15437704u,15437704u,1578u},{15437705u,15437706u,10833u},
+{15437707u,15437708u,1579u},{15437709u,15437709u,10835u},{15437710u,15437710u,1581u},{15437711u,15437711u,10836u},
+{15437712u,15437712u,1582u},{15437713u,15437715u,10837u},{15437716u,15437717u,1583u},{15437718u,15437718u,10840u},
+{15437719u,15437719u,1585u},{15437720u,15437720u,10841u},{15437721u,15437721u,1586u},{15437722u,15437722u,10842u},
+{15437723u,15437723u,1587u},{15437724u,15437724u,10843u},{15437725u,15437725u,1588u},{15437726u,15437727u,10844u},
+{15437728u,15437728u,1589u},{15437729u,15437731u,10846u},{15437732u,15437732u,1590u},{15437733u,15437735u,10849u},
+{15437736u,15437736u,1591u},{15437737u,15437755u,10852u},{15437756u,15437756u,1592u},{15437757u,15437759u,10871u},
+{15437952u,15437967u,10874u},{15437968u,15437968u,1593u},{15437969u,15437975u,10890u},{15437976u,15437976u,1594u},
+{15437977u,15437979u,10897u},{15437980u,15437980u,1595u},{15437981u,15437983u,10900u},{15437984u,15437984u,1596u},
+{15437985u,15437991u,10903u},{15437992u,15437993u,1597u},{15437994u,15437994u,10910u},{15437995u,15437995u,1599u},
+{15437996u,15438003u,10911u},{15438004u,15438004u,1600u},{15438005u,15438015u,10919u},{15438208u,15438223u,10930u},
+{15438224u,15438225u,1601u},{15438226u,15438227u,10946u},{15438228u,15438228u,1603u},{15438229u,15438231u,10948u},
+{15438232u,15438232u,1604u},{15438233u,15438239u,10951u},{15438240u,15438241u,1605u},{15438242u,15438242u,10958u},
+{15438243u,15438243u,1607u},{15438244u,15438244u,10959u},{15438245u,15438245u,1608u},{15438246u,15438251u,10960u},
+{15438252u,15438252u,1609u},{15438253u,15438271u,10966u},{15438464u,15438464u,1610u},{15438465u,15438471u,10985u},
+{15438472u,15438472u,1611u},{15438473u,15438492u,10992u},{15438493u,15438493u,1612u},{15438494u,15438499u,11012u},
+{15438500u,15438500u,1613u},{15438501u,15438503u,11018u},{15438504u,15438504u,1614u},{15438505u,15438507u,11021u},
+{15438508u,15438508u,1615u},{15438509u,15438516u,11024u},{15438517u,15438517u,1616u},{15438518u,15438518u,11032u},
+{15438519u,15438519u,1617u},{15438520u,15438520u,11033u},{15438521u,15438521u,1618u},{15438522u,15438527u,11034u},
+{15438720u,15438720u,1619u},{15438721u,15438723u,11040u},{15438724u,15438724u,1620u},{15438725u,15438727u,11043u},
+{15438728u,15438728u,1621u},{15438729u,15438735u,11046u},{15438736u,15438736u,1622u},{15438737u,15438740u,11053u},
+{15438741u,15438741u,1623u},{15438742u,15438747u,11057u},{15438748u,15438749u,1624u},{15438750u,15438751u,11063u},
+{15438752u,15438752u,1626u},{15438753u,15438754u,11065u},{15438755u,15438756u,1627u},{15438757u,15438757u,11067u},
+{15438758u,15438758u,1629u},{15438759u,15438763u,11068u},{15438764u,15438765u,1630u},{15438766u,15438766u,11073u},
+{15438767u,15438767u,1632u},{15438768u,15438768u,11074u},{15438769u,15438769u,1633u},{15438770u,15438775u,11075u},
+{15438776u,15438776u,1634u},{15438777u,15438783u,11081u},{15438976u,15438995u,11088u},{15438996u,15438997u,1635u},
+{15438998u,15438999u,11108u},{15439000u,15439000u,1637u},{15439001u,15439002u,11110u},{15439003u,15439004u,1638u},
+{15439005u,15439011u,11112u},{15439012u,15439013u,1640u},{15439014u,15439014u,11119u},{15439015u,15439018u,1642u},
+{15439019u,15439023u,11120u},{15439024u,15439025u,1646u},{15439026u,15439027u,11125u},{15439028u,15439028u,1648u},
+{15439029u,15439031u,11127u},{15439032u,15439032u,1649u},{15439033u,15439039u,11130u},{15439232u,15439233u,1650u},
+{15439234u,15439234u,11137u},{15439235u,15439237u,1652u},{15439238u,15439242u,11138u},{15439243u,15439245u,1655u},
+{15439246u,15439247u,11143u},{15439248u,15439248u,1658u},{15439249u,15439251u,11145u},{15439252u,15439252u,1659u},
+{15439253u,15439259u,11148u},{15439260u,15439261u,1660u},{15439262u,15439262u,11155u},{15439263u,15439265u,1662u},
+{15439266u,15439295u,11156u},{15439488u,15439519u,11186u},{15439520u,15439521u,1665u},{15439522u,15439523u,11218u},
+{15439524u,15439524u,1667u},{15439525u,15439527u,11220u},{15439528u,15439528u,1668u},{15439529u,15439529u,11223u},
+{15439530u,15439531u,1669u},{15439532u,15439535u,11224u},{15439536u,15439537u,1671u},{15439538u,15439538u,11228u},
+{15439539u,15439541u,1673u},{15439542u,15439546u,11229u},{15439547u,15439549u,1676u},{15439550u,15439551u,11234u},
+{15439744u,15439744u,1679u},{15439745u,15439747u,11236u},{15439748u,15439748u,1680u},{15439749u,15439755u,11239u},
+{15439756u,15439757u,1681u},{15439758u,15439758u,11246u},{15439759u,15439761u,1683u},{15439762u,15439767u,11247u},
+{15439768u,15439768u,1686u},{15439769u,15439787u,11253u},{15439788u,15439788u,1687u},{15439789u,15439807u,11272u},
+{15440000u,15440015u,11291u},{15440016u,15440017u,1688u},{15440018u,15440019u,11307u},{15440020u,15440020u,1690u},
+{15440021u,15440023u,11309u},{15440024u,15440024u,1691u},{15440025u,15440036u,11312u},{15440037u,15440037u,1692u},
+{15440038u,15440043u,11324u},{15440044u,15440044u,1693u},{15440045u,15440051u,11330u},{15440052u,15440052u,1694u},
+{15440053u,15440063u,11337u},{15440256u,15440263u,11348u},{15440264u,15440264u,1695u},{15440265u,15440291u,11356u},
+{15440292u,15440292u,1696u},{15440293u,15440295u,11383u},{15440296u,15440296u,1697u},{15440297u,15440319u,11386u},
+{15440512u,15440539u,11409u},{15440540u,15440541u,1698u},{15440542u,15440543u,11437u},{15440544u,15440544u,1700u},
+{15440545u,15440547u,11439u},{15440548u,15440548u,1701u},{15440549u,15440554u,11442u},{15440555u,15440556u,1702u},
+{15440557u,15440560u,11448u},{15440561u,15440561u,1704u},{15440562u,15440575u,11452u},{15440768u,15440787u,11466u},
+{15440788u,15440788u,1705u},{15440789u,15440815u,11486u},{15440816u,15440816u,1706u},{15440817u,15440819u,11513u},
+{15440820u,15440820u,1707u},{15440821u,15440823u,11516u},{15440824u,15440824u,1708u},{15440825u,15440831u,11519u},
+{15441024u,15441025u,1709u},{15441026u,15441028u,11526u},{15441029u,15441029u,1711u},{15441030u,15441063u,11529u},
+{15441064u,15441065u,1712u},{15441066u,15441067u,11563u},{15441068u,15441068u,1714u},{15441069u,15441070u,11565u},
+{15441071u,15441072u,1715u},{15441073u,15441079u,11567u},{15441080u,15441081u,1717u},{15441082u,15441082u,11574u},
+{15441083u,15441083u,1719u},{15441084u,15441087u,11575u},{15441280u,15441283u,11579u},{15441284u,15441284u,1720u},
+{15441285u,15441287u,11583u},{15441288u,15441288u,1721u},{15441289u,15441291u,11586u},{15441292u,15441292u,1722u},
+{15441293u,15441299u,11589u},{15441300u,15441301u,1723u},{15441302u,15441311u,11596u},{15441312u,15441312u,1725u},
+{15441313u,15441315u,11606u},{15441316u,15441316u,1726u},{15441317u,15441319u,11609u},{15441320u,15441320u,1727u},
+{15441321u,15441327u,11612u},{15441328u,15441329u,1728u},{15441330u,15441330u,11619u},{15441331u,15441331u,1730u},
+{15441332u,15441332u,11620u},{15441333u,15441333u,1731u},{15441334u,15441339u,11621u},{15441340u,15441341u,1732u},
+{15441342u,15441343u,11627u},{15441536u,15441536u,1734u},{15441537u,15441539u,11629u},{15441540u,15441540u,1735u},
+{15441541u,15441547u,11632u},{15441548u,15441549u,1736u},{15441550u,15441550u,11639u},{15441551u,15441554u,1738u},
+{15441555u,15441557u,11640u},{15441558u,15441561u,1742u},{15441562u,15441563u,11643u},{15441564u,15441564u,1746u},
+{15441565u,15441567u,11645u},{15441568u,15441568u,1747u},{15441569u,15441575u,11648u},{15441576u,15441577u,1748u},
+{15441578u,15441578u,11655u},{15441579u,15441581u,1750u},{15441582u,15441587u,11656u},{15441588u,15441589u,1753u},
+{15441590u,15441591u,11662u},{15441592u,15441592u,1755u},{15441593u,15441599u,11664u},{15441792u,15441798u,11671u},
+{15441799u,15441799u,1756u},{15441800u,15441800u,11678u},{15441801u,15441801u,1757u},{15441802u,15441835u,11679u},
+{15441836u,15441837u,1758u},{15441838u,15441839u,11713u},{15441840u,15441840u,1760u},{15441841u,15441843u,11715u},
+{15441844u,15441844u,1761u},{15441845u,15441851u,11718u},{15441852u,15441853u,1762u},{15441854u,15441854u,11725u},
+{15441855u,15441855u,1764u},{15442048u,15442049u,1765u},{15442050u,15442054u,11726u},{15442055u,15442057u,1767u},
+{15442058u,15442059u,11731u},{15442060u,15442060u,1770u},{15442061u,15442063u,11733u},{15442064u,15442064u,1771u},
+{15442065u,15442071u,11736u},{15442072u,15442073u,1772u},{15442074u,15442074u,11743u},{15442075u,15442075u,1774u},
+{15442076u,15442076u,11744u},{15442077u,15442077u,1775u},{15442078u,15442083u,11745u},{15442084u,15442085u,1776u},
+{15442086u,15442087u,11751u},{15442088u,15442088u,1778u},{15442089u,15442091u,11753u},{15442092u,15442092u,1779u},
+{15442093u,15442099u,11756u},{15442100u,15442101u,1780u},{15442102u,15442102u,11763u},{15442103u,15442105u,1782u},
+{15442106u,15442111u,11764u},{15442304u,15442304u,1785u},{15442305u,15442307u,11770u},{15442308u,15442308u,1786u},
+{15442309u,15442320u,11773u},{15442321u,15442321u,1787u},{15442322u,15442322u,11785u},{15442323u,15442323u,1788u},
+{15442324u,15442331u,11786u},{15442332u,15442333u,1789u},{15442334u,15442335u,11794u},{15442336u,15442336u,1791u},
+{15442337u,15442339u,11796u},{15442340u,15442340u,1792u},{15442341u,15442347u,11799u},{15442348u,15442349u,1793u},
+{15442350u,15442350u,11806u},{15442351u,15442351u,1795u},{15442352u,15442352u,11807u},{15442353u,15442353u,1796u},
+{15442354u,15442359u,11808u},{15442360u,15442360u,1797u},{15442361u,15442363u,11814u},{15442364u,15442364u,1798u},
+{15442365u,15442367u,11817u},{15442560u,15442572u,11820u},{15442573u,15442573u,1799u},{15442574u,15442599u,11833u},
+{15442600u,15442600u,1800u},{15442601u,15442607u,11859u},{15442608u,15442608u,1801u},{15442609u,15442611u,11866u},
+{15442612u,15442612u,1802u},{15442613u,15442615u,11869u},{15442616u,15442616u,1803u},{15442617u,15442623u,11872u},
+{15442816u,15442817u,1804u},{15442818u,15442818u,11879u},{15442819u,15442819u,1806u},{15442820u,15442820u,11880u},
+{15442821u,15442821u,1807u},{15442822u,15442827u,11881u},{15442828u,15442828u,1808u},{15442829u,15442831u,11887u},
+{15442832u,15442832u,1809u},{15442833u,15442835u,11890u},{15442836u,15442836u,1810u},{15442837u,15442844u,11893u},
+{15442845u,15442845u,1811u},{15442846u,15442846u,11901u},{15442847u,15442847u,1812u},{15442848u,15442848u,11902u},
+{15442849u,15442849u,1813u},{15442850u,15442855u,11903u},{15442856u,15442857u,1814u},{15442858u,15442859u,11909u},
+{15442860u,15442860u,1816u},{15442861u,15442863u,11911u},{15442864u,15442864u,1817u},{15442865u,15442871u,11914u},
+{15442872u,15442873u,1818u},{15442874u,15442874u,11921u},{15442875u,15442875u,1820u},{15442876u,15442876u,11922u},
+{15442877u,15442877u,1821u},{15442878u,15442879u,11923u},{15443072u,15443075u,11925u},{15443076u,15443076u,1822u},
+{15443077u,15443095u,11929u},{15443096u,15443096u,1823u},{15443097u,15443103u,11948u},{15443104u,15443104u,1824u},
+{15443105u,15443131u,11955u},{15443132u,15443133u,1825u},{15443134u,15443135u,11982u},{15443328u,15443328u,1827u},
+{15443329u,15443331u,11984u},{15443332u,15443332u,1828u},{15443333u,15443339u,11987u},{15443340u,15443340u,1829u},
+{15443341u,15443342u,11994u},{15443343u,15443343u,1830u},{15443344u,15443344u,11996u},{15443345u,15443345u,1831u},
+{15443346u,15443351u,11997u},{15443352u,15443353u,1832u},{15443354u,15443355u,12003u},{15443356u,15443356u,1834u},
+{15443357u,15443359u,12005u},{15443360u,15443360u,1835u},{15443361u,15443367u,12008u},{15443368u,15443369u,1836u},
+{15443370u,15443370u,12015u},{15443371u,15443371u,1838u},{15443372u,15443372u,12016u},{15443373u,15443373u,1839u},
+{15443374u,15443379u,12017u},{15443380u,15443381u,1840u},{15443382u,15443383u,12023u},{15443384u,15443384u,1842u},
+{15443385u,15443387u,12025u},{15443388u,15443388u,1843u},{15443389u,15443391u,12028u},{15443584u,15443587u,12031u},
+{15443588u,15443589u,1844u},{15443590u,15443590u,12035u},{15443591u,15443591u,1846u},{15443592u,15443592u,12036u},
+{15443593u,15443594u,1847u},{15443595u,15443596u,12037u},{15443597u,15443598u,1849u},{15443599u,15443627u,12039u},
+{15443628u,15443629u,1851u},{15443630u,15443631u,12068u},{15443632u,15443632u,1853u},{15443633u,15443635u,12070u},
+{15443636u,15443636u,1854u},{15443637u,15443643u,12073u},{15443644u,15443645u,1855u},{15443646u,15443646u,12080u},
+{15443647u,15443647u,1857u},{15443840u,15443840u,12081u},{15443841u,15443841u,1858u},{15443842u,15443847u,12082u},
+{15443848u,15443849u,1859u},{15443850u,15443851u,12088u},{15443852u,15443852u,1861u},{15443853u,15443853u,12090u},
+{15443854u,15443858u,1862u},{15443859u,15443863u,12091u},{15443864u,15443865u,1867u},{15443866u,15443866u,12096u},
+{15443867u,15443867u,1869u},{15443868u,15443868u,12097u},{15443869u,15443870u,1870u},{15443871u,15443872u,12098u},
+{15443873u,15443873u,1872u},{15443874u,15443874u,12100u},{15443875u,15443877u,1873u},{15443878u,15443879u,12101u},
+{15443880u,15443880u,1876u},{15443881u,15443883u,12103u},{15443884u,15443884u,1877u},{15443885u,15443891u,12106u},
+{15443892u,15443893u,1878u},{15443894u,15443894u,12113u},{15443895u,15443898u,1880u},{15443899u,15443903u,12114u},
+{15444096u,15444097u,1884u},{15444098u,15444103u,12119u},{15444104u,15444104u,1886u},{15444105u,15444116u,12125u},
+{15444117u,15444117u,1887u},{15444118u,15444151u,12137u},{15444152u,15444153u,1888u},{15444154u,15444155u,12171u},
+{15444156u,15444156u,1890u},{15444157u,15444159u,12173u},{15444352u,15444352u,1891u},{15444353u,15444353u,12176u},
+{15444354u,15444354u,1892u},{15444355u,15444359u,12177u},{15444360u,15444361u,1893u},{15444362u,15444362u,12182u},
+{15444363u,15444363u,1895u},{15444364u,15444364u,12183u},{15444365u,15444366u,1896u},{15444367u,15444370u,12184u},
+{15444371u,15444373u,1898u},{15444374u,15444375u,12188u},{15444376u,15444376u,1901u},{15444377u,15444379u,12190u},
+{15444380u,15444380u,1902u},{15444381u,15444387u,12193u},{15444388u,15444389u,1903u},{15444390u,15444390u,12200u},
+{15444391u,15444393u,1905u},{15444394u,15444399u,12201u},{15444400u,15444401u,1908u},{15444402u,15444403u,12207u},
+{15444404u,15444404u,1910u},{15444405u,15444407u,12209u},{15444408u,15444408u,1911u},{15444409u,15444415u,12212u},
+{15444608u,15444610u,12219u},{15444611u,15444613u,1912u},{15444614u,15444614u,12222u},{15444615u,15444615u,1915u},
+{15444616u,15444619u,12223u},{15444620u,15444620u,1916u},{15444621u,15444647u,12227u},{15444648u,15444649u,1917u},
+{15444650u,15444650u,12254u},{15444651u,15444652u,1919u},{15444653u,15444655u,12255u},{15444656u,15444656u,1921u},
+{15444657u,15444657u,12258u},{15444658u,15444658u,1922u},{15444659u,15444663u,12259u},{15444664u,15444665u,1923u},
+{15444666u,15444666u,12264u},{15444667u,15444667u,1925u},{15444668u,15444668u,12265u},{15444669u,15444669u,1926u},
+{15444670u,15444671u,12266u},{15444864u,15444867u,12268u},{15444868u,15444868u,1927u},{15444869u,15444871u,12272u},
+{15444872u,15444872u,1928u},{15444873u,15444887u,12275u},{15444888u,15444889u,1929u},{15444890u,15444923u,12290u},
+{15444924u,15444924u,1931u},{15444925u,15444927u,12324u},{15445120u,15445120u,1932u},{15445121u,15445123u,12327u},
+{15445124u,15445124u,1933u},{15445125u,15445132u,12330u},{15445133u,15445133u,1934u},{15445134u,15445134u,12338u},
+{15445135u,15445135u,1935u},{15445136u,15445136u,12339u},{15445137u,15445137u,1936u},{15445138u,15445143u,12340u},
+{15445144u,15445144u,1937u},{15445145u,15445147u,12346u},{15445148u,15445148u,1938u},{15445149u,15445151u,12349u},
+{15445152u,15445152u,1939u},{15445153u,15445160u,12352u},{15445161u,15445161u,1940u},{15445162u,15445162u,12360u},
+{15445163u,15445163u,1941u},{15445164u,15445171u,12361u},{15445172u,15445174u,1942u},{15445175u,15445175u,12369u},
+{15445176u,15445176u,1945u},{15445177u,15445178u,12370u},{15445179u,15445182u,1946u},{15445183u,15445183u,12372u},
+{15445376u,15445379u,12373u},{15445380u,15445381u,1950u},{15445382u,15445382u,12377u},{15445383u,15445383u,1952u},
+{15445384u,15445384u,12378u},{15445385u,15445385u,1953u},{15445386u,15445388u,12379u},{15445389u,15445389u,1954u},
+{15445390u,15445390u,12382u},{15445391u,15445392u,1955u},{15445393u,15445395u,12383u},{15445396u,15445396u,1957u},
+{15445397u,15445399u,12386u},{15445400u,15445400u,1958u},{15445401u,15445408u,12389u},{15445409u,15445409u,1959u},
+{15445410u,15445410u,12397u},{15445411u,15445411u,1960u},{15445412u,15445419u,12398u},{15445420u,15445420u,1961u},
+{15445421u,15445439u,12406u},{15445632u,15445639u,12425u},{15445640u,15445640u,1962u},{15445641u,15445643u,12433u},
+{15445644u,15445644u,1963u},{15445645u,15445647u,12436u},{15445648u,15445648u,1964u},{15445649u,15445667u,12439u},
+{15445668u,15445668u,1965u},{15445669u,15445671u,12458u},{15445672u,15445672u,1966u},{15445673u,15445675u,12461u},
+{15445676u,15445676u,1967u},{15445677u,15445683u,12464u},{15445684u,15445684u,1968u},{15445685u,15445686u,12471u},
+{15445687u,15445687u,1969u},{15445688u,15445695u,12473u},{15445888u,15445888u,1970u},{15445889u,15445891u,12481u},
+{15445892u,15445892u,1971u},{15445893u,15445895u,12484u},{15445896u,15445896u,1972u},{15445897u,15445903u,12487u},
+{15445904u,15445904u,1973u},{15445905u,15445906u,12494u},{15445907u,15445907u,1974u},{15445908u,15445943u,12496u},
+{15445944u,15445945u,1975u},{15445946u,15445947u,12532u},{15445948u,15445948u,1977u},{15445949u,15445950u,12534u},
+{15445951u,15445951u,1978u},{15446144u,15446144u,1979u},{15446145u,15446145u,12536u},{15446146u,15446146u,1980u},
+{15446147u,15446151u,12537u},{15446152u,15446153u,1981u},{15446154u,15446154u,12542u},{15446155u,15446157u,1983u},
+{15446158u,15446158u,12543u},{15446159u,15446159u,1986u},{15446160u,15446160u,12544u},{15446161u,15446161u,1987u},
+{15446162u,15446163u,12545u},{15446164u,15446168u,1988u},{15446169u,15446170u,12547u},{15446171u,15446175u,1993u},
+{15446176u,15446179u,12549u},{15446180u,15446181u,1998u},{15446182u,15446182u,12553u},{15446183u,15446183u,2000u},
+{15446184u,15446184u,12554u},{15446185u,15446185u,2001u},{15446186u,15446188u,12555u},{15446189u,15446189u,2002u},
+{15446190u,15446191u,12558u},{15446192u,15446193u,2003u},{15446194u,15446195u,12560u},{15446196u,15446196u,2005u},
+{15446197u,15446199u,12562u},{15446200u,15446200u,2006u},{15446201u,15446207u,12565u},{15446400u,15446401u,2007u},
+{15446402u,15446402u,12572u},{15446403u,15446405u,2009u},{15446406u,15446408u,12573u},{15446409u,15446409u,2012u},
+{15446410u,15446411u,12576u},{15446412u,15446413u,2013u},{15446414u,15446415u,12578u},{15446416u,15446416u,2015u},
+{15446417u,15446428u,12580u},{15446429u,15446429u,2016u},{15446430u,15446463u,12592u},{15446656u,15446659u,12626u},
+{15446660u,15446661u,2017u},{15446662u,15446663u,12630u},{15446664u,15446664u,2019u},{15446665u,15446666u,12632u},
+{15446667u,15446668u,2020u},{15446669u,15446669u,12634u},{15446670u,15446670u,2022u},{15446671u,15446675u,12635u},
+{15446676u,15446677u,2023u},{15446678u,15446678u,12640u},{15446679u,15446679u,2025u},{15446680u,15446680u,12641u},
+{15446681u,15446682u,2026u},{15446683u,15446687u,12642u},{15446688u,15446689u,2028u},{15446690u,15446691u,12647u},
+{15446692u,15446692u,2030u},{15446693u,15446694u,12649u},{15446695u,15446696u,2031u},{15446697u,15446703u,12651u},
+{15446704u,15446705u,2033u},{15446706u,15446706u,12658u},{15446707u,15446709u,2035u},{15446710u,15446715u,12659u},
+{15446716u,15446717u,2038u},{15446718u,15446719u,12665u},{15446912u,15446912u,2040u},{15446913u,15446915u,12667u},
+{15446916u,15446916u,2041u},{15446917u,15446924u,12670u},{15446925u,15446925u,2042u},{15446926u,15446926u,12678u},
+{15446927u,15446929u,2043u},{15446930u,15446932u,12679u},{15446933u,15446933u,2046u},{15446934u,15446935u,12682u},
+{15446936u,15446936u,2047u},{15446937u,15446939u,12684u},{15446940u,15446940u,2048u},{15446941u,15446963u,12687u},
+{15446964u,15446966u,2049u},{15446967u,15446967u,12710u},{15446968u,15446968u,2052u},{15446969u,15446971u,12711u},
+{15446972u,15446972u,2053u},{15446973u,15446975u,12714u},{15447168u,15447171u,12717u},{15447172u,15447173u,2054u},
+{15447174u,15447174u,12721u},{15447175u,15447175u,2056u},{15447176u,15447176u,12722u},{15447177u,15447177u,2057u},
+{15447178u,15447183u,12723u},{15447184u,15447184u,2058u},{15447185u,15447187u,12729u},{15447188u,15447188u,2059u},
+{15447189u,15447203u,12732u},{15447204u,15447204u,2060u},{15447205u,15447211u,12747u},{15447212u,15447212u,2061u},
+{15447213u,15447231u,12754u},{15447424u,15447424u,2062u},{15447425u,15447431u,12773u},{15447432u,15447433u,2063u},
+{15447434u,15447435u,12780u},{15447436u,15447436u,2065u},{15447437u,15447439u,12782u},{15447440u,15447440u,2066u},
+{15447441u,15447447u,12785u},{15447448u,15447449u,2067u},{15447450u,15447459u,12792u},{15447460u,15447460u,2069u},
+{15447461u,15447463u,12802u},{15447464u,15447464u,2070u},{15447465u,15447487u,12805u},{15447680u,15447681u,2071u},
+{15447682u,15447683u,12828u},{15447684u,15447684u,2073u},{15447685u,15447686u,12830u},{15447687u,15447690u,2074u},
+{15447691u,15447695u,12832u},{15447696u,15447697u,2078u},{15447698u,15447698u,12837u},{15447699u,15447699u,2080u},
+{15447700u,15447700u,12838u},{15447701u,15447701u,2081u},{15447702u,15447704u,12839u},{15447705u,15447706u,2082u},
+{15447707u,15447707u,12842u},{15447708u,15447708u,2084u},{15447709u,15447715u,12843u},{15447716u,15447716u,2085u},
+{15447717u,15447727u,12850u},{15447728u,15447728u,2086u},{15447729u,15447735u,12861u},{15447736u,15447736u,2087u},
+{15447737u,15447743u,12868u},{15447936u,15447955u,12875u},{15447956u,15447957u,2088u},{15447958u,15447959u,12895u},
+{15447960u,15447960u,2090u},{15447961u,15447963u,12897u},{15447964u,15447964u,2091u},{15447965u,15447976u,12900u},
+{15447977u,15447977u,2092u},{15447978u,15447983u,12912u},{15447984u,15447984u,2093u},{15447985u,15447987u,12918u},
+{15447988u,15447988u,2094u},{15447989u,15447991u,12921u},{15447992u,15447992u,2095u},{15447993u,15447999u,12924u},
+{15448192u,15448192u,2096u},{15448193u,15448194u,12931u},{15448195u,15448195u,2097u},{15448196u,15448196u,12933u},
+{15448197u,15448197u,2098u},{15448198u,15448203u,12934u},{15448204u,15448205u,2099u},{15448206u,15448207u,12940u},
+{15448208u,15448208u,2101u},{15448209u,15448211u,12942u},{15448212u,15448212u,2102u},{15448213u,15448219u,12945u},
+{15448220u,15448221u,2103u},{15448222u,15448222u,12952u},{15448223u,15448223u,2105u},{15448224u,15448255u,12953u},
+{15448448u,15448451u,12985u},{15448452u,15448453u,2106u},{15448454u,15448455u,12989u},{15448456u,15448456u,2108u},
+{15448457u,15448459u,12991u},{15448460u,15448460u,2109u},{15448461u,15448461u,12994u},{15448462u,15448462u,2110u},
+{15448463u,15448467u,12995u},{15448468u,15448469u,2111u},{15448470u,15448470u,13000u},{15448471u,15448471u,2113u},
+{15448472u,15448472u,13001u},{15448473u,15448475u,2114u},{15448476u,15448479u,13002u},{15448480u,15448481u,2117u},
+{15448482u,15448483u,13006u},{15448484u,15448484u,2119u},{15448485u,15448487u,13008u},{15448488u,15448488u,2120u},
+{15448489u,15448489u,13011u},{15448490u,15448490u,2121u},{15448491u,15448495u,13012u},{15448496u,15448497u,2122u},
+{15448498u,15448498u,13017u},{15448499u,15448501u,2124u},{15448502u,15448506u,13018u},{15448507u,15448509u,2127u},
+{15448510u,15448511u,13023u},{15448704u,15448704u,2130u},{15448705u,15448707u,13025u},{15448708u,15448708u,2131u},
+{15448709u,15448715u,13028u},{15448716u,15448717u,2132u},{15448718u,15448718u,13035u},{15448719u,15448721u,2134u},
+{15448722u,15448727u,13036u},{15448728u,15448729u,2137u},{15448730u,15448743u,13042u},{15448744u,15448744u,2139u},
+{15448745u,15448767u,13056u},{15448960u,15448975u,13079u},{15448976u,15448977u,2140u},{15448978u,15448979u,13095u},
+{15448980u,15448980u,2142u},{15448981u,15448982u,13097u},{15448983u,15448984u,2143u},{15448985u,15448991u,13099u},
+{15448992u,15448992u,2145u},{15448993u,15448994u,13106u},{15448995u,15448997u,2146u},{15448998u,15449003u,13108u},
+{15449004u,15449004u,2149u},{15449005u,15449023u,13114u},{15449216u,15449216u,13133u},{15449217u,15449217u,2150u},
+{15449218u,15449223u,13134u},{15449224u,15449225u,2151u},{15449226u,15449239u,13140u},{15449240u,15449241u,2153u},
+{15449242u,15449242u,13154u},{15449243u,15449245u,2155u},{15449246u,15449279u,13155u},{15449472u,15449473u,2158u},
+{15449474u,15449475u,13189u},{15449476u,15449476u,2160u},{15449477u,15449479u,13191u},{15449480u,15449480u,2161u},
+{15449481u,15449487u,13194u},{15449488u,15449489u,2162u},{15449490u,15449492u,13201u},{15449493u,15449493u,2164u},
+{15449494u,15449535u,13204u},{15449728u,15449747u,13246u},{15449748u,15449748u,2165u},{15449749u,15449775u,13266u},
+{15449776u,15449776u,2166u},{15449777u,15449791u,13293u},{15449984u,15449988u,13308u},{15449989u,15449989u,2167u},
+{15449990u,15449995u,13313u},{15449996u,15449997u,2168u},{15449998u,15449999u,13319u},{15450000u,15450000u,2170u},
+{15450001u,15450003u,13321u},{15450004u,15450004u,2171u},{15450005u,15450011u,13324u},{15450012u,15450012u,2172u},
+{15450013u,15450014u,13331u},{15450015u,15450015u,2173u},{15450016u,15450016u,13333u},{15450017u,15450017u,2174u},
+{15450018u,15450047u,13334u},{15499392u,15499451u,13364u},{15499452u,15499452u,2175u},{15499453u,15499455u,13424u},
+{15499648u,15499664u,13427u},{15499665u,15499665u,2176u},{15499666u,15499671u,13444u},{15499672u,15499672u,2177u},
+{15499673u,15499675u,13450u},{15499676u,15499676u,2178u},{15499677u,15499679u,13453u},{15499680u,15499680u,2179u},
+{15499681u,15499687u,13456u},{15499688u,15499689u,2180u},{15499690u,15499711u,13463u},{15499904u,15499919u,13485u},
+{15499920u,15499921u,2182u},{15499922u,15499923u,13501u},{15499924u,15499924u,2184u},{15499925u,15499927u,13503u},
+{15499928u,15499928u,2185u},{15499929u,15499935u,13506u},{15499936u,15499937u,2186u},{15499938u,15499938u,13513u},
+{15499939u,15499939u,2188u},{15499940u,15499940u,13514u},{15499941u,15499941u,2189u},{15499942u,15499947u,13515u},
+{15499948u,15499949u,2190u},{15499950u,15499950u,13521u},{15499951u,15499952u,2192u},{15499953u,15499954u,13522u},
+{15499955u,15499958u,2194u},{15499959u,15499963u,13524u},{15499964u,15499965u,2198u},{15499966u,15499966u,13529u},
+{15499967u,15499967u,2200u},{15500160u,15500161u,2201u},{15500162u,15500164u,13530u},{15500165u,15500165u,2203u},
+{15500166u,15500167u,13533u},{15500168u,15500169u,2204u},{15500170u,15500171u,13535u},{15500172u,15500172u,2206u},
+{15500173u,15500175u,13537u},{15500176u,15500176u,2207u},{15500177u,15500183u,13540u},{15500184u,15500185u,2208u},
+{15500186u,15500186u,13547u},{15500187u,15500189u,2210u},{15500190u,15500195u,13548u},{15500196u,15500197u,2213u},
+{15500198u,15500199u,13554u},{15500200u,15500200u,2215u},{15500201u,15500203u,13556u},{15500204u,15500204u,2216u},
+{15500205u,15500211u,13559u},{15500212u,15500213u,2217u},{15500214u,15500214u,13566u},{15500215u,15500215u,2219u},
+{15500216u,15500216u,13567u},{15500217u,15500217u,2220u},{15500218u,15500223u,13568u},{15500416u,15500416u,2221u},
+{15500417u,15500419u,13574u},{15500420u,15500420u,2222u},{15500421u,15500423u,13577u},{15500424u,15500424u,2223u},
+{15500425u,15500431u,13580u},{15500432u,15500432u,2224u},{15500433u,15500436u,13587u},{15500437u,15500437u,2225u},
+{15500438u,15500443u,13591u},{15500444u,15500448u,2226u},{15500449u,15500450u,13597u},{15500451u,15500452u,2231u},
+{15500453u,15500453u,13599u},{15500454u,15500455u,2233u},{15500456u,15500459u,13600u},{15500460u,15500461u,2235u},
+{15500462u,15500462u,13604u},{15500463u,15500465u,2237u},{15500466u,15500469u,13605u},{15500470u,15500470u,2240u},
+{15500471u,15500471u,13609u},{15500472u,15500473u,2241u},{15500474u,15500475u,13610u},{15500476u,15500476u,2243u},
+{15500477u,15500479u,13612u},{15500672u,15500672u,2244u},{15500673u,15500679u,13615u},{15500680u,15500681u,2245u},
+{15500682u,15500682u,13622u},{15500683u,15500685u,2247u},{15500686u,15500691u,13623u},{15500692u,15500693u,2250u},
+{15500694u,15500695u,13629u},{15500696u,15500696u,2252u},{15500697u,15500699u,13631u},{15500700u,15500700u,2253u},
+{15500701u,15500707u,13634u},{15500708u,15500709u,2254u},{15500710u,15500710u,13641u},{15500711u,15500713u,2256u},
+{15500714u,15500719u,13642u},{15500720u,15500720u,2259u},{15500721u,15500723u,13648u},{15500724u,15500724u,2260u},
+{15500725u,15500727u,13651u},{15500728u,15500728u,2261u},{15500729u,15500735u,13654u},{15500928u,15500932u,13661u},
+{15500933u,15500933u,2262u},{15500934u,15500939u,13666u},{15500940u,15500942u,2263u},{15500943u,15500943u,13672u},
+{15500944u,15500944u,2266u},{15500945u,15500947u,13673u},{15500948u,15500948u,2267u},{15500949u,15500949u,13676u},
+{15500950u,15500950u,2268u},{15500951u,15500955u,13677u},{15500956u,15500957u,2269u},{15500958u,15500958u,13682u},
+{15500959u,15500959u,2271u},{15500960u,15500960u,13683u},{15500961u,15500961u,2272u},{15500962u,15500964u,13684u},
+{15500965u,15500965u,2273u},{15500966u,15500967u,13687u},{15500968u,15500969u,2274u},{15500970u,15500971u,13689u},
+{15500972u,15500972u,2276u},{15500973u,15500975u,13691u},{15500976u,15500976u,2277u},{15500977u,15500988u,13694u},
+{15500989u,15500989u,2278u},{15500990u,15500991u,13706u},{15501184u,15501187u,13708u},{15501188u,15501188u,2279u},
+{15501189u,15501191u,13712u},{15501192u,15501192u,2280u},{15501193u,15501195u,13715u},{15501196u,15501196u,2281u},
+{15501197u,15501203u,13718u},{15501204u,15501204u,2282u},{15501205u,15501206u,13725u},{15501207u,15501208u,2283u},
+{15501209u,15501215u,13727u},{15501216u,15501216u,2285u},{15501217u,15501219u,13734u},{15501220u,15501220u,2286u},
+{15501221u,15501223u,13737u},{15501224u,15501224u,2287u},{15501225u,15501231u,13740u},{15501232u,15501233u,2288u},
+{15501234u,15501234u,13747u},{15501235u,15501235u,2290u},{15501236u,15501243u,13748u},{15501244u,15501245u,2291u},
+{15501246u,15501247u,13756u},{15501440u,15501440u,2293u},{15501441u,15501443u,13758u},{15501444u,15501444u,2294u},
+{15501445u,15501451u,13761u},{15501452u,15501453u,2295u},{15501454u,15501454u,13768u},{15501455u,15501455u,2297u},
+{15501456u,15501456u,13769u},{15501457u,15501457u,2298u},{15501458u,15501463u,13770u},{15501464u,15501465u,2299u},
+{15501466u,15501467u,13776u},{15501468u,15501468u,2301u},{15501469u,15501470u,13778u},{15501471u,15501472u,2302u},
+{15501473u,15501479u,13780u},{15501480u,15501481u,2304u},{15501482u,15501482u,13787u},{15501483u,15501483u,2306u},
+{15501484u,15501484u,13788u},{15501485u,15501485u,2307u},{15501486u,15501486u,13789u},{15501487u,15501487u,2308u},
+{15501488u,15501488u,13790u},{15501489u,15501490u,2309u},{15501491u,15501491u,13791u},{15501492u,15501492u,2311u},
+{15501493u,15501503u,13792u},{15501696u,15501703u,13803u},{15501704u,15501704u,2312u},{15501705u,15501711u,13811u},
+{15501712u,15501713u,2313u},{15501714u,15501715u,13818u},{15501716u,15501716u,2315u},{15501717u,15501719u,13820u},
+{15501720u,15501720u,2316u},{15501721u,15501727u,13823u},{15501728u,15501728u,2317u},{15501729u,15501732u,13830u},
+{15501733u,15501733u,2318u},{15501734u,15501739u,13834u},{15501740u,15501741u,2319u},{15501742u,15501743u,13840u},
+{15501744u,15501744u,2321u},{15501745u,15501747u,13842u},{15501748u,15501748u,2322u},{15501749u,15501755u,13845u},
+{15501756u,15501757u,2323u},{15501758u,15501758u,13852u},{15501759u,15501759u,2325u},{15501952u,15501952u,13853u},
+{15501953u,15501953u,2326u},{15501954u,15501959u,13854u},{15501960u,15501961u,2327u},{15501962u,15501967u,13860u},
+{15501968u,15501968u,2329u},{15501969u,15501975u,13866u},{15501976u,15501976u,2330u},{15501977u,15501978u,13873u},
+{15501979u,15501979u,2331u},{15501980u,15501980u,13875u},{15501981u,15501981u,2332u},{15501982u,15501987u,13876u},
+{15501988u,15501989u,2333u},{15501990u,15501991u,13882u},{15501992u,15501992u,2335u},{15501993u,15501995u,13884u},
+{15501996u,15501997u,2336u},{15501998u,15502003u,13887u},{15502004u,15502005u,2338u},{15502006u,15502006u,13893u},
+{15502007u,15502007u,2340u},{15502008u,15502008u,13894u},{15502009u,15502009u,2341u},{15502010u,15502015u,13895u},
+{15502208u,15502235u,13901u},{15502236u,15502237u,2342u},{15502238u,15502239u,13929u},{15502240u,15502240u,2344u},
+{15502241u,15502242u,13931u},{15502243u,15502244u,2345u},{15502245u,15502250u,13933u},{15502251u,15502253u,2347u},
+{15502254u,15502254u,13939u},{15502255u,15502255u,2350u},{15502256u,15502256u,13940u},{15502257u,15502257u,2351u},
+{15502258u,15502261u,13941u},{15502262u,15502262u,2352u},{15502263u,15502263u,13945u},{15502264u,15502265u,2353u},
+{15502266u,15502266u,13946u},{15502267u,15502268u,2355u},{15502269u,15502271u,13947u},{15502464u,15502464u,2357u},
+{15502465u,15502471u,13950u},{15502472u,15502473u,2358u},{15502474u,15502475u,13957u},{15502476u,15502477u,2360u},
+{15502478u,15502482u,13959u},{15502483u,15502485u,2362u},{15502486u,15502487u,13964u},{15502488u,15502488u,2365u},
+{15502489u,15502491u,13966u},{15502492u,15502492u,2366u},{15502493u,15502499u,13969u},{15502500u,15502501u,2367u},
+{15502502u,15502503u,13976u},{15502504u,15502505u,2369u},{15502506u,15502527u,13978u},{15502720u,15502724u,14000u},
+{15502725u,15502725u,2371u},{15502726u,15502759u,14005u},{15502760u,15502761u,2372u},{15502762u,15502763u,14039u},
+{15502764u,15502764u,2374u},{15502765u,15502767u,14041u},{15502768u,15502768u,2375u},{15502769u,15502769u,14044u},
+{15502770u,15502770u,2376u},{15502771u,15502775u,14045u},{15502776u,15502777u,2377u},{15502778u,15502779u,14050u},
+{15502780u,15502781u,2379u},{15502782u,15502783u,14052u},{15502976u,15502979u,14054u},{15502980u,15502980u,2381u},
+{15502981u,15502983u,14058u},{15502984u,15502984u,2382u},{15502985u,15502987u,14061u},{15502988u,15502988u,2383u},
+{15502989u,15503039u,14064u},{15503232u,15503232u,2384u},{15503233u,15503255u,14115u},{15503256u,15503257u,2385u},
+{15503258u,15503259u,14138u},{15503260u,15503260u,2387u},{15503261u,15503262u,14140u},{15503263u,15503264u,2388u},
+{15503265u,15503265u,14142u},{15503266u,15503266u,2390u},{15503267u,15503271u,14143u},{15503272u,15503273u,2391u},
+{15503274u,15503276u,14148u},{15503277u,15503277u,2393u},{15503278u,15503283u,14151u},{15503284u,15503285u,2394u},
+{15503286u,15503287u,14157u},{15503288u,15503288u,2396u},{15503289u,15503295u,14159u},{15503488u,15503495u,14166u},
+{15503496u,15503496u,2397u},{15503497u,15503503u,14174u},{15503504u,15503504u,2398u},{15503505u,15503523u,14181u},
+{15503524u,15503524u,2399u},{15503525u,15503531u,14200u},{15503532u,15503532u,2400u},{15503533u,15503535u,14207u},
+{15503536u,15503536u,2401u},{15503537u,15503539u,14210u},{15503540u,15503540u,2402u},{15503541u,15503547u,14213u},
+{15503548u,15503549u,2403u},{15503550u,15503551u,14220u},{15503744u,15503751u,14222u},{15503752u,15503752u,2405u},
+{15503753u,15503779u,14230u},{15503780u,15503781u,2406u},{15503782u,15503783u,14257u},{15503784u,15503784u,2408u},
+{15503785u,15503787u,14259u},{15503788u,15503788u,2409u},{15503789u,15503795u,14262u},{15503796u,15503797u,2410u},
+{15503798u,15503800u,14269u},{15503801u,15503801u,2412u},{15503802u,15503807u,14272u},{15504000u,15504000u,2413u},
+{15504001u,15504019u,14278u},{15504020u,15504020u,2414u},{15504021u,15504027u,14297u},{15504028u,15504028u,2415u},
+{15504029u,15504055u,14304u},{15504056u,15504056u,2416u},{15504057u,15504059u,14331u},{15504060u,15504060u,2417u},
+{15504061u,15504063u,14334u},{15504256u,15504296u,14337u},{15504297u,15504297u,2418u},{15504298u,15504303u,14378u},
+{15504304u,15504305u,2419u},{15504306u,15504307u,14384u},{15504308u,15504308u,2421u},{15504309u,15504311u,14386u},
+{15504312u,15504312u,2422u},{15504313u,15504313u,14389u},{15504314u,15504314u,2423u},{15504315u,15504318u,14390u},
+{15504319u,15504319u,2424u},{15504512u,15504513u,2425u},{15504514u,15504523u,14394u},{15504524u,15504524u,2427u},
+{15504525u,15504527u,14404u},{15504528u,15504528u,2428u},{15504529u,15504531u,14407u},{15504532u,15504532u,2429u},
+{15504533u,15504539u,14410u},{15504540u,15504540u,2430u},{15504541u,15504551u,14417u},{15504552u,15504553u,2431u},
+{15504554u,15504555u,14428u},{15504556u,15504556u,2433u},{15504557u,15504559u,14430u},{15504560u,15504560u,2434u},
+{15504561u,15504567u,14433u},{15504568u,15504569u,2435u},{15504570u,15504570u,14440u},{15504571u,15504571u,2437u},
+{15504572u,15504572u,14441u},{15504573u,15504573u,2438u},{15504574u,15504575u,14442u},{15504768u,15504771u,14444u},
+{15504772u,15504773u,2439u},{15504774u,15504775u,14448u},{15504776u,15504778u,2441u},{15504779u,15504779u,14450u},
+{15504780u,15504782u,2444u},{15504783u,15504786u,14451u},{15504787u,15504789u,2447u},{15504790u,15504790u,14455u},
+{15504791u,15504793u,2450u},{15504794u,15504796u,14456u},{15504797u,15504798u,2453u},{15504799u,15504799u,14459u},
+{15504800u,15504801u,2455u},{15504802u,15504803u,14460u},{15504804u,15504804u,2457u},{15504805u,15504807u,14462u},
+{15504808u,15504808u,2458u},{15504809u,15504815u,14465u},{15504816u,15504817u,2459u},{15504818u,15504818u,14472u},
+{15504819u,15504821u,2461u},{15504822u,15504827u,14473u},{15504828u,15504829u,2464u},{15504830u,15504831u,14479u},
+{15505024u,15505024u,2466u},{15505025u,15505027u,14481u},{15505028u,15505028u,2467u},{15505029u,15505030u,14484u},
+{15505031u,15505031u,2468u},{15505032u,15505035u,14486u},{15505036u,15505037u,2469u},{15505038u,15505038u,14490u},
+{15505039u,15505039u,2471u},{15505040u,15505040u,14491u},{15505041u,15505041u,2472u},{15505042u,15505044u,14492u},
+{15505045u,15505045u,2473u},{15505046u,15505046u,14495u},{15505047u,15505048u,2474u},{15505049u,15505051u,14496u},
+{15505052u,15505052u,2476u},{15505053u,15505055u,14499u},{15505056u,15505056u,2477u},{15505057u,15505064u,14502u},
+{15505065u,15505065u,2478u},{15505066u,15505075u,14510u},{15505076u,15505077u,2479u},{15505078u,15505079u,14520u},
+{15505080u,15505081u,2481u},{15505082u,15505082u,14522u},{15505083u,15505086u,2483u},{15505087u,15505087u,14523u},
+{15505280u,15505283u,14524u},{15505284u,15505290u,2487u},{15505291u,15505291u,14528u},{15505292u,15505292u,2494u},
+{15505293u,15505293u,14529u},{15505294u,15505294u,2495u},{15505295u,15505295u,14530u},{15505296u,15505297u,2496u},
+{15505298u,15505299u,14531u},{15505300u,15505300u,2498u},{15505301u,15505303u,14533u},{15505304u,15505304u,2499u},
+{15505305u,15505311u,14536u},{15505312u,15505313u,2500u},{15505314u,15505314u,14543u},{15505315u,15505315u,2502u},
+{15505316u,15505316u,14544u},{15505317u,15505317u,2503u},{15505318u,15505323u,14545u},{15505324u,15505326u,2504u},
+{15505327u,15505327u,14551u},{15505328u,15505328u,2507u},{15505329u,15505331u,14552u},{15505332u,15505332u,2508u},
+{15505333u,15505333u,14555u},{15505334u,15505335u,2509u},{15505336u,15505339u,14556u},{15505340u,15505343u,2511u},
+{15505536u,15505537u,2515u},{15505538u,15505540u,14560u},{15505541u,15505544u,2517u},{15505545u,15505547u,14563u},
+{15505548u,15505548u,2521u},{15505549u,15505551u,14566u},{15505552u,15505552u,2522u},{15505553u,15505559u,14569u},
+{15505560u,15505561u,2523u},{15505562u,15505562u,14576u},{15505563u,15505564u,2525u},{15505565u,15505571u,14577u},
+{15505572u,15505573u,2527u},{15505574u,15505575u,14584u},{15505576u,15505576u,2529u},{15505577u,15505579u,14586u},
+{15505580u,15505582u,2530u},{15505583u,15505583u,14589u},{15505584u,15505584u,2533u},{15505585u,15505586u,14590u},
+{15505587u,15505589u,2534u},{15505590u,15505590u,14592u},{15505591u,15505591u,2537u},{15505592u,15505592u,14593u},
+{15505593u,15505593u,2538u},{15505594u,15505594u,14594u},{15505595u,15505595u,2539u},{15505596u,15505599u,14595u},
+{15505792u,15505793u,2540u},{15505794u,15505795u,14599u},{15505796u,15505796u,2542u},{15505797u,15505799u,14601u},
+{15505800u,15505800u,2543u},{15505801u,15505807u,14604u},{15505808u,15505809u,2544u},{15505810u,15505810u,14611u},
+{15505811u,15505813u,2546u},{15505814u,15505819u,14612u},{15505820u,15505821u,2549u},{15505822u,15505823u,14618u},
+{15505824u,15505824u,2551u},{15505825u,15505835u,14620u},{15505836u,15505836u,2552u},{15505837u,15505838u,14631u},
+{15505839u,15505839u,2553u},{15505840u,15505840u,14633u},{15505841u,15505841u,2554u},{15505842u,15505847u,14634u},
+{15505848u,15505849u,2555u},{15505850u,15505851u,14640u},{15505852u,15505852u,2557u},{15505853u,15505855u,14642u},
+{15506048u,15506048u,2558u},{15506049u,15506055u,14645u},{15506056u,15506057u,2559u},{15506058u,15506058u,14652u},
+{15506059u,15506059u,2561u},{15506060u,15506060u,14653u},{15506061u,15506061u,2562u},{15506062u,15506067u,14654u},
+{15506068u,15506069u,2563u},{15506070u,15506071u,14660u},{15506072u,15506072u,2565u},{15506073u,15506075u,14662u},
+{15506076u,15506076u,2566u},{15506077u,15506083u,14665u},{15506084u,15506085u,2567u},{15506086u,15506086u,14672u},
+{15506087u,15506087u,2569u},{15506088u,15506088u,14673u},{15506089u,15506089u,2570u},{15506090u,15506095u,14674u},
+{15506096u,15506097u,2571u},{15506098u,15506099u,14680u},{15506100u,15506100u,2573u},{15506101u,15506103u,14682u},
+{15506104u,15506106u,2574u},{15506107u,15506111u,14685u},{15506304u,15506305u,2577u},{15506306u,15506306u,14690u},
+{15506307u,15506307u,2579u},{15506308u,15506308u,14691u},{15506309u,15506309u,2580u},{15506310u,15506315u,14692u},
+{15506316u,15506317u,2581u},{15506318u,15506319u,14698u},{15506320u,15506320u,2583u},{15506321u,15506323u,14700u},
+{15506324u,15506324u,2584u},{15506325u,15506331u,14703u},{15506332u,15506333u,2585u},{15506334u,15506335u,14710u},
+{15506336u,15506337u,2587u},{15506338u,15506343u,14712u},{15506344u,15506345u,2589u},{15506346u,15506347u,14718u},
+{15506348u,15506348u,2591u},{15506349u,15506351u,14720u},{15506352u,15506352u,2592u},{15506353u,15506359u,14723u},
+{15506360u,15506361u,2593u},{15506362u,15506364u,14730u},{15506365u,15506365u,2595u},{15506366u,15506367u,14733u},
+{15506560u,15506563u,14735u},{15506564u,15506565u,2596u},{15506566u,15506567u,14739u},{15506568u,15506568u,2598u},
+{15506569u,15506571u,14741u},{15506572u,15506572u,2599u},{15506573u,15506579u,14744u},{15506580u,15506581u,2600u},
+{15506582u,15506582u,14751u},{15506583u,15506583u,2602u},{15506584u,15506584u,14752u},{15506585u,15506585u,2603u},
+{15506586u,15506591u,14753u},{15506592u,15506593u,2604u},{15506594u,15506595u,14759u},{15506596u,15506596u,2606u},
+{15506597u,15506599u,14761u},{15506600u,15506600u,2607u},{15506601u,15506607u,14764u},{15506608u,15506609u,2608u},
+{15506610u,15506610u,14771u},{15506611u,15506611u,2610u},{15506612u,15506612u,14772u},{15506613u,15506613u,2611u},
+{15506614u,15506614u,14773u},{15506615u,15506615u,2612u},{15506616u,15506619u,14774u},{15506620u,15506621u,2613u},
+{15506622u,15506623u,14778u},{15506816u,15506816u,2615u},{15506817u,15506819u,14780u},{15506820u,15506820u,2616u},
+{15506821u,15506825u,14783u},{15506826u,15506826u,2617u},{15506827u,15506827u,14788u},{15506828u,15506829u,2618u},
+{15506830u,15506830u,14789u},{15506831u,15506831u,2620u},{15506832u,15506832u,14790u},{15506833u,15506840u,2621u},
+{15506841u,15506843u,14791u},{15506844u,15506844u,2629u},{15506845u,15506847u,14794u},{15506848u,15506848u,2630u},
+{15506849u,15506855u,14797u},{15506856u,15506856u,2631u},{15506857u,15506858u,14804u},{15506859u,15506859u,2632u},
+{15506860u,15506867u,14806u},{15506868u,15506869u,2633u},{15506870u,15506871u,14814u},{15506872u,15506872u,2635u},
+{15506873u,15506875u,14816u},{15506876u,15506878u,2636u},{15506879u,15506879u,14819u},{15507072u,15507074u,14820u},
+{15507075u,15507077u,2639u},{15507078u,15507078u,14823u},{15507079u,15507082u,2642u},{15507083u,15507085u,14824u},
+{15507086u,15507086u,2646u},{15507087u,15507087u,14827u},{15507088u,15507089u,2647u},{15507090u,15507091u,14828u},
+{15507092u,15507092u,2649u},{15507093u,15507093u,14830u},{15507094u,15507096u,2650u},{15507097u,15507097u,14831u},
+{15507098u,15507098u,2653u},{15507099u,15507103u,14832u},{15507104u,15507105u,2654u},{15507106u,15507106u,14837u},
+{15507107u,15507110u,2656u},{15507111u,15507115u,14838u},{15507116u,15507117u,2660u},{15507118u,15507119u,14843u},
+{15507120u,15507120u,2662u},{15507121u,15507123u,14845u},{15507124u,15507124u,2663u},{15507125u,15507131u,14848u},
+{15507132u,15507133u,2664u},{15507134u,15507134u,14855u},{15507135u,15507135u,2666u},{15507328u,15507329u,2667u},
+{15507330u,15507335u,14856u},{15507336u,15507337u,2669u},{15507338u,15507339u,14862u},{15507340u,15507340u,2671u},
+{15507341u,15507341u,14864u},{15507342u,15507342u,2672u},{15507343u,15507343u,14865u},{15507344u,15507344u,2673u},
+{15507345u,15507351u,14866u},{15507352u,15507352u,2674u},{15507353u,15507356u,14873u},{15507357u,15507357u,2675u},
+{15507358u,15507363u,14877u},{15507364u,15507364u,2676u},{15507365u,15507367u,14883u},{15507368u,15507368u,2677u},
+{15507369u,15507371u,14886u},{15507372u,15507372u,2678u},{15507373u,15507391u,14889u},{15507584u,15507585u,2679u},
+{15507586u,15507587u,14908u},{15507588u,15507588u,2681u},{15507589u,15507591u,14910u},{15507592u,15507592u,2682u},
+{15507593u,15507593u,14913u},{15507594u,15507594u,2683u},{15507595u,15507599u,14914u},{15507600u,15507601u,2684u},
+{15507602u,15507602u,14919u},{15507603u,15507603u,2686u},{15507604u,15507604u,14920u},{15507605u,15507606u,2687u},
+{15507607u,15507611u,14921u},{15507612u,15507613u,2689u},{15507614u,15507615u,14926u},{15507616u,15507616u,2691u},
+{15507617u,15507619u,14928u},{15507620u,15507620u,2692u},{15507621u,15507627u,14931u},{15507628u,15507629u,2693u},
+{15507630u,15507630u,14938u},{15507631u,15507631u,2695u},{15507632u,15507632u,14939u},{15507633u,15507633u,2696u},
+{15507634u,15507639u,14940u},{15507640u,15507640u,2697u},{15507641u,15507643u,14946u},{15507644u,15507644u,2698u},
+{15507645u,15507647u,14949u},{15507840u,15507840u,2699u},{15507841u,15507847u,14952u},{15507848u,15507849u,2700u},
+{15507850u,15507851u,14959u},{15507852u,15507853u,2702u},{15507854u,15507859u,14961u},{15507860u,15507860u,2704u},
+{15507861u,15507887u,14967u},{15507888u,15507889u,2705u},{15507890u,15507891u,14994u},{15507892u,15507892u,2707u},
+{15507893u,15507895u,14996u},{15507896u,15507896u,2708u},{15507897u,15507897u,14999u},{15507898u,15507898u,2709u},
+{15507899u,15507903u,15000u},{15508096u,15508097u,2710u},{15508098u,15508098u,15005u},{15508099u,15508099u,2712u},
+{15508100u,15508100u,15006u},{15508101u,15508103u,2713u},{15508104u,15508106u,15007u},{15508107u,15508109u,2716u},
+{15508110u,15508115u,15010u},{15508116u,15508116u,2719u},{15508117u,15508124u,15016u},{15508125u,15508125u,2720u},
+{15508126u,15508126u,15024u},{15508127u,15508127u,2721u},{15508128u,15508128u,15025u},{15508129u,15508129u,2722u},
+{15508130u,15508135u,15026u},{15508136u,15508136u,2723u},{15508137u,15508155u,15032u},{15508156u,15508157u,2724u},
+{15508158u,15508159u,15051u},{15508352u,15508355u,15053u},{15508356u,15508356u,2726u},{15508357u,15508359u,15057u},
+{15508360u,15508360u,2727u},{15508361u,15508363u,15060u},{15508364u,15508364u,2728u},{15508365u,15508371u,15063u},
+{15508372u,15508373u,2729u},{15508374u,15508374u,15070u},{15508375u,15508375u,2731u},{15508376u,15508376u,15071u},
+{15508377u,15508377u,2732u},{15508378u,15508383u,15072u},{15508384u,15508385u,2733u},{15508386u,15508387u,15078u},
+{15508388u,15508388u,2735u},{15508389u,15508404u,15080u},{15508405u,15508405u,2736u},{15508406u,15508411u,15096u},
+{15508412u,15508413u,2737u},{15508414u,15508415u,15102u},{15508608u,15508608u,2739u},{15508609u,15508611u,15104u},
+{15508612u,15508614u,2740u},{15508615u,15508619u,15107u},{15508620u,15508621u,2743u},{15508622u,15508622u,15112u},
+{15508623u,15508623u,2745u},{15508624u,15508624u,15113u},{15508625u,15508625u,2746u},{15508626u,15508631u,15114u},
+{15508632u,15508632u,2747u},{15508633u,15508651u,15120u},{15508652u,15508652u,2748u},{15508653u,15508659u,15139u},
+{15508660u,15508660u,2749u},{15508661u,15508671u,15146u},{15508864u,15508879u,15157u},{15508880u,15508881u,2750u},
+{15508882u,15508883u,15173u},{15508884u,15508884u,2752u},{15508885u,15508887u,15175u},{15508888u,15508888u,2753u},
+{15508889u,15508895u,15178u},{15508896u,15508897u,2754u},{15508898u,15508898u,15185u},{15508899u,15508899u,2756u},
+{15508900u,15508907u,15186u},{15508908u,15508908u,2757u},{15508909u,15508911u,15194u},{15508912u,15508912u,2758u},
+{15508913u,15508915u,15197u},{15508916u,15508916u,2759u},{15508917u,15508923u,15200u},{15508924u,15508924u,2760u},
+{15508925u,15508927u,15207u},{15509120u,15509127u,15210u},{15509128u,15509129u,2761u},{15509130u,15509131u,15218u},
+{15509132u,15509132u,2763u},{15509133u,15509135u,15220u},{15509136u,15509136u,2764u},{15509137u,15509143u,15223u},
+{15509144u,15509145u,2765u},{15509146u,15509146u,15230u},{15509147u,15509147u,2767u},{15509148u,15509148u,15231u},
+{15509149u,15509149u,2768u},{15509150u,15509183u,15232u},{15509376u,15509377u,2769u},{15509378u,15509379u,15266u},
+{15509380u,15509380u,2771u},{15509381u,15509382u,15268u},{15509383u,15509384u,2772u},{15509385u,15509385u,15270u},
+{15509386u,15509386u,2774u},{15509387u,15509391u,15271u},{15509392u,15509393u,2775u},{15509394u,15509394u,15276u},
+{15509395u,15509395u,2777u},{15509396u,15509396u,15277u},{15509397u,15509398u,2778u},{15509399u,15509400u,15278u},
+{15509401u,15509402u,2780u},{15509403u,15509403u,15280u},{15509404u,15509405u,2782u},{15509406u,15509407u,15281u},
+{15509408u,15509408u,2784u},{15509409u,15509409u,15283u},{15509410u,15509410u,2785u},{15509411u,15509411u,15284u},
+{15509412u,15509412u,2786u},{15509413u,15509414u,15285u},{15509415u,15509415u,2787u},{15509416u,15509419u,15287u},
+{15509420u,15509421u,2788u},{15509422u,15509422u,15291u},{15509423u,15509425u,2790u},{15509426u,15509431u,15292u},
+{15509432u,15509433u,2793u},{15509434u,15509435u,15298u},{15509436u,15509436u,2795u},{15509437u,15509439u,15300u},
+{15509632u,15509632u,2796u},{15509633u,15509639u,15303u},{15509640u,15509641u,2797u},{15509642u,15509642u,15310u},
+{15509643u,15509645u,2799u},{15509646u,15509651u,15311u},{15509652u,15509652u,2802u},{15509653u,15509655u,15317u},
+{15509656u,15509656u,2803u},{15509657u,15509672u,15320u},{15509673u,15509673u,2804u},{15509674u,15509695u,15336u},
+{15509888u,15509899u,15358u},{15509900u,15509901u,2805u},{15509902u,15509903u,15370u},{15509904u,15509904u,2807u},
+{15509905u,15509907u,15372u},{15509908u,15509908u,2808u},{15509909u,15509915u,15375u},{15509916u,15509917u,2809u},
+{15509918u,15509918u,15382u},{15509919u,15509921u,2811u},{15509922u,15509927u,15383u},{15509928u,15509928u,2814u},
+{15509929u,15509948u,15389u},{15509949u,15509949u,2815u},{15509950u,15509951u,15409u},{15510144u,15510147u,15411u},
+{15510148u,15510148u,2816u},{15510149u,15510167u,15415u},{15510168u,15510168u,2817u},{15510169u,15510203u,15434u},
+{15510204u,15510205u,2818u},{15510206u,15510207u,15469u},{15510400u,15510400u,2820u},{15510401u,15510403u,15471u},
+{15510404u,15510404u,2821u},{15510405u,15510411u,15474u},{15510412u,15510413u,2822u},{15510414u,15510414u,15481u},
+{15510415u,15510415u,2824u},{15510416u,15510416u,15482u},{15510417u,15510417u,2825u},{15510418u,15510418u,15483u},
+{15510419u,15510419u,2826u},{15510420u,15510423u,15484u},{15510424u,15510425u,2827u},{15510426u,15510431u,15488u},
+{15510432u,15510432u,2829u},{15510433u,15510443u,15494u},{15510444u,15510444u,2830u},{15510445u,15510451u,15505u},
+{15510452u,15510452u,2831u},{15510453u,15510463u,15512u},{15510656u,15510663u,15523u},{15510664u,15510664u,2832u},
+{15510665u,15510671u,15531u},{15510672u,15510672u,2833u},{15510673u,15510675u,15538u},{15510676u,15510676u,2834u},
+{15510677u,15510679u,15541u},{15510680u,15510680u,2835u},{15510681u,15510687u,15544u},{15510688u,15510689u,2836u},
+{15510690u,15510719u,15551u},{15510912u,15510912u,15581u},{15510913u,15510913u,2838u},{15510914u,15510919u,15582u},
+{15510920u,15510921u,2839u},{15510922u,15510923u,15588u},{15510924u,15510924u,2841u},{15510925u,15510927u,15590u},
+{15510928u,15510928u,2842u},{15510929u,15510935u,15593u},{15510936u,15510937u,2843u},{15510938u,15510940u,15600u},
+{15510941u,15510941u,2845u},{15510942u,15510947u,15603u},{15510948u,15510948u,2846u},{15510949u,15510967u,15609u},
+{15510968u,15510969u,2847u},{15510970u,15510975u,15628u},{15511168u,15511195u,15634u},{15511196u,15511196u,2849u},
+{15511197u,15511223u,15662u},{15511224u,15511224u,2850u},{15511225u,15511231u,15689u},{15511424u,15511443u,15696u},
+{15511444u,15511444u,2851u},{15511445u,15511459u,15716u},{15511460u,15511460u,2852u},{15511461u,15511462u,15731u},
+{15511463u,15511463u,2853u},{15511464u,15511464u,15733u},{15511465u,15511465u,2854u},{15511466u,15511487u,15734u},
+{15511680u,15511691u,15756u},{15511692u,15511693u,2855u},{15511694u,15511695u,15768u},{15511696u,15511696u,2857u},
+{15511697u,15511699u,15770u},{15511700u,15511700u,2858u},{15511701u,15511707u,15773u},{15511708u,15511709u,2859u},
+{15511710u,15511712u,15780u},{15511713u,15511714u,2861u},{15511715u,15511718u,15783u},{15511719u,15511721u,2863u},
+{15511722u,15511723u,15787u},{15511724u,15511724u,2866u},{15511725u,15511725u,15789u},{15511726u,15511726u,2867u},
+{15511727u,15511727u,15790u},{15511728u,15511728u,2868u},{15511729u,15511735u,15791u},{15511736u,15511737u,2869u},
+{15511738u,15511738u,15798u},{15511739u,15511742u,2871u},{15511743u,15511743u,15799u},{15511936u,15511939u,15800u},
+{15511940u,15511941u,2875u},{15511942u,15511943u,15804u},{15511944u,15511944u,2877u},{15511945u,15511947u,15806u},
+{15511948u,15511948u,2878u},{15511949u,15511955u,15809u},{15511956u,15511957u,2879u},{15511958u,15511958u,15816u},
+{15511959u,15511961u,2881u},{15511962u,15511967u,15817u},{15511968u,15511968u,2884u},{15511969u,15511971u,15823u},
+{15511972u,15511972u,2885u},{15511973u,15511973u,15826u},{15511974u,15511974u,2886u},{15511975u,15511975u,15827u},
+{15511976u,15511976u,2887u},{15511977u,15511983u,15828u},{15511984u,15511984u,2888u},{15511985u,15511988u,15835u},
+{15511989u,15511989u,2889u},{15511990u,15511999u,15839u},{15512192u,15512215u,15849u},{15512216u,15512217u,2890u},
+{15512218u,15512219u,15873u},{15512220u,15512220u,2892u},{15512221u,15512223u,15875u},{15512224u,15512224u,2893u},
+{15512225u,15512231u,15878u},{15512232u,15512233u,2894u},{15512234u,15512234u,15885u},{15512235u,15512237u,2896u},
+{15512238u,15512243u,15886u},{15512244u,15512245u,2899u},{15512246u,15512247u,15892u},{15512248u,15512248u,2901u},
+{15512249u,15512251u,15894u},{15512252u,15512252u,2902u},{15512253u,15512255u,15897u},{15512448u,15512451u,15900u},
+{15512452u,15512453u,2903u},{15512454u,15512454u,15904u},{15512455u,15512455u,2905u},{15512456u,15512456u,15905u},
+{15512457u,15512457u,2906u},{15512458u,15512463u,15906u},{15512464u,15512464u,2907u},{15512465u,15512467u,15912u},
+{15512468u,15512468u,2908u},{15512469u,15512483u,15915u},{15512484u,15512484u,2909u},{15512485u,15512491u,15930u},
+{15512492u,15512492u,2910u},{15512493u,15512495u,15937u},{15512496u,15512496u,2911u},{15512497u,15512511u,15940u},
+{15512704u,15512704u,15955u},{15512705u,15512705u,2912u},{15512706u,15512711u,15956u},{15512712u,15512713u,2913u},
+{15512714u,15512715u,15962u},{15512716u,15512716u,2915u},{15512717u,15512719u,15964u},{15512720u,15512720u,2916u},
+{15512721u,15512727u,15967u},{15512728u,15512729u,2917u},{15512730u,15512730u,15974u},{15512731u,15512731u,2919u},
+{15512732u,15512732u,15975u},{15512733u,15512733u,2920u},{15512734u,15512739u,15976u},{15512740u,15512740u,2921u},
+{15512741u,15512743u,15982u},{15512744u,15512744u,2922u},{15512745u,15512747u,15985u},{15512748u,15512748u,2923u},
+{15512749u,15512760u,15988u},{15512761u,15512761u,2924u},{15512762u,15512767u,16000u},{15512960u,15512987u,16006u},
+{15512988u,15512988u,2925u},{15512989u,15512991u,16034u},{15512992u,15512992u,2926u},{15512993u,15512995u,16037u},
+{15512996u,15512996u,2927u},{15512997u,15513003u,16040u},{15513004u,15513005u,2928u},{15513006u,15513006u,16047u},
+{15513007u,15513007u,2930u},{15513008u,15513008u,16048u},{15513009u,15513009u,2931u},{15513010u,15513015u,16049u},
+{15513016u,15513016u,2932u},{15513017u,15513023u,16055u},{15513216u,15513223u,16062u},{15513224u,15513224u,2933u},
+{15513225u,15513235u,16070u},{15513236u,15513237u,2934u},{15513238u,15513239u,16081u},{15513240u,15513240u,2936u},
+{15513241u,15513243u,16083u},{15513244u,15513244u,2937u},{15513245u,15513251u,16086u},{15513252u,15513253u,2938u},
+{15513254u,15513254u,16093u},{15513255u,15513255u,2940u},{15513256u,15513256u,16094u},{15513257u,15513257u,2941u},
+{15513258u,15513263u,16095u},{15513264u,15513264u,2942u},{15513265u,15513279u,16101u},{15513472u,15513475u,16116u},
+{15513476u,15513476u,2943u},{15513477u,15513483u,16120u},{15513484u,15513484u,2944u},{15513485u,15513487u,16127u},
+{15513488u,15513488u,2945u},{15513489u,15513511u,16130u},{15513512u,15513512u,2946u},{15513513u,15513515u,16153u},
+{15513516u,15513516u,2947u},{15513517u,15513519u,16156u},{15513520u,15513520u,2948u},{15513521u,15513527u,16159u},
+{15513528u,15513529u,2949u},{15513530u,15513530u,16166u},{15513531u,15513531u,2951u},{15513532u,15513532u,16167u},
+{15513533u,15513533u,2952u},{15513534u,15513535u,16168u},{15513728u,15513731u,16170u},{15513732u,15513732u,2953u},
+{15513733u,15513735u,16174u},{15513736u,15513736u,2954u},{15513737u,15513739u,16177u},{15513740u,15513740u,2955u},
+{15513741u,15513747u,16180u},{15513748u,15513748u,2956u},{15513749u,15513752u,16187u},{15513753u,15513753u,2957u},
+{15513754u,15513759u,16191u},{15513760u,15513761u,2958u},{15513762u,15513763u,16197u},{15513764u,15513764u,2960u},
+{15513765u,15513767u,16199u},{15513768u,15513768u,2961u},{15513769u,15513775u,16202u},{15513776u,15513777u,2962u},
+{15513778u,15513778u,16209u},{15513779u,15513779u,2964u},{15513780u,15513780u,16210u},{15513781u,15513781u,2965u},
+{15513782u,15513791u,16211u},{15513984u,15514007u,16221u},{15514008u,15514009u,2966u},{15514010u,15514011u,16245u},
+{15514012u,15514012u,2968u},{15514013u,15514014u,16247u},{15514015u,15514017u,2969u},{15514018u,15514023u,16249u},
+{15514024u,15514025u,2972u},{15514026u,15514026u,16255u},{15514027u,15514027u,2974u},{15514028u,15514028u,16256u},
+{15514029u,15514029u,2975u},{15514030u,15514035u,16257u},{15514036u,15514037u,2976u},{15514038u,15514039u,16263u},
+{15514040u,15514040u,2978u},{15514041u,15514043u,16265u},{15514044u,15514044u,2979u},{15514045u,15514047u,16268u},
+{15514240u,15514243u,16271u},{15514244u,15514245u,2980u},{15514246u,15514246u,16275u},{15514247u,15514247u,2982u},
+{15514248u,15514248u,16276u},{15514249u,15514249u,2983u},{15514250u,15514255u,16277u},{15514256u,15514257u,2984u},
+{15514258u,15514259u,16283u},{15514260u,15514260u,2986u},{15514261u,15514263u,16285u},{15514264u,15514264u,2987u},
+{15514265u,15514271u,16288u},{15514272u,15514273u,2988u},{15514274u,15514274u,16295u},{15514275u,15514277u,2990u},
+{15514278u,15514283u,16296u},{15514284u,15514285u,2993u},{15514286u,15514303u,16302u},{15514496u,15514496u,16320u},
+{15514497u,15514497u,2995u},{15514498u,15514531u,16321u},{15514532u,15514533u,2996u},{15514534u,15514535u,16355u},
+{15514536u,15514536u,2998u},{15514537u,15514538u,16357u},{15514539u,15514540u,2999u},{15514541u,15514547u,16359u},
+{15514548u,15514549u,3001u},{15514550u,15514550u,16366u},{15514551u,15514553u,3003u},{15514554u,15514559u,16367u},
+{15514752u,15514753u,3006u},{15514754u,15514755u,16373u},{15514756u,15514756u,3008u},{15514757u,15514759u,16375u},
+{15514760u,15514760u,3009u},{15514761u,15514767u,16378u},{15514768u,15514769u,3010u},{15514770u,15514770u,16385u},
+{15514771u,15514771u,3012u},{15514772u,15514772u,16386u},{15514773u,15514773u,3013u},{15514774u,15514779u,16387u},
+{15514780u,15514780u,3014u},{15514781u,15514783u,16393u},{15514784u,15514784u,3015u},{15514785u,15514787u,16396u},
+{15514788u,15514788u,3016u},{15514789u,15514795u,16399u},{15514796u,15514797u,3017u},{15514798u,15514798u,16406u},
+{15514799u,15514801u,3019u},{15514802u,15514807u,16407u},{15514808u,15514808u,3022u},{15514809u,15514815u,16413u},
+{15515008u,15515027u,16420u},{15515028u,15515029u,3023u},{15515030u,15515031u,16440u},{15515032u,15515032u,3025u},
+{15515033u,15515035u,16442u},{15515036u,15515036u,3026u},{15515037u,15515043u,16445u},{15515044u,15515045u,3027u},
+{15515046u,15515046u,16452u},{15515047u,15515047u,3029u},{15515048u,15515048u,16453u},{15515049u,15515049u,3030u},
+{15515050u,15515055u,16454u},{15515056u,15515057u,3031u},{15515058u,15515059u,16460u},{15515060u,15515060u,3033u},
+{15515061u,15515063u,16462u},{15515064u,15515064u,3034u},{15515065u,15515071u,16465u},{15515264u,15515264u,3035u},
+{15515265u,15515268u,16472u},{15515269u,15515269u,3036u},{15515270u,15515275u,16476u},{15515276u,15515276u,3037u},
+{15515277u,15515296u,16482u},{15515297u,15515297u,3038u},{15515298u,15515303u,16502u},{15515304u,15515304u,3039u},
+{15515305u,15515311u,16508u},{15515312u,15515312u,3040u},{15515313u,15515327u,16515u},{15515520u,15515523u,16530u},
+{15515524u,15515524u,3041u},{15515525u,15515551u,16534u},{15515552u,15515553u,3042u},{15515554u,15515555u,16561u},
+{15515556u,15515556u,3044u},{15515557u,15515559u,16563u},{15515560u,15515560u,3045u},{15515561u,15515567u,16566u},
+{15515568u,15515569u,3046u},{15515570u,15515570u,16573u},{15515571u,15515571u,3048u},{15515572u,15515572u,16574u},
+{15515573u,15515573u,3049u},{15515574u,15515579u,16575u},{15515580u,15515580u,3050u},{15515581u,15515583u,16581u},
+{15564928u,15564928u,3051u},{15564929u,15564931u,16584u},{15564932u,15564932u,3052u},{15564933u,15564944u,16587u},
+{15564945u,15564945u,3053u},{15564946u,15564951u,16599u},{15564952u,15564952u,3054u},{15564953u,15564972u,16605u},
+{15564973u,15564973u,3055u},{15564974u,15564979u,16625u},{15564980u,15564981u,3056u},{15564982u,15564983u,16631u},
+{15564984u,15564984u,3058u},{15564985u,15564987u,16633u},{15564988u,15564988u,3059u},{15564989u,15564991u,16636u},
+{15565184u,15565187u,16639u},{15565188u,15565189u,3060u},{15565190u,15565190u,16643u},{15565191u,15565191u,3062u},
+{15565192u,15565192u,16644u},{15565193u,15565193u,3063u},{15565194u,15565199u,16645u},{15565200u,15565200u,3064u},
+{15565201u,15565203u,16651u},{15565204u,15565204u,3065u},{15565205u,15565207u,16654u},{15565208u,15565208u,3066u},
+{15565209u,15565215u,16657u},{15565216u,15565216u,3067u},{15565217u,15565227u,16664u},{15565228u,15565229u,3068u},
+{15565230u,15565231u,16675u},{15565232u,15565232u,3070u},{15565233u,15565235u,16677u},{15565236u,15565236u,3071u},
+{15565237u,15565243u,16680u},{15565244u,15565245u,3072u},{15565246u,15565247u,16687u},{15565440u,15565440u,16689u},
+{15565441u,15565441u,3074u},{15565442u,15565475u,16690u},{15565476u,15565477u,3075u},{15565478u,15565479u,16724u},
+{15565480u,15565480u,3077u},{15565481u,15565483u,16726u},{15565484u,15565484u,3078u},{15565485u,15565491u,16729u},
+{15565492u,15565493u,3079u},{15565494u,15565494u,16736u},{15565495u,15565495u,3081u},{15565496u,15565496u,16737u},
+{15565497u,15565497u,3082u},{15565498u,15565503u,16738u},{15565696u,15565697u,3083u},{15565698u,15565699u,16744u},
+{15565700u,15565700u,3085u},{15565701u,15565703u,16746u},{15565704u,15565705u,3086u},{15565706u,15565711u,16749u},
+{15565712u,15565713u,3088u},{15565714u,15565714u,16755u},{15565715u,15565717u,3090u},{15565718u,15565723u,16756u},
+{15565724u,15565725u,3093u},{15565726u,15565727u,16762u},{15565728u,15565728u,3095u},{15565729u,15565731u,16764u},
+{15565732u,15565732u,3096u},{15565733u,15565739u,16767u},{15565740u,15565741u,3097u},{15565742u,15565742u,16774u},
+{15565743u,15565745u,3099u},{15565746u,15565751u,16775u},{15565752u,15565752u,3102u},{15565753u,15565759u,16781u},
+{15565952u,15565964u,16788u},{15565965u,15565965u,3103u},{15565966u,15565999u,16801u},{15566000u,15566001u,3104u},
+{15566002u,15566003u,16835u},{15566004u,15566004u,3106u},{15566005u,15566007u,16837u},{15566008u,15566008u,3107u},
+{15566009u,15566009u,16840u},{15566010u,15566010u,3108u},{15566011u,15566015u,16841u},{15566208u,15566209u,3109u},
+{15566210u,15566210u,16846u},{15566211u,15566213u,3111u},{15566214u,15566219u,16847u},{15566220u,15566221u,3114u},
+{15566222u,15566223u,16853u},{15566224u,15566224u,3116u},{15566225u,15566227u,16855u},{15566228u,15566228u,3117u},
+{15566229u,15566235u,16858u},{15566236u,15566237u,3118u},{15566238u,15566238u,16865u},{15566239u,15566239u,3120u},
+{15566240u,15566240u,16866u},{15566241u,15566241u,3121u},{15566242u,15566247u,16867u},{15566248u,15566248u,3122u},
+{15566249u,15566251u,16873u},{15566252u,15566252u,3123u},{15566253u,15566267u,16876u},{15566268u,15566268u,3124u},
+{15566269u,15566271u,16891u},{15566464u,15566467u,16894u},{15566468u,15566468u,3125u},{15566469u,15566471u,16898u},
+{15566472u,15566472u,3126u},{15566473u,15566495u,16901u},{15566496u,15566497u,3127u},{15566498u,15566499u,16924u},
+{15566500u,15566500u,3129u},{15566501u,15566503u,16926u},{15566504u,15566504u,3130u},{15566505u,15566511u,16929u},
+{15566512u,15566513u,3131u},{15566514u,15566514u,16936u},{15566515u,15566515u,3133u},{15566516u,15566516u,16937u},
+{15566517u,15566517u,3134u},{15566518u,15566521u,16938u},{15566522u,15566522u,3135u},{15566523u,15566523u,16942u},
+{15566524u,15566524u,3136u},{15566525u,15566527u,16943u},{15566720u,15566720u,3137u},{15566721u,15566743u,16946u},
+{15566744u,15566744u,3138u},{15566745u,15566771u,16969u},{15566772u,15566772u,3139u},{15566773u,15566775u,16996u},
+{15566776u,15566776u,3140u},{15566777u,15566783u,16999u},{15566976u,15566982u,17006u},{15566983u,15566983u,3141u},
+{15566984u,15566984u,17013u},{15566985u,15566985u,3142u},{15566986u,15566991u,17014u},{15566992u,15566992u,3143u},
+{15566993u,15567019u,17020u},{15567020u,15567021u,3144u},{15567022u,15567023u,17047u},{15567024u,15567024u,3146u},
+{15567025u,15567027u,17049u},{15567028u,15567028u,3147u},{15567029u,15567035u,17052u},{15567036u,15567037u,3148u},
+{15567038u,15567038u,17059u},{15567039u,15567039u,3150u},{15567232u,15567232u,17060u},{15567233u,15567233u,3151u},
+{15567234u,15567239u,17061u},{15567240u,15567240u,3152u},{15567241u,15567259u,17067u},{15567260u,15567260u,3153u},
+{15567261u,15567267u,17086u},{15567268u,15567268u,3154u},{15567269u,15567295u,17093u},{15567488u,15567489u,3155u},
+{15567490u,15567491u,17120u},{15567492u,15567492u,3157u},{15567493u,15567495u,17122u},{15567496u,15567496u,3158u},
+{15567497u,15567503u,17125u},{15567504u,15567505u,3159u},{15567506u,15567508u,17132u},{15567509u,15567509u,3161u},
+{15567510u,15567515u,17135u},{15567516u,15567516u,3162u},{15567517u,15567519u,17141u},{15567520u,15567520u,3163u},
+{15567521u,15567523u,17144u},{15567524u,15567524u,3164u},{15567525u,15567531u,17147u},{15567532u,15567532u,3165u},
+{15567533u,15567536u,17154u},{15567537u,15567537u,3166u},{15567538u,15567543u,17158u},{15567544u,15567545u,3167u},
+{15567546u,15567547u,17164u},{15567548u,15567548u,3169u},{15567549u,15567550u,17166u},{15567551u,15567551u,3170u},
+{15567744u,15567744u,3171u},{15567745u,15567745u,17168u},{15567746u,15567746u,3172u},{15567747u,15567751u,17169u},
+{15567752u,15567753u,3173u},{15567754u,15567754u,17174u},{15567755u,15567755u,3175u},{15567756u,15567763u,17175u},
+{15567764u,15567764u,3176u},{15567765u,15567767u,17183u},{15567768u,15567768u,3177u},{15567769u,15567771u,17186u},
+{15567772u,15567772u,3178u},{15567773u,15567779u,17189u},{15567780u,15567781u,3179u},{15567782u,15567791u,17196u},
+{15567792u,15567793u,3181u},{15567794u,15567795u,17206u},{15567796u,15567796u,3183u},{15567797u,15567799u,17208u},
+{15567800u,15567800u,3184u},{15567801u,15567807u,17211u},{15568000u,15568001u,3185u},{15568002u,15568002u,17218u},
+{15568003u,15568003u,3187u},{15568004u,15568004u,17219u},{15568005u,15568005u,3188u},{15568006u,15568011u,17220u},
+{15568012u,15568014u,3189u},{15568015u,15568015u,17226u},{15568016u,15568016u,3192u},{15568017u,15568019u,17227u},
+{15568020u,15568020u,3193u},{15568021u,15568021u,17230u},{15568022u,15568022u,3194u},{15568023u,15568027u,17231u},
+{15568028u,15568029u,3195u},{15568030u,15568030u,17236u},{15568031u,15568033u,3197u},{15568034u,15568036u,17237u},
+{15568037u,15568037u,3200u},{15568038u,15568039u,17240u},{15568040u,15568041u,3201u},{15568042u,15568043u,17242u},
+{15568044u,15568044u,3203u},{15568045u,15568047u,17244u},{15568048u,15568048u,3204u},{15568049u,15568055u,17247u},
+{15568056u,15568057u,3205u},{15568058u,15568058u,17254u},{15568059u,15568061u,3207u},{15568062u,15568063u,17255u},
+{15568256u,15568259u,17257u},{15568260u,15568261u,3210u},{15568262u,15568315u,17261u},{15568316u,15568317u,3212u},
+{15568318u,15568319u,17315u},{15568512u,15568512u,3214u},{15568513u,15568515u,17317u},{15568516u,15568516u,3215u},
+{15568517u,15568523u,17320u},{15568524u,15568525u,3216u},{15568526u,15568526u,17327u},{15568527u,15568529u,3218u},
+{15568530u,15568535u,17328u},{15568536u,15568537u,3221u},{15568538u,15568539u,17334u},{15568540u,15568540u,3223u},
+{15568541u,15568543u,17336u},{15568544u,15568544u,3224u},{15568545u,15568551u,17339u},{15568552u,15568553u,3225u},
+{15568554u,15568554u,17346u},{15568555u,15568555u,3227u},{15568556u,15568556u,17347u},{15568557u,15568557u,3228u},
+{15568558u,15568563u,17348u},{15568564u,15568564u,3229u},{15568565u,15568567u,17354u},{15568568u,15568568u,3230u},
+{15568569u,15568571u,17357u},{15568572u,15568572u,3231u},{15568573u,15568575u,17360u},{15568768u,15568771u,17363u},
+{15568772u,15568773u,3232u},{15568774u,15568775u,17367u},{15568776u,15568777u,3234u},{15568778u,15568783u,17369u},
+{15568784u,15568784u,3236u},{15568785u,15568791u,17375u},{15568792u,15568792u,3237u},{15568793u,15568800u,17382u},
+{15568801u,15568801u,3238u},{15568802u,15568802u,17390u},{15568803u,15568803u,3239u},{15568804u,15568811u,17391u},
+{15568812u,15568813u,3240u},{15568814u,15568815u,17399u},{15568816u,15568816u,3242u},{15568817u,15568819u,17401u},
+{15568820u,15568820u,3243u},{15568821u,15568827u,17404u},{15568828u,15568829u,3244u},{15568830u,15568830u,17411u},
+{15568831u,15568831u,3246u},{15569024u,15569024u,17412u},{15569025u,15569025u,3247u},{15569026u,15569031u,17413u},
+{15569032u,15569032u,3248u},{15569033u,15569052u,17419u},{15569053u,15569053u,3249u},{15569054u,15569087u,17439u},
+{15569280u,15569280u,3250u},{15569281u,15569283u,17473u},{15569284u,15569284u,3251u},{15569285u,15569307u,17476u},
+{15569308u,15569308u,3252u},{15569309u,15569311u,17499u},{15569312u,15569312u,3253u},{15569313u,15569315u,17502u},
+{15569316u,15569316u,3254u},{15569317u,15569324u,17505u},{15569325u,15569325u,3255u},{15569326u,15569326u,17513u},
+{15569327u,15569327u,3256u},{15569328u,15569335u,17514u},{15569336u,15569337u,3257u},{15569338u,15569339u,17522u},
+{15569340u,15569340u,3259u},{15569341u,15569342u,17524u},{15569343u,15569343u,3260u},{15569536u,15569536u,3261u},
+{15569537u,15569537u,17526u},{15569538u,15569538u,3262u},{15569539u,15569543u,17527u},{15569544u,15569545u,3263u},
+{15569546u,15569546u,17532u},{15569547u,15569547u,3265u},{15569548u,15569548u,17533u},{15569549u,15569549u,3266u},
+{15569550u,15569555u,17534u},{15569556u,15569556u,3267u},{15569557u,15569576u,17540u},{15569577u,15569577u,3268u},
+{15569578u,15569599u,17560u},{15569792u,15569803u,17582u},{15569804u,15569804u,3269u},{15569805u,15569807u,17594u},
+{15569808u,15569808u,3270u},{15569809u,15569811u,17597u},{15569812u,15569812u,3271u},{15569813u,15569819u,17600u},
+{15569820u,15569820u,3272u},{15569821u,15569822u,17607u},{15569823u,15569823u,3273u},{15569824u,15569831u,17609u},
+{15569832u,15569832u,3274u},{15569833u,15569835u,17617u},{15569836u,15569836u,3275u},{15569837u,15569839u,17620u},
+{15569840u,15569840u,3276u},{15569841u,15569847u,17623u},{15569848u,15569848u,3277u},{15569849u,15569850u,17630u},
+{15569851u,15569851u,3278u},{15569852u,15569852u,17632u},{15569853u,15569853u,3279u},{15569854u,15569855u,17633u},
+{15570048u,15570051u,17635u},{15570052u,15570052u,3280u},{15570053u,15570055u,17639u},{15570056u,15570056u,3281u},
+{15570057u,15570059u,17642u},{15570060u,15570060u,3282u},{15570061u,15570067u,17645u},{15570068u,15570069u,3283u},
+{15570070u,15570070u,17652u},{15570071u,15570071u,3285u},{15570072u,15570107u,17653u},{15570108u,15570109u,3286u},
+{15570110u,15570111u,17689u},{15570304u,15570304u,3288u},{15570305u,15570307u,17691u},{15570308u,15570308u,3289u},
+{15570309u,15570315u,17694u},{15570316u,15570317u,3290u},{15570318u,15570318u,17701u},{15570319u,15570319u,3292u},
+{15570320u,15570320u,17702u},{15570321u,15570321u,3293u},{15570322u,15570327u,17703u},{15570328u,15570329u,3294u},
+{15570330u,15570331u,17709u},{15570332u,15570332u,3296u},{15570333u,15570335u,17711u},{15570336u,15570336u,3297u},
+{15570337u,15570340u,17714u},{15570341u,15570341u,3298u},{15570342u,15570343u,17718u},{15570344u,15570345u,3299u},
+{15570346u,15570346u,17720u},{15570347u,15570347u,3301u},{15570348u,15570348u,17721u},{15570349u,15570349u,3302u},
+{15570350u,15570355u,17722u},{15570356u,15570357u,3303u},{15570358u,15570359u,17728u},{15570360u,15570360u,3305u},
+{15570361u,15570363u,17730u},{15570364u,15570364u,3306u},{15570365u,15570367u,17733u},{15570560u,15570563u,17736u},
+{15570564u,15570565u,3307u},{15570566u,15570566u,17740u},{15570567u,15570569u,3309u},{15570570u,15570575u,17741u},
+{15570576u,15570576u,3312u},{15570577u,15570596u,17747u},{15570597u,15570597u,3313u},{15570598u,15570623u,17767u},
+{15570816u,15570823u,17793u},{15570824u,15570825u,3314u},{15570826u,15570827u,17801u},{15570828u,15570828u,3316u},
+{15570829u,15570831u,17803u},{15570832u,15570832u,3317u},{15570833u,15570833u,17806u},{15570834u,15570834u,3318u},
+{15570835u,15570839u,17807u},{15570840u,15570841u,3319u},{15570842u,15570842u,17812u},{15570843u,15570843u,3321u},
+{15570844u,15570844u,17813u},{15570845u,15570845u,3322u},{15570846u,15570851u,17814u},{15570852u,15570853u,3323u},
+{15570854u,15570855u,17820u},{15570856u,15570856u,3325u},{15570857u,15570859u,17822u},{15570860u,15570860u,3326u},
+{15570861u,15570867u,17825u},{15570868u,15570869u,3327u},{15570870u,15570870u,17832u},{15570871u,15570871u,3329u},
+{15570872u,15570872u,17833u},{15570873u,15570873u,3330u},{15570874u,15570879u,17834u},{15571072u,15571073u,3331u},
+{15571074u,15571075u,17840u},{15571076u,15571076u,3333u},{15571077u,15571079u,17842u},{15571080u,15571080u,3334u},
+{15571081u,15571087u,17845u},{15571088u,15571089u,3335u},{15571090u,15571090u,17852u},{15571091u,15571093u,3337u},
+{15571094u,15571099u,17853u},{15571100u,15571100u,3340u},{15571101u,15571103u,17859u},{15571104u,15571104u,3341u},
+{15571105u,15571107u,17862u},{15571108u,15571108u,3342u},{15571109u,15571116u,17865u},{15571117u,15571117u,3343u},
+{15571118u,15571127u,17873u},{15571128u,15571129u,3344u},{15571130u,15571131u,17883u},{15571132u,15571132u,3346u},
+{15571133u,15571135u,17885u},{15571328u,15571328u,3347u},{15571329u,15571332u,17888u},{15571333u,15571333u,3348u},
+{15571334u,15571335u,17892u},{15571336u,15571337u,3349u},{15571338u,15571338u,17894u},{15571339u,15571339u,3351u},
+{15571340u,15571340u,17895u},{15571341u,15571341u,3352u},{15571342u,15571344u,17896u},{15571345u,15571345u,3353u},
+{15571346u,15571347u,17899u},{15571348u,15571349u,3354u},{15571350u,15571351u,17901u},{15571352u,15571352u,3356u},
+{15571353u,15571355u,17903u},{15571356u,15571356u,3357u},{15571357u,15571366u,17906u},{15571367u,15571367u,3358u},
+{15571368u,15571368u,17916u},{15571369u,15571369u,3359u},{15571370u,15571375u,17917u},{15571376u,15571377u,3360u},
+{15571378u,15571379u,17923u},{15571380u,15571380u,3362u},{15571381u,15571391u,17925u},{15571584u,15571586u,17936u},
+{15571587u,15571587u,3363u},{15571588u,15571588u,17939u},{15571589u,15571589u,3364u},{15571590u,15571595u,17940u},
+{15571596u,15571597u,3365u},{15571598u,15571599u,17946u},{15571600u,15571600u,3367u},{15571601u,15571603u,17948u},
+{15571604u,15571604u,3368u},{15571605u,15571612u,17951u},{15571613u,15571613u,3369u},{15571614u,15571614u,17959u},
+{15571615u,15571615u,3370u},{15571616u,15571616u,17960u},{15571617u,15571617u,3371u},{15571618u,15571623u,17961u},
+{15571624u,15571624u,3372u},{15571625u,15571627u,17967u},{15571628u,15571628u,3373u},{15571629u,15571631u,17970u},
+{15571632u,15571632u,3374u},{15571633u,15571640u,17973u},{15571641u,15571641u,3375u},{15571642u,15571642u,17981u},
+{15571643u,15571643u,3376u},{15571644u,15571647u,17982u},{15571840u,15571843u,17986u},{15571844u,15571845u,3377u},
+{15571846u,15571847u,17990u},{15571848u,15571848u,3379u},{15571849u,15571851u,17992u},{15571852u,15571852u,3380u},
+{15571853u,15571856u,17995u},{15571857u,15571857u,3381u},{15571858u,15571859u,17999u},{15571860u,15571860u,3382u},
+{15571861u,15571862u,18001u},{15571863u,15571863u,3383u},{15571864u,15571864u,18003u},{15571865u,15571865u,3384u},
+{15571866u,15571871u,18004u},{15571872u,15571872u,3385u},{15571873u,15571875u,18010u},{15571876u,15571876u,3386u},
+{15571877u,15571879u,18013u},{15571880u,15571880u,3387u},{15571881u,15571887u,18016u},{15571888u,15571888u,3388u},
+{15571889u,15571892u,18023u},{15571893u,15571893u,3389u},{15571894u,15571899u,18027u},{15571900u,15571901u,3390u},
+{15571902u,15571903u,18033u},{15572096u,15572096u,3392u},{15572097u,15572099u,18035u},{15572100u,15572100u,3393u},
+{15572101u,15572112u,18038u},{15572113u,15572113u,3394u},{15572114u,15572119u,18050u},{15572120u,15572121u,3395u},
+{15572122u,15572123u,18056u},{15572124u,15572124u,3397u},{15572125u,15572127u,18058u},{15572128u,15572128u,3398u},
+{15572129u,15572135u,18061u},{15572136u,15572137u,3399u},{15572138u,15572138u,18068u},{15572139u,15572139u,3401u},
+{15572140u,15572140u,18069u},{15572141u,15572141u,3402u},{15572142u,15572147u,18070u},{15572148u,15572149u,3403u},
+{15572150u,15572151u,18076u},{15572152u,15572152u,3405u},{15572153u,15572155u,18078u},{15572156u,15572156u,3406u},
+{15572157u,15572159u,18081u},{15572352u,15572355u,18084u},{15572356u,15572356u,3407u},{15572357u,15572358u,18088u},
+{15572359u,15572359u,3408u},{15572360u,15572360u,18090u},{15572361u,15572361u,3409u},{15572362u,15572367u,18091u},
+{15572368u,15572369u,3410u},{15572370u,15572371u,18097u},{15572372u,15572372u,3412u},{15572373u,15572373u,18099u},
+{15572374u,15572377u,3413u},{15572378u,15572383u,18100u},{15572384u,15572385u,3417u},{15572386u,15572386u,18106u},
+{15572387u,15572387u,3419u},{15572388u,15572388u,18107u},{15572389u,15572389u,3420u},{15572390u,15572392u,18108u},
+{15572393u,15572393u,3421u},{15572394u,15572395u,18111u},{15572396u,15572396u,3422u},{15572397u,15572399u,18113u},
+{15572400u,15572400u,3423u},{15572401u,15572403u,18116u},{15572404u,15572404u,3424u},{15572405u,15572411u,18119u},
+{15572412u,15572413u,3425u},{15572414u,15572415u,18126u},{15572608u,15572608u,18128u},{15572609u,15572609u,3427u},
+{15572610u,15572615u,18129u},{15572616u,15572617u,3428u},{15572618u,15572619u,18135u},{15572620u,15572620u,3430u},
+{15572621u,15572623u,18137u},{15572624u,15572624u,3431u},{15572625u,15572631u,18140u},{15572632u,15572633u,3432u},
+{15572634u,15572634u,18147u},{15572635u,15572635u,3434u},{15572636u,15572636u,18148u},{15572637u,15572637u,3435u},
+{15572638u,15572643u,18149u},{15705216u,15705216u,4116u},{15705217u,15705217u,3678u},{15705218u,15705218u,7053u},
+{15705219u,15705219u,3460u},{15705220u,15705220u,7900u},{15705221u,15705221u,3802u},{15705222u,15705222u,3902u},
+{15705223u,15705223u,3946u},{15705224u,15705224u,3946u},{15705225u,15705225u,3708u},{15705226u,15705226u,4131u},
+{15705227u,15705227u,4374u},{15705228u,15705228u,4156u},{15705229u,15705235u,4375u},{15705236u,15705236u,5800u},
+{15705237u,15705239u,4382u},{15705240u,15705245u,4386u},{15705246u,15705248u,4394u},{15705249u,15705249u,4399u},
+{15705250u,15705250u,4403u},{15705251u,15705252u,4406u},{15705253u,15705259u,4409u},{15705260u,15705261u,4419u},
+{15705262u,15705262u,4424u},{15705263u,15705263u,4511u},{15705264u,15705265u,4513u},{15705266u,15705271u,4517u},
+{15705272u,15705274u,4524u},{15705275u,15705279u,4528u},{15705472u,15705472u,4533u},{15705473u,15705475u,4535u},
+{15705476u,15705477u,4541u},{15705478u,15705480u,4545u},{15705481u,15705481u,4550u},{15705482u,15705482u,4564u},
+{15705483u,15705486u,4566u},{15705487u,15705488u,4571u},{15705489u,15705489u,4576u},{15705490u,15705493u,4604u},
+{15705494u,15705497u,4609u},{15705498u,15705498u,4318u},{15705499u,15705499u,4136u},{15705500u,15705500u,5800u},
+{15705501u,15705501u,4139u},{15705502u,15705502u,4192u},{15705503u,15705503u,4167u},{15705504u,15705504u,4172u},
+{15705505u,15705505u,5552u},{15705506u,15705506u,6424u},{15705507u,15705507u,5151u},{15705508u,15705508u,4922u},
+{15705509u,15705509u,7518u},{15705510u,15705510u,5079u},{15705511u,15705511u,5109u},{15705512u,15705512u,7607u},
+{15705513u,15705513u,5584u},{15705514u,15705514u,5367u},{15705515u,15705515u,7083u},{15705516u,15705516u,5362u},
+{15705517u,15705517u,5485u},{15705518u,15705518u,6001u},{15705519u,15705519u,5460u},{15705520u,15705520u,5317u},
+{15705521u,15705521u,7009u},{15705522u,15705522u,7370u},{15705523u,15705523u,5678u},{15705524u,15705524u,5874u},
+{15705525u,15705527u,4425u},{15705528u,15705530u,4429u},{15705531u,15705533u,4435u},{15705534u,15705534u,4439u},
+{15705535u,15705535u,4442u},{15705728u,15705728u,4443u},{15705729u,15705729u,4159u},{15705730u,15705730u,4444u},
+{15705731u,15705731u,4447u},{15705732u,15705733u,4449u},{15705734u,15705734u,4453u},{15705735u,15705740u,4455u},
+{15705741u,15705741u,4463u},{15705742u,15705742u,4160u},{15705743u,15705744u,4465u},{15705745u,15705745u,4161u},
+{15705746u,15705748u,4468u},{15705749u,15705749u,4162u},{15705750u,15705751u,4471u},{15705752u,15705752u,4474u},
+{15705753u,15705753u,4473u},{15705754u,15705755u,4475u},{15705756u,15705757u,4478u},{15705758u,15705758u,6447u},
+{15705759u,15705760u,4481u},{15705761u,15705761u,5460u},{15705762u,15705762u,4483u},{15705763u,15705763u,4163u},
+{15705764u,15705764u,4166u},{15705765u,15705765u,4485u},{15705766u,15705768u,4487u},{15705769u,15705769u,4491u},
+{15705770u,15705770u,4167u},{15705771u,15705773u,4493u},{15705774u,15705774u,7783u},{15705775u,15705775u,4497u},
+{15705776u,15705776u,4499u},{15705777u,15705780u,4501u},{15705781u,15705781u,4506u},{15705782u,15705784u,4508u},
+{15705785u,15705785u,5797u},{15705786u,15705788u,4551u},{15705789u,15705789u,4180u},{15705790u,15705790u,4555u},
+{15705791u,15705791u,5800u},{15705984u,15705985u,4556u},{15705986u,15705987u,4560u},{15705988u,15705988u,4563u},
+{15705989u,15705989u,7988u},{15705990u,15705990u,6123u},{15705991u,15705991u,4577u},{15705992u,15705992u,4183u},
+{15705993u,15705993u,4579u},{15705994u,15705995u,4581u},{15705996u,15705996u,4584u},{15705997u,15705997u,4586u},
+{15705998u,15705998u,4588u},{15705999u,15705999u,4184u},{15706000u,15706003u,4590u},{15706004u,15706006u,4595u},
+{15706007u,15706010u,4599u},{15706011u,15706011u,5552u},{15706012u,15706012u,4603u},{15706013u,15706013u,4614u},
+{15706014u,15706014u,4616u},{15706015u,15706015u,4618u},{15706016u,15706016u,5950u},{15706017u,15706018u,4620u},
+{15706019u,15706019u,4187u},{15706020u,15706020u,4625u},{15706021u,15706021u,4627u},{15706022u,15706022u,4629u},
+{15706023u,15706025u,4632u},{15706026u,15706026u,4636u},{15706027u,15706028u,4188u},{15706029u,15706029u,4638u},
+{15706030u,15706032u,4640u},{15706033u,15706037u,4644u},{15706038u,15706038u,4650u},{15706039u,15706041u,4653u},
+{15706042u,15706042u,5351u},{15706043u,15706043u,6494u},{15706044u,15706044u,5731u},{15706045u,15706045u,5771u},
+{15706046u,15706046u,4191u},{15706047u,15706047u,6484u},{15706240u,15706240u,6684u},{15706241u,15706241u,4279u},
+{15706242u,15706242u,7139u},{15706243u,15706243u,4247u},{15706244u,15706244u,4266u},{15706245u,15706245u,4340u},
+{15706246u,15706246u,7572u},{15706247u,15706247u,5088u},{15706248u,15706248u,7709u},{15706249u,15706249u,3558u},
+{15706250u,15706250u,3644u},{15706251u,15706251u,3815u},{15706286u,15706286u,4419u},{15706287u,15706287u,4510u},
+{15711361u,15711419u,264u},{15711420u,15711420u,112u},{15711421u,15711423u,324u},{15711616u,15711645u,327u},
+{15711646u,15711646u,113u},{15712160u,15712161u,143u},{15712162u,15712162u,194u},{15712163u,15712163u,357u},
+{15712165u,15712165u,145u},{15712166u,15712166u,323u},
+};
+
+static pdf_cmap cmap_UniKS_UTF8_H = {
+	{-1, pdf_free_cmap_imp}, "UniKS-UTF8-H", "", 0, 0, 4,
+	{ {1,0u,127u},{2,49280u,57279u},{3,14712960u,15712191u},{4,4034953344u,4156538815u}, },
+	71, 71, (pdf_range*) cmap_UniKS_UTF8_H_ranges,
+	8574, 8574, (pdf_xrange*) cmap_UniKS_UTF8_H_xranges,
+	0, 0, NULL,
+};
+
+/* UniKS-UTF8-V */
+
+static const pdf_xrange cmap_UniKS_UTF8_V_xranges[] = {
+{14844051u,14844052u,8059u},{14844054u,14844054u,8061u},{14844069u,14844069u,8058u},{14909569u,14909570u,8056u},
+{14909576u,14909585u,8065u},{14909587u,14909587u,8075u},{14909588u,14909589u,8063u},{15711361u,15711361u,8076u},
+{15711368u,15711369u,8077u},{15711372u,15711372u,8079u},{15711374u,15711374u,8080u},{15711386u,15711391u,8081u},
+{15711419u,15711419u,8087u},{15711421u,15711421u,8088u},{15711423u,15711423u,8089u},{15711643u,15711645u,8090u},
+{15711646u,15711646u,8062u},{15712163u,15712163u,8093u},
+};
+
+static pdf_cmap cmap_UniKS_UTF8_V = {
+	{-1, pdf_free_cmap_imp}, "UniKS-UTF8-V", "UniKS-UTF8-H", 0, 1, 0,
+	{ {0,0,0}, },
+	0, 0, NULL,
+	18, 18, (pdf_xrange*) cmap_UniKS_UTF8_V_xranges,
+	0, 0, NULL,
+};
+
+/* UniKS-X */
+
+static const pdf_range cmap_UniKS_X_ranges[] = {
+{32u,126u,1u},{161u,161u,208u},{164u,164u,214u},{167u,167u,155u},
+{168u,168u,107u},{170u,170u,668u},{171u,171u,176u},{176u,176u,138u},
+{177u,177u,130u},{178u,179u,843u},{180u,180u,199u},{182u,182u,244u},
+{184u,184u,206u},{185u,185u,842u},{186u,186u,675u},{187u,187u,177u},
+{188u,188u,751u},{189u,189u,748u},{190u,190u,752u},{191u,191u,209u},
+{198u,198u,666u},{208u,208u,667u},{215u,215u,131u},{216u,216u,673u},
+{222u,222u,676u},{223u,223u,768u},{230u,230u,757u},{240u,240u,759u},
+{247u,247u,132u},{248u,248u,766u},{254u,254u,769u},{273u,273u,758u},
+{294u,294u,669u},{295u,295u,760u},{305u,305u,761u},{306u,306u,670u},
+{307u,307u,762u},{312u,312u,763u},{319u,319u,671u},{320u,320u,764u},
+{321u,321u,672u},{322u,322u,765u},{329u,329u,772u},{330u,330u,678u},
+{331u,331u,771u},{338u,338u,674u},{339u,339u,767u},{358u,358u,677u},
+{359u,359u,770u},{700u,700u,8275u},{711u,711u,201u},{728u,728u,202u},
+{729u,729u,205u},{730u,730u,204u},{731u,731u,207u},{732u,732u,200u},
+{733u,733u,203u},{913u,929u,471u},{931u,937u,488u},{945u,961u,495u},
+{963u,969u,512u},{1025u,1025u,1026u},{1040u,1045u,1020u},{1046u,1077u,1027u},
+{1078u,1103u,1060u},{1105u,1105u,1059u},{8211u,8212u,109u},{8214u,8214u,111u},
+{8216u,8217u,114u},{8219u,8219u,8238u},{8220u,8221u,116u},{8223u,8223u,8237u},
+{8224u,8225u,245u},{8226u,8226u,8607u},{8229u,8230u,105u},{8240u,8240u,216u},
+{8242u,8243u,139u},{8244u,8244u,8582u},{8245u,8245u,9326u},{8246u,8246u,9324u},
+{8249u,8250u,8612u},{8251u,8251u,156u},{8252u,8252u,8763u},{8258u,8258u,8599u},
+{8308u,8308u,845u},{8314u,8315u,8239u},{8316u,8316u,8248u},{8317u,8318u,8250u},
+{8319u,8319u,846u},{8321u,8324u,847u},{8451u,8451u,141u},{8457u,8457u,215u},
+{8467u,8467u,590u},{8470u,8470u,258u},{8481u,8481u,263u},{8482u,8482u,260u},
+{8486u,8486u,643u},{8491u,8491u,142u},{8531u,8532u,749u},{8539u,8542u,753u},
+{8544u,8553u,461u},{8560u,8569u,451u},{8592u,8593u,171u},{8594u,8594u,170u},
+{8595u,8596u,173u},{8597u,8597u,247u},{8598u,8598u,250u},{8599u,8599u,248u},
+{8600u,8600u,251u},{8601u,8601u,249u},{8624u,8624u,8868u},{8625u,8625u,8865u},
+{8626u,8626u,8864u},{8627u,8627u,8869u},{8628u,8628u,8867u},{8636u,8636u,8884u},
+{8640u,8640u,8885u},{8644u,8645u,8896u},{8653u,8653u,8816u},{8655u,8655u,8815u},
+{8656u,8656u,8814u},{8657u,8657u,8854u},{8658u,8658u,195u},{8659u,8659u,8855u},
+{8660u,8660u,196u},{8672u,8672u,9190u},{8673u,8673u,9192u},{8674u,8674u,9191u},
+{8675u,8675u,9193u},{8678u,8678u,9198u},{8679u,8679u,9200u},{8680u,8680u,9199u},
+{8681u,8681u,9201u},{8704u,8704u,197u},{8706u,8706u,151u},{8707u,8707u,198u},
+{8710u,8710u,8715u},{8711u,8711u,152u},{8712u,8712u,184u},{8713u,8713u,8749u},
+{8715u,8715u,185u},{8716u,8716u,8750u},{8719u,8719u,213u},{8721u,8721u,212u},
+{8723u,8723u,8726u},{8730u,8730u,178u},{8733u,8733u,180u},{8734u,8734u,136u},
+{8735u,8735u,8717u},{8736u,8736u,148u},{8738u,8738u,8738u},{8741u,8742u,8719u},
+{8743u,8744u,192u},{8745u,8745u,191u},{8746u,8746u,190u},{8747u,8748u,182u},
+{8750u,8750u,211u},{8756u,8756u,137u},{8757u,8757u,181u},{8758u,8758u,210u},
+{8759u,8759u,8321u},{8765u,8765u,179u},{8771u,8771u,8500u},{8773u,8773u,8499u},
+{8776u,8776u,8501u},{8784u,8784u,8739u},{8785u,8785u,8723u},{8786u,8786u,154u},
+{8787u,8787u,8722u},{8794u,8794u,8753u},{8800u,8800u,133u},{8801u,8801u,153u},
+{8802u,8802u,8734u},{8804u,8805u,134u},{8806u,8807u,8724u},{8814u,8815u,8745u},
+{8816u,8819u,8481u},{8822u,8823u,8489u},{8825u,8825u,8491u},{8826u,8827u,8475u},
+{8832u,8833u,8479u},{8834u,8835u,188u},{8836u,8836u,8748u},{8837u,8837u,8747u},
+{8838u,8839u,186u},{8842u,8842u,8486u},{8843u,8843u,8488u},{8853u,8855u,8727u},
+{8867u,8867u,8742u},{8868u,8868u,8503u},{8869u,8869u,149u},{8891u,8892u,8751u},
+{8910u,8911u,8477u},{8922u,8923u,8492u},{8942u,8942u,8320u},{8943u,8943u,106u},
+{8966u,8966u,8754u},{8978u,8978u,150u},{8980u,8980u,8731u},{9312u,9326u,733u},
+{9327u,9331u,8791u},{9332u,9346u,827u},{9347u,9351u,9042u},{9372u,9397u,801u},
+{9398u,9423u,8388u},{9424u,9449u,707u},{9472u,9472u,519u},{9473u,9473u,530u},
+{9474u,9474u,520u},{9475u,9475u,531u},{9484u,9484u,521u},{9485u,9485u,558u},
+{9486u,9486u,557u},{9487u,9487u,532u},{9488u,9488u,522u},{9489u,9489u,552u},
+{9490u,9490u,551u},{9491u,9491u,533u},{9492u,9492u,524u},{9493u,9493u,556u},
+{9494u,9494u,555u},{9495u,9495u,535u},{9496u,9496u,523u},{9497u,9497u,554u},
+{9498u,9498u,553u},{9499u,9499u,534u},{9500u,9500u,525u},{9501u,9501u,546u},
+{9502u,9503u,559u},{9504u,9504u,541u},{9505u,9506u,561u},{9507u,9507u,536u},
+{9508u,9508u,527u},{9509u,9509u,548u},{9510u,9511u,563u},{9512u,9512u,543u},
+{9513u,9514u,565u},{9515u,9515u,538u},{9516u,9516u,526u},{9517u,9518u,567u},
+{9519u,9519u,542u},{9520u,9520u,547u},{9521u,9522u,569u},{9523u,9523u,537u},
+{9524u,9524u,528u},{9525u,9526u,571u},{9527u,9527u,544u},{9528u,9528u,549u},
+{9529u,9530u,573u},{9531u,9531u,539u},{9532u,9532u,529u},{9533u,9534u,575u},
+{9535u,9535u,545u},{9536u,9537u,577u},{9538u,9538u,550u},{9539u,9546u,579u},
+{9547u,9547u,540u},{9618u,9618u,232u},{9632u,9632u,165u},{9633u,9633u,164u},
+{9635u,9635u,229u},{9636u,9637u,233u},{9638u,9638u,237u},{9639u,9639u,236u},
+{9640u,9640u,235u},{9641u,9641u,238u},{9649u,9649u,8736u},{9650u,9650u,167u},
+{9651u,9651u,166u},{9653u,9653u,8780u},{9654u,9654u,220u},{9655u,9655u,219u},
+{9657u,9657u,8781u},{9660u,9660u,169u},{9661u,9661u,168u},{9663u,9663u,8779u},
+{9664u,9664u,218u},{9665u,9665u,217u},{9667u,9667u,8782u},{9670u,9670u,163u},
+{9671u,9671u,162u},{9672u,9672u,228u},{9673u,9673u,227u},{9674u,9674u,8787u},
+{9675u,9675u,159u},{9676u,9676u,8639u},{9678u,9678u,161u},{9679u,9679u,160u},
+{9680u,9681u,230u},{9702u,9702u,8775u},{9711u,9711u,8633u},{9733u,9733u,158u},
+{9734u,9734u,157u},{9742u,9742u,241u},{9743u,9743u,240u},{9756u,9756u,242u},
+{9757u,9757u,9222u},{9758u,9758u,243u},{9759u,9759u,9223u},{9775u,9775u,8664u},
+{9792u,9792u,147u},{9794u,9794u,146u},{9824u,9825u,222u},{9827u,9827u,226u},
+{9828u,9828u,221u},{9829u,9829u,224u},{9831u,9831u,225u},{9832u,9832u,239u},
+{9833u,9834u,253u},{9836u,9836u,255u},{9837u,9837u,252u},{9839u,9839u,8594u},
+{10006u,10006u,8631u},{10010u,10010u,8630u},{10045u,10045u,8604u},{10070u,10070u,8637u},
+{10102u,10111u,8673u},{10122u,10131u,8342u},{12288u,12290u,101u},{12291u,12291u,108u},
+{12296u,12305u,120u},{12306u,12306u,8700u},{12307u,12307u,175u},{12308u,12309u,118u},
+{12310u,12313u,8219u},{12318u,12319u,9322u},{12320u,12320u,8671u},{12342u,12342u,8701u},
+{12353u,12435u,851u},{12449u,12534u,934u},{12539u,12539u,104u},{12540u,12540u,9330u},
+{12593u,12643u,358u},{12644u,12644u,101u},{12645u,12686u,409u},{12800u,12827u,773u},
+{12828u,12828u,257u},{12849u,12849u,8788u},{12857u,12857u,8789u},{12896u,12923u,679u},
+{12927u,12927u,256u},{12938u,12943u,9301u},{12944u,12944u,9300u},{12948u,12948u,9080u},
+{12958u,12958u,8761u},{12965u,12965u,9096u},{13184u,13188u,627u},{13192u,13193u,612u},
+{13194u,13196u,646u},{13197u,13199u,608u},{13200u,13204u,638u},{13205u,13207u,587u},
+{13208u,13208u,591u},{13209u,13218u,597u},{13219u,13222u,593u},{13223u,13224u,615u},
+{13225u,13228u,655u},{13229u,13231u,651u},{13232u,13241u,617u},{13242u,13247u,632u},
+{13248u,13249u,644u},{13250u,13250u,261u},{13251u,13251u,662u},{13252u,13252u,592u},
+{13253u,13253u,650u},{13254u,13254u,665u},{13255u,13255u,259u},{13256u,13256u,614u},
+{13257u,13257u,663u},{13258u,13258u,607u},{13259u,13259u,8790u},{13263u,13263u,611u},
+{13264u,13264u,660u},{13267u,13267u,661u},{13270u,13270u,649u},{13272u,13272u,262u},
+{13275u,13275u,654u},{13276u,13276u,664u},{13277u,13277u,659u},{19968u,19968u,6460u},
+{19969u,19969u,6704u},{19971u,19971u,7364u},{19975u,19975u,4670u},{19976u,19976u,6534u},
+{19977u,19977u,5320u},{19978u,19978u,5331u},{19979u,19979u,7616u},{19981u,19981u,5109u},
+{19985u,19985u,7288u},{19988u,19988u,7041u},{19989u,19989u,5181u},{19990u,19990u,5492u},
+{19992u,19992u,3893u},{19993u,19993u,5041u},{19998u,19998u,5682u},{20013u,20013u,6922u},
+{20018u,20018u,3802u},{20024u,20024u,7882u},{20025u,20025u,4192u},{20027u,20027u,6860u},
+{20034u,20034u,6029u},{20035u,20035u,4154u},{20037u,20037u,3894u},{20043u,20043u,6942u},
+{20045u,20045u,5241u},{20046u,20046u,7800u},{20047u,20047u,7614u},{20054u,20054u,3855u},
+{20056u,20056u,5683u},{20057u,20057u,6380u},{20061u,20061u,3895u},{20062u,20062u,3613u},
+{20063u,20063u,5862u},{20075u,20075u,3500u},{20077u,20077u,4329u},{20083u,20083u,6309u},
+{20086u,20086u,5092u},{20087u,20087u,5315u},{20094u,20094u,3601u},{20098u,20098u,4389u},
+{20102u,20102u,4551u},{20104u,20104u,5934u},{20107u,20107u,5242u},{20108u,20108u,6413u},
+{20110u,20110u,6197u},{20112u,20112u,6252u},{20113u,20113u,6238u},{20114u,20114u,7801u},
+{20116u,20116u,6049u},{20117u,20117u,6705u},{20120u,20120u,4058u},{20123u,20123u,5243u},
+{20126u,20126u,5775u},{20129u,20129u,4696u},{20130u,20130u,7670u},{20132u,20132u,3868u},
+{20133u,20133u,7685u},{20134u,20134u,5947u},{20136u,20136u,7771u},{20139u,20139u,7710u},
+{20140u,20140u,3660u},{20141u,20141u,6706u},{20142u,20142u,4427u},{20150u,20150u,4193u},
+{20154u,20154u,6443u},{20160u,20160u,5771u},{20161u,20161u,6444u},{20164u,20164u,7331u},
+{20167u,20167u,3896u},{20170u,20170u,4038u},{20171u,20171u,3560u},{20173u,20173u,6479u},
+{20180u,20180u,6483u},{20181u,20181u,5244u},{20182u,20182u,7380u},{20183u,20183u,6535u},
+{20184u,20184u,5110u},{20185u,20185u,5418u},{20189u,20189u,4331u},{20191u,20191u,7148u},
+{20195u,20195u,4250u},{20196u,20196u,4489u},{20197u,20197u,6414u},{20208u,20208u,5833u},
+{20210u,20210u,6923u},{20214u,20214u,3602u},{20215u,20215u,3561u},{20219u,20219u,6469u},
+{20225u,20225u,4062u},{20233u,20233u,7671u},{20234u,20234u,6415u},{20235u,20235u,4051u},
+{20237u,20237u,6050u},{20238u,20238u,4063u},{20239u,20239u,5074u},{20240u,20240u,5005u},
+{20241u,20241u,8005u},{20271u,20271u,4988u},{20276u,20276u,4905u},{20278u,20278u,4490u},
+{20280u,20280u,5735u},{20282u,20282u,5245u},{20284u,20284u,5246u},{20285u,20285u,3436u},
+{20291u,20291u,6643u},{20294u,20294u,4194u},{20295u,20295u,6591u},{20296u,20296u,7544u},
+{20301u,20301u,6284u},{20302u,20302u,6592u},{20303u,20303u,6861u},{20304u,20304u,6854u},
+{20305u,20305u,6198u},{20309u,20309u,7617u},{20313u,20313u,5935u},{20314u,20314u,6461u},
+{20315u,20315u,5171u},{20316u,20316u,6509u},{20329u,20329u,7502u},{20335u,20335u,5879u},
+{20336u,20336u,4989u},{20339u,20339u,3437u},{20342u,20342u,4127u},{20346u,20346u,6644u},
+{20350u,20350u,6462u},{20351u,20351u,5247u},{20353u,20353u,5736u},{20355u,20355u,3476u},
+{20356u,20356u,7015u},{20358u,20358u,4420u},{20360u,20360u,7336u},{20362u,20362u,3839u},
+{20363u,20363u,4506u},{20365u,20365u,5692u},{20367u,20367u,6862u},{20369u,20369u,6310u},
+{20374u,20374u,4594u},{20376u,20376u,7042u},{20379u,20379u,3786u},{20381u,20381u,6394u},
+{20398u,20398u,4764u},{20399u,20399u,7966u},{20405u,20405u,7367u},{20406u,20406u,4440u},
+{20415u,20415u,7518u},{20418u,20418u,3705u},{20419u,20419u,7241u},{20420u,20420u,5776u},
+{20425u,20425u,6051u},{20426u,20426u,6902u},{20430u,20430u,6782u},{20433u,20433u,6174u},
+{20435u,20435u,3661u},{20436u,20436u,7734u},{20439u,20439u,5537u},{20442u,20442u,4613u},
+{20445u,20445u,5058u},{20447u,20447u,5248u},{20448u,20448u,7759u},{20449u,20449u,5737u},
+{20462u,20462u,5567u},{20463u,20463u,5111u},{20465u,20465u,3897u},{20467u,20467u,4970u},
+{20469u,20469u,7576u},{20472u,20472u,5093u},{20474u,20474u,5925u},{20482u,20482u,5042u},
+{20486u,20486u,4428u},{20489u,20489u,7092u},{20491u,20491u,3562u},{20493u,20493u,4969u},
+{20497u,20497u,4836u},{20498u,20498u,4269u},{20502u,20502u,7705u},{20505u,20505u,7967u},
+{20506u,20506u,6395u},{20508u,20508u,7134u},{20510u,20510u,3662u},{20511u,20511u,7043u},
+{20513u,20513u,7093u},{20515u,20515u,4941u},{20516u,20516u,7337u},{20518u,20518u,3969u},
+{20519u,20519u,6837u},{20520u,20520u,3585u},{20522u,20522u,6030u},{20523u,20523u,4595u},
+{20524u,20524u,7394u},{20525u,20525u,6131u},{20539u,20539u,5863u},{20547u,20547u,5917u},
+{20551u,20551u,3438u},{20552u,20552u,3627u},{20553u,20553u,6285u},{20559u,20559u,7519u},
+{20565u,20565u,7686u},{20570u,20570u,6863u},{20572u,20572u,6707u},{20581u,20581u,3603u},
+{20596u,20596u,7330u},{20597u,20597u,6708u},{20598u,20598u,6199u},{20600u,20600u,7465u},
+{20608u,20608u,3856u},{20613u,20613u,5112u},{20621u,20621u,4942u},{20625u,20625u,3614u},
+{20632u,20632u,5303u},{20633u,20633u,5182u},{20652u,20652u,7262u},{20653u,20653u,6175u},
+{20658u,20658u,6052u},{20659u,20659u,6645u},{20661u,20661u,7114u},{20663u,20663u,5332u},
+{20670u,20670u,3663u},{20677u,20677u,4023u},{20681u,20681u,7177u},{20682u,20682u,5419u},
+{20687u,20687u,5333u},{20689u,20689u,3869u},{20693u,20693u,5075u},{20694u,20694u,8035u},
+{20698u,20698u,4552u},{20702u,20702u,6286u},{20709u,20709u,6140u},{20711u,20711u,5684u},
+{20717u,20717u,7082u},{20729u,20729u,3439u},{20731u,20731u,5020u},{20735u,20735u,5249u},
+{20736u,20736u,6396u},{20737u,20737u,6903u},{20740u,20740u,5912u},{20742u,20742u,3664u},
+{20745u,20745u,3617u},{20754u,20754u,6311u},{20767u,20767u,5334u},{20769u,20769u,4543u},
+{20778u,20778u,6200u},{20786u,20786u,6593u},{20791u,20791u,4441u},{20794u,20794u,4133u},
+{20796u,20796u,5926u},{20800u,20800u,6089u},{20801u,20801u,6359u},{20803u,20803u,6255u},
+{20804u,20804u,7772u},{20805u,20805u,7306u},{20806u,20806u,6783u},{20807u,20807u,8013u},
+{20808u,20808u,5420u},{20809u,20809u,3840u},{20811u,20811u,4016u},{20812u,20812u,7431u},
+{20813u,20813u,4735u},{20814u,20814u,7449u},{20818u,20818u,5777u},{20828u,20828u,4348u},
+{20834u,20834u,4059u},{20837u,20837u,6477u},{20839u,20839u,4155u},{20840u,20840u,6646u},
+{20841u,20841u,4429u},{20842u,20842u,6312u},{20843u,20843u,7499u},{20844u,20844u,3787u},
+{20845u,20845u,4591u},{20846u,20846u,7791u},{20849u,20849u,3788u},{20853u,20853u,5043u},
+{20854u,20854u,4064u},{20855u,20855u,3898u},{20856u,20856u,6647u},{20860u,20860u,3654u},
+{20864u,20864u,4065u},{20870u,20870u,5933u},{20874u,20874u,7126u},{20877u,20877u,6570u},
+{20882u,20882u,4765u},{20885u,20885u,4736u},{20887u,20887u,6176u},{20896u,20896u,3819u},
+{20901u,20901u,4748u},{20906u,20906u,4733u},{20908u,20908u,4332u},{20918u,20918u,5864u},
+{20919u,20919u,4424u},{20925u,20925u,4477u},{20932u,20932u,7130u},{20934u,20934u,6904u},
+{20937u,20937u,4430u},{20939u,20939u,6784u},{20940u,20940u,4607u},{20941u,20941u,4333u},
+{20956u,20956u,4606u},{20957u,20957u,6390u},{20958u,20958u,8036u},{20961u,20961u,5009u},
+{20976u,20976u,7904u},{20977u,20977u,3563u},{20982u,20982u,8014u},{20984u,20984u,7167u},
+{20985u,20985u,6141u},{20986u,20986u,7303u},{20989u,20989u,7651u},{20992u,20992u,4270u},
+{20995u,20995u,6445u},{20998u,20998u,5152u},{20999u,20999u,6684u},{21000u,21000u,6031u},
+{21002u,21002u,3477u},{21006u,21006u,4837u},{21009u,21009u,7773u},{21015u,21015u,4478u},
+{21021u,21021u,7214u},{21028u,21028u,7490u},{21029u,21029u,5037u},{21033u,21033u,4614u},
+{21034u,21034u,5304u},{21038u,21038u,3835u},{21040u,21040u,4271u},{21046u,21046u,6759u},
+{21047u,21047u,5561u},{21048u,21048u,3970u},{21049u,21049u,7077u},{21050u,21050u,6484u},
+{21051u,21051u,3465u},{21059u,21059u,7205u},{21063u,21063u,7360u},{21066u,21066u,5301u},
+{21067u,21067u,4017u},{21068u,21068u,4397u},{21069u,21069u,6648u},{21076u,21076u,7135u},
+{21078u,21078u,5113u},{21083u,21083u,3536u},{21085u,21085u,4886u},{21089u,21089u,5463u},
+{21097u,21097u,6480u},{21098u,21098u,6649u},{21103u,21103u,5114u},{21106u,21106u,7649u},
+{21109u,21109u,7094u},{21117u,21117u,7577u},{21119u,21119u,7215u},{21123u,21123u,7948u},
+{21127u,21127u,4018u},{21128u,21128u,5021u},{21129u,21129u,4577u},{21133u,21133u,3618u},
+{21137u,21137u,6760u},{21138u,21138u,3619u},{21147u,21147u,4458u},{21151u,21151u,3789u},
+{21152u,21152u,3440u},{21155u,21155u,4479u},{21156u,21156u,4024u},{21161u,21161u,6785u},
+{21162u,21162u,4169u},{21163u,21163u,3624u},{21182u,21182u,7703u},{21185u,21185u,3665u},
+{21187u,21187u,4930u},{21189u,21189u,7361u},{21191u,21191u,6177u},{21193u,21193u,4737u},
+{21197u,21197u,3666u},{21202u,21202u,4604u},{21205u,21205u,4334u},{21206u,21206u,6229u},
+{21208u,21208u,3510u},{21209u,21209u,4812u},{21211u,21211u,7979u},{21213u,21213u,5685u},
+{21214u,21214u,4511u},{21215u,21215u,4766u},{21218u,21218u,5493u},{21219u,21219u,6619u},
+{21220u,21220u,4025u},{21235u,21235u,7980u},{21237u,21237u,4442u},{21240u,21240u,3971u},
+{21242u,21242u,6510u},{21243u,21243u,4009u},{21246u,21246u,3899u},{21247u,21247u,4848u},
+{21253u,21253u,7545u},{21256u,21256u,8015u},{21261u,21261u,7546u},{21263u,21263u,7547u},
+{21264u,21264u,5076u},{21269u,21269u,5183u},{21270u,21270u,7863u},{21271u,21271u,5151u},
+{21273u,21273u,5693u},{21280u,21280u,6536u},{21281u,21281u,3841u},{21283u,21283u,3530u},
+{21290u,21290u,5184u},{21295u,21295u,7928u},{21305u,21305u,7604u},{21311u,21311u,4188u},
+{21312u,21312u,3900u},{21313u,21313u,5772u},{21315u,21315u,7149u},{21316u,21316u,6478u},
+{21319u,21319u,5686u},{21320u,21320u,6053u},{21321u,21321u,7994u},{21322u,21322u,4906u},
+{21325u,21325u,4671u},{21329u,21329u,5185u},{21330u,21330u,6834u},{21331u,21331u,7395u},
+{21332u,21332u,7760u},{21335u,21335u,4145u},{21338u,21338u,4887u},{21340u,21340u,5077u},
+{21342u,21342u,5031u},{21344u,21344u,6692u},{21350u,21350u,3852u},{21352u,21352u,5450u},
+{21359u,21359u,4800u},{21360u,21360u,6446u},{21361u,21361u,6287u},{21364u,21364u,3466u},
+{21365u,21365u,4390u},{21367u,21367u,3972u},{21373u,21373u,6926u},{21375u,21375u,3667u},
+{21380u,21380u,5851u},{21395u,21395u,5840u},{21400u,21400u,4615u},{21402u,21402u,7968u},
+{21407u,21407u,6256u},{21408u,21408u,7332u},{21413u,21413u,3979u},{21414u,21414u,7618u},
+{21421u,21421u,5989u},{21435u,21435u,3586u},{21443u,21443u,7083u},{21448u,21448u,6201u},
+{21449u,21449u,7044u},{21450u,21450u,4052u},{21451u,21451u,6202u},{21453u,21453u,4907u},
+{21460u,21460u,5628u},{21462u,21462u,7316u},{21463u,21463u,5568u},{21467u,21467u,4908u},
+{21473u,21473u,6032u},{21474u,21474u,7251u},{21475u,21475u,3901u},{21476u,21476u,3729u},
+{21477u,21477u,3902u},{21481u,21481u,3730u},{21482u,21482u,6943u},{21483u,21483u,3994u},
+{21484u,21484u,5500u},{21485u,21485u,7500u},{21487u,21487u,3441u},{21488u,21488u,7432u},
+{21489u,21489u,7016u},{21490u,21490u,5250u},{21491u,21491u,6203u},{21496u,21496u,5251u},
+{21507u,21507u,8023u},{21508u,21508u,3467u},{21512u,21512u,7663u},{21513u,21513u,4128u},
+{21514u,21514u,6620u},{21516u,21516u,4335u},{21517u,21517u,4749u},{21518u,21518u,7969u},
+{21519u,21519u,4616u},{21520u,21520u,7450u},{21521u,21521u,7711u},{21531u,21531u,3953u},
+{21533u,21533u,4638u},{21535u,21535u,6381u},{21536u,21536u,7534u},{21542u,21542u,5115u},
+{21545u,21545u,5153u},{21547u,21547u,7652u},{21555u,21555u,6055u},{21560u,21560u,8030u},
+{21561u,21561u,7317u},{21563u,21563u,4838u},{21564u,21564u,7970u},{21566u,21566u,6054u},
+{21570u,21570u,4443u},{21576u,21576u,6709u},{21578u,21578u,3731u},{21585u,21585u,7408u},
+{21608u,21608u,6867u},{21610u,21610u,6866u},{21617u,21617u,3732u},{21619u,21619u,4851u},
+{21621u,21621u,3442u},{21627u,21627u,5738u},{21628u,21628u,7802u},{21629u,21629u,4750u},
+{21632u,21632u,6594u},{21638u,21638u,7548u},{21644u,21644u,7864u},{21646u,21646u,3903u},
+{21648u,21648u,5116u},{21668u,21668u,7381u},{21672u,21672u,6485u},{21675u,21675u,6944u},
+{21676u,21676u,3870u},{21683u,21683u,7687u},{21688u,21688u,7653u},{21693u,21693u,6447u},
+{21696u,21696u,5841u},{21697u,21697u,7590u},{21700u,21700u,7853u},{21704u,21704u,7664u},
+{21705u,21705u,6571u},{21729u,21729u,6257u},{21733u,21733u,3443u},{21736u,21736u,7216u},
+{21741u,21741u,3767u},{21742u,21742u,7953u},{21746u,21746u,7168u},{21754u,21754u,7549u},
+{21764u,21764u,7503u},{21766u,21766u,5252u},{21767u,21767u,6980u},{21774u,21774u,4617u},
+{21776u,21776u,4239u},{21788u,21788u,4689u},{21807u,21807u,6313u},{21809u,21809u,7095u},
+{21813u,21813u,5821u},{21822u,21822u,7382u},{21828u,21828u,7396u},{21830u,21830u,5335u},
+{21839u,21839u,4839u},{21843u,21843u,3706u},{21846u,21846u,4217u},{21854u,21854u,5778u},
+{21859u,21859u,7654u},{21884u,21884u,6761u},{21888u,21888u,3579u},{21892u,21892u,5421u},
+{21894u,21894u,7169u},{21895u,21895u,4374u},{21897u,21897u,7971u},{21898u,21898u,7655u},
+{21912u,21912u,7150u},{21913u,21913u,7995u},{21914u,21914u,7883u},{21916u,21916u,8037u},
+{21917u,21917u,3501u},{21927u,21927u,7990u},{21929u,21929u,6314u},{21930u,21930u,5336u},
+{21931u,21931u,4132u},{21932u,21932u,3871u},{21934u,21934u,4195u},{21957u,21957u,7972u},
+{21959u,21959u,5365u},{21972u,21972u,6981u},{21978u,21978u,6056u},{21980u,21980u,4066u},
+{21983u,21983u,7045u},{21987u,21987u,5253u},{21988u,21988u,7338u},{22013u,22013u,5569u},
+{22014u,22014u,6868u},{22022u,22022u,7409u},{22025u,22025u,3444u},{22036u,22036u,3904u},
+{22039u,22039u,5337u},{22063u,22063u,5501u},{22066u,22066u,6786u},{22068u,22068u,7318u},
+{22070u,22070u,5694u},{22099u,22099u,7719u},{22120u,22120u,4067u},{22123u,22123u,8038u},
+{22132u,22132u,5154u},{22150u,22150u,7954u},{22181u,22181u,5956u},{22188u,22188u,5223u},
+{22190u,22190u,7712u},{22196u,22196u,5927u},{22204u,22204u,6511u},{22218u,22218u,4152u},
+{22221u,22221u,8039u},{22225u,22225u,7242u},{22234u,22234u,5570u},{22235u,22235u,5254u},
+{22238u,22238u,7929u},{22240u,22240u,6448u},{22256u,22256u,3774u},{22265u,22265u,4491u},
+{22266u,22266u,3733u},{22275u,22275u,7550u},{22276u,22276u,5902u},{22280u,22280u,3973u},
+{22283u,22283u,3947u},{22285u,22285u,6288u},{22290u,22290u,6259u},{22291u,22291u,6258u},
+{22294u,22294u,4272u},{22296u,22296u,4196u},{22303u,22303u,7451u},{22312u,22312u,6572u},
+{22317u,22317u,3995u},{22320u,22320u,6945u},{22331u,22331u,4068u},{22336u,22336u,6946u},
+{22338u,22338u,7491u},{22343u,22343u,4010u},{22346u,22346u,4943u},{22349u,22349u,4218u},
+{22350u,22350u,3511u},{22352u,22352u,6855u},{22353u,22353u,3581u},{22369u,22369u,7474u},
+{22372u,22372u,3775u},{22374u,22374u,7410u},{22378u,22378u,7529u},{22382u,22382u,4252u},
+{22384u,22384u,3668u},{22389u,22389u,3905u},{22396u,22396u,7397u},{22402u,22402u,5571u},
+{22408u,22408u,4251u},{22411u,22411u,7774u},{22419u,22419u,7688u},{22432u,22432u,6373u},
+{22434u,22434u,3906u},{22435u,22435u,6260u},{22467u,22467u,5842u},{22471u,22471u,6178u},
+{22472u,22472u,6905u},{22475u,22475u,4708u},{22478u,22478u,5474u},{22495u,22495u,5948u},
+{22496u,22496u,5117u},{22512u,22512u,7115u},{22516u,22516u,5720u},{22519u,22519u,7032u},
+{22521u,22521u,4971u},{22522u,22522u,4069u},{22524u,22524u,4070u},{22528u,22528u,3959u},
+{22530u,22530u,4240u},{22533u,22533u,3637u},{22534u,22534u,7459u},{22536u,22536u,3537u},
+{22537u,22537u,6355u},{22538u,22538u,5793u},{22558u,22558u,7187u},{22561u,22561u,5059u},
+{22564u,22564u,6762u},{22567u,22567u,5957u},{22570u,22570u,3512u},{22575u,22575u,6142u},
+{22576u,22576u,5918u},{22577u,22577u,5060u},{22580u,22580u,6537u},{22581u,22581u,4273u},
+{22586u,22586u,3707u},{22602u,22602u,3857u},{22603u,22603u,6002u},{22607u,22607u,3564u},
+{22609u,22609u,5502u},{22612u,22612u,7424u},{22615u,22615u,4274u},{22616u,22616u,4241u},
+{22618u,22618u,7252u},{22622u,22622u,5362u},{22625u,22625u,6650u},{22626u,22626u,6057u},
+{22628u,22628u,7981u},{22645u,22645u,6982u},{22649u,22649u,7084u},{22652u,22652u,6651u},
+{22654u,22654u,5629u},{22659u,22659u,3669u},{22661u,22661u,5373u},{22665u,22665u,6179u},
+{22675u,22675u,4801u},{22684u,22684u,7265u},{22686u,22686u,6931u},{22687u,22687u,7720u},
+{22696u,22696u,4834u},{22697u,22697u,4319u},{22702u,22702u,7383u},{22707u,22707u,5155u},
+{22714u,22714u,6058u},{22715u,22715u,6538u},{22718u,22718u,3478u},{22721u,22721u,5022u},
+{22725u,22725u,6090u},{22727u,22727u,4197u},{22734u,22734u,7982u},{22737u,22737u,7630u},
+{22739u,22739u,5829u},{22741u,22741u,7803u},{22744u,22744u,4564u},{22745u,22745u,3842u},
+{22750u,22750u,3858u},{22751u,22751u,4536u},{22756u,22756u,5880u},{22763u,22763u,5255u},
+{22764u,22764u,6470u},{22767u,22767u,6539u},{22777u,22777u,6463u},{22778u,22778u,7804u},
+{22779u,22779u,5374u},{22781u,22781u,5572u},{22799u,22799u,7619u},{22804u,22804u,4071u},
+{22805u,22805u,5403u},{22806u,22806u,6135u},{22809u,22809u,5630u},{22810u,22810u,4190u},
+{22812u,22812u,5865u},{22818u,22818u,4797u},{22823u,22823u,4253u},{22825u,22825u,7151u},
+{22826u,22826u,7433u},{22827u,22827u,5118u},{22829u,22829u,6143u},{22830u,22830u,5834u},
+{22833u,22833u,5758u},{22839u,22839u,6416u},{22846u,22846u,7761u},{22852u,22852u,5928u},
+{22855u,22855u,4072u},{22856u,22856u,4156u},{22857u,22857u,5094u},{22862u,22862u,3996u},
+{22863u,22863u,6869u},{22864u,22864u,7884u},{22865u,22865u,3708u},{22868u,22868u,5156u},
+{22869u,22869u,7730u},{22871u,22871u,7466u},{22874u,22874u,7689u},{22880u,22880u,6652u},
+{22882u,22882u,5256u},{22887u,22887u,6059u},{22890u,22890u,7418u},{22891u,22891u,6360u},
+{22892u,22892u,6540u},{22893u,22893u,5404u},{22894u,22894u,5157u},{22899u,22899u,4159u},
+{22900u,22900u,4170u},{22904u,22904u,3479u},{22909u,22909u,7805u},{22914u,22914u,5936u},
+{22915u,22915u,5186u},{22916u,22916u,4697u},{22922u,22922u,6471u},{22931u,22931u,4073u},
+{22934u,22934u,6144u},{22935u,22935u,4039u},{22937u,22937u,4802u},{22949u,22949u,7384u},
+{22952u,22952u,4944u},{22956u,22956u,7467u},{22969u,22969u,4709u},{22971u,22971u,7131u},
+{22974u,22974u,7188u},{22979u,22979u,6710u},{22982u,22982u,4767u},{22985u,22985u,6486u},
+{22987u,22987u,5695u},{22992u,22992u,6595u},{22993u,22993u,3734u},{22995u,22995u,5475u},
+{22996u,22996u,6289u},{23001u,23001u,6472u},{23002u,23002u,6145u},{23004u,23004u,3538u},
+{23005u,23005u,6864u},{23014u,23014u,3480u},{23016u,23016u,6417u},{23018u,23018u,7017u},
+{23020u,23020u,8040u},{23022u,23022u,7672u},{23032u,23032u,5958u},{23035u,23035u,6449u},
+{23039u,23039u,6487u},{23041u,23041u,6290u},{23043u,23043u,6132u},{23057u,23057u,5257u},
+{23064u,23064u,4153u},{23067u,23067u,6060u},{23068u,23068u,4134u},{23071u,23071u,5959u},
+{23072u,23072u,5739u},{23077u,23077u,5779u},{23081u,23081u,4672u},{23094u,23094u,7319u},
+{23100u,23100u,7096u},{23105u,23105u,4565u},{23110u,23110u,7475u},{23113u,23113u,6107u},
+{23130u,23130u,7844u},{23138u,23138u,5187u},{23142u,23142u,5119u},{23186u,23186u,4710u},
+{23194u,23194u,4852u},{23195u,23195u,6261u},{23204u,23204u,5696u},{23233u,23233u,3445u},
+{23234u,23234u,5573u},{23236u,23236u,6262u},{23241u,23241u,7018u},{23244u,23244u,7758u},
+{23265u,23265u,6621u},{23270u,23270u,7673u},{23273u,23273u,4181u},{23301u,23301u,7865u},
+{23305u,23305u,8041u},{23307u,23307u,5422u},{23308u,23308u,3872u},{23318u,23318u,7535u},
+{23338u,23338u,5224u},{23360u,23360u,5338u},{23363u,23363u,5881u},{23376u,23376u,6488u},
+{23377u,23377u,7754u},{23380u,23380u,3790u},{23381u,23381u,6481u},{23383u,23383u,6489u},
+{23384u,23384u,6832u},{23386u,23386u,5120u},{23388u,23388u,6490u},{23389u,23389u,7955u},
+{23391u,23391u,4727u},{23395u,23395u,3709u},{23396u,23396u,3735u},{23401u,23401u,7690u},
+{23403u,23403u,5546u},{23408u,23408u,5631u},{23409u,23409u,6522u},{23413u,23413u,5121u},
+{23416u,23416u,7631u},{23418u,23418u,6315u},{23420u,23420u,5923u},{23429u,23429u,4266u},
+{23431u,23431u,6204u},{23432u,23432u,5574u},{23433u,23433u,5807u},{23435u,23435u,5553u},
+{23436u,23436u,6108u},{23439u,23439u,3864u},{23443u,23443u,5078u},{23445u,23445u,7427u},
+{23446u,23446u,7950u},{23447u,23447u,6838u},{23448u,23448u,3820u},{23449u,23449u,6870u},
+{23450u,23450u,6711u},{23451u,23451u,6109u},{23452u,23452u,6397u},{23458u,23458u,3580u},
+{23459u,23459u,5423u},{23460u,23460u,5759u},{23461u,23461u,6316u},{23462u,23462u,7885u},
+{23468u,23468u,5476u},{23470u,23470u,3963u},{23472u,23472u,6573u},{23475u,23475u,7691u},
+{23476u,23476u,5960u},{23477u,23477u,5503u},{23478u,23478u,3446u},{23480u,23480u,5740u},
+{23481u,23481u,6180u},{23487u,23487u,5632u},{23488u,23488u,7116u},{23490u,23490u,6622u},
+{23491u,23491u,6263u},{23492u,23492u,4074u},{23493u,23493u,6450u},{23494u,23494u,4883u},
+{23495u,23495u,3907u},{23500u,23500u,5122u},{23504u,23504u,4711u},{23506u,23506u,7635u},
+{23507u,23507u,6205u},{23508u,23508u,5721u},{23511u,23511u,4168u},{23518u,23518u,4664u},
+{23519u,23519u,7078u},{23521u,23521u,3803u},{23522u,23522u,7368u},{23524u,23524u,6061u},
+{23525u,23525u,6146u},{23526u,23526u,5760u},{23527u,23527u,4167u},{23528u,23528u,7117u},
+{23529u,23529u,5762u},{23531u,23531u,5258u},{23532u,23532u,3821u},{23534u,23534u,4553u},
+{23535u,23535u,6906u},{23541u,23541u,7253u},{23542u,23542u,5061u},{23544u,23544u,7247u},
+{23546u,23546u,5259u},{23553u,23553u,5095u},{23556u,23556u,5260u},{23559u,23559u,6541u},
+{23560u,23560u,6653u},{23561u,23561u,6291u},{23562u,23562u,6833u},{23563u,23563u,5763u},
+{23565u,23565u,4254u},{23566u,23566u,4275u},{23567u,23567u,5504u},{23569u,23569u,5505u},
+{23574u,23574u,7178u},{23577u,23577u,5339u},{23588u,23588u,6206u},{23592u,23592u,4945u},
+{23601u,23601u,7320u},{23608u,23608u,5697u},{23609u,23609u,6361u},{23610u,23610u,7136u},
+{23611u,23611u,3736u},{23612u,23612u,4186u},{23614u,23614u,4853u},{23615u,23615u,4180u},
+{23616u,23616u,3948u},{23621u,23621u,3587u},{23622u,23622u,3710u},{23624u,23624u,3960u},
+{23627u,23627u,6078u},{23629u,23629u,5699u},{23630u,23630u,5698u},{23633u,23633u,5451u},
+{23637u,23637u,6654u},{23643u,23643u,5044u},{23648u,23648u,4276u},{23650u,23650u,4566u},
+{23652u,23652u,7335u},{23653u,23653u,4618u},{23660u,23660u,5538u},{23663u,23663u,4358u},
+{23665u,23665u,5305u},{23673u,23673u,8024u},{23696u,23696u,4075u},{23697u,23697u,6527u},
+{23713u,23713u,3539u},{23721u,23721u,5822u},{23723u,23723u,5575u},{23724u,23724u,3531u},
+{23729u,23729u,4255u},{23731u,23731u,5794u},{23733u,23733u,7806u},{23735u,23735u,4870u},
+{23736u,23736u,5808u},{23738u,23738u,4492u},{23742u,23742u,6693u},{23744u,23744u,5576u},
+{23769u,23769u,7339u},{23776u,23776u,5340u},{23784u,23784u,5780u},{23791u,23792u,5096u},
+{23796u,23796u,7735u},{23798u,23798u,4277u},{23803u,23803u,6907u},{23805u,23805u,7762u},
+{23815u,23815u,5671u},{23821u,23821u,4421u},{23822u,23822u,4076u},{23825u,23825u,3776u},
+{23828u,23828u,7263u},{23830u,23830u,5843u},{23831u,23831u,3540u},{23833u,23833u,4596u},
+{23847u,23847u,5672u},{23849u,23849u,5175u},{23883u,23883u,4854u},{23884u,23884u,3513u},
+{23888u,23888u,4399u},{23913u,23913u,5673u},{23916u,23916u,6136u},{23919u,23919u,7046u},
+{23943u,23943u,3908u},{23947u,23947u,4278u},{23965u,23965u,4365u},{23968u,23968u,3873u},
+{23970u,23970u,6147u},{23978u,23978u,5931u},{23992u,23992u,6003u},{23994u,23994u,4493u},
+{23996u,23996u,5375u},{23997u,23997u,5795u},{24013u,24013u,6137u},{24018u,24018u,4673u},
+{24022u,24022u,5823u},{24029u,24029u,7152u},{24030u,24030u,6871u},{24033u,24033u,5640u},
+{24034u,24034u,5506u},{24037u,24037u,3791u},{24038u,24038u,6856u},{24039u,24039u,3874u},
+{24040u,24040u,3588u},{24043u,24043u,4813u},{24046u,24046u,7047u},{24049u,24049u,4077u},
+{24050u,24050u,6418u},{24051u,24051u,5261u},{24052u,24052u,7476u},{24055u,24055u,7674u},
+{24061u,24061u,5547u},{24062u,24062u,3604u},{24066u,24066u,5700u},{24067u,24067u,7551u},
+{24070u,24070u,5010u},{24076u,24076u,8042u},{24081u,24081u,7428u},{24086u,24086u,7189u},
+{24089u,24089u,7019u},{24091u,24091u,4990u},{24093u,24093u,6763u},{24101u,24101u,5577u},
+{24107u,24107u,5262u},{24109u,24109u,5405u},{24115u,24115u,6542u},{24118u,24118u,4256u},
+{24120u,24120u,5341u},{24125u,24125u,4768u},{24127u,24127u,7973u},{24128u,24128u,6712u},
+{24132u,24132u,5796u},{24133u,24133u,7571u},{24135u,24135u,4946u},{24140u,24140u,7905u},
+{24149u,24149u,4665u},{24159u,24159u,7340u},{24161u,24161u,4996u},{24162u,24162u,4242u},
+{24163u,24163u,7536u},{24178u,24178u,3481u},{24179u,24179u,7530u},{24180u,24180u,4160u},
+{24183u,24183u,5045u},{24184u,24184u,7706u},{24185u,24185u,3482u},{24187u,24187u,7886u},
+{24188u,24189u,6317u},{24190u,24190u,4078u},{24196u,24196u,6543u},{24199u,24199u,5188u},
+{24202u,24202u,5342u},{24207u,24207u,5376u},{24213u,24213u,6596u},{24215u,24215u,6694u},
+{24218u,24218u,3670u},{24220u,24220u,5123u},{24224u,24224u,5343u},{24230u,24230u,4279u},
+{24231u,24231u,6857u},{24235u,24235u,3737u},{24237u,24237u,6713u},{24245u,24245u,5824u},
+{24246u,24246u,5377u},{24247u,24247u,3541u},{24248u,24248u,6181u},{24254u,24254u,6319u},
+{24258u,24258u,5344u},{24264u,24264u,7620u},{24265u,24265u,4483u},{24266u,24266u,4412u},
+{24272u,24272u,3909u},{24275u,24275u,3815u},{24278u,24278u,4554u},{24282u,24282u,6872u},
+{24283u,24283u,6655u},{24287u,24287u,4803u},{24288u,24288u,7097u},{24290u,24290u,7537u},
+{24291u,24291u,3843u},{24300u,24300u,4444u},{24307u,24307u,7197u},{24310u,24310u,5961u},
+{24311u,24311u,6714u},{24314u,24314u,3605u},{24315u,24315u,7930u},{24321u,24321u,5032u},
+{24324u,24324u,4537u},{24330u,24330u,7538u},{24335u,24335u,5722u},{24337u,24337u,5701u},
+{24339u,24339u,3964u},{24340u,24340u,6787u},{24341u,24341u,6451u},{24343u,24343u,5172u},
+{24344u,24344u,7854u},{24347u,24347u,6419u},{24351u,24351u,6764u},{24358u,24358u,7736u},
+{24359u,24359u,7807u},{24361u,24361u,4171u},{24369u,24369u,5872u},{24373u,24373u,6544u},
+{24378u,24378u,3542u},{24380u,24380u,7605u},{24392u,24392u,7411u},{24394u,24394u,3543u},
+{24396u,24396u,4855u},{24398u,24398u,4674u},{24406u,24406u,4198u},{24407u,24407u,7792u},
+{24409u,24409u,7997u},{24411u,24411u,6420u},{24418u,24418u,7775u},{24422u,24422u,5919u},
+{24423u,24423u,6230u},{24425u,24425u,7118u},{24426u,24426u,7578u},{24427u,24427u,6788u},
+{24428u,24428u,5225u},{24429u,24429u,7513u},{24432u,24432u,7098u},{24433u,24433u,6004u},
+{24439u,24439u,4947u},{24441u,24441u,5949u},{24444u,24444u,7597u},{24447u,24447u,5173u},
+{24448u,24448u,6126u},{24449u,24449u,6715u},{24453u,24453u,4257u},{24455u,24455u,5641u},
+{24458u,24458u,7931u},{24459u,24459u,4600u},{24460u,24460u,7974u},{24464u,24464u,5378u},
+{24465u,24465u,3671u},{24466u,24466u,4280u},{24471u,24471u,4364u},{24472u,24472u,4972u},
+{24473u,24473u,5263u},{24478u,24478u,6839u},{24480u,24480u,4422u},{24481u,24481u,5903u},
+{24488u,24488u,7906u},{24489u,24489u,5079u},{24490u,24490u,5642u},{24494u,24494u,4856u},
+{24501u,24501u,7038u},{24503u,24503u,4267u},{24505u,24505u,7170u},{24509u,24509u,7998u},
+{24515u,24515u,5764u},{24517u,24517u,7606u},{24524u,24524u,4079u},{24525u,24525u,6452u},
+{24534u,24534u,7248u},{24535u,24535u,6947u},{24536u,24537u,4698u},{24544u,24544u,7307u},
+{24555u,24555u,7379u},{24565u,24565u,4163u},{24573u,24573u,7850u},{24575u,24575u,5158u},
+{24591u,24591u,5835u},{24594u,24594u,4172u},{24598u,24598u,7552u},{24604u,24604u,4494u},
+{24605u,24605u,5264u},{24608u,24608u,7434u},{24609u,24609u,6421u},{24613u,24613u,4053u},
+{24615u,24615u,5477u},{24616u,24616u,6264u},{24618u,24618u,3859u},{24623u,24623u,3625u},
+{24641u,24641u,6473u},{24642u,24642u,5643u},{24643u,24643u,5702u},{24653u,24653u,7907u},
+{24656u,24656u,3792u},{24658u,24658u,7675u},{24661u,24661u,5379u},{24665u,24665u,5882u},
+{24669u,24669u,3836u},{24674u,24674u,7932u},{24675u,24675u,6491u},{24676u,24676u,8010u},
+{24677u,24677u,7341u},{24680u,24680u,7636u},{24681u,24681u,6374u},{24682u,24682u,3468u},
+{24684u,24684u,4164u},{24685u,24685u,3793u},{24687u,24687u,5723u},{24688u,24688u,8031u},
+{24709u,24709u,5985u},{24713u,24713u,5761u},{24716u,24716u,6765u},{24717u,24717u,7637u},
+{24724u,24724u,7933u},{24726u,24726u,7504u},{24730u,24730u,5554u},{24731u,24731u,6656u},
+{24735u,24735u,6062u},{24736u,24736u,6320u},{24739u,24739u,7887u},{24740u,24740u,7254u},
+{24743u,24743u,4619u},{24752u,24752u,6840u},{24754u,24754u,5189u},{24755u,24755u,4268u},
+{24756u,24756u,7312u},{24758u,24758u,4871u},{24760u,24760u,3711u},{24764u,24764u,4281u},
+{24765u,24765u,7132u},{24773u,24773u,6716u},{24775u,24775u,4320u},{24785u,24785u,7841u},
+{24794u,24794u,7851u},{24796u,24796u,5406u},{24799u,24799u,6321u},{24800u,24800u,7793u},
+{24801u,24801u,5797u},{24816u,24816u,7385u},{24817u,24817u,4178u},{24819u,24819u,5345u},
+{24822u,24822u,7908u},{24825u,24825u,5866u},{24826u,24826u,5478u},{24827u,24827u,7333u},
+{24833u,24833u,5578u},{24838u,24838u,3606u},{24840u,24841u,6322u},{24845u,24845u,4872u},
+{24846u,24846u,7517u},{24847u,24847u,6398u},{24853u,24853u,5798u},{24858u,24858u,6207u},
+{24859u,24859u,5844u},{24863u,24863u,3514u},{24871u,24871u,3860u},{24880u,24880u,7909u},
+{24884u,24884u,7099u},{24887u,24887u,3565u},{24892u,24892u,5741u},{24894u,24894u,3566u},
+{24895u,24895u,6265u},{24898u,24898u,6182u},{24900u,24900u,4601u},{24903u,24903u,6375u},
+{24904u,24904u,6492u},{24906u,24906u,3655u},{24907u,24907u,7435u},{24908u,24908u,7910u},
+{24915u,24915u,7579u},{24917u,24917u,4769u},{24920u,24921u,7085u},{24925u,24925u,7471u},
+{24927u,24927u,7453u},{24930u,24930u,4675u},{24931u,24931u,3822u},{24932u,24932u,3469u},
+{24935u,24935u,7794u},{24936u,24936u,3567u},{24939u,24939u,6841u},{24942u,24942u,4445u},
+{24944u,24944u,6292u},{24950u,24950u,3672u},{24951u,24951u,3544u},{24957u,24957u,7137u},
+{24958u,24958u,6168u},{24961u,24961u,7255u},{24962u,24962u,6208u},{24970u,24970u,5190u},
+{24974u,24974u,6932u},{24976u,24976u,4465u},{24977u,24977u,5237u},{24980u,24980u,7217u},
+{24984u,24984u,8044u},{24985u,24985u,8043u},{24986u,24986u,7412u},{24996u,24996u,5159u},
+{24999u,24999u,4336u},{25001u,25001u,3628u},{25003u,25003u,4873u},{25004u,25004u,3673u},
+{25006u,25006u,4814u},{25010u,25010u,7723u},{25014u,25014u,5913u},{25018u,25018u,4219u},
+{25022u,25022u,3515u},{25027u,25027u,4026u},{25031u,25031u,3483u},{25032u,25032u,7692u},
+{25033u,25033u,6391u},{25034u,25034u,6063u},{25035u,25035u,4815u},{25062u,25062u,4135u},
+{25074u,25074u,7039u},{25078u,25078u,4375u},{25079u,25079u,7934u},{25080u,25080u,7737u},
+{25082u,25082u,7087u},{25084u,25084u,3910u},{25087u,25087u,6399u},{25088u,25088u,4466u},
+{25095u,25095u,4243u},{25096u,25096u,3804u},{25098u,25098u,4816u},{25100u,25100u,5667u},
+{25101u,25101u,5579u},{25102u,25102u,6369u},{25104u,25104u,5479u},{25105u,25105u,5781u},
+{25106u,25106u,3712u},{25110u,25110u,7842u},{25114u,25114u,7138u},{25119u,25119u,4019u},
+{25121u,25121u,3516u},{25130u,25130u,6685u},{25134u,25134u,4592u},{25136u,25136u,6657u},
+{25137u,25137u,8045u},{25140u,25140u,4258u},{25142u,25142u,7808u},{25150u,25150u,4446u},
+{25151u,25151u,4948u},{25152u,25152u,5507u},{25153u,25153u,7520u},{25159u,25159u,5424u},
+{25160u,25160u,7809u},{25161u,25161u,5191u},{25163u,25163u,5580u},{25165u,25165u,6574u},
+{25171u,25171u,7386u},{25176u,25176u,7398u},{25198u,25198u,5160u},{25201u,25201u,4054u},
+{25206u,25206u,5124u},{25209u,25209u,5192u},{25212u,25212u,5852u},{25215u,25215u,5687u},
+{25216u,25216u,4080u},{25220u,25220u,7218u},{25225u,25225u,3648u},{25226u,25226u,7477u},
+{25233u,25233u,5914u},{25234u,25234u,5380u},{25237u,25237u,7468u},{25239u,25239u,7676u},
+{25240u,25240u,6686u},{25243u,25243u,7553u},{25259u,25259u,7598u},{25265u,25265u,7554u},
+{25269u,25269u,6597u},{25273u,25273u,4690u},{25276u,25276u,5830u},{25277u,25277u,7266u},
+{25282u,25282u,5174u},{25287u,25287u,4817u},{25288u,25288u,4165u},{25289u,25289u,4409u},
+{25292u,25292u,4909u},{25293u,25293u,4888u},{25295u,25295u,4136u},{25296u,25296u,3861u},
+{25298u,25298u,3589u},{25299u,25299u,7139u},{25300u,25300u,4931u},{25302u,25302u,7387u},
+{25303u,25303u,6148u},{25304u,25304u,3911u},{25305u,25305u,6835u},{25307u,25307u,7219u},
+{25308u,25308u,4973u},{25324u,25324u,3837u},{25325u,25325u,5724u},{25326u,25326u,4129u},
+{25327u,25327u,6934u},{25329u,25329u,3794u},{25331u,25331u,3974u},{25335u,25335u,3738u},
+{25342u,25342u,5678u},{25343u,25343u,4137u},{25345u,25345u,6948u},{25351u,25351u,6949u},
+{25353u,25353u,5809u},{25361u,25361u,4282u},{25387u,25387u,6858u},{25391u,25391u,6983u},
+{25402u,25402u,6717u},{25403u,25403u,5963u},{25405u,25405u,4676u},{25406u,25406u,7763u},
+{25417u,25417u,7055u},{25420u,25420u,7501u},{25423u,25423u,4143u},{25424u,25424u,5962u},
+{25429u,25429u,7555u},{25447u,25447u,5098u},{25448u,25448u,5265u},{25454u,25454u,3590u},
+{25458u,25458u,3975u},{25463u,25463u,7190u},{25466u,25466u,4144u},{25467u,25467u,4166u},
+{25471u,25471u,5381u},{25475u,25475u,5508u},{25480u,25480u,5581u},{25481u,25481u,4283u},
+{25484u,25484u,6545u},{25490u,25490u,4974u},{25494u,25494u,5853u},{25496u,25496u,3961u},
+{25499u,25499u,3853u},{25504u,25504u,4425u},{25505u,25505u,7119u},{25506u,25506u,7420u},
+{25509u,25509u,6701u},{25511u,25511u,3795u},{25512u,25512u,7267u},{25513u,25513u,5929u},
+{25514u,25514u,6789u},{25536u,25536u,3484u},{25540u,25540u,6324u},{25542u,25542u,3997u},
+{25551u,25551u,4804u},{25552u,25552u,6766u},{25558u,25558u,6387u},{25562u,25562u,5883u},
+{25563u,25563u,7888u},{25569u,25569u,5799u},{25581u,25581u,3629u},{25582u,25582u,7999u},
+{25588u,25588u,6266u},{25590u,25590u,5867u},{25591u,25591u,5327u},{25613u,25613u,5548u},
+{25615u,25615u,4889u},{25620u,25620u,5509u},{25622u,25622u,6149u},{25623u,25623u,4284u},
+{25628u,25628u,5582u},{25634u,25634u,6984u},{25644u,25644u,4910u},{25645u,25645u,7425u},
+{25658u,25658u,8006u},{25662u,25662u,7056u},{25688u,25688u,6623u},{25696u,25696u,7256u},
+{25705u,25705u,4656u},{25711u,25711u,6950u},{25720u,25721u,4770u},{25722u,25722u,6702u},
+{25736u,25736u,4512u},{25745u,25745u,7447u},{25746u,25746u,5316u},{25747u,25747u,6150u},
+{25754u,25754u,4161u},{25758u,25758u,4244u},{25764u,25764u,7171u},{25765u,25765u,4932u},
+{25771u,25771u,4818u},{25773u,25773u,7478u},{25774u,25774u,7261u},{25776u,25776u,7062u},
+{25778u,25778u,4890u},{25787u,25787u,4212u},{25793u,25793u,6091u},{25796u,25796u,4513u},
+{25797u,25797u,7153u},{25799u,25799u,7445u},{25802u,25802u,3630u},{25805u,25805u,6790u},
+{25806u,25806u,3674u},{25810u,25810u,4040u},{25812u,25812u,4220u},{25816u,25816u,5023u},
+{25818u,25818u,3591u},{25825u,25825u,4259u},{25826u,25826u,7399u},{25829u,25829u,4400u},
+{25830u,25830u,7079u},{25831u,25831u,3592u},{25836u,25836u,6400u},{25842u,25842u,7140u},
+{25844u,25844u,7877u},{25850u,25850u,7479u},{25854u,25854u,6151u},{25856u,25856u,4911u},
+{25860u,25860u,7448u},{25880u,25880u,5884u},{25885u,25885u,5471u},{25891u,25891u,4467u},
+{25898u,25898u,3875u},{25899u,25899u,7878u},{25900u,25900u,4401u},{25903u,25903u,6951u},
+{25910u,25910u,5583u},{25911u,25911u,3739u},{25912u,25912u,6325u},{25913u,25913u,3568u},
+{25915u,25915u,3796u},{25918u,25918u,4949u},{25919u,25919u,6718u},{25925u,25925u,3740u},
+{25928u,25928u,7956u},{25933u,25933u,5382u},{25934u,25934u,3876u},{25935u,25935u,4874u},
+{25937u,25937u,3912u},{25942u,25942u,6064u},{25943u,25943u,7505u},{25950u,25950u,7100u},
+{25954u,25954u,3517u},{25955u,25955u,5306u},{25958u,25958u,4321u},{25964u,25964u,3675u},
+{25965u,25965u,5885u},{25970u,25970u,3741u},{25972u,25972u,6719u},{25973u,25973u,6624u},
+{25975u,25975u,5125u},{25976u,25976u,5584u},{25982u,25982u,5425u},{25986u,25986u,4484u},
+{25987u,25987u,7539u},{25989u,25989u,7957u},{25991u,25991u,4840u},{25996u,25996u,5226u},
+{26000u,26000u,5193u},{26001u,26001u,4912u},{26007u,26007u,4349u},{26009u,26009u,4555u},
+{26011u,26011u,3768u},{26012u,26012u,5266u},{26015u,26015u,7030u},{26017u,26017u,5817u},
+{26020u,26020u,4027u},{26021u,26021u,7141u},{26023u,26023u,5126u},{26027u,26027u,6512u},
+{26028u,26028u,7088u},{26031u,26031u,5267u},{26032u,26032u,5742u},{26039u,26039u,4199u},
+{26041u,26041u,4950u},{26044u,26044u,5904u},{26045u,26045u,5703u},{26049u,26049u,4951u},
+{26053u,26053u,4447u},{26059u,26059u,5426u},{26060u,26060u,6720u},{26063u,26063u,6828u},
+{26066u,26066u,4578u},{26071u,26071u,4081u},{26080u,26080u,4819u},{26083u,26083u,4082u},
+{26085u,26085u,6464u},{26086u,26086u,4200u},{26088u,26088u,6952u},{26089u,26089u,6791u},
+{26092u,26092u,5644u},{26093u,26093u,6231u},{26097u,26097u,7638u},{26100u,26100u,6209u},
+{26106u,26106u,6127u},{26107u,26108u,4875u},{26109u,26109u,4322u},{26111u,26111u,6065u},
+{26118u,26118u,3777u},{26119u,26119u,5688u},{26121u,26121u,4952u},{26122u,26122u,7810u},
+{26124u,26124u,7101u},{26126u,26126u,4751u},{26127u,26127u,7845u},{26128u,26128u,5161u},
+{26129u,26129u,4041u},{26131u,26131u,5950u},{26132u,26132u,5407u},{26133u,26133u,8019u},
+{26142u,26142u,5046u},{26143u,26143u,5480u},{26144u,26144u,6005u},{26149u,26149u,7300u},
+{26151u,26151u,4712u},{26152u,26152u,6513u},{26157u,26157u,5510u},{26159u,26159u,5704u},
+{26160u,26160u,7621u},{26161u,26161u,6232u},{26164u,26164u,4805u},{26166u,26166u,7102u},
+{26170u,26170u,5047u},{26171u,26171u,5836u},{26177u,26177u,6792u},{26178u,26178u,5705u},
+{26179u,26180u,7911u},{26185u,26185u,6985u},{26187u,26187u,6986u},{26191u,26191u,5810u},
+{26201u,26201u,6908u},{26203u,26203u,7738u},{26205u,26205u,6873u},{26206u,26206u,8046u},
+{26207u,26207u,5481u},{26212u,26212u,6066u},{26213u,26213u,7890u},{26214u,26214u,7935u},
+{26215u,26215u,7811u},{26216u,26216u,5743u},{26217u,26217u,4677u},{26219u,26219u,7400u},
+{26222u,26222u,5062u},{26223u,26223u,3676u},{26227u,26227u,5408u},{26228u,26228u,7198u},
+{26230u,26230u,6721u},{26231u,26231u,3990u},{26232u,26232u,6722u},{26234u,26234u,6953u},
+{26244u,26244u,7991u},{26247u,26247u,3447u},{26248u,26248u,7988u},{26249u,26249u,8000u},
+{26254u,26254u,6006u},{26256u,26256u,6293u},{26257u,26257u,5383u},{26262u,26262u,4140u},
+{26263u,26263u,5825u},{26264u,26264u,5886u},{26269u,26269u,4752u},{26272u,26272u,3742u},
+{26274u,26274u,7103u},{26283u,26283u,6528u},{26286u,26286u,4772u},{26290u,26290u,6546u},
+{26291u,26291u,7795u},{26292u,26292u,7572u},{26297u,26297u,5464u},{26299u,26299u,3677u},
+{26302u,26302u,4323u},{26308u,26308u,5999u},{26310u,26310u,4459u},{26311u,26311u,4221u},
+{26313u,26313u,7958u},{26326u,26326u,5845u},{26329u,26329u,5384u},{26332u,26332u,6152u},
+{26333u,26333u,7573u},{26336u,26336u,3844u},{26342u,26342u,8047u},{26352u,26352u,6125u},
+{26354u,26354u,3769u},{26355u,26355u,6033u},{26356u,26356u,3678u},{26359u,26359u,3502u},
+{26360u,26360u,5385u},{26361u,26361u,6794u},{26362u,26362u,6793u},{26364u,26364u,4678u},
+{26366u,26366u,6933u},{26367u,26367u,7206u},{26368u,26368u,7264u},{26371u,26371u,7936u},
+{26376u,26376u,6281u},{26377u,26377u,6326u},{26379u,26379u,5176u},{26381u,26381u,5080u},
+{26388u,26388u,5302u},{26389u,26389u,7031u},{26391u,26391u,4413u},{26395u,26395u,4700u},
+{26397u,26397u,6795u},{26398u,26399u,4083u},{26406u,26406u,4798u},{26407u,26407u,4538u},
+{26408u,26408u,4788u},{26410u,26410u,4857u},{26411u,26411u,4691u},{26412u,26412u,5091u},
+{26413u,26413u,7080u},{26414u,26414u,7304u},{26417u,26417u,6874u},{26420u,26420u,4891u},
+{26422u,26422u,7388u},{26426u,26426u,3984u},{26429u,26429u,7975u},{26438u,26438u,3485u},
+{26441u,26441u,5321u},{26446u,26446u,4620u},{26447u,26447u,7707u},{26448u,26448u,6575u},
+{26449u,26449u,7249u},{26451u,26451u,7580u},{26454u,26454u,6547u},{26460u,26460u,4350u},
+{26462u,26462u,4085u},{26463u,26463u,5539u},{26477u,26477u,7677u},{26479u,26479u,4975u},
+{26480u,26480u,3615u},{26481u,26481u,4337u},{26483u,26483u,4806u},{26485u,26485u,6598u},
+{26487u,26487u,7480u},{26491u,26491u,4183u},{26494u,26494u,5555u},{26495u,26495u,7492u},
+{26503u,26503u,5194u},{26505u,26505u,6128u},{26507u,26507u,4953u},{26511u,26511u,4146u},
+{26512u,26512u,5409u},{26515u,26515u,4351u},{26517u,26517u,7369u},{26519u,26519u,4647u},
+{26522u,26522u,4713u},{26524u,26524u,3805u},{26525u,26525u,6954u},{26543u,26543u,3743u},
+{26544u,26544u,7531u},{26547u,26547u,6955u},{26550u,26551u,3448u},{26552u,26552u,3913u},
+{26558u,26558u,5706u},{26564u,26564u,5048u},{26575u,26575u,4991u},{26576u,26576u,4773u},
+{26577u,26577u,3518u},{26578u,26578u,7365u},{26579u,26579u,5990u},{26580u,26580u,6327u},
+{26586u,26586u,6328u},{26589u,26589u,7401u},{26601u,26601u,3914u},{26604u,26604u,3486u},
+{26607u,26607u,3450u},{26608u,26608u,4157u},{26609u,26609u,6875u},{26611u,26611u,4579u},
+{26612u,26612u,5707u},{26613u,26613u,7127u},{26614u,26614u,5268u},{26619u,26619u,5269u},
+{26622u,26622u,6723u},{26642u,26642u,5645u},{26643u,26643u,6658u},{26646u,26646u,5386u},
+{26647u,26647u,4602u},{26657u,26657u,3877u},{26658u,26658u,4992u},{26666u,26666u,6876u},
+{26671u,26671u,6233u},{26680u,26680u,7704u},{26681u,26681u,4028u},{26684u,26684u,3631u},
+{26685u,26685u,6576u},{26688u,26688u,3616u},{26689u,26689u,7678u},{26690u,26690u,3713u},
+{26691u,26691u,4285u},{26696u,26696u,5811u},{26702u,26702u,7020u},{26704u,26704u,4338u},
+{26705u,26705u,5346u},{26707u,26707u,7891u},{26708u,26708u,4130u},{26733u,26733u,6987u},
+{26742u,26742u,7454u},{26751u,26751u,3487u},{26753u,26753u,4431u},{26757u,26757u,4714u},
+{26767u,26767u,3770u},{26771u,26771u,6577u},{26772u,26772u,7342u},{26775u,26775u,3679u},
+{26781u,26781u,6796u},{26783u,26783u,7959u},{26785u,26785u,6110u},{26786u,26786u,7220u},
+{26791u,26791u,6067u},{26792u,26792u,4621u},{26797u,26797u,5270u},{26799u,26799u,6767u},
+{26800u,26800u,3714u},{26801u,26801u,3778u},{26803u,26803u,5511u},{26805u,26805u,5011u},
+{26806u,26806u,4858u},{26820u,26820u,4087u},{26821u,26821u,5049u},{26825u,26825u,4738u},
+{26827u,26827u,4086u},{26829u,26829u,3779u},{26834u,26834u,5099u},{26837u,26837u,6842u},
+{26839u,26839u,6797u},{26840u,26840u,4020u},{26842u,26842u,5177u},{26847u,26847u,4339u},
+{26848u,26848u,4245u},{26855u,26855u,6523u},{26856u,26856u,3715u},{26862u,26862u,5322u},
+{26866u,26866u,5387u},{26873u,26873u,4286u},{26874u,26874u,3823u},{26880u,26880u,6111u},
+{26885u,26885u,6401u},{26893u,26893u,5725u},{26894u,26894u,7268u},{26898u,26898u,7221u},
+{26919u,26919u,4753u},{26928u,26928u,5868u},{26941u,26941u,5964u},{26943u,26943u,7301u},
+{26954u,26954u,5887u},{26963u,26963u,7592u},{26964u,26964u,5452u},{26965u,26965u,7389u},
+{26967u,26967u,3607u},{26969u,26969u,4820u},{26970u,26970u,7222u},{26974u,26974u,4608u},
+{26976u,26976u,4147u},{26977u,26978u,6329u},{26979u,26979u,4859u},{26984u,26984u,6724u},
+{26987u,26987u,6928u},{26989u,26989u,5932u},{26990u,26990u,6599u},{26991u,26991u,5646u},
+{26997u,26997u,4021u},{26999u,26999u,7693u},{27000u,27000u,7269u},{27001u,27001u,6007u},
+{27029u,27029u,6183u},{27035u,27035u,6988u},{27036u,27036u,4954u},{27045u,27045u,7913u},
+{27047u,27047u,5195u},{27054u,27054u,6008u},{27060u,27060u,4580u},{27067u,27067u,7426u},
+{27073u,27073u,3744u},{27075u,27075u,4913u},{27083u,27083u,3915u},{27084u,27084u,7460u},
+{27085u,27085u,7104u},{27088u,27088u,3862u},{27112u,27112u,3816u},{27114u,27114u,3569u},
+{27131u,27131u,3998u},{27133u,27133u,6798u},{27135u,27135u,4029u},{27138u,27138u,5800u},
+{27146u,27146u,4997u},{27153u,27153u,4432u},{27155u,27155u,4567u},{27159u,27159u,6600u},
+{27161u,27161u,7581u},{27166u,27166u,7270u},{27167u,27167u,6548u},{27169u,27169u,4774u},
+{27171u,27171u,5888u},{27189u,27189u,7223u},{27192u,27192u,4892u},{27193u,27193u,5585u},
+{27194u,27194u,7866u},{27197u,27197u,6909u},{27204u,27204u,3519u},{27208u,27208u,6153u},
+{27211u,27211u,3878u},{27218u,27218u,6239u},{27219u,27219u,5647u},{27224u,27224u,4015u},
+{27225u,27225u,4366u},{27231u,27231u,4088u},{27233u,27233u,5347u},{27243u,27243u,7951u},
+{27264u,27264u,4201u},{27268u,27268u,3632u},{27273u,27273u,6725u},{27277u,27277u,5915u},
+{27278u,27278u,4042u},{27287u,27287u,5024u},{27292u,27292u,7937u},{27298u,27298u,3620u},
+{27299u,27299u,6549u},{27315u,27315u,5227u},{27323u,27323u,7656u},{27330u,27330u,4287u},
+{27331u,27331u,3985u},{27347u,27347u,4514u},{27354u,27354u,4448u},{27355u,27355u,6927u},
+{27382u,27382u,7724u},{27387u,27387u,5858u},{27396u,27396u,4391u},{27402u,27402u,3976u},
+{27404u,27404u,6550u},{27410u,27410u,4392u},{27414u,27414u,4402u},{27424u,27424u,8027u},
+{27425u,27425u,7048u},{27427u,27427u,8020u},{27442u,27442u,6169u},{27450u,27450u,4089u},
+{27453u,27453u,8028u},{27454u,27454u,3824u},{27462u,27462u,8029u},{27463u,27463u,7727u},
+{27468u,27468u,3451u},{27470u,27470u,7413u},{27472u,27472u,3916u},{27487u,27487u,5937u},
+{27489u,27489u,7889u},{27490u,27490u,6956u},{27491u,27491u,6726u},{27492u,27492u,7049u},
+{27493u,27493u,5063u},{27494u,27494u,4821u},{27498u,27498u,6133u},{27506u,27506u,5494u},
+{27511u,27511u,4460u},{27512u,27512u,3991u},{27515u,27515u,5271u},{27519u,27519u,4795u},
+{27523u,27523u,5837u},{27524u,27524u,6989u},{27526u,27526u,7436u},{27529u,27529u,5648u},
+{27530u,27530u,5586u},{27542u,27542u,5726u},{27544u,27544u,6524u},{27550u,27550u,6240u},
+{27566u,27566u,4485u},{27567u,27567u,5228u},{27570u,27570u,5465u},{27573u,27573u,4202u},
+{27575u,27575u,6376u},{27578u,27578u,5317u},{27580u,27580u,3470u},{27583u,27583u,6659u},
+{27585u,27585u,7996u},{27589u,27589u,6402u},{27590u,27590u,3917u},{27595u,27595u,4822u},
+{27597u,27597u,4775u},{27599u,27599u,4715u},{27602u,27602u,4309u},{27603u,27603u,6356u},
+{27604u,27604u,5196u},{27606u,27608u,5197u},{27611u,27611u,4776u},{27627u,27627u,7812u},
+{27628u,27628u,3918u},{27656u,27656u,6660u},{27663u,27663u,5774u},{27665u,27665u,4877u},
+{27667u,27667u,4728u},{27683u,27683u,4090u},{27700u,27700u,5587u},{27703u,27703u,5238u},
+{27704u,27704u,6009u},{27710u,27710u,5012u},{27712u,27712u,6727u},{27713u,27713u,6929u},
+{27714u,27714u,3919u},{27726u,27726u,5013u},{27728u,27728u,5410u},{27733u,27733u,5307u},
+{27735u,27735u,7639u},{27738u,27738u,6068u},{27741u,27741u,5938u},{27742u,27742u,7855u},
+{27743u,27743u,3545u},{27744u,27744u,6957u},{27752u,27752u,3784u},{27754u,27754u,6129u},
+{27757u,27757u,6034u},{27760u,27760u,7437u},{27762u,27762u,4055u},{27766u,27766u,4841u},
+{27770u,27770u,3649u},{27773u,27773u,4091u},{27774u,27774u,5162u},{27777u,27777u,5765u},
+{27778u,27778u,4092u},{27779u,27779u,6079u},{27781u,27781u,6267u},{27782u,27782u,7679u},
+{27783u,27783u,5965u},{27784u,27784u,7370u},{27788u,27788u,4324u},{27792u,27792u,4789u},
+{27794u,27794u,4796u},{27795u,27795u,4234u},{27796u,27796u,4739u},{27797u,27797u,4849u},
+{27798u,27798u,7308u},{27801u,27801u,5272u},{27802u,27802u,6958u},{27803u,27803u,7506u},
+{27819u,27819u,4692u},{27822u,27822u,6601u},{27827u,27827u,7622u},{27832u,27832u,5200u},
+{27833u,27833u,6331u},{27835u,27835u,7343u},{27836u,27836u,5512u},{27837u,27837u,3745u},
+{27838u,27838u,7179u},{27839u,27839u,5966u},{27841u,27841u,7914u},{27842u,27842u,7776u},
+{27844u,27844u,5453u},{27849u,27849u,7154u},{27850u,27850u,4893u},{27852u,27852u,7607u},
+{27859u,27859u,7856u},{27861u,27861u,5018u},{27863u,27863u,5273u},{27867u,27867u,5014u},
+{27873u,27873u,7556u},{27874u,27874u,7481u},{27875u,27875u,6388u},{27877u,27877u,4187u},
+{27880u,27880u,6877u},{27883u,27883u,7739u},{27886u,27886u,4914u},{27887u,27887u,4878u},
+{27888u,27888u,7438u},{27891u,27891u,6010u},{27915u,27915u,5889u},{27916u,27916u,4480u},
+{27921u,27921u,5064u},{27927u,27927u,5495u},{27929u,27929u,5588u},{27931u,27931u,4382u},
+{27934u,27934u,4340u},{27941u,27941u,6990u},{27943u,27943u,6332u},{27945u,27945u,5454u},
+{27946u,27946u,7857u},{27954u,27954u,6878u},{27957u,27957u,5649u},{27958u,27958u,8016u},
+{27960u,27960u,3845u},{27961u,27961u,6268u},{27963u,27963u,7899u},{27965u,27965u,8032u},
+{27966u,27966u,7482u},{27969u,27969u,4581u},{27993u,27993u,6687u},{27994u,27994u,6910u},
+{27996u,27996u,5229u},{28003u,28003u,6112u},{28006u,28006u,7557u},{28009u,28009u,7813u},
+{28010u,28010u,4414u},{28012u,28012u,4622u},{28014u,28014u,5127u},{28020u,28020u,6170u},
+{28023u,28023u,7694u},{28024u,28024u,7371u},{28025u,28025u,7764u},{28031u,28031u,7507u},
+{28037u,28037u,5986u},{28039u,28039u,3680u},{28040u,28040u,5513u},{28041u,28041u,5472u},
+{28044u,28044u,6184u},{28045u,28045u,7960u},{28046u,28046u,5967u},{28049u,28049u,5540u},
+{28051u,28051u,5968u},{28053u,28053u,7207u},{28079u,28079u,5846u},{28082u,28082u,5854u},
+{28085u,28085u,7657u},{28096u,28096u,6728u},{28099u,28099u,3977u},{28100u,28100u,7344u},
+{28101u,28101u,5411u},{28102u,28102u,7961u},{28103u,28103u,4093u},{28107u,28107u,4648u},
+{28111u,28111u,7814u},{28113u,28113u,5633u},{28120u,28120u,4288u},{28121u,28121u,6843u},
+{28122u,28122u,4568u},{28126u,28126u,5556u},{28129u,28129u,4222u},{28136u,28136u,6729u},
+{28138u,28138u,4597u},{28139u,28139u,6382u},{28142u,28142u,7938u},{28145u,28145u,5766u},
+{28147u,28147u,5650u},{28149u,28149u,5969u},{28151u,28151u,7846u},{28152u,28152u,7199u},
+{28153u,28153u,5930u},{28154u,28154u,7155u},{28155u,28155u,7180u},{28183u,28183u,5323u},
+{28185u,28185u,7892u},{28186u,28186u,6602u},{28187u,28187u,3520u},{28191u,28191u,6730u},
+{28192u,28192u,3593u},{28193u,28193u,4289u},{28195u,28195u,5274u},{28196u,28196u,4933u},
+{28197u,28197u,5801u},{28198u,28198u,6099u},{28203u,28203u,5455u},{28204u,28204u,7334u},
+{28205u,28205u,6294u},{28207u,28207u,7680u},{28210u,28210u,5427u},{28212u,28212u,3503u},
+{28214u,28214u,6011u},{28216u,28216u,6333u},{28218u,28218u,4807u},{28220u,28220u,4860u},
+{28221u,28221u,6578u},{28222u,28222u,7847u},{28227u,28227u,4976u},{28228u,28228u,4861u},
+{28234u,28234u,6879u},{28237u,28237u,4203u},{28246u,28246u,7815u},{28248u,28248u,5348u},
+{28251u,28251u,4223u},{28252u,28252u,5727u},{28254u,28254u,6731u},{28255u,28255u,7915u},
+{28263u,28263u,6185u},{28267u,28267u,7271u},{28270u,28270u,6453u},{28271u,28271u,7429u},
+{28274u,28274u,6269u},{28275u,28275u,4148u},{28282u,28282u,5065u},{28304u,28304u,6270u},
+{28310u,28310u,6911u},{28316u,28316u,4582u},{28317u,28317u,3920u},{28319u,28319u,4754u},
+{28322u,28322u,6465u},{28325u,28325u,5128u},{28330u,28330u,3716u},{28331u,28331u,6083u},
+{28335u,28335u,5514u},{28337u,28337u,6991u},{28342u,28342u,6186u},{28346u,28346u,4189u},
+{28354u,28354u,4955u},{28356u,28356u,7105u},{28357u,28357u,4746u},{28361u,28361u,7916u},
+{28363u,28363u,6493u},{28364u,28364u,7142u},{28366u,28366u,7777u},{28369u,28369u,7900u},
+{28371u,28371u,6579u},{28372u,28372u,4290u},{28399u,28399u,7208u},{28404u,28404u,6625u},
+{28408u,28408u,7816u},{28414u,28414u,3780u},{28415u,28415u,4679u},{28417u,28417u,5905u},
+{28418u,28418u,7582u},{28422u,28422u,7366u},{28431u,28431u,4569u},{28433u,28433u,3570u},
+{28436u,28436u,5970u},{28437u,28437u,6799u},{28448u,28448u,4666u},{28450u,28450u,7640u},
+{28451u,28451u,4468u},{28459u,28459u,4680u},{28460u,28460u,6959u},{28465u,28465u,5589u},
+{28466u,28466u,7106u},{28472u,28472u,6695u},{28479u,28479u,6551u},{28481u,28481u,6012u},
+{28497u,28497u,4934u},{28500u,28500u,3650u},{28503u,28503u,7033u},{28504u,28504u,4915u},
+{28506u,28506u,5634u},{28507u,28507u,6529u},{28510u,28510u,4515u},{28511u,28511u,5412u},
+{28514u,28514u,7917u},{28516u,28516u,6362u},{28525u,28525u,4224u},{28526u,28526u,6800u},
+{28528u,28528u,3986u},{28538u,28538u,6525u},{28540u,28540u,4341u},{28541u,28541u,5066u},
+{28542u,28542u,4639u},{28545u,28545u,5328u},{28548u,28548u,7040u},{28552u,28552u,7172u},
+{28557u,28557u,6880u},{28558u,28558u,7514u},{28560u,28560u,6241u},{28564u,28564u,7817u},
+{28567u,28567u,3488u},{28579u,28579u,7641u},{28580u,28580u,7446u},{28583u,28583u,4507u},
+{28590u,28590u,7939u},{28591u,28591u,7063u},{28593u,28593u,6661u},{28595u,28595u,6069u},
+{28601u,28601u,4225u},{28606u,28606u,4213u},{28608u,28608u,3633u},{28609u,28609u,7402u},
+{28610u,28610u,4486u},{28611u,28611u,4175u},{28618u,28618u,6035u},{28629u,28629u,5677u},
+{28634u,28634u,6013u},{28639u,28639u,6768u},{28640u,28640u,7818u},{28641u,28641u,6334u},
+{28644u,28644u,4291u},{28649u,28649u,7819u},{28651u,28651u,4403u},{28652u,28652u,6912u},
+{28655u,28655u,7403u},{28657u,28657u,5230u},{28670u,28670u,4449u},{28673u,28673u,5890u},
+{28677u,28677u,7778u},{28678u,28678u,4310u},{28681u,28681u,5275u},{28683u,28683u,5767u},
+{28687u,28687u,4583u},{28689u,28689u,7574u},{28693u,28693u,5231u},{28696u,28696u,4516u},
+{28698u,28698u,7642u},{28699u,28699u,6014u},{28700u,28700u,6370u},{28701u,28701u,4461u},
+{28702u,28702u,6732u},{28703u,28703u,5515u},{28707u,28707u,7695u},{28711u,28711u,4539u},
+{28712u,28712u,4544u},{28719u,28719u,6015u},{28727u,28727u,6437u},{28734u,28734u,4393u},
+{28748u,28748u,3825u},{28752u,28752u,7779u},{28753u,28753u,5562u},{28760u,28760u,7414u},
+{28765u,28765u,7820u},{28771u,28771u,4681u},{28779u,28779u,7867u},{28784u,28784u,7940u},
+{28792u,28792u,3921u},{28796u,28796u,6514u},{28797u,28797u,6580u},{28805u,28805u,3681u},
+{28810u,28810u,7321u},{28814u,28814u,5991u},{28818u,28818u,7224u},{28824u,28824u,8021u},
+{28825u,28825u,6494u},{28826u,28826u,3846u},{28833u,28833u,6733u},{28836u,28836u,5516u},
+{28843u,28843u,7740u},{28844u,28844u,3594u},{28845u,28845u,7415u},{28847u,28847u,7780u},
+{28851u,28851u,5050u},{28855u,28855u,6881u},{28856u,28856u,6515u},{28857u,28857u,6696u},
+{28872u,28872u,4481u},{28875u,28875u,8007u},{28879u,28879u,6070u},{28888u,28888u,7858u},
+{28889u,28889u,4383u},{28893u,28893u,6935u},{28895u,28895u,5971u},{28913u,28913u,3682u},
+{28921u,28921u,7515u},{28925u,28925u,5100u},{28932u,28932u,7983u},{28937u,28937u,5920u},
+{28940u,28940u,6913u},{28953u,28953u,4977u},{28954u,28954u,5163u},{28958u,28958u,4325u},
+{28961u,28961u,4823u},{28966u,28966u,7225u},{28976u,28976u,5992u},{28982u,28982u,5972u},
+{28999u,28999u,8001u},{29001u,29001u,4469u},{29002u,29002u,7992u},{29004u,29004u,7918u},
+{29006u,29006u,6662u},{29008u,29008u,6016u},{29014u,29014u,4141u},{29017u,29017u,5973u},
+{29020u,29020u,6234u},{29022u,29022u,5318u},{29028u,29028u,4716u},{29029u,29029u,7893u},
+{29030u,29030u,7976u},{29031u,29031u,6801u},{29033u,29033u,4998u},{29036u,29036u,5891u},
+{29038u,29038u,6495u},{29053u,29053u,5428u},{29060u,29060u,5728u},{29065u,29065u,6242u},
+{29066u,29066u,6253u},{29071u,29071u,7984u},{29074u,29074u,7781u},{29076u,29076u,6187u},
+{29081u,29081u,8048u},{29087u,29087u,5635u},{29090u,29090u,5101u},{29100u,29100u,6071u},
+{29105u,29105u,5987u},{29113u,29114u,8049u},{29118u,29118u,7345u},{29121u,29121u,6000u},
+{29123u,29123u,5974u},{29128u,29128u,4367u},{29129u,29129u,4326u},{29134u,29134u,4556u},
+{29136u,29136u,4640u},{29138u,29138u,5517u},{29140u,29140u,4999u},{29141u,29141u,5975u},
+{29151u,29151u,6017u},{29157u,29157u,6802u},{29158u,29158u,7064u},{29159u,29159u,5590u},
+{29165u,29165u,7243u},{29166u,29166u,5473u},{29179u,29179u,7985u},{29180u,29180u,5744u},
+{29182u,29182u,4292u},{29183u,29183u,6154u},{29184u,29184u,7731u},{29190u,29190u,7575u},
+{29200u,29200u,4517u},{29211u,29211u,4394u},{29226u,29226u,6803u},{29228u,29228u,7483u},
+{29229u,29229u,6587u},{29232u,29232u,6271u},{29234u,29234u,6295u},{29237u,29237u,6516u},
+{29238u,29238u,5129u},{29242u,29242u,5869u},{29243u,29243u,7962u},{29245u,29245u,5349u},
+{29246u,29246u,6422u},{29248u,29248u,5350u},{29254u,29254u,6552u},{29255u,29255u,7521u},
+{29256u,29256u,7493u},{29260u,29260u,7508u},{29266u,29266u,7191u},{29272u,29272u,4311u},
+{29273u,29273u,5782u},{29275u,29275u,6210u},{29277u,29277u,5232u},{29279u,29279u,4777u},
+{29281u,29281u,4778u},{29282u,29282u,4545u},{29287u,29287u,4790u},{29289u,29289u,4850u},
+{29298u,29298u,5369u},{29305u,29305u,7472u},{29309u,29309u,3638u},{29312u,29312u,5388u},
+{29313u,29313u,4623u},{29346u,29346u,4312u},{29351u,29351u,8051u},{29356u,29356u,3639u},
+{29359u,29359u,5015u},{29376u,29376u,5351u},{29378u,29378u,3847u},{29380u,29380u,6626u},
+{29390u,29390u,5831u},{29392u,29392u,7821u},{29399u,29399u,3922u},{29401u,29401u,6603u},
+{29409u,29409u,3879u},{29417u,29417u,5591u},{29432u,29432u,4624u},{29433u,29433u,7765u},
+{29436u,29436u,4415u},{29437u,29437u,7509u},{29450u,29450u,6036u},{29462u,29462u,7107u},
+{29467u,29467u,4729u},{29468u,29468u,5708u},{29469u,29469u,6836u},{29477u,29477u,6138u},
+{29481u,29481u,5482u},{29482u,29482u,6604u},{29483u,29483u,4808u},{29494u,29495u,6335u},
+{29502u,29502u,7901u},{29503u,29503u,6272u},{29508u,29508u,6080u},{29509u,29509u,5276u},
+{29520u,29520u,6553u},{29522u,29522u,6072u},{29527u,29527u,3980u},{29544u,29544u,4313u},
+{29546u,29546u,7941u},{29552u,29552u,6018u},{29554u,29554u,7949u},{29557u,29557u,4488u},
+{29560u,29560u,5592u},{29562u,29562u,4214u},{29563u,29563u,7725u},{29572u,29572u,7741u},
+{29574u,29574u,6496u},{29575u,29575u,5552u},{29577u,29577u,6081u},{29579u,29579u,6130u},
+{29582u,29582u,6734u},{29588u,29588u,7156u},{29590u,29590u,3923u},{29591u,29591u,6211u},
+{29592u,29592u,4094u},{29599u,29599u,4879u},{29607u,29607u,6363u},{29609u,29609u,6113u},
+{29613u,29613u,5233u},{29618u,29618u,4495u},{29619u,29619u,4260u},{29625u,29625u,7742u},
+{29632u,29632u,4894u},{29634u,29634u,3452u},{29641u,29641u,4880u},{29642u,29642u,5308u},
+{29644u,29644u,7608u},{29645u,29645u,6992u},{29647u,29647u,3471u},{29654u,29654u,3848u},
+{29657u,29657u,3797u},{29661u,29661u,7977u},{29662u,29662u,4384u},{29664u,29664u,6882u},
+{29667u,29667u,5651u},{29668u,29668u,5067u},{29669u,29669u,6423u},{29670u,29670u,7713u},
+{29673u,29673u,7782u},{29674u,29674u,3999u},{29677u,29677u,4916u},{29687u,29687u,4824u},
+{29689u,29689u,5483u},{29693u,29693u,6735u},{29694u,29694u,7743u},{29697u,29697u,5429u},
+{29699u,29699u,3924u},{29701u,29701u,4416u},{29702u,29702u,4625u},{29703u,29703u,5593u},
+{29705u,29705u,4584u},{29715u,29715u,6114u},{29723u,29723u,7372u},{29728u,29728u,6663u},
+{29729u,29729u,5636u},{29730u,29730u,7404u},{29733u,29733u,7822u},{29734u,29734u,4095u},
+{29736u,29736u,3781u},{29738u,29738u,4096u},{29739u,29739u,5102u},{29740u,29740u,6115u},
+{29742u,29742u,6844u},{29743u,29743u,3826u},{29744u,29744u,5993u},{29747u,29747u,4649u},
+{29748u,29748u,4043u},{29749u,29749u,5201u},{29750u,29750u,7484u},{29752u,29752u,7405u},
+{29754u,29754u,5019u},{29759u,29759u,7848u},{29760u,29760u,6212u},{29761u,29761u,4779u},
+{29763u,29763u,7302u},{29764u,29764u,5430u},{29771u,29771u,6296u},{29781u,29781u,7623u},
+{29783u,29783u,6273u},{29785u,29785u,4173u},{29786u,29786u,7823u},{29787u,29787u,6019u},
+{29788u,29788u,6337u},{29790u,29790u,5389u},{29791u,29791u,5674u},{29792u,29792u,4585u},
+{29794u,29794u,6188u},{29796u,29796u,6155u},{29797u,29797u,6084u},{29800u,29800u,6993u},
+{29801u,29801u,7783u},{29802u,29802u,4657u},{29807u,29807u,4417u},{29822u,29822u,4030u},
+{29826u,29826u,4097u},{29827u,29827u,4626u},{29831u,29831u,5431u},{29833u,29833u,4470u},
+{29835u,29835u,6554u},{29848u,29848u,4641u},{29852u,29852u,7919u},{29854u,29854u,4895u},
+{29855u,29855u,3683u},{29857u,29857u,6994u},{29859u,29859u,4098u},{29861u,29861u,3684u},
+{29863u,29863u,5025u},{29864u,29864u,7065u},{29866u,29866u,6804u},{29872u,29872u,7894u},
+{29874u,29874u,5594u},{29877u,29877u,5939u},{29881u,29881u,5637u},{29885u,29885u,5363u},
+{29887u,29887u,5432u},{29894u,29894u,7021u},{29898u,29898u,3685u},{29903u,29903u,4540u},
+{29908u,29908u,6020u},{29912u,29912u,3827u},{29914u,29914u,7066u},{29916u,29916u,3806u},
+{29920u,29920u,7824u},{29922u,29922u,7583u},{29923u,29923u,7494u},{29926u,29926u,6100u},
+{29934u,29934u,6092u},{29943u,29943u,6497u},{29953u,29953u,5051u},{29956u,29956u,3640u},
+{29969u,29969u,6936u},{29973u,29973u,6093u},{29976u,29976u,3521u},{29978u,29978u,5768u},
+{29979u,29979u,7181u},{29983u,29983u,5370u},{29987u,29987u,5309u},{29989u,29989u,5371u},
+{29990u,29990u,5518u},{29992u,29992u,6189u},{29995u,29995u,5068u},{29996u,29996u,6190u},
+{30000u,30000u,6664u},{30001u,30001u,6338u},{30002u,30002u,3532u},{30003u,30003u,5745u},
+{30007u,30007u,4149u},{30008u,30008u,6665u},{30010u,30010u,6736u},{30023u,30023u,4011u},
+{30028u,30028u,3717u},{30031u,30031u,6139u},{30033u,30033u,6666u},{30035u,30035u,4235u},
+{30036u,30036u,4917u},{30041u,30041u,4586u},{30043u,30043u,6995u},{30044u,30044u,7289u},
+{30045u,30045u,4825u},{30050u,30050u,7609u},{30053u,30053u,4426u},{30054u,30054u,8008u},
+{30058u,30058u,5000u},{30063u,30063u,6914u},{30064u,30064u,6424u},{30069u,30069u,7868u},
+{30070u,30070u,4246u},{30072u,30072u,4099u},{30074u,30074u,3546u},{30079u,30079u,4100u},
+{30086u,30086u,3547u},{30087u,30087u,6883u},{30090u,30090u,7192u},{30091u,30091u,7610u},
+{30094u,30094u,5520u},{30095u,30095u,5519u},{30097u,30097u,6403u},{30109u,30109u,5310u},
+{30117u,30117u,3571u},{30123u,30123u,5951u},{30129u,30129u,7558u},{30130u,30130u,7599u},
+{30131u,30131u,3522u},{30133u,30133u,6498u},{30136u,30136u,4215u},{30137u,30137u,6996u},
+{30140u,30140u,4342u},{30141u,30141u,6605u},{30142u,30142u,7022u},{30146u,30146u,3453u},
+{30149u,30149u,5052u},{30151u,30151u,6937u},{30157u,30157u,6425u},{30162u,30162u,5892u},
+{30164u,30164u,7346u},{30165u,30165u,8022u},{30168u,30168u,4352u},{30169u,30169u,3686u},
+{30171u,30171u,7455u},{30178u,30178u,4627u},{30192u,30192u,4226u},{30194u,30194u,4658u},
+{30196u,30196u,7347u},{30202u,30202u,5202u},{30204u,30204u,3746u},{30208u,30208u,5906u},
+{30221u,30221u,5893u},{30233u,30233u,5521u},{30239u,30239u,6085u},{30240u,30240u,7143u},
+{30241u,30241u,7108u},{30242u,30242u,4918u},{30244u,30244u,4587u},{30246u,30246u,5595u},
+{30267u,30267u,4570u},{30274u,30274u,4557u},{30284u,30284u,5826u},{30286u,30286u,3489u},
+{30290u,30290u,6339u},{30294u,30294u,5026u},{30305u,30305u,7348u},{30308u,30308u,6688u},
+{30313u,30313u,4376u},{30316u,30316u,5433u},{30320u,30320u,6094u},{30322u,30322u,6667u},
+{30328u,30328u,3718u},{30331u,30331u,4368u},{30332u,30332u,4935u},{30333u,30334u,4993u},
+{30340u,30340u,6627u},{30342u,30342u,3572u},{30343u,30343u,7920u},{30350u,30350u,3880u},
+{30352u,30352u,3747u},{30355u,30355u,7825u},{30382u,30382u,7600u},{30394u,30394u,7272u},
+{30399u,30399u,4755u},{30402u,30402u,6213u},{30403u,30403u,4978u},{30406u,30406u,5164u},
+{30408u,30408u,6021u},{30410u,30410u,6438u},{30418u,30418u,7665u},{30422u,30422u,3573u},
+{30427u,30427u,5484u},{30428u,30428u,4293u},{30430u,30430u,6526u},{30431u,30431u,4731u},
+{30433u,30433u,6997u},{30435u,30435u,3523u},{30436u,30436u,4919u},{30439u,30439u,4518u},
+{30446u,30446u,4791u},{30450u,30450u,4730u},{30452u,30452u,6975u},{30456u,30456u,5352u},
+{30460u,30460u,4920u},{30462u,30462u,5652u},{30465u,30465u,5485u},{30468u,30468u,4740u},
+{30472u,30472u,7421u},{30473u,30473u,4862u},{30475u,30475u,3490u},{30494u,30494u,6998u},
+{30496u,30496u,4741u},{30505u,30505u,7744u},{30519u,30519u,3978u},{30520u,30520u,4780u},
+{30522u,30522u,6805u},{30524u,30524u,5812u},{30528u,30528u,7057u},{30541u,30541u,7745u},
+{30555u,30555u,6737u},{30561u,30561u,5596u},{30563u,30563u,4314u},{30566u,30566u,4792u},
+{30571u,30571u,7193u},{30585u,30585u,4294u},{30590u,30590u,3748u},{30591u,30591u,6037u},
+{30603u,30603u,6999u},{30609u,30609u,4756u},{30622u,30622u,4682u},{30629u,30629u,5038u},
+{30636u,30636u,5653u},{30637u,30637u,4558u},{30640u,30640u,3524u},{30643u,30643u,4343u},
+{30651u,30651u,7182u},{30652u,30652u,3621u},{30655u,30655u,3925u},{30679u,30679u,7244u},
+{30683u,30683u,4781u},{30684u,30684u,4060u},{30690u,30690u,5709u},{30691u,30691u,6404u},
+{30693u,30693u,6960u},{30697u,30697u,3926u},{30701u,30701u,4204u},{30702u,30702u,6134u},
+{30703u,30703u,3881u},{30707u,30707u,5413u},{30722u,30722u,5277u},{30738u,30738u,5203u},
+{30757u,30757u,6961u},{30758u,30758u,7120u},{30759u,30759u,7373u},{30764u,30764u,4652u},
+{30770u,30770u,7559u},{30772u,30772u,7485u},{30789u,30789u,4000u},{30799u,30799u,5976u},
+{30813u,30813u,7226u},{30827u,30827u,4588u},{30828u,30828u,3687u},{30831u,30831u,5977u},
+{30844u,30844u,5178u},{30849u,30849u,4101u},{30855u,30855u,6738u},{30860u,30860u,4528u},
+{30861u,30861u,5847u},{30862u,30862u,5563u},{30865u,30865u,5204u},{30871u,30871u,6116u},
+{30883u,30883u,3504u},{30887u,30887u,5027u},{30889u,30889u,5414u},{30906u,30907u,7879u},
+{30908u,30908u,4659u},{30913u,30913u,6499u},{30917u,30917u,4956u},{30922u,30922u,4546u},
+{30923u,30923u,7050u},{30926u,30926u,3719u},{30928u,30928u,4921u},{30952u,30952u,4660u},
+{30956u,30956u,3688u},{30959u,30959u,4102u},{30965u,30965u,3491u},{30971u,30971u,4922u},
+{30977u,30977u,7227u},{30990u,30990u,7228u},{30998u,30998u,5940u},{31018u,31018u,4450u},
+{31019u,31019u,4462u},{31020u,31020u,4923u},{31034u,31034u,5710u},{31038u,31038u,5278u},
+{31040u,31040u,5279u},{31041u,31041u,4103u},{31047u,31048u,4104u},{31049u,31049u,6962u},
+{31056u,31056u,6214u},{31062u,31062u,6806u},{31063u,31063u,6963u},{31066u,31066u,6807u},
+{31067u,31067u,3595u},{31068u,31068u,7826u},{31069u,31069u,7290u},{31070u,31070u,5746u},
+{31072u,31072u,5280u},{31077u,31077u,5353u},{31080u,31080u,7584u},{31085u,31085u,6769u},
+{31098u,31098u,4106u},{31103u,31103u,4529u},{31105u,31105u,4044u},{31117u,31117u,7869u},
+{31118u,31118u,6739u},{31119u,31119u,5081u},{31121u,31121u,6215u},{31142u,31142u,5907u},
+{31143u,31143u,8052u},{31146u,31146u,5434u},{31150u,31150u,4508u},{31153u,31153u,4295u},
+{31155u,31155u,5894u},{31161u,31161u,6216u},{31165u,31165u,4045u},{31166u,31166u,7870u},
+{31167u,31167u,4315u},{31168u,31168u,5597u},{31169u,31169u,5281u},{31177u,31177u,5053u},
+{31178u,31178u,4162u},{31179u,31179u,7273u},{31185u,31185u,3807u},{31186u,31186u,7229u},
+{31189u,31189u,5205u},{31192u,31192u,5206u},{31199u,31199u,6808u},{31204u,31204u,7377u},
+{31206u,31206u,7000u},{31207u,31207u,5838u},{31209u,31209u,7023u},{31227u,31227u,6426u},
+{31232u,31232u,8053u},{31237u,31237u,5496u},{31240u,31240u,3492u},{31243u,31243u,6740u},
+{31245u,31245u,7230u},{31252u,31252u,6474u},{31255u,31255u,7510u},{31257u,31257u,6976u},
+{31258u,31258u,7349u},{31260u,31260u,4609u},{31263u,31263u,7591u},{31264u,31264u,6809u},
+{31278u,31278u,6845u},{31281u,31281u,7378u},{31286u,31286u,6235u},{31287u,31287u,6977u},
+{31291u,31291u,4296u},{31292u,31292u,3454u},{31293u,31293u,3720u},{31295u,31295u,3749u},
+{31296u,31296u,3771u},{31302u,31302u,4793u},{31305u,31305u,7350u},{31309u,31309u,6628u},
+{31310u,31310u,6022u},{31319u,31319u,5598u},{31329u,31329u,5366u},{31330u,31330u,6038u},
+{31337u,31337u,6086u},{31339u,31339u,7881u},{31344u,31344u,5895u},{31348u,31348u,7755u},
+{31350u,31350u,3927u},{31353u,31353u,3965u},{31354u,31354u,3798u},{31357u,31357u,6741u},
+{31359u,31359u,7157u},{31361u,31361u,4330u},{31364u,31364u,7058u},{31368u,31368u,6156u},
+{31378u,31378u,7024u},{31379u,31379u,7109u},{31381u,31381u,6810u},{31384u,31384u,3954u},
+{31391u,31391u,3962u},{31401u,31402u,6101u},{31406u,31406u,3966u},{31407u,31407u,6157u},
+{31418u,31418u,4001u},{31428u,31428u,7067u},{31429u,31429u,4002u},{31431u,31431u,4353u},
+{31434u,31434u,6689u},{31435u,31435u,4653u},{31447u,31447u,4809u},{31449u,31449u,7089u},
+{31453u,31453u,5054u},{31455u,31455u,3689u},{31456u,31456u,6555u},{31459u,31459u,6915u},
+{31461u,31461u,4344u},{31466u,31466u,5599u},{31469u,31469u,3505u},{31471u,31471u,4205u},
+{31478u,31478u,3690u},{31481u,31481u,6900u},{31482u,31482u,7291u},{31487u,31487u,3493u},
+{31503u,31503u,7852u},{31505u,31505u,5522u},{31513u,31513u,5372u},{31515u,31515u,6629u},
+{31518u,31518u,7439u},{31520u,31520u,4654u},{31526u,31526u,5130u},{31532u,31532u,6770u},
+{31533u,31533u,4496u},{31545u,31545u,5497u},{31558u,31558u,7611u},{31561u,31561u,4369u},
+{31563u,31563u,4031u},{31564u,31564u,6668u},{31565u,31565u,5654u},{31567u,31567u,5006u},
+{31568u,31568u,3849u},{31569u,31569u,7292u},{31570u,31570u,7456u},{31572u,31572u,4236u},
+{31574u,31574u,7128u},{31584u,31584u,4012u},{31596u,31596u,5486u},{31598u,31598u,5390u},
+{31605u,31605u,5978u},{31613u,31613u,6073u},{31623u,31623u,3574u},{31627u,31627u,6669u},
+{31631u,31631u,6588u},{31636u,31636u,4896u},{31637u,31637u,4107u},{31639u,31639u,5311u},
+{31642u,31642u,7051u},{31645u,31645u,3656u},{31649u,31649u,3828u},{31661u,31661u,6670u},
+{31665u,31665u,5354u},{31668u,31668u,6530u},{31672u,31672u,6606u},{31680u,31680u,6690u},
+{31681u,31681u,7921u},{31684u,31684u,5016u},{31686u,31686u,6671u},{31687u,31687u,7522u},
+{31689u,31689u,7293u},{31698u,31698u,5729u},{31712u,31712u,5523u},{31716u,31716u,4316u},
+{31721u,31721u,5282u},{31751u,31751u,6829u},{31762u,31762u,7068u},{31774u,31774u,4206u},
+{31777u,31777u,3494u},{31783u,31783u,7922u},{31786u,31786u,6531u},{31787u,31787u,5524u},
+{31805u,31805u,7183u},{31806u,31806u,4487u},{31807u,31807u,5131u},{31811u,31811u,4404u},
+{31820u,31820u,6884u},{31821u,31821u,6630u},{31840u,31840u,4541u},{31844u,31844u,7184u},
+{31852u,31852u,4628u},{31859u,31859u,4863u},{31875u,31875u,5207u},{31881u,31881u,5165u},
+{31890u,31890u,4655u},{31893u,31893u,4897u},{31895u,31895u,6811u},{31896u,31896u,6697u},
+{31903u,31903u,5541u},{31909u,31909u,6901u},{31911u,31911u,6556u},{31918u,31918u,4433u},
+{31921u,31921u,4434u},{31922u,31922u,7070u},{31923u,31923u,3582u},{31929u,31929u,5600u},
+{31934u,31934u,6742u},{31946u,31946u,7827u},{31958u,31958u,4247u},{31966u,31966u,5166u},
+{31967u,31967u,6812u},{31968u,31968u,3548u},{31975u,31975u,4435u},{31995u,31995u,3721u},
+{31998u,31998u,4003u},{32000u,32000u,4108u},{32002u,32002u,6885u},{32004u,32004u,5873u},
+{32005u,32005u,7859u},{32006u,32006u,6217u},{32007u,32007u,8025u},{32008u,32008u,7895u},
+{32010u,32011u,4842u},{32013u,32013u,4150u},{32016u,32016u,4184u},{32020u,32020u,5655u},
+{32023u,32023u,5283u},{32024u,32024u,3865u},{32025u,32025u,6964u},{32026u,32026u,4056u},
+{32027u,32027u,5167u},{32032u,32032u,5525u},{32033u,32033u,4957u},{32034u,32034u,5367u},
+{32043u,32043u,6500u},{32044u,32044u,6886u},{32046u,32046u,7081u},{32047u,32047u,4571u},
+{32048u,32048u,5498u},{32051u,32051u,5747u},{32053u,32053u,6607u},{32057u,32057u,5526u},
+{32058u,32058u,3525u},{32066u,32066u,6846u},{32067u,32067u,7746u},{32068u,32068u,6813u},
+{32069u,32069u,3691u},{32070u,32070u,4924u},{32080u,32080u,3651u},{32094u,32094u,3882u},
+{32097u,32097u,4385u},{32098u,32098u,7747u},{32102u,32102u,4057u},{32104u,32104u,6371u},
+{32106u,32106u,6454u},{32110u,32110u,5391u},{32113u,32113u,7457u},{32114u,32114u,5284u},
+{32115u,32115u,3549u},{32118u,32118u,6691u},{32121u,32121u,3641u},{32127u,32127u,3928u},
+{32142u,32142u,6743u},{32143u,32143u,5601u},{32147u,32147u,3692u},{32156u,32156u,6847u},
+{32160u,32160u,4530u},{32162u,32162u,6887u},{32172u,32172u,5602u},{32173u,32173u,6340u},
+{32177u,32177u,3550u},{32178u,32178u,4701u},{32180u,32180u,7173u},{32181u,32181u,7121u},
+{32184u,32184u,4598u},{32186u,32186u,4109u},{32187u,32187u,7416u},{32189u,32189u,6517u},
+{32190u,32190u,4610u},{32191u,32191u,4742u},{32199u,32199u,7351u},{32202u,32202u,4126u},
+{32203u,32203u,5208u},{32214u,32214u,5392u},{32216u,32216u,7658u},{32218u,32218u,5435u},
+{32221u,32221u,7034u},{32222u,32222u,4207u},{32224u,32224u,7209u},{32225u,32225u,4881u},
+{32227u,32227u,5979u},{32232u,32232u,7523u},{32233u,32233u,6117u},{32236u,32236u,4743u},
+{32239u,32239u,6297u},{32244u,32244u,4471u},{32251u,32251u,7352u},{32265u,32265u,7001u},
+{32266u,32266u,5855u},{32277u,32277u,6087u},{32283u,32283u,4898u},{32285u,32285u,7002u},
+{32286u,32286u,7828u},{32287u,32287u,6171u},{32289u,32289u,6581u},{32291u,32291u,7748u},
+{32299u,32299u,5103u},{32302u,32302u,7294u},{32303u,32303u,5980u},{32305u,32305u,6848u},
+{32311u,32311u,4572u},{32317u,32317u,7257u},{32318u,32318u,6631u},{32321u,32321u,5001u},
+{32323u,32323u,5179u},{32326u,32326u,4826u},{32327u,32327u,6158u},{32338u,32338u,6938u},
+{32340u,32340u,6978u},{32341u,32341u,5436u},{32350u,32350u,6159u},{32353u,32353u,5603u},
+{32361u,32361u,5689u},{32362u,32362u,7942u},{32363u,32363u,3722u},{32365u,32365u,3642u},
+{32368u,32368u,6814u},{32377u,32377u,5952u},{32380u,32380u,3723u},{32386u,32386u,7069u},
+{32396u,32396u,5542u},{32399u,32399u,6672u},{32403u,32403u,6023u},{32406u,32406u,5466u},
+{32408u,32408u,7071u},{32411u,32411u,4317u},{32412u,32412u,4405u},{32566u,32566u,5132u},
+{32568u,32568u,7681u},{32570u,32570u,3652u},{32588u,32588u,5859u},{32592u,32592u,3829u},
+{32596u,32596u,4702u},{32597u,32597u,7643u},{32618u,32618u,6859u},{32619u,32619u,3854u},
+{32622u,32622u,7353u},{32624u,32624u,5007u},{32626u,32626u,5393u},{32629u,32629u,4717u},
+{32631u,32631u,7486u},{32633u,32633u,4629u},{32645u,32645u,4377u},{32648u,32648u,4110u},
+{32650u,32650u,5896u},{32652u,32652u,3551u},{32654u,32654u,4864u},{32660u,32660u,3750u},
+{32666u,32666u,4497u},{32670u,32670u,5604u},{32676u,32676u,3955u},{32680u,32680u,5437u},
+{32681u,32681u,6405u},{32690u,32690u,8054u},{32696u,32696u,4630u},{32697u,32697u,3583u},
+{32701u,32701u,6218u},{32705u,32705u,6095u},{32709u,32709u,5711u},{32714u,32714u,6439u},
+{32716u,32716u,6440u},{32718u,32718u,4498u},{32722u,32722u,5679u},{32724u,32724u,5355u},
+{32725u,32725u,8033u},{32735u,32735u,6632u},{32736u,32736u,7322u},{32737u,32737u,5209u},
+{32745u,32745u,7524u},{32747u,32747u,6118u},{32752u,32752u,7644u},{32761u,32761u,3883u},
+{32764u,32764u,6441u},{32768u,32768u,6160u},{32769u,32769u,4519u},{32771u,32771u,3751u},
+{32773u,32773u,6501u},{32774u,32774u,4111u},{32777u,32777u,3929u},{32780u,32780u,6427u},
+{32784u,32784u,4158u},{32789u,32789u,3693u},{32791u,32791u,4782u},{32792u,32792u,6243u},
+{32813u,32813u,4112u},{32819u,32819u,6428u},{32822u,32822u,5870u},{32829u,32829u,7422u},
+{32831u,32831u,3694u},{32835u,32835u,4227u},{32838u,32838u,4499u},{32842u,32842u,4559u},
+{32854u,32854u,5487u},{32856u,32856u,5239u},{32858u,32858u,7323u},{32862u,32862u,4844u},
+{32879u,32879u,4472u},{32880u,32880u,7258u},{32882u,32882u,5488u},{32883u,32883u,6191u},
+{32887u,32887u,6979u},{32893u,32893u,7200u},{32894u,32894u,4542u},{32895u,32895u,6368u},
+{32900u,32900u,6429u},{32901u,32901u,5638u},{32902u,32902u,5285u},{32903u,32903u,6815u},
+{32905u,32905u,6357u},{32907u,32907u,4605u},{32908u,32908u,4113u},{32918u,32918u,7231u},
+{32923u,32923u,7682u},{32925u,32925u,3495u},{32929u,32929u,3752u},{32930u,32930u,6965u},
+{32933u,32933u,5210u},{32937u,32937u,3643u},{32938u,32938u,4958u},{32943u,32943u,4061u},
+{32945u,32945u,3866u},{32946u,32946u,6358u},{32948u,32948u,7963u},{32954u,32954u,7540u},
+{32963u,32963u,6298u},{32964u,32964u,6865u},{32972u,32972u,4979u},{32974u,32974u,7440u},
+{32986u,32986u,4980u},{32987u,32987u,3533u},{32990u,32990u,7560u},{32993u,32993u,7829u},
+{32996u,32996u,6364u},{32997u,32997u,5394u},{33009u,33009u,3850u},{33012u,33012u,4345u},
+{33016u,33016u,8017u},{33021u,33021u,4185u},{33026u,33026u,6966u},{33029u,33029u,7766u},
+{33030u,33030u,7324u},{33031u,33031u,7767u},{33032u,33032u,4722u},{33034u,33034u,7144u},
+{33048u,33048u,6119u},{33050u,33050u,3472u},{33051u,33051u,3695u},{33059u,33059u,5656u},
+{33065u,33065u,5605u},{33067u,33067u,7419u},{33071u,33071u,7561u},{33081u,33081u,7110u},
+{33086u,33086u,5211u},{33099u,33099u,5856u},{33102u,33102u,5748u},{33104u,33105u,5133u},
+{33108u,33108u,3552u},{33109u,33109u,6120u},{33125u,33125u,5489u},{33126u,33126u,4179u},
+{33131u,33131u,6849u},{33136u,33136u,6161u},{33137u,33137u,3608u},{33144u,33144u,6557u},
+{33145u,33145u,5082u},{33146u,33146u,5438u},{33151u,33151u,7461u},{33152u,33152u,4959u},
+{33160u,33160u,3634u},{33162u,33162u,4899u},{33167u,33167u,3753u},{33178u,33178u,5135u},
+{33180u,33180u,4667u},{33181u,33181u,5675u},{33184u,33184u,3884u},{33187u,33187u,7025u},
+{33192u,33192u,7516u},{33203u,33203u,5439u},{33205u,33205u,7313u},{33210u,33210u,6392u},
+{33213u,33213u,4228u},{33214u,33214u,7943u},{33215u,33215u,4176u},{33216u,33216u,4359u},
+{33218u,33218u,5212u},{33222u,33222u,5916u},{33229u,33229u,6771u},{33240u,33240u,4410u},
+{33247u,33247u,6558u},{33251u,33251u,5749u},{33253u,33253u,6103u},{33255u,33255u,6559u},
+{33256u,33256u,4650u},{33258u,33258u,6502u},{33261u,33261u,7325u},{33267u,33267u,6967u},
+{33268u,33268u,7354u},{33274u,33274u,4261u},{33275u,33275u,7003u},{33276u,33276u,3930u},
+{33278u,33278u,6341u},{33285u,33285u,3931u},{33287u,33287u,5941u},{33288u,33288u,8034u},
+{33290u,33290u,3932u},{33292u,33292u,5456u},{33293u,33293u,5286u},{33298u,33298u,5395u},
+{33307u,33307u,7158u},{33308u,33308u,5657u},{33310u,33310u,4827u},{33311u,33311u,6888u},
+{33313u,33313u,3553u},{33322u,33322u,7683u},{33323u,33323u,4960u},{33324u,33324u,4925u},
+{33333u,33333u,7390u},{33334u,33334u,4900u},{33335u,33335u,7749u},{33337u,33337u,5440u},
+{33344u,33344u,5136u},{33349u,33349u,5942u},{33351u,33351u,6744u},{33369u,33369u,7111u},
+{33380u,33380u,6406u},{33382u,33382u,7659u},{33390u,33390u,3496u},{33391u,33391u,4436u},
+{33393u,33393u,3497u},{33394u,33394u,5368u},{33398u,33398u,5994u},{33400u,33400u,7232u},
+{33406u,33406u,5848u},{33419u,33419u,6219u},{33421u,33421u,6518u},{33422u,33422u,3967u},
+{33426u,33426u,4703u},{33433u,33433u,5137u},{33434u,33434u,4360u},{33437u,33437u,6968u},
+{33439u,33439u,5324u},{33445u,33445u,3575u},{33446u,33446u,7830u},{33449u,33449u,4046u},
+{33452u,33452u,5168u},{33453u,33453u,7487u},{33454u,33454u,6039u},{33455u,33455u,5769u},
+{33457u,33457u,7871u},{33459u,33459u,4961u},{33463u,33463u,6969u},{33464u,33464u,6244u},
+{33465u,33465u,4032u},{33467u,33467u,7274u},{33468u,33468u,4783u},{33469u,33469u,5783u},
+{33471u,33471u,6482u},{33489u,33489u,6274u},{33490u,33490u,5995u},{33492u,33492u,7441u},
+{33493u,33493u,7233u},{33495u,33495u,4810u},{33499u,33499u,3455u},{33502u,33502u,7562u},
+{33503u,33503u,3933u},{33505u,33505u,6430u},{33509u,33509u,5874u},{33510u,33510u,3754u},
+{33511u,33511u,6608u},{33521u,33521u,6024u},{33533u,33533u,3755u},{33534u,33534u,7612u},
+{33537u,33537u,6921u},{33538u,33538u,4828u},{33539u,33539u,5017u},{33540u,33540u,3456u},
+{33541u,33541u,4784u},{33545u,33545u,4693u},{33559u,33559u,4757u},{33576u,33576u,6503u},
+{33579u,33579u,4704u},{33583u,33583u,5083u},{33585u,33585u,5606u},{33588u,33588u,7944u},
+{33589u,33589u,6455u},{33590u,33590u,4191u},{33592u,33592u,6192u},{33593u,33593u,5943u},
+{33600u,33600u,5658u},{33607u,33607u,7708u},{33609u,33609u,7234u},{33610u,33610u,7784u},
+{33615u,33615u,6475u},{33617u,33617u,6431u},{33618u,33618u,7923u},{33651u,33651u,4354u},
+{33655u,33655u,7624u},{33659u,33659u,6633u},{33673u,33673u,4631u},{33674u,33674u,6560u},
+{33678u,33678u,5287u},{33686u,33686u,3696u},{33688u,33688u,5750u},{33694u,33694u,6121u},
+{33698u,33698u,7768u},{33705u,33705u,5138u},{33706u,33706u,5784u},{33707u,33707u,4668u},
+{33725u,33725u,4705u},{33729u,33729u,7201u},{33733u,33733u,3830u},{33737u,33737u,4531u},
+{33738u,33738u,3949u},{33740u,33740u,4013u},{33747u,33747u,3808u},{33750u,33750u,7112u},
+{33756u,33756u,7122u},{33769u,33769u,5069u},{33771u,33771u,4033u},{33775u,33775u,7872u},
+{33776u,33776u,3756u},{33777u,33777u,4611u},{33778u,33778u,5213u},{33780u,33780u,5827u},
+{33785u,33785u,6609u},{33789u,33789u,5639u},{33795u,33795u,7314u},{33796u,33796u,4297u},
+{33802u,33802u,4423u},{33804u,33804u,4732u},{33805u,33805u,7532u},{33806u,33806u,6299u},
+{33833u,33833u,7275u},{33836u,33836u,4683u},{33841u,33841u,7993u},{33848u,33848u,6342u},
+{33853u,33853u,4386u},{33865u,33865u,6001u},{33879u,33879u,6610u},{33883u,33883u,3506u},
+{33889u,33889u,7563u},{33891u,33891u,4346u},{33894u,33894u,6300u},{33899u,33899u,7831u},
+{33900u,33900u,6561u},{33903u,33903u,5875u},{33909u,33909u,4004u},{33914u,33914u,6930u},
+{33936u,33936u,5607u},{33940u,33940u,5712u},{33945u,33945u,4799u},{33948u,33948u,5312u},
+{33953u,33953u,4962u},{33970u,33970u,7564u},{33976u,33976u,6939u},{33979u,33979u,5876u},
+{33980u,33980u,7113u},{33983u,33983u,7832u},{33984u,33984u,5549u},{33986u,33986u,4758u},
+{33988u,33988u,7295u},{33990u,33990u,5415u},{33993u,33993u,6193u},{33995u,33995u,3576u},
+{33997u,33997u,5713u},{34001u,34001u,5288u},{34010u,34010u,5608u},{34028u,34028u,5104u},
+{34030u,34030u,4473u},{34036u,34036u,5659u},{34044u,34044u,4560u},{34065u,34065u,4747u},
+{34067u,34067u,4684u},{34068u,34068u,5084u},{34071u,34071u,6504u},{34072u,34072u,5325u},
+{34074u,34074u,6250u},{34078u,34078u,4573u},{34081u,34081u,7123u},{34083u,34083u,6562u},
+{34085u,34085u,7259u},{34092u,34092u,5527u},{34093u,34093u,6383u},{34095u,34095u,7004u},
+{34109u,34109u,7541u},{34111u,34111u,6301u},{34113u,34113u,4229u},{34115u,34115u,5002u},
+{34121u,34121u,7235u},{34126u,34126u,3885u},{34131u,34131u,6245u},{34137u,34137u,7796u},
+{34147u,34147u,5660u},{34152u,34152u,3981u},{34153u,34153u,7430u},{34154u,34154u,4829u},
+{34157u,34157u,5528u},{34180u,34180u,4901u},{34183u,34183u,4865u},{34191u,34191u,6407u},
+{34193u,34193u,3554u},{34196u,34196u,6563u},{34203u,34203u,5457u},{34214u,34214u,7159u},
+{34216u,34216u,7989u},{34217u,34217u,5319u},{34218u,34218u,5751u},{34223u,34223u,5396u},
+{34224u,34224u,7986u},{34234u,34234u,6772u},{34241u,34241u,3757u},{34249u,34249u,6505u},
+{34253u,34253u,4406u},{34254u,34254u,5752u},{34255u,34255u,6564u},{34261u,34261u,6220u},
+{34268u,34268u,4451u},{34269u,34269u,6040u},{34276u,34276u,4370u},{34277u,34277u,5877u},
+{34281u,34281u,5003u},{34282u,34282u,5609u},{34295u,34295u,6611u},{34298u,34298u,4642u},
+{34299u,34299u,6816u},{34303u,34303u,3817u},{34306u,34306u,6041u},{34310u,34310u,4520u},
+{34311u,34311u,5529u},{34314u,34314u,6088u},{34326u,34326u,5924u},{34327u,34327u,5028u},
+{34330u,34330u,5441u},{34349u,34349u,4395u},{34367u,34367u,4378u},{34382u,34382u,7833u},
+{34384u,34384u,7632u},{34388u,34388u,3609u},{34389u,34389u,7133u},{34395u,34395u,7721u},
+{34396u,34396u,4521u},{34398u,34398u,6221u},{34399u,34399u,7834u},{34407u,34407u,8009u},
+{34425u,34425u,7860u},{34442u,34442u,4845u},{34444u,34444u,4963u},{34451u,34451u,6456u},
+{34467u,34467u,3799u},{34468u,34468u,6817u},{34473u,34473u,7355u},{34503u,34503u,5289u},
+{34507u,34507u,4208u},{34516u,34516u,7945u},{34521u,34521u,6104u},{34523u,34523u,6889u},
+{34527u,34527u,3886u},{34532u,34532u,7666u},{34541u,34541u,7026u},{34558u,34558u,5785u},
+{34560u,34560u,7245u},{34562u,34562u,5105u},{34563u,34563u,5753u},{34568u,34568u,6074u},
+{34584u,34584u,6970u},{34586u,34586u,5214u},{34588u,34588u,4884u},{34638u,34638u,3508u},
+{34645u,34645u,5730u},{34647u,34647u,7924u},{34655u,34655u,6302u},{34662u,34662u,7625u},
+{34664u,34664u,5676u},{34676u,34676u,7835u},{34678u,34678u,6703u},{34680u,34680u,6105u},
+{34690u,34690u,4418u},{34701u,34701u,6372u},{34719u,34719u,4759u},{34722u,34722u,7785u},
+{34739u,34739u,4248u},{34746u,34746u,4379u},{34756u,34756u,7376u},{34784u,34784u,4926u},
+{34796u,34796u,5442u},{34799u,34799u,6162u},{34802u,34802u,7309u},{34809u,34809u,7696u},
+{34811u,34811u,6408u},{34814u,34814u,5467u},{34821u,34821u,5690u},{34847u,34847u,4411u},
+{34850u,34850u,6916u},{34851u,34851u,4452u},{34865u,34865u,3758u},{34870u,34870u,6532u},
+{34875u,34875u,4685u},{34880u,34880u,7756u},{34886u,34886u,6924u},{34892u,34892u,7709u},
+{34893u,34893u,5981u},{34898u,34898u,7750u},{34899u,34899u,5668u},{34903u,34903u,3457u},
+{34905u,34905u,5786u},{34907u,34907u,6303u},{34909u,34909u,7310u},{34913u,34913u,7786u},
+{34914u,34914u,3934u},{34915u,34915u,6409u},{34920u,34920u,7585u},{34923u,34923u,5326u},
+{34928u,34928u,5565u},{34930u,34930u,4151u},{34935u,34935u,7311u},{34942u,34943u,4047u},
+{34945u,34945u,6275u},{34946u,34946u,4763u},{34952u,34952u,3458u},{34955u,34955u,4262u},
+{34957u,34957u,7565u},{34962u,34962u,4209u},{34966u,34966u,5610u},{34967u,34967u,7005u},
+{34974u,34974u,3782u},{34987u,34987u,7601u},{34996u,34996u,3759u},{35009u,35009u,6582u},
+{35010u,35010u,4482u},{35023u,35023u,4632u},{35028u,35028u,6042u},{35029u,35029u,6343u},
+{35033u,35033u,3956u},{35036u,35036u,5070u},{35037u,35037u,6565u},{35039u,35039u,5290u},
+{35041u,35041u,4633u},{35048u,35048u,5215u},{35059u,35059u,5356u},{35060u,35061u,4981u},
+{35064u,35064u,4380u},{35069u,35069u,6773u},{35079u,35079u,5085u},{35088u,35088u,3507u},
+{35090u,35090u,7566u},{35091u,35091u,5071u},{35096u,35096u,6304u},{35097u,35097u,4983u},
+{35109u,35109u,6172u},{35114u,35114u,7462u},{35126u,35126u,5680u},{35128u,35128u,4574u},
+{35131u,35131u,5458u},{35137u,35137u,3555u},{35140u,35140u,5897u},{35167u,35167u,4049u},
+{35172u,35172u,4407u},{35178u,35178u,4694u},{35186u,35186u,5681u},{35199u,35199u,5397u},
+{35201u,35201u,6163u},{35203u,35203u,4230u},{35206u,35206u,5086u},{35207u,35207u,7511u},
+{35211u,35211u,3644u},{35215u,35215u,4005u},{35219u,35219u,4734u},{35222u,35222u,5714u},
+{35233u,35233u,3635u},{35241u,35241u,4298u},{35242u,35242u,7363u},{35250u,35250u,4034u},
+{35258u,35258u,3473u},{35261u,35261u,4408u},{35264u,35264u,3831u},{35282u,35282u,3474u},
+{35299u,35299u,7697u},{35316u,35316u,5357u},{35320u,35320u,7246u},{35328u,35328u,5921u},
+{35330u,35330u,6745u},{35331u,35331u,5139u},{35336u,35336u,3724u},{35338u,35338u,5754u},
+{35340u,35340u,7861u},{35342u,35342u,7452u},{35347u,35347u,7987u},{35350u,35350u,8026u},
+{35351u,35351u,7406u},{35352u,35352u,4114u},{35355u,35355u,6106u},{35357u,35357u,5787u},
+{35359u,35359u,5557u},{35363u,35363u,3653u},{35365u,35365u,4182u},{35370u,35370u,4964u},
+{35373u,35373u,5459u},{35377u,35377u,7722u},{35380u,35380u,5530u},{35382u,35382u,3459u},
+{35386u,35386u,7006u},{35387u,35387u,6890u},{35408u,35408u,5291u},{35412u,35412u,6818u},
+{35413u,35413u,7533u},{35419u,35419u,6612u},{35422u,35422u,5292u},{35424u,35424u,6025u},
+{35426u,35426u,5661u},{35427u,35427u,6043u},{35430u,35430u,5715u},{35433u,35433u,5716u},
+{35437u,35437u,3987u},{35438u,35438u,6673u},{35440u,35440u,8055u},{35441u,35441u,7873u},
+{35442u,35442u,7698u},{35443u,35443u,5358u},{35445u,35445u,5443u},{35449u,35449u,7185u},
+{35461u,35461u,6891u},{35463u,35463u,3809u},{35468u,35468u,6971u},{35469u,35469u,6457u},
+{35475u,35475u,5398u},{35477u,35477u,7417u},{35480u,35480u,6344u},{35486u,35486u,5908u},
+{35488u,35488u,5490u},{35489u,35489u,3725u},{35491u,35491u,4830u},{35492u,35492u,6075u},
+{35493u,35493u,3760u},{35494u,35494u,5558u},{35496u,35496u,7946u},{35498u,35498u,5460u},
+{35504u,35504u,5611u},{35506u,35506u,3810u},{35513u,35513u,5216u},{35516u,35516u,6410u},
+{35518u,35518u,6377u},{35519u,35519u,6819u},{35522u,35522u,7186u},{35524u,35524u,5662u},
+{35527u,35527u,4231u},{35531u,35531u,7202u},{35533u,35533u,6589u},{35535u,35535u,7276u},
+{35538u,35538u,4437u},{35542u,35542u,4535u},{35547u,35547u,6345u},{35548u,35548u,7194u},
+{35553u,35553u,5717u},{35558u,35558u,7210u},{35559u,35559u,7699u},{35562u,35562u,6746u},
+{35563u,35563u,3498u},{35565u,35565u,6346u},{35566u,35566u,6506u},{35569u,35569u,8002u},
+{35574u,35574u,5770u},{35575u,35575u,7593u},{35576u,35576u,6774u},{35578u,35578u,5922u},
+{35582u,35582u,4139u},{35584u,35584u,4785u},{35585u,35585u,5818u},{35586u,35586u,6305u},
+{35588u,35588u,4371u},{35598u,35598u,4866u},{35600u,35600u,4885u},{35604u,35604u,7633u},
+{35606u,35606u,5543u},{35607u,35607u,4965u},{35609u,35609u,3657u},{35610u,35610u,6442u},
+{35611u,35611u,3556u},{35613u,35613u,5293u},{35616u,35616u,6164u},{35624u,35624u,4786u},
+{35627u,35627u,6634u},{35628u,35628u,4589u},{35635u,35635u,3935u},{35641u,35641u,4035u},
+{35649u,35649u,7874u},{35657u,35657u,6940u},{35662u,35662u,8011u},{35663u,35663u,4115u},
+{35672u,35672u,5731u},{35674u,35674u,4232u},{35676u,35676u,5072u},{35686u,35686u,3697u},
+{35692u,35692u,5217u},{35695u,35695u,5953u},{35696u,35696u,6411u},{35700u,35700u,3645u},
+{35703u,35703u,7836u},{35709u,35709u,6044u},{35712u,35712u,4318u},{35722u,35722u,5033u},
+{35728u,35728u,5612u},{35730u,35730u,7090u},{35731u,35731u,5898u},{35734u,35734u,7091u},
+{35738u,35738u,7072u},{35895u,35895u,3772u},{35903u,35903u,3726u},{35905u,35905u,7902u},
+{35910u,35910u,4355u},{35912u,35912u,4116u},{35914u,35914u,7594u},{35916u,35916u,6122u},
+{35925u,35925u,5718u},{35930u,35930u,4327u},{35937u,35937u,5359u},{35946u,35946u,7837u},
+{35947u,35947u,6045u},{35961u,35961u,7586u},{35962u,35962u,5719u},{35970u,35970u,7236u},
+{35978u,35978u,4723u},{35980u,35980u,4787u},{35997u,35997u,7512u},{35998u,35998u,6747u},
+{36000u,36000u,5140u},{36001u,36001u,6583u},{36002u,36002u,3800u},{36007u,36007u,5234u},
+{36008u,36008u,7875u},{36009u,36009u,7495u},{36010u,36010u,7423u},{36011u,36011u,3832u},
+{36012u,36012u,7129u},{36015u,36015u,6613u},{36016u,36016u,5499u},{36019u,36019u,6433u},
+{36020u,36020u,3992u},{36022u,36022u,7528u},{36023u,36023u,4718u},{36024u,36024u,4263u},
+{36027u,36027u,5218u},{36028u,36028u,7195u},{36029u,36029u,6432u},{36031u,36031u,4831u},
+{36032u,36032u,7626u},{36033u,36033u,5169u},{36034u,36034u,4547u},{36035u,36035u,6476u},
+{36036u,36036u,7947u},{36039u,36039u,6507u},{36040u,36040u,3460u},{36042u,36042u,6635u},
+{36049u,36049u,7007u},{36051u,36051u,5235u},{36058u,36058u,4548u},{36060u,36060u,5294u},
+{36062u,36062u,5360u},{36064u,36064u,4984u},{36066u,36066u,7751u},{36067u,36067u,4719u},
+{36068u,36068u,7160u},{36070u,36070u,5141u},{36074u,36074u,7027u},{36077u,36077u,4299u},
+{36084u,36084u,4549u},{36091u,36091u,5142u},{36092u,36092u,3936u},{36093u,36093u,5364u},
+{36100u,36100u,6972u},{36101u,36101u,7315u},{36103u,36103u,6365u},{36104u,36104u,6941u},
+{36106u,36106u,7073u},{36109u,36109u,5468u},{36115u,36115u,6566u},{36118u,36118u,5544u},
+{36196u,36196u,6636u},{36198u,36198u,5295u},{36203u,36203u,7732u},{36208u,36208u,6892u},
+{36211u,36211u,4006u},{36212u,36212u,5143u},{36215u,36215u,4117u},{36229u,36229u,7237u},
+{36234u,36234u,6282u},{36249u,36249u,6820u},{36259u,36259u,7326u},{36264u,36264u,7277u},
+{36275u,36275u,6830u},{36282u,36282u,5144u},{36286u,36286u,6973u},{36294u,36294u,7442u},
+{36299u,36299u,4936u},{36300u,36300u,7028u},{36303u,36303u,3461u},{36315u,36315u,7488u},
+{36317u,36317u,3596u},{36321u,36321u,6637u},{36323u,36323u,5444u},{36328u,36328u,3811u},
+{36335u,36335u,4522u},{36339u,36339u,4300u},{36362u,36362u,6194u},{36367u,36367u,4237u},
+{36368u,36368u,7161u},{36382u,36382u,3597u},{36394u,36394u,6850u},{36400u,36400u,6347u},
+{36405u,36405u,6851u},{36418u,36418u,6348u},{36420u,36420u,6775u},{36423u,36423u,3610u},
+{36424u,36424u,4301u},{36425u,36425u,7052u},{36426u,36426u,7797u},{36441u,36441u,7296u},
+{36447u,36447u,6638u},{36448u,36448u,7145u},{36468u,36468u,7297u},{36470u,36470u,3982u},
+{36481u,36481u,6821u},{36487u,36487u,6614u},{36490u,36490u,6893u},{36493u,36493u,5878u},
+{36522u,36522u,4643u},{36523u,36523u,5755u},{36524u,36524u,3968u},{36544u,36544u,3937u},
+{36554u,36554u,7053u},{36555u,36555u,5819u},{36556u,36556u,3988u},{36557u,36557u,3957u},
+{36562u,36562u,7726u},{36575u,36575u,5982u},{36587u,36587u,7008u},{36600u,36600u,7298u},
+{36603u,36603u,3462u},{36606u,36606u,5732u},{36611u,36611u,3887u},{36613u,36613u,4523u},
+{36617u,36617u,6584u},{36626u,36626u,7196u},{36627u,36627u,4686u},{36628u,36628u,5073u},
+{36629u,36629u,3698u},{36635u,36635u,4438u},{36636u,36636u,7356u},{36637u,36637u,8003u},
+{36638u,36638u,4706u},{36639u,36639u,7174u},{36646u,36646u,4474u},{36647u,36647u,5055u},
+{36649u,36649u,4985u},{36650u,36650u,4599u},{36655u,36655u,7035u},{36659u,36659u,6894u},
+{36664u,36664u,5613u},{36665u,36665u,5087u},{36667u,36667u,5088u},{36670u,36670u,6674u},
+{36671u,36671u,5944u},{36676u,36676u,7650u},{36677u,36677u,6276u},{36681u,36681u,6675u},
+{36685u,36685u,7175u},{36686u,36686u,3888u},{36701u,36701u,5945u},{36703u,36703u,3867u},
+{36706u,36706u,4463u},{36763u,36763u,5756u},{36764u,36764u,3761u},{36771u,36771u,4398u},
+{36774u,36774u,7496u},{36776u,36776u,5034u},{36781u,36781u,5296u},{36783u,36783u,5035u},
+{36784u,36784u,7009u},{36785u,36785u,6173u},{36786u,36786u,4177u},{36802u,36802u,6222u},
+{36805u,36805u,5757u},{36814u,36814u,6026u},{36817u,36817u,4036u},{36820u,36820u,4927u},
+{36838u,36838u,3463u},{36842u,36842u,6639u},{36843u,36843u,4902u},{36845u,36845u,7029u},
+{36848u,36848u,5669u},{36850u,36850u,3626u},{36855u,36855u,4867u},{36857u,36857u,6640u},
+{36861u,36861u,7278u},{36864u,36864u,7463u},{36865u,36865u,5559u},{36866u,36866u,3838u},
+{36867u,36867u,4302u},{36869u,36869u,7978u},{36870u,36870u,5954u},{36872u,36872u,7787u},
+{36875u,36875u,7567u},{36877u,36877u,5531u},{36879u,36879u,7469u},{36880u,36880u,7299u},
+{36881u,36881u,3938u},{36884u,36884u,4303u},{36885u,36885u,3699u},{36887u,36887u,4356u},
+{36889u,36889u,6615u},{36890u,36890u,7458u},{36893u,36893u,5399u},{36894u,36894u,4500u},
+{36895u,36895u,5545u},{36896u,36896u,6822u},{36897u,36897u,6917u},{36898u,36898u,5106u},
+{36899u,36899u,4475u},{36910u,36910u,7211u},{36913u,36913u,6895u},{36914u,36914u,7010u},
+{36917u,36917u,4007u},{36920u,36920u,6466u},{36924u,36924u,7615u},{36926u,36926u,6350u},
+{36929u,36929u,4361u},{36930u,36930u,5614u},{36935u,36935u,6223u},{36938u,36938u,6349u},
+{36939u,36939u,6246u},{36941u,36941u,7525u},{36942u,36942u,3812u},{36944u,36944u,7627u},
+{36945u,36945u,7925u},{36947u,36947u,4304u},{36948u,36948u,4216u},{36949u,36949u,6306u},
+{36953u,36953u,6165u},{36956u,36956u,5550u},{36957u,36957u,4238u},{36958u,36958u,7212u},
+{36960u,36960u,6277u},{36961u,36961u,5532u},{36963u,36963u,3646u},{36969u,36969u,6641u},
+{36973u,36973u,6823u},{36974u,36974u,7054u},{36975u,36975u,4362u},{36978u,36978u,6974u},
+{36981u,36981u,6918u},{36983u,36983u,7162u},{36984u,36984u,5445u},{36986u,36986u,6351u},
+{36988u,36988u,4561u},{36989u,36989u,3598u},{36991u,36991u,7602u},{36992u,36992u,6166u},
+{36993u,36993u,4720u},{36994u,36994u,7700u},{36995u,36995u,5615u},{36996u,36996u,7896u},
+{36999u,36999u,6434u},{37000u,37000u,4669u},{37002u,37002u,5036u},{37007u,37007u,4381u},
+{37009u,37009u,6389u},{37013u,37013u,6096u},{37017u,37017u,4707u},{37026u,37026u,7788u},
+{37027u,37027u,4138u},{37030u,37030u,4966u},{37032u,37032u,7250u},{37034u,37034u,5297u},
+{37039u,37039u,3526u},{37040u,37040u,7443u},{37041u,37041u,3939u},{37045u,37045u,5533u},
+{37048u,37048u,6616u},{37057u,37057u,6236u},{37066u,37066u,3889u},{37086u,37086u,4419u},
+{37089u,37089u,3958u},{37096u,37096u,5145u},{37101u,37101u,3818u},{37109u,37109u,6224u},
+{37117u,37117u,4305u},{37122u,37122u,5802u},{37138u,37138u,7279u},{37141u,37141u,7714u},
+{37145u,37145u,5219u},{37159u,37159u,4372u},{37165u,37165u,6748u},{37170u,37170u,4210u},
+{37193u,37193u,6352u},{37194u,37194u,6749u},{37195u,37195u,7280u},{37196u,37196u,6519u},
+{37197u,37197u,4986u},{37198u,37198u,6896u},{37202u,37202u,6897u},{37218u,37218u,7238u},
+{37225u,37225u,4760u},{37226u,37226u,4387u},{37228u,37228u,5616u},{37237u,37237u,7964u},
+{37239u,37239u,7843u},{37240u,37240u,5313u},{37255u,37255u,5663u},{37257u,37257u,7327u},
+{37259u,37259u,7239u},{37261u,37261u,6776u},{37266u,37266u,5491u},{37276u,37276u,7281u},
+{37291u,37291u,6412u},{37292u,37292u,6567u},{37294u,37294u,7240u},{37295u,37295u,7798u},
+{37297u,37297u,4937u},{37300u,37300u,4509u},{37301u,37301u,3584u},{37312u,37312u,5899u},
+{37319u,37319u,7124u},{37321u,37321u,6353u},{37323u,37323u,5416u},{37324u,37324u,4634u},
+{37325u,37325u,6925u},{37326u,37326u,5871u},{37327u,37327u,4439u},{37328u,37328u,4635u},
+{37329u,37329u,4131u},{37335u,37335u,5566u},{37336u,37336u,6750u},{37340u,37340u,5146u},
+{37341u,37341u,7374u},{37347u,37347u,6824u},{37351u,37351u,7163u},{37354u,37354u,6225u},
+{37365u,37365u,7125u},{37389u,37389u,4363u},{37392u,37392u,3622u},{37393u,37393u,7497u},
+{37394u,37394u,5329u},{37399u,37399u,6366u},{37406u,37406u,4014u},{37428u,37428u,4501u},
+{37434u,37434u,6082u},{37439u,37439u,6676u},{37440u,37440u,3534u},{37445u,37445u,3599u},
+{37449u,37449u,7752u},{37463u,37463u,3658u},{37467u,37467u,5983u},{37470u,37470u,6283u},
+{37474u,37474u,4938u},{37476u,37476u,3940u},{37477u,37477u,5670u},{37478u,37478u,6751u},
+{37504u,37504u,6378u},{37507u,37507u,7260u},{37509u,37509u,4347u},{37521u,37521u,5446u},
+{37523u,37523u,6677u},{37526u,37526u,5617u},{37528u,37528u,4761u},{37532u,37532u,7660u},
+{37555u,37555u,6046u},{37558u,37558u,3941u},{37559u,37559u,5534u},{37561u,37561u,5618u},
+{37580u,37580u,6752u},{37583u,37583u,7769u},{37586u,37586u,5107u},{37604u,37604u,5400u},
+{37610u,37610u,7568u},{37624u,37624u,3600u},{37628u,37628u,3557u},{37636u,37636u,4532u},
+{37648u,37648u,7282u},{37656u,37656u,7283u},{37658u,37658u,6590u},{37662u,37662u,5664u},
+{37663u,37663u,4233u},{37664u,37664u,6753u},{37665u,37665u,4118u},{37666u,37666u,6678u},
+{37668u,37668u,4119u},{37670u,37670u,4050u},{37672u,37672u,4811u},{37675u,37675u,5417u},
+{37678u,37678u,3762u},{37679u,37679u,7059u},{37704u,37704u,6027u},{37706u,37706u,4476u},
+{37707u,37707u,3813u},{37709u,37709u,4306u},{37716u,37716u,5803u},{37723u,37723u,4211u},
+{37742u,37742u,6354u},{37749u,37749u,3611u},{37756u,37756u,7375u},{37758u,37758u,6852u},
+{37772u,37772u,3659u},{37780u,37780u,6195u},{37782u,37782u,5564u},{37786u,37786u,7284u},
+{37795u,37795u,7789u},{37799u,37799u,3577u},{37804u,37804u,7838u},{37805u,37805u,7011u},
+{37808u,37808u,6467u},{37827u,37827u,6831u},{37841u,37841u,6642u},{37854u,37854u,6196u},
+{37857u,37857u,3700u},{37860u,37860u,4575u},{37878u,37878u,7036u},{37892u,37892u,7952u},
+{37912u,37912u,6853u},{37925u,37925u,5447u},{37931u,37931u,6679u},{37941u,37941u,7176u},
+{37944u,37944u,7407u},{37956u,37956u,6898u},{37969u,37970u,3527u},{37979u,37979u,3851u},
+{38013u,38013u,7074u},{38015u,38015u,7060u},{38263u,38263u,6568u},{38272u,38272u,4846u},
+{38275u,38275u,5469u},{38281u,38281u,7542u},{38283u,38283u,3578u},{38287u,38287u,6367u},
+{38289u,38290u,7645u},{38291u,38291u,3499u},{38292u,38292u,4882u},{38296u,38296u,3535u},
+{38307u,38307u,3475u},{38308u,38308u,7667u},{38309u,38309u,5008u},{38312u,38312u,4008u},
+{38317u,38317u,4453u},{38321u,38321u,5988u},{38331u,38331u,5996u},{38332u,38332u,5820u},
+{38343u,38343u,5828u},{38346u,38346u,7903u},{38356u,38356u,7668u},{38357u,38357u,3983u},
+{38358u,38358u,7473u},{38364u,38364u,3833u},{38369u,38369u,7164u},{38370u,38370u,5029u},
+{38428u,38428u,5147u},{38433u,38433u,7165u},{38442u,38442u,7498u},{38446u,38446u,6123u},
+{38450u,38450u,4967u},{38459u,38459u,6825u},{38463u,38463u,5788u},{38464u,38464u,7391u},
+{38466u,38466u,7603u},{38468u,38468u,5148u},{38475u,38475u,4576u},{38476u,38476u,4724u},
+{38477u,38477u,3558u},{38480u,38480u,7647u},{38491u,38491u,7543u},{38492u,38492u,7669u},
+{38493u,38493u,5470u},{38494u,38494u,5691u},{38495u,38495u,7146u},{38498u,38498u,6278u},
+{38499u,38499u,7012u},{38500u,38500u,6777u},{38506u,38506u,4987u},{38512u,38512u,6384u},
+{38515u,38515u,7013u},{38517u,38517u,4612u},{38518u,38518u,4307u},{38519u,38519u,7661u},
+{38520u,38520u,4593u},{38525u,38525u,5900u},{38533u,38533u,6226u},{38534u,38534u,4603u},
+{38538u,38538u,4264u},{38539u,38539u,5619u},{38541u,38541u,7926u},{38542u,38542u,3727u},
+{38548u,38548u,3636u},{38549u,38549u,6247u},{38552u,38552u,5849u},{38553u,38553u,4022u},
+{38555u,38555u,6778u},{38556u,38556u,6569u},{38563u,38563u,4644u},{38567u,38568u,5620u},
+{38570u,38570u,7728u},{38577u,38577u,6379u},{38583u,38583u,4510u},{38587u,38587u,7147u},
+{38592u,38592u,6520u},{38593u,38593u,5813u},{38596u,38596u,6254u},{38597u,38597u,5789u},
+{38598u,38598u,7037u},{38599u,38599u,3763u},{38601u,38601u,7357u},{38603u,38603u,6919u},
+{38604u,38604u,6508u},{38605u,38605u,6097u},{38606u,38606u,6617u},{38613u,38613u,6826u},
+{38614u,38614u,5622u},{38617u,38617u,5773u},{38619u,38619u,7285u},{38620u,38620u,6533u},
+{38626u,38626u,4636u},{38627u,38627u,4142u},{38632u,38633u,6227u},{38634u,38634u,5461u},
+{38639u,38639u,4847u},{38640u,38640u,5170u},{38642u,38642u,6248u},{38646u,38646u,4502u},
+{38647u,38647u,4550u},{38649u,38649u,4903u},{38651u,38651u,6680u},{38656u,38656u,5623u},
+{38662u,38662u,6754u},{38663u,38663u,7014u},{38673u,38673u,6698u},{38675u,38675u,6047u},
+{38678u,38678u,4651u},{38681u,38681u,6028u},{38684u,38684u,5361u},{38686u,38686u,7628u},
+{38695u,38695u,4832u},{38704u,38704u,5314u},{38706u,38706u,4524u},{38713u,38713u,5030u},
+{38717u,38717u,6779u},{38722u,38722u,4464u},{38724u,38724u,5850u},{38728u,38728u,4503u},
+{38737u,38737u,7203u},{38742u,38742u,6755u},{38748u,38748u,6756u},{38750u,38750u,5220u},
+{38753u,38753u,4868u},{38754u,38754u,4744u},{38761u,38761u,7733u},{38765u,38765u,6458u},
+{38772u,38772u,7876u},{38775u,38775u,6459u},{38778u,38778u,4695u},{38795u,38795u,7799u},
+{38797u,38797u,5814u},{38799u,38799u,3801u},{38816u,38816u,3950u},{38824u,38824u,3509u},
+{38827u,38827u,3951u},{38829u,38829u,7526u},{38854u,38854u,7166u},{38859u,38859u,6307u},
+{38867u,38867u,7648u},{38876u,38876u,4308u},{38899u,38899u,6385u},{38902u,38902u,5535u},
+{38907u,38907u,6249u},{38911u,38911u,7715u},{38912u,38912u,7839u},{38913u,38913u,7757u},
+{38914u,38914u,6757u},{38915u,38915u,3701u},{38917u,38917u,7684u},{38918u,38918u,5665u},
+{38920u,38920u,5624u},{38922u,38922u,6237u},{38924u,38924u,5560u},{38928u,38928u,6048u},
+{38929u,38929u,6124u},{38930u,38930u,4928u},{38931u,38931u,4328u},{38935u,38935u,7489u},
+{38936u,38936u,4504u},{38957u,38957u,4357u},{38960u,38960u,7770u},{38968u,38968u,3702u},
+{38969u,38969u,7464u},{38971u,38971u,5236u},{38982u,38982u,3814u},{38988u,38988u,6780u},
+{38989u,38989u,5857u},{38990u,38990u,5804u},{38996u,38996u,5815u},{39000u,39000u,6279u},
+{39002u,39002u,6681u},{39006u,39006u,4590u},{39013u,39013u,7840u},{39015u,39015u,3764u},
+{39019u,39019u,6682u},{39023u,39023u,7753u},{39080u,39080u,7595u},{39087u,39087u,5330u},
+{39089u,39089u,7444u},{39108u,39108u,7588u},{39111u,39111u,7587u},{39131u,39131u,5221u},
+{39132u,39132u,5004u},{39135u,39135u,5733u},{39137u,39137u,5551u},{39138u,39138u,4120u},
+{39149u,39149u,7362u},{39150u,39150u,6386u},{39151u,39151u,4929u},{39156u,39156u,6435u},
+{39164u,39164u,5298u},{39165u,39165u,7569u},{39166u,39166u,5734u},{39171u,39171u,3890u},
+{39177u,39177u,7716u},{39178u,39178u,5901u},{39180u,39180u,6436u},{39184u,39184u,7075u},
+{39187u,39187u,5790u},{39192u,39192u,5946u},{39198u,39198u,6683u},{39200u,39200u,5056u},
+{39208u,39208u,3834u},{39237u,39237u,4687u},{39241u,39241u,4037u},{39243u,39243u,3989u},
+{39244u,39244u,7076u},{39245u,39245u,5448u},{39249u,39249u,4121u},{39250u,39250u,6167u},
+{39252u,39252u,6098u},{39255u,39255u,7717u},{39318u,39318u,5625u},{39321u,39321u,7718u},
+{39325u,39325u,7613u},{39333u,39333u,5089u},{39336u,39336u,7790u},{39340u,39340u,4661u},
+{39341u,39341u,5909u},{39342u,39342u,7596u},{39345u,39345u,7392u},{39347u,39347u,7358u},
+{39348u,39348u,5666u},{39353u,39353u,6468u},{39361u,39361u,4904u},{39376u,39376u,6899u},
+{39377u,39377u,4174u},{39378u,39378u,3942u},{39381u,39381u,3464u},{39385u,39385u,5149u},
+{39389u,39389u,7393u},{39391u,39391u,5299u},{39405u,39405u,7701u},{39409u,39409u,4388u},
+{39423u,39423u,6920u},{39425u,39425u,5240u},{39432u,39432u,5057u},{39438u,39439u,4122u},
+{39449u,39449u,7527u},{39467u,39467u,3612u},{39472u,39472u,4373u},{39478u,39478u,7286u},
+{39479u,39479u,5536u},{39488u,39488u,4725u},{39491u,39491u,7589u},{39493u,39493u,3943u},
+{39501u,39501u,7965u},{39509u,39509u,3891u},{39511u,39511u,7729u},{39514u,39514u,3703u},
+{39515u,39515u,5955u},{39519u,39519u,7328u},{39522u,39522u,4454u},{39525u,39525u,4124u},
+{39529u,39529u,7897u},{39530u,39530u,4455u},{39592u,39592u,3785u},{39608u,39608u,7702u},
+{39635u,39635u,5626u},{39636u,39636u,7213u},{39640u,39640u,3765u},{39653u,39653u,5997u},
+{39662u,39662u,4939u},{39706u,39706u,5627u},{39719u,39719u,4562u},{39722u,39722u,7470u},
+{39729u,39729u,6251u},{39740u,39740u,3993u},{39745u,39745u,3863u},{39746u,39746u,7849u},
+{39747u,39747u,4940u},{39748u,39748u,4995u},{39749u,39749u,4721u},{39759u,39759u,6308u},
+{39764u,39764u,4662u},{39770u,39770u,5910u},{39791u,39791u,4525u},{39822u,39822u,6699u},
+{39825u,39825u,7570u},{39839u,39839u,5816u},{39851u,39851u,3892u},{39854u,39854u,5449u},
+{39881u,39881u,4637u},{39894u,39894u,7204u},{39908u,39908u,3783u},{39912u,39912u,3704u},
+{39949u,39949u,7287u},{39952u,39952u,5805u},{39954u,39954u,5090u},{39957u,39957u,7629u},
+{39973u,39973u,7898u},{39986u,39986u,6076u},{39995u,39995u,4688u},{40007u,40007u,3559u},
+{40009u,40009u,5039u},{40023u,40023u,4645u},{40165u,40165u,6827u},{40167u,40167u,5150u},
+{40169u,40169u,3944u},{40179u,40179u,5108u},{40180u,40180u,4762u},{40182u,40182u,5984u},
+{40201u,40201u,5791u},{40219u,40219u,6280u},{40230u,40230u,5839u},{40232u,40232u,5832u},
+{40251u,40251u,7862u},{40273u,40273u,3647u},{40285u,40285u,5792u},{40288u,40288u,3773u},
+{40289u,40289u,4833u},{40300u,40300u,5180u},{40306u,40306u,6521u},{40361u,40361u,4794u},
+{40367u,40367u,5860u},{40372u,40372u,7634u},{40388u,40388u,3728u},{40407u,40407u,3945u},
+{40434u,40434u,7329u},{40440u,40440u,8012u},{40441u,40441u,6393u},{40442u,40442u,4526u},
+{40474u,40474u,5861u},{40478u,40478u,4396u},{40565u,40565u,4527u},{40569u,40569u,7662u},
+{40573u,40573u,5998u},{40575u,40575u,4533u},{40594u,40594u,4125u},{40595u,40595u,4534u},
+{40599u,40599u,4456u},{40605u,40605u,5300u},{40607u,40607u,4646u},{40613u,40613u,4726u},
+{40628u,40628u,3952u},{40629u,40629u,4745u},{40635u,40635u,4663u},{40638u,40638u,8004u},
+{40643u,40643u,7927u},{40653u,40653u,5401u},{40654u,40654u,4457u},{40657u,40657u,8018u},
+{40660u,40660u,3623u},{40664u,40664u,4835u},{40667u,40667u,4265u},{40668u,40668u,7305u},
+{40670u,40670u,6700u},{40680u,40680u,4249u},{40692u,40692u,4869u},{40711u,40711u,6077u},
+{40712u,40712u,5040u},{40718u,40718u,6758u},{40723u,40723u,3766u},{40736u,40736u,5402u},
+{40763u,40763u,5222u},{40778u,40778u,6781u},{40779u,40779u,6585u},{40782u,40782u,6586u},
+{40786u,40786u,7359u},{40799u,40799u,6618u},{40801u,40801u,4505u},{40807u,40807u,5462u},
+{40810u,40810u,7061u},{40812u,40812u,5911u},{40823u,40823u,5806u},{40845u,40845u,4563u},
+{40848u,40848u,4968u},{40853u,40853u,3529u},{40860u,40860u,3946u},{44032u,44033u,1086u},
+{44034u,44035u,9333u},{44036u,44036u,1088u},{44037u,44038u,9335u},{44039u,44042u,1089u},
+{44043u,44047u,9337u},{44048u,44055u,1093u},{44056u,44056u,9342u},{44057u,44061u,1101u},
+{44062u,44063u,9343u},{44064u,44064u,1106u},{44065u,44067u,9345u},{44068u,44068u,1107u},
+{44069u,44075u,9348u},{44076u,44077u,1108u},{44078u,44078u,9355u},{44079u,44081u,1110u},
+{44082u,44087u,9356u},{44088u,44089u,1113u},{44090u,44091u,9362u},{44092u,44092u,1115u},
+{44093u,44095u,9364u},{44096u,44096u,1116u},{44097u,44106u,9367u},{44107u,44107u,1117u},
+{44108u,44108u,9377u},{44109u,44109u,1118u},{44110u,44115u,9378u},{44116u,44116u,1119u},
+{44117u,44119u,9384u},{44120u,44120u,1120u},{44121u,44123u,9387u},{44124u,44124u,1121u},
+{44125u,44143u,9390u},{44144u,44145u,1122u},{44146u,44147u,9409u},{44148u,44148u,1124u},
+{44149u,44150u,9411u},{44151u,44152u,1125u},{44153u,44153u,9413u},{44154u,44154u,1127u},
+{44155u,44159u,9414u},{44160u,44161u,1128u},{44162u,44162u,9419u},{44163u,44166u,1130u},
+{44167u,44168u,9420u},{44169u,44172u,1134u},{44173u,44175u,9422u},{44176u,44176u,1138u},
+{44177u,44179u,9425u},{44180u,44180u,1139u},{44181u,44187u,9428u},{44188u,44189u,1140u},
+{44190u,44190u,9435u},{44191u,44193u,1142u},{44194u,44199u,9436u},{44200u,44202u,1145u},
+{44203u,44203u,9442u},{44204u,44204u,1148u},{44205u,44206u,9443u},{44207u,44208u,1149u},
+{44209u,44215u,9445u},{44216u,44217u,1151u},{44218u,44218u,9452u},{44219u,44221u,1153u},
+{44222u,44224u,9453u},{44225u,44225u,1156u},{44226u,44227u,9456u},{44228u,44228u,1157u},
+{44229u,44231u,9458u},{44232u,44232u,1158u},{44233u,44235u,9461u},{44236u,44236u,1159u},
+{44237u,44244u,9464u},{44245u,44245u,1160u},{44246u,44246u,9472u},{44247u,44247u,1161u},
+{44248u,44255u,9473u},{44256u,44257u,1162u},{44258u,44259u,9481u},{44260u,44260u,1164u},
+{44261u,44262u,9483u},{44263u,44264u,1165u},{44265u,44265u,9485u},{44266u,44266u,1167u},
+{44267u,44267u,9486u},{44268u,44268u,1168u},{44269u,44270u,9487u},{44271u,44273u,1169u},
+{44274u,44274u,9489u},{44275u,44275u,1172u},{44276u,44276u,9490u},{44277u,44278u,1173u},
+{44279u,44283u,9491u},{44284u,44285u,1175u},{44286u,44287u,9496u},{44288u,44288u,1177u},
+{44289u,44291u,9498u},{44292u,44292u,1178u},{44293u,44293u,9501u},{44294u,44294u,1179u},
+{44295u,44299u,9502u},{44300u,44301u,1180u},{44302u,44302u,9507u},{44303u,44303u,1182u},
+{44304u,44304u,9508u},{44305u,44305u,1183u},{44306u,44311u,9509u},{44312u,44312u,1184u},
+{44313u,44315u,9515u},{44316u,44316u,1185u},{44317u,44319u,9518u},{44320u,44320u,1186u},
+{44321u,44328u,9521u},{44329u,44329u,1187u},{44330u,44331u,9529u},{44332u,44333u,1188u},
+{44334u,44339u,9531u},{44340u,44341u,1190u},{44342u,44343u,9537u},{44344u,44344u,1192u},
+{44345u,44347u,9539u},{44348u,44348u,1193u},{44349u,44355u,9542u},{44356u,44357u,1194u},
+{44358u,44358u,9549u},{44359u,44359u,1196u},{44360u,44360u,9550u},{44361u,44361u,1197u},
+{44362u,44367u,9551u},{44368u,44368u,1198u},{44369u,44371u,9557u},{44372u,44372u,1199u},
+{44373u,44375u,9560u},{44376u,44376u,1200u},{44377u,44384u,9563u},{44385u,44385u,1201u},
+{44386u,44386u,9571u},{44387u,44387u,1202u},{44388u,44395u,9572u},{44396u,44397u,1203u},
+{44398u,44399u,9580u},{44400u,44400u,1205u},{44401u,44402u,9582u},{44403u,44406u,1206u},
+{44407u,44410u,9584u},{44411u,44413u,1210u},{44414u,44414u,9588u},{44415u,44415u,1213u},
+{44416u,44416u,9589u},{44417u,44418u,1214u},{44419u,44423u,9590u},{44424u,44425u,1216u},
+{44426u,44427u,9595u},{44428u,44428u,1218u},{44429u,44431u,9597u},{44432u,44432u,1219u},
+{44433u,44443u,9600u},{44444u,44445u,1220u},{44446u,44451u,9611u},{44452u,44452u,1222u},
+{44453u,44470u,9617u},{44471u,44471u,1223u},{44472u,44479u,9635u},{44480u,44481u,1224u},
+{44482u,44483u,9643u},{44484u,44484u,1226u},{44485u,44487u,9645u},{44488u,44488u,1227u},
+{44489u,44495u,9648u},{44496u,44497u,1228u},{44498u,44498u,9655u},{44499u,44499u,1230u},
+{44500u,44507u,9656u},{44508u,44508u,1231u},{44509u,44511u,9664u},{44512u,44512u,1232u},
+{44513u,44515u,9667u},{44516u,44516u,1233u},{44517u,44535u,9670u},{44536u,44537u,1234u},
+{44538u,44539u,9689u},{44540u,44540u,1236u},{44541u,44542u,9691u},{44543u,44545u,1237u},
+{44546u,44551u,9693u},{44552u,44553u,1240u},{44554u,44554u,9699u},{44555u,44555u,1242u},
+{44556u,44556u,9700u},{44557u,44557u,1243u},{44558u,44563u,9701u},{44564u,44564u,1244u},
+{44565u,44591u,9707u},{44592u,44593u,1245u},{44594u,44595u,9734u},{44596u,44596u,1247u},
+{44597u,44598u,9736u},{44599u,44600u,1248u},{44601u,44601u,9738u},{44602u,44602u,1250u},
+{44603u,44607u,9739u},{44608u,44609u,1251u},{44610u,44610u,9744u},{44611u,44611u,1253u},
+{44612u,44612u,9745u},{44613u,44614u,1254u},{44615u,44617u,9746u},{44618u,44618u,1256u},
+{44619u,44619u,9749u},{44620u,44622u,1257u},{44623u,44623u,9750u},{44624u,44624u,1260u},
+{44625u,44627u,9751u},{44628u,44628u,1261u},{44629u,44629u,9754u},{44630u,44630u,1262u},
+{44631u,44635u,9755u},{44636u,44637u,1263u},{44638u,44638u,9760u},{44639u,44641u,1265u},
+{44642u,44644u,9761u},{44645u,44645u,1268u},{44646u,44647u,9764u},{44648u,44649u,1269u},
+{44650u,44651u,9766u},{44652u,44652u,1271u},{44653u,44655u,9768u},{44656u,44656u,1272u},
+{44657u,44663u,9771u},{44664u,44665u,1273u},{44666u,44666u,9778u},{44667u,44669u,1275u},
+{44670u,44675u,9779u},{44676u,44677u,1278u},{44678u,44683u,9785u},{44684u,44684u,1280u},
+{44685u,44731u,9791u},{44732u,44734u,1281u},{44735u,44735u,9838u},{44736u,44736u,1284u},
+{44737u,44739u,9839u},{44740u,44740u,1285u},{44741u,44747u,9842u},{44748u,44749u,1286u},
+{44750u,44750u,9849u},{44751u,44753u,1288u},{44754u,44759u,9850u},{44760u,44761u,1291u},
+{44762u,44763u,9856u},{44764u,44764u,1293u},{44765u,44775u,9858u},{44776u,44776u,1294u},
+{44777u,44778u,9869u},{44779u,44779u,1295u},{44780u,44780u,9871u},{44781u,44781u,1296u},
+{44782u,44787u,9872u},{44788u,44788u,1297u},{44789u,44791u,9878u},{44792u,44792u,1298u},
+{44793u,44795u,9881u},{44796u,44796u,1299u},{44797u,44806u,9884u},{44807u,44808u,1300u},
+{44809u,44812u,9894u},{44813u,44813u,1302u},{44814u,44815u,9898u},{44816u,44816u,1303u},
+{44817u,44843u,9900u},{44844u,44845u,1304u},{44846u,44847u,9927u},{44848u,44848u,1306u},
+{44849u,44849u,9929u},{44850u,44850u,1307u},{44851u,44851u,9930u},{44852u,44852u,1308u},
+{44853u,44859u,9931u},{44860u,44861u,1309u},{44862u,44862u,9938u},{44863u,44863u,1311u},
+{44864u,44864u,9939u},{44865u,44867u,1312u},{44868u,44871u,9940u},{44872u,44873u,1315u},
+{44874u,44879u,9944u},{44880u,44880u,1317u},{44881u,44891u,9950u},{44892u,44893u,1318u},
+{44894u,44899u,9961u},{44900u,44901u,1320u},{44902u,44920u,9967u},{44921u,44921u,1322u},
+{44922u,44927u,9986u},{44928u,44928u,1323u},{44929u,44931u,9992u},{44932u,44932u,1324u},
+{44933u,44935u,9995u},{44936u,44936u,1325u},{44937u,44943u,9998u},{44944u,44945u,1326u},
+{44946u,44948u,10005u},{44949u,44949u,1328u},{44950u,44955u,10008u},{44956u,44956u,1329u},
+{44957u,44983u,10014u},{44984u,44985u,1330u},{44986u,44987u,10041u},{44988u,44988u,1332u},
+{44989u,44991u,10043u},{44992u,44992u,1333u},{44993u,44998u,10046u},{44999u,45001u,1334u},
+{45002u,45002u,10052u},{45003u,45003u,1337u},{45004u,45004u,10053u},{45005u,45006u,1338u},
+{45007u,45011u,10054u},{45012u,45012u,1340u},{45013u,45019u,10059u},{45020u,45020u,1341u},
+{45021u,45031u,10066u},{45032u,45033u,1342u},{45034u,45039u,10077u},{45040u,45041u,1344u},
+{45042u,45043u,10083u},{45044u,45044u,1346u},{45045u,45047u,10085u},{45048u,45048u,1347u},
+{45049u,45055u,10088u},{45056u,45057u,1348u},{45058u,45059u,10095u},{45060u,45060u,1350u},
+{45061u,45067u,10097u},{45068u,45068u,1351u},{45069u,45071u,10104u},{45072u,45072u,1352u},
+{45073u,45075u,10107u},{45076u,45076u,1353u},{45077u,45083u,10110u},{45084u,45085u,1354u},
+{45086u,45095u,10117u},{45096u,45096u,1356u},{45097u,45123u,10127u},{45124u,45125u,1357u},
+{45126u,45127u,10154u},{45128u,45128u,1359u},{45129u,45129u,10156u},{45130u,45130u,1360u},
+{45131u,45131u,10157u},{45132u,45132u,1361u},{45133u,45133u,10158u},{45134u,45134u,1362u},
+{45135u,45138u,10159u},{45139u,45141u,1363u},{45142u,45142u,10163u},{45143u,45143u,1366u},
+{45144u,45144u,10164u},{45145u,45145u,1367u},{45146u,45148u,10165u},{45149u,45149u,1368u},
+{45150u,45179u,10168u},{45180u,45181u,1369u},{45182u,45183u,10198u},{45184u,45184u,1371u},
+{45185u,45187u,10200u},{45188u,45188u,1372u},{45189u,45195u,10203u},{45196u,45197u,1373u},
+{45198u,45198u,10210u},{45199u,45199u,1375u},{45200u,45200u,10211u},{45201u,45201u,1376u},
+{45202u,45207u,10212u},{45208u,45210u,1377u},{45211u,45211u,10218u},{45212u,45212u,1380u},
+{45213u,45214u,10219u},{45215u,45218u,1381u},{45219u,45223u,10221u},{45224u,45225u,1385u},
+{45226u,45226u,10226u},{45227u,45231u,1387u},{45232u,45232u,10227u},{45233u,45233u,1392u},
+{45234u,45234u,10228u},{45235u,45237u,1393u},{45238u,45239u,10229u},{45240u,45240u,1396u},
+{45241u,45243u,10231u},{45244u,45244u,1397u},{45245u,45251u,10234u},{45252u,45253u,1398u},
+{45254u,45254u,10241u},{45255u,45257u,1400u},{45258u,45263u,10242u},{45264u,45265u,1403u},
+{45266u,45267u,10248u},{45268u,45268u,1405u},{45269u,45271u,10250u},{45272u,45272u,1406u},
+{45273u,45279u,10253u},{45280u,45280u,1407u},{45281u,45284u,10260u},{45285u,45285u,1408u},
+{45286u,45319u,10264u},{45320u,45321u,1409u},{45322u,45322u,10298u},{45323u,45324u,1411u},
+{45325u,45327u,10299u},{45328u,45328u,1413u},{45329u,45329u,10302u},{45330u,45331u,1414u},
+{45332u,45335u,10303u},{45336u,45337u,1416u},{45338u,45338u,10307u},{45339u,45341u,1418u},
+{45342u,45346u,10308u},{45347u,45349u,1421u},{45350u,45351u,10313u},{45352u,45352u,1424u},
+{45353u,45355u,10315u},{45356u,45356u,1425u},{45357u,45363u,10318u},{45364u,45365u,1426u},
+{45366u,45366u,10325u},{45367u,45369u,1428u},{45370u,45375u,10326u},{45376u,45377u,1431u},
+{45378u,45379u,10332u},{45380u,45380u,1433u},{45381u,45383u,10334u},{45384u,45384u,1434u},
+{45385u,45391u,10337u},{45392u,45393u,1435u},{45394u,45395u,10344u},{45396u,45397u,1437u},
+{45398u,45399u,10346u},{45400u,45400u,1439u},{45401u,45403u,10348u},{45404u,45404u,1440u},
+{45405u,45407u,10351u},{45408u,45408u,1441u},{45409u,45431u,10354u},{45432u,45433u,1442u},
+{45434u,45435u,10377u},{45436u,45436u,1444u},{45437u,45439u,10379u},{45440u,45440u,1445u},
+{45441u,45441u,10382u},{45442u,45442u,1446u},{45443u,45447u,10383u},{45448u,45449u,1447u},
+{45450u,45450u,10388u},{45451u,45451u,1449u},{45452u,45452u,10389u},{45453u,45453u,1450u},
+{45454u,45457u,10390u},{45458u,45460u,1451u},{45461u,45463u,10394u},{45464u,45464u,1454u},
+{45465u,45467u,10397u},{45468u,45468u,1455u},{45469u,45479u,10400u},{45480u,45480u,1456u},
+{45481u,45515u,10411u},{45516u,45516u,1457u},{45517u,45519u,10446u},{45520u,45520u,1458u},
+{45521u,45523u,10449u},{45524u,45524u,1459u},{45525u,45531u,10452u},{45532u,45533u,1460u},
+{45534u,45534u,10459u},{45535u,45535u,1462u},{45536u,45543u,10460u},{45544u,45545u,1463u},
+{45546u,45547u,10468u},{45548u,45548u,1465u},{45549u,45551u,10470u},{45552u,45552u,1466u},
+{45553u,45560u,10473u},{45561u,45561u,1467u},{45562u,45562u,10481u},{45563u,45563u,1468u},
+{45564u,45564u,10482u},{45565u,45565u,1469u},{45566u,45571u,10483u},{45572u,45573u,1470u},
+{45574u,45575u,10489u},{45576u,45576u,1472u},{45577u,45578u,10491u},{45579u,45580u,1473u},
+{45581u,45587u,10493u},{45588u,45589u,1475u},{45590u,45590u,10500u},{45591u,45591u,1477u},
+{45592u,45592u,10501u},{45593u,45593u,1478u},{45594u,45599u,10502u},{45600u,45600u,1479u},
+{45601u,45619u,10508u},{45620u,45620u,1480u},{45621u,45627u,10527u},{45628u,45628u,1481u},
+{45629u,45655u,10534u},{45656u,45656u,1482u},{45657u,45659u,10561u},{45660u,45660u,1483u},
+{45661u,45663u,10564u},{45664u,45664u,1484u},{45665u,45671u,10567u},{45672u,45673u,1485u},
+{45674u,45683u,10574u},{45684u,45685u,1487u},{45686u,45691u,10584u},{45692u,45692u,1489u},
+{45693u,45699u,10590u},{45700u,45701u,1490u},{45702u,45704u,10597u},{45705u,45705u,1492u},
+{45706u,45711u,10600u},{45712u,45713u,1493u},{45714u,45715u,10606u},{45716u,45716u,1495u},
+{45717u,45719u,10608u},{45720u,45722u,1496u},{45723u,45727u,10611u},{45728u,45729u,1499u},
+{45730u,45730u,10616u},{45731u,45731u,1501u},{45732u,45732u,10617u},{45733u,45734u,1502u},
+{45735u,45737u,10618u},{45738u,45738u,1504u},{45739u,45739u,10621u},{45740u,45740u,1505u},
+{45741u,45743u,10622u},{45744u,45744u,1506u},{45745u,45747u,10625u},{45748u,45748u,1507u},
+{45749u,45767u,10628u},{45768u,45769u,1508u},{45770u,45771u,10647u},{45772u,45772u,1510u},
+{45773u,45775u,10649u},{45776u,45776u,1511u},{45777u,45777u,10652u},{45778u,45778u,1512u},
+{45779u,45783u,10653u},{45784u,45785u,1513u},{45786u,45786u,10658u},{45787u,45787u,1515u},
+{45788u,45788u,10659u},{45789u,45789u,1516u},{45790u,45793u,10660u},{45794u,45794u,1517u},
+{45795u,45795u,10664u},{45796u,45798u,1518u},{45799u,45799u,10665u},{45800u,45800u,1521u},
+{45801u,45802u,10666u},{45803u,45807u,1522u},{45808u,45810u,10668u},{45811u,45813u,1527u},
+{45814u,45814u,10671u},{45815u,45819u,1530u},{45820u,45822u,10672u},{45823u,45825u,1535u},
+{45826u,45827u,10675u},{45828u,45828u,1538u},{45829u,45831u,10677u},{45832u,45832u,1539u},
+{45833u,45839u,10680u},{45840u,45841u,1540u},{45842u,45842u,10687u},{45843u,45845u,1542u},
+{45846u,45851u,10688u},{45852u,45852u,1545u},{45853u,45907u,10694u},{45908u,45910u,1546u},
+{45911u,45911u,10749u},{45912u,45912u,1549u},{45913u,45914u,10750u},{45915u,45916u,1550u},
+{45917u,45917u,10752u},{45918u,45919u,1552u},{45920u,45923u,10753u},{45924u,45925u,1554u},
+{45926u,45926u,10757u},{45927u,45927u,1556u},{45928u,45928u,10758u},{45929u,45929u,1557u},
+{45930u,45930u,10759u},{45931u,45931u,1558u},{45932u,45933u,10760u},{45934u,45934u,1559u},
+{45935u,45935u,10762u},{45936u,45937u,1560u},{45938u,45939u,10763u},{45940u,45940u,1562u},
+{45941u,45943u,10765u},{45944u,45944u,1563u},{45945u,45951u,10768u},{45952u,45953u,1564u},
+{45954u,45954u,10775u},{45955u,45957u,1566u},{45958u,45963u,10776u},{45964u,45964u,1569u},
+{45965u,45967u,10782u},{45968u,45968u,1570u},{45969u,45971u,10785u},{45972u,45972u,1571u},
+{45973u,45983u,10788u},{45984u,45985u,1572u},{45986u,45991u,10799u},{45992u,45992u,1574u},
+{45993u,45995u,10805u},{45996u,45996u,1575u},{45997u,46019u,10808u},{46020u,46021u,1576u},
+{46022u,46023u,10831u},{46024u,46024u,1578u},{46025u,46026u,10833u},{46027u,46028u,1579u},
+{46029u,46029u,10835u},{46030u,46030u,1581u},{46031u,46031u,10836u},{46032u,46032u,1582u},
+{46033u,46035u,10837u},{46036u,46037u,1583u},{46038u,46038u,10840u},{46039u,46039u,1585u},
+{46040u,46040u,10841u},{46041u,46041u,1586u},{46042u,46042u,10842u},{46043u,46043u,1587u},
+{46044u,46044u,10843u},{46045u,46045u,1588u},{46046u,46047u,10844u},{46048u,46048u,1589u},
+{46049u,46051u,10846u},{46052u,46052u,1590u},{46053u,46055u,10849u},{46056u,46056u,1591u},
+{46057u,46075u,10852u},{46076u,46076u,1592u},{46077u,46095u,10871u},{46096u,46096u,1593u},
+{46097u,46103u,10890u},{46104u,46104u,1594u},{46105u,46107u,10897u},{46108u,46108u,1595u},
+{46109u,46111u,10900u},{46112u,46112u,1596u},{46113u,46119u,10903u},{46120u,46121u,1597u},
+{46122u,46122u,10910u},{46123u,46123u,1599u},{46124u,46131u,10911u},{46132u,46132u,1600u},
+{46133u,46159u,10919u},{46160u,46161u,1601u},{46162u,46163u,10946u},{46164u,46164u,1603u},
+{46165u,46167u,10948u},{46168u,46168u,1604u},{46169u,46175u,10951u},{46176u,46177u,1605u},
+{46178u,46178u,10958u},{46179u,46179u,1607u},{46180u,46180u,10959u},{46181u,46181u,1608u},
+{46182u,46187u,10960u},{46188u,46188u,1609u},{46189u,46207u,10966u},{46208u,46208u,1610u},
+{46209u,46215u,10985u},{46216u,46216u,1611u},{46217u,46236u,10992u},{46237u,46237u,1612u},
+{46238u,46243u,11012u},{46244u,46244u,1613u},{46245u,46247u,11018u},{46248u,46248u,1614u},
+{46249u,46251u,11021u},{46252u,46252u,1615u},{46253u,46260u,11024u},{46261u,46261u,1616u},
+{46262u,46262u,11032u},{46263u,46263u,1617u},{46264u,46264u,11033u},{46265u,46265u,1618u},
+{46266u,46271u,11034u},{46272u,46272u,1619u},{46273u,46275u,11040u},{46276u,46276u,1620u},
+{46277u,46279u,11043u},{46280u,46280u,1621u},{46281u,46287u,11046u},{46288u,46288u,1622u},
+{46289u,46292u,11053u},{46293u,46293u,1623u},{46294u,46299u,11057u},{46300u,46301u,1624u},
+{46302u,46303u,11063u},{46304u,46304u,1626u},{46305u,46306u,11065u},{46307u,46308u,1627u},
+{46309u,46309u,11067u},{46310u,46310u,1629u},{46311u,46315u,11068u},{46316u,46317u,1630u},
+{46318u,46318u,11073u},{46319u,46319u,1632u},{46320u,46320u,11074u},{46321u,46321u,1633u},
+{46322u,46327u,11075u},{46328u,46328u,1634u},{46329u,46355u,11081u},{46356u,46357u,1635u},
+{46358u,46359u,11108u},{46360u,46360u,1637u},{46361u,46362u,11110u},{46363u,46364u,1638u},
+{46365u,46371u,11112u},{46372u,46373u,1640u},{46374u,46374u,11119u},{46375u,46378u,1642u},
+{46379u,46383u,11120u},{46384u,46385u,1646u},{46386u,46387u,11125u},{46388u,46388u,1648u},
+{46389u,46391u,11127u},{46392u,46392u,1649u},{46393u,46399u,11130u},{46400u,46401u,1650u},
+{46402u,46402u,11137u},{46403u,46405u,1652u},{46406u,46410u,11138u},{46411u,46413u,1655u},
+{46414u,46415u,11143u},{46416u,46416u,1658u},{46417u,46419u,11145u},{46420u,46420u,1659u},
+{46421u,46427u,11148u},{46428u,46429u,1660u},{46430u,46430u,11155u},{46431u,46433u,1662u},
+{46434u,46495u,11156u},{46496u,46497u,1665u},{46498u,46499u,11218u},{46500u,46500u,1667u},
+{46501u,46503u,11220u},{46504u,46504u,1668u},{46505u,46505u,11223u},{46506u,46507u,1669u},
+{46508u,46511u,11224u},{46512u,46513u,1671u},{46514u,46514u,11228u},{46515u,46517u,1673u},
+{46518u,46522u,11229u},{46523u,46525u,1676u},{46526u,46527u,11234u},{46528u,46528u,1679u},
+{46529u,46531u,11236u},{46532u,46532u,1680u},{46533u,46539u,11239u},{46540u,46541u,1681u},
+{46542u,46542u,11246u},{46543u,46545u,1683u},{46546u,46551u,11247u},{46552u,46552u,1686u},
+{46553u,46571u,11253u},{46572u,46572u,1687u},{46573u,46607u,11272u},{46608u,46609u,1688u},
+{46610u,46611u,11307u},{46612u,46612u,1690u},{46613u,46615u,11309u},{46616u,46616u,1691u},
+{46617u,46628u,11312u},{46629u,46629u,1692u},{46630u,46635u,11324u},{46636u,46636u,1693u},
+{46637u,46643u,11330u},{46644u,46644u,1694u},{46645u,46663u,11337u},{46664u,46664u,1695u},
+{46665u,46691u,11356u},{46692u,46692u,1696u},{46693u,46695u,11383u},{46696u,46696u,1697u},
+{46697u,46747u,11386u},{46748u,46749u,1698u},{46750u,46751u,11437u},{46752u,46752u,1700u},
+{46753u,46755u,11439u},{46756u,46756u,1701u},{46757u,46762u,11442u},{46763u,46764u,1702u},
+{46765u,46768u,11448u},{46769u,46769u,1704u},{46770u,46803u,11452u},{46804u,46804u,1705u},
+{46805u,46831u,11486u},{46832u,46832u,1706u},{46833u,46835u,11513u},{46836u,46836u,1707u},
+{46837u,46839u,11516u},{46840u,46840u,1708u},{46841u,46847u,11519u},{46848u,46849u,1709u},
+{46850u,46852u,11526u},{46853u,46853u,1711u},{46854u,46887u,11529u},{46888u,46889u,1712u},
+{46890u,46891u,11563u},{46892u,46892u,1714u},{46893u,46894u,11565u},{46895u,46896u,1715u},
+{46897u,46903u,11567u},{46904u,46905u,1717u},{46906u,46906u,11574u},{46907u,46907u,1719u},
+{46908u,46915u,11575u},{46916u,46916u,1720u},{46917u,46919u,11583u},{46920u,46920u,1721u},
+{46921u,46923u,11586u},{46924u,46924u,1722u},{46925u,46931u,11589u},{46932u,46933u,1723u},
+{46934u,46943u,11596u},{46944u,46944u,1725u},{46945u,46947u,11606u},{46948u,46948u,1726u},
+{46949u,46951u,11609u},{46952u,46952u,1727u},{46953u,46959u,11612u},{46960u,46961u,1728u},
+{46962u,46962u,11619u},{46963u,46963u,1730u},{46964u,46964u,11620u},{46965u,46965u,1731u},
+{46966u,46971u,11621u},{46972u,46973u,1732u},{46974u,46975u,11627u},{46976u,46976u,1734u},
+{46977u,46979u,11629u},{46980u,46980u,1735u},{46981u,46987u,11632u},{46988u,46989u,1736u},
+{46990u,46990u,11639u},{46991u,46994u,1738u},{46995u,46997u,11640u},{46998u,47001u,1742u},
+{47002u,47003u,11643u},{47004u,47004u,1746u},{47005u,47007u,11645u},{47008u,47008u,1747u},
+{47009u,47015u,11648u},{47016u,47017u,1748u},{47018u,47018u,11655u},{47019u,47021u,1750u},
+{47022u,47027u,11656u},{47028u,47029u,1753u},{47030u,47031u,11662u},{47032u,47032u,1755u},
+{47033u,47046u,11664u},{47047u,47047u,1756u},{47048u,47048u,11678u},{47049u,47049u,1757u},
+{47050u,47083u,11679u},{47084u,47085u,1758u},{47086u,47087u,11713u},{47088u,47088u,1760u},
+{47089u,47091u,11715u},{47092u,47092u,1761u},{47093u,47099u,11718u},{47100u,47101u,1762u},
+{47102u,47102u,11725u},{47103u,47105u,1764u},{47106u,47110u,11726u},{47111u,47113u,1767u},
+{47114u,47115u,11731u},{47116u,47116u,1770u},{47117u,47119u,11733u},{47120u,47120u,1771u},
+{47121u,47127u,11736u},{47128u,47129u,1772u},{47130u,47130u,11743u},{47131u,47131u,1774u},
+{47132u,47132u,11744u},{47133u,47133u,1775u},{47134u,47139u,11745u},{47140u,47141u,1776u},
+{47142u,47143u,11751u},{47144u,47144u,1778u},{47145u,47147u,11753u},{47148u,47148u,1779u},
+{47149u,47155u,11756u},{47156u,47157u,1780u},{47158u,47158u,11763u},{47159u,47161u,1782u},
+{47162u,47167u,11764u},{47168u,47168u,1785u},{47169u,47171u,11770u},{47172u,47172u,1786u},
+{47173u,47184u,11773u},{47185u,47185u,1787u},{47186u,47186u,11785u},{47187u,47187u,1788u},
+{47188u,47195u,11786u},{47196u,47197u,1789u},{47198u,47199u,11794u},{47200u,47200u,1791u},
+{47201u,47203u,11796u},{47204u,47204u,1792u},{47205u,47211u,11799u},{47212u,47213u,1793u},
+{47214u,47214u,11806u},{47215u,47215u,1795u},{47216u,47216u,11807u},{47217u,47217u,1796u},
+{47218u,47223u,11808u},{47224u,47224u,1797u},{47225u,47227u,11814u},{47228u,47228u,1798u},
+{47229u,47244u,11817u},{47245u,47245u,1799u},{47246u,47271u,11833u},{47272u,47272u,1800u},
+{47273u,47279u,11859u},{47280u,47280u,1801u},{47281u,47283u,11866u},{47284u,47284u,1802u},
+{47285u,47287u,11869u},{47288u,47288u,1803u},{47289u,47295u,11872u},{47296u,47297u,1804u},
+{47298u,47298u,11879u},{47299u,47299u,1806u},{47300u,47300u,11880u},{47301u,47301u,1807u},
+{47302u,47307u,11881u},{47308u,47308u,1808u},{47309u,47311u,11887u},{47312u,47312u,1809u},
+{47313u,47315u,11890u},{47316u,47316u,1810u},{47317u,47324u,11893u},{47325u,47325u,1811u},
+{47326u,47326u,11901u},{47327u,47327u,1812u},{47328u,47328u,11902u},{47329u,47329u,1813u},
+{47330u,47335u,11903u},{47336u,47337u,1814u},{47338u,47339u,11909u},{47340u,47340u,1816u},
+{47341u,47343u,11911u},{47344u,47344u,1817u},{47345u,47351u,11914u},{47352u,47353u,1818u},
+{47354u,47354u,11921u},{47355u,47355u,1820u},{47356u,47356u,11922u},{47357u,47357u,1821u},
+{47358u,47363u,11923u},{47364u,47364u,1822u},{47365u,47383u,11929u},{47384u,47384u,1823u},
+{47385u,47391u,11948u},{47392u,47392u,1824u},{47393u,47419u,11955u},{47420u,47421u,1825u},
+{47422u,47423u,11982u},{47424u,47424u,1827u},{47425u,47427u,11984u},{47428u,47428u,1828u},
+{47429u,47435u,11987u},{47436u,47436u,1829u},{47437u,47438u,11994u},{47439u,47439u,1830u},
+{47440u,47440u,11996u},{47441u,47441u,1831u},{47442u,47447u,11997u},{47448u,47449u,1832u},
+{47450u,47451u,12003u},{47452u,47452u,1834u},{47453u,47455u,12005u},{47456u,47456u,1835u},
+{47457u,47463u,12008u},{47464u,47465u,1836u},{47466u,47466u,12015u},{47467u,47467u,1838u},
+{47468u,47468u,12016u},{47469u,47469u,1839u},{47470u,47475u,12017u},{47476u,47477u,1840u},
+{47478u,47479u,12023u},{47480u,47480u,1842u},{47481u,47483u,12025u},{47484u,47484u,1843u},
+{47485u,47491u,12028u},{47492u,47493u,1844u},{47494u,47494u,12035u},{47495u,47495u,1846u},
+{47496u,47496u,12036u},{47497u,47498u,1847u},{47499u,47500u,12037u},{47501u,47502u,1849u},
+{47503u,47531u,12039u},{47532u,47533u,1851u},{47534u,47535u,12068u},{47536u,47536u,1853u},
+{47537u,47539u,12070u},{47540u,47540u,1854u},{47541u,47547u,12073u},{47548u,47549u,1855u},
+{47550u,47550u,12080u},{47551u,47551u,1857u},{47552u,47552u,12081u},{47553u,47553u,1858u},
+{47554u,47559u,12082u},{47560u,47561u,1859u},{47562u,47563u,12088u},{47564u,47564u,1861u},
+{47565u,47565u,12090u},{47566u,47570u,1862u},{47571u,47575u,12091u},{47576u,47577u,1867u},
+{47578u,47578u,12096u},{47579u,47579u,1869u},{47580u,47580u,12097u},{47581u,47582u,1870u},
+{47583u,47584u,12098u},{47585u,47585u,1872u},{47586u,47586u,12100u},{47587u,47589u,1873u},
+{47590u,47591u,12101u},{47592u,47592u,1876u},{47593u,47595u,12103u},{47596u,47596u,1877u},
+{47597u,47603u,12106u},{47604u,47605u,1878u},{47606u,47606u,12113u},{47607u,47610u,1880u},
+{47611u,47615u,12114u},{47616u,47617u,1884u},{47618u,47623u,12119u},{47624u,47624u,1886u},
+{47625u,47636u,12125u},{47637u,47637u,1887u},{47638u,47671u,12137u},{47672u,47673u,1888u},
+{47674u,47675u,12171u},{47676u,47676u,1890u},{47677u,47679u,12173u},{47680u,47680u,1891u},
+{47681u,47681u,12176u},{47682u,47682u,1892u},{47683u,47687u,12177u},{47688u,47689u,1893u},
+{47690u,47690u,12182u},{47691u,47691u,1895u},{47692u,47692u,12183u},{47693u,47694u,1896u},
+{47695u,47698u,12184u},{47699u,47701u,1898u},{47702u,47703u,12188u},{47704u,47704u,1901u},
+{47705u,47707u,12190u},{47708u,47708u,1902u},{47709u,47715u,12193u},{47716u,47717u,1903u},
+{47718u,47718u,12200u},{47719u,47721u,1905u},{47722u,47727u,12201u},{47728u,47729u,1908u},
+{47730u,47731u,12207u},{47732u,47732u,1910u},{47733u,47735u,12209u},{47736u,47736u,1911u},
+{47737u,47746u,12212u},{47747u,47749u,1912u},{47750u,47750u,12222u},{47751u,47751u,1915u},
+{47752u,47755u,12223u},{47756u,47756u,1916u},{47757u,47783u,12227u},{47784u,47785u,1917u},
+{47786u,47786u,12254u},{47787u,47788u,1919u},{47789u,47791u,12255u},{47792u,47792u,1921u},
+{47793u,47793u,12258u},{47794u,47794u,1922u},{47795u,47799u,12259u},{47800u,47801u,1923u},
+{47802u,47802u,12264u},{47803u,47803u,1925u},{47804u,47804u,12265u},{47805u,47805u,1926u},
+{47806u,47811u,12266u},{47812u,47812u,1927u},{47813u,47815u,12272u},{47816u,47816u,1928u},
+{47817u,47831u,12275u},{47832u,47833u,1929u},{47834u,47867u,12290u},{47868u,47868u,1931u},
+{47869u,47871u,12324u},{47872u,47872u,1932u},{47873u,47875u,12327u},{47876u,47876u,1933u},
+{47877u,47884u,12330u},{47885u,47885u,1934u},{47886u,47886u,12338u},{47887u,47887u,1935u},
+{47888u,47888u,12339u},{47889u,47889u,1936u},{47890u,47895u,12340u},{47896u,47896u,1937u},
+{47897u,47899u,12346u},{47900u,47900u,1938u},{47901u,47903u,12349u},{47904u,47904u,1939u},
+{47905u,47912u,12352u},{47913u,47913u,1940u},{47914u,47914u,12360u},{47915u,47915u,1941u},
+{47916u,47923u,12361u},{47924u,47926u,1942u},{47927u,47927u,12369u},{47928u,47928u,1945u},
+{47929u,47930u,12370u},{47931u,47934u,1946u},{47935u,47939u,12372u},{47940u,47941u,1950u},
+{47942u,47942u,12377u},{47943u,47943u,1952u},{47944u,47944u,12378u},{47945u,47945u,1953u},
+{47946u,47948u,12379u},{47949u,47949u,1954u},{47950u,47950u,12382u},{47951u,47952u,1955u},
+{47953u,47955u,12383u},{47956u,47956u,1957u},{47957u,47959u,12386u},{47960u,47960u,1958u},
+{47961u,47968u,12389u},{47969u,47969u,1959u},{47970u,47970u,12397u},{47971u,47971u,1960u},
+{47972u,47979u,12398u},{47980u,47980u,1961u},{47981u,48007u,12406u},{48008u,48008u,1962u},
+{48009u,48011u,12433u},{48012u,48012u,1963u},{48013u,48015u,12436u},{48016u,48016u,1964u},
+{48017u,48035u,12439u},{48036u,48036u,1965u},{48037u,48039u,12458u},{48040u,48040u,1966u},
+{48041u,48043u,12461u},{48044u,48044u,1967u},{48045u,48051u,12464u},{48052u,48052u,1968u},
+{48053u,48054u,12471u},{48055u,48055u,1969u},{48056u,48063u,12473u},{48064u,48064u,1970u},
+{48065u,48067u,12481u},{48068u,48068u,1971u},{48069u,48071u,12484u},{48072u,48072u,1972u},
+{48073u,48079u,12487u},{48080u,48080u,1973u},{48081u,48082u,12494u},{48083u,48083u,1974u},
+{48084u,48119u,12496u},{48120u,48121u,1975u},{48122u,48123u,12532u},{48124u,48124u,1977u},
+{48125u,48126u,12534u},{48127u,48128u,1978u},{48129u,48129u,12536u},{48130u,48130u,1980u},
+{48131u,48135u,12537u},{48136u,48137u,1981u},{48138u,48138u,12542u},{48139u,48141u,1983u},
+{48142u,48142u,12543u},{48143u,48143u,1986u},{48144u,48144u,12544u},{48145u,48145u,1987u},
+{48146u,48147u,12545u},{48148u,48152u,1988u},{48153u,48154u,12547u},{48155u,48159u,1993u},
+{48160u,48163u,12549u},{48164u,48165u,1998u},{48166u,48166u,12553u},{48167u,48167u,2000u},
+{48168u,48168u,12554u},{48169u,48169u,2001u},{48170u,48172u,12555u},{48173u,48173u,2002u},
+{48174u,48175u,12558u},{48176u,48177u,2003u},{48178u,48179u,12560u},{48180u,48180u,2005u},
+{48181u,48183u,12562u},{48184u,48184u,2006u},{48185u,48191u,12565u},{48192u,48193u,2007u},
+{48194u,48194u,12572u},{48195u,48197u,2009u},{48198u,48200u,12573u},{48201u,48201u,2012u},
+{48202u,48203u,12576u},{48204u,48205u,2013u},{48206u,48207u,12578u},{48208u,48208u,2015u},
+{48209u,48220u,12580u},{48221u,48221u,2016u},{48222u,48259u,12592u},{48260u,48261u,2017u},
+{48262u,48263u,12630u},{48264u,48264u,2019u},{48265u,48266u,12632u},{48267u,48268u,2020u},
+{48269u,48269u,12634u},{48270u,48270u,2022u},{48271u,48275u,12635u},{48276u,48277u,2023u},
+{48278u,48278u,12640u},{48279u,48279u,2025u},{48280u,48280u,12641u},{48281u,48282u,2026u},
+{48283u,48287u,12642u},{48288u,48289u,2028u},{48290u,48291u,12647u},{48292u,48292u,2030u},
+{48293u,48294u,12649u},{48295u,48296u,2031u},{48297u,48303u,12651u},{48304u,48305u,2033u},
+{48306u,48306u,12658u},{48307u,48309u,2035u},{48310u,48315u,12659u},{48316u,48317u,2038u},
+{48318u,48319u,12665u},{48320u,48320u,2040u},{48321u,48323u,12667u},{48324u,48324u,2041u},
+{48325u,48332u,12670u},{48333u,48333u,2042u},{48334u,48334u,12678u},{48335u,48337u,2043u},
+{48338u,48340u,12679u},{48341u,48341u,2046u},{48342u,48343u,12682u},{48344u,48344u,2047u},
+{48345u,48347u,12684u},{48348u,48348u,2048u},{48349u,48371u,12687u},{48372u,48374u,2049u},
+{48375u,48375u,12710u},{48376u,48376u,2052u},{48377u,48379u,12711u},{48380u,48380u,2053u},
+{48381u,48387u,12714u},{48388u,48389u,2054u},{48390u,48390u,12721u},{48391u,48391u,2056u},
+{48392u,48392u,12722u},{48393u,48393u,2057u},{48394u,48399u,12723u},{48400u,48400u,2058u},
+{48401u,48403u,12729u},{48404u,48404u,2059u},{48405u,48419u,12732u},{48420u,48420u,2060u},
+{48421u,48427u,12747u},{48428u,48428u,2061u},{48429u,48447u,12754u},{48448u,48448u,2062u},
+{48449u,48455u,12773u},{48456u,48457u,2063u},{48458u,48459u,12780u},{48460u,48460u,2065u},
+{48461u,48463u,12782u},{48464u,48464u,2066u},{48465u,48471u,12785u},{48472u,48473u,2067u},
+{48474u,48483u,12792u},{48484u,48484u,2069u},{48485u,48487u,12802u},{48488u,48488u,2070u},
+{48489u,48511u,12805u},{48512u,48513u,2071u},{48514u,48515u,12828u},{48516u,48516u,2073u},
+{48517u,48518u,12830u},{48519u,48522u,2074u},{48523u,48527u,12832u},{48528u,48529u,2078u},
+{48530u,48530u,12837u},{48531u,48531u,2080u},{48532u,48532u,12838u},{48533u,48533u,2081u},
+{48534u,48536u,12839u},{48537u,48538u,2082u},{48539u,48539u,12842u},{48540u,48540u,2084u},
+{48541u,48547u,12843u},{48548u,48548u,2085u},{48549u,48559u,12850u},{48560u,48560u,2086u},
+{48561u,48567u,12861u},{48568u,48568u,2087u},{48569u,48595u,12868u},{48596u,48597u,2088u},
+{48598u,48599u,12895u},{48600u,48600u,2090u},{48601u,48603u,12897u},{48604u,48604u,2091u},
+{48605u,48616u,12900u},{48617u,48617u,2092u},{48618u,48623u,12912u},{48624u,48624u,2093u},
+{48625u,48627u,12918u},{48628u,48628u,2094u},{48629u,48631u,12921u},{48632u,48632u,2095u},
+{48633u,48639u,12924u},{48640u,48640u,2096u},{48641u,48642u,12931u},{48643u,48643u,2097u},
+{48644u,48644u,12933u},{48645u,48645u,2098u},{48646u,48651u,12934u},{48652u,48653u,2099u},
+{48654u,48655u,12940u},{48656u,48656u,2101u},{48657u,48659u,12942u},{48660u,48660u,2102u},
+{48661u,48667u,12945u},{48668u,48669u,2103u},{48670u,48670u,12952u},{48671u,48671u,2105u},
+{48672u,48707u,12953u},{48708u,48709u,2106u},{48710u,48711u,12989u},{48712u,48712u,2108u},
+{48713u,48715u,12991u},{48716u,48716u,2109u},{48717u,48717u,12994u},{48718u,48718u,2110u},
+{48719u,48723u,12995u},{48724u,48725u,2111u},{48726u,48726u,13000u},{48727u,48727u,2113u},
+{48728u,48728u,13001u},{48729u,48731u,2114u},{48732u,48735u,13002u},{48736u,48737u,2117u},
+{48738u,48739u,13006u},{48740u,48740u,2119u},{48741u,48743u,13008u},{48744u,48744u,2120u},
+{48745u,48745u,13011u},{48746u,48746u,2121u},{48747u,48751u,13012u},{48752u,48753u,2122u},
+{48754u,48754u,13017u},{48755u,48757u,2124u},{48758u,48762u,13018u},{48763u,48765u,2127u},
+{48766u,48767u,13023u},{48768u,48768u,2130u},{48769u,48771u,13025u},{48772u,48772u,2131u},
+{48773u,48779u,13028u},{48780u,48781u,2132u},{48782u,48782u,13035u},{48783u,48785u,2134u},
+{48786u,48791u,13036u},{48792u,48793u,2137u},{48794u,48807u,13042u},{48808u,48808u,2139u},
+{48809u,48847u,13056u},{48848u,48849u,2140u},{48850u,48851u,13095u},{48852u,48852u,2142u},
+{48853u,48854u,13097u},{48855u,48856u,2143u},{48857u,48863u,13099u},{48864u,48864u,2145u},
+{48865u,48866u,13106u},{48867u,48869u,2146u},{48870u,48875u,13108u},{48876u,48876u,2149u},
+{48877u,48896u,13114u},{48897u,48897u,2150u},{48898u,48903u,13134u},{48904u,48905u,2151u},
+{48906u,48919u,13140u},{48920u,48921u,2153u},{48922u,48922u,13154u},{48923u,48925u,2155u},
+{48926u,48959u,13155u},{48960u,48961u,2158u},{48962u,48963u,13189u},{48964u,48964u,2160u},
+{48965u,48967u,13191u},{48968u,48968u,2161u},{48969u,48975u,13194u},{48976u,48977u,2162u},
+{48978u,48980u,13201u},{48981u,48981u,2164u},{48982u,49043u,13204u},{49044u,49044u,2165u},
+{49045u,49071u,13266u},{49072u,49072u,2166u},{49073u,49092u,13293u},{49093u,49093u,2167u},
+{49094u,49099u,13313u},{49100u,49101u,2168u},{49102u,49103u,13319u},{49104u,49104u,2170u},
+{49105u,49107u,13321u},{49108u,49108u,2171u},{49109u,49115u,13324u},{49116u,49116u,2172u},
+{49117u,49118u,13331u},{49119u,49119u,2173u},{49120u,49120u,13333u},{49121u,49121u,2174u},
+{49122u,49211u,13334u},{49212u,49212u,2175u},{49213u,49232u,13424u},{49233u,49233u,2176u},
+{49234u,49239u,13444u},{49240u,49240u,2177u},{49241u,49243u,13450u},{49244u,49244u,2178u},
+{49245u,49247u,13453u},{49248u,49248u,2179u},{49249u,49255u,13456u},{49256u,49257u,2180u},
+{49258u,49295u,13463u},{49296u,49297u,2182u},{49298u,49299u,13501u},{49300u,49300u,2184u},
+{49301u,49303u,13503u},{49304u,49304u,2185u},{49305u,49311u,13506u},{49312u,49313u,2186u},
+{49314u,49314u,13513u},{49315u,49315u,2188u},{49316u,49316u,13514u},{49317u,49317u,2189u},
+{49318u,49323u,13515u},{49324u,49325u,2190u},{49326u,49326u,13521u},{49327u,49328u,2192u},
+{49329u,49330u,13522u},{49331u,49334u,2194u},{49335u,49339u,13524u},{49340u,49341u,2198u},
+{49342u,49342u,13529u},{49343u,49345u,2200u},{49346u,49348u,13530u},{49349u,49349u,2203u},
+{49350u,49351u,13533u},{49352u,49353u,2204u},{49354u,49355u,13535u},{49356u,49356u,2206u},
+{49357u,49359u,13537u},{49360u,49360u,2207u},{49361u,49367u,13540u},{49368u,49369u,2208u},
+{49370u,49370u,13547u},{49371u,49373u,2210u},{49374u,49379u,13548u},{49380u,49381u,2213u},
+{49382u,49383u,13554u},{49384u,49384u,2215u},{49385u,49387u,13556u},{49388u,49388u,2216u},
+{49389u,49395u,13559u},{49396u,49397u,2217u},{49398u,49398u,13566u},{49399u,49399u,2219u},
+{49400u,49400u,13567u},{49401u,49401u,2220u},{49402u,49407u,13568u},{49408u,49408u,2221u},
+{49409u,49411u,13574u},{49412u,49412u,2222u},{49413u,49415u,13577u},{49416u,49416u,2223u},
+{49417u,49423u,13580u},{49424u,49424u,2224u},{49425u,49428u,13587u},{49429u,49429u,2225u},
+{49430u,49435u,13591u},{49436u,49440u,2226u},{49441u,49442u,13597u},{49443u,49444u,2231u},
+{49445u,49445u,13599u},{49446u,49447u,2233u},{49448u,49451u,13600u},{49452u,49453u,2235u},
+{49454u,49454u,13604u},{49455u,49457u,2237u},{49458u,49461u,13605u},{49462u,49462u,2240u},
+{49463u,49463u,13609u},{49464u,49465u,2241u},{49466u,49467u,13610u},{49468u,49468u,2243u},
+{49469u,49471u,13612u},{49472u,49472u,2244u},{49473u,49479u,13615u},{49480u,49481u,2245u},
+{49482u,49482u,13622u},{49483u,49485u,2247u},{49486u,49491u,13623u},{49492u,49493u,2250u},
+{49494u,49495u,13629u},{49496u,49496u,2252u},{49497u,49499u,13631u},{49500u,49500u,2253u},
+{49501u,49507u,13634u},{49508u,49509u,2254u},{49510u,49510u,13641u},{49511u,49513u,2256u},
+{49514u,49519u,13642u},{49520u,49520u,2259u},{49521u,49523u,13648u},{49524u,49524u,2260u},
+{49525u,49527u,13651u},{49528u,49528u,2261u},{49529u,49540u,13654u},{49541u,49541u,2262u},
+{49542u,49547u,13666u},{49548u,49550u,2263u},{49551u,49551u,13672u},{49552u,49552u,2266u},
+{49553u,49555u,13673u},{49556u,49556u,2267u},{49557u,49557u,13676u},{49558u,49558u,2268u},
+{49559u,49563u,13677u},{49564u,49565u,2269u},{49566u,49566u,13682u},{49567u,49567u,2271u},
+{49568u,49568u,13683u},{49569u,49569u,2272u},{49570u,49572u,13684u},{49573u,49573u,2273u},
+{49574u,49575u,13687u},{49576u,49577u,2274u},{49578u,49579u,13689u},{49580u,49580u,2276u},
+{49581u,49583u,13691u},{49584u,49584u,2277u},{49585u,49596u,13694u},{49597u,49597u,2278u},
+{49598u,49603u,13706u},{49604u,49604u,2279u},{49605u,49607u,13712u},{49608u,49608u,2280u},
+{49609u,49611u,13715u},{49612u,49612u,2281u},{49613u,49619u,13718u},{49620u,49620u,2282u},
+{49621u,49622u,13725u},{49623u,49624u,2283u},{49625u,49631u,13727u},{49632u,49632u,2285u},
+{49633u,49635u,13734u},{49636u,49636u,2286u},{49637u,49639u,13737u},{49640u,49640u,2287u},
+{49641u,49647u,13740u},{49648u,49649u,2288u},{49650u,49650u,13747u},{49651u,49651u,2290u},
+{49652u,49659u,13748u},{49660u,49661u,2291u},{49662u,49663u,13756u},{49664u,49664u,2293u},
+{49665u,49667u,13758u},{49668u,49668u,2294u},{49669u,49675u,13761u},{49676u,49677u,2295u},
+{49678u,49678u,13768u},{49679u,49679u,2297u},{49680u,49680u,13769u},{49681u,49681u,2298u},
+{49682u,49687u,13770u},{49688u,49689u,2299u},{49690u,49691u,13776u},{49692u,49692u,2301u},
+{49693u,49694u,13778u},{49695u,49696u,2302u},{49697u,49703u,13780u},{49704u,49705u,2304u},
+{49706u,49706u,13787u},{49707u,49707u,2306u},{49708u,49708u,13788u},{49709u,49709u,2307u},
+{49710u,49710u,13789u},{49711u,49711u,2308u},{49712u,49712u,13790u},{49713u,49714u,2309u},
+{49715u,49715u,13791u},{49716u,49716u,2311u},{49717u,49735u,13792u},{49736u,49736u,2312u},
+{49737u,49743u,13811u},{49744u,49745u,2313u},{49746u,49747u,13818u},{49748u,49748u,2315u},
+{49749u,49751u,13820u},{49752u,49752u,2316u},{49753u,49759u,13823u},{49760u,49760u,2317u},
+{49761u,49764u,13830u},{49765u,49765u,2318u},{49766u,49771u,13834u},{49772u,49773u,2319u},
+{49774u,49775u,13840u},{49776u,49776u,2321u},{49777u,49779u,13842u},{49780u,49780u,2322u},
+{49781u,49787u,13845u},{49788u,49789u,2323u},{49790u,49790u,13852u},{49791u,49791u,2325u},
+{49792u,49792u,13853u},{49793u,49793u,2326u},{49794u,49799u,13854u},{49800u,49801u,2327u},
+{49802u,49807u,13860u},{49808u,49808u,2329u},{49809u,49815u,13866u},{49816u,49816u,2330u},
+{49817u,49818u,13873u},{49819u,49819u,2331u},{49820u,49820u,13875u},{49821u,49821u,2332u},
+{49822u,49827u,13876u},{49828u,49829u,2333u},{49830u,49831u,13882u},{49832u,49832u,2335u},
+{49833u,49835u,13884u},{49836u,49837u,2336u},{49838u,49843u,13887u},{49844u,49845u,2338u},
+{49846u,49846u,13893u},{49847u,49847u,2340u},{49848u,49848u,13894u},{49849u,49849u,2341u},
+{49850u,49883u,13895u},{49884u,49885u,2342u},{49886u,49887u,13929u},{49888u,49888u,2344u},
+{49889u,49890u,13931u},{49891u,49892u,2345u},{49893u,49898u,13933u},{49899u,49901u,2347u},
+{49902u,49902u,13939u},{49903u,49903u,2350u},{49904u,49904u,13940u},{49905u,49905u,2351u},
+{49906u,49909u,13941u},{49910u,49910u,2352u},{49911u,49911u,13945u},{49912u,49913u,2353u},
+{49914u,49914u,13946u},{49915u,49916u,2355u},{49917u,49919u,13947u},{49920u,49920u,2357u},
+{49921u,49927u,13950u},{49928u,49929u,2358u},{49930u,49931u,13957u},{49932u,49933u,2360u},
+{49934u,49938u,13959u},{49939u,49941u,2362u},{49942u,49943u,13964u},{49944u,49944u,2365u},
+{49945u,49947u,13966u},{49948u,49948u,2366u},{49949u,49955u,13969u},{49956u,49957u,2367u},
+{49958u,49959u,13976u},{49960u,49961u,2369u},{49962u,49988u,13978u},{49989u,49989u,2371u},
+{49990u,50023u,14005u},{50024u,50025u,2372u},{50026u,50027u,14039u},{50028u,50028u,2374u},
+{50029u,50031u,14041u},{50032u,50032u,2375u},{50033u,50033u,14044u},{50034u,50034u,2376u},
+{50035u,50039u,14045u},{50040u,50041u,2377u},{50042u,50043u,14050u},{50044u,50045u,2379u},
+{50046u,50051u,14052u},{50052u,50052u,2381u},{50053u,50055u,14058u},{50056u,50056u,2382u},
+{50057u,50059u,14061u},{50060u,50060u,2383u},{50061u,50111u,14064u},{50112u,50112u,2384u},
+{50113u,50135u,14115u},{50136u,50137u,2385u},{50138u,50139u,14138u},{50140u,50140u,2387u},
+{50141u,50142u,14140u},{50143u,50144u,2388u},{50145u,50145u,14142u},{50146u,50146u,2390u},
+{50147u,50151u,14143u},{50152u,50153u,2391u},{50154u,50156u,14148u},{50157u,50157u,2393u},
+{50158u,50163u,14151u},{50164u,50165u,2394u},{50166u,50167u,14157u},{50168u,50168u,2396u},
+{50169u,50183u,14159u},{50184u,50184u,2397u},{50185u,50191u,14174u},{50192u,50192u,2398u},
+{50193u,50211u,14181u},{50212u,50212u,2399u},{50213u,50219u,14200u},{50220u,50220u,2400u},
+{50221u,50223u,14207u},{50224u,50224u,2401u},{50225u,50227u,14210u},{50228u,50228u,2402u},
+{50229u,50235u,14213u},{50236u,50237u,2403u},{50238u,50247u,14220u},{50248u,50248u,2405u},
+{50249u,50275u,14230u},{50276u,50277u,2406u},{50278u,50279u,14257u},{50280u,50280u,2408u},
+{50281u,50283u,14259u},{50284u,50284u,2409u},{50285u,50291u,14262u},{50292u,50293u,2410u},
+{50294u,50296u,14269u},{50297u,50297u,2412u},{50298u,50303u,14272u},{50304u,50304u,2413u},
+{50305u,50323u,14278u},{50324u,50324u,2414u},{50325u,50331u,14297u},{50332u,50332u,2415u},
+{50333u,50359u,14304u},{50360u,50360u,2416u},{50361u,50363u,14331u},{50364u,50364u,2417u},
+{50365u,50408u,14334u},{50409u,50409u,2418u},{50410u,50415u,14378u},{50416u,50417u,2419u},
+{50418u,50419u,14384u},{50420u,50420u,2421u},{50421u,50423u,14386u},{50424u,50424u,2422u},
+{50425u,50425u,14389u},{50426u,50426u,2423u},{50427u,50430u,14390u},{50431u,50433u,2424u},
+{50434u,50443u,14394u},{50444u,50444u,2427u},{50445u,50447u,14404u},{50448u,50448u,2428u},
+{50449u,50451u,14407u},{50452u,50452u,2429u},{50453u,50459u,14410u},{50460u,50460u,2430u},
+{50461u,50471u,14417u},{50472u,50473u,2431u},{50474u,50475u,14428u},{50476u,50476u,2433u},
+{50477u,50479u,14430u},{50480u,50480u,2434u},{50481u,50487u,14433u},{50488u,50489u,2435u},
+{50490u,50490u,14440u},{50491u,50491u,2437u},{50492u,50492u,14441u},{50493u,50493u,2438u},
+{50494u,50499u,14442u},{50500u,50501u,2439u},{50502u,50503u,14448u},{50504u,50506u,2441u},
+{50507u,50507u,14450u},{50508u,50510u,2444u},{50511u,50514u,14451u},{50515u,50517u,2447u},
+{50518u,50518u,14455u},{50519u,50521u,2450u},{50522u,50524u,14456u},{50525u,50526u,2453u},
+{50527u,50527u,14459u},{50528u,50529u,2455u},{50530u,50531u,14460u},{50532u,50532u,2457u},
+{50533u,50535u,14462u},{50536u,50536u,2458u},{50537u,50543u,14465u},{50544u,50545u,2459u},
+{50546u,50546u,14472u},{50547u,50549u,2461u},{50550u,50555u,14473u},{50556u,50557u,2464u},
+{50558u,50559u,14479u},{50560u,50560u,2466u},{50561u,50563u,14481u},{50564u,50564u,2467u},
+{50565u,50566u,14484u},{50567u,50567u,2468u},{50568u,50571u,14486u},{50572u,50573u,2469u},
+{50574u,50574u,14490u},{50575u,50575u,2471u},{50576u,50576u,14491u},{50577u,50577u,2472u},
+{50578u,50580u,14492u},{50581u,50581u,2473u},{50582u,50582u,14495u},{50583u,50584u,2474u},
+{50585u,50587u,14496u},{50588u,50588u,2476u},{50589u,50591u,14499u},{50592u,50592u,2477u},
+{50593u,50600u,14502u},{50601u,50601u,2478u},{50602u,50611u,14510u},{50612u,50613u,2479u},
+{50614u,50615u,14520u},{50616u,50617u,2481u},{50618u,50618u,14522u},{50619u,50622u,2483u},
+{50623u,50627u,14523u},{50628u,50634u,2487u},{50635u,50635u,14528u},{50636u,50636u,2494u},
+{50637u,50637u,14529u},{50638u,50638u,2495u},{50639u,50639u,14530u},{50640u,50641u,2496u},
+{50642u,50643u,14531u},{50644u,50644u,2498u},{50645u,50647u,14533u},{50648u,50648u,2499u},
+{50649u,50655u,14536u},{50656u,50657u,2500u},{50658u,50658u,14543u},{50659u,50659u,2502u},
+{50660u,50660u,14544u},{50661u,50661u,2503u},{50662u,50667u,14545u},{50668u,50670u,2504u},
+{50671u,50671u,14551u},{50672u,50672u,2507u},{50673u,50675u,14552u},{50676u,50676u,2508u},
+{50677u,50677u,14555u},{50678u,50679u,2509u},{50680u,50683u,14556u},{50684u,50689u,2511u},
+{50690u,50692u,14560u},{50693u,50696u,2517u},{50697u,50699u,14563u},{50700u,50700u,2521u},
+{50701u,50703u,14566u},{50704u,50704u,2522u},{50705u,50711u,14569u},{50712u,50713u,2523u},
+{50714u,50714u,14576u},{50715u,50716u,2525u},{50717u,50723u,14577u},{50724u,50725u,2527u},
+{50726u,50727u,14584u},{50728u,50728u,2529u},{50729u,50731u,14586u},{50732u,50734u,2530u},
+{50735u,50735u,14589u},{50736u,50736u,2533u},{50737u,50738u,14590u},{50739u,50741u,2534u},
+{50742u,50742u,14592u},{50743u,50743u,2537u},{50744u,50744u,14593u},{50745u,50745u,2538u},
+{50746u,50746u,14594u},{50747u,50747u,2539u},{50748u,50751u,14595u},{50752u,50753u,2540u},
+{50754u,50755u,14599u},{50756u,50756u,2542u},{50757u,50759u,14601u},{50760u,50760u,2543u},
+{50761u,50767u,14604u},{50768u,50769u,2544u},{50770u,50770u,14611u},{50771u,50773u,2546u},
+{50774u,50779u,14612u},{50780u,50781u,2549u},{50782u,50783u,14618u},{50784u,50784u,2551u},
+{50785u,50795u,14620u},{50796u,50796u,2552u},{50797u,50798u,14631u},{50799u,50799u,2553u},
+{50800u,50800u,14633u},{50801u,50801u,2554u},{50802u,50807u,14634u},{50808u,50809u,2555u},
+{50810u,50811u,14640u},{50812u,50812u,2557u},{50813u,50815u,14642u},{50816u,50816u,2558u},
+{50817u,50823u,14645u},{50824u,50825u,2559u},{50826u,50826u,14652u},{50827u,50827u,2561u},
+{50828u,50828u,14653u},{50829u,50829u,2562u},{50830u,50835u,14654u},{50836u,50837u,2563u},
+{50838u,50839u,14660u},{50840u,50840u,2565u},{50841u,50843u,14662u},{50844u,50844u,2566u},
+{50845u,50851u,14665u},{50852u,50853u,2567u},{50854u,50854u,14672u},{50855u,50855u,2569u},
+{50856u,50856u,14673u},{50857u,50857u,2570u},{50858u,50863u,14674u},{50864u,50865u,2571u},
+{50866u,50867u,14680u},{50868u,50868u,2573u},{50869u,50871u,14682u},{50872u,50874u,2574u},
+{50875u,50879u,14685u},{50880u,50881u,2577u},{50882u,50882u,14690u},{50883u,50883u,2579u},
+{50884u,50884u,14691u},{50885u,50885u,2580u},{50886u,50891u,14692u},{50892u,50893u,2581u},
+{50894u,50895u,14698u},{50896u,50896u,2583u},{50897u,50899u,14700u},{50900u,50900u,2584u},
+{50901u,50907u,14703u},{50908u,50909u,2585u},{50910u,50911u,14710u},{50912u,50913u,2587u},
+{50914u,50919u,14712u},{50920u,50921u,2589u},{50922u,50923u,14718u},{50924u,50924u,2591u},
+{50925u,50927u,14720u},{50928u,50928u,2592u},{50929u,50935u,14723u},{50936u,50937u,2593u},
+{50938u,50940u,14730u},{50941u,50941u,2595u},{50942u,50947u,14733u},{50948u,50949u,2596u},
+{50950u,50951u,14739u},{50952u,50952u,2598u},{50953u,50955u,14741u},{50956u,50956u,2599u},
+{50957u,50963u,14744u},{50964u,50965u,2600u},{50966u,50966u,14751u},{50967u,50967u,2602u},
+{50968u,50968u,14752u},{50969u,50969u,2603u},{50970u,50975u,14753u},{50976u,50977u,2604u},
+{50978u,50979u,14759u},{50980u,50980u,2606u},{50981u,50983u,14761u},{50984u,50984u,2607u},
+{50985u,50991u,14764u},{50992u,50993u,2608u},{50994u,50994u,14771u},{50995u,50995u,2610u},
+{50996u,50996u,14772u},{50997u,50997u,2611u},{50998u,50998u,14773u},{50999u,50999u,2612u},
+{51000u,51003u,14774u},{51004u,51005u,2613u},{51006u,51007u,14778u},{51008u,51008u,2615u},
+{51009u,51011u,14780u},{51012u,51012u,2616u},{51013u,51017u,14783u},{51018u,51018u,2617u},
+{51019u,51019u,14788u},{51020u,51021u,2618u},{51022u,51022u,14789u},{51023u,51023u,2620u},
+{51024u,51024u,14790u},{51025u,51032u,2621u},{51033u,51035u,14791u},{51036u,51036u,2629u},
+{51037u,51039u,14794u},{51040u,51040u,2630u},{51041u,51047u,14797u},{51048u,51048u,2631u},
+{51049u,51050u,14804u},{51051u,51051u,2632u},{51052u,51059u,14806u},{51060u,51061u,2633u},
+{51062u,51063u,14814u},{51064u,51064u,2635u},{51065u,51067u,14816u},{51068u,51070u,2636u},
+{51071u,51074u,14819u},{51075u,51077u,2639u},{51078u,51078u,14823u},{51079u,51082u,2642u},
+{51083u,51085u,14824u},{51086u,51086u,2646u},{51087u,51087u,14827u},{51088u,51089u,2647u},
+{51090u,51091u,14828u},{51092u,51092u,2649u},{51093u,51093u,14830u},{51094u,51096u,2650u},
+{51097u,51097u,14831u},{51098u,51098u,2653u},{51099u,51103u,14832u},{51104u,51105u,2654u},
+{51106u,51106u,14837u},{51107u,51110u,2656u},{51111u,51115u,14838u},{51116u,51117u,2660u},
+{51118u,51119u,14843u},{51120u,51120u,2662u},{51121u,51123u,14845u},{51124u,51124u,2663u},
+{51125u,51131u,14848u},{51132u,51133u,2664u},{51134u,51134u,14855u},{51135u,51137u,2666u},
+{51138u,51143u,14856u},{51144u,51145u,2669u},{51146u,51147u,14862u},{51148u,51148u,2671u},
+{51149u,51149u,14864u},{51150u,51150u,2672u},{51151u,51151u,14865u},{51152u,51152u,2673u},
+{51153u,51159u,14866u},{51160u,51160u,2674u},{51161u,51164u,14873u},{51165u,51165u,2675u},
+{51166u,51171u,14877u},{51172u,51172u,2676u},{51173u,51175u,14883u},{51176u,51176u,2677u},
+{51177u,51179u,14886u},{51180u,51180u,2678u},{51181u,51199u,14889u},{51200u,51201u,2679u},
+{51202u,51203u,14908u},{51204u,51204u,2681u},{51205u,51207u,14910u},{51208u,51208u,2682u},
+{51209u,51209u,14913u},{51210u,51210u,2683u},{51211u,51215u,14914u},{51216u,51217u,2684u},
+{51218u,51218u,14919u},{51219u,51219u,2686u},{51220u,51220u,14920u},{51221u,51222u,2687u},
+{51223u,51227u,14921u},{51228u,51229u,2689u},{51230u,51231u,14926u},{51232u,51232u,2691u},
+{51233u,51235u,14928u},{51236u,51236u,2692u},{51237u,51243u,14931u},{51244u,51245u,2693u},
+{51246u,51246u,14938u},{51247u,51247u,2695u},{51248u,51248u,14939u},{51249u,51249u,2696u},
+{51250u,51255u,14940u},{51256u,51256u,2697u},{51257u,51259u,14946u},{51260u,51260u,2698u},
+{51261u,51263u,14949u},{51264u,51264u,2699u},{51265u,51271u,14952u},{51272u,51273u,2700u},
+{51274u,51275u,14959u},{51276u,51277u,2702u},{51278u,51283u,14961u},{51284u,51284u,2704u},
+{51285u,51311u,14967u},{51312u,51313u,2705u},{51314u,51315u,14994u},{51316u,51316u,2707u},
+{51317u,51319u,14996u},{51320u,51320u,2708u},{51321u,51321u,14999u},{51322u,51322u,2709u},
+{51323u,51327u,15000u},{51328u,51329u,2710u},{51330u,51330u,15005u},{51331u,51331u,2712u},
+{51332u,51332u,15006u},{51333u,51335u,2713u},{51336u,51338u,15007u},{51339u,51341u,2716u},
+{51342u,51347u,15010u},{51348u,51348u,2719u},{51349u,51356u,15016u},{51357u,51357u,2720u},
+{51358u,51358u,15024u},{51359u,51359u,2721u},{51360u,51360u,15025u},{51361u,51361u,2722u},
+{51362u,51367u,15026u},{51368u,51368u,2723u},{51369u,51387u,15032u},{51388u,51389u,2724u},
+{51390u,51395u,15051u},{51396u,51396u,2726u},{51397u,51399u,15057u},{51400u,51400u,2727u},
+{51401u,51403u,15060u},{51404u,51404u,2728u},{51405u,51411u,15063u},{51412u,51413u,2729u},
+{51414u,51414u,15070u},{51415u,51415u,2731u},{51416u,51416u,15071u},{51417u,51417u,2732u},
+{51418u,51423u,15072u},{51424u,51425u,2733u},{51426u,51427u,15078u},{51428u,51428u,2735u},
+{51429u,51444u,15080u},{51445u,51445u,2736u},{51446u,51451u,15096u},{51452u,51453u,2737u},
+{51454u,51455u,15102u},{51456u,51456u,2739u},{51457u,51459u,15104u},{51460u,51462u,2740u},
+{51463u,51467u,15107u},{51468u,51469u,2743u},{51470u,51470u,15112u},{51471u,51471u,2745u},
+{51472u,51472u,15113u},{51473u,51473u,2746u},{51474u,51479u,15114u},{51480u,51480u,2747u},
+{51481u,51499u,15120u},{51500u,51500u,2748u},{51501u,51507u,15139u},{51508u,51508u,2749u},
+{51509u,51535u,15146u},{51536u,51537u,2750u},{51538u,51539u,15173u},{51540u,51540u,2752u},
+{51541u,51543u,15175u},{51544u,51544u,2753u},{51545u,51551u,15178u},{51552u,51553u,2754u},
+{51554u,51554u,15185u},{51555u,51555u,2756u},{51556u,51563u,15186u},{51564u,51564u,2757u},
+{51565u,51567u,15194u},{51568u,51568u,2758u},{51569u,51571u,15197u},{51572u,51572u,2759u},
+{51573u,51579u,15200u},{51580u,51580u,2760u},{51581u,51591u,15207u},{51592u,51593u,2761u},
+{51594u,51595u,15218u},{51596u,51596u,2763u},{51597u,51599u,15220u},{51600u,51600u,2764u},
+{51601u,51607u,15223u},{51608u,51609u,2765u},{51610u,51610u,15230u},{51611u,51611u,2767u},
+{51612u,51612u,15231u},{51613u,51613u,2768u},{51614u,51647u,15232u},{51648u,51649u,2769u},
+{51650u,51651u,15266u},{51652u,51652u,2771u},{51653u,51654u,15268u},{51655u,51656u,2772u},
+{51657u,51657u,15270u},{51658u,51658u,2774u},{51659u,51663u,15271u},{51664u,51665u,2775u},
+{51666u,51666u,15276u},{51667u,51667u,2777u},{51668u,51668u,15277u},{51669u,51670u,2778u},
+{51671u,51672u,15278u},{51673u,51674u,2780u},{51675u,51675u,15280u},{51676u,51677u,2782u},
+{51678u,51679u,15281u},{51680u,51680u,2784u},{51681u,51681u,15283u},{51682u,51682u,2785u},
+{51683u,51683u,15284u},{51684u,51684u,2786u},{51685u,51686u,15285u},{51687u,51687u,2787u},
+{51688u,51691u,15287u},{51692u,51693u,2788u},{51694u,51694u,15291u},{51695u,51697u,2790u},
+{51698u,51703u,15292u},{51704u,51705u,2793u},{51706u,51707u,15298u},{51708u,51708u,2795u},
+{51709u,51711u,15300u},{51712u,51712u,2796u},{51713u,51719u,15303u},{51720u,51721u,2797u},
+{51722u,51722u,15310u},{51723u,51725u,2799u},{51726u,51731u,15311u},{51732u,51732u,2802u},
+{51733u,51735u,15317u},{51736u,51736u,2803u},{51737u,51752u,15320u},{51753u,51753u,2804u},
+{51754u,51787u,15336u},{51788u,51789u,2805u},{51790u,51791u,15370u},{51792u,51792u,2807u},
+{51793u,51795u,15372u},{51796u,51796u,2808u},{51797u,51803u,15375u},{51804u,51805u,2809u},
+{51806u,51806u,15382u},{51807u,51809u,2811u},{51810u,51815u,15383u},{51816u,51816u,2814u},
+{51817u,51836u,15389u},{51837u,51837u,2815u},{51838u,51843u,15409u},{51844u,51844u,2816u},
+{51845u,51863u,15415u},{51864u,51864u,2817u},{51865u,51899u,15434u},{51900u,51901u,2818u},
+{51902u,51903u,15469u},{51904u,51904u,2820u},{51905u,51907u,15471u},{51908u,51908u,2821u},
+{51909u,51915u,15474u},{51916u,51917u,2822u},{51918u,51918u,15481u},{51919u,51919u,2824u},
+{51920u,51920u,15482u},{51921u,51921u,2825u},{51922u,51922u,15483u},{51923u,51923u,2826u},
+{51924u,51927u,15484u},{51928u,51929u,2827u},{51930u,51935u,15488u},{51936u,51936u,2829u},
+{51937u,51947u,15494u},{51948u,51948u,2830u},{51949u,51955u,15505u},{51956u,51956u,2831u},
+{51957u,51975u,15512u},{51976u,51976u,2832u},{51977u,51983u,15531u},{51984u,51984u,2833u},
+{51985u,51987u,15538u},{51988u,51988u,2834u},{51989u,51991u,15541u},{51992u,51992u,2835u},
+{51993u,51999u,15544u},{52000u,52001u,2836u},{52002u,52032u,15551u},{52033u,52033u,2838u},
+{52034u,52039u,15582u},{52040u,52041u,2839u},{52042u,52043u,15588u},{52044u,52044u,2841u},
+{52045u,52047u,15590u},{52048u,52048u,2842u},{52049u,52055u,15593u},{52056u,52057u,2843u},
+{52058u,52060u,15600u},{52061u,52061u,2845u},{52062u,52067u,15603u},{52068u,52068u,2846u},
+{52069u,52087u,15609u},{52088u,52089u,2847u},{52090u,52123u,15628u},{52124u,52124u,2849u},
+{52125u,52151u,15662u},{52152u,52152u,2850u},{52153u,52179u,15689u},{52180u,52180u,2851u},
+{52181u,52195u,15716u},{52196u,52196u,2852u},{52197u,52198u,15731u},{52199u,52199u,2853u},
+{52200u,52200u,15733u},{52201u,52201u,2854u},{52202u,52235u,15734u},{52236u,52237u,2855u},
+{52238u,52239u,15768u},{52240u,52240u,2857u},{52241u,52243u,15770u},{52244u,52244u,2858u},
+{52245u,52251u,15773u},{52252u,52253u,2859u},{52254u,52256u,15780u},{52257u,52258u,2861u},
+{52259u,52262u,15783u},{52263u,52265u,2863u},{52266u,52267u,15787u},{52268u,52268u,2866u},
+{52269u,52269u,15789u},{52270u,52270u,2867u},{52271u,52271u,15790u},{52272u,52272u,2868u},
+{52273u,52279u,15791u},{52280u,52281u,2869u},{52282u,52282u,15798u},{52283u,52286u,2871u},
+{52287u,52291u,15799u},{52292u,52293u,2875u},{52294u,52295u,15804u},{52296u,52296u,2877u},
+{52297u,52299u,15806u},{52300u,52300u,2878u},{52301u,52307u,15809u},{52308u,52309u,2879u},
+{52310u,52310u,15816u},{52311u,52313u,2881u},{52314u,52319u,15817u},{52320u,52320u,2884u},
+{52321u,52323u,15823u},{52324u,52324u,2885u},{52325u,52325u,15826u},{52326u,52326u,2886u},
+{52327u,52327u,15827u},{52328u,52328u,2887u},{52329u,52335u,15828u},{52336u,52336u,2888u},
+{52337u,52340u,15835u},{52341u,52341u,2889u},{52342u,52375u,15839u},{52376u,52377u,2890u},
+{52378u,52379u,15873u},{52380u,52380u,2892u},{52381u,52383u,15875u},{52384u,52384u,2893u},
+{52385u,52391u,15878u},{52392u,52393u,2894u},{52394u,52394u,15885u},{52395u,52397u,2896u},
+{52398u,52403u,15886u},{52404u,52405u,2899u},{52406u,52407u,15892u},{52408u,52408u,2901u},
+{52409u,52411u,15894u},{52412u,52412u,2902u},{52413u,52419u,15897u},{52420u,52421u,2903u},
+{52422u,52422u,15904u},{52423u,52423u,2905u},{52424u,52424u,15905u},{52425u,52425u,2906u},
+{52426u,52431u,15906u},{52432u,52432u,2907u},{52433u,52435u,15912u},{52436u,52436u,2908u},
+{52437u,52451u,15915u},{52452u,52452u,2909u},{52453u,52459u,15930u},{52460u,52460u,2910u},
+{52461u,52463u,15937u},{52464u,52464u,2911u},{52465u,52480u,15940u},{52481u,52481u,2912u},
+{52482u,52487u,15956u},{52488u,52489u,2913u},{52490u,52491u,15962u},{52492u,52492u,2915u},
+{52493u,52495u,15964u},{52496u,52496u,2916u},{52497u,52503u,15967u},{52504u,52505u,2917u},
+{52506u,52506u,15974u},{52507u,52507u,2919u},{52508u,52508u,15975u},{52509u,52509u,2920u},
+{52510u,52515u,15976u},{52516u,52516u,2921u},{52517u,52519u,15982u},{52520u,52520u,2922u},
+{52521u,52523u,15985u},{52524u,52524u,2923u},{52525u,52536u,15988u},{52537u,52537u,2924u},
+{52538u,52571u,16000u},{52572u,52572u,2925u},{52573u,52575u,16034u},{52576u,52576u,2926u},
+{52577u,52579u,16037u},{52580u,52580u,2927u},{52581u,52587u,16040u},{52588u,52589u,2928u},
+{52590u,52590u,16047u},{52591u,52591u,2930u},{52592u,52592u,16048u},{52593u,52593u,2931u},
+{52594u,52599u,16049u},{52600u,52600u,2932u},{52601u,52615u,16055u},{52616u,52616u,2933u},
+{52617u,52627u,16070u},{52628u,52629u,2934u},{52630u,52631u,16081u},{52632u,52632u,2936u},
+{52633u,52635u,16083u},{52636u,52636u,2937u},{52637u,52643u,16086u},{52644u,52645u,2938u},
+{52646u,52646u,16093u},{52647u,52647u,2940u},{52648u,52648u,16094u},{52649u,52649u,2941u},
+{52650u,52655u,16095u},{52656u,52656u,2942u},{52657u,52675u,16101u},{52676u,52676u,2943u},
+{52677u,52683u,16120u},{52684u,52684u,2944u},{52685u,52687u,16127u},{52688u,52688u,2945u},
+{52689u,52711u,16130u},{52712u,52712u,2946u},{52713u,52715u,16153u},{52716u,52716u,2947u},
+{52717u,52719u,16156u},{52720u,52720u,2948u},{52721u,52727u,16159u},{52728u,52729u,2949u},
+{52730u,52730u,16166u},{52731u,52731u,2951u},{52732u,52732u,16167u},{52733u,52733u,2952u},
+{52734u,52739u,16168u},{52740u,52740u,2953u},{52741u,52743u,16174u},{52744u,52744u,2954u},
+{52745u,52747u,16177u},{52748u,52748u,2955u},{52749u,52755u,16180u},{52756u,52756u,2956u},
+{52757u,52760u,16187u},{52761u,52761u,2957u},{52762u,52767u,16191u},{52768u,52769u,2958u},
+{52770u,52771u,16197u},{52772u,52772u,2960u},{52773u,52775u,16199u},{52776u,52776u,2961u},
+{52777u,52783u,16202u},{52784u,52785u,2962u},{52786u,52786u,16209u},{52787u,52787u,2964u},
+{52788u,52788u,16210u},{52789u,52789u,2965u},{52790u,52823u,16211u},{52824u,52825u,2966u},
+{52826u,52827u,16245u},{52828u,52828u,2968u},{52829u,52830u,16247u},{52831u,52833u,2969u},
+{52834u,52839u,16249u},{52840u,52841u,2972u},{52842u,52842u,16255u},{52843u,52843u,2974u},
+{52844u,52844u,16256u},{52845u,52845u,2975u},{52846u,52851u,16257u},{52852u,52853u,2976u},
+{52854u,52855u,16263u},{52856u,52856u,2978u},{52857u,52859u,16265u},{52860u,52860u,2979u},
+{52861u,52867u,16268u},{52868u,52869u,2980u},{52870u,52870u,16275u},{52871u,52871u,2982u},
+{52872u,52872u,16276u},{52873u,52873u,2983u},{52874u,52879u,16277u},{52880u,52881u,2984u},
+{52882u,52883u,16283u},{52884u,52884u,2986u},{52885u,52887u,16285u},{52888u,52888u,2987u},
+{52889u,52895u,16288u},{52896u,52897u,2988u},{52898u,52898u,16295u},{52899u,52901u,2990u},
+{52902u,52907u,16296u},{52908u,52909u,2993u},{52910u,52928u,16302u},{52929u,52929u,2995u},
+{52930u,52963u,16321u},{52964u,52965u,2996u},{52966u,52967u,16355u},{52968u,52968u,2998u},
+{52969u,52970u,16357u},{52971u,52972u,2999u},{52973u,52979u,16359u},{52980u,52981u,3001u},
+{52982u,52982u,16366u},{52983u,52985u,3003u},{52986u,52991u,16367u},{52992u,52993u,3006u},
+{52994u,52995u,16373u},{52996u,52996u,3008u},{52997u,52999u,16375u},{53000u,53000u,3009u},
+{53001u,53007u,16378u},{53008u,53009u,3010u},{53010u,53010u,16385u},{53011u,53011u,3012u},
+{53012u,53012u,16386u},{53013u,53013u,3013u},{53014u,53019u,16387u},{53020u,53020u,3014u},
+{53021u,53023u,16393u},{53024u,53024u,3015u},{53025u,53027u,16396u},{53028u,53028u,3016u},
+{53029u,53035u,16399u},{53036u,53037u,3017u},{53038u,53038u,16406u},{53039u,53041u,3019u},
+{53042u,53047u,16407u},{53048u,53048u,3022u},{53049u,53075u,16413u},{53076u,53077u,3023u},
+{53078u,53079u,16440u},{53080u,53080u,3025u},{53081u,53083u,16442u},{53084u,53084u,3026u},
+{53085u,53091u,16445u},{53092u,53093u,3027u},{53094u,53094u,16452u},{53095u,53095u,3029u},
+{53096u,53096u,16453u},{53097u,53097u,3030u},{53098u,53103u,16454u},{53104u,53105u,3031u},
+{53106u,53107u,16460u},{53108u,53108u,3033u},{53109u,53111u,16462u},{53112u,53112u,3034u},
+{53113u,53119u,16465u},{53120u,53120u,3035u},{53121u,53124u,16472u},{53125u,53125u,3036u},
+{53126u,53131u,16476u},{53132u,53132u,3037u},{53133u,53152u,16482u},{53153u,53153u,3038u},
+{53154u,53159u,16502u},{53160u,53160u,3039u},{53161u,53167u,16508u},{53168u,53168u,3040u},
+{53169u,53187u,16515u},{53188u,53188u,3041u},{53189u,53215u,16534u},{53216u,53217u,3042u},
+{53218u,53219u,16561u},{53220u,53220u,3044u},{53221u,53223u,16563u},{53224u,53224u,3045u},
+{53225u,53231u,16566u},{53232u,53233u,3046u},{53234u,53234u,16573u},{53235u,53235u,3048u},
+{53236u,53236u,16574u},{53237u,53237u,3049u},{53238u,53243u,16575u},{53244u,53244u,3050u},
+{53245u,53247u,16581u},{53248u,53248u,3051u},{53249u,53251u,16584u},{53252u,53252u,3052u},
+{53253u,53264u,16587u},{53265u,53265u,3053u},{53266u,53271u,16599u},{53272u,53272u,3054u},
+{53273u,53292u,16605u},{53293u,53293u,3055u},{53294u,53299u,16625u},{53300u,53301u,3056u},
+{53302u,53303u,16631u},{53304u,53304u,3058u},{53305u,53307u,16633u},{53308u,53308u,3059u},
+{53309u,53315u,16636u},{53316u,53317u,3060u},{53318u,53318u,16643u},{53319u,53319u,3062u},
+{53320u,53320u,16644u},{53321u,53321u,3063u},{53322u,53327u,16645u},{53328u,53328u,3064u},
+{53329u,53331u,16651u},{53332u,53332u,3065u},{53333u,53335u,16654u},{53336u,53336u,3066u},
+{53337u,53343u,16657u},{53344u,53344u,3067u},{53345u,53355u,16664u},{53356u,53357u,3068u},
+{53358u,53359u,16675u},{53360u,53360u,3070u},{53361u,53363u,16677u},{53364u,53364u,3071u},
+{53365u,53371u,16680u},{53372u,53373u,3072u},{53374u,53376u,16687u},{53377u,53377u,3074u},
+{53378u,53411u,16690u},{53412u,53413u,3075u},{53414u,53415u,16724u},{53416u,53416u,3077u},
+{53417u,53419u,16726u},{53420u,53420u,3078u},{53421u,53427u,16729u},{53428u,53429u,3079u},
+{53430u,53430u,16736u},{53431u,53431u,3081u},{53432u,53432u,16737u},{53433u,53433u,3082u},
+{53434u,53439u,16738u},{53440u,53441u,3083u},{53442u,53443u,16744u},{53444u,53444u,3085u},
+{53445u,53447u,16746u},{53448u,53449u,3086u},{53450u,53455u,16749u},{53456u,53457u,3088u},
+{53458u,53458u,16755u},{53459u,53461u,3090u},{53462u,53467u,16756u},{53468u,53469u,3093u},
+{53470u,53471u,16762u},{53472u,53472u,3095u},{53473u,53475u,16764u},{53476u,53476u,3096u},
+{53477u,53483u,16767u},{53484u,53485u,3097u},{53486u,53486u,16774u},{53487u,53489u,3099u},
+{53490u,53495u,16775u},{53496u,53496u,3102u},{53497u,53516u,16781u},{53517u,53517u,3103u},
+{53518u,53551u,16801u},{53552u,53553u,3104u},{53554u,53555u,16835u},{53556u,53556u,3106u},
+{53557u,53559u,16837u},{53560u,53560u,3107u},{53561u,53561u,16840u},{53562u,53562u,3108u},
+{53563u,53567u,16841u},{53568u,53569u,3109u},{53570u,53570u,16846u},{53571u,53573u,3111u},
+{53574u,53579u,16847u},{53580u,53581u,3114u},{53582u,53583u,16853u},{53584u,53584u,3116u},
+{53585u,53587u,16855u},{53588u,53588u,3117u},{53589u,53595u,16858u},{53596u,53597u,3118u},
+{53598u,53598u,16865u},{53599u,53599u,3120u},{53600u,53600u,16866u},{53601u,53601u,3121u},
+{53602u,53607u,16867u},{53608u,53608u,3122u},{53609u,53611u,16873u},{53612u,53612u,3123u},
+{53613u,53627u,16876u},{53628u,53628u,3124u},{53629u,53635u,16891u},{53636u,53636u,3125u},
+{53637u,53639u,16898u},{53640u,53640u,3126u},{53641u,53663u,16901u},{53664u,53665u,3127u},
+{53666u,53667u,16924u},{53668u,53668u,3129u},{53669u,53671u,16926u},{53672u,53672u,3130u},
+{53673u,53679u,16929u},{53680u,53681u,3131u},{53682u,53682u,16936u},{53683u,53683u,3133u},
+{53684u,53684u,16937u},{53685u,53685u,3134u},{53686u,53689u,16938u},{53690u,53690u,3135u},
+{53691u,53691u,16942u},{53692u,53692u,3136u},{53693u,53695u,16943u},{53696u,53696u,3137u},
+{53697u,53719u,16946u},{53720u,53720u,3138u},{53721u,53747u,16969u},{53748u,53748u,3139u},
+{53749u,53751u,16996u},{53752u,53752u,3140u},{53753u,53766u,16999u},{53767u,53767u,3141u},
+{53768u,53768u,17013u},{53769u,53769u,3142u},{53770u,53775u,17014u},{53776u,53776u,3143u},
+{53777u,53803u,17020u},{53804u,53805u,3144u},{53806u,53807u,17047u},{53808u,53808u,3146u},
+{53809u,53811u,17049u},{53812u,53812u,3147u},{53813u,53819u,17052u},{53820u,53821u,3148u},
+{53822u,53822u,17059u},{53823u,53823u,3150u},{53824u,53824u,17060u},{53825u,53825u,3151u},
+{53826u,53831u,17061u},{53832u,53832u,3152u},{53833u,53851u,17067u},{53852u,53852u,3153u},
+{53853u,53859u,17086u},{53860u,53860u,3154u},{53861u,53887u,17093u},{53888u,53889u,3155u},
+{53890u,53891u,17120u},{53892u,53892u,3157u},{53893u,53895u,17122u},{53896u,53896u,3158u},
+{53897u,53903u,17125u},{53904u,53905u,3159u},{53906u,53908u,17132u},{53909u,53909u,3161u},
+{53910u,53915u,17135u},{53916u,53916u,3162u},{53917u,53919u,17141u},{53920u,53920u,3163u},
+{53921u,53923u,17144u},{53924u,53924u,3164u},{53925u,53931u,17147u},{53932u,53932u,3165u},
+{53933u,53936u,17154u},{53937u,53937u,3166u},{53938u,53943u,17158u},{53944u,53945u,3167u},
+{53946u,53947u,17164u},{53948u,53948u,3169u},{53949u,53950u,17166u},{53951u,53952u,3170u},
+{53953u,53953u,17168u},{53954u,53954u,3172u},{53955u,53959u,17169u},{53960u,53961u,3173u},
+{53962u,53962u,17174u},{53963u,53963u,3175u},{53964u,53971u,17175u},{53972u,53972u,3176u},
+{53973u,53975u,17183u},{53976u,53976u,3177u},{53977u,53979u,17186u},{53980u,53980u,3178u},
+{53981u,53987u,17189u},{53988u,53989u,3179u},{53990u,53999u,17196u},{54000u,54001u,3181u},
+{54002u,54003u,17206u},{54004u,54004u,3183u},{54005u,54007u,17208u},{54008u,54008u,3184u},
+{54009u,54015u,17211u},{54016u,54017u,3185u},{54018u,54018u,17218u},{54019u,54019u,3187u},
+{54020u,54020u,17219u},{54021u,54021u,3188u},{54022u,54027u,17220u},{54028u,54030u,3189u},
+{54031u,54031u,17226u},{54032u,54032u,3192u},{54033u,54035u,17227u},{54036u,54036u,3193u},
+{54037u,54037u,17230u},{54038u,54038u,3194u},{54039u,54043u,17231u},{54044u,54045u,3195u},
+{54046u,54046u,17236u},{54047u,54049u,3197u},{54050u,54052u,17237u},{54053u,54053u,3200u},
+{54054u,54055u,17240u},{54056u,54057u,3201u},{54058u,54059u,17242u},{54060u,54060u,3203u},
+{54061u,54063u,17244u},{54064u,54064u,3204u},{54065u,54071u,17247u},{54072u,54073u,3205u},
+{54074u,54074u,17254u},{54075u,54077u,3207u},{54078u,54083u,17255u},{54084u,54085u,3210u},
+{54086u,54139u,17261u},{54140u,54141u,3212u},{54142u,54143u,17315u},{54144u,54144u,3214u},
+{54145u,54147u,17317u},{54148u,54148u,3215u},{54149u,54155u,17320u},{54156u,54157u,3216u},
+{54158u,54158u,17327u},{54159u,54161u,3218u},{54162u,54167u,17328u},{54168u,54169u,3221u},
+{54170u,54171u,17334u},{54172u,54172u,3223u},{54173u,54175u,17336u},{54176u,54176u,3224u},
+{54177u,54183u,17339u},{54184u,54185u,3225u},{54186u,54186u,17346u},{54187u,54187u,3227u},
+{54188u,54188u,17347u},{54189u,54189u,3228u},{54190u,54195u,17348u},{54196u,54196u,3229u},
+{54197u,54199u,17354u},{54200u,54200u,3230u},{54201u,54203u,17357u},{54204u,54204u,3231u},
+{54205u,54211u,17360u},{54212u,54213u,3232u},{54214u,54215u,17367u},{54216u,54217u,3234u},
+{54218u,54223u,17369u},{54224u,54224u,3236u},{54225u,54231u,17375u},{54232u,54232u,3237u},
+{54233u,54240u,17382u},{54241u,54241u,3238u},{54242u,54242u,17390u},{54243u,54243u,3239u},
+{54244u,54251u,17391u},{54252u,54253u,3240u},{54254u,54255u,17399u},{54256u,54256u,3242u},
+{54257u,54259u,17401u},{54260u,54260u,3243u},{54261u,54267u,17404u},{54268u,54269u,3244u},
+{54270u,54270u,17411u},{54271u,54271u,3246u},{54272u,54272u,17412u},{54273u,54273u,3247u},
+{54274u,54279u,17413u},{54280u,54280u,3248u},{54281u,54300u,17419u},{54301u,54301u,3249u},
+{54302u,54335u,17439u},{54336u,54336u,3250u},{54337u,54339u,17473u},{54340u,54340u,3251u},
+{54341u,54363u,17476u},{54364u,54364u,3252u},{54365u,54367u,17499u},{54368u,54368u,3253u},
+{54369u,54371u,17502u},{54372u,54372u,3254u},{54373u,54380u,17505u},{54381u,54381u,3255u},
+{54382u,54382u,17513u},{54383u,54383u,3256u},{54384u,54391u,17514u},{54392u,54393u,3257u},
+{54394u,54395u,17522u},{54396u,54396u,3259u},{54397u,54398u,17524u},{54399u,54400u,3260u},
+{54401u,54401u,17526u},{54402u,54402u,3262u},{54403u,54407u,17527u},{54408u,54409u,3263u},
+{54410u,54410u,17532u},{54411u,54411u,3265u},{54412u,54412u,17533u},{54413u,54413u,3266u},
+{54414u,54419u,17534u},{54420u,54420u,3267u},{54421u,54440u,17540u},{54441u,54441u,3268u},
+{54442u,54475u,17560u},{54476u,54476u,3269u},{54477u,54479u,17594u},{54480u,54480u,3270u},
+{54481u,54483u,17597u},{54484u,54484u,3271u},{54485u,54491u,17600u},{54492u,54492u,3272u},
+{54493u,54494u,17607u},{54495u,54495u,3273u},{54496u,54503u,17609u},{54504u,54504u,3274u},
+{54505u,54507u,17617u},{54508u,54508u,3275u},{54509u,54511u,17620u},{54512u,54512u,3276u},
+{54513u,54519u,17623u},{54520u,54520u,3277u},{54521u,54522u,17630u},{54523u,54523u,3278u},
+{54524u,54524u,17632u},{54525u,54525u,3279u},{54526u,54531u,17633u},{54532u,54532u,3280u},
+{54533u,54535u,17639u},{54536u,54536u,3281u},{54537u,54539u,17642u},{54540u,54540u,3282u},
+{54541u,54547u,17645u},{54548u,54549u,3283u},{54550u,54550u,17652u},{54551u,54551u,3285u},
+{54552u,54587u,17653u},{54588u,54589u,3286u},{54590u,54591u,17689u},{54592u,54592u,3288u},
+{54593u,54595u,17691u},{54596u,54596u,3289u},{54597u,54603u,17694u},{54604u,54605u,3290u},
+{54606u,54606u,17701u},{54607u,54607u,3292u},{54608u,54608u,17702u},{54609u,54609u,3293u},
+{54610u,54615u,17703u},{54616u,54617u,3294u},{54618u,54619u,17709u},{54620u,54620u,3296u},
+{54621u,54623u,17711u},{54624u,54624u,3297u},{54625u,54628u,17714u},{54629u,54629u,3298u},
+{54630u,54631u,17718u},{54632u,54633u,3299u},{54634u,54634u,17720u},{54635u,54635u,3301u},
+{54636u,54636u,17721u},{54637u,54637u,3302u},{54638u,54643u,17722u},{54644u,54645u,3303u},
+{54646u,54647u,17728u},{54648u,54648u,3305u},{54649u,54651u,17730u},{54652u,54652u,3306u},
+{54653u,54659u,17733u},{54660u,54661u,3307u},{54662u,54662u,17740u},{54663u,54665u,3309u},
+{54666u,54671u,17741u},{54672u,54672u,3312u},{54673u,54692u,17747u},{54693u,54693u,3313u},
+{54694u,54727u,17767u},{54728u,54729u,3314u},{54730u,54731u,17801u},{54732u,54732u,3316u},
+{54733u,54735u,17803u},{54736u,54736u,3317u},{54737u,54737u,17806u},{54738u,54738u,3318u},
+{54739u,54743u,17807u},{54744u,54745u,3319u},{54746u,54746u,17812u},{54747u,54747u,3321u},
+{54748u,54748u,17813u},{54749u,54749u,3322u},{54750u,54755u,17814u},{54756u,54757u,3323u},
+{54758u,54759u,17820u},{54760u,54760u,3325u},{54761u,54763u,17822u},{54764u,54764u,3326u},
+{54765u,54771u,17825u},{54772u,54773u,3327u},{54774u,54774u,17832u},{54775u,54775u,3329u},
+{54776u,54776u,17833u},{54777u,54777u,3330u},{54778u,54783u,17834u},{54784u,54785u,3331u},
+{54786u,54787u,17840u},{54788u,54788u,3333u},{54789u,54791u,17842u},{54792u,54792u,3334u},
+{54793u,54799u,17845u},{54800u,54801u,3335u},{54802u,54802u,17852u},{54803u,54805u,3337u},
+{54806u,54811u,17853u},{54812u,54812u,3340u},{54813u,54815u,17859u},{54816u,54816u,3341u},
+{54817u,54819u,17862u},{54820u,54820u,3342u},{54821u,54828u,17865u},{54829u,54829u,3343u},
+{54830u,54839u,17873u},{54840u,54841u,3344u},{54842u,54843u,17883u},{54844u,54844u,3346u},
+{54845u,54847u,17885u},{54848u,54848u,3347u},{54849u,54852u,17888u},{54853u,54853u,3348u},
+{54854u,54855u,17892u},{54856u,54857u,3349u},{54858u,54858u,17894u},{54859u,54859u,3351u},
+{54860u,54860u,17895u},{54861u,54861u,3352u},{54862u,54864u,17896u},{54865u,54865u,3353u},
+{54866u,54867u,17899u},{54868u,54869u,3354u},{54870u,54871u,17901u},{54872u,54872u,3356u},
+{54873u,54875u,17903u},{54876u,54876u,3357u},{54877u,54886u,17906u},{54887u,54887u,3358u},
+{54888u,54888u,17916u},{54889u,54889u,3359u},{54890u,54895u,17917u},{54896u,54897u,3360u},
+{54898u,54899u,17923u},{54900u,54900u,3362u},{54901u,54914u,17925u},{54915u,54915u,3363u},
+{54916u,54916u,17939u},{54917u,54917u,3364u},{54918u,54923u,17940u},{54924u,54925u,3365u},
+{54926u,54927u,17946u},{54928u,54928u,3367u},{54929u,54931u,17948u},{54932u,54932u,3368u},
+{54933u,54940u,17951u},{54941u,54941u,3369u},{54942u,54942u,17959u},{54943u,54943u,3370u},
+{54944u,54944u,17960u},{54945u,54945u,3371u},{54946u,54951u,17961u},{54952u,54952u,3372u},
+{54953u,54955u,17967u},{54956u,54956u,3373u},{54957u,54959u,17970u},{54960u,54960u,3374u},
+{54961u,54968u,17973u},{54969u,54969u,3375u},{54970u,54970u,17981u},{54971u,54971u,3376u},
+{54972u,54979u,17982u},{54980u,54981u,3377u},{54982u,54983u,17990u},{54984u,54984u,3379u},
+{54985u,54987u,17992u},{54988u,54988u,3380u},{54989u,54992u,17995u},{54993u,54993u,3381u},
+{54994u,54995u,17999u},{54996u,54996u,3382u},{54997u,54998u,18001u},{54999u,54999u,3383u},
+{55000u,55000u,18003u},{55001u,55001u,3384u},{55002u,55007u,18004u},{55008u,55008u,3385u},
+{55009u,55011u,18010u},{55012u,55012u,3386u},{55013u,55015u,18013u},{55016u,55016u,3387u},
+{55017u,55023u,18016u},{55024u,55024u,3388u},{55025u,55028u,18023u},{55029u,55029u,3389u},
+{55030u,55035u,18027u},{55036u,55037u,3390u},{55038u,55039u,18033u},{55040u,55040u,3392u},
+{55041u,55043u,18035u},{55044u,55044u,3393u},{55045u,55056u,18038u},{55057u,55057u,3394u},
+{55058u,55063u,18050u},{55064u,55065u,3395u},{55066u,55067u,18056u},{55068u,55068u,3397u},
+{55069u,55071u,18058u},{55072u,55072u,3398u},{55073u,55079u,18061u},{55080u,55081u,3399u},
+{55082u,55082u,18068u},{55083u,55083u,3401u},{55084u,55084u,18069u},{55085u,55085u,3402u},
+{55086u,55091u,18070u},{55092u,55093u,3403u},{55094u,55095u,18076u},{55096u,55096u,3405u},
+{55097u,55099u,18078u},{55100u,55100u,3406u},{55101u,55107u,18081u},{55108u,55108u,3407u},
+{55109u,55110u,18088u},{55111u,55111u,3408u},{55112u,55112u,18090u},{55113u,55113u,3409u},
+{55114u,55119u,18091u},{55120u,55121u,3410u},{55122u,55123u,18097u},{55124u,55124u,3412u},
+{55125u,55125u,18099u},{55126u,55129u,3413u},{55130u,55135u,18100u},{55136u,55137u,3417u},
+{55138u,55138u,18106u},{55139u,55139u,3419u},{55140u,55140u,18107u},{55141u,55141u,3420u},
+{55142u,55144u,18108u},{55145u,55145u,3421u},{55146u,55147u,18111u},{55148u,55148u,3422u},
+{55149u,55151u,18113u},{55152u,55152u,3423u},{55153u,55155u,18116u},{55156u,55156u,3424u},
+{55157u,55163u,18119u},{55164u,55165u,3425u},{55166u,55168u,18126u},{55169u,55169u,3427u},
+{55170u,55175u,18129u},{55176u,55177u,3428u},{55178u,55179u,18135u},{55180u,55180u,3430u},
+{55181u,55183u,18137u},{55184u,55184u,3431u},{55185u,55191u,18140u},{55192u,55193u,3432u},
+{55194u,55194u,18147u},{55195u,55195u,3434u},{55196u,55196u,18148u},{55197u,55197u,3435u},
+{55198u,55203u,18149u},{63744u,63744u,4116u},{63745u,63745u,3678u},{63746u,63746u,7053u},
+{63747u,63747u,3460u},{63748u,63748u,7900u},{63749u,63749u,3802u},{63750u,63750u,3902u},
+{63751u,63751u,3946u},{63752u,63752u,3946u},{63753u,63753u,3708u},{63754u,63754u,4131u},
+{63755u,63755u,4374u},{63756u,63756u,4156u},{63757u,63763u,4375u},{63764u,63764u,5800u},
+{63765u,63767u,4382u},{63768u,63773u,4386u},{63774u,63776u,4394u},{63777u,63777u,4399u},
+{63778u,63778u,4403u},{63779u,63780u,4406u},{63781u,63787u,4409u},{63788u,63789u,4419u},
+{63790u,63790u,4424u},{63791u,63791u,4511u},{63792u,63793u,4513u},{63794u,63799u,4517u},
+{63800u,63802u,4524u},{63803u,63808u,4528u},{63809u,63811u,4535u},{63812u,63813u,4541u},
+{63814u,63816u,4545u},{63817u,63817u,4550u},{63818u,63818u,4564u},{63819u,63822u,4566u},
+{63823u,63824u,4571u},{63825u,63825u,4576u},{63826u,63829u,4604u},{63830u,63833u,4609u},
+{63834u,63834u,4318u},{63835u,63835u,4136u},{63836u,63836u,5800u},{63837u,63837u,4139u},
+{63838u,63838u,4192u},{63839u,63839u,4167u},{63840u,63840u,4172u},{63841u,63841u,5552u},
+{63842u,63842u,6424u},{63843u,63843u,5151u},{63844u,63844u,4922u},{63845u,63845u,7518u},
+{63846u,63846u,5079u},{63847u,63847u,5109u},{63848u,63848u,7607u},{63849u,63849u,5584u},
+{63850u,63850u,5367u},{63851u,63851u,7083u},{63852u,63852u,5362u},{63853u,63853u,5485u},
+{63854u,63854u,6001u},{63855u,63855u,5460u},{63856u,63856u,5317u},{63857u,63857u,7009u},
+{63858u,63858u,7370u},{63859u,63859u,5678u},{63860u,63860u,5874u},{63861u,63863u,4425u},
+{63864u,63866u,4429u},{63867u,63869u,4435u},{63870u,63870u,4439u},{63871u,63872u,4442u},
+{63873u,63873u,4159u},{63874u,63874u,4444u},{63875u,63875u,4447u},{63876u,63877u,4449u},
+{63878u,63878u,4453u},{63879u,63884u,4455u},{63885u,63885u,4463u},{63886u,63886u,4160u},
+{63887u,63888u,4465u},{63889u,63889u,4161u},{63890u,63892u,4468u},{63893u,63893u,4162u},
+{63894u,63895u,4471u},{63896u,63896u,4474u},{63897u,63897u,4473u},{63898u,63899u,4475u},
+{63900u,63901u,4478u},{63902u,63902u,6447u},{63903u,63904u,4481u},{63905u,63905u,5460u},
+{63906u,63906u,4483u},{63907u,63907u,4163u},{63908u,63908u,4166u},{63909u,63909u,4485u},
+{63910u,63912u,4487u},{63913u,63913u,4491u},{63914u,63914u,4167u},{63915u,63917u,4493u},
+{63918u,63918u,7783u},{63919u,63919u,4497u},{63920u,63920u,4499u},{63921u,63924u,4501u},
+{63925u,63925u,4506u},{63926u,63928u,4508u},{63929u,63929u,5797u},{63930u,63932u,4551u},
+{63933u,63933u,4180u},{63934u,63934u,4555u},{63935u,63935u,5800u},{63936u,63937u,4556u},
+{63938u,63939u,4560u},{63940u,63940u,4563u},{63941u,63941u,7988u},{63942u,63942u,6123u},
+{63943u,63943u,4577u},{63944u,63944u,4183u},{63945u,63945u,4579u},{63946u,63947u,4581u},
+{63948u,63948u,4584u},{63949u,63949u,4586u},{63950u,63950u,4588u},{63951u,63951u,4184u},
+{63952u,63955u,4590u},{63956u,63958u,4595u},{63959u,63962u,4599u},{63963u,63963u,5552u},
+{63964u,63964u,4603u},{63965u,63965u,4614u},{63966u,63966u,4616u},{63967u,63967u,4618u},
+{63968u,63968u,5950u},{63969u,63970u,4620u},{63971u,63971u,4187u},{63972u,63972u,4625u},
+{63973u,63973u,4627u},{63974u,63974u,4629u},{63975u,63977u,4632u},{63978u,63978u,4636u},
+{63979u,63980u,4188u},{63981u,63981u,4638u},{63982u,63984u,4640u},{63985u,63989u,4644u},
+{63990u,63990u,4650u},{63991u,63993u,4653u},{63994u,63994u,5351u},{63995u,63995u,6494u},
+{63996u,63996u,5731u},{63997u,63997u,5771u},{63998u,63998u,4191u},{63999u,63999u,6484u},
+{64000u,64000u,6684u},{64001u,64001u,4279u},{64002u,64002u,7139u},{64003u,64003u,4247u},
+{64004u,64004u,4266u},{64005u,64005u,4340u},{64006u,64006u,7572u},{64007u,64007u,5088u},
+{64008u,64008u,7709u},{64009u,64009u,3558u},{64010u,64010u,3644u},{64011u,64011u,3815u},
+{65281u,65339u,264u},{65340u,65340u,112u},{65341u,65373u,324u},{65374u,65374u,113u},
+{65504u,65505u,143u},{65506u,65506u,194u},{65507u,65507u,357u},{65509u,65509u,145u},
+{65510u,65510u,323u},
+};
+
+static pdf_cmap cmap_UniKS_X = {
+	{-1, pdf_free_cmap_imp}, "UniKS-X", "", 0, 0, 0,
+	{ {0,0,0}, },
+	8369, 8369, (pdf_range*) cmap_UniKS_X_ranges,
+	0, 0, NULL,
+	0, 0, NULL,
+};
@@ -258,6 +258,7 @@ function sumatra_files()
     "TableOfContents.*",
     "Tabs.*",
     "Tester.*",
+    "TextIndex.*",
     "TextSearch.*",
     "TextSelection.*",
     "Theme.*",
@@ -325,6 +326,8 @@ function utils_files()
     "WebpReader.*",
     "WinDynCalls.*",
     "WinUtil.*",
+    "WorkScheduler.*",
+    "WStrFinder.*",
   })
 
   files_in_dir("src/wingui", {
@@ -627,6 +630,8 @@ function test_util_files()
     "Vec.*",
     "WinUtil*",
     "WinDynCalls.*",
+    "WorkScheduler.*",
+    "WStrFinder.*",
     "tests/*"
   })
   files_in_dir("src", {
@@ -635,6 +640,9 @@ function test_util_files()
     "AppUtil.*",
     "ParseCommandLine.*",
     "SettingsStructs.*",
+    "TextIndex*",
+    "TextSearch*",
+    "TextSelection.*",
     "UnitTests.cpp",
     "mui/SvgPath*",
     "tools/test_util.cpp"
@@ -91,9 +91,12 @@ workspace "SumatraPDF"
     language "C++"
     cppdialect "C++17"
 
-    includedirs { "src", "src/utils", "ext/unarr" }
+    -- mupdf's fz_throw and fz_warn pass __FILE__ as char *
+    disablewarnings { "write-strings" }
+    -- ScanConverter_ut.cpp calls the draw device's scan converter directly (see draw-imp.h)
+    includedirs { "src", "src/utils", "ext/unarr", "mupdf/include", "mupdf/source/fitz" }
 
-    links { "unarrlib", "zlib" }
+    links { "unarrlib", "mupdf", "freetype", "jbig2dec", "libjpeg-turbo", "openjpeg", "zlib", "m" }
 
     files {
       "src/utils/Archive.cpp",
@@ -101,5 +104,133 @@ workspace "SumatraPDF"
       "src/utils/FileUtil.cpp",
       "src/utils/StrUtil.cpp",
       "src/utils/UtAssert.cpp",
+      "src/utils/WorkScheduler.cpp",
+      "src/utils/tests/WorkScheduler_ut.cpp",
+      "src/utils/WStrFinder.cpp",
+      "src/utils/tests/WStrFinder_ut.cpp",
       "tools/test_unix/main.cpp",
+      "tools/test_unix/PdfLinear_ut.cpp",
+      "tools/test_unix/ScanConverter_ut.cpp",
+      "tools/test_unix/StextSearch_ut.cpp",
+      "tools/test_unix/DrawBlend_ut.cpp",
+    }
+
+  project "freetype"
+    kind "StaticLib"
+    language "C"
+    defines { "FT2_BUILD_LIBRARY", "FT_OPTION_AUTOFIT2" }
+    warnings "Default"
+    disablewarnings { "unused-function" }
+    includedirs { "ext/freetype2/config", "ext/freetype2/include" }
+    freetype_files()
+
+  project "jbig2dec"
+    kind "StaticLib"
+    language "C"
+    defines { "HAVE_STRING_H=1", "HAVE_STDINT_H=1", "JBIG_NO_MEMENTO" }
+    warnings "Default"
+    disablewarnings { "unused-function" }
+    includedirs { "ext/jbig2dec" }
+    jbig2dec_files()
+
+  project "libjpeg-turbo"
+    kind "StaticLib"
+    language "C"
+    warnings "Default"
+    disablewarnings { "attributes" }
+    includedirs { "ext/libjpeg-turbo" }
+    libjpeg_turbo_files()
+    -- the portable C version instead of the nasm SIMD code
+    removefiles { "ext/libjpeg-turbo/simd/*" }
+    files { "ext/libjpeg-turbo/jsimd_none.c" }
+
+  project "openjpeg"
+    kind "StaticLib"
+    language "C"
+    defines { "USE_JPIP", "OPJ_STATIC", "OPJ_EXPORTS", "OPJ_HAVE_STDINT_H", "OPJ_HAVE_INTTYPES_H" }
+    warnings "Default"
+    disablewarnings { "attributes", "misleading-indentation", "use-after-free" }
+    openjpeg_files()
+    removefiles { "ext/openjpeg/src/lib/openjp2/t1_generate_luts.c" }
+
+  project "libdjvu"
+    kind "StaticLib"
+    language "C++"
+    defines { "NEED_JPEG_DECODER", "THREADMODEL=0", "DDJVUAPI=",  "MINILISPAPI=", "DO_CHANGELOCALE=0", "DEBUGLVL=0" }
+    -- what djvulibre's configure would detect
+    defines { "AUTOCONF", "UNIX", "HAVE_STDINCLUDES", "HAVE_NAMESPACES", "HAVE_BOOL", "HAS_WCHAR", "HAVE_WCHAR_H" }
+    defines { "HAVE_MBSTATE_T", "HAVE_UNISTD_H", "HAVE_DIRENT_H", "HAVE_STRERROR", "HAVE_STDINT_H", "DIR_DATADIR=\"/usr/local/share\"" }
+    exceptionhandling "On"
+    warnings "Default"
+    disablewarnings { "class-memaccess", "deprecated-copy", "misleading-indentation", "parentheses", "register" }
+    disablewarnings { "uninitialized", "maybe-uninitialized", "unused-local-typedefs", "unused-but-set-variable" }
+    includedirs { "ext/libjpeg-turbo" }
+    libdjvu_files()
+
+  -- cmapdump and fontdump generate the headers in mupdf/generated
+  -- (which on Windows is done by scripts/gen_mupdf_generated.bat and font_base14.asm)
+  project "cmapdump"
+    kind "ConsoleApp"
+    language "C"
+    warnings "Default"
+    includedirs { "mupdf/include" }
+    files { "mupdf/scripts/cmapdump.c" }
+
+  project "fontdump"
+    kind "ConsoleApp"
+    language "C"
+    warnings "Default"
+    includedirs { "mupdf/include" }
+    files { "mupdf/scripts/fontdump.c" }
+
+  project "mupdf"
+    kind "StaticLib"
+    language "C"
+    dependson { "cmapdump", "fontdump" }
+    -- for openjpeg, OPJ_STATIC and OPJ_HAVE_STDINT_H are already defined in load-jpx.c
+    defines { "USE_JPIP", "OPJ_EXPORTS", "OPJ_HAVE_INTTYPES_H" }
+    -- NOASMFONTS: fonts are included from gen_font_base14.h instead of font_base14.asm
+    defines { "NOCJKFONT", "SHARE_JPEG", "NOASMFONTS" }
+    warnings "Default"
+    disablewarnings { "comment", "parentheses", "sequence-point", "incompatible-pointer-types", "stringop-overflow" }
+    disablewarnings { "unused-but-set-variable", "unused-function", "unused-variable" }
+    -- fitz accesses fz_rect as fz_point (fz_rect_min/fz_rect_max)
+    buildoptions { "-fno-strict-aliasing" }
+    includedirs { "mupdf/scripts/openjpeg" }
+    includedirs {
+      "mupdf/include", "mupdf/generated", "ext/zlib",
+      "ext/freetype2/config", "ext/freetype2/include",
+      "ext/jbig2dec", "ext/libjpeg-turbo", "ext/openjpeg/src/lib/openjp2"
+    }
+    prebuildcommands {
+      "mkdir -p ../mupdf/generated",
+      "for d in cns gb japan korea; do %{cfg.targetdir}/cmapdump ../mupdf/generated/gen_cmap_$$d.h ../mupdf/resources/cmaps/$$d/*; done",
+      "%{cfg.targetdir}/fontdump ../mupdf/generated/gen_font_base14.h ../mupdf/resources/fonts/urw/*.cff",
+    }
+    mupdf_files()
+    removefiles { "mupdf/font_base14.asm" }
+    files_in_dir("mupdf/source", {
+      "cbz/mucbz.c",
+      "img/muimage.c",
+      "tiff/mutiff.c",
+      "fitz/document-all.c",
+    })
+
+  project "render_unix"
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++17"
+
+    -- mupdf's fz_throw and fz_warn pass __FILE__ as char *
+    disablewarnings { "write-strings" }
+    -- -paint-bench calls the draw device's paint functions directly (see draw-imp.h)
+    includedirs { "src", "src/utils", "mupdf/include", "mupdf/source/fitz", "ext/libdjvu" }
+
+    links { "mupdf", "libdjvu", "freetype", "jbig2dec", "libjpeg-turbo", "openjpeg", "zlib", "m" }
+
+    files {
+      "src/utils/BaseUtil.cpp",
+      "src/utils/StrUtil.cpp",
+      "src/utils/StrUtil_unix.cpp",
+      "tools/render_unix/main.cpp",
     }
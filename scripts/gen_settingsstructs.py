@@ -188,6 +188,11 @@ FixedPageUI = [
 		"colors are supported; the idea behind this experimental feature is that the " +
 		"background might allow to subconsciously determine reading progress; " +
 		"suggested values: #2828aa #28aa28 #aa2828"),
+	Field("ExactAntiAliasing", Bool, False,
+		"if true, filled paths in PDF and XPS documents are anti-aliased by computing the exact area " +
+		"they cover in each pixel (which is faster for pages with many vector graphics). " +
+		"takes effect after re-opening the document",
+		expert=True, version="3.2"),
 	Field("InvertColors", Bool, False,
 		"if true, TextColor and BackgroundColor will be temporarily swapped",
 		internal=True),
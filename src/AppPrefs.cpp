@@ -10,6 +10,7 @@
 
 #include "BaseEngine.h"
 #include "EbookEngine.h"
+#include "PdfEngine.h"
 
 #include "SettingsStructs.h"
 #include "FileHistory.h"
@@ -110,6 +111,7 @@ bool Load() {
     // TODO: verify that all states have a non-nullptr file path?
     gFileHistory.UpdateStatesSource(gGlobalPrefs->fileStates);
     SetDefaultEbookFont(gGlobalPrefs->ebookUI.fontName, gGlobalPrefs->ebookUI.fontSize);
+    SetExactAntiAliasing(gGlobalPrefs->fixedPageUI.exactAntiAliasing);
 
     if (!file::Exists(path.get())) {
         Save();
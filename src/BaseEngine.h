@@ -251,8 +251,19 @@ class BaseEngine {
     // creates a clone of this engine (e.g. for printing on a different thread)
     virtual BaseEngine* Clone() = 0;
 
-    // number of pages the loaded document contains
+    // number of pages the loaded document contains (engines which lay out
+    // pages in the background wait until all pages have been laid out)
     virtual int PageCount() const = 0;
+    // the page count without waiting for the layout to complete (until then an estimate
+    // which may change). Only for callers which handle changes (cf. SetPageCountFinalCallback)
+    virtual int EstimatePageCount() const { return PageCount(); }
+    // returns false if the estimated page count already is exact. Otherwise onFinal is called once
+    // it has become exact, on a background thread (so it mustn't call back into the engine).
+    // Call with nullptr to unregister before destroying the callback's state
+    virtual bool SetPageCountFinalCallback(const std::function<void()>& onFinal) {
+        UNUSED(onFinal);
+        return false;
+    }
 
     // the box containing the visible page content (usually RectD(0, 0, pageWidth, pageHeight))
     virtual RectD PageMediabox(int pageNo) = 0;
@@ -294,6 +305,14 @@ class BaseEngine {
     // caller needs to free() the result and *coordsOut (if coordsOut is non-nullptr)
     virtual WCHAR* ExtractPageText(int pageNo, const WCHAR* lineSep, RectI** coordsOut = nullptr,
                                    RenderTarget target = RenderTarget::View) = 0;
+    // returns false if the page's text doesn't contain text (ignoring the case of ASCII letters
+    // and the kind and amount of whitespace), so that searching can skip the page without
+    // extracting its text as a whole. Returns true if unsure
+    virtual bool PageMightContainText(int pageNo, const WCHAR* text) {
+        UNUSED(pageNo);
+        UNUSED(text);
+        return true;
+    }
     // pages where clipping doesn't help are rendered in larger tiles
     virtual bool HasClipOptimizations(int pageNo) = 0;
     // the layout type this document's author suggests (if the user doesn't care)
@@ -364,6 +383,16 @@ class BaseEngine {
     // without also measuring rendering times
     virtual bool BenchLoadPage(int pageNo) = 0;
 
+    // prepares the given page for rendering (e.g. by caching its parsed content)
+    // so that rendering it soon afterwards is quicker; returns false if the engine
+    // doesn't support prefetching or the page couldn't be loaded
+    virtual bool PrefetchPage(int pageNo) {
+        UNUSED(pageNo);
+        return false;
+    }
+    // limits the memory used for caching parsed page content (if the engine does so)
+    virtual void SetPageCacheBudget(size_t maxBytes) { UNUSED(maxBytes); }
+
     // the name of the file this engine handles
     const WCHAR* FileName() const { return fileName.Get(); }
 
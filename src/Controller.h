@@ -22,8 +22,15 @@ class ControllerCallback {
     virtual void Repaint() = 0;
     virtual void UpdateScrollbars(SizeI canvas) = 0;
     virtual void RequestRendering(int pageNo) = 0;
+    // hint that pages nextPageNo through lastPageNo (in reading direction) are likely
+    // to become visible soon, so that their content can be prepared ahead of time
+    // (nextPageNo == INVALID_PAGE_NO cancels all such pending requests)
+    virtual void PrefetchPages(int nextPageNo, int lastPageNo) = 0;
     virtual void CleanUp(DisplayModel* dm) = 0;
     virtual void RenderThumbnail(DisplayModel* dm, SizeI size, const onBitmapRenderedCb&) = 0;
+    // called on a background thread once the engine's estimated page count has become
+    // exact, so that dm->UpdatePageCount() can be called on the UI thread
+    virtual void PageCountChanged(DisplayModel* dm) = 0;
     // ChmModel //
     // tell the UI to move focus back to the main window
     // (if always == false, then focus is only moved if it's inside
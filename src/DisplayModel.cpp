@@ -61,6 +61,32 @@
 // if true, we pre-render the pages right before and after the visible pages
 static bool gPredictiveRender = true;
 
+// how far ahead page content is prefetched, measured in time scrolling at the current speed
+#define PREFETCH_LOOKAHEAD_MS 1000
+// maximum number of page rows for which content is prefetched
+#define MAX_PREFETCH_ROWS 3
+// scrolling steps further apart are considered to belong to separate scroll gestures
+#define SCROLL_GESTURE_TIMEOUT_MS 500
+// lower and upper limit for the memory an engine may use for caching parsed page content
+#define MIN_PAGE_CONTENT_CACHE_BYTES (64 * 1024 * 1024)
+#ifdef _WIN64
+#define MAX_PAGE_CONTENT_CACHE_BYTES (512 * 1024 * 1024)
+#else
+#define MAX_PAGE_CONTENT_CACHE_BYTES (128 * 1024 * 1024)
+#endif
+
+// use up to 1/32 of the physical memory for a document's cached page content
+// (prefetching is pointless if prefetched pages are evicted before they're shown)
+static size_t GetPageContentCacheBudget() {
+    MEMORYSTATUSEX mem = {0};
+    mem.dwLength = sizeof(mem);
+    if (!GlobalMemoryStatusEx(&mem))
+        return MIN_PAGE_CONTENT_CACHE_BYTES;
+    DWORDLONG budget = limitValue(mem.ullTotalPhys / 32, (DWORDLONG)MIN_PAGE_CONTENT_CACHE_BYTES,
+                                  (DWORDLONG)MAX_PAGE_CONTENT_CACHE_BYTES);
+    return (size_t)budget;
+}
+
 static int ColumnsFromDisplayMode(DisplayMode displayMode) {
     if (!IsSingle(displayMode))
         return 2;
@@ -147,6 +173,8 @@ DisplayModel::DisplayModel(BaseEngine* engine, EngineType type, ControllerCallba
       userAnnotsModified(false),
       engineType(type),
       pdfSync(nullptr),
+      pageCount(0),
+      pageCountFinal(true),
       pagesInfo(nullptr),
       displayMode(DM_AUTOMATIC),
       startPage(1),
@@ -159,8 +187,18 @@ DisplayModel::DisplayModel(BaseEngine* engine, EngineType type, ControllerCallba
       presZoomVirtual(INVALID_ZOOM),
       presDisplayMode(DM_AUTOMATIC),
       navHistoryIx(0),
+      prevFirstVisiblePage(0),
+      prevScrollY(0),
+      prevScrollTime(0),
+      scrollDirection(1),
+      scrollSpeed(0),
       dontRenderFlag(false) {
-    CrashIf(!engine || engine->PageCount() <= 0);
+    CrashIf(!engine);
+    // engines still laying out pages in the background only estimate the page count,
+    // so ask to be notified of the exact count before reading it
+    pageCountFinal = !engine->SetPageCountFinalCallback([this] { cb->PageCountChanged(this); });
+    pageCount = engine->EstimatePageCount();
+    CrashIf(pageCount <= 0);
 
     if (!engine->IsImageCollection()) {
         windowMargin = gGlobalPrefs->fixedPageUI.windowMargin;
@@ -178,13 +216,16 @@ DisplayModel::DisplayModel(BaseEngine* engine, EngineType type, ControllerCallba
     pageSpacing.dy += 4;
 #endif
 
-    textCache = new PageTextCache(engine);
+    engine->SetPageCacheBudget(GetPageContentCacheBudget());
+
+    textCache = new PageTextCache(engine, pageCount);
     textSelection = new TextSelection(engine, textCache);
     textSearch = new TextSearch(engine, textCache);
 }
 
 DisplayModel::~DisplayModel() {
     dontRenderFlag = true;
+    engine->SetPageCountFinalCallback(nullptr);
     cb->CleanUp(this);
 
     delete pdfSync;
@@ -243,7 +284,6 @@ void DisplayModel::SetInitialViewSettings(DisplayMode newDisplayMode, int newSta
 
 void DisplayModel::BuildPagesInfo() {
     AssertCrash(!pagesInfo);
-    int pageCount = PageCount();
     pagesInfo = AllocArray<PageInfo>(pageCount);
 
     RectD defaultRect;
@@ -271,6 +311,38 @@ void DisplayModel::BuildPagesInfo() {
     }
 }
 
+// called on the UI thread while no search is running
+void DisplayModel::UpdatePageCount() {
+    pageCountFinal = true;
+    int newPageCount = engine->EstimatePageCount();
+    if (newPageCount == pageCount || newPageCount <= 0)
+        return;
+
+    ScrollState ss = pagesInfo ? GetScrollState() : ScrollState(startPage, -1, -1);
+    if (ss.page > newPageCount)
+        ss = ScrollState(newPageCount, -1, -1);
+    // rendering requests and cached bitmaps might be for pages which no longer exist
+    cb->CleanUp(this);
+
+    // the text caches are sized for the previous page count
+    delete textSearch;
+    delete textSelection;
+    delete textCache;
+    textCache = new PageTextCache(engine, newPageCount);
+    textSelection = new TextSelection(engine, textCache);
+    textSearch = new TextSearch(engine, textCache);
+
+    pageCount = newPageCount;
+    startPage = std::min(startPage, pageCount);
+    if (!pagesInfo)
+        return; // SetInitialViewSettings hasn't been called yet
+    free(pagesInfo);
+    pagesInfo = nullptr;
+    BuildPagesInfo();
+    Relayout(zoomVirtual, rotation);
+    SetScrollState(ss);
+}
+
 // TODO: a better name e.g. ShouldShow() to better distinguish between
 // before-layout info and after-layout visibility checks
 bool DisplayModel::PageShown(int pageNo) const {
@@ -871,6 +943,57 @@ void DisplayModel::RenderVisibleParts() {
     for (int pageNo = lastVisiblePage; pageNo >= firstVisiblePage; pageNo--) {
         cb->RequestRendering(pageNo);
     }
+
+    if (gPredictiveRender)
+        PrefetchPredictedPages(firstVisiblePage, lastVisiblePage);
+}
+
+/* Guess from the scrolling direction and speed which pages will become visible
+   next and have their content parsed ahead of time (the faster the user scrolls,
+   the more pages are prefetched). Prefetching is restarted after a jump. */
+void DisplayModel::PrefetchPredictedPages(int firstVisiblePage, int lastVisiblePage) {
+    DisplayMode mode = GetDisplayMode();
+    int columns = ColumnsFromDisplayMode(mode);
+    int pageDelta = firstVisiblePage - prevFirstVisiblePage;
+    int scrollDelta = viewPort.y - prevScrollY;
+    if (0 == pageDelta && 0 == scrollDelta)
+        return;
+
+    DWORD now = GetTickCount();
+    DWORD elapsed = now - prevScrollTime;
+    int maxStep = lastVisiblePage - firstVisiblePage + 1 + MAX_PREFETCH_ROWS * columns;
+    if (0 == prevFirstVisiblePage || abs(pageDelta) > maxStep) {
+        // the document has just been opened or the user jumped elsewhere
+        // (e.g. through a link), so assume that reading continues forward
+        scrollDirection = 1;
+        scrollSpeed = 0;
+    } else {
+        // in non-continuous modes the view port is reset when flipping pages
+        if (pageDelta != 0)
+            scrollDirection = pageDelta > 0 ? 1 : -1;
+        else
+            scrollDirection = scrollDelta > 0 ? 1 : -1;
+        if (!IsContinuous(mode) || elapsed >= SCROLL_GESTURE_TIMEOUT_MS)
+            scrollSpeed = 0;
+        else
+            scrollSpeed = (scrollSpeed + abs(scrollDelta) / (float)std::max(elapsed, (DWORD)1)) / 2;
+    }
+    prevFirstVisiblePage = firstVisiblePage;
+    prevScrollY = viewPort.y;
+    prevScrollTime = now;
+
+    int rows = 1;
+    PageInfo* pageInfo = GetPageInfo(firstVisiblePage);
+    int rowDy = pageInfo->pageOnScreen.dy + pageSpacing.dy;
+    if (scrollSpeed > 0 && rowDy > 0)
+        rows += (int)(scrollSpeed * PREFETCH_LOOKAHEAD_MS / rowDy);
+    int count = std::min(rows, MAX_PREFETCH_ROWS) * columns;
+
+    int nextPageNo = scrollDirection > 0 ? lastVisiblePage + 1 : firstVisiblePage - 1;
+    int lastPageNo = limitValue(nextPageNo + scrollDirection * (count - 1), 1, PageCount());
+    if (!ValidPageNo(nextPageNo))
+        nextPageNo = INVALID_PAGE_NO;
+    cb->PrefetchPages(nextPageNo, lastPageNo);
 }
 
 void DisplayModel::SetViewPortSize(SizeI newViewPortSize) {
@@ -1356,10 +1479,13 @@ void DisplayModel::RotateBy(int newRotation) {
 /* Given <region> (in user coordinates ) on page <pageNo>, copies text in that region
  * into a newly allocated buffer (which the caller needs to free()). */
 WCHAR* DisplayModel::GetTextInRegion(int pageNo, RectD region) {
-    RectI* coords;
-    const WCHAR* pageText = textCache->GetData(pageNo, nullptr, &coords);
+    PageTextCache::ReadScope scope(textCache);
+    int pageTextLen;
+    const WCHAR* pageText = textCache->GetData(pageNo, &pageTextLen);
     if (str::IsEmpty(pageText))
         return nullptr;
+    ScopedMem<RectI> coords(AllocArray<RectI>(pageTextLen));
+    textCache->GetCoords(pageNo, 0, pageTextLen, coords);
 
     str::Str<WCHAR> result;
     RectI regionI = region.Round();
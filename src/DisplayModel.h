@@ -62,7 +62,7 @@ class DisplayModel : public Controller {
     // meta data
     const WCHAR* FilePath() const override { return engine->FileName(); }
     const WCHAR* DefaultFileExt() const override { return engine->GetDefaultFileExt(); }
-    int PageCount() const override { return engine->PageCount(); }
+    int PageCount() const override { return pageCount; }
     WCHAR* GetProperty(DocumentProperty prop) override { return engine->GetProperty(prop); }
 
     // page navigation (stateful)
@@ -99,7 +99,7 @@ class DisplayModel : public Controller {
     int GetPageByLabel(const WCHAR* label) const override { return engine->GetPageByLabel(label); }
 
     // common shortcuts
-    bool ValidPageNo(int pageNo) const override { return 1 <= pageNo && pageNo <= engine->PageCount(); }
+    bool ValidPageNo(int pageNo) const override { return 1 <= pageNo && pageNo <= pageCount; }
     bool GoToNextPage() override;
     bool GoToPrevPage(bool toBottom = false) override { return GoToPrevPage(toBottom ? -1 : 0); }
     bool GoToFirstPage() override;
@@ -125,6 +125,10 @@ class DisplayModel : public Controller {
     TextSearch* textSearch;
 
     PageInfo* GetPageInfo(int pageNo) const;
+    // false while the engine's page count is only an estimate
+    bool IsPageCountFinal() const { return pageCountFinal; }
+    // adopts the engine's exact page count (cf. ControllerCallback::PageCountChanged)
+    void UpdatePageCount();
 
     /* current rotation selected by user */
     int GetRotation() const { return rotation; }
@@ -192,6 +196,7 @@ class DisplayModel : public Controller {
     PointI GetContentStart(int pageNo);
     void RecalcVisibleParts();
     void RenderVisibleParts();
+    void PrefetchPredictedPages(int firstVisiblePage, int lastVisiblePage);
     void AddNavPoint();
     RectD GetContentBox(int pageNo, RenderTarget target = RenderTarget::View);
     void CalcZoomVirtual(float zoomVirtual);
@@ -201,6 +206,10 @@ class DisplayModel : public Controller {
 
     BaseEngine* engine;
 
+    /* the engine's page count as of the last call to BuildPagesInfo
+       (it might change once an engine has finished laying out pages) */
+    int pageCount;
+    bool pageCountFinal;
     /* an array of PageInfo, len of array is pageCount */
     PageInfo* pagesInfo;
 
@@ -244,6 +253,16 @@ class DisplayModel : public Controller {
     /* index of the "current" history entry (to be updated on navigation),
        resp. number of Back history entries */
     size_t navHistoryIx;
+
+    /* scroll state as of the previous scrolling step, for predicting which
+       pages are about to become visible (cf. PrefetchPredictedPages) */
+    int prevFirstVisiblePage;
+    int prevScrollY;
+    DWORD prevScrollTime;
+    /* 1 when reading towards the end of the document, -1 when reading backwards */
+    int scrollDirection;
+    /* smoothed scrolling speed in pixels per millisecond */
+    float scrollSpeed;
 };
 
 int NormalizeRotation(int rotation);
@@ -243,6 +243,12 @@ HtmlFormatter* Doc::CreateFormatter(HtmlFormatterArgs* args) const {
     }
 }
 
+EpubParallelFormatter* Doc::CreateParallelFormatter(HtmlFormatterArgs* args, int threadCount) const {
+    if (type != DocType::Epub || threadCount < 2)
+        return nullptr;
+    return new EpubParallelFormatter(args, epubDoc, threadCount);
+}
+
 Doc Doc::CreateFromFile(const WCHAR* filePath) {
     Doc doc;
     if (EpubDoc::IsSupportedFile(filePath)) {
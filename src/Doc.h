@@ -16,6 +16,7 @@ struct ImageData;
 class EbookTocVisitor;
 class HtmlFormatter;
 class HtmlFormatterArgs;
+class EpubParallelFormatter;
 
 enum class DocType { None, Epub, Fb2, Mobi, Pdb };
 enum class DocError { None, Unknown };
@@ -80,6 +81,8 @@ class Doc {
     bool HasToc() const;
     bool ParseToc(EbookTocVisitor* visitor) const;
     HtmlFormatter* CreateFormatter(HtmlFormatterArgs* args) const;
+    // returns nullptr for documents which can't be laid out in parallel
+    EpubParallelFormatter* CreateParallelFormatter(HtmlFormatterArgs* args, int threadCount) const;
 
     static Doc CreateFromFile(const WCHAR* filePath);
     static bool IsSupportedFile(const WCHAR* filePath, bool sniff = false);
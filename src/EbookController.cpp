@@ -11,12 +11,14 @@
 #include "ThreadUtil.h"
 #include "Timer.h"
 #include "TrivialHtmlParser.h"
+#include "WorkScheduler.h"
 
 #include "BaseEngine.h"
 #include "EbookBase.h"
 #include "EbookDoc.h"
 #include "MobiDoc.h"
 #include "HtmlFormatter.h"
+#include "EbookFormatter.h"
 #include "Doc.h"
 
 #include "SettingsStructs.h"
@@ -29,6 +31,9 @@
 //#define NOLOG 0
 #include "DebugLog.h"
 
+// maximum number of threads for laying out a single document
+#define MAX_LAYOUT_THREADS 8
+
 static const WCHAR* GetFontName() {
     // TODO: validate the name?
     return gGlobalPrefs->ebookUI.fontName;
@@ -149,8 +154,12 @@ bool EbookFormattingThread::Format() {
     int totalPageCount = 0;
     formatterArgs->reparseIdx = 0;
     pagesAfterReparseIdx = 0;
-    HtmlFormatter* formatter = doc.CreateFormatter(formatterArgs);
-    for (HtmlPage* pd = formatter->Next(); pd; pd = formatter->Next()) {
+    // EPUB documents are laid out on several threads at once
+    EpubParallelFormatter* parallelFormatter =
+        doc.CreateParallelFormatter(formatterArgs, DefaultWorkerCount(MAX_LAYOUT_THREADS));
+    HtmlFormatter* formatter = parallelFormatter ? nullptr : doc.CreateFormatter(formatterArgs);
+    auto nextPage = [&]() { return parallelFormatter ? parallelFormatter->Next() : formatter->Next(); };
+    for (HtmlPage* pd = nextPage(); pd; pd = nextPage()) {
         if (WasCancelRequested()) {
             // lf("layout cancelled");
             for (int i = 0; i < pageCount; i++) {
@@ -161,6 +170,7 @@ bool EbookFormattingThread::Format() {
             // send a 'finished' message so that the thread object gets deleted
             SendPagesIfNecessary(true, true /* finished */);
             delete formatter;
+            delete parallelFormatter;
             return true;
         }
         pages[pageCount++] = pd;
@@ -180,6 +190,7 @@ bool EbookFormattingThread::Format() {
     }
     SendPagesIfNecessary(true, true /* finished */);
     delete formatter;
+    delete parallelFormatter;
     return false;
 }
 
@@ -14,6 +14,7 @@
 #include "HtmlPullParser.h"
 #include "Mui.h"
 #include "PalmDbReader.h"
+#include "ThreadUtil.h"
 #include "TrivialHtmlParser.h"
 #include "WinUtil.h"
 #include "ZipUtil.h"
@@ -62,12 +63,29 @@ class EbookAbortCookie : public AbortCookie {
     void Abort() override { abort = true; }
 };
 
+class EbookEngine;
+
+// lays out an EbookEngine's pages in the background
+class EbookLayoutThread : public ThreadBase {
+    EbookEngine* engine;
+
+  public:
+    explicit EbookLayoutThread(EbookEngine* engine) : ThreadBase("EbookLayoutThread"), engine(engine) {}
+    ~EbookLayoutThread() override {}
+
+    void Run() override;
+};
+
 class EbookEngine : public BaseEngine {
+    friend class EbookLayoutThread;
+
   public:
     EbookEngine();
     virtual ~EbookEngine();
 
-    int PageCount() const override { return pages ? (int)pages->size() : 0; }
+    int PageCount() const override;
+    int EstimatePageCount() const override;
+    bool SetPageCountFinalCallback(const std::function<void()>& onFinal) override;
 
     RectD PageMediabox(int pageNo) override {
         UNUSED(pageNo);
@@ -128,6 +146,8 @@ class EbookEngine : public BaseEngine {
     }
 
   protected:
+    // pages are laid out on demand and in the background (cf. StartLayout),
+    // so pages, anchors and baseAnchors only grow while pagesAccess is held
     Vec<HtmlPage*>* pages = nullptr;
     Vec<PageAnchor> anchors;
     // contains for each page the last anchor indicating
@@ -143,18 +163,50 @@ class EbookEngine : public BaseEngine {
     RectD pageRect;
     float pageBorder;
 
+    // creates the formatter on the layout thread (only set during StartLayout)
+    std::function<HtmlFormatter*()> newFormatter;
+    bool skipEmptyPages = false;
+    // length of the formatted html, for estimating the page count
+    size_t htmlLen = 0;
+    EbookLayoutThread* layoutThread = nullptr;
+    // signaled by the layout thread after each page and once it's done
+    std::mutex layoutMutex;
+    std::condition_variable layoutProgress;
+    // pagesLaidOut, layoutDone and onPageCountFinal are protected by layoutMutex
+    int pagesLaidOut = 0;
+    bool layoutDone = true;
+    std::function<void()> onPageCountFinal;
+
     void GetTransform(Matrix& m, float zoom, int rotation) {
         GetBaseTransform(m, pageRect.ToGdipRectF(), zoom, rotation);
     }
-    bool ExtractPageAnchors();
+    // lays out the pages on a background thread with a formatter from newFormatter
+    // (which is called on that thread) and waits until the first page is ready
+    bool StartLayout(const std::function<HtmlFormatter*()>& newFormatter, size_t htmlLen,
+                     bool skipEmptyPages = false);
+    // waits until pageNo has been laid out and returns false if the document has fewer pages.
+    // Mustn't be called while holding pagesAccess, as the layout thread needs it
+    bool LayoutPagesUpTo(int pageNo);
+    // waits until all pages have been laid out, which is required before looking at all pages
+    // (e.g. for resolving links) and before using doc outside of the formatter, as the
+    // ebook documents aren't meant to be used on several threads at once
+    void LayoutAllPages() { LayoutPagesUpTo(INT_MAX); }
+    // must be called by destructors before the formatted data is freed
+    void AbortLayout();
+    void AppendPage(HtmlPage* page);
+    void FinishLayout();
+    int ExtrapolatePageCount();
     WCHAR* ExtractFontList();
 
     virtual PageElement* CreatePageLink(DrawInstr* link, RectI rect, int pageNo);
 
+    // returns nullptr for pages beyond the end of the document, which are
+    // requested while EstimatePageCount() still returns a too large estimate.
+    // Mustn't be called while holding pagesAccess (cf. LayoutPagesUpTo)
     Vec<DrawInstr>* GetHtmlPage(int pageNo) {
-        CrashIf(pageNo < 1 || PageCount() < pageNo);
-        if (pageNo < 1 || PageCount() < pageNo)
+        if (pageNo < 1 || !LayoutPagesUpTo(pageNo))
             return nullptr;
+        ScopedCritSec scope(&pagesAccess);
         return &pages->at(pageNo - 1)->instructions;
     }
 };
@@ -248,6 +300,8 @@ EbookEngine::EbookEngine() {
 }
 
 EbookEngine::~EbookEngine() {
+    AbortLayout();
+
     EnterCriticalSection(&pagesAccess);
 
     if (pages)
@@ -258,28 +312,124 @@ EbookEngine::~EbookEngine() {
     DeleteCriticalSection(&pagesAccess);
 }
 
-bool EbookEngine::ExtractPageAnchors() {
+// the page count is only known once all pages have been laid out
+int EbookEngine::PageCount() const {
+    EbookEngine* self = const_cast<EbookEngine*>(this);
+    self->LayoutAllPages();
+    ScopedCritSec scope(&self->pagesAccess);
+    return self->pages ? (int)self->pages->size() : 0;
+}
+
+// until all pages have been laid out, this returns an estimate (cf. SetPageCountFinalCallback)
+int EbookEngine::EstimatePageCount() const {
+    return const_cast<EbookEngine*>(this)->ExtrapolatePageCount();
+}
+
+int EbookEngine::ExtrapolatePageCount() {
+    bool done;
+    {
+        std::lock_guard<std::mutex> lock(layoutMutex);
+        done = layoutDone;
+    }
     ScopedCritSec scope(&pagesAccess);
+    if (!pages)
+        return 0;
+    int count = (int)pages->size();
+    int reparseIdx = count > 0 ? pages->Last()->reparseIdx : 0;
+    if (done || reparseIdx <= 0)
+        return count;
+    // extrapolate from the amount of html consumed by the pages before the last one
+    int estimate = (int)((count - 1) * (double)htmlLen / reparseIdx) + 1;
+    return std::max(count, estimate);
+}
 
-    DrawInstr* baseAnchor = nullptr;
-    for (int pageNo = 1; pageNo <= PageCount(); pageNo++) {
-        Vec<DrawInstr>* pageInstrs = GetHtmlPage(pageNo);
-        if (!pageInstrs)
-            return false;
+bool EbookEngine::SetPageCountFinalCallback(const std::function<void()>& onFinal) {
+    std::lock_guard<std::mutex> lock(layoutMutex);
+    onPageCountFinal = layoutDone ? nullptr : onFinal;
+    return !layoutDone;
+}
 
-        for (size_t k = 0; k < pageInstrs->size(); k++) {
-            DrawInstr* i = &pageInstrs->at(k);
-            if (InstrAnchor != i->type)
-                continue;
-            anchors.Append(PageAnchor(i, pageNo));
-            if (k < 2 && str::StartsWith(i->str.s + i->str.len, "\" page_marker />"))
-                baseAnchor = i;
-        }
-        baseAnchors.Append(baseAnchor);
+bool EbookEngine::StartLayout(const std::function<HtmlFormatter*()>& newFormatter, size_t htmlLen,
+                              bool skipEmptyPages) {
+    CrashIf(pages || layoutThread);
+    pages = new Vec<HtmlPage*>();
+    this->newFormatter = newFormatter;
+    this->htmlLen = htmlLen;
+    this->skipEmptyPages = skipEmptyPages;
+    layoutDone = false;
+
+    // show the first page as soon as possible and lay out the others in the background
+    layoutThread = new EbookLayoutThread(this);
+    layoutThread->Start();
+    bool ok = LayoutPagesUpTo(1);
+    // the formatter has been created by now, and newFormatter
+    // may refer to the caller's arguments which are about to go away
+    this->newFormatter = nullptr;
+    return ok;
+}
+
+bool EbookEngine::LayoutPagesUpTo(int pageNo) {
+    std::unique_lock<std::mutex> lock(layoutMutex);
+    layoutProgress.wait(lock, [&] { return pagesLaidOut >= pageNo || layoutDone; });
+    return pageNo <= pagesLaidOut;
+}
+
+void EbookEngine::AbortLayout() {
+    if (layoutThread) {
+        layoutThread->RequestCancel();
+        layoutThread->Join();
+        delete layoutThread;
+        layoutThread = nullptr;
     }
+}
+
+// adds a newly laid out page and indexes its anchors
+void EbookEngine::AppendPage(HtmlPage* page) {
+    ScopedCritSec scope(&pagesAccess);
+    pages->Append(page);
+    int pageNo = (int)pages->size();
+
+    // the most recent break between two merged documents applies to all following pages
+    DrawInstr* baseAnchor = baseAnchors.size() > 0 ? baseAnchors.Last() : nullptr;
+    Vec<DrawInstr>* pageInstrs = &page->instructions;
+    for (size_t k = 0; k < pageInstrs->size(); k++) {
+        DrawInstr* i = &pageInstrs->at(k);
+        if (InstrAnchor != i->type)
+            continue;
+        anchors.Append(PageAnchor(i, pageNo));
+        if (k < 2 && str::StartsWith(i->str.s + i->str.len, "\" page_marker />"))
+            baseAnchor = i;
+    }
+    baseAnchors.Append(baseAnchor);
 
     CrashIf(baseAnchors.size() != pages->size());
-    return true;
+
+    std::lock_guard<std::mutex> lock(layoutMutex);
+    pagesLaidOut = pageNo;
+    layoutProgress.notify_all();
+}
+
+void EbookEngine::FinishLayout() {
+    std::lock_guard<std::mutex> lock(layoutMutex);
+    layoutDone = true;
+    layoutProgress.notify_all();
+    if (onPageCountFinal)
+        onPageCountFinal();
+    onPageCountFinal = nullptr;
+}
+
+void EbookLayoutThread::Run() {
+    // the formatter's GDI+ objects mustn't be shared between threads,
+    // so it's created, used and deleted on this thread only
+    HtmlFormatter* formatter = engine->newFormatter();
+    while (!WasCancelRequested()) {
+        HtmlPage* page = formatter->Next(engine->skipEmptyPages);
+        if (!page)
+            break;
+        engine->AppendPage(page);
+    }
+    delete formatter;
+    engine->FinishLayout();
 }
 
 PointD EbookEngine::Transform(PointD pt, int pageNo, float zoom, int rotation, bool inverse) {
@@ -387,11 +537,14 @@ RenderedBitmap* EbookEngine::RenderBitmap(int pageNo, float zoom, int rotation,
     if (cookieOut)
         *cookieOut = cookie = new EbookAbortCookie();
 
+    Vec<DrawInstr>* pageInstrs = GetHtmlPage(pageNo);
     ScopedCritSec scope(&pagesAccess);
 
     mui::ITextRender* textDraw = mui::TextRenderGdiplus::Create(&g);
-    DrawHtmlPage(&g, textDraw, GetHtmlPage(pageNo), pageBorder, pageBorder, false, Color((ARGB)Color::Black),
-                 cookie ? &cookie->abort : nullptr);
+    if (pageInstrs) {
+        DrawHtmlPage(&g, textDraw, pageInstrs, pageBorder, pageBorder, false, Color((ARGB)Color::Black),
+                     cookie ? &cookie->abort : nullptr);
+    }
     DrawAnnotations(g, userAnnots, pageNo);
     delete textDraw;
     DeleteDC(hDC);
@@ -413,13 +566,15 @@ static RectI GetInstrBbox(DrawInstr& instr, float pageBorder) {
 
 WCHAR* EbookEngine::ExtractPageText(int pageNo, const WCHAR* lineSep, RectI** coordsOut, RenderTarget target) {
     UNUSED(target);
+    Vec<DrawInstr>* pageInstrs = GetHtmlPage(pageNo);
+    if (!pageInstrs)
+        return nullptr;
     ScopedCritSec scope(&pagesAccess);
 
     str::Str<WCHAR> content;
     Vec<RectI> coords;
     bool insertSpace = false;
 
-    Vec<DrawInstr>* pageInstrs = GetHtmlPage(pageNo);
     for (DrawInstr& i : *pageInstrs) {
         RectI bbox = GetInstrBbox(i, pageBorder);
         switch (i.type) {
@@ -497,6 +652,8 @@ void EbookEngine::UpdateUserAnnotations(Vec<PageAnnotation>* list) {
 }
 
 PageElement* EbookEngine::CreatePageLink(DrawInstr* link, RectI rect, int pageNo) {
+    LayoutAllPages();
+
     AutoFreeW url(str::conv::FromHtmlUtf8(link->str.s, link->str.len));
     if (url::IsAbsolute(url)) {
         return new EbookLink(link, rect, nullptr, pageNo);
@@ -518,9 +675,11 @@ PageElement* EbookEngine::CreatePageLink(DrawInstr* link, RectI rect, int pageNo
 }
 
 Vec<PageElement*>* EbookEngine::GetElements(int pageNo) {
+    Vec<DrawInstr>* pageInstrs = GetHtmlPage(pageNo);
+    if (!pageInstrs)
+        return nullptr;
     Vec<PageElement*>* els = new Vec<PageElement*>();
 
-    Vec<DrawInstr>* pageInstrs = GetHtmlPage(pageNo);
     for (DrawInstr& i : *pageInstrs) {
         if (InstrImage == i.type) {
             els->Append(new ImageDataElement(pageNo, &i.img, GetInstrBbox(i, pageBorder)));
@@ -554,6 +713,8 @@ PageElement* EbookEngine::GetElementAtPos(int pageNo, PointD pt) {
 }
 
 PageDestination* EbookEngine::GetNamedDest(const WCHAR* name) {
+    LayoutAllPages();
+
     OwnedData name_utf8(str::conv::ToUtf8(name));
     const char* id = name_utf8.Get();
     if (str::FindChar(id, '#'))
@@ -604,6 +765,7 @@ PageDestination* EbookEngine::GetNamedDest(const WCHAR* name) {
 }
 
 WCHAR* EbookEngine::ExtractFontList() {
+    LayoutAllPages();
     ScopedCritSec scope(&pagesAccess);
 
     Vec<mui::CachedFont*> seenFonts;
@@ -741,6 +903,7 @@ class EpubEngineImpl : public EbookEngine {
 };
 
 EpubEngineImpl::~EpubEngineImpl() {
+    AbortLayout();
     delete doc;
     if (stream)
         stream->Release();
@@ -779,11 +942,7 @@ bool EpubEngineImpl::FinishLoading() {
     args.textAllocator = &allocator;
     args.textRenderMethod = mui::TextRenderMethodGdiplusQuick;
 
-    pages = EpubFormatter(&args, doc).FormatAllPages(false);
-    if (!ExtractPageAnchors())
-        return false;
-
-    return pages->size() > 0;
+    return StartLayout([&] { return new EpubFormatter(&args, doc); }, args.htmlStr.size());
 }
 
 u8* EpubEngineImpl::GetFileData(size_t* cbCount) {
@@ -814,6 +973,7 @@ PageLayoutType EpubEngineImpl::PreferredLayout() {
 }
 
 DocTocItem* EpubEngineImpl::GetTocTree() {
+    LayoutAllPages();
     EbookTocBuilder builder(this);
     doc->ParseToc(&builder);
     EbookTocItem* root = builder.GetRoot();
@@ -866,7 +1026,10 @@ BaseEngine* CreateFromStream(IStream* stream) {
 class Fb2EngineImpl : public EbookEngine {
   public:
     Fb2EngineImpl() : EbookEngine(), doc(nullptr) {}
-    virtual ~Fb2EngineImpl() { delete doc; }
+    virtual ~Fb2EngineImpl() {
+        AbortLayout();
+        delete doc;
+    }
     BaseEngine* Clone() override { return fileName ? CreateFromFile(fileName) : nullptr; }
 
     WCHAR* GetProperty(DocumentProperty prop) override {
@@ -913,15 +1076,11 @@ bool Fb2EngineImpl::FinishLoading() {
     args.textAllocator = &allocator;
     args.textRenderMethod = mui::TextRenderMethodGdiplusQuick;
 
-    pages = Fb2Formatter(&args, doc).FormatAllPages(false);
-    if (!ExtractPageAnchors()) {
-        return false;
-    }
-
-    return pages->size() > 0;
+    return StartLayout([&] { return new Fb2Formatter(&args, doc); }, args.htmlStr.size());
 }
 
 DocTocItem* Fb2EngineImpl::GetTocTree() {
+    LayoutAllPages();
     EbookTocBuilder builder(this);
     doc->ParseToc(&builder);
     EbookTocItem* root = builder.GetRoot();
@@ -972,7 +1131,10 @@ BaseEngine* CreateFromStream(IStream* stream) {
 class MobiEngineImpl : public EbookEngine {
   public:
     MobiEngineImpl() : EbookEngine(), doc(nullptr) {}
-    ~MobiEngineImpl() override { delete doc; }
+    ~MobiEngineImpl() override {
+        AbortLayout();
+        delete doc;
+    }
     BaseEngine* Clone() override { return fileName ? CreateFromFile(fileName) : nullptr; }
 
     WCHAR* GetProperty(DocumentProperty prop) override {
@@ -1020,12 +1182,7 @@ bool MobiEngineImpl::FinishLoading() {
     args.textAllocator = &allocator;
     args.textRenderMethod = mui::TextRenderMethodGdiplusQuick;
 
-    pages = MobiFormatter(&args, doc).FormatAllPages();
-    if (!ExtractPageAnchors()) {
-        return false;
-    }
-
-    return pages->size() > 0;
+    return StartLayout([&] { return new MobiFormatter(&args, doc); }, args.htmlStr.size(), true);
 }
 
 PageDestination* MobiEngineImpl::GetNamedDest(const WCHAR* name) {
@@ -1033,6 +1190,7 @@ PageDestination* MobiEngineImpl::GetNamedDest(const WCHAR* name) {
     if (filePos < 0 || 0 == filePos && *name != '0') {
         return nullptr;
     }
+    LayoutAllPages();
     int pageNo;
     for (pageNo = 1; pageNo < PageCount(); pageNo++) {
         if (pages->at(pageNo)->reparseIdx > filePos) {
@@ -1048,7 +1206,6 @@ PageDestination* MobiEngineImpl::GetNamedDest(const WCHAR* name) {
         return nullptr;
     }
 
-    ScopedCritSec scope(&pagesAccess);
     Vec<DrawInstr>* pageInstrs = GetHtmlPage(pageNo);
     // link to the bottom of the page, if filePos points
     // beyond the last visible DrawInstr of a page
@@ -1066,6 +1223,7 @@ PageDestination* MobiEngineImpl::GetNamedDest(const WCHAR* name) {
 }
 
 DocTocItem* MobiEngineImpl::GetTocTree() {
+    LayoutAllPages();
     EbookTocBuilder builder(this);
     doc->ParseToc(&builder);
     EbookTocItem* root = builder.GetRoot();
@@ -1113,7 +1271,10 @@ BaseEngine* CreateFromStream(IStream* stream) {
 class PdbEngineImpl : public EbookEngine {
   public:
     PdbEngineImpl() : EbookEngine(), doc(nullptr) {}
-    virtual ~PdbEngineImpl() { delete doc; }
+    virtual ~PdbEngineImpl() {
+        AbortLayout();
+        delete doc;
+    }
     BaseEngine* Clone() override { return fileName ? CreateFromFile(fileName) : nullptr; }
 
     WCHAR* GetProperty(DocumentProperty prop) override {
@@ -1148,14 +1309,11 @@ bool PdbEngineImpl::Load(const WCHAR* fileName) {
     args.textAllocator = &allocator;
     args.textRenderMethod = mui::TextRenderMethodGdiplusQuick;
 
-    pages = HtmlFormatter(&args).FormatAllPages();
-    if (!ExtractPageAnchors())
-        return false;
-
-    return pages->size() > 0;
+    return StartLayout([&] { return new HtmlFormatter(&args); }, args.htmlStr.size(), true);
 }
 
 DocTocItem* PdbEngineImpl::GetTocTree() {
+    LayoutAllPages();
     EbookTocBuilder builder(this);
     doc->ParseToc(&builder);
     return builder.GetRoot();
@@ -1307,6 +1465,7 @@ class ChmEngineImpl : public EbookEngine {
         pageRect = RectD(0, 0, 8.27 * GetFileDPI(), 11.693 * GetFileDPI());
     }
     virtual ~ChmEngineImpl() {
+        AbortLayout();
         delete dataCache;
         delete doc;
     }
@@ -1443,11 +1602,7 @@ bool ChmEngineImpl::Load(const WCHAR* fileName) {
     args.textAllocator = &allocator;
     args.textRenderMethod = mui::TextRenderMethodGdiplusQuick;
 
-    pages = ChmFormatter(&args, dataCache).FormatAllPages(false);
-    if (!ExtractPageAnchors())
-        return false;
-
-    return pages->size() > 0;
+    return StartLayout([&] { return new ChmFormatter(&args, dataCache); }, args.htmlStr.size());
 }
 
 PageDestination* ChmEngineImpl::GetNamedDest(const WCHAR* name) {
@@ -1466,6 +1621,7 @@ PageDestination* ChmEngineImpl::GetNamedDest(const WCHAR* name) {
 }
 
 DocTocItem* ChmEngineImpl::GetTocTree() {
+    LayoutAllPages();
     EbookTocBuilder builder(this);
     doc->ParseToc(&builder);
     if (doc->HasIndex()) {
@@ -1514,6 +1670,7 @@ PageElement* ChmEngineImpl::CreatePageLink(DrawInstr* link, RectI rect, int page
 }
 
 bool ChmEngineImpl::SaveEmbedded(LinkSaverUI& saveUI, const char* path) {
+    LayoutAllPages();
     size_t len;
     ScopedMem<unsigned char> data(doc->GetData(path, &len));
     if (!data)
@@ -1551,7 +1708,10 @@ class HtmlEngineImpl : public EbookEngine {
         // ISO 216 A4 (210mm x 297mm)
         pageRect = RectD(0, 0, 8.27 * GetFileDPI(), 11.693 * GetFileDPI());
     }
-    virtual ~HtmlEngineImpl() { delete doc; }
+    virtual ~HtmlEngineImpl() {
+        AbortLayout();
+        delete doc;
+    }
     BaseEngine* Clone() override { return fileName ? CreateFromFile(fileName) : nullptr; }
 
     WCHAR* GetProperty(DocumentProperty prop) override {
@@ -1586,11 +1746,7 @@ bool HtmlEngineImpl::Load(const WCHAR* fileName) {
     args.textAllocator = &allocator;
     args.textRenderMethod = mui::TextRenderMethodGdiplus;
 
-    pages = HtmlFileFormatter(&args, doc).FormatAllPages(false);
-    if (!ExtractPageAnchors())
-        return false;
-
-    return pages->size() > 0;
+    return StartLayout([&] { return new HtmlFileFormatter(&args, doc); }, args.htmlStr.size());
 }
 
 class RemoteHtmlDest : public SimpleDest2 {
@@ -1651,7 +1807,10 @@ class TxtEngineImpl : public EbookEngine {
         // ISO 216 A4 (210mm x 297mm)
         pageRect = RectD(0, 0, 8.27 * GetFileDPI(), 11.693 * GetFileDPI());
     }
-    virtual ~TxtEngineImpl() { delete doc; }
+    virtual ~TxtEngineImpl() {
+        AbortLayout();
+        delete doc;
+    }
     BaseEngine* Clone() override { return fileName ? CreateFromFile(fileName) : nullptr; }
 
     WCHAR* GetProperty(DocumentProperty prop) override {
@@ -1692,14 +1851,11 @@ bool TxtEngineImpl::Load(const WCHAR* fileName) {
     args.textAllocator = &allocator;
     args.textRenderMethod = mui::TextRenderMethodGdiplus;
 
-    pages = TxtFormatter(&args).FormatAllPages(false);
-    if (!ExtractPageAnchors())
-        return false;
-
-    return pages->size() > 0;
+    return StartLayout([&] { return new TxtFormatter(&args); }, args.htmlStr.size());
 }
 
 DocTocItem* TxtEngineImpl::GetTocTree() {
+    LayoutAllPages();
     EbookTocBuilder builder(this);
     doc->ParseToc(&builder);
     return builder.GetRoot();
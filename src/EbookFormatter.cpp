@@ -214,6 +214,144 @@ bool EpubFormatter::IgnoreText() {
     return hiddenDepth > 0 || HtmlFormatter::IgnoreText();
 }
 
+void* SerializedAllocator::Alloc(size_t size) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return Allocator::Alloc(allocator, size);
+}
+
+void* SerializedAllocator::Realloc(void* mem, size_t size) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return Allocator::Realloc(allocator, mem, size);
+}
+
+void SerializedAllocator::Free(void* mem) {
+    std::lock_guard<std::mutex> lock(mutex);
+    Allocator::Free(allocator, mem);
+}
+
+/* parallel layout of EPUB documents */
+
+// chunks smaller than this aren't worth the overhead of another formatter
+#define MIN_EPUB_CHUNK_SIZE (32 * 1024)
+// number of chunks per thread (more chunks balance better between threads,
+// fewer chunks mean fewer fresh formatters which can't reuse any state)
+#define EPUB_CHUNKS_PER_THREAD 4
+
+// inserted by EpubDoc::Load at the start of every spine document
+static const char* gEpubPageMarker = "<pagebreak page_path=\"";
+
+struct EpubLayoutChunk {
+    // range of the html to lay out
+    int startIdx;
+    int endIdx;
+    // pages laid out but not returned yet (only used for chunks after the first one)
+    Vec<HtmlPage*> pages;
+    bool done;
+
+    EpubLayoutChunk(int startIdx, int endIdx) : startIdx(startIdx), endIdx(endIdx), done(false) {}
+    ~EpubLayoutChunk() { DeleteVecMembers(pages); }
+};
+
+EpubParallelFormatter::EpubParallelFormatter(HtmlFormatterArgs* args, EpubDoc* doc, int threadCount)
+    : args(args),
+      epubDoc(doc),
+      textAllocator(args->textAllocator),
+      currChunk(0),
+      firstFormatter(nullptr),
+      nextChunk(1),
+      cancel(false) {
+    CrashIf(threadCount < 2);
+    std::string_view html = args->htmlStr;
+    size_t htmlLen = html.size();
+    size_t startIdx = (size_t)args->reparseIdx;
+    size_t chunkSize = (htmlLen - startIdx) / (threadCount * EPUB_CHUNKS_PER_THREAD);
+    chunkSize = std::max(chunkSize, (size_t)MIN_EPUB_CHUNK_SIZE);
+
+    // split the html at the page markers, so that chunks are roughly of chunkSize
+    while (startIdx < htmlLen) {
+        size_t endIdx = htmlLen;
+        if (htmlLen - startIdx > chunkSize)
+            endIdx = html.find(gEpubPageMarker, startIdx + chunkSize);
+        if (std::string_view::npos == endIdx)
+            endIdx = htmlLen;
+        chunks.Append(new EpubLayoutChunk((int)startIdx, (int)endIdx));
+        startIdx = endIdx;
+    }
+
+    // the first chunk is laid out by Next() itself
+    int workerCount = std::min(threadCount - 1, (int)chunks.size() - 1);
+    for (int i = 0; i < workerCount; i++) {
+        workers.push_back(std::thread([this] { LayoutChunks(); }));
+    }
+}
+
+EpubParallelFormatter::~EpubParallelFormatter() {
+    cancel = true;
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    delete firstFormatter;
+    DeleteVecMembers(chunks);
+}
+
+// formatters measure text on the thread they've been created on,
+// so this must be called on the thread which lays out the chunk
+HtmlFormatter* EpubParallelFormatter::CreateChunkFormatter(EpubLayoutChunk* chunk) {
+    HtmlFormatterArgs chunkArgs;
+    chunkArgs.pageDx = args->pageDx;
+    chunkArgs.pageDy = args->pageDy;
+    chunkArgs.SetFontName(args->GetFontName());
+    chunkArgs.fontSize = args->fontSize;
+    chunkArgs.textAllocator = &textAllocator;
+    chunkArgs.textRenderMethod = args->textRenderMethod;
+    // keep reparseIdx relative to the whole html
+    chunkArgs.htmlStr = args->htmlStr.substr(0, chunk->endIdx);
+    chunkArgs.reparseIdx = chunk->startIdx;
+    return new EpubFormatter(&chunkArgs, epubDoc);
+}
+
+// called on the worker threads
+void EpubParallelFormatter::LayoutChunks() {
+    for (size_t i = nextChunk++; i < chunks.size() && !cancel; i = nextChunk++) {
+        EpubLayoutChunk* chunk = chunks.at(i);
+        HtmlFormatter* formatter = CreateChunkFormatter(chunk);
+        for (HtmlPage* page = formatter->Next(); page; page = formatter->Next()) {
+            std::lock_guard<std::mutex> lock(mutex);
+            chunk->pages.Append(page);
+            pageAdded.notify_all();
+            if (cancel)
+                break;
+        }
+        delete formatter;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        chunk->done = true;
+        pageAdded.notify_all();
+    }
+}
+
+HtmlPage* EpubParallelFormatter::Next() {
+    while (currChunk < chunks.size()) {
+        EpubLayoutChunk* chunk = chunks.at(currChunk);
+        if (0 == currChunk) {
+            if (!firstFormatter)
+                firstFormatter = CreateChunkFormatter(chunk);
+            HtmlPage* page = firstFormatter->Next();
+            if (page)
+                return page;
+            delete firstFormatter;
+            firstFormatter = nullptr;
+        } else {
+            std::unique_lock<std::mutex> lock(mutex);
+            pageAdded.wait(lock, [chunk] { return chunk->pages.size() > 0 || chunk->done; });
+            if (chunk->pages.size() > 0)
+                return chunk->pages.PopAt(0);
+        }
+        currChunk++;
+    }
+    return nullptr;
+}
+
 /* FictionBook-specific formatting methods */
 
 Fb2Formatter::Fb2Formatter(HtmlFormatterArgs* args, Fb2Doc* doc)
@@ -1,6 +1,12 @@
 /* Copyright 2018 the SumatraPDF project authors (see AUTHORS file).
    License: GPLv3 */
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 /* formatting extensions for Mobi */
 
 class MobiDoc;
@@ -39,6 +45,53 @@ class EpubFormatter : public HtmlFormatter {
     EpubFormatter(HtmlFormatterArgs* args, EpubDoc* doc) : HtmlFormatter(args), epubDoc(doc), hiddenDepth(0) {}
 };
 
+// makes an Allocator usable from several threads at once
+class SerializedAllocator : public Allocator {
+    Allocator* allocator;
+    std::mutex mutex;
+
+  public:
+    explicit SerializedAllocator(Allocator* allocator) : allocator(allocator) {}
+
+    void* Alloc(size_t size) override;
+    void* Realloc(void* mem, size_t size) override;
+    void Free(void* mem) override;
+};
+
+struct EpubLayoutChunk;
+
+// Lays out an EPUB document with several EpubFormatters at once. Every document of the
+// EPUB spine starts on a new page and brings its own style sheets, so the html is split
+// at the page markers between them into chunks which are laid out independently. Next()
+// returns the pages in document order (and the first chunk is laid out on the calling
+// thread, so that its first pages are available as quickly as from an EpubFormatter).
+class EpubParallelFormatter {
+    HtmlFormatterArgs* args;
+    EpubDoc* epubDoc;
+    SerializedAllocator textAllocator;
+
+    Vec<EpubLayoutChunk*> chunks;
+    size_t currChunk;
+    HtmlFormatter* firstFormatter;
+
+    // protects the pages of all chunks but the first one
+    std::mutex mutex;
+    std::condition_variable pageAdded;
+    std::atomic<size_t> nextChunk;
+    std::atomic<bool> cancel;
+    std::vector<std::thread> workers;
+
+    HtmlFormatter* CreateChunkFormatter(EpubLayoutChunk* chunk);
+    void LayoutChunks();
+
+  public:
+    // args must remain valid for the lifetime of the EpubParallelFormatter
+    EpubParallelFormatter(HtmlFormatterArgs* args, EpubDoc* doc, int threadCount);
+    ~EpubParallelFormatter();
+
+    HtmlPage* Next();
+};
+
 /* formatting extensions for FictionBook */
 
 class Fb2Doc;
@@ -8,6 +8,8 @@
 #include "GdiPlusUtil.h"
 #include "MiniMui.h"
 #include "TgaReader.h"
+#include "ThreadUtil.h"
+#include "Timer.h"
 #include "WinUtil.h"
 
 #include "BaseEngine.h"
@@ -406,6 +408,73 @@ bool RenderDocument(BaseEngine* engine, const WCHAR* renderPath, float zoom = 1.
     return success;
 }
 
+class BenchRenderThread : public ThreadBase {
+    BaseEngine* engine;
+    int pageCount;
+    float zoom;
+    LONG* nextPageNo;
+
+  public:
+    bool success;
+
+    BenchRenderThread(BaseEngine* engine, int pageCount, float zoom, LONG* nextPageNo)
+        : ThreadBase("BenchRenderThread"),
+          engine(engine),
+          pageCount(pageCount),
+          zoom(zoom),
+          nextPageNo(nextPageNo),
+          success(true) {}
+    ~BenchRenderThread() override {}
+
+    void Run() override {
+        int pageNo;
+        while ((pageNo = InterlockedIncrement(nextPageNo)) <= pageCount) {
+            RenderedBitmap* bmp = engine->RenderBitmap(pageNo, zoom, 0);
+            success &= bmp != nullptr;
+            delete bmp;
+        }
+    }
+};
+
+// renders pages 1 to pageCount with the given number of threads,
+// returns the elapsed time in milliseconds
+static double BenchRenderPass(BaseEngine* engine, int threads, int pageCount, float zoom, bool& success) {
+    LONG nextPageNo = 0;
+    Vec<BenchRenderThread*> workers;
+    Timer t;
+    for (int i = 0; i < threads; i++) {
+        workers.Append(new BenchRenderThread(engine, pageCount, zoom, &nextPageNo));
+        workers.Last()->Start();
+    }
+    for (BenchRenderThread* worker : workers) {
+        worker->Join();
+        success &= worker->success;
+        delete worker;
+    }
+    return t.Stop();
+}
+
+// renders the same pages with 1, 2, 4, ... maxThreads threads in order
+// to measure how well an engine scales (only meant for profiling)
+bool BenchRenderThreads(BaseEngine* engine, int maxThreads, float zoom = 1.f) {
+    // limit the number of pages so that all their display lists can stay
+    // cached and mostly the rasterization is measured
+    int pageCount = std::min(engine->PageCount(), 8);
+    bool success = true;
+    // warm up the caches first
+    BenchRenderPass(engine, 1, pageCount, zoom, success);
+    double singleMs = 0;
+    for (int threads = 1;; threads = std::min(threads * 2, maxThreads)) {
+        double ms = BenchRenderPass(engine, threads, pageCount, zoom, success);
+        if (1 == threads)
+            singleMs = ms;
+        Out("threads: %d, pages: %d, %.2f ms (%.2fx)\n", threads, pageCount, ms, ms > 0 ? singleMs / ms : 0);
+        if (threads >= maxThreads)
+            break;
+    }
+    return success;
+}
+
 class PasswordHolder : public PasswordUI {
     const WCHAR* password;
 
@@ -431,7 +500,8 @@ int main(int argc, char** argv) {
     ParseCmdLine(GetCommandLine(), argList);
     if (argList.size() < 2) {
     Usage:
-        ErrOut("%s [-pwd <password>][-quick][-render <path-%%d.tga>] <filename>", path::GetBaseName(argList.at(0)));
+        ErrOut("%s [-pwd <password>][-quick][-render <path-%%d.tga>][-bench-threads <n>] <filename>",
+               path::GetBaseName(argList.at(0)));
         return 2;
     }
 
@@ -441,6 +511,7 @@ int main(int argc, char** argv) {
     WCHAR* renderPath = nullptr;
     float renderZoom = 1.f;
     bool loadOnly = false, silent = false;
+    int benchThreads = 0;
 #ifdef DEBUG
     int breakAlloc = 0;
 #endif
@@ -464,6 +535,8 @@ int main(int argc, char** argv) {
             loadOnly = true;
         else if (str::Eq(argList.at(i), L"-silent"))
             silent = true;
+        else if (str::Eq(argList.at(i), L"-bench-threads") && i + 1 < argList.size())
+            benchThreads = _wtoi(argList.at(++i));
         // -full is for backward compatibility
         else if (str::Eq(argList.at(i), L"-full"))
             fullDump = true;
@@ -530,6 +603,8 @@ int main(int argc, char** argv) {
         DumpData(engine, fullDump);
     if (renderPath)
         RenderDocument(engine, renderPath, renderZoom, silent);
+    if (benchThreads > 0)
+        BenchRenderThreads(engine, benchThreads, renderZoom);
     delete engine;
 
     return 0;
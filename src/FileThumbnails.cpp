@@ -18,7 +18,7 @@
 #define THUMBNAILS_DIR_NAME L"sumatrapdfcache"
 
 // TODO: create in TEMP directory instead?
-static WCHAR* GetThumbnailPath(const WCHAR* filePath) {
+static WCHAR* GetCachePath(const WCHAR* filePath, const WCHAR* ext) {
     // create a fingerprint of a (normalized) path for the file name
     // I'd have liked to also include the file's last modification time
     // in the fingerprint (much quicker than hashing the entire file's
@@ -40,17 +40,19 @@ static WCHAR* GetThumbnailPath(const WCHAR* filePath) {
         return nullptr;
     AutoFreeW fname(str::conv::FromAnsi(fingerPrint));
 
-    return str::Format(L"%s\\%s.png", thumbsPath.Get(), fname.Get());
+    return str::Format(L"%s\\%s%s", thumbsPath.Get(), fname.Get(), ext);
 }
 
-// removes thumbnails that don't belong to any frequently used item in file history
-void CleanUpThumbnailCache(FileHistory& fileHistory) {
-    AutoFreeW thumbsPath(AppGenDataFilename(THUMBNAILS_DIR_NAME));
-    if (!thumbsPath)
-        return;
-    AutoFreeW pattern(path::Join(thumbsPath, L"*.png"));
+static WCHAR* GetThumbnailPath(const WCHAR* filePath) {
+    return GetCachePath(filePath, L".png");
+}
 
-    WStrVec files;
+WCHAR* GetTextIndexPath(const WCHAR* filePath) {
+    return GetCachePath(filePath, TEXT_INDEX_EXT);
+}
+
+static void AppendCachedFiles(const WCHAR* cachePath, const WCHAR* ext, WStrVec& files) {
+    AutoFreeW pattern(str::Format(L"%s\\*%s", cachePath, ext));
     WIN32_FIND_DATA fdata;
 
     HANDLE hfind = FindFirstFile(pattern, &fdata);
@@ -61,17 +63,33 @@ void CleanUpThumbnailCache(FileHistory& fileHistory) {
             files.Append(str::Dup(fdata.cFileName));
     } while (FindNextFile(hfind, &fdata));
     FindClose(hfind);
+}
+
+// removes thumbnails and text indices that don't belong to any frequently used item in file history
+void CleanUpThumbnailCache(FileHistory& fileHistory) {
+    AutoFreeW thumbsPath(AppGenDataFilename(THUMBNAILS_DIR_NAME));
+    if (!thumbsPath)
+        return;
+
+    WStrVec files;
+    AppendCachedFiles(thumbsPath, L".png", files);
+    AppendCachedFiles(thumbsPath, TEXT_INDEX_EXT, files);
+    if (files.size() == 0)
+        return;
 
     Vec<DisplayState*> list;
     fileHistory.GetFrequencyOrder(list);
     for (size_t i = 0; i < list.size() && i < FILE_HISTORY_MAX_FREQUENT * 2; i++) {
-        AutoFreeW bmpPath(GetThumbnailPath(list.at(i)->filePath));
-        if (!bmpPath)
-            continue;
-        int idx = files.Find(path::GetBaseName(bmpPath));
-        if (idx != -1) {
-            CrashIf(idx < 0 || files.size() <= (size_t)idx);
-            free(files.PopAt(idx));
+        const WCHAR* exts[] = {L".png", TEXT_INDEX_EXT};
+        for (const WCHAR* ext : exts) {
+            AutoFreeW cachePath(GetCachePath(list.at(i)->filePath, ext));
+            if (!cachePath)
+                continue;
+            int idx = files.Find(path::GetBaseName(cachePath));
+            if (idx != -1) {
+                CrashIf(idx < 0 || files.size() <= (size_t)idx);
+                free(files.PopAt(idx));
+            }
         }
     }
 
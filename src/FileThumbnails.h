@@ -5,7 +5,12 @@
 #define THUMBNAIL_DX 212
 #define THUMBNAIL_DY 150
 
+// file extension of the cached text indices (cf. TextIndex)
+#define TEXT_INDEX_EXT L".idx"
+
 void CleanUpThumbnailCache(FileHistory& fileHistory);
+// returns the path of the cached text index for filePath (which might not exist yet)
+WCHAR* GetTextIndexPath(const WCHAR* filePath);
 
 bool LoadThumbnail(DisplayState& ds);
 bool HasThumbnail(DisplayState& ds);
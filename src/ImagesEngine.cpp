@@ -88,6 +88,9 @@ class ImagesEngine : public BaseEngine {
 
     CRITICAL_SECTION cacheAccess;
     Vec<ImagePage*> pageCache;
+    // GDI+ objects aren't thread-safe and all renders of a page draw from the same
+    // cached Bitmap, so pages are rendered one at a time (cf. PdfEngineImpl::ctxAccess)
+    CRITICAL_SECTION renderAccess;
     Vec<RectD> mediaboxes;
 
     void GetTransform(Matrix& m, int pageNo, float zoom, int rotation);
@@ -101,6 +104,7 @@ class ImagesEngine : public BaseEngine {
 
 ImagesEngine::ImagesEngine() {
     InitializeCriticalSection(&cacheAccess);
+    InitializeCriticalSection(&renderAccess);
 }
 
 ImagesEngine::~ImagesEngine() {
@@ -112,6 +116,7 @@ ImagesEngine::~ImagesEngine() {
     LeaveCriticalSection(&cacheAccess);
 
     DeleteCriticalSection(&cacheAccess);
+    DeleteCriticalSection(&renderAccess);
 }
 
 RectD ImagesEngine::PageMediabox(int pageNo) {
@@ -125,6 +130,7 @@ RenderedBitmap* ImagesEngine::RenderBitmap(int pageNo, float zoom, int rotation,
                                            AbortCookie** cookieOut) {
     UNUSED(target);
     UNUSED(cookieOut);
+    ScopedCritSec scope(&renderAccess);
     ImagePage* page = GetPage(pageNo);
     if (!page)
         return nullptr;
@@ -210,6 +216,7 @@ class ImageElement : public PageElement {
     virtual WCHAR* GetValue() const { return nullptr; }
 
     virtual RenderedBitmap* GetImage() {
+        ScopedCritSec scope(&engine->renderAccess);
         HBITMAP hbmp;
         if (page->bmp->GetHBITMAP((ARGB)Color::White, &hbmp) != Ok)
             return nullptr;
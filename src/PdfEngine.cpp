@@ -15,6 +15,7 @@ extern "C" {
 #include "HtmlPullParser.h"
 #include "TrivialHtmlParser.h"
 #include "WinUtil.h"
+#include "WorkScheduler.h"
 #include "ZipUtil.h"
 #include "BaseEngine.h"
 #include "PdfEngine.h"
@@ -23,17 +24,38 @@ extern "C" {
 // and displayed; larger files will be kept open while they're displayed
 // so that their content can be loaded on demand in order to preserve memory
 #define MAX_MEMORY_FILE_SIZE (10 * 1024 * 1024)
-
-// number of page content trees to cache for quicker rendering
-#define MAX_PAGE_RUN_CACHE 8
-// maximum estimated memory requirement allowed for the run cache of one document
-#define MAX_PAGE_RUN_MEMORY (40 * 1024 * 1024)
+// files at least this large are mapped into memory (if they're on a local drive)
+#define MIN_MAPPED_FILE_SIZE (64 * 1024 * 1024)
+
+// default limit for the memory used by the cached page content trees of one
+// document (which make rendering pages again much quicker)
+#define MAX_PAGE_RUN_MEMORY (64 * 1024 * 1024)
+// number of most recently used page content trees which are kept even if they
+// exceed MAX_PAGE_RUN_MEMORY on their own (e.g. due to huge images)
+#define MIN_PAGE_RUNS_KEPT 2
+// number of hash buckets for looking up cached page content trees
+#define PAGE_RUN_CACHE_BUCKETS 64
 
 // maximum amount of memory that MuPDF should use per fz_context store
 #define MAX_CONTEXT_MEMORY (256 * 1024 * 1024)
 
+// bitmaps with at least that many pixels are rasterized in horizontal
+// bands, one per thread (all drawing from the same cached display list)
+#define MIN_BANDED_RENDER_PIXELS (2048 * 2048)
+// bands shouldn't get so thin that the per-band overhead dominates
+#define MIN_RENDER_BAND_HEIGHT 256
+#define MAX_RENDER_BANDS 8
+
 ///// extensions to Fitz that are usable for both PDF and XPS /////
 
+// how the contexts of newly opened documents anti-alias filled paths
+// (rendering contexts are cloned from them and inherit the scan converter)
+static int gScanConverter = FZ_SCAN_CONVERT_SAMPLED;
+
+void SetExactAntiAliasing(bool exact) {
+    gScanConverter = exact ? FZ_SCAN_CONVERT_ANALYTIC : FZ_SCAN_CONVERT_SAMPLED;
+}
+
 inline RectD fz_rect_to_RectD(fz_rect rect) {
     return RectD::FromXY(rect.x0, rect.y0, rect.x1, rect.y1);
 }
@@ -55,7 +77,177 @@ inline float fz_calc_overlap(fz_rect r1, fz_rect r2) {
     return (isect.x1 - isect.x0) * (isect.y1 - isect.y0) / ((r1.x1 - r1.x0) * (r1.y1 - r1.y0));
 }
 
-static RenderedBitmap* new_rendered_fz_pixmap(fz_context* ctx, fz_pixmap* pixmap) {
+// lets fitz rasterize straight into a DIB section (in GDI's BGRA format), so that
+// new_rendered_fz_pixmap can hand it to a RenderedBitmap without copying the samples
+struct FitzDibSection {
+    fz_pixmap_allocator allocator;
+    HBITMAP hbmp = nullptr;
+    HANDLE hMap = nullptr;
+    unsigned char* bits = nullptr;
+
+    FitzDibSection();
+};
+
+static unsigned char* AllocDibSection(fz_context* ctx, void* opaque, int w, int h, int n) {
+    UNUSED(ctx);
+    FitzDibSection* dib = (FitzDibSection*)opaque;
+    if (n != 4 || w <= 0 || h <= 0 || dib->hbmp)
+        return nullptr;
+
+    BITMAPINFO bmi = {0};
+    BITMAPINFOHEADER* bmih = &bmi.bmiHeader;
+    bmih->biSize = sizeof(*bmih);
+    bmih->biWidth = w;
+    bmih->biHeight = -h;
+    bmih->biPlanes = 1;
+    bmih->biCompression = BI_RGB;
+    bmih->biBitCount = 32;
+    bmih->biSizeImage = h * w * 4;
+
+    void* data = nullptr;
+    HANDLE hMap = CreateFileMapping(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, bmih->biSizeImage, nullptr);
+    HBITMAP hbmp = CreateDIBSection(nullptr, &bmi, DIB_RGB_COLORS, &data, hMap, 0);
+    if (!hbmp) {
+        if (hMap)
+            CloseHandle(hMap);
+        // fitz falls back to allocating the samples itself
+        return nullptr;
+    }
+    dib->hbmp = hbmp;
+    dib->hMap = hMap;
+    dib->bits = (unsigned char*)data;
+    return dib->bits;
+}
+
+static void ReleaseDibSection(fz_context* ctx, void* opaque, unsigned char* samples) {
+    UNUSED(ctx);
+    FitzDibSection* dib = (FitzDibSection*)opaque;
+    // nothing to do if the DIB section has been taken over by a RenderedBitmap
+    if (samples != dib->bits)
+        return;
+    DeleteObject(dib->hbmp);
+    if (dib->hMap)
+        CloseHandle(dib->hMap);
+    dib->hbmp = nullptr;
+    dib->hMap = nullptr;
+    dib->bits = nullptr;
+}
+
+FitzDibSection::FitzDibSection() {
+    allocator.alloc = AllocDibSection;
+    allocator.release = ReleaseDibSection;
+    allocator.opaque = this;
+}
+
+// open addressing hash table for looking up the palette index of a color
+// (sized so that with at most 256 entries, lookups need few probes)
+#define PALETTE_HASH_SIZE 1024
+#define PALETTE_HASH_EMPTY 0xFFFFFFFF
+
+struct PaletteHash {
+    uint32_t colors[PALETTE_HASH_SIZE];
+    BYTE indices[PALETTE_HASH_SIZE];
+
+    PaletteHash() { memset(colors, 0xFF, sizeof(colors)); }
+
+    // returns the index of color c (adding it as index count if needed) or -1 if
+    // the color doesn't fit into a 256 color palette
+    int FindOrAdd(uint32_t c, uint32_t* palette, int& count) {
+        size_t slot = (c * 2654435761u) >> 22;
+        for (;; slot = (slot + 1) & (PALETTE_HASH_SIZE - 1)) {
+            if (colors[slot] == c)
+                return indices[slot];
+            if (colors[slot] == PALETTE_HASH_EMPTY)
+                break;
+        }
+        if (count == 256)
+            return -1;
+        colors[slot] = c;
+        indices[slot] = (BYTE)count;
+        palette[count] = c;
+        return count++;
+    }
+};
+
+// pure gray pixels (e.g. of scans) are written as is, as indices into a grayscale palette;
+// returns false and the position of the first pixel with color if there is one
+static bool IndexGrayPixels(const unsigned char* samples, int w, int h, unsigned char* dest, int stride,
+                            bool grayUsed[256], int* yOut, int* xOut) {
+    uint32_t lastPixel = PALETTE_HASH_EMPTY;
+    for (int y = 0; y < h; y++) {
+        const unsigned char* src = samples + (size_t)y * w * 4;
+        unsigned char* d = dest + (size_t)y * stride;
+        for (int x = 0; x < w; x++, src += 4) {
+            uint32_t pixel;
+            memcpy(&pixel, src, 4);
+            pixel &= 0xFFFFFF;
+            if (pixel != lastPixel) {
+                // gray if all three color bytes are the same
+                if (((pixel >> 8) ^ pixel) & 0xFFFF) {
+                    *yOut = y;
+                    *xOut = x;
+                    return false;
+                }
+                grayUsed[src[0]] = true;
+                lastPixel = pixel;
+            }
+            d[x] = src[0];
+        }
+    }
+    return true;
+}
+
+// writes the 4-byte RGBA (or BGRA) pixels in samples as 8-bit indices into palette
+// (in RGBQUAD format) into dest, returns the number of colors in palette
+// or 0 if the pixels don't fit into a 256 color palette
+static int BuildExactPalette(const unsigned char* samples, int w, int h, bool isBgr, unsigned char* dest,
+                             int stride, uint32_t* palette) {
+    bool grayUsed[256] = {false};
+    int y, x;
+    if (IndexGrayPixels(samples, w, h, dest, stride, grayUsed, &y, &x)) {
+        for (int k = 0; k < 256; k++) {
+            palette[k] = k * 0x010101;
+        }
+        return 256;
+    }
+
+    // give the grays used so far their own palette entries and remap the indices written until now
+    PaletteHash hash;
+    int count = 0;
+    BYTE remap[256];
+    for (int k = 0; k < 256; k++) {
+        if (grayUsed[k])
+            remap[k] = (BYTE)hash.FindOrAdd(k * 0x010101, palette, count);
+    }
+    for (int row = 0; row <= y; row++) {
+        unsigned char* d = dest + (size_t)row * stride;
+        for (int col = 0, end = row < y ? w : x; col < end; col++) {
+            d[col] = remap[d[col]];
+        }
+    }
+
+    // neighboring pixels mostly have the same color, so only look up color changes
+    uint32_t lastColor = PALETTE_HASH_EMPTY;
+    int lastIdx = 0;
+    for (; y < h; y++, x = 0) {
+        const unsigned char* src = samples + ((size_t)y * w + x) * 4;
+        unsigned char* d = dest + (size_t)y * stride;
+        for (; x < w; x++, src += 4) {
+            uint32_t c = isBgr ? src[0] | (src[1] << 8) | (src[2] << 16) : src[2] | (src[1] << 8) | (src[0] << 16);
+            if (c != lastColor) {
+                lastIdx = hash.FindOrAdd(c, palette, count);
+                if (lastIdx < 0)
+                    return 0;
+                lastColor = c;
+            }
+            d[x] = (BYTE)lastIdx;
+        }
+    }
+    return count;
+}
+
+// dib is the FitzDibSection pixmap has been allocated through (if any)
+static RenderedBitmap* new_rendered_fz_pixmap(fz_context* ctx, fz_pixmap* pixmap, FitzDibSection* dib = nullptr) {
     int paletteSize = 0;
     bool hasPalette = false;
 
@@ -70,48 +262,24 @@ static RenderedBitmap* new_rendered_fz_pixmap(fz_context* ctx, fz_pixmap* pixmap
     if (!bmpData)
         return nullptr;
     fz_pixmap* bgrPixmap = nullptr;
-    if (bmpData && pixmap->n == 4 && pixmap->colorspace == fz_device_rgb(ctx)) {
-        unsigned char* dest = bmpData;
-        unsigned char* source = pixmap->samples;
+    bool isBgr = pixmap->colorspace == fz_device_bgr(ctx);
+    if (bmpData && pixmap->n == 4 && (isBgr || pixmap->colorspace == fz_device_rgb(ctx))) {
         uint32_t* palette = (uint32_t*)bmi.Get()->bmiColors;
-        BYTE grayIdxs[256] = {0};
-
-        for (int j = 0; j < h; j++) {
-            for (int i = 0; i < w; i++) {
-                RGBQUAD c;
-
-                c.rgbRed = *source++;
-                c.rgbGreen = *source++;
-                c.rgbBlue = *source++;
-                c.rgbReserved = 0;
-                source++;
-
-                /* find this color in the palette */
-                int k;
-                bool isGray = c.rgbRed == c.rgbGreen && c.rgbRed == c.rgbBlue;
-                if (isGray) {
-                    k = grayIdxs[c.rgbRed] || palette[0] == *(uint32_t*)&c ? grayIdxs[c.rgbRed] : paletteSize;
-                } else {
-                    for (k = 0; k < paletteSize && palette[k] != *(uint32_t*)&c; k++)
-                        ;
-                }
-                /* add it to the palette if it isn't in there and if there's still space left */
-                if (k == paletteSize) {
-                    if (++paletteSize > 256)
-                        goto ProducingPaletteDone;
-                    if (isGray)
-                        grayIdxs[c.rgbRed] = (BYTE)k;
-                    palette[k] = *(uint32_t*)&c;
-                }
-                /* 8-bit data consists of indices into the color palette */
-                *dest++ = k;
-            }
-            dest += rows8 - w;
-        }
-    ProducingPaletteDone:
-        hasPalette = paletteSize <= 256;
+        paletteSize = BuildExactPalette(pixmap->samples, w, h, isBgr, bmpData, rows8, palette);
+        hasPalette = paletteSize > 0;
     }
-    if (!hasPalette) {
+    if (!hasPalette && dib && dib->bits && pixmap->samples == dib->bits) {
+        free(bmpData);
+        // the samples already are in the DIB section, so hand it over as is
+        RenderedBitmap* bmp = new RenderedBitmap(dib->hbmp, SizeI(w, h), dib->hMap);
+        dib->hbmp = nullptr;
+        dib->hMap = nullptr;
+        dib->bits = nullptr;
+        return bmp;
+    }
+    if (!hasPalette && isBgr && pixmap->n == 4) {
+        free(bmpData);
+    } else if (!hasPalette) {
         free(bmpData);
         /* BGRA is a GDI compatible format */
         fz_try(ctx) {
@@ -122,7 +290,7 @@ static RenderedBitmap* new_rendered_fz_pixmap(fz_context* ctx, fz_pixmap* pixmap
         }
         fz_catch(ctx) { return nullptr; }
     }
-    AssertCrash(hasPalette || bgrPixmap);
+    AssertCrash(hasPalette || bgrPixmap || isBgr);
 
     BITMAPINFOHEADER* bmih = &bmi.Get()->bmiHeader;
     bmih->biSize = sizeof(*bmih);
@@ -138,7 +306,7 @@ static RenderedBitmap* new_rendered_fz_pixmap(fz_context* ctx, fz_pixmap* pixmap
     HANDLE hMap = CreateFileMapping(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, bmih->biSizeImage, nullptr);
     HBITMAP hbmp = CreateDIBSection(nullptr, bmi, DIB_RGB_COLORS, &data, hMap, 0);
     if (hbmp)
-        memcpy(data, hasPalette ? bmpData : bgrPixmap->samples, bmih->biSizeImage);
+        memcpy(data, hasPalette ? bmpData : bgrPixmap ? bgrPixmap->samples : pixmap->samples, bmih->biSizeImage);
 
     if (hasPalette)
         free(bmpData);
@@ -171,6 +339,19 @@ fz_stream* fz_open_file2(fz_context* ctx, const WCHAR* filePath) {
             return file;
     }
 
+    // map very large files into memory, so that seeking and reading objects doesn't
+    // cost a system call and a copy each time (the OS only loads what's accessed).
+    // A mapping prevents other programs from truncating the file (e.g. when LaTeX
+    // rewrites it in place), which rarely matters at that size, and turns read errors
+    // into access violations, which is why files on network shares aren't mapped
+    if (fileSize >= MIN_MAPPED_FILE_SIZE && path::IsOnFixedDrive(filePath)) {
+        fz_try(ctx) { file = fz_open_file_mapped_w(ctx, filePath); }
+        fz_catch(ctx) { file = nullptr; }
+        if (file)
+            return file;
+    }
+
+    // all other files and those that can't be mapped (e.g. too large for the address space)
     fz_try(ctx) { file = fz_open_file_w(ctx, filePath); }
     fz_catch(ctx) { file = nullptr; }
     return file;
@@ -227,10 +408,14 @@ static inline int wchars_per_rune(int rune) {
     return 1;
 }
 
-static void AddChar(fz_text_span* span, fz_text_char* c, str::Str<WCHAR>& s, Vec<RectI>& rects) {
-    fz_rect bbox;
-    fz_text_char_bbox(&bbox, span, c - span->text);
-    RectI r = fz_rect_to_RectD(bbox).Round();
+// rects is nullptr if only the text is needed (computing the glyph boxes is expensive)
+static void AddChar(fz_text_span* span, fz_text_char* c, str::Str<WCHAR>& s, Vec<RectI>* rects) {
+    RectI r;
+    if (rects) {
+        fz_rect bbox;
+        fz_text_char_bbox(&bbox, span, c - span->text);
+        r = fz_rect_to_RectD(bbox).Round();
+    }
 
     int n = wchars_per_rune(c->c);
     if (n == 2) {
@@ -238,22 +423,26 @@ static void AddChar(fz_text_span* span, fz_text_char* c, str::Str<WCHAR>& s, Vec
         tmp[0] = 0xD800 | ((c->c - 0x10000) >> 10) & 0x3FF;
         tmp[1] = 0xDC00 | (c->c - 0x10000) & 0x3FF;
         s.Append(tmp, 2);
-        rects.Append(r);
-        rects.Append(r);
+        if (rects) {
+            rects->Append(r);
+            rects->Append(r);
+        }
         return;
     }
     WCHAR wc = c->c;
     bool isNonPrintable = (wc <= 32) || str::IsNonCharacter(wc);
     if (!isNonPrintable) {
         s.Append(wc);
-        rects.Append(r);
+        if (rects)
+            rects->Append(r);
         return;
     }
 
     // non-printable or whitespace
     if (!str::IsWs(wc)) {
         s.Append(L'?');
-        rects.Append(r);
+        if (rects)
+            rects->Append(r);
         return;
     }
 
@@ -261,50 +450,55 @@ static void AddChar(fz_text_span* span, fz_text_char* c, str::Str<WCHAR>& s, Vec
     WCHAR prev = s.LastChar();
     if (!str::IsWs(prev)) {
         s.Append(L' ');
-        rects.Append(r);
+        if (rects)
+            rects->Append(r);
     }
 }
 
 // if there's a span following this one, add space to separate them
-static void AddSpaceAtSpanEnd(fz_text_span* span, str::Str<WCHAR>& s, Vec<RectI>& rects) {
+static void AddSpaceAtSpanEnd(fz_text_span* span, str::Str<WCHAR>& s, Vec<RectI>* rects) {
     if (span->len == 0 || span->next == NULL) {
         return;
     }
     CrashIf(s.size() == 0);
-    CrashIf(rects.size() == 0);
+    CrashIf(rects && rects->size() == 0);
     if (s.LastChar() == ' ') {
         return;
     }
     // TODO: use a Tab instead? (this might be a table)
     s.Append(L' ');
-    RectI prev = rects.Last();
-    prev.x += prev.dx;
-    prev.dx /= 2;
-    rects.Append(prev);
+    if (rects) {
+        RectI prev = rects->Last();
+        prev.x += prev.dx;
+        prev.dx /= 2;
+        rects->Append(prev);
+    }
 }
 
-static void AddLineSep(str::Str<WCHAR>& s, Vec<RectI>& rects, const WCHAR* lineSep, size_t lineSepLen) {
+static void AddLineSep(str::Str<WCHAR>& s, Vec<RectI>* rects, const WCHAR* lineSep, size_t lineSepLen) {
     if (lineSepLen == 0) {
         return;
     }
     // remove trailing spaces
     if (str::IsWs(s.LastChar())) {
         s.Pop();
-        rects.Pop();
+        if (rects)
+            rects->Pop();
     }
 
     s.Append(lineSep);
-    for (size_t i = 0; i < lineSepLen; i++) {
-        rects.Append(RectI());
+    for (size_t i = 0; rects && i < lineSepLen; i++) {
+        rects->Append(RectI());
     }
 }
 
 static WCHAR* fz_text_page_to_str(fz_text_page* text, const WCHAR* lineSep, RectI** coordsOut) {
     size_t lineSepLen = str::Len(lineSep);
     str::Str<WCHAR> content;
-    // coordsOut is optional but we ask for it by default so we simplify the code
-    // by always calculating it
+    // the glyph boxes are only calculated if coordsOut is requested
+    // (callers only searching the text don't need them)
     Vec<RectI> rects;
+    Vec<RectI>* rectsOut = coordsOut ? &rects : nullptr;
 
     for (fz_page_block* block = text->blocks; block < text->blocks + text->len; block++) {
         if (block->type != FZ_PAGE_BLOCK_TEXT)
@@ -312,15 +506,15 @@ static WCHAR* fz_text_page_to_str(fz_text_page* text, const WCHAR* lineSep, Rect
         for (fz_text_line* line = block->u.text->lines; line < block->u.text->lines + block->u.text->len; line++) {
             for (fz_text_span* span = line->first_span; span; span = span->next) {
                 for (fz_text_char* c = span->text; c < span->text + span->len; c++) {
-                    AddChar(span, c, content, rects);
+                    AddChar(span, c, content, rectsOut);
                 }
-                AddSpaceAtSpanEnd(span, content, rects);
+                AddSpaceAtSpanEnd(span, content, rectsOut);
             }
-            AddLineSep(content, rects, lineSep, lineSepLen);
+            AddLineSep(content, rectsOut, lineSep, lineSepLen);
         }
     }
 
-    CrashIf(content.size() != rects.size());
+    CrashIf(coordsOut && content.size() != rects.size());
 
     if (coordsOut) {
         *coordsOut = rects.StealData();
@@ -329,6 +523,25 @@ static WCHAR* fz_text_page_to_str(fz_text_page* text, const WCHAR* lineSep, Rect
     return content.StealData();
 }
 
+// returns false if text doesn't contain needle, as matched by fz_search_text_index
+// (must be called with access to ctx)
+static bool fz_text_page_might_contain(fz_context* ctx, fz_text_page* text, const WCHAR* needle) {
+    OwnedData needleUtf8(str::conv::ToUtf8(needle));
+    if (str::IsEmpty(needleUtf8.Get()))
+        return true;
+    fz_text_index* index = nullptr;
+    bool found = true;
+    fz_var(index);
+    fz_var(found);
+    fz_try(ctx) {
+        index = fz_new_text_index(ctx, text);
+        found = fz_text_index_contains(ctx, index, needleUtf8.Get()) != 0;
+    }
+    fz_catch(ctx) { found = true; }
+    fz_drop_text_index(ctx, index);
+    return found;
+}
+
 struct istream_filter {
     IStream* stream;
     unsigned char buf[4096];
@@ -611,9 +824,11 @@ struct FitzImagePos {
 
 struct ListInspectionData {
     Vec<FitzImagePos>* images;
-    size_t mem_estimate;
+    // Type 3 glyphs are run through the document's own fz_context,
+    // so such lists can't be rendered on a cloned context
+    bool uses_type3_fonts;
 
-    explicit ListInspectionData(Vec<FitzImagePos>& images) : images(&images), mem_estimate(0) {}
+    explicit ListInspectionData(Vec<FitzImagePos>& images) : images(&images), uses_type3_fonts(false) {}
 };
 
 extern "C" static void fz_inspection_free(fz_device* dev) {
@@ -623,26 +838,21 @@ extern "C" static void fz_inspection_free(fz_device* dev) {
     ((ListInspectionData*)dev->user)->images->Reverse();
 }
 
-static void fz_inspection_handle_path(fz_device* dev, fz_path* path) {
-    ((ListInspectionData*)dev->user)->mem_estimate += sizeof(fz_path) + path->cmd_cap + path->coord_cap * sizeof(float);
-}
-
-static void fz_inspection_handle_image(fz_device* dev, fz_image* image) {
-    int n = image->colorspace ? image->colorspace->n + 1 : 1;
-    ((ListInspectionData*)dev->user)->mem_estimate += sizeof(fz_image) + image->w * image->h * n;
+static void fz_inspection_handle_text(fz_device* dev, fz_text* text) {
+    if (text->font && text->font->t3procs)
+        ((ListInspectionData*)dev->user)->uses_type3_fonts = true;
 }
 
-extern "C" static void fz_inspection_fill_path(fz_device* dev, fz_path* path, int even_odd, const fz_matrix* ctm,
+extern "C" static void fz_inspection_fill_text(fz_device* dev, fz_text* text, const fz_matrix* ctm,
                                                fz_colorspace* colorspace, float* color, float alpha) {
-    UNUSED(even_odd);
     UNUSED(ctm);
     UNUSED(colorspace);
     UNUSED(color);
     UNUSED(alpha);
-    fz_inspection_handle_path(dev, path);
+    fz_inspection_handle_text(dev, text);
 }
 
-extern "C" static void fz_inspection_stroke_path(fz_device* dev, fz_path* path, fz_stroke_state* stroke,
+extern "C" static void fz_inspection_stroke_text(fz_device* dev, fz_text* text, fz_stroke_state* stroke,
                                                  const fz_matrix* ctm, fz_colorspace* colorspace, float* color,
                                                  float alpha) {
     UNUSED(stroke);
@@ -650,35 +860,24 @@ extern "C" static void fz_inspection_stroke_path(fz_device* dev, fz_path* path,
     UNUSED(colorspace);
     UNUSED(color);
     UNUSED(alpha);
-    fz_inspection_handle_path(dev, path);
+    fz_inspection_handle_text(dev, text);
 }
 
-extern "C" static void fz_inspection_clip_path(fz_device* dev, fz_path* path, const fz_rect* rect, int even_odd,
-                                               const fz_matrix* ctm) {
-    UNUSED(rect);
-    UNUSED(even_odd);
+extern "C" static void fz_inspection_clip_text(fz_device* dev, fz_text* text, const fz_matrix* ctm, int accumulate) {
     UNUSED(ctm);
-    fz_inspection_handle_path(dev, path);
+    UNUSED(accumulate);
+    fz_inspection_handle_text(dev, text);
 }
 
-extern "C" static void fz_inspection_clip_stroke_path(fz_device* dev, fz_path* path, const fz_rect* rect,
-                                                      fz_stroke_state* stroke, const fz_matrix* ctm) {
-    UNUSED(rect);
+extern "C" static void fz_inspection_clip_stroke_text(fz_device* dev, fz_text* text, fz_stroke_state* stroke,
+                                                      const fz_matrix* ctm) {
     UNUSED(stroke);
     UNUSED(ctm);
-    fz_inspection_handle_path(dev, path);
-}
-
-extern "C" static void fz_inspection_fill_shade(fz_device* dev, fz_shade* shade, const fz_matrix* ctm, float alpha) {
-    UNUSED(shade);
-    UNUSED(ctm);
-    UNUSED(alpha);
-    ((ListInspectionData*)dev->user)->mem_estimate += sizeof(fz_shade);
+    fz_inspection_handle_text(dev, text);
 }
 
 extern "C" static void fz_inspection_fill_image(fz_device* dev, fz_image* image, const fz_matrix* ctm, float alpha) {
     UNUSED(alpha);
-    fz_inspection_handle_image(dev, image);
     // extract rectangles for images a user might want to extract
     // TODO: try to better distinguish images a user might actually want to extract
     if (image->w < 16 || image->h < 16)
@@ -689,65 +888,230 @@ extern "C" static void fz_inspection_fill_image(fz_device* dev, fz_image* image,
         ((ListInspectionData*)dev->user)->images->Append(FitzImagePos(image, rect));
 }
 
-extern "C" static void fz_inspection_fill_image_mask(fz_device* dev, fz_image* image, const fz_matrix* ctm,
-                                                     fz_colorspace* colorspace, float* color, float alpha) {
-    UNUSED(ctm);
-    UNUSED(colorspace);
-    UNUSED(color);
-    UNUSED(alpha);
-    fz_inspection_handle_image(dev, image);
-}
-
-extern "C" static void fz_inspection_clip_image_mask(fz_device* dev, fz_image* image, const fz_rect* rect,
-                                                     const fz_matrix* ctm) {
-    UNUSED(rect);
-    UNUSED(ctm);
-    fz_inspection_handle_image(dev, image);
-}
-
 static fz_device* fz_new_inspection_device(fz_context* ctx, ListInspectionData* data) {
     fz_device* dev = fz_new_device(ctx, data);
     dev->free_user = fz_inspection_free;
 
-    dev->fill_path = fz_inspection_fill_path;
-    dev->stroke_path = fz_inspection_stroke_path;
-    dev->clip_path = fz_inspection_clip_path;
-    dev->clip_stroke_path = fz_inspection_clip_stroke_path;
+    dev->fill_text = fz_inspection_fill_text;
+    dev->stroke_text = fz_inspection_stroke_text;
+    dev->clip_text = fz_inspection_clip_text;
+    dev->clip_stroke_text = fz_inspection_clip_stroke_text;
 
-    dev->fill_shade = fz_inspection_fill_shade;
     dev->fill_image = fz_inspection_fill_image;
-    dev->fill_image_mask = fz_inspection_fill_image_mask;
-    dev->clip_image_mask = fz_inspection_clip_image_mask;
 
     return dev;
 }
 
 class FitzAbortCookie : public AbortCookie {
+    CRITICAL_SECTION access;
+    // cookies of the bands currently rendered on behalf of this one (each band thread
+    // needs a cookie of its own, as fz_run_display_list updates the progress fields)
+    Vec<FitzAbortCookie*> bandCookies;
+
   public:
     fz_cookie cookie;
-    FitzAbortCookie() { memset(&cookie, 0, sizeof(cookie)); }
-    void Abort() override { cookie.abort = 1; }
+    FitzAbortCookie() {
+        memset(&cookie, 0, sizeof(cookie));
+        InitializeCriticalSection(&access);
+    }
+    ~FitzAbortCookie() { DeleteCriticalSection(&access); }
+    void Abort() override {
+        ScopedCritSec scope(&access);
+        cookie.abort = 1;
+        for (FitzAbortCookie* band : bandCookies) {
+            band->Abort();
+        }
+    }
+    // band is aborted along with this cookie until it's removed again
+    void AddBand(FitzAbortCookie* band) {
+        ScopedCritSec scope(&access);
+        bandCookies.Append(band);
+        if (cookie.abort)
+            band->Abort();
+    }
+    void RemoveBand(FitzAbortCookie* band) {
+        ScopedCritSec scope(&access);
+        bandCookies.Remove(band);
+    }
 };
 
-extern "C" static void fz_lock_context_cs(void* user, int lock) {
-    UNUSED(lock);
-    // we use a single critical section for all locks,
-    // since that critical section (ctxAccess) should
-    // be guarding all fz_context access anyway and
-    // thus already be in place (in debug builds we
-    // crash if that assertion doesn't hold)
-    CRITICAL_SECTION* cs = (CRITICAL_SECTION*)user;
-    BOOL ok = TryEnterCriticalSection(cs);
-    if (!ok) {
-        CrashIf(true);
-        EnterCriticalSection(cs);
+// a page's display list, as cached by FitzPageRunCache
+template <typename Page>
+struct FitzPageRun {
+    Page* page;
+    fz_display_list* list;
+    // memory kept alive by list (cf. fz_display_list_size)
+    size_t size;
+    bool uses_type3_fonts;
+    // one reference is held by the cache (as long as the run is cached)
+    // and one by each caller currently using the list
+    int refs;
+    bool cached;
+
+    // next run in the same hash bucket
+    FitzPageRun* bucketNext;
+    // neighbors in the list of runs ordered from least to most recently used
+    FitzPageRun* lruPrev;
+    FitzPageRun* lruNext;
+
+    FitzPageRun(Page* page, fz_display_list* list, size_t size, bool uses_type3_fonts)
+        : page(page),
+          list(list),
+          size(size),
+          uses_type3_fonts(uses_type3_fonts),
+          refs(1),
+          cached(false),
+          bucketNext(nullptr),
+          lruPrev(nullptr),
+          lruNext(nullptr) {}
+};
+
+// An index of the cached display lists of an engine's pages with O(1) lookup and
+// promotion, limited by the memory the lists keep alive. The cache doesn't do any
+// locking and doesn't free the lists itself (that's up to the engine, since lists
+// have to be dropped on the engine's fz_context)
+template <typename Page>
+class FitzPageRunCache {
+    typedef FitzPageRun<Page> Run;
+
+    Run* buckets[PAGE_RUN_CACHE_BUCKETS];
+    Run* lruFirst;
+    Run* lruLast;
+    size_t count;
+    size_t bytes;
+    size_t maxBytes;
+
+    Run*& Bucket(Page* page) {
+        uintptr_t key = (uintptr_t)page;
+        return buckets[MurmurHash2(&key, sizeof(key)) % PAGE_RUN_CACHE_BUCKETS];
+    }
+
+    void Link(Run* run) {
+        Run*& bucket = Bucket(run->page);
+        run->bucketNext = bucket;
+        bucket = run;
+
+        run->lruPrev = lruLast;
+        run->lruNext = nullptr;
+        if (lruLast)
+            lruLast->lruNext = run;
+        else
+            lruFirst = run;
+        lruLast = run;
+    }
+
+    void Unlink(Run* run) {
+        Run** next = &Bucket(run->page);
+        while (*next != run) {
+            CrashIf(!*next);
+            next = &(*next)->bucketNext;
+        }
+        *next = run->bucketNext;
+        run->bucketNext = nullptr;
+
+        if (run->lruPrev)
+            run->lruPrev->lruNext = run->lruNext;
+        else
+            lruFirst = run->lruNext;
+        if (run->lruNext)
+            run->lruNext->lruPrev = run->lruPrev;
+        else
+            lruLast = run->lruPrev;
+        run->lruPrev = run->lruNext = nullptr;
     }
+
+  public:
+    explicit FitzPageRunCache(size_t maxBytes = MAX_PAGE_RUN_MEMORY)
+        : lruFirst(nullptr), lruLast(nullptr), count(0), bytes(0), maxBytes(maxBytes) {
+        ZeroMemory(buckets, sizeof(buckets));
+    }
+
+    size_t Count() const { return count; }
+    size_t Bytes() const { return bytes; }
+    size_t MaxBytes() const { return maxBytes; }
+    // runs in excess of the new budget are returned by GetOverBudget
+    void SetMaxBytes(size_t newMaxBytes) { maxBytes = newMaxBytes; }
+
+    // returns the cached run for page (if any) and marks it as most recently used
+    Run* Find(Page* page) {
+        for (Run* run = Bucket(page); run; run = run->bucketNext) {
+            if (run->page == page) {
+                if (run != lruLast) {
+                    Unlink(run);
+                    Link(run);
+                }
+                return run;
+            }
+        }
+        return nullptr;
+    }
+
+    // adds run as the most recently used one (the cache takes over the initial reference)
+    void Add(Run* run) {
+        CrashIf(run->cached || Find(run->page));
+        Link(run);
+        run->cached = true;
+        count++;
+        bytes += run->size;
+    }
+
+    // removes run from the index (the caller has to drop the cache's reference)
+    void Remove(Run* run) {
+        if (!run->cached)
+            return;
+        Unlink(run);
+        run->cached = false;
+        count--;
+        bytes -= run->size;
+    }
+
+    // returns the least recently used run, if the cache exceeds its budget
+    // (the MIN_PAGE_RUNS_KEPT most recently used runs are always kept, though)
+    Run* GetOverBudget() const {
+        if (bytes <= maxBytes || count <= MIN_PAGE_RUNS_KEPT)
+            return nullptr;
+        return lruFirst;
+    }
+
+    Run* LeastRecentlyUsed() const { return lruFirst; }
+};
+
+// one critical section per FZ_LOCK_* instead of a single one for all locks, so that
+// contexts cloned with fz_clone_context can be used from several threads at once
+// (all calls on an engine's main fz_context are still serialized through ctxAccess)
+class FitzLocks {
+  public:
+    CRITICAL_SECTION cs[FZ_LOCK_MAX];
+    fz_locks_context locks;
+
+    FitzLocks();
+    ~FitzLocks();
+};
+
+extern "C" static void fz_lock_context_cs(void* user, int lock) {
+    FitzLocks* fzLocks = (FitzLocks*)user;
+    CrashIf(lock < 0 || lock >= FZ_LOCK_MAX);
+    EnterCriticalSection(&fzLocks->cs[lock]);
 }
 
 extern "C" static void fz_unlock_context_cs(void* user, int lock) {
-    UNUSED(lock);
-    CRITICAL_SECTION* cs = (CRITICAL_SECTION*)user;
-    LeaveCriticalSection(cs);
+    FitzLocks* fzLocks = (FitzLocks*)user;
+    LeaveCriticalSection(&fzLocks->cs[lock]);
+}
+
+FitzLocks::FitzLocks() {
+    for (int i = 0; i < FZ_LOCK_MAX; i++) {
+        InitializeCriticalSection(&cs[i]);
+    }
+    locks.user = this;
+    locks.lock = fz_lock_context_cs;
+    locks.unlock = fz_unlock_context_cs;
+}
+
+FitzLocks::~FitzLocks() {
+    for (int i = 0; i < FZ_LOCK_MAX; i++) {
+        DeleteCriticalSection(&cs[i]);
+    }
 }
 
 static Vec<PageAnnotation> fz_get_user_page_annots(Vec<PageAnnotation>& userAnnots, int pageNo) {
@@ -1077,7 +1441,9 @@ static void pdf_load_page_objs(pdf_document* doc, pdf_obj** page_objs) {
                 if (page_no >= pdf_count_pages(doc))
                     fz_throw(ctx, FZ_ERROR_GENERIC, "found more /Page objects than anticipated");
 
-                page_objs[page_no] = pdf_keep_obj(kid);
+                // keep page objects which have already been looked up individually
+                if (!page_objs[page_no])
+                    page_objs[page_no] = pdf_keep_obj(kid);
                 page_no++;
             }
         }
@@ -1095,15 +1461,7 @@ static void pdf_load_page_objs(pdf_document* doc, pdf_obj** page_objs) {
 
 ///// Above are extensions to Fitz and MuPDF, now follows PdfEngine /////
 
-struct PdfPageRun {
-    pdf_page* page;
-    fz_display_list* list;
-    size_t size_est;
-    int refs;
-
-    PdfPageRun(pdf_page* page, fz_display_list* list, ListInspectionData& data)
-        : page(page), list(list), size_est(data.mem_estimate), refs(1) {}
-};
+typedef FitzPageRun<pdf_page> PdfPageRun;
 
 class PdfTocItem;
 class PdfLink;
@@ -1141,6 +1499,7 @@ class PdfEngineImpl : public BaseEngine {
     }
     WCHAR* ExtractPageText(int pageNo, const WCHAR* lineSep, RectI** coordsOut = nullptr,
                            RenderTarget target = RenderTarget::View) override;
+    bool PageMightContainText(int pageNo, const WCHAR* text) override;
     bool HasClipOptimizations(int pageNo) override;
     PageLayoutType PreferredLayout() override;
     WCHAR* GetProperty(DocumentProperty prop) override;
@@ -1155,15 +1514,19 @@ class PdfEngineImpl : public BaseEngine {
     const WCHAR* GetDefaultFileExt() const override { return L".pdf"; }
 
     bool BenchLoadPage(int pageNo) override { return GetPdfPage(pageNo) != nullptr; }
+    bool PrefetchPage(int pageNo) override;
+    void SetPageCacheBudget(size_t maxBytes) override;
 
     Vec<PageElement*>* GetElements(int pageNo) override;
     PageElement* GetElementAtPos(int pageNo, PointD pt) override;
 
     PageDestination* GetNamedDest(const WCHAR* name) override;
-    bool HasTocTree() const override { return outline != nullptr || attachments != nullptr; }
+    bool HasTocTree() const override {
+        return _outlineLoaded ? outline != nullptr || attachments != nullptr : _hasTocTree;
+    }
     DocTocItem* GetTocTree() override;
 
-    bool HasPageLabels() const override { return _pagelabels != nullptr; }
+    bool HasPageLabels() const override { return _pagelabelsLoaded ? _pagelabels != nullptr : _hasPageLabels; }
     WCHAR* GetPageLabel(int pageNo) const override;
     int GetPageByLabel(const WCHAR* label) const override;
 
@@ -1181,9 +1544,16 @@ class PdfEngineImpl : public BaseEngine {
     // protected critical section in order to avoid deadlocks
     CRITICAL_SECTION ctxAccess;
     fz_context* ctx;
-    fz_locks_context fz_locks_ctx;
+    FitzLocks fzLocks;
     pdf_document* _doc;
 
+    // contexts cloned from ctx for rasterizing cached display lists
+    // without holding ctxAccess (so that pages can render in parallel)
+    CRITICAL_SECTION renderCtxAccess;
+    Vec<fz_context*> renderCtxPool;
+    fz_context* GetRenderContext();
+    void ReleaseRenderContext(fz_context* renderCtx);
+
     CRITICAL_SECTION pagesAccess;
     pdf_page** _pages;
     pdf_obj** _pageObjs;
@@ -1194,6 +1564,14 @@ class PdfEngineImpl : public BaseEngine {
     bool LoadFromStream(fz_stream* stm, PasswordUI* pwdUI = nullptr);
     bool FinishLoading();
 
+    // everything below is loaded on first use so that opening a document
+    // doesn't depend on its size (the page tree alone can take seconds to walk)
+    pdf_obj* GetPageObj(int pageNo);
+    void LoadAllPageObjs();
+    void LoadOutline();
+    void LoadDocInfo();
+    void LoadPageLabels();
+
     pdf_page* GetPdfPage(int pageNo, bool failIfBusy = false);
     int GetPageNo(pdf_page* page);
     fz_matrix viewctm(int pageNo, float zoom, int rotation) {
@@ -1206,12 +1584,25 @@ class PdfEngineImpl : public BaseEngine {
     }
     WCHAR* ExtractPageText(pdf_page* page, const WCHAR* lineSep, RectI** coordsOut = nullptr,
                            RenderTarget target = RenderTarget::View, bool cacheRun = false);
-
-    Vec<PdfPageRun*> runCache; // ordered most recently used first
+    // runs page through a text device, the caller must free the result and *sheetOut
+    // (with ctxAccess held). Returns nullptr on failure
+    fz_text_page* NewTextPage(pdf_page* page, fz_text_sheet** sheetOut, RenderTarget target, bool cacheRun);
+    // returns the page if it's loaded, else loads it without keeping it loaded
+    // (ReleaseTextPage frees it again in that case)
+    pdf_page* GetTextPage(int pageNo, bool* isTemporary);
+    void ReleaseTextPage(pdf_page* page, bool isTemporary);
+
+    FitzPageRunCache<pdf_page> runCache;
     PdfPageRun* CreatePageRun(pdf_page* page, fz_display_list* list);
     PdfPageRun* GetPageRun(pdf_page* page, bool tryOnly = false);
     bool RunPage(pdf_page* page, fz_device* dev, const fz_matrix* ctm, RenderTarget target = RenderTarget::View,
                  const fz_rect* cliprect = nullptr, bool cacheRun = true, FitzAbortCookie* cookie = nullptr);
+    bool RunPageList(PdfPageRun* run, fz_device* dev, const fz_matrix* ctm, const fz_rect* cliprect = nullptr,
+                     FitzAbortCookie* cookie = nullptr);
+    bool RunPageListBand(PdfPageRun* run, fz_pixmap* image, const fz_irect* band, const fz_matrix* ctm,
+                         FitzAbortCookie* cookie);
+    bool RunPageListBanded(fz_context* renderCtx, PdfPageRun* run, fz_pixmap* image, const fz_matrix* ctm,
+                           FitzAbortCookie* cookie);
     void DropPageRun(PdfPageRun* run, bool forceRemove = false);
 
     PdfTocItem* BuildTocTree(fz_outline* entry, int& idCounter);
@@ -1229,6 +1620,13 @@ class PdfEngineImpl : public BaseEngine {
     fz_outline* attachments;
     pdf_obj* _info;
     WStrVec* _pagelabels;
+    bool _pageObjsLoaded;
+    bool _outlineLoaded;
+    bool _infoLoaded;
+    bool _pagelabelsLoaded;
+    // cheap guesses for HasTocTree and HasPageLabels until the real data is loaded
+    bool _hasTocTree;
+    bool _hasPageLabels;
     pdf_annot*** pageAnnots;
     fz_rect** imageRects;
 
@@ -1318,20 +1716,26 @@ PdfEngineImpl::PdfEngineImpl()
       outline(nullptr),
       attachments(nullptr),
       _pagelabels(nullptr),
+      _pageObjsLoaded(false),
+      _outlineLoaded(false),
+      _infoLoaded(false),
+      _pagelabelsLoaded(false),
+      _hasTocTree(false),
+      _hasPageLabels(false),
       _decryptionKey(nullptr),
       isProtected(false),
       pageAnnots(nullptr),
       imageRects(nullptr) {
     InitializeCriticalSection(&pagesAccess);
     InitializeCriticalSection(&ctxAccess);
+    InitializeCriticalSection(&renderCtxAccess);
 
-    fz_locks_ctx.user = &ctxAccess;
-    fz_locks_ctx.lock = fz_lock_context_cs;
-    fz_locks_ctx.unlock = fz_unlock_context_cs;
-    ctx = fz_new_context(nullptr, &fz_locks_ctx, MAX_CONTEXT_MEMORY);
+    ctx = fz_new_context(nullptr, &fzLocks.locks, MAX_CONTEXT_MEMORY);
 
-    if (ctx)
+    if (ctx) {
         pdf_install_load_system_font_funcs(ctx);
+        fz_set_scan_converter(ctx, gScanConverter);
+    }
 }
 
 PdfEngineImpl::~PdfEngineImpl() {
@@ -1368,13 +1772,16 @@ PdfEngineImpl::~PdfEngineImpl() {
         free(imageRects);
     }
 
-    while (runCache.size() > 0) {
-        AssertCrash(runCache.Last()->refs == 1);
-        DropPageRun(runCache.Last(), true);
+    while (runCache.LeastRecentlyUsed()) {
+        AssertCrash(runCache.LeastRecentlyUsed()->refs == 1);
+        DropPageRun(runCache.LeastRecentlyUsed(), true);
     }
 
     pdf_close_document(_doc);
     _doc = nullptr;
+    for (fz_context* renderCtx : renderCtxPool) {
+        fz_free_context(renderCtx);
+    }
     fz_free_context(ctx);
     ctx = nullptr;
 
@@ -1382,6 +1789,7 @@ PdfEngineImpl::~PdfEngineImpl() {
     delete _pagelabels;
     free(_decryptionKey);
 
+    DeleteCriticalSection(&renderCtxAccess);
     LeaveCriticalSection(&ctxAccess);
     DeleteCriticalSection(&ctxAccess);
     LeaveCriticalSection(&pagesAccess);
@@ -1527,7 +1935,8 @@ bool PdfEngineImpl::LoadFromStream(fz_stream* stm, PasswordUI* pwdUI) {
     if (!stm)
         return false;
 
-    fz_try(ctx) { _doc = pdf_open_document_with_stream(ctx, stm); }
+    // linearized documents are read through their hint tables as far as possible
+    fz_try(ctx) { _doc = pdf_open_document_linear_with_stream(ctx, stm); }
     fz_always(ctx) { fz_close(stm); }
     fz_catch(ctx) { return false; }
 
@@ -1603,8 +2012,64 @@ bool PdfEngineImpl::FinishLoading() {
 
     ScopedCritSec scope(&ctxAccess);
 
+    // only check whether there's anything to load later on
+    fz_try(ctx) {
+        pdf_obj* root = pdf_dict_gets(pdf_trailer(_doc), "Root");
+        _hasTocTree = pdf_dict_getp(root, "Outlines/First") || pdf_dict_getp(root, "Names/EmbeddedFiles");
+        _hasPageLabels = pdf_dict_gets(root, "PageLabels") != nullptr;
+    }
+    fz_catch(ctx) { fz_warn(ctx, "Couldn't read document catalog"); }
+
+    AssertCrash(!pdf_js_supported(_doc));
+
+    return true;
+}
+
+// must be called with ctxAccess held
+pdf_obj* PdfEngineImpl::GetPageObj(int pageNo) {
+    pdf_obj* obj = _pageObjs[pageNo - 1];
+    if (obj || _pageObjsLoaded)
+        return obj;
+
+    // pdf_lookup_page_obj starts from the root for every page, which makes looking up
+    // all pages (e.g. for their mediaboxes) quadratic for a flat /Kids array. So only
+    // the first page is looked up on its own and all other pages are loaded at once
+    // (while reading a linearized file, pages are loaded through the hint tables instead)
+    if (pageNo == 1 || _doc->file_reading_linearly) {
+        fz_var(obj);
+        fz_try(ctx) {
+            if (_doc->file_reading_linearly)
+                obj = pdf_progressive_advance(_doc, pageNo - 1);
+            else
+                obj = pdf_lookup_page_obj(_doc, pageNo - 1);
+        }
+        fz_catch(ctx) { obj = nullptr; }
+        if (obj) {
+            _pageObjs[pageNo - 1] = pdf_keep_obj(obj);
+            return obj;
+        }
+    }
+
+    // this also covers page trees broken in a way that pdf_load_page_objs tolerates
+    LoadAllPageObjs();
+    return _pageObjs[pageNo - 1];
+}
+
+void PdfEngineImpl::LoadAllPageObjs() {
+    ScopedCritSec scope(&ctxAccess);
+    if (_pageObjsLoaded)
+        return;
+    _pageObjsLoaded = true;
+
     fz_try(ctx) { pdf_load_page_objs(_doc, _pageObjs); }
     fz_catch(ctx) { fz_warn(ctx, "Couldn't load all page objects"); }
+}
+
+void PdfEngineImpl::LoadOutline() {
+    ScopedCritSec scope(&ctxAccess);
+    if (_outlineLoaded)
+        return;
+
     fz_try(ctx) { outline = pdf_load_outline(_doc); }
     fz_catch(ctx) {
         // ignore errors from pdf_load_outline()
@@ -1615,6 +2080,15 @@ bool PdfEngineImpl::FinishLoading() {
     }
     fz_try(ctx) { attachments = pdf_loadattachments(_doc); }
     fz_catch(ctx) { fz_warn(ctx, "Couldn't load attachments"); }
+    _outlineLoaded = true;
+}
+
+void PdfEngineImpl::LoadDocInfo() {
+    ScopedCritSec scope(&ctxAccess);
+    if (_infoLoaded)
+        return;
+    _infoLoaded = true;
+
     fz_try(ctx) {
         // keep a copy of the Info dictionary, as accessing the original
         // isn't thread safe and we don't want to block for this when
@@ -1650,16 +2124,20 @@ bool PdfEngineImpl::FinishLoading() {
         pdf_drop_obj(_info);
         _info = nullptr;
     }
+}
+
+void PdfEngineImpl::LoadPageLabels() {
+    ScopedCritSec scope(&ctxAccess);
+    if (_pagelabelsLoaded)
+        return;
+
     fz_try(ctx) {
         pdf_obj* pagelabels = pdf_dict_getp(pdf_trailer(_doc), "Root/PageLabels");
         if (pagelabels)
             _pagelabels = BuildPageLabelVec(pagelabels, PageCount());
     }
     fz_catch(ctx) { fz_warn(ctx, "Couldn't load page labels"); }
-
-    AssertCrash(!pdf_js_supported(_doc));
-
-    return true;
+    _pagelabelsLoaded = true;
 }
 
 PdfTocItem* PdfEngineImpl::BuildTocTree(fz_outline* entry, int& idCounter) {
@@ -1686,6 +2164,8 @@ PdfTocItem* PdfEngineImpl::BuildTocTree(fz_outline* entry, int& idCounter) {
 }
 
 DocTocItem* PdfEngineImpl::GetTocTree() {
+    LoadOutline();
+
     PdfTocItem* node = nullptr;
     int idCounter = 0;
 
@@ -1741,7 +2221,7 @@ pdf_page* PdfEngineImpl::GetPdfPage(int pageNo, bool failIfBusy) {
         ScopedCritSec ctxScope(&ctxAccess);
         fz_var(page);
         fz_try(ctx) {
-            page = pdf_load_page_by_obj(_doc, pageNo - 1, _pageObjs[pageNo - 1]);
+            page = pdf_load_page_by_obj(_doc, pageNo - 1, GetPageObj(pageNo));
             _pages[pageNo - 1] = page;
             LinkifyPageText(page);
             pageAnnots[pageNo - 1] = ProcessPageAnnotations(page);
@@ -1785,7 +2265,8 @@ PdfPageRun* PdfEngineImpl::CreatePageRun(pdf_page* page, fz_display_list* list)
         }
     }
 
-    return new PdfPageRun(page, list, data);
+    size_t size = fz_display_list_size(ctx, list);
+    return new PdfPageRun(page, list, size, data.uses_type3_fonts);
 }
 
 PdfPageRun* PdfEngineImpl::GetPageRun(pdf_page* page, bool tryOnly) {
@@ -1793,27 +2274,8 @@ PdfPageRun* PdfEngineImpl::GetPageRun(pdf_page* page, bool tryOnly) {
 
     ScopedCritSec scope(&pagesAccess);
 
-    for (size_t i = 0; i < runCache.size(); i++) {
-        if (runCache.at(i)->page == page) {
-            result = runCache.at(i);
-            break;
-        }
-    }
+    result = runCache.Find(page);
     if (!result && !tryOnly) {
-        size_t mem = 0;
-        for (size_t i = 0; i < runCache.size(); i++) {
-            // drop page runs that take up too much memory due to huge images
-            // (except for the very recently used ones)
-            if (i >= 2 && mem + runCache.at(i)->size_est >= MAX_PAGE_RUN_MEMORY)
-                DropPageRun(runCache.at(i--), true);
-            else
-                mem += runCache.at(i)->size_est;
-        }
-        if (runCache.size() >= MAX_PAGE_RUN_CACHE) {
-            AssertCrash(runCache.size() == MAX_PAGE_RUN_CACHE);
-            DropPageRun(runCache.Last(), true);
-        }
-
         ScopedCritSec scope2(&ctxAccess);
 
         fz_display_list* list = nullptr;
@@ -1833,12 +2295,12 @@ PdfPageRun* PdfEngineImpl::GetPageRun(pdf_page* page, bool tryOnly) {
 
         if (list) {
             result = CreatePageRun(page, list);
-            runCache.InsertAt(0, result);
+            runCache.Add(result);
+            // drop the least recently used page runs exceeding the memory budget
+            while (PdfPageRun* victim = runCache.GetOverBudget()) {
+                DropPageRun(victim, true);
+            }
         }
-    } else if (result && result != runCache.at(0)) {
-        // keep the list Most Recently Used first
-        runCache.Remove(result);
-        runCache.InsertAt(0, result);
     }
 
     if (result)
@@ -1852,19 +2314,7 @@ bool PdfEngineImpl::RunPage(pdf_page* page, fz_device* dev, const fz_matrix* ctm
 
     PdfPageRun* run;
     if (RenderTarget::View == target && (run = GetPageRun(page, !cacheRun)) != nullptr) {
-        EnterCriticalSection(&ctxAccess);
-        Vec<PageAnnotation> pageAnnots = fz_get_user_page_annots(userAnnots, GetPageNo(page));
-        fz_try(ctx) {
-            fz_rect pagerect;
-            fz_begin_page(dev, pdf_bound_page(_doc, page, &pagerect), ctm);
-            fz_run_page_transparency(pageAnnots, dev, cliprect, false, page->transparency);
-            fz_run_display_list(run->list, dev, ctm, cliprect, cookie ? &cookie->cookie : nullptr);
-            fz_run_page_transparency(pageAnnots, dev, cliprect, true, page->transparency);
-            fz_run_user_page_annots(pageAnnots, dev, ctm, cliprect, cookie ? &cookie->cookie : nullptr);
-            fz_end_page(dev);
-        }
-        fz_catch(ctx) { ok = false; }
-        LeaveCriticalSection(&ctxAccess);
+        ok = RunPageList(run, dev, ctm, cliprect, cookie);
         DropPageRun(run);
     } else {
         ScopedCritSec scope(&ctxAccess);
@@ -1889,6 +2339,204 @@ bool PdfEngineImpl::RunPage(pdf_page* page, fz_device* dev, const fz_matrix* ctm
     return ok && !(cookie && cookie->cookie.abort);
 }
 
+// runs a cached display list through dev; if dev was created on one of
+// the cloned render contexts, this doesn't block any other thread
+bool PdfEngineImpl::RunPageList(PdfPageRun* run, fz_device* dev, const fz_matrix* ctm, const fz_rect* cliprect,
+                                FitzAbortCookie* cookie) {
+    fz_context* devCtx = dev->ctx;
+    bool ok = true;
+
+    EnterCriticalSection(&ctxAccess);
+    Vec<PageAnnotation> pageAnnots = fz_get_user_page_annots(userAnnots, GetPageNo(run->page));
+    if (devCtx != ctx)
+        LeaveCriticalSection(&ctxAccess);
+
+    fz_try(devCtx) {
+        fz_rect pagerect;
+        fz_begin_page(dev, pdf_bound_page(_doc, run->page, &pagerect), ctm);
+        fz_run_page_transparency(pageAnnots, dev, cliprect, false, run->page->transparency);
+        fz_run_display_list(run->list, dev, ctm, cliprect, cookie ? &cookie->cookie : nullptr);
+        fz_run_page_transparency(pageAnnots, dev, cliprect, true, run->page->transparency);
+        fz_run_user_page_annots(pageAnnots, dev, ctm, cliprect, cookie ? &cookie->cookie : nullptr);
+        fz_end_page(dev);
+    }
+    fz_catch(devCtx) { ok = false; }
+
+    if (devCtx == ctx)
+        LeaveCriticalSection(&ctxAccess);
+
+    return ok;
+}
+
+// rasterizes the part of a cached display list covered by band directly into
+// the corresponding rows of image, using a render context of its own
+bool PdfEngineImpl::RunPageListBand(PdfPageRun* run, fz_pixmap* image, const fz_irect* band, const fz_matrix* ctm,
+                                    FitzAbortCookie* cookie) {
+    fz_context* bandCtx = GetRenderContext();
+    if (!bandCtx)
+        return false;
+
+    fz_pixmap* bandImage = nullptr;
+    fz_device* dev = nullptr;
+    fz_var(bandImage);
+    fz_var(dev);
+    fz_try(bandCtx) {
+        unsigned char* samples = image->samples + (size_t)(band->y0 - image->y) * image->w * image->n;
+        bandImage = fz_new_pixmap_with_bbox_and_data(bandCtx, image->colorspace, band, samples);
+        dev = fz_new_draw_device(bandCtx, bandImage);
+    }
+    fz_catch(bandCtx) {}
+
+    bool ok = false;
+    if (dev) {
+        fz_rect cliprect;
+        fz_rect_from_irect(&cliprect, band);
+        ok = RunPageList(run, dev, ctm, &cliprect, cookie);
+        fz_free_device(dev);
+    }
+    // the samples still belong to image
+    fz_drop_pixmap(bandCtx, bandImage);
+    ReleaseRenderContext(bandCtx);
+    return ok;
+}
+
+// bands of all documents are rendered on the same few threads
+// (in addition to the render threads, which each render a first band themselves)
+static WorkScheduler& GetBandScheduler() {
+    static WorkScheduler scheduler(DefaultWorkerCount(MAX_RENDER_BANDS) - 1);
+    return scheduler;
+}
+
+namespace {
+
+// state shared by the bands of a RunPageListBanded call
+struct RenderBandsState {
+    std::function<bool(int band, FitzAbortCookie* cookie)> renderBand;
+    FitzAbortCookie* parentCookie = nullptr;
+
+    std::mutex mutex;
+    // signaled whenever a queued band is done (or has been dropped)
+    std::condition_variable bandDone;
+    int queuedDone = 0;
+    bool ok[MAX_RENDER_BANDS] = {false};
+
+    void RunBand(int band, FitzAbortCookie* cookie) {
+        if (parentCookie)
+            parentCookie->AddBand(cookie);
+        bool bandOk = renderBand(band, cookie) && !cookie->cookie.abort;
+        if (parentCookie)
+            parentCookie->RemoveBand(cookie);
+        std::lock_guard<std::mutex> lock(mutex);
+        ok[band] = bandOk;
+    }
+};
+
+class RenderBandItem : public WorkItem {
+    RenderBandsState* state;
+    int band;
+    FitzAbortCookie cookie;
+
+  public:
+    RenderBandItem(RenderBandsState* state, int band) : state(state), band(band) {}
+
+    // also called for bands which the scheduler drops without running them
+    virtual ~RenderBandItem() {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->queuedDone++;
+        state->bandDone.notify_all();
+    }
+
+    virtual void Run() { state->RunBand(band, &cookie); }
+    virtual void Abort() { cookie.Abort(); }
+};
+
+} // namespace
+
+// splits image into horizontal bands which are rendered in parallel, so that
+// rendering a single large page (e.g. a map at high zoom) scales with the cores.
+// Returns false if banding isn't worth it or failed (the caller should then render image as a whole,
+// and image is white again, as completed bands would otherwise be drawn over a second time)
+bool PdfEngineImpl::RunPageListBanded(fz_context* renderCtx, PdfPageRun* run, fz_pixmap* image,
+                                      const fz_matrix* ctm, FitzAbortCookie* cookie) {
+    if ((size_t)image->w * image->h < MIN_BANDED_RENDER_PIXELS)
+        return false;
+    int bandCount = std::min(DefaultWorkerCount(MAX_RENDER_BANDS), image->h / MIN_RENDER_BAND_HEIGHT);
+    if (bandCount < 2)
+        return false;
+
+    fz_irect bands[MAX_RENDER_BANDS];
+    int bandHeight = (image->h + bandCount - 1) / bandCount;
+    for (int i = 0; i < bandCount; i++) {
+        bands[i].x0 = image->x;
+        bands[i].x1 = image->x + image->w;
+        bands[i].y0 = image->y + i * bandHeight;
+        bands[i].y1 = std::min(bands[i].y0 + bandHeight, image->y + image->h);
+    }
+
+    RenderBandsState state;
+    state.renderBand = [&](int band, FitzAbortCookie* bandCookie) {
+        return RunPageListBand(run, image, &bands[band], ctm, bandCookie);
+    };
+    state.parentCookie = cookie;
+
+    // the current thread renders the first band itself
+    WorkScheduler& scheduler = GetBandScheduler();
+    for (int i = 1; i < bandCount; i++) {
+        scheduler.Push(new RenderBandItem(&state, i));
+    }
+    FitzAbortCookie firstCookie;
+    state.RunBand(0, &firstCookie);
+    {
+        std::unique_lock<std::mutex> lock(state.mutex);
+        state.bandDone.wait(lock, [&] { return state.queuedDone == bandCount - 1; });
+    }
+
+    // an aborted image is discarded anyway
+    if (cookie && cookie->cookie.abort)
+        return true;
+    for (int i = 0; i < bandCount; i++) {
+        if (!state.ok[i]) {
+            fz_clear_pixmap_with_value(renderCtx, image, 0xFF);
+            return false;
+        }
+    }
+    return true;
+}
+
+fz_context* PdfEngineImpl::GetRenderContext() {
+    {
+        ScopedCritSec scope(&renderCtxAccess);
+        if (renderCtxPool.size() > 0)
+            return renderCtxPool.Pop();
+    }
+    ScopedCritSec scope(&ctxAccess);
+    return fz_clone_context(ctx);
+}
+
+void PdfEngineImpl::ReleaseRenderContext(fz_context* renderCtx) {
+    ScopedCritSec scope(&renderCtxAccess);
+    renderCtxPool.Append(renderCtx);
+}
+
+bool PdfEngineImpl::PrefetchPage(int pageNo) {
+    pdf_page* page = GetPdfPage(pageNo);
+    if (!page)
+        return false;
+    PdfPageRun* run = GetPageRun(page);
+    if (!run)
+        return false;
+    DropPageRun(run);
+    return true;
+}
+
+void PdfEngineImpl::SetPageCacheBudget(size_t maxBytes) {
+    ScopedCritSec scope(&pagesAccess);
+    runCache.SetMaxBytes(maxBytes);
+    while (PdfPageRun* victim = runCache.GetOverBudget()) {
+        DropPageRun(victim, true);
+    }
+}
+
 void PdfEngineImpl::DropPageRun(PdfPageRun* run, bool forceRemove) {
     ScopedCritSec scope(&pagesAccess);
     run->refs--;
@@ -1905,15 +2553,15 @@ void PdfEngineImpl::DropPageRun(PdfPageRun* run, bool forceRemove) {
 
 RectD PdfEngineImpl::PageMediabox(int pageNo) {
     AssertCrash(1 <= pageNo && pageNo <= PageCount());
+
+    ScopedCritSec scope(&ctxAccess);
     if (!_mediaboxes[pageNo - 1].IsEmpty())
         return _mediaboxes[pageNo - 1];
 
-    pdf_obj* page = _pageObjs[pageNo - 1];
+    pdf_obj* page = GetPageObj(pageNo);
     if (!page)
         return RectD();
 
-    ScopedCritSec scope(&ctxAccess);
-
     // cf. pdf-page.c's pdf_load_page
     fz_rect mbox = fz_empty_rect, cbox = fz_empty_rect;
     int rotate = 0;
@@ -2012,39 +2660,67 @@ RenderedBitmap* PdfEngineImpl::RenderBitmap(int pageNo, float zoom, int rotation
     fz_irect bbox;
     fz_round_rect(&bbox, fz_transform_rect(&r, &ctm));
 
+    // cached display lists are rasterized on a cloned context, so that several
+    // pages can be rendered at once (Type 3 glyphs need the document's context, though)
+    PdfPageRun* run = nullptr;
+    fz_context* renderCtx = nullptr;
+    if (RenderTarget::View == target && (run = GetPageRun(page)) != nullptr && !run->uses_type3_fonts)
+        renderCtx = GetRenderContext();
+    if (!renderCtx)
+        renderCtx = ctx;
+
+    // rasterize straight into GDI's format (must outlive image)
+    FitzDibSection dib;
     fz_pixmap* image = nullptr;
-    EnterCriticalSection(&ctxAccess);
-    fz_try(ctx) {
-        fz_colorspace* colorspace = fz_device_rgb(ctx);
-        image = fz_new_pixmap_with_bbox(ctx, colorspace, &bbox);
-        fz_clear_pixmap_with_value(ctx, image, 0xFF); // initialize white background
+    fz_device* dev = nullptr;
+    fz_var(image);
+    fz_var(dev);
+    if (renderCtx == ctx)
+        EnterCriticalSection(&ctxAccess);
+    fz_try(renderCtx) {
+        fz_colorspace* colorspace = fz_device_bgr(renderCtx);
+        image = fz_new_pixmap_with_bbox_and_allocator(renderCtx, colorspace, &bbox, &dib.allocator);
+        fz_clear_pixmap_with_value(renderCtx, image, 0xFF); // initialize white background
+        dev = fz_new_draw_device(renderCtx, image);
     }
-    fz_catch(ctx) {
-        LeaveCriticalSection(&ctxAccess);
-        return nullptr;
+    fz_catch(renderCtx) {
+        fz_drop_pixmap(renderCtx, image);
+        image = nullptr;
     }
-
-    fz_device* dev = nullptr;
-    fz_try(ctx) { dev = fz_new_draw_device(ctx, image); }
-    fz_catch(ctx) {
-        fz_drop_pixmap(ctx, image);
+    if (renderCtx == ctx)
         LeaveCriticalSection(&ctxAccess);
-        return nullptr;
-    }
-    LeaveCriticalSection(&ctxAccess);
-
-    FitzAbortCookie* cookie = nullptr;
-    if (cookie_out)
-        *cookie_out = cookie = new FitzAbortCookie();
-    fz_rect cliprect;
-    bool ok = RunPage(page, dev, &ctm, target, fz_rect_from_irect(&cliprect, &bbox), true, cookie);
 
-    ScopedCritSec scope(&ctxAccess);
+    bool ok = false;
+    if (dev) {
+        FitzAbortCookie* cookie = nullptr;
+        if (cookie_out)
+            *cookie_out = cookie = new FitzAbortCookie();
+        fz_rect cliprect;
+        fz_rect_from_irect(&cliprect, &bbox);
+        if (run && renderCtx != ctx) {
+            // large bitmaps are drawn by several threads at once, each into its own band of image
+            bool banded = RunPageListBanded(renderCtx, run, image, &ctm, cookie);
+            ok = banded || RunPageList(run, dev, &ctm, &cliprect, cookie);
+            ok = ok && !(cookie && cookie->cookie.abort);
+            fz_free_device(dev);
+        } else {
+            ok = RunPage(page, dev, &ctm, target, &cliprect, true, cookie);
+        }
+    }
 
     RenderedBitmap* bitmap = nullptr;
+    if (renderCtx == ctx)
+        EnterCriticalSection(&ctxAccess);
     if (ok)
-        bitmap = new_rendered_fz_pixmap(ctx, image);
-    fz_drop_pixmap(ctx, image);
+        bitmap = new_rendered_fz_pixmap(renderCtx, image, &dib);
+    fz_drop_pixmap(renderCtx, image);
+    if (renderCtx == ctx)
+        LeaveCriticalSection(&ctxAccess);
+
+    if (renderCtx != ctx)
+        ReleaseRenderContext(renderCtx);
+    if (run)
+        DropPageRun(run);
     return bitmap;
 }
 
@@ -2242,8 +2918,8 @@ RenderedBitmap* PdfEngineImpl::GetPageImage(int pageNo, RectD rect, size_t image
     return bmp;
 }
 
-WCHAR* PdfEngineImpl::ExtractPageText(pdf_page* page, const WCHAR* lineSep, RectI** coordsOut, RenderTarget target,
-                                      bool cacheRun) {
+fz_text_page* PdfEngineImpl::NewTextPage(pdf_page* page, fz_text_sheet** sheetOut, RenderTarget target,
+                                         bool cacheRun) {
     if (!page)
         return nullptr;
 
@@ -2274,37 +2950,75 @@ WCHAR* PdfEngineImpl::ExtractPageText(pdf_page* page, const WCHAR* lineSep, Rect
     // the extracted text is consistent between cached runs using a list device and
     // fresh runs (otherwise the list device omits text outside the mediabox bounds)
     bool ok = RunPage(page, dev, &fz_identity, target, nullptr, cacheRun);
+    if (!ok) {
+        ScopedCritSec scope(&ctxAccess);
+        fz_free_text_page(ctx, text);
+        fz_free_text_sheet(ctx, sheet);
+        return nullptr;
+    }
+
+    *sheetOut = sheet;
+    return text;
+}
+
+WCHAR* PdfEngineImpl::ExtractPageText(pdf_page* page, const WCHAR* lineSep, RectI** coordsOut, RenderTarget target,
+                                      bool cacheRun) {
+    fz_text_sheet* sheet;
+    fz_text_page* text = NewTextPage(page, &sheet, target, cacheRun);
+    if (!text)
+        return nullptr;
 
     ScopedCritSec scope(&ctxAccess);
 
-    WCHAR* content = nullptr;
-    if (ok)
-        content = fz_text_page_to_str(text, lineSep, coordsOut);
+    WCHAR* content = fz_text_page_to_str(text, lineSep, coordsOut);
     fz_free_text_page(ctx, text);
     fz_free_text_sheet(ctx, sheet);
 
     return content;
 }
 
-WCHAR* PdfEngineImpl::ExtractPageText(int pageNo, const WCHAR* lineSep, RectI** coordsOut, RenderTarget target) {
+pdf_page* PdfEngineImpl::GetTextPage(int pageNo, bool* isTemporary) {
     pdf_page* page = GetPdfPage(pageNo, true);
+    *isTemporary = !page;
     if (page)
-        return ExtractPageText(page, lineSep, coordsOut, target);
+        return page;
 
-    EnterCriticalSection(&ctxAccess);
-    fz_try(ctx) { page = pdf_load_page_by_obj(_doc, pageNo - 1, _pageObjs[pageNo - 1]); }
-    fz_catch(ctx) {
-        LeaveCriticalSection(&ctxAccess);
-        return nullptr;
-    }
-    LeaveCriticalSection(&ctxAccess);
-
-    WCHAR* result = ExtractPageText(page, lineSep, coordsOut, target);
+    ScopedCritSec scope(&ctxAccess);
+    fz_try(ctx) { page = pdf_load_page_by_obj(_doc, pageNo - 1, GetPageObj(pageNo)); }
+    fz_catch(ctx) { page = nullptr; }
+    return page;
+}
 
-    EnterCriticalSection(&ctxAccess);
+void PdfEngineImpl::ReleaseTextPage(pdf_page* page, bool isTemporary) {
+    if (!page || !isTemporary)
+        return;
+    ScopedCritSec scope(&ctxAccess);
     pdf_free_page(_doc, page);
-    LeaveCriticalSection(&ctxAccess);
+}
+
+WCHAR* PdfEngineImpl::ExtractPageText(int pageNo, const WCHAR* lineSep, RectI** coordsOut, RenderTarget target) {
+    bool isTemporary;
+    pdf_page* page = GetTextPage(pageNo, &isTemporary);
+    WCHAR* result = ExtractPageText(page, lineSep, coordsOut, target);
+    ReleaseTextPage(page, isTemporary);
+    return result;
+}
 
+// searches an index of the page's fz_text_page instead of its extracted text, which saves
+// converting the text and computing glyph boxes for pages without any hits
+bool PdfEngineImpl::PageMightContainText(int pageNo, const WCHAR* text) {
+    bool isTemporary;
+    pdf_page* page = GetTextPage(pageNo, &isTemporary);
+    fz_text_sheet* sheet;
+    fz_text_page* textPage = NewTextPage(page, &sheet, RenderTarget::View, false);
+    bool result = true;
+    if (textPage) {
+        ScopedCritSec scope(&ctxAccess);
+        result = fz_text_page_might_contain(ctx, textPage, text);
+        fz_free_text_page(ctx, textPage);
+        fz_free_text_sheet(ctx, sheet);
+    }
+    ReleaseTextPage(page, isTemporary);
     return result;
 }
 
@@ -2331,7 +3045,7 @@ bool PdfEngineImpl::IsLinearizedFile() {
     if (pdf_to_int(pdf_dict_gets(obj, "L")) != _doc->file_size)
         return false;
     // /O must be the object number of the first page
-    if (pdf_to_int(pdf_dict_gets(obj, "O")) != pdf_to_num(_pageObjs[0]))
+    if (pdf_to_int(pdf_dict_gets(obj, "O")) != pdf_to_num(GetPageObj(1)))
         return false;
     // /N must be the total number of pages
     if (pdf_to_int(pdf_dict_gets(obj, "N")) != PageCount())
@@ -2482,6 +3196,11 @@ WCHAR* PdfEngineImpl::GetProperty(DocumentProperty prop) {
         return str::Format(L"%d.%d", major, minor);
     }
 
+    if (DocumentProperty::FontList == prop)
+        return ExtractFontList();
+
+    LoadDocInfo();
+
     if (DocumentProperty::PdfFileStructure == prop) {
         WStrVec fstruct;
         if (pdf_to_bool(pdf_dict_gets(_info, "Linearized")))
@@ -2504,9 +3223,6 @@ WCHAR* PdfEngineImpl::GetProperty(DocumentProperty prop) {
         return nullptr;
     }
 
-    if (DocumentProperty::FontList == prop)
-        return ExtractFontList();
-
     static struct {
         DocumentProperty prop;
         const char* name;
@@ -2534,6 +3250,7 @@ WCHAR* PdfEngineImpl::GetProperty(DocumentProperty prop) {
 bool PdfEngineImpl::SupportsAnnotation(bool forSaving) const {
     if (forSaving) {
         // TODO: support updating of documents where pages aren't all numbered objects?
+        const_cast<PdfEngineImpl*>(this)->LoadAllPageObjs();
         for (int i = 0; i < PageCount(); i++) {
             if (pdf_to_num(_pageObjs[i]) == 0)
                 return false;
@@ -2753,10 +3470,14 @@ bool PdfEngineImpl::SaveUserAnnots(const char* pathUtf8) {
     ScopedCritSec scope1(&pagesAccess);
     ScopedCritSec scope2(&ctxAccess);
 
+    LoadAllPageObjs();
+
     bool ok = true;
     Vec<PageAnnotation> pageAnnots;
 
     fz_try(ctx) {
+        // incremental updates need the document's complete xref
+        pdf_load_complete_xref(_doc);
         for (int pageNo = 1; pageNo <= PageCount(); pageNo++) {
             pdf_page* page = GetPdfPage(pageNo);
             // TODO: this will skip annotations for broken documents
@@ -2819,6 +3540,7 @@ bool PdfEngineImpl::HasClipOptimizations(int pageNo) {
 }
 
 WCHAR* PdfEngineImpl::GetPageLabel(int pageNo) const {
+    const_cast<PdfEngineImpl*>(this)->LoadPageLabels();
     if (!_pagelabels || pageNo < 1 || PageCount() < pageNo)
         return BaseEngine::GetPageLabel(pageNo);
 
@@ -2826,6 +3548,7 @@ WCHAR* PdfEngineImpl::GetPageLabel(int pageNo) const {
 }
 
 int PdfEngineImpl::GetPageByLabel(const WCHAR* label) const {
+    const_cast<PdfEngineImpl*>(this)->LoadPageLabels();
     int pageNo = _pagelabels ? _pagelabels->Find(label) + 1 : 0;
     if (!pageNo)
         return BaseEngine::GetPageByLabel(label);
@@ -3199,15 +3922,7 @@ xps_doc_props* xps_extract_doc_props(xps_document* doc) {
 
 ///// XpsEngine is also based on Fitz and shares quite some code with PdfEngine /////
 
-struct XpsPageRun {
-    xps_page* page;
-    fz_display_list* list;
-    size_t size_est;
-    int refs;
-
-    XpsPageRun(xps_page* page, fz_display_list* list, ListInspectionData& data)
-        : page(page), list(list), size_est(data.mem_estimate), refs(1) {}
-};
+typedef FitzPageRun<xps_page> XpsPageRun;
 
 class XpsTocItem;
 class XpsImage;
@@ -3239,6 +3954,7 @@ class XpsEngineImpl : public BaseEngine {
         UNUSED(target);
         return ExtractPageText(GetXpsPage(pageNo), lineSep, coordsOut);
     }
+    bool PageMightContainText(int pageNo, const WCHAR* text) override;
     bool HasClipOptimizations(int pageNo) override;
     WCHAR* GetProperty(DocumentProperty prop) override;
 
@@ -3249,6 +3965,8 @@ class XpsEngineImpl : public BaseEngine {
     const WCHAR* GetDefaultFileExt() const override { return L".xps"; }
 
     bool BenchLoadPage(int pageNo) override { return GetXpsPage(pageNo) != nullptr; }
+    bool PrefetchPage(int pageNo) override;
+    void SetPageCacheBudget(size_t maxBytes) override;
 
     Vec<PageElement*>* GetElements(int pageNo) override;
     PageElement* GetElementAtPos(int pageNo, PointD pt) override;
@@ -3267,7 +3985,7 @@ class XpsEngineImpl : public BaseEngine {
     // protected critical section in order to avoid deadlocks
     CRITICAL_SECTION ctxAccess;
     fz_context* ctx;
-    fz_locks_context fz_locks_ctx;
+    FitzLocks fzLocks;
     xps_document* _doc;
     fz_stream* _docStream;
 
@@ -3290,8 +4008,11 @@ class XpsEngineImpl : public BaseEngine {
         return fz_create_view_ctm(xps_bound_page(_doc, page, &r), zoom, rotation);
     }
     WCHAR* ExtractPageText(xps_page* page, const WCHAR* lineSep, RectI** coordsOut = nullptr, bool cacheRun = false);
+    // runs page through a text device, the caller must free the result and *sheetOut
+    // (with ctxAccess held). Returns nullptr on failure
+    fz_text_page* NewTextPage(xps_page* page, fz_text_sheet** sheetOut, bool cacheRun);
 
-    Vec<XpsPageRun*> runCache; // ordered most recently used first
+    FitzPageRunCache<xps_page> runCache;
     XpsPageRun* CreatePageRun(xps_page* page, fz_display_list* list);
     XpsPageRun* GetPageRun(xps_page* page, bool tryOnly = false);
     bool RunPage(xps_page* page, fz_device* dev, const fz_matrix* ctm, const fz_rect* cliprect = nullptr,
@@ -3392,10 +4113,9 @@ XpsEngineImpl::XpsEngineImpl()
     InitializeCriticalSection(&_pagesAccess);
     InitializeCriticalSection(&ctxAccess);
 
-    fz_locks_ctx.user = &ctxAccess;
-    fz_locks_ctx.lock = fz_lock_context_cs;
-    fz_locks_ctx.unlock = fz_unlock_context_cs;
-    ctx = fz_new_context(nullptr, &fz_locks_ctx, MAX_CONTEXT_MEMORY);
+    ctx = fz_new_context(nullptr, &fzLocks.locks, MAX_CONTEXT_MEMORY);
+    if (ctx)
+        fz_set_scan_converter(ctx, gScanConverter);
 }
 
 XpsEngineImpl::~XpsEngineImpl() {
@@ -3417,9 +4137,9 @@ XpsEngineImpl::~XpsEngineImpl() {
         free(imageRects);
     }
 
-    while (runCache.size() > 0) {
-        AssertCrash(runCache.Last()->refs == 1);
-        DropPageRun(runCache.Last(), true);
+    while (runCache.LeastRecentlyUsed()) {
+        AssertCrash(runCache.LeastRecentlyUsed()->refs == 1);
+        DropPageRun(runCache.LeastRecentlyUsed(), true);
     }
 
     xps_close_document(_doc);
@@ -3585,7 +4305,8 @@ XpsPageRun* XpsEngineImpl::CreatePageRun(xps_page* page, fz_display_list* list)
         }
     }
 
-    return new XpsPageRun(page, list, data);
+    size_t size = fz_display_list_size(ctx, list);
+    return new XpsPageRun(page, list, size, data.uses_type3_fonts);
 }
 
 XpsPageRun* XpsEngineImpl::GetPageRun(xps_page* page, bool tryOnly) {
@@ -3593,27 +4314,8 @@ XpsPageRun* XpsEngineImpl::GetPageRun(xps_page* page, bool tryOnly) {
 
     XpsPageRun* result = nullptr;
 
-    for (size_t i = 0; i < runCache.size(); i++) {
-        if (runCache.at(i)->page == page) {
-            result = runCache.at(i);
-            break;
-        }
-    }
+    result = runCache.Find(page);
     if (!result && !tryOnly) {
-        size_t mem = 0;
-        for (size_t i = 0; i < runCache.size(); i++) {
-            // drop page runs that take up too much memory due to huge images
-            // (except for the very recently used ones)
-            if (i >= 2 && mem + runCache.at(i)->size_est >= MAX_PAGE_RUN_MEMORY)
-                DropPageRun(runCache.at(i--), true);
-            else
-                mem += runCache.at(i)->size_est;
-        }
-        if (runCache.size() >= MAX_PAGE_RUN_CACHE) {
-            AssertCrash(runCache.size() == MAX_PAGE_RUN_CACHE);
-            DropPageRun(runCache.Last(), true);
-        }
-
         ScopedCritSec ctxScope(&ctxAccess);
 
         fz_display_list* list = nullptr;
@@ -3633,12 +4335,12 @@ XpsPageRun* XpsEngineImpl::GetPageRun(xps_page* page, bool tryOnly) {
 
         if (list) {
             result = CreatePageRun(page, list);
-            runCache.InsertAt(0, result);
+            runCache.Add(result);
+            // drop the least recently used page runs exceeding the memory budget
+            while (XpsPageRun* victim = runCache.GetOverBudget()) {
+                DropPageRun(victim, true);
+            }
         }
-    } else if (result && result != runCache.at(0)) {
-        // keep the list Most Recently Used first
-        runCache.Remove(result);
-        runCache.InsertAt(0, result);
     }
 
     if (result)
@@ -3688,6 +4390,25 @@ bool XpsEngineImpl::RunPage(xps_page* page, fz_device* dev, const fz_matrix* ctm
     return ok && !(cookie && cookie->cookie.abort);
 }
 
+bool XpsEngineImpl::PrefetchPage(int pageNo) {
+    xps_page* page = GetXpsPage(pageNo);
+    if (!page)
+        return false;
+    XpsPageRun* run = GetPageRun(page);
+    if (!run)
+        return false;
+    DropPageRun(run);
+    return true;
+}
+
+void XpsEngineImpl::SetPageCacheBudget(size_t maxBytes) {
+    ScopedCritSec scope(&_pagesAccess);
+    runCache.SetMaxBytes(maxBytes);
+    while (XpsPageRun* victim = runCache.GetOverBudget()) {
+        DropPageRun(victim, true);
+    }
+}
+
 void XpsEngineImpl::DropPageRun(XpsPageRun* run, bool forceRemove) {
     ScopedCritSec scope(&_pagesAccess);
     run->refs--;
@@ -3793,11 +4514,13 @@ RenderedBitmap* XpsEngineImpl::RenderBitmap(int pageNo, float zoom, int rotation
     fz_irect bbox;
     fz_round_rect(&bbox, fz_transform_rect(&r, &ctm));
 
+    // rasterize straight into GDI's format (must outlive image)
+    FitzDibSection dib;
     fz_pixmap* image = nullptr;
     EnterCriticalSection(&ctxAccess);
     fz_try(ctx) {
-        fz_colorspace* colorspace = fz_device_rgb(ctx);
-        image = fz_new_pixmap_with_bbox(ctx, colorspace, &bbox);
+        fz_colorspace* colorspace = fz_device_bgr(ctx);
+        image = fz_new_pixmap_with_bbox_and_allocator(ctx, colorspace, &bbox, &dib.allocator);
         fz_clear_pixmap_with_value(ctx, image, 0xFF); // initialize white background
     }
     fz_catch(ctx) {
@@ -3824,12 +4547,12 @@ RenderedBitmap* XpsEngineImpl::RenderBitmap(int pageNo, float zoom, int rotation
 
     RenderedBitmap* bitmap = nullptr;
     if (ok)
-        bitmap = new_rendered_fz_pixmap(ctx, image);
+        bitmap = new_rendered_fz_pixmap(ctx, image, &dib);
     fz_drop_pixmap(ctx, image);
     return bitmap;
 }
 
-WCHAR* XpsEngineImpl::ExtractPageText(xps_page* page, const WCHAR* lineSep, RectI** coordsOut, bool cacheRun) {
+fz_text_page* XpsEngineImpl::NewTextPage(xps_page* page, fz_text_sheet** sheetOut, bool cacheRun) {
     if (!page)
         return nullptr;
 
@@ -3861,6 +4584,16 @@ WCHAR* XpsEngineImpl::ExtractPageText(xps_page* page, const WCHAR* lineSep, Rect
     // fresh runs (otherwise the list device omits text outside the mediabox bounds)
     RunPage(page, dev, &fz_identity, nullptr, cacheRun);
 
+    *sheetOut = sheet;
+    return text;
+}
+
+WCHAR* XpsEngineImpl::ExtractPageText(xps_page* page, const WCHAR* lineSep, RectI** coordsOut, bool cacheRun) {
+    fz_text_sheet* sheet;
+    fz_text_page* text = NewTextPage(page, &sheet, cacheRun);
+    if (!text)
+        return nullptr;
+
     ScopedCritSec scope(&ctxAccess);
 
     WCHAR* content = fz_text_page_to_str(text, lineSep, coordsOut);
@@ -3870,6 +4603,20 @@ WCHAR* XpsEngineImpl::ExtractPageText(xps_page* page, const WCHAR* lineSep, Rect
     return content;
 }
 
+// cf. PdfEngineImpl::PageMightContainText
+bool XpsEngineImpl::PageMightContainText(int pageNo, const WCHAR* text) {
+    fz_text_sheet* sheet;
+    fz_text_page* textPage = NewTextPage(GetXpsPage(pageNo), &sheet, false);
+    if (!textPage)
+        return true;
+
+    ScopedCritSec scope(&ctxAccess);
+    bool result = fz_text_page_might_contain(ctx, textPage, text);
+    fz_free_text_page(ctx, textPage);
+    fz_free_text_sheet(ctx, sheet);
+    return result;
+}
+
 u8* XpsEngineImpl::GetFileData(size_t* cbCount) {
     u8* res = nullptr;
     ScopedCritSec scope(&ctxAccess);
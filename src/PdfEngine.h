@@ -16,3 +16,7 @@ BaseEngine* CreateFromFile(const WCHAR* fileName);
 BaseEngine* CreateFromStream(IStream* stream);
 
 } // namespace XpsEngine
+
+// if true, filled paths are anti-aliased by the exact area they cover in each pixel
+// (cf. fz_set_scan_converter). Applies to PDF and XPS documents opened afterwards
+void SetExactAntiAliasing(bool exact);
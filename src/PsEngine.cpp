@@ -303,6 +303,10 @@ class PsEngineImpl : public BaseEngine {
 
     bool BenchLoadPage(int pageNo) override { return pdfEngine->BenchLoadPage(pageNo); }
 
+    bool PrefetchPage(int pageNo) override { return pdfEngine->PrefetchPage(pageNo); }
+
+    void SetPageCacheBudget(size_t maxBytes) override { pdfEngine->SetPageCacheBudget(maxBytes); }
+
     Vec<PageElement*>* GetElements(int pageNo) override { return pdfEngine->GetElements(pageNo); }
 
     PageElement* GetElementAtPos(int pageNo, PointD pt) override { return pdfEngine->GetElementAtPos(pageNo, pt); }
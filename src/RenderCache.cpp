@@ -4,6 +4,7 @@
 #include "BaseUtil.h"
 #include "ScopedWin.h"
 #include "WinUtil.h"
+#include "WorkScheduler.h"
 #include "BaseEngine.h"
 #include "EngineManager.h"
 #include "SettingsStructs.h"
@@ -24,29 +25,83 @@
 // define to view the tile boundaries
 #undef SHOW_TILE_LAYOUT
 
+// a PageRenderRequest as queued for one of the rendering threads
+class PageRenderItem : public WorkItem {
+  public:
+    RenderCache* cache;
+    PageRenderRequest req;
+
+    PageRenderItem(RenderCache* cache, const PageRenderRequest& req, RenderPriority priority)
+        : WorkItem((int)priority), cache(cache), req(req) {}
+    ~PageRenderItem() override {
+        // let the caller know that the request has been dropped or aborted
+        if (req.renderCb)
+            req.renderCb->Callback();
+        delete req.abortCookie;
+    }
+
+    void Run() override { cache->RenderRequest(req); }
+
+    void Abort() override {
+        req.abort = true;
+        if (req.abortCookie)
+            req.abortCookie->Abort();
+    }
+};
+
+static PageRenderRequest& GetRequest(WorkItem* item) {
+    return static_cast<PageRenderItem*>(item)->req;
+}
+
+// use up to an eighth of the physical memory for cached bitmaps
+static size_t GetBitmapCacheBudget() {
+    MEMORYSTATUSEX mem = {0};
+    mem.dwLength = sizeof(mem);
+    if (!GlobalMemoryStatusEx(&mem))
+        return MIN_BITMAP_CACHE_BYTES;
+    DWORDLONG budget = limitValue(mem.ullTotalPhys / 8, (DWORDLONG)MIN_BITMAP_CACHE_BYTES,
+                                  (DWORDLONG)MAX_BITMAP_CACHE_BYTES);
+    return (size_t)budget;
+}
+
+static size_t GetBitmapBytes(RenderedBitmap* bmp) {
+    if (!bmp)
+        return 0;
+    BITMAP info;
+    if (GetObject(bmp->GetBitmap(), sizeof(info), &info) == sizeof(info))
+        return (size_t)info.bmWidthBytes * abs(info.bmHeight);
+    SizeI size = bmp->Size();
+    return (size_t)size.dx * size.dy * 4;
+}
+
 RenderCache::RenderCache()
-    : cacheCount(0),
-      requestCount(0),
+    : lruFirst(nullptr),
+      lruLast(nullptr),
+      cacheCount(0),
+      cacheBytes(0),
+      maxCacheBytes(GetBitmapCacheBudget()),
       maxTileSize(GetSystemMetrics(SM_CXSCREEN), GetSystemMetrics(SM_CYSCREEN)),
       isRemoteSession(GetSystemMetrics(SM_REMOTESESSION)) {
+    ZeroMemory(buckets, sizeof(buckets));
+    ZeroMemory(&stats, sizeof(stats));
     textColor = WIN_COL_BLACK;
     backgroundColor = WIN_COL_WHITE;
 
     InitializeCriticalSection(&cacheAccess);
     InitializeCriticalSection(&requestAccess);
 
-    startRendering = CreateEvent(nullptr, FALSE, FALSE, nullptr);
-    renderThread = CreateThread(nullptr, 0, RenderCacheThread, this, 0, 0);
-    AssertCrash(nullptr != renderThread);
+    renderQueue = new WorkScheduler(DefaultWorkerCount(MAX_RENDER_THREADS), (int)RenderPriority::Count,
+                                    MAX_PAGE_REQUESTS);
 }
 
 RenderCache::~RenderCache() {
+    AssertCrash(0 == renderQueue->QueuedCount() && 0 == renderQueue->RunningCount());
+    delete renderQueue;
+
     EnterCriticalSection(&requestAccess);
     EnterCriticalSection(&cacheAccess);
 
-    CloseHandle(renderThread);
-    CloseHandle(startRendering);
-    AssertCrash(!curReq && 0 == requestCount && 0 == cacheCount);
+    AssertCrash(0 == cacheCount);
 
     LeaveCriticalSection(&cacheAccess);
     DeleteCriticalSection(&cacheAccess);
@@ -60,10 +115,12 @@ RenderCache::~RenderCache() {
 BitmapCacheEntry* RenderCache::Find(DisplayModel* dm, int pageNo, int rotation, float zoom, TilePosition* tile) {
     ScopedCritSec scope(&cacheAccess);
     rotation = NormalizeRotation(rotation);
-    for (int i = 0; i < cacheCount; i++) {
-        BitmapCacheEntry* entry = cache[i];
+    for (BitmapCacheEntry* entry = Bucket(dm, pageNo); entry; entry = entry->bucketNext) {
         if ((dm == entry->dm) && (pageNo == entry->pageNo) && (rotation == entry->rotation) &&
             (INVALID_ZOOM == zoom || zoom == entry->zoom) && (!tile || entry->tile == *tile)) {
+            // mark the entry as most recently used
+            Unlink(entry);
+            Link(entry);
             entry->refs++;
             return entry;
         }
@@ -88,41 +145,115 @@ void RenderCache::DropCacheEntry(BitmapCacheEntry* entry) {
     }
 }
 
+BitmapCacheEntry*& RenderCache::Bucket(DisplayModel* dm, int pageNo) {
+    uintptr_t key[2] = {(uintptr_t)dm, (uintptr_t)pageNo};
+    return buckets[MurmurHash2(key, sizeof(key)) % BITMAP_CACHE_BUCKETS];
+}
+
+// adds entry to the index as the most recently used one
+void RenderCache::Link(BitmapCacheEntry* entry) {
+    BitmapCacheEntry*& bucket = Bucket(entry->dm, entry->pageNo);
+    entry->bucketNext = bucket;
+    bucket = entry;
+
+    entry->lruPrev = lruLast;
+    entry->lruNext = nullptr;
+    if (lruLast)
+        lruLast->lruNext = entry;
+    else
+        lruFirst = entry;
+    lruLast = entry;
+
+    cacheCount++;
+    cacheBytes += entry->bytes;
+}
+
+void RenderCache::Unlink(BitmapCacheEntry* entry) {
+    BitmapCacheEntry** next = &Bucket(entry->dm, entry->pageNo);
+    while (*next != entry) {
+        CrashIf(!*next);
+        next = &(*next)->bucketNext;
+    }
+    *next = entry->bucketNext;
+    entry->bucketNext = nullptr;
+
+    if (entry->lruPrev)
+        entry->lruPrev->lruNext = entry->lruNext;
+    else
+        lruFirst = entry->lruNext;
+    if (entry->lruNext)
+        entry->lruNext->lruPrev = entry->lruPrev;
+    else
+        lruLast = entry->lruPrev;
+    entry->lruPrev = entry->lruNext = nullptr;
+
+    cacheCount--;
+    cacheBytes -= entry->bytes;
+}
+
+// removes entry from the cache (it's deleted once it's no longer in use)
+void RenderCache::Evict(BitmapCacheEntry* entry) {
+    Unlink(entry);
+    DropCacheEntry(entry);
+}
+
+// evicts bitmaps until one more bitmap of the given size fits into the budget
+void RenderCache::MakeRoomFor(size_t bytes) {
+    auto isFull = [&]() { return cacheCount >= MAX_BITMAPS_CACHED || cacheBytes + bytes > maxCacheBytes; };
+
+    // free pages which are no longer visible (least recently used first) ...
+    BitmapCacheEntry* next;
+    for (BitmapCacheEntry* entry = lruFirst; entry && isFull(); entry = next) {
+        next = entry->lruNext;
+        if (!entry->dm->PageVisibleNearby(entry->pageNo)) {
+            Evict(entry);
+            stats.evictions++;
+        }
+    }
+    // ... or just the least recently used ones
+    while (lruFirst && isFull()) {
+        Evict(lruFirst);
+        stats.evictions++;
+    }
+}
+
 void RenderCache::Add(PageRenderRequest& req, RenderedBitmap* bitmap) {
     ScopedCritSec scope(&cacheAccess);
     AssertCrash(req.dm);
 
     req.rotation = NormalizeRotation(req.rotation);
-    AssertCrash(cacheCount <= MAX_BITMAPS_CACHED);
+
+    /* A preview is of no use if the full quality rendering has been faster
+       (bitmaps at other zoom levels don't count, they're about to be replaced) */
+    if (req.preview && Exists(req.dm, req.pageNo, req.rotation, req.dm->GetZoomReal(req.pageNo), &req.tile)) {
+        delete bitmap;
+        return;
+    }
+    if (req.preview)
+        stats.previews++;
 
     /* It's possible there still is a cached bitmap with different zoom/rotation */
     FreePage(req.dm, req.pageNo, &req.tile);
 
-    if (cacheCount >= MAX_BITMAPS_CACHED) {
-        // free an invisible page of the same DisplayModel ...
-        for (int i = 0; i < cacheCount; i++) {
-            if (cache[i]->dm == req.dm && !req.dm->PageVisibleNearby(cache[i]->pageNo)) {
-                DropCacheEntry(cache[i]);
-                cacheCount--;
-                memmove(&cache[i], &cache[i + 1], (cacheCount - i) * sizeof(cache[0]));
-                break;
-            }
-        }
-        // ... or just the oldest cached page
-        if (cacheCount >= MAX_BITMAPS_CACHED) {
-            DropCacheEntry(cache[0]);
-            cacheCount--;
-            memmove(&cache[0], &cache[1], cacheCount * sizeof(cache[0]));
-        }
-    }
+    size_t bytes = GetBitmapBytes(bitmap);
+    MakeRoomFor(bytes);
 
-    // Copy the PageRenderRequest as it will be reused
-    cache[cacheCount] = new BitmapCacheEntry(req.dm, req.pageNo, req.rotation, req.zoom, req.tile, bitmap);
-    CrashIf(!cache[cacheCount]);
-    if (!cache[cacheCount])
+    // Copy the PageRenderRequest as it will be deleted after rendering
+    BitmapCacheEntry* entry = new BitmapCacheEntry(req.dm, req.pageNo, req.rotation, req.zoom, req.tile, bitmap, bytes);
+    CrashIf(!entry);
+    if (!entry)
         delete bitmap;
     else
-        cacheCount++;
+        Link(entry);
+}
+
+RenderCacheStats RenderCache::GetStats() {
+    ScopedCritSec scope(&cacheAccess);
+    RenderCacheStats result = stats;
+    result.count = cacheCount;
+    result.bytes = cacheBytes;
+    result.maxBytes = maxCacheBytes;
+    return result;
 }
 
 static RectD GetTileRect(RectD pagerect, TilePosition tile) {
@@ -177,15 +308,13 @@ static bool IsTileVisible(DisplayModel* dm, int pageNo, TilePosition tile, float
    of the given DisplayModel, or even all invisible pages). */
 void RenderCache::FreePage(DisplayModel* dm, int pageNo, TilePosition* tile) {
     ScopedCritSec scope(&cacheAccess);
-    int cacheCountTmp = cacheCount;
-    int curPos = 0;
+    BitmapCacheEntry* next;
 
-    for (int i = 0; i < cacheCountTmp; i++) {
-        BitmapCacheEntry* entry = cache[i];
-        bool shouldFree;
-        if (dm && pageNo != INVALID_PAGE_NO) {
-            // a specific page
-            shouldFree = (entry->dm == dm) && (entry->pageNo == pageNo);
+    if (dm && pageNo != INVALID_PAGE_NO) {
+        // a specific page
+        for (BitmapCacheEntry* entry = Bucket(dm, pageNo); entry; entry = next) {
+            next = entry->bucketNext;
+            bool shouldFree = (entry->dm == dm) && (entry->pageNo == pageNo);
             if (tile) {
                 // a given tile of the page or all tiles not rendered at a given resolution
                 // (and at resolution 0 for quick zoom previews)
@@ -194,26 +323,26 @@ void RenderCache::FreePage(DisplayModel* dm, int pageNo, TilePosition* tile) {
                                    tile->row == (USHORT)-1 && entry->tile.res > 0 && entry->tile.res != tile->res ||
                                    tile->row == (USHORT)-1 && entry->tile.res == 0 && entry->outOfDate);
             }
-        } else if (dm) {
+            if (shouldFree)
+                Evict(entry);
+        }
+        return;
+    }
+
+    for (BitmapCacheEntry* entry = lruFirst; entry; entry = next) {
+        next = entry->lruNext;
+        bool shouldFree;
+        if (dm) {
             // all pages of this DisplayModel
-            shouldFree = (cache[i]->dm == dm);
+            shouldFree = (entry->dm == dm);
         } else {
             // all invisible pages resp. page tiles
             shouldFree = !entry->dm->PageVisibleNearby(entry->pageNo);
             if (!shouldFree && entry->tile.res > 1)
                 shouldFree = !IsTileVisible(entry->dm, entry->pageNo, entry->tile, 2.0);
         }
-
-        if (shouldFree) {
-            DropCacheEntry(entry);
-            cache[i] = nullptr;
-            cacheCount--;
-        }
-
-        if (curPos != i)
-            cache[curPos] = cache[i];
-        if (!shouldFree)
-            curPos++;
+        if (shouldFree)
+            Evict(entry);
     }
 }
 
@@ -221,14 +350,20 @@ void RenderCache::FreePage(DisplayModel* dm, int pageNo, TilePosition* tile) {
 // mark invisible pages as out-of-date to prevent inconsistencies
 void RenderCache::KeepForDisplayModel(DisplayModel* oldDm, DisplayModel* newDm) {
     ScopedCritSec scope(&cacheAccess);
-    for (int i = 0; i < cacheCount; i++) {
-        if (cache[i]->dm == oldDm) {
-            if (oldDm->PageVisible(cache[i]->pageNo))
-                cache[i]->dm = newDm;
-            // make sure that the page is rerendered eventually
-            cache[i]->zoom = INVALID_ZOOM;
-            cache[i]->outOfDate = true;
+    BitmapCacheEntry* next;
+    for (BitmapCacheEntry* entry = lruFirst; entry; entry = next) {
+        next = entry->lruNext;
+        if (entry->dm != oldDm)
+            continue;
+        if (oldDm != newDm && oldDm->PageVisible(entry->pageNo)) {
+            // re-index the entry under its new DisplayModel
+            Unlink(entry);
+            entry->dm = newDm;
+            Link(entry);
         }
+        // make sure that the page is rerendered eventually
+        entry->zoom = INVALID_ZOOM;
+        entry->outOfDate = true;
     }
 }
 
@@ -237,17 +372,16 @@ void RenderCache::Invalidate(DisplayModel* dm, int pageNo, RectD rect) {
     ScopedCritSec scopeReq(&requestAccess);
 
     ClearQueueForDisplayModel(dm, pageNo);
-    if (curReq && curReq->dm == dm && curReq->pageNo == pageNo)
-        AbortCurrentRequest();
+    AbortRequests(dm, pageNo);
 
     ScopedCritSec scopeCache(&cacheAccess);
 
     RectD mediabox = dm->GetEngine()->PageMediabox(pageNo);
-    for (int i = 0; i < cacheCount; i++) {
-        if (cache[i]->dm == dm && cache[i]->pageNo == pageNo &&
-            !GetTileRect(mediabox, cache[i]->tile).Intersect(rect).IsEmpty()) {
-            cache[i]->zoom = INVALID_ZOOM;
-            cache[i]->outOfDate = true;
+    for (BitmapCacheEntry* entry = Bucket(dm, pageNo); entry; entry = entry->bucketNext) {
+        if (entry->dm == dm && entry->pageNo == pageNo &&
+            !GetTileRect(mediabox, entry->tile).Intersect(rect).IsEmpty()) {
+            entry->zoom = INVALID_ZOOM;
+            entry->outOfDate = true;
         }
     }
 }
@@ -284,9 +418,9 @@ USHORT RenderCache::GetTileRes(DisplayModel* dm, int pageNo) {
 USHORT RenderCache::GetMaxTileRes(DisplayModel* dm, int pageNo, int rotation) {
     ScopedCritSec scope(&cacheAccess);
     USHORT maxRes = 0;
-    for (int i = 0; i < cacheCount; i++) {
-        if (cache[i]->dm == dm && cache[i]->pageNo == pageNo && cache[i]->rotation == rotation) {
-            maxRes = std::max(cache[i]->tile.res, maxRes);
+    for (BitmapCacheEntry* entry = Bucket(dm, pageNo); entry; entry = entry->bucketNext) {
+        if (entry->dm == dm && entry->pageNo == pageNo && entry->rotation == rotation) {
+            maxRes = std::max(entry->tile.res, maxRes);
         }
     }
     return maxRes;
@@ -307,16 +441,21 @@ bool RenderCache::ReduceTileSize() {
         maxTileSize.dy /= 2;
 
     // invalidate all rendered bitmaps and all requests
-    while (cacheCount > 0)
-        FreeForDisplayModel(cache[0]->dm);
-    while (requestCount > 0)
-        ClearQueueForDisplayModel(requests[0].dm);
-    AbortCurrentRequest();
+    while (lruFirst)
+        FreeForDisplayModel(lruFirst->dm);
+    renderQueue->RemoveQueued(nullptr);
+    AbortRequests();
 
     return true;
 }
 
 void RenderCache::RequestRendering(DisplayModel* dm, int pageNo) {
+    CancelStaleRequests(dm);
+
+    // show something as soon as possible, even for pages with too many tiles
+    if (dm->PageVisible(pageNo))
+        RequestPreview(dm, pageNo);
+
     TilePosition tile(GetTileRes(dm, pageNo), 0, 0);
     // only honor the request if there's a good chance that the
     // rendered tile will actually be used
@@ -341,40 +480,48 @@ void RenderCache::RequestRendering(DisplayModel* dm, int pageNo, TilePosition ti
 
     int rotation = NormalizeRotation(dm->GetRotation());
     float zoom = dm->GetZoomReal(pageNo);
+    RenderPriority priority = dm->PageVisible(pageNo) ? RenderPriority::Visible : RenderPriority::Prefetch;
 
-    if (curReq && (curReq->pageNo == pageNo) && (curReq->dm == dm) && (curReq->tile == tile)) {
-        if ((curReq->zoom == zoom) && (curReq->rotation == rotation)) {
-            /* we're already rendering exactly the same page */
-            return;
-        }
-        /* Currently rendered page is for the same page but with different zoom
-        or rotation, so abort it */
-        AbortCurrentRequest();
-    }
+    auto isSameTile = [dm, pageNo, tile](PageRenderRequest& req) {
+        return req.pageNo == pageNo && req.dm == dm && req.tile == tile && !req.renderCb && !req.preview &&
+               !req.contentOnly;
+    };
+
+    /* Currently rendered tiles for the same page but with different zoom
+       or rotation are no longer needed, so abort them */
+    renderQueue->AbortRunning([&](WorkItem* item) {
+        PageRenderRequest& req = GetRequest(item);
+        return isSameTile(req) && (req.zoom != zoom || req.rotation != rotation);
+    });
 
     // clear requests for tiles of different resolution and invisible tiles
     if (clearQueueForPage)
         ClearQueueForDisplayModel(dm, pageNo, &tile);
 
-    for (int i = 0; i < requestCount; i++) {
-        PageRenderRequest* req = &(requests[i]);
-        if ((req->pageNo == pageNo) && (req->dm == dm) && (req->tile == tile)) {
-            if ((req->zoom == zoom) && (req->rotation == rotation)) {
-                /* Request with exactly the same parameters already queued for
-                   rendering. Move it to the top of the queue so that it'll
-                   be rendered faster. */
-                PageRenderRequest tmp;
-                tmp = requests[requestCount - 1];
-                requests[requestCount - 1] = *req;
-                *req = tmp;
-            } else {
-                /* There was a request queued for the same page but with different
-                   zoom or rotation, so only replace this request */
-                req->zoom = zoom;
-                req->rotation = rotation;
-            }
-            return;
-        }
+    /* If a request for the same tile is already queued, move it to the top
+       of its queue so that it'll be rendered faster (and only replace zoom
+       and rotation, if they've changed in the meantime) */
+    RectD pageRect = GetTileRectUser(dm->GetEngine(), pageNo, rotation, zoom, tile);
+    bool isQueued = renderQueue->UpdateQueued([&](WorkItem* item) {
+        PageRenderRequest& req = GetRequest(item);
+        if (!isSameTile(req))
+            return false;
+        req.zoom = zoom;
+        req.rotation = rotation;
+        req.pageRect = pageRect;
+        item->priority = (int)priority;
+        return true;
+    });
+    if (isQueued)
+        return;
+
+    bool isRendering = renderQueue->Visit([&](WorkItem* item) {
+        PageRenderRequest& req = GetRequest(item);
+        return isSameTile(req) && req.zoom == zoom && req.rotation == rotation && !req.abort;
+    });
+    if (isRendering) {
+        /* we're already rendering exactly the same page */
+        return;
     }
 
     if (Exists(dm, pageNo, rotation, zoom, &tile)) {
@@ -383,18 +530,87 @@ void RenderCache::RequestRendering(DisplayModel* dm, int pageNo, TilePosition ti
         return;
     }
 
-    Render(dm, pageNo, rotation, zoom, &tile);
+    {
+        ScopedCritSec scopeCache(&cacheAccess);
+        stats.misses++;
+    }
+    Render(dm, pageNo, rotation, zoom, &tile, nullptr, nullptr, priority);
+}
+
+/* Render the whole page <pageNo> at a fraction of the zoom level, so that there's
+   something to display (scaled up) for a newly visible page while its tiles are
+   being rendered at full quality. Previews are rendered before all other requests. */
+void RenderCache::RequestPreview(DisplayModel* dm, int pageNo) {
+    ScopedCritSec scope(&requestAccess);
+    if (!dm || dm->dontRenderFlag)
+        return;
+
+    // any cached bitmap of the whole page (even at a different zoom level) will do
+    int rotation = NormalizeRotation(dm->GetRotation());
+    TilePosition tile(0, 0, 0);
+    if (Exists(dm, pageNo, rotation, INVALID_ZOOM, &tile))
+        return;
+
+    bool isQueued = renderQueue->Visit([&](WorkItem* item) {
+        PageRenderRequest& req = GetRequest(item);
+        return req.preview && req.pageNo == pageNo && req.dm == dm;
+    });
+    if (isQueued)
+        return;
+
+    float zoom = dm->GetZoomReal(pageNo);
+    RectI pixelbox = GetTileRectDevice(dm->GetEngine(), pageNo, rotation, zoom, tile);
+    if (pixelbox.IsEmpty() || (int64_t)pixelbox.dx * pixelbox.dy < PREVIEW_MIN_PAGE_PIXELS)
+        return;
+    float scale = std::min(PREVIEW_ZOOM_FACTOR, std::min(1.0f * maxTileSize.dx / pixelbox.dx,
+                                                         1.0f * maxTileSize.dy / pixelbox.dy));
+    Render(dm, pageNo, rotation, zoom * scale, &tile, nullptr, nullptr, RenderPriority::Preview);
+}
+
+/* Parse the content of the pages nextPageNo through lastPageNo (which are expected to
+   become visible in this order) ahead of time, so that rendering them doesn't stall
+   once they're scrolled into view. Pending requests for other pages are dropped. */
+void RenderCache::PrefetchPages(DisplayModel* dm, int nextPageNo, int lastPageNo) {
+    ScopedCritSec scope(&requestAccess);
+    if (!dm)
+        return;
+
+    int step = nextPageNo <= lastPageNo ? 1 : -1;
+    auto isPredicted = [=](int pageNo) {
+        return nextPageNo != INVALID_PAGE_NO && (pageNo - nextPageNo) * step >= 0 && (lastPageNo - pageNo) * step >= 0;
+    };
+    renderQueue->RemoveQueued([&](WorkItem* item) {
+        PageRenderRequest& req = GetRequest(item);
+        return req.contentOnly && req.dm == dm && !isPredicted(req.pageNo);
+    });
+    if (nextPageNo == INVALID_PAGE_NO || dm->dontRenderFlag)
+        return;
+
+    // the most recently queued request is run first, so queue the next page last
+    TilePosition tile(0, 0, 0);
+    for (int pageNo = lastPageNo; isPredicted(pageNo); pageNo -= step) {
+        if (!dm->ValidPageNo(pageNo) || dm->PageVisible(pageNo))
+            continue;
+        auto isSamePage = [&](WorkItem* item) {
+            PageRenderRequest& req = GetRequest(item);
+            return req.contentOnly && req.dm == dm && req.pageNo == pageNo;
+        };
+        if (renderQueue->UpdateQueued(isSamePage) || renderQueue->Visit(isSamePage))
+            continue;
+        Render(dm, pageNo, dm->GetRotation(), dm->GetZoomReal(pageNo), &tile, nullptr, nullptr,
+               RenderPriority::PrefetchContent);
+    }
 }
 
 void RenderCache::Render(DisplayModel* dm, int pageNo, int rotation, float zoom, RectD pageRect,
                          RenderingCallback& callback) {
-    bool ok = Render(dm, pageNo, rotation, zoom, nullptr, &pageRect, &callback);
+    bool ok = Render(dm, pageNo, rotation, zoom, nullptr, &pageRect, &callback, RenderPriority::Thumbnail);
     if (!ok)
         callback.Callback();
 }
 
 bool RenderCache::Render(DisplayModel* dm, int pageNo, int rotation, float zoom, TilePosition* tile, RectD* pageRect,
-                         RenderingCallback* renderCb) {
+                         RenderingCallback* renderCb, RenderPriority priority) {
     AssertCrash(dm);
     if (!dm || dm->dontRenderFlag)
         return false;
@@ -403,186 +619,138 @@ bool RenderCache::Render(DisplayModel* dm, int pageNo, int rotation, float zoom,
     if (!tile && !(pageRect && renderCb))
         return false;
 
-    ScopedCritSec scope(&requestAccess);
-    PageRenderRequest* newRequest;
-
-    /* add request to the queue */
-    if (requestCount == MAX_PAGE_REQUESTS) {
-        /* queue is full -> remove the oldest items on the queue */
-        if (requests[0].renderCb)
-            requests[0].renderCb->Callback();
-        memmove(&(requests[0]), &(requests[1]), sizeof(PageRenderRequest) * (MAX_PAGE_REQUESTS - 1));
-        newRequest = &(requests[MAX_PAGE_REQUESTS - 1]);
-    } else {
-        newRequest = &(requests[requestCount]);
-        requestCount++;
-    }
-    AssertCrash(requestCount <= MAX_PAGE_REQUESTS);
-
-    newRequest->dm = dm;
-    newRequest->pageNo = pageNo;
-    newRequest->rotation = rotation;
-    newRequest->zoom = zoom;
+    PageRenderRequest newRequest;
+    newRequest.dm = dm;
+    newRequest.pageNo = pageNo;
+    newRequest.rotation = rotation;
+    newRequest.zoom = zoom;
     if (tile) {
-        newRequest->pageRect = GetTileRectUser(dm->GetEngine(), pageNo, rotation, zoom, *tile);
-        newRequest->tile = *tile;
+        newRequest.pageRect = GetTileRectUser(dm->GetEngine(), pageNo, rotation, zoom, *tile);
+        newRequest.tile = *tile;
     } else if (pageRect) {
-        newRequest->pageRect = *pageRect;
+        newRequest.pageRect = *pageRect;
         // can't cache bitmaps that aren't for a given tile
         AssertCrash(renderCb);
     } else
         AssertCrash(0);
-    newRequest->abort = false;
-    newRequest->abortCookie = nullptr;
-    newRequest->timestamp = GetTickCount();
-    newRequest->renderCb = renderCb;
-
-    SetEvent(startRendering);
+    newRequest.preview = RenderPriority::Preview == priority;
+    newRequest.contentOnly = RenderPriority::PrefetchContent == priority;
+    newRequest.abort = false;
+    newRequest.abortCookie = nullptr;
+    newRequest.timestamp = GetTickCount();
+    newRequest.renderCb = renderCb;
+
+    /* add request to the queue (if the queue is full, the least important
+       request is dropped, which also calls its callback) */
+    ScopedCritSec scope(&requestAccess);
+    renderQueue->Push(new PageRenderItem(this, newRequest, priority));
 
+    // the callback has been consumed, even if the request was dropped again
     return true;
 }
 
-UINT RenderCache::GetRenderDelay(DisplayModel* dm, int pageNo, TilePosition tile) {
-    ScopedCritSec scope(&requestAccess);
-
-    if (curReq && curReq->pageNo == pageNo && curReq->dm == dm && curReq->tile == tile)
-        return GetTickCount() - curReq->timestamp;
-
-    for (int i = 0; i < requestCount; i++)
-        if (requests[i].pageNo == pageNo && requests[i].dm == dm && requests[i].tile == tile)
-            return GetTickCount() - requests[i].timestamp;
-
-    return RENDER_DELAY_UNDEFINED;
+bool RenderCache::IsRenderQueueFull() const {
+    return renderQueue->IsFull();
 }
 
-bool RenderCache::GetNextRequest(PageRenderRequest* req) {
-    ScopedCritSec scope(&requestAccess);
-
-    if (requestCount == 0)
-        return false;
-
-    AssertCrash(requestCount > 0);
-    AssertCrash(requestCount <= MAX_PAGE_REQUESTS);
-    requestCount--;
-    *req = requests[requestCount];
-    curReq = req;
-    AssertCrash(requestCount >= 0);
-    AssertCrash(!req->abort);
-
-    return true;
+bool RenderCache::HasVisibleRequests() {
+    return renderQueue->Visit([](WorkItem* item) { return item->priority <= (int)RenderPriority::Visible; });
 }
 
-bool RenderCache::ClearCurrentRequest() {
-    ScopedCritSec scope(&requestAccess);
-    if (curReq)
-        delete curReq->abortCookie;
-    curReq = nullptr;
-
-    bool isQueueEmpty = requestCount == 0;
-    return isQueueEmpty;
+UINT RenderCache::GetRenderDelay(DisplayModel* dm, int pageNo, TilePosition tile) {
+    DWORD timestamp = 0;
+    bool found = renderQueue->Visit([&](WorkItem* item) {
+        PageRenderRequest& req = GetRequest(item);
+        if (req.pageNo != pageNo || req.dm != dm || !(req.tile == tile) || req.preview || req.contentOnly)
+            return false;
+        timestamp = req.timestamp;
+        return true;
+    });
+    if (!found)
+        return RENDER_DELAY_UNDEFINED;
+    return GetTickCount() - timestamp;
 }
 
-/* Wait until rendering of a page beloging to <dm> has finished. */
-/* TODO: this might take some time, would be good to show a dialog to let the
-   user know he has to wait until we finish */
+/* Wait until rendering of all pages beloging to <dm> has finished. */
 void RenderCache::CancelRendering(DisplayModel* dm) {
     ClearQueueForDisplayModel(dm);
 
-    for (;;) {
-        EnterCriticalSection(&requestAccess);
-        if (!curReq || (curReq->dm != dm)) {
-            // to be on the safe side
-            ClearQueueForDisplayModel(dm);
-            LeaveCriticalSection(&requestAccess);
-            return;
-        }
-
-        AbortCurrentRequest();
-        LeaveCriticalSection(&requestAccess);
+    auto isForDm = [dm](WorkItem* item) { return GetRequest(item).dm == dm; };
+    renderQueue->AbortRunning(isForDm);
+    renderQueue->WaitForRunning(isForDm);
 
-        /* TODO: busy loop is not good, but I don't have a better idea */
-        Sleep(50);
-    }
+    // to be on the safe side
+    ClearQueueForDisplayModel(dm);
 }
 
 void RenderCache::ClearQueueForDisplayModel(DisplayModel* dm, int pageNo, TilePosition* tile) {
-    ScopedCritSec scope(&requestAccess);
-    int reqCount = requestCount;
-    int curPos = 0;
-    for (int i = 0; i < reqCount; i++) {
-        PageRenderRequest* req = &(requests[i]);
-        bool shouldRemove = req->dm == dm && (pageNo == INVALID_PAGE_NO || req->pageNo == pageNo) &&
-                            (!tile || req->tile.res != tile->res || !IsTileVisible(dm, req->pageNo, *tile, 0.5));
-        if (i != curPos)
-            requests[curPos] = requests[i];
-        if (shouldRemove) {
-            if (req->renderCb)
-                req->renderCb->Callback();
-            requestCount--;
-        } else
-            curPos++;
-    }
+    renderQueue->RemoveQueued([=](WorkItem* item) {
+        PageRenderRequest& req = GetRequest(item);
+        // previews are only dropped with the whole page (they're always for the whole page)
+        return req.dm == dm && (pageNo == INVALID_PAGE_NO || req.pageNo == pageNo) &&
+               (!tile || !req.preview && (req.tile.res != tile->res || !IsTileVisible(dm, req.pageNo, *tile, 0.5)));
+    });
 }
 
-void RenderCache::AbortCurrentRequest() {
-    ScopedCritSec scope(&requestAccess);
-    if (!curReq)
-        return;
-    if (curReq->abortCookie)
-        curReq->abortCookie->Abort();
-    curReq->abort = true;
+// aborts the requests currently being rendered for <dm> (or for all DisplayModels)
+void RenderCache::AbortRequests(DisplayModel* dm, int pageNo) {
+    renderQueue->AbortRunning([=](WorkItem* item) {
+        PageRenderRequest& req = GetRequest(item);
+        return (!dm || req.dm == dm) && (pageNo == INVALID_PAGE_NO || req.pageNo == pageNo);
+    });
 }
 
-DWORD WINAPI RenderCache::RenderCacheThread(LPVOID data) {
-    RenderCache* cache = (RenderCache*)data;
-    PageRenderRequest req;
-    RenderedBitmap* bmp;
-
-    for (;;) {
-        if (cache->ClearCurrentRequest()) {
-            DWORD waitResult = WaitForSingleObject(cache->startRendering, INFINITE);
-            // Is it not a page render request?
-            if (WAIT_OBJECT_0 != waitResult)
-                continue;
-        }
+// drops queued and aborts running requests for tiles which have been scrolled out of view
+// (content prefetching requests are replaced in PrefetchPages instead)
+void RenderCache::CancelStaleRequests(DisplayModel* dm) {
+    auto isStale = [dm](WorkItem* item) {
+        PageRenderRequest& req = GetRequest(item);
+        return req.dm == dm && !req.renderCb && !req.contentOnly && !dm->PageVisibleNearby(req.pageNo);
+    };
+    renderQueue->RemoveQueued(isStale);
+    renderQueue->AbortRunning(isStale);
+}
 
-        if (!cache->GetNextRequest(&req))
-            continue;
-        if (!req.dm->PageVisibleNearby(req.pageNo) && !req.renderCb)
-            continue;
-        if (req.dm->dontRenderFlag) {
-            if (req.renderCb)
-                req.renderCb->Callback();
-            continue;
-        }
+// called on one of the rendering threads
+void RenderCache::RenderRequest(PageRenderRequest& req) {
+    if (req.contentOnly) {
+        if (!req.dm->dontRenderFlag)
+            req.dm->GetEngine()->PrefetchPage(req.pageNo);
+        return;
+    }
+    if (!req.dm->PageVisibleNearby(req.pageNo) && !req.renderCb)
+        return;
+    // requests for a callback are notified when they're deleted
+    if (req.dm->dontRenderFlag)
+        return;
 
-        // make sure that we have extracted page text for
-        // all rendered pages to allow text selection and
-        // searching without any further delays
-        if (!req.dm->textCache->HasData(req.pageNo))
-            req.dm->textCache->GetData(req.pageNo);
-
-        CrashIf(req.abortCookie != nullptr);
-        bmp = req.dm->GetEngine()->RenderBitmap(req.pageNo, req.zoom, req.rotation, &req.pageRect, RenderTarget::View,
-                                                &req.abortCookie);
-        if (req.abort) {
-            delete bmp;
-            if (req.renderCb)
-                req.renderCb->Callback();
-            continue;
-        }
+    // make sure that we have extracted page text for
+    // all rendered pages to allow text selection and
+    // searching without any further delays
+    // (but don't delay previews, they're all about being fast)
+    if (!req.preview && !req.dm->textCache->HasData(req.pageNo)) {
+        PageTextCache::ReadScope scope(req.dm->textCache);
+        req.dm->textCache->GetData(req.pageNo);
+    }
 
-        if (req.renderCb) {
-            // the callback must free the RenderedBitmap
-            req.renderCb->Callback(bmp);
-            req.renderCb = (RenderingCallback*)1; // will crash if accessed again, which should not happen
-        } else {
-            // don't replace colors for individual images
-            if (bmp && !req.dm->GetEngine()->IsImageCollection())
-                UpdateBitmapColors(bmp->GetBitmap(), cache->textColor, cache->backgroundColor);
-            cache->Add(req, bmp);
-            req.dm->RepaintDisplay();
-        }
+    CrashIf(req.abortCookie != nullptr);
+    RenderedBitmap* bmp = req.dm->GetEngine()->RenderBitmap(req.pageNo, req.zoom, req.rotation, &req.pageRect,
+                                                            RenderTarget::View, &req.abortCookie);
+    if (req.abort) {
+        delete bmp;
+        return;
+    }
+
+    if (req.renderCb) {
+        // the callback must free the RenderedBitmap
+        req.renderCb->Callback(bmp);
+        req.renderCb = nullptr;
+    } else {
+        // don't replace colors for individual images
+        if (bmp && !req.dm->GetEngine()->IsImageCollection())
+            UpdateBitmapColors(bmp->GetBitmap(), textColor, backgroundColor);
+        Add(req, bmp);
+        req.dm->RepaintDisplay();
     }
 }
 
@@ -593,7 +761,10 @@ UINT RenderCache::PaintTile(HDC hdc, RectI bounds, DisplayModel* dm, int pageNo,
     BitmapCacheEntry* entry = Find(dm, pageNo, dm->GetRotation(), dm->GetZoomReal(), &tile);
     UINT renderDelay = 0;
 
-    if (!entry) {
+    if (entry) {
+        ScopedCritSec scope(&cacheAccess);
+        stats.hits++;
+    } else {
         if (!isRemoteSession) {
             if (renderedReplacement)
                 *renderedReplacement = true;
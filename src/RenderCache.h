@@ -5,10 +5,27 @@
 #define RENDER_DELAY_FAILED ((UINT)-2)
 #define INVALID_TILE_RES ((USHORT)-1)
 
-#define MAX_PAGE_REQUESTS 8
-// keep this value reasonably low, else we'll run out of
-// GDI resources/memory when caching many larger bitmaps
-#define MAX_BITMAPS_CACHED 64
+// maximum number of queued (i.e. not yet rendering) requests
+#define MAX_PAGE_REQUESTS 32
+// maximum number of pages rendered in parallel
+#define MAX_RENDER_THREADS 4
+// the cache is limited by the memory used for bitmaps (see GetBitmapCacheBudget),
+// this only keeps us from running out of GDI handles for many small bitmaps
+#define MAX_BITMAPS_CACHED 512
+// lower and upper limit for the memory used by cached bitmaps
+#define MIN_BITMAP_CACHE_BYTES (64 * 1024 * 1024)
+#ifdef _WIN64
+#define MAX_BITMAP_CACHE_BYTES (1024 * 1024 * 1024)
+#else
+#define MAX_BITMAP_CACHE_BYTES (256 * 1024 * 1024)
+#endif
+// number of hash buckets for looking up cached bitmaps by page
+#define BITMAP_CACHE_BUCKETS 256
+// newly visible pages are first rendered as a whole at a quarter of
+// the zoom level (and at most at screen size), then at full quality
+#define PREVIEW_ZOOM_FACTOR 0.25f
+// pages with fewer pixels than this render fast enough without a preview
+#define PREVIEW_MIN_PAGE_PIXELS (512 * 512)
 
 class RenderingCallback {
   public:
@@ -40,24 +57,53 @@ struct BitmapCacheEntry {
 
     // owned by the BitmapCacheEntry
     RenderedBitmap* bitmap;
+    // memory used by bitmap's pixels
+    size_t bytes;
     bool outOfDate;
     int refs;
 
-    BitmapCacheEntry(DisplayModel* dm, int pageNo, int rotation, float zoom, TilePosition tile, RenderedBitmap* bitmap)
+    // next entry in the same hash bucket
+    BitmapCacheEntry* bucketNext;
+    // neighbors in the list of entries ordered from least to most recently used
+    BitmapCacheEntry* lruPrev;
+    BitmapCacheEntry* lruNext;
+
+    BitmapCacheEntry(DisplayModel* dm, int pageNo, int rotation, float zoom, TilePosition tile, RenderedBitmap* bitmap,
+                     size_t bytes)
         : dm(dm),
           pageNo(pageNo),
           rotation(rotation),
           zoom(zoom),
           tile(tile),
           bitmap(bitmap),
+          bytes(bytes),
           outOfDate(false),
-          refs(1) {}
+          refs(1),
+          bucketNext(nullptr),
+          lruPrev(nullptr),
+          lruNext(nullptr) {}
     ~BitmapCacheEntry() { delete bitmap; }
 };
 
+// requests with a lower value are rendered first
+enum class RenderPriority {
+    // quick low resolution previews of newly visible pages
+    Preview,
+    // tiles of pages which are currently visible
+    Visible,
+    // pages which are likely to become visible soon
+    Prefetch,
+    // thumbnails and other requests with a callback
+    Thumbnail,
+    // pages predicted from the scrolling direction and speed, for which
+    // only the content is parsed (cf. BaseEngine::PrefetchPage)
+    PrefetchContent,
+    Count
+};
+
 /* Even though this looks a lot like a BitmapCacheEntry, we keep it
-   separate for clarity in the code (PageRenderRequests are reused,
-   while BitmapCacheEntries are ref-counted) */
+   separate for clarity in the code (PageRenderRequests are owned by
+   the render queue, while BitmapCacheEntries are ref-counted) */
 struct PageRenderRequest {
     DisplayModel* dm;
     int pageNo;
@@ -66,27 +112,52 @@ struct PageRenderRequest {
     TilePosition tile;
 
     RectD pageRect; // calculated from TilePosition
+    // a low resolution stand-in until the tile has been rendered at zoom
+    bool preview;
+    // only prepare the page's content for rendering, don't render a bitmap
+    bool contentOnly;
     bool abort;
     AbortCookie* abortCookie;
     DWORD timestamp;
-    // owned by the PageRenderRequest (use it before reusing the request)
-    // on rendering success, the callback gets handed the RenderedBitmap
+    // owned by the PageRenderRequest (it's called without a bitmap if the
+    // request is dropped or aborted, else it gets handed the RenderedBitmap)
     RenderingCallback* renderCb;
 };
 
+struct RenderCacheStats {
+    int count;
+    size_t bytes;
+    size_t maxBytes;
+    // number of tiles painted from the cache resp. which had to be (re)rendered
+    size_t hits;
+    size_t misses;
+    // number of bitmaps dropped in order to make room for new ones
+    size_t evictions;
+    // number of low resolution previews rendered for newly visible pages
+    size_t previews;
+};
+
+class WorkScheduler;
+
 class RenderCache {
+    friend class PageRenderItem;
+
   private:
-    BitmapCacheEntry* cache[MAX_BITMAPS_CACHED];
+    // cached bitmaps are indexed by (dm, pageNo) and kept in LRU order
+    BitmapCacheEntry* buckets[BITMAP_CACHE_BUCKETS];
+    BitmapCacheEntry* lruFirst;
+    BitmapCacheEntry* lruLast;
     int cacheCount;
+    size_t cacheBytes;
+    size_t maxCacheBytes;
+    RenderCacheStats stats;
     // make sure to never ask for requestAccess in a cacheAccess
     // protected critical section in order to avoid deadlocks
     CRITICAL_SECTION cacheAccess;
 
-    PageRenderRequest requests[MAX_PAGE_REQUESTS];
-    int requestCount;
-    PageRenderRequest* curReq;
+    // serializes compound operations on the render queue
     CRITICAL_SECTION requestAccess;
-    HANDLE renderThread;
+    WorkScheduler* renderQueue;
 
     SizeI maxTileSize;
     bool isRemoteSession;
@@ -99,23 +170,25 @@ class RenderCache {
     ~RenderCache();
 
     void RequestRendering(DisplayModel* dm, int pageNo);
+    void PrefetchPages(DisplayModel* dm, int nextPageNo, int lastPageNo);
     void Render(DisplayModel* dm, int pageNo, int rotation, float zoom, RectD pageRect, RenderingCallback& callback);
     void CancelRendering(DisplayModel* dm);
     bool Exists(DisplayModel* dm, int pageNo, int rotation, float zoom = INVALID_ZOOM, TilePosition* tile = nullptr);
     void FreeForDisplayModel(DisplayModel* dm) { FreePage(dm); }
     void KeepForDisplayModel(DisplayModel* oldDm, DisplayModel* newDm);
     void Invalidate(DisplayModel* dm, int pageNo, RectD rect);
+    RenderCacheStats GetStats();
+    // returns true while visible parts of a page are still waiting to be rendered
+    // (background work should yield to the rendering during that time)
+    bool HasVisibleRequests();
     // returns how much time in ms has past since the most recent rendering
     // request for the visible part of the page if nothing at all could be
     // painted, 0 if something has been painted and RENDER_DELAY_FAILED on failure
     UINT Paint(HDC hdc, RectI bounds, DisplayModel* dm, int pageNo, PageInfo* pageInfo, bool* renderOutOfDateCue);
 
   protected:
-    /* Interface for page rendering thread */
-    HANDLE startRendering;
-
-    bool ClearCurrentRequest();
-    bool GetNextRequest(PageRenderRequest* req);
+    /* Interface for page rendering threads */
+    void RenderRequest(PageRenderRequest& req);
     void Add(PageRenderRequest& req, RenderedBitmap* bitmap);
 
   private:
@@ -123,19 +196,25 @@ class RenderCache {
     USHORT GetMaxTileRes(DisplayModel* dm, int pageNo, int rotation);
     bool ReduceTileSize();
 
-    bool IsRenderQueueFull() const { return requestCount == MAX_PAGE_REQUESTS; }
+    bool IsRenderQueueFull() const;
     UINT GetRenderDelay(DisplayModel* dm, int pageNo, TilePosition tile);
     void RequestRendering(DisplayModel* dm, int pageNo, TilePosition tile, bool clearQueueForPage = true);
+    void RequestPreview(DisplayModel* dm, int pageNo);
     bool Render(DisplayModel* dm, int pageNo, int rotation, float zoom, TilePosition* tile = nullptr,
-                RectD* pageRect = nullptr, RenderingCallback* callback = nullptr);
+                RectD* pageRect = nullptr, RenderingCallback* callback = nullptr,
+                RenderPriority priority = RenderPriority::Visible);
     void ClearQueueForDisplayModel(DisplayModel* dm, int pageNo = INVALID_PAGE_NO, TilePosition* tile = nullptr);
-    void AbortCurrentRequest();
-
-    static DWORD WINAPI RenderCacheThread(LPVOID data);
+    void AbortRequests(DisplayModel* dm = nullptr, int pageNo = INVALID_PAGE_NO);
+    void CancelStaleRequests(DisplayModel* dm);
 
     BitmapCacheEntry* Find(DisplayModel* dm, int pageNo, int rotation, float zoom = INVALID_ZOOM,
                            TilePosition* tile = nullptr);
     void DropCacheEntry(BitmapCacheEntry* entry);
+    BitmapCacheEntry*& Bucket(DisplayModel* dm, int pageNo);
+    void Link(BitmapCacheEntry* entry);
+    void Unlink(BitmapCacheEntry* entry);
+    void Evict(BitmapCacheEntry* entry);
+    void MakeRoomFor(size_t bytes);
     void FreePage(DisplayModel* dm = nullptr, int pageNo = -1, TilePosition* tile = nullptr);
     void FreeNotVisible() { FreePage(); }
 
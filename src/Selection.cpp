@@ -35,7 +35,7 @@ RectI SelectionOnPage::GetRect(DisplayModel* dm) {
 Vec<SelectionOnPage>* SelectionOnPage::FromRectangle(DisplayModel* dm, RectI rect) {
     Vec<SelectionOnPage>* sel = new Vec<SelectionOnPage>();
 
-    for (int pageNo = dm->GetEngine()->PageCount(); pageNo >= 1; --pageNo) {
+    for (int pageNo = dm->PageCount(); pageNo >= 1; --pageNo) {
         PageInfo* pageInfo = dm->GetPageInfo(pageNo);
         AssertCrash(!pageInfo || 0.0 == pageInfo->visibleRatio || pageInfo->shown);
         if (!pageInfo || !pageInfo->shown)
@@ -54,6 +54,11 @@ struct FixedPageUI {
     // subconsciously determine reading progress; suggested values: #2828aa
     // #28aa28 #aa2828
     Vec<COLORREF>* gradientColors;
+    // if true, filled paths in PDF and XPS documents are anti-aliased by
+    // computing the exact area they cover in each pixel (which is faster
+    // for pages with many vector graphics). takes effect after re-opening
+    // the document
+    bool exactAntiAliasing;
     // if true, TextColor and BackgroundColor will be temporarily swapped
     bool invertColors;
 };
@@ -422,10 +427,11 @@ static const FieldInfo gFixedPageUIFields[] = {
     {offsetof(FixedPageUI, windowMargin), Type_Compact, (intptr_t)&gWindowMarginInfo},
     {offsetof(FixedPageUI, pageSpacing), Type_Compact, (intptr_t)&gSizeIInfo},
     {offsetof(FixedPageUI, gradientColors), Type_ColorArray, 0},
+    {offsetof(FixedPageUI, exactAntiAliasing), Type_Bool, false},
 };
 static const StructInfo gFixedPageUIInfo = {
-    sizeof(FixedPageUI), 6, gFixedPageUIFields,
-    "TextColor\0BackgroundColor\0SelectionColor\0WindowMargin\0PageSpacing\0GradientColors"};
+    sizeof(FixedPageUI), 7, gFixedPageUIFields,
+    "TextColor\0BackgroundColor\0SelectionColor\0WindowMargin\0PageSpacing\0GradientColors\0ExactAntiAliasing"};
 
 static const FieldInfo gEbookUIFields[] = {
     {offsetof(EbookUI, fontName), Type_String, (intptr_t)L"Georgia"},
@@ -559,6 +559,12 @@ void StressTest::Finished(bool success) {
         AutoFreeW tm(FormatTime(secs));
         AutoFreeW s(str::Format(L"Stress test complete, rendered %d files in %s", filesCount, tm));
         win->ShowNotification(s, NOS_PERSIST, NG_STRESS_TEST_SUMMARY);
+
+        RenderCacheStats stats = gRenderCache.GetStats();
+        wprintf(L"bitmap cache: %d bitmaps, %d of %d KB, %d hits, %d misses, %d evictions, %d previews\n",
+                stats.count, (int)(stats.bytes / 1024), (int)(stats.maxBytes / 1024), (int)stats.hits,
+                (int)stats.misses, (int)stats.evictions, (int)stats.previews);
+        fflush(stdout);
     }
 
     CloseWindow(win, exitWhenDone && MayCloseWindow(win));
@@ -130,6 +130,7 @@ static WStrVec gAllowedFileTypes;
 
 static void CloseDocumentInTab(WindowInfo* win, bool keepUIEnabled = false, bool deleteModel = false);
 static void UpdatePageInfoHelper(WindowInfo* win, NotificationWnd* wnd = nullptr, int pageNo = -1);
+static void StartTextExtraction(DisplayModel* dm);
 static bool SidebarSplitterCb(void* ctx, bool done);
 static bool FavSplitterCb(void* ctx, bool done);
 
@@ -625,8 +626,10 @@ class ControllerCallbackHandler : public ControllerCallback {
     void PageNoChanged(Controller* ctrl, int pageNo) override;
     void UpdateScrollbars(SizeI canvas) override;
     void RequestRendering(int pageNo) override;
+    void PrefetchPages(int nextPageNo, int lastPageNo) override;
     void CleanUp(DisplayModel* dm) override;
     void RenderThumbnail(DisplayModel* dm, SizeI size, const onBitmapRenderedCb&) override;
+    void PageCountChanged(DisplayModel* dm) override;
     void GotoLink(PageDestination* dest) override { win->linkHandler->GotoLink(dest); }
     void FocusFrame(bool always) override;
     void SaveDownload(const WCHAR* url, const unsigned char* data, size_t len) override;
@@ -692,11 +695,37 @@ void ControllerCallbackHandler::RequestRendering(int pageNo) {
         gRenderCache.RequestRendering(dm, pageNo);
 }
 
+void ControllerCallbackHandler::PrefetchPages(int nextPageNo, int lastPageNo) {
+    CrashIf(!win->AsFixed());
+    if (!win->AsFixed())
+        return;
+    gRenderCache.PrefetchPages(win->AsFixed(), nextPageNo, lastPageNo);
+}
+
 void ControllerCallbackHandler::CleanUp(DisplayModel* dm) {
     gRenderCache.CancelRendering(dm);
     gRenderCache.FreeForDisplayModel(dm);
 }
 
+void ControllerCallbackHandler::PageCountChanged(DisplayModel* dm) {
+    uitask::Post([=] {
+        // dm might have been closed in the meantime
+        WindowInfo* win = FindWindowInfoByController(dm);
+        if (!win)
+            return;
+        bool isCurrent = win->ctrl == dm;
+        // searches mustn't run while the text caches are replaced
+        if (isCurrent)
+            AbortFinding(win, true);
+        dm->UpdatePageCount();
+        if (!isCurrent)
+            return;
+        StartTextExtraction(dm);
+        UpdateToolbarPageText(win, dm->PageCount());
+        win->RedrawAll(true);
+    });
+}
+
 void ControllerCallbackHandler::FocusFrame(bool always) {
     if (always || !FindWindowInfoByHwnd(GetFocus()))
         SetFocus(win->hwndFrame);
@@ -913,6 +942,21 @@ static void UpdateUiForCurrentTab(WindowInfo* win) {
     ToggleWindowStyle(win->hwndPageBox, ES_NUMBER, onlyNumbers);
 }
 
+// pre-warms the text cache for searching and text selection, yielding to
+// rendering for as long as visible pages are waiting to be painted
+static void StartTextExtraction(DisplayModel* dm) {
+    auto isBusy = [] { return gRenderCache.HasVisibleRequests(); };
+    dm->textCache->StartExtraction(dm->CurrentPageNo(), isBusy);
+    // keep a persistent text index next to the thumbnails, so that
+    // repeated searches in the same document don't need a full text extraction
+    // (the index is only built for the exact page count, cf. PageCountChanged)
+    if (gGlobalPrefs->rememberOpenedFiles && HasPermission(Perm_SavePreferences) && !gPluginMode &&
+        dm->IsPageCountFinal()) {
+        AutoFreeW indexPath(GetTextIndexPath(dm->FilePath()));
+        dm->textCache->StartIndexing(dm->FilePath(), indexPath, isBusy);
+    }
+}
+
 // meaning of the internal values of LoadArgs:
 // isNewWindow : if true then 'win' refers to a newly created window that needs
 //   to be resized and placed
@@ -1089,6 +1133,9 @@ static void LoadDocIntoCurrentTab(LoadArgs& args, Controller* ctrl, DisplayState
     if (!win->IsDocLoaded())
         return;
 
+    if (win->AsFixed())
+        StartTextExtraction(win->AsFixed());
+
     AutoFreeW unsupported(win->ctrl->GetProperty(DocumentProperty::UnsupportedFeatures));
     if (unsupported) {
         unsupported.Set(str::Format(_TR("This document uses unsupported features (%s) and might not render properly"),
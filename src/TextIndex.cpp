@@ -0,0 +1,266 @@
+/* Copyright 2018 the SumatraPDF project authors (see AUTHORS file).
+   License: GPLv3 */
+
+#include "BaseUtil.h"
+#include "ScopedWin.h"
+#include "CryptoUtil.h"
+#include "Dict.h"
+#include "FileUtil.h"
+#include "BaseEngine.h"
+#include "TextSelection.h"
+#include "TextIndex.h"
+
+/*
+The index file consists of a header followed by three arrays:
+  TextIndexWord words[wordCount] (sorted by word)
+  TextIndexHit hits[hitCount] (grouped by word, in document order)
+  WCHAR chars[charCount] (the lower-cased words, not zero-terminated)
+*/
+
+#define TEXT_INDEX_MAGIC "STIX"
+#define TEXT_INDEX_VERSION 1
+
+struct TextIndexHeader {
+    char magic[4];
+    uint32_t version;
+    unsigned char digest[16];
+    uint32_t pageCount;
+    uint32_t wordCount;
+    uint32_t hitCount;
+    uint32_t charCount;
+};
+
+struct TextIndexWord {
+    uint32_t charOffset;
+    uint32_t charCount;
+    uint32_t firstHit;
+    uint32_t hitCount;
+};
+
+static_assert(sizeof(TextIndexHeader) == 40, "the index file layout mustn't depend on the compiler");
+static_assert(sizeof(TextIndexWord) == 16 && sizeof(TextIndexHit) == 8, "see above");
+
+TextIndex::~TextIndex() {
+    if (data)
+        UnmapViewOfFile(data);
+    if (hMap)
+        CloseHandle(hMap);
+    if (hFile != INVALID_HANDLE_VALUE)
+        CloseHandle(hFile);
+}
+
+TextIndex* TextIndex::Open(const WCHAR* indexPath, const unsigned char digest[16], int pageCount) {
+    TextIndex* index = new TextIndex();
+    if (!index->Load(indexPath, digest, pageCount)) {
+        delete index;
+        return nullptr;
+    }
+    return index;
+}
+
+bool TextIndex::Load(const WCHAR* indexPath, const unsigned char digest[16], int pageCount) {
+    hFile = file::OpenReadOnly(indexPath);
+    if (INVALID_HANDLE_VALUE == hFile)
+        return false;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(hFile, &size) || (uint64_t)size.QuadPart < sizeof(TextIndexHeader) ||
+        (uint64_t)size.QuadPart > UINT_MAX)
+        return false;
+    hMap = CreateFileMapping(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!hMap)
+        return false;
+    data = (const char*)MapViewOfFile(hMap, FILE_MAP_READ, 0, 0, 0);
+    if (!data)
+        return false;
+    dataSize = (size_t)size.QuadPart;
+
+    const TextIndexHeader* hdr = (const TextIndexHeader*)data;
+    if (memcmp(hdr->magic, TEXT_INDEX_MAGIC, 4) != 0 || hdr->version != TEXT_INDEX_VERSION)
+        return false;
+    // the index is outdated as soon as the document's content has changed
+    if (memcmp(hdr->digest, digest, 16) != 0 || hdr->pageCount != (uint32_t)pageCount)
+        return false;
+    uint64_t expectedSize = sizeof(TextIndexHeader) + (uint64_t)hdr->wordCount * sizeof(TextIndexWord) +
+                            (uint64_t)hdr->hitCount * sizeof(TextIndexHit) + (uint64_t)hdr->charCount * sizeof(WCHAR);
+    if (expectedSize != dataSize)
+        return false;
+
+    // make sure that a corrupted file can't lead to out-of-bounds reads later on
+    const TextIndexWord* words = (const TextIndexWord*)(hdr + 1);
+    for (uint32_t i = 0; i < hdr->wordCount; i++) {
+        if (words[i].charOffset > hdr->charCount || words[i].charCount > hdr->charCount - words[i].charOffset)
+            return false;
+        if (words[i].firstHit > hdr->hitCount || words[i].hitCount > hdr->hitCount - words[i].firstHit)
+            return false;
+    }
+    return true;
+}
+
+int TextIndex::PageCount() const {
+    return (int)((const TextIndexHeader*)data)->pageCount;
+}
+
+size_t TextIndex::WordCount() const {
+    return ((const TextIndexHeader*)data)->wordCount;
+}
+
+static bool ContainsPart(const WCHAR* word, size_t wordLen, const WCHAR* part, size_t partLen) {
+    for (size_t i = 0; i + partLen <= wordLen; i++) {
+        if (word[i] == part[0] && wmemcmp(word + i, part, partLen) == 0)
+            return true;
+    }
+    return false;
+}
+
+size_t TextIndex::FindWordsContaining(const WCHAR* part, Vec<TextIndexHit>& hits) const {
+    size_t partLen = str::Len(part);
+    if (0 == partLen)
+        return 0;
+    AutoFreeW lowerPart(str::Dup(part));
+    CharLowerBuffW(lowerPart, (DWORD)partLen);
+
+    const TextIndexHeader* hdr = (const TextIndexHeader*)data;
+    const TextIndexWord* words = (const TextIndexWord*)(hdr + 1);
+    const TextIndexHit* allHits = (const TextIndexHit*)(words + hdr->wordCount);
+    const WCHAR* chars = (const WCHAR*)(allHits + hdr->hitCount);
+
+    size_t found = 0;
+    for (uint32_t i = 0; i < hdr->wordCount; i++) {
+        if (!ContainsPart(chars + words[i].charOffset, words[i].charCount, lowerPart, partLen))
+            continue;
+        for (uint32_t j = 0; j < words[i].hitCount; j++) {
+            TextIndexHit hit = allHits[words[i].firstHit + j];
+            if (1 <= hit.pageNo && hit.pageNo <= hdr->pageCount)
+                hits.Append(hit);
+        }
+        found++;
+    }
+    return found;
+}
+
+struct TextIndexBuildHit {
+    int wordId;
+    TextIndexHit hit;
+};
+
+bool TextIndex::Build(const WCHAR* indexPath, const unsigned char digest[16], int pageCount,
+                      const TextIndexPageTextFunc& getPageText, const std::function<bool()>& shouldAbort) {
+    dict::MapWStrToInt wordIds(1024);
+    WStrVec words;
+    Vec<TextIndexBuildHit> buildHits;
+
+    for (int pageNo = 1; pageNo <= pageCount; pageNo++) {
+        if (shouldAbort && shouldAbort())
+            return false;
+        int len = 0;
+        const WCHAR* text = getPageText(pageNo, &len);
+        if (!text)
+            continue;
+        // a word is any run of word characters (cf. isWordChar), so that all
+        // matches of a search anchor are contained in one of the indexed words
+        for (int i = 0; i < len;) {
+            if (!isWordChar(text[i])) {
+                i++;
+                continue;
+            }
+            int start = i;
+            for (i++; i < len && isWordChar(text[i]); i++)
+                ;
+            WCHAR* word = str::DupN(text + start, i - start);
+            CharLowerBuffW(word, (DWORD)(i - start));
+
+            int wordId = (int)words.size();
+            if (wordIds.Insert(word, wordId, &wordId))
+                words.Append(word);
+            else
+                free(word);
+            TextIndexBuildHit bh = {wordId, {(uint32_t)pageNo, (uint32_t)start}};
+            buildHits.Append(bh);
+        }
+    }
+
+    std::vector<int> order(words.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        order[i] = (int)i;
+    }
+    std::sort(order.begin(), order.end(), [&](int a, int b) { return wcscmp(words.at(a), words.at(b)) < 0; });
+
+    size_t charCount = 0;
+    for (size_t i = 0; i < words.size(); i++) {
+        charCount += str::Len(words.at(i));
+    }
+    size_t size = sizeof(TextIndexHeader) + words.size() * sizeof(TextIndexWord) +
+                  buildHits.size() * sizeof(TextIndexHit) + charCount * sizeof(WCHAR);
+    if (charCount > UINT_MAX || buildHits.size() > UINT_MAX || size > UINT_MAX)
+        return false;
+    AutoFree buf(AllocArray<char>(size));
+    if (!buf)
+        return false;
+
+    TextIndexHeader* hdr = (TextIndexHeader*)buf.Get();
+    memcpy(hdr->magic, TEXT_INDEX_MAGIC, 4);
+    hdr->version = TEXT_INDEX_VERSION;
+    memcpy(hdr->digest, digest, 16);
+    hdr->pageCount = (uint32_t)pageCount;
+    hdr->wordCount = (uint32_t)words.size();
+    hdr->hitCount = (uint32_t)buildHits.size();
+    hdr->charCount = (uint32_t)charCount;
+    TextIndexWord* outWords = (TextIndexWord*)(hdr + 1);
+    TextIndexHit* outHits = (TextIndexHit*)(outWords + hdr->wordCount);
+    WCHAR* outChars = (WCHAR*)(outHits + hdr->hitCount);
+
+    // outWords is indexed by word id until the hits have been distributed
+    for (size_t i = 0; i < buildHits.size(); i++) {
+        outWords[buildHits.at(i).wordId].hitCount++;
+    }
+    uint32_t firstHit = 0, charOffset = 0;
+    Vec<uint32_t> nextHit(words.size());
+    nextHit.AppendBlanks(words.size());
+    for (int id : order) {
+        nextHit.at(id) = firstHit;
+        firstHit += outWords[id].hitCount;
+    }
+    for (size_t i = 0; i < buildHits.size(); i++) {
+        outHits[nextHit.at(buildHits.at(i).wordId)++] = buildHits.at(i).hit;
+    }
+    Vec<TextIndexWord> sorted(words.size());
+    for (int id : order) {
+        TextIndexWord w;
+        w.charCount = (uint32_t)str::Len(words.at(id));
+        w.charOffset = charOffset;
+        w.hitCount = outWords[id].hitCount;
+        w.firstHit = nextHit.at(id) - w.hitCount;
+        memcpy(outChars + charOffset, words.at(id), w.charCount * sizeof(WCHAR));
+        charOffset += w.charCount;
+        sorted.Append(w);
+    }
+    memcpy(outWords, sorted.LendData(), sorted.size() * sizeof(TextIndexWord));
+
+    AutoFreeW dir(path::GetDir(indexPath));
+    if (!dir::Create(dir))
+        return false;
+    return file::WriteFile(indexPath, buf.Get(), size);
+}
+
+bool TextIndex::CalcFileDigest(const WCHAR* filePath, unsigned char digest[16]) {
+    ScopedHandle hFile(file::OpenReadOnly(filePath));
+    if (!hFile.IsValid())
+        return false;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(hFile, &size) || (uint64_t)size.QuadPart > SIZE_MAX)
+        return false;
+    if (0 == size.QuadPart) {
+        CalcMD5Digest(nullptr, 0, digest);
+        return true;
+    }
+    // map the file instead of reading it, as it might be too large to keep in memory twice
+    ScopedHandle hMap(CreateFileMapping(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr));
+    if (!hMap.IsValid())
+        return false;
+    const unsigned char* data = (const unsigned char*)MapViewOfFile(hMap, FILE_MAP_READ, 0, 0, 0);
+    if (!data)
+        return false;
+    CalcMD5Digest(data, (size_t)size.QuadPart, digest);
+    UnmapViewOfFile(data);
+    return true;
+}
@@ -0,0 +1,47 @@
+/* Copyright 2018 the SumatraPDF project authors (see AUTHORS file).
+   License: GPLv3 */
+
+// TextIndex is a persistent inverted index of the words in a document's text,
+// so that repeated searches in a known document only have to look at the pages
+// which might actually contain a match instead of extracting the text of all pages.
+//
+// The index is stored in a single file (cf. GetTextIndexPath in FileThumbnails.h)
+// which is memory-mapped when opened and is only considered valid for a document
+// with the same content fingerprint (MD5) and page count that it was built for.
+
+struct TextIndexHit {
+    uint32_t pageNo;
+    // offset of the word's first glyph in the page's text (cf. PageTextCache)
+    uint32_t glyph;
+};
+
+// returns the text of page pageNo and its length (the text is not freed)
+typedef std::function<const WCHAR*(int pageNo, int* lenOut)> TextIndexPageTextFunc;
+
+class TextIndex {
+    HANDLE hFile = INVALID_HANDLE_VALUE;
+    HANDLE hMap = nullptr;
+    const char* data = nullptr;
+    size_t dataSize = 0;
+
+    TextIndex() {}
+    bool Load(const WCHAR* indexPath, const unsigned char digest[16], int pageCount);
+
+  public:
+    ~TextIndex();
+
+    // returns nullptr if there's no (valid) index for the given document at indexPath
+    static TextIndex* Open(const WCHAR* indexPath, const unsigned char digest[16], int pageCount);
+    // extracts all words from the pages and writes a new index file. Building
+    // stops prematurely and returns false as soon as shouldAbort returns true
+    static bool Build(const WCHAR* indexPath, const unsigned char digest[16], int pageCount,
+                      const TextIndexPageTextFunc& getPageText, const std::function<bool()>& shouldAbort);
+    // the fingerprint used for identifying a document's content
+    static bool CalcFileDigest(const WCHAR* filePath, unsigned char digest[16]);
+
+    // appends the hits for all words which contain part (case-insensitively),
+    // returns the number of matching words
+    size_t FindWordsContaining(const WCHAR* part, Vec<TextIndexHit>& hits) const;
+    int PageCount() const;
+    size_t WordCount() const;
+};
@@ -0,0 +1,132 @@
+/* Copyright 2018 the SumatraPDF project authors (see AUTHORS file).
+   License: GPLv3 */
+
+#include "BaseUtil.h"
+#include "FileUtil.h"
+#include "TextIndex.h"
+
+// must be last due to assert() over-write
+#include "UtAssert.h"
+
+static const WCHAR* gTextIndexPages[] = {
+    L"Hello world\nhello again",
+    L"",
+    L"Yellow submarine, WORLD",
+};
+static const int gTextIndexPageCount = (int)dimof(gTextIndexPages);
+
+static bool HasHit(Vec<TextIndexHit>& hits, uint32_t pageNo, uint32_t glyph) {
+    for (TextIndexHit& hit : hits) {
+        if (hit.pageNo == pageNo && hit.glyph == glyph)
+            return true;
+    }
+    return false;
+}
+
+static bool BuildTestIndex(const WCHAR* indexPath, const unsigned char digest[16]) {
+    auto getPageText = [](int pageNo, int* lenOut) {
+        const WCHAR* text = gTextIndexPages[pageNo - 1];
+        *lenOut = (int)str::Len(text);
+        return text;
+    };
+    return TextIndex::Build(indexPath, digest, gTextIndexPageCount, getPageText, nullptr);
+}
+
+static void TextIndexRoundTripTest(const WCHAR* indexPath, const unsigned char digest[16]) {
+    utassert(BuildTestIndex(indexPath, digest));
+    TextIndex* index = TextIndex::Open(indexPath, digest, gTextIndexPageCount);
+    utassert(index);
+    if (!index)
+        return;
+    utassert(index->PageCount() == gTextIndexPageCount);
+    // hello, world, again, yellow, submarine
+    utassert(index->WordCount() == 5);
+
+    Vec<TextIndexHit> hits;
+    // matches are case-insensitive and within words
+    utassert(index->FindWordsContaining(L"ELLO", hits) == 2);
+    utassert(hits.size() == 3);
+    utassert(HasHit(hits, 1, 0) && HasHit(hits, 1, 12) && HasHit(hits, 3, 0));
+    hits.Reset();
+    utassert(index->FindWordsContaining(L"world", hits) == 1);
+    utassert(hits.size() == 2 && HasHit(hits, 1, 6) && HasHit(hits, 3, 18));
+    hits.Reset();
+    utassert(index->FindWordsContaining(L"o w", hits) == 0 && hits.size() == 0);
+    utassert(index->FindWordsContaining(L"", hits) == 0 && hits.size() == 0);
+    delete index;
+
+    // the index is only valid for the document it's been built for
+    unsigned char otherDigest[16];
+    memcpy(otherDigest, digest, 16);
+    otherDigest[15] ^= 1;
+    utassert(!TextIndex::Open(indexPath, otherDigest, gTextIndexPageCount));
+    utassert(!TextIndex::Open(indexPath, digest, gTextIndexPageCount + 1));
+
+    // building can be aborted
+    auto getNoText = [](int pageNo, int* lenOut) {
+        UNUSED(pageNo);
+        *lenOut = 0;
+        return L"";
+    };
+    auto abort = []() { return true; };
+    AutoFreeW abortedPath(str::Join(indexPath, L".aborted"));
+    utassert(!TextIndex::Build(abortedPath, digest, 1, getNoText, abort));
+    utassert(!file::Exists(abortedPath));
+}
+
+static void TextIndexCorruptionTest(const WCHAR* indexPath, const unsigned char digest[16]) {
+    utassert(BuildTestIndex(indexPath, digest));
+    OwnedData data(file::ReadFile(indexPath));
+    utassert(data.data && data.size > 40);
+    if (!data.data)
+        return;
+
+    // truncated files
+    size_t sizes[] = {0, 20, 40, data.size - 1};
+    for (size_t size : sizes) {
+        utassert(file::WriteFile(indexPath, data.data, size));
+        utassert(!TextIndex::Open(indexPath, digest, gTextIndexPageCount));
+    }
+
+    // a wrong magic number and an unknown version
+    AutoFree copy((char*)memdup(data.data, data.size));
+    copy.Get()[0] = 'X';
+    utassert(file::WriteFile(indexPath, copy.Get(), data.size));
+    utassert(!TextIndex::Open(indexPath, digest, gTextIndexPageCount));
+    memcpy(copy.Get(), data.data, data.size);
+    copy.Get()[4]++;
+    utassert(file::WriteFile(indexPath, copy.Get(), data.size));
+    utassert(!TextIndex::Open(indexPath, digest, gTextIndexPageCount));
+
+    // word records pointing outside of the chars and hits arrays (the header has 40 bytes,
+    // each word record consists of charOffset, charCount, firstHit and hitCount)
+    uint32_t* firstWord = (uint32_t*)(copy.Get() + 40);
+    for (int field = 0; field < 4; field++) {
+        memcpy(copy.Get(), data.data, data.size);
+        firstWord[field] = 0x7FFFFFFF;
+        utassert(file::WriteFile(indexPath, copy.Get(), data.size));
+        utassert(!TextIndex::Open(indexPath, digest, gTextIndexPageCount));
+    }
+
+    // the unmodified data is still accepted
+    utassert(file::WriteFile(indexPath, data.data, data.size));
+    TextIndex* index = TextIndex::Open(indexPath, digest, gTextIndexPageCount);
+    utassert(index);
+    delete index;
+}
+
+void TextIndexTest() {
+    AutoFreeW indexPath(path::GetTempPath(L"tix"));
+    utassert(indexPath);
+    if (!indexPath)
+        return;
+    unsigned char digest[16];
+    for (int i = 0; i < 16; i++) {
+        digest[i] = (unsigned char)(i * 17);
+    }
+
+    TextIndexRoundTripTest(indexPath, digest);
+    TextIndexCorruptionTest(indexPath, digest);
+
+    file::Delete(indexPath);
+}
@@ -3,9 +3,12 @@
 
 #include "BaseUtil.h"
 #include "ScopedWin.h"
+#include "WorkScheduler.h"
+#include "WStrFinder.h"
 #include "BaseEngine.h"
 #include "TextSelection.h"
 #include "TextSearch.h"
+#include "TextIndex.h"
 
 #define SkipWhitespace(c) for (; str::IsWs(*(c)); (c)++)
 // ignore spaces between CJK glyphs but not between Latin, Greek, Cyrillic, etc. letters
@@ -18,20 +21,46 @@ static void markAllPagesNonSkip(std::vector<bool>& pagesToSkip) {
     }
 }
 TextSearch::TextSearch(BaseEngine* engine, PageTextCache* textCache) : TextSelection(engine, textCache) {
-    nPages = engine->PageCount();
+    nPages = textCache->PageCount();
     pagesToSkip.resize(nPages);
-    markAllPagesNonSkip(pagesToSkip);
+    ResetPagesToSkip();
 }
 
 TextSearch::~TextSearch() {
     Clear();
 }
 
+void TextSearch::Clear() {
+    str::ReplacePtr(&findText, nullptr);
+    str::ReplacePtr(&anchor, nullptr);
+    str::ReplacePtr(&lastText, nullptr);
+    delete anchorFinder;
+    anchorFinder = nullptr;
+    Reset();
+}
+
 void TextSearch::Reset() {
     pageText = nullptr;
+    pageTextLen = 0;
     TextSelection::Reset();
 }
 
+const WCHAR* TextSearch::LoadPageText(int pageNo) {
+    pageText = textCache->GetData(pageNo, &pageTextLen);
+    return pageText;
+}
+
+// precomputes the anchor's case variants for FindTextInPage
+void TextSearch::UpdateAnchorFinder() {
+    delete anchorFinder;
+    anchorFinder = nullptr;
+    if (!anchor)
+        return;
+    // 'Match word end' can only be checked for the anchor if it's all of the search text
+    bool anchorWordEnd = matchWordEnd && str::Eq(anchor, findText);
+    anchorFinder = new WStrFinder((const wchar16*)anchor, caseSensitive, matchWordStart, anchorWordEnd);
+}
+
 void TextSearch::SetText(const WCHAR* text) {
     // search text starting with a single space enables the 'Match word start'
     // and search text ending in a single space enables the 'Match word end' option
@@ -71,7 +100,8 @@ void TextSearch::SetText(const WCHAR* text) {
     if (str::EndsWith(this->findText, L" "))
         this->findText[str::Len(this->findText) - 1] = '\0';
 
-    markAllPagesNonSkip(pagesToSkip);
+    UpdateAnchorFinder();
+    ResetPagesToSkip();
 }
 
 void TextSearch::SetSensitive(bool sensitive) {
@@ -80,7 +110,53 @@ void TextSearch::SetSensitive(bool sensitive) {
     }
     this->caseSensitive = sensitive;
 
+    UpdateAnchorFinder();
+    ResetPagesToSkip();
+}
+
+void TextSearch::ResetPagesToSkip() {
     markAllPagesNonSkip(pagesToSkip);
+    indexApplied = false;
+}
+
+// skips all pages which according to the document's text index don't contain the
+// anchor, so that their text doesn't have to be extracted at all. The index is
+// case-insensitive and thus also usable (if less precise) for case-sensitive searches
+void TextSearch::SkipPagesNotInIndex() {
+    if (indexApplied || !anchor || !isnoncjkwordchar(*anchor))
+        return;
+    TextIndex* index = textCache->GetIndex();
+    if (!index || index->PageCount() != nPages)
+        return;
+    indexApplied = true;
+
+    Vec<TextIndexHit> hits;
+    index->FindWordsContaining(anchor, hits);
+    std::vector<bool> hasHit(nPages);
+    for (size_t i = 0; i < hits.size(); i++) {
+        hasHit[hits.at(i).pageNo - 1] = true;
+    }
+    for (int i = 0; i < nPages; i++) {
+        if (!hasHit[i])
+            pagesToSkip[i] = true;
+    }
+}
+
+// returns false if the engine can rule out an anchor hit on pageNo without extracting
+// the page's text (which is much more expensive than the engine's own text search).
+// The engine only ignores the case of ASCII letters and doesn't know about the '?'
+// replacement characters, so this only applies to anchors of ASCII word characters
+bool TextSearch::PageMightContainAnchor(int pageNo) {
+    if (!anchor || !isnoncjkwordchar(*anchor))
+        return true;
+    for (const WCHAR* c = anchor; *c; c++) {
+        if (*c >= 0x80)
+            return true;
+    }
+    // pages with cached text are searched faster as they are
+    if (textCache->HasData(pageNo))
+        return true;
+    return engine->PageMightContainText(pageNo, anchor);
 }
 
 void TextSearch::SetDirection(TextSearchDirection direction) {
@@ -99,6 +175,7 @@ void TextSearch::SetDirection(TextSearchDirection direction) {
 }
 
 void TextSearch::SetLastResult(TextSelection* sel) {
+    PageTextCache::ReadScope scope(textCache);
     CopySelection(sel);
 
     AutoFreeW selection(ExtractText(L" "));
@@ -107,7 +184,7 @@ void TextSearch::SetLastResult(TextSelection* sel) {
 
     searchHitStartAt = findPage = std::min(startPage, endPage);
     findIndex = (findPage == startPage ? startGlyph : endGlyph) + (int)str::Len(findText);
-    pageText = textCache->GetData(findPage);
+    LoadPageText(findPage);
     forward = true;
 }
 
@@ -202,15 +279,11 @@ bool TextSearch::FindTextInPage(int pageNo, TextSearch::PageAndOffset* finalGlyp
     do {
         if (!anchor) {
             found = GetNextIndex(pageText, findIndex, forward);
-        } else if (forward) {
-            const WCHAR* s = pageText + findIndex;
-            if (caseSensitive) {
-                found = StrStr(s, anchor);
-            } else {
-                found = StrStrI(s, anchor);
-            }
         } else {
-            found = StrRStrI(pageText, pageText + findIndex, anchor);
+            const wchar16* s = (const wchar16*)pageText;
+            ptrdiff_t pos = forward ? anchorFinder->Find(s, pageTextLen, findIndex)
+                                    : anchorFinder->FindLast(s, pageTextLen, findIndex);
+            found = pos < 0 ? nullptr : pageText + pos;
         }
         if (!found)
             return false;
@@ -237,6 +310,7 @@ bool TextSearch::FindTextInPage(int pageNo, TextSearch::PageAndOffset* finalGlyp
 bool TextSearch::FindStartingAtPage(int pageNo, ProgressUpdateUI* tracker) {
     if (str::IsEmpty(findText))
         return false;
+    SkipPagesNotInIndex();
 
     int next = forward ? 1 : -1;
     while (1 <= pageNo && pageNo <= nPages && (!tracker || !tracker->WasCanceled())) {
@@ -244,24 +318,25 @@ bool TextSearch::FindStartingAtPage(int pageNo, ProgressUpdateUI* tracker) {
             tracker->UpdateProgress(pageNo, nPages);
         }
 
-        if (pagesToSkip[pageNo - 1]) {
+        if (pagesToSkip[pageNo - 1] || !PageMightContainAnchor(pageNo)) {
+            pagesToSkip[pageNo - 1] = true;
             pageNo += next;
             continue;
         }
 
         Reset();
 
-        pageText = textCache->GetData(pageNo, &findIndex);
-        if (pageText) {
-            if (forward) {
-                findIndex = 0;
-            }
+        // a scope per page, so that the text of pages evicted during a long search can be freed
+        PageTextCache::ReadScope scope(textCache);
+        findIndex = 0;
+        if (LoadPageText(pageNo)) {
+            findIndex = forward ? 0 : pageTextLen;
             PageAndOffset r;
             if (FindTextInPage(pageNo, &r)) {
                 if (forward) {
                     if (findPage != r.page) {
                         findPage = r.page;
-                        pageText = textCache->GetData(findPage);
+                        LoadPageText(findPage);
                     }
                     findIndex = r.offset;
                 }
@@ -299,14 +374,25 @@ TextSel* TextSearch::FindNext(ProgressUpdateUI* tracker) {
         tracker->UpdateProgress(findPage, nPages);
     }
 
-    PageAndOffset finalGlyph;
-    if (FindTextInPage(findPage, &finalGlyph)) {
-        if (forward) {
-            findPage = finalGlyph.page;
-            findIndex = finalGlyph.offset;
-            pageText = textCache->GetData(findPage);
+    {
+        PageTextCache::ReadScope scope(textCache);
+        // the page's text might have been evicted from the cache since the last call
+        if (1 <= findPage && findPage <= nPages) {
+            LoadPageText(findPage);
+        } else {
+            pageText = nullptr;
+            pageTextLen = 0;
+        }
+
+        PageAndOffset finalGlyph;
+        if (FindTextInPage(findPage, &finalGlyph)) {
+            if (forward) {
+                findPage = finalGlyph.page;
+                findIndex = finalGlyph.offset;
+                LoadPageText(findPage);
+            }
+            return &result;
         }
-        return &result;
     }
 
     auto next = forward ? 1 : -1;
@@ -315,3 +401,222 @@ TextSel* TextSearch::FindNext(ProgressUpdateUI* tracker) {
     }
     return nullptr;
 }
+
+// finds all hits starting on pageNo and appends their rectangles,
+// returns the number of hits
+int TextSearch::FindAllInPage(int pageNo, Vec<int>& pagesOut, Vec<RectI>& rectsOut) {
+    if (!PageMightContainAnchor(pageNo))
+        return 0;
+
+    PageTextCache::ReadScope scope(textCache);
+    Reset();
+    forward = true;
+    findPage = pageNo;
+    LoadPageText(pageNo);
+    findIndex = 0;
+
+    int hitCount = 0;
+    PageAndOffset fg;
+    while (FindTextInPage(pageNo, &fg)) {
+        hitCount++;
+        pagesOut.Append(result.pages, result.len);
+        rectsOut.Append(result.rects, result.len);
+        // a hit spanning a page break is the last one starting on this page
+        if (fg.page != pageNo)
+            break;
+    }
+    return hitCount;
+}
+
+namespace {
+
+struct FindAllPage {
+    bool done = false;
+    int hitCount = 0;
+    Vec<int> pages;
+    Vec<RectI> rects;
+};
+
+// state shared by all pages of a TextSearch::FindAll call
+struct FindAllState {
+    BaseEngine* engine;
+    PageTextCache* textCache;
+    const WCHAR* text;
+    bool caseSensitive;
+    TextSearchSink* sink;
+    ProgressUpdateUI* tracker;
+
+    std::mutex mutex;
+    // signaled whenever a page is done
+    std::condition_variable pageDone;
+    FindAllPage* pages;
+    int nPages;
+    int pagesDone = 0;
+    // pages before nextToReport have already been passed on to sink
+    int nextToReport = 1;
+    int totalHits = 0;
+    volatile bool canceled = false;
+    // idle TextSearch instances, one is needed per worker thread
+    Vec<TextSearch*> searchers;
+
+    TextSearch* GetSearcher() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (searchers.size() > 0)
+                return searchers.Pop();
+        }
+        TextSearch* searcher = new TextSearch(engine, textCache);
+        searcher->SetSensitive(caseSensitive);
+        searcher->SetText(text);
+        return searcher;
+    }
+
+    // must be called with mutex held. Reports pages in order as soon as possible
+    void ReportDonePages() {
+        for (; nextToReport <= nPages && pages[nextToReport - 1].done; nextToReport++) {
+            FindAllPage& page = pages[nextToReport - 1];
+            if (page.hitCount > 0 && !canceled) {
+                totalHits += page.hitCount;
+                TextSel hits = {(int)page.rects.size(), page.pages.LendData(), page.rects.LendData()};
+                sink->AddPageHits(nextToReport, page.hitCount, &hits, totalHits);
+            }
+            page.pages.Reset();
+            page.rects.Reset();
+        }
+    }
+
+    void MarkDone(int pageNo, TextSearch* searcher) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (searcher)
+            searchers.Append(searcher);
+        pages[pageNo - 1].done = true;
+        pagesDone++;
+        ReportDonePages();
+        if (tracker && !canceled) {
+            tracker->UpdateProgress(pagesDone, nPages);
+            canceled = tracker->WasCanceled();
+        }
+        pageDone.notify_all();
+    }
+};
+
+class FindAllItem : public WorkItem {
+    FindAllState* state;
+    int pageNo;
+
+  public:
+    FindAllItem(FindAllState* state, int pageNo) : state(state), pageNo(pageNo) {}
+
+    virtual void Run() {
+        if (state->canceled) {
+            state->MarkDone(pageNo, nullptr);
+            return;
+        }
+        TextSearch* searcher = state->GetSearcher();
+        FindAllPage& page = state->pages[pageNo - 1];
+        page.hitCount = searcher->FindAllInPage(pageNo, page.pages, page.rects);
+        state->MarkDone(pageNo, searcher);
+    }
+
+    // the scheduler also aborts items which have already marked their page as done
+    // (and are about to return), which mustn't turn a complete search into a canceled one
+    virtual void Abort() {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (!state->pages[pageNo - 1].done)
+            state->canceled = true;
+    }
+};
+
+} // namespace
+
+int TextSearch::FindAll(const WCHAR* text, TextSearchSink* sink, ProgressUpdateUI* tracker) {
+    Clear();
+    SetText(text);
+    if (str::IsEmpty(findText))
+        return 0;
+    SkipPagesNotInIndex();
+
+    FindAllState state;
+    state.engine = engine;
+    state.textCache = textCache;
+    state.text = text;
+    state.caseSensitive = caseSensitive;
+    state.sink = sink;
+    state.tracker = tracker;
+    state.nPages = nPages;
+    state.pages = new FindAllPage[nPages];
+
+    {
+        WorkScheduler scheduler(DefaultWorkerCount(MAX_FIND_ALL_THREADS));
+        int queued = 0;
+        // queue the pages in reverse order, so that they're run in document order
+        for (int pageNo = nPages; pageNo >= 1; pageNo--) {
+            if (!pagesToSkip[pageNo - 1]) {
+                scheduler.Push(new FindAllItem(&state, pageNo));
+                queued++;
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(state.mutex);
+        for (int pageNo = 1; pageNo <= nPages; pageNo++) {
+            if (pagesToSkip[pageNo - 1]) {
+                state.pages[pageNo - 1].done = true;
+                state.pagesDone++;
+            }
+        }
+        state.ReportDonePages();
+        state.pageDone.wait(lock, [&] { return state.pagesDone == nPages || state.canceled; });
+        // the scheduler's destructor drops the remaining pages and waits for the running ones
+        lock.unlock();
+    }
+
+    int totalHits = state.canceled ? -1 : state.totalHits;
+    delete[] state.pages;
+    DeleteVecMembers(state.searchers);
+
+    // allow for FindFirst/FindNext to start from scratch
+    Clear();
+    return totalHits;
+}
+
+bool TextSearch::FindPatterns(const WStrVec& patterns, PatternSearchSink* sink, Vec<int>& hitCountsOut,
+                              ProgressUpdateUI* tracker) {
+    Clear();
+    // whitespace, dashes and quotation marks are matched as loosely as by MatchEnd
+    MultiWStrFinder finder(caseSensitive, true);
+    for (const WCHAR* pattern : patterns) {
+        // leading and trailing single spaces are handled as in SetText
+        bool wordStart = pattern[0] == ' ' && pattern[1] != ' ';
+        bool wordEnd = str::EndsWith(pattern, L" ") && !str::EndsWith(pattern, L"  ");
+        AutoFreeW text(str::Dup(pattern[0] == ' ' ? pattern + 1 : pattern));
+        if (str::EndsWith(text, L" "))
+            text.Get()[str::Len(text) - 1] = '\0';
+        finder.AddPattern((const wchar16*)text.Get(), wordStart, wordEnd);
+    }
+    finder.Compile();
+    hitCountsOut.Reset();
+    hitCountsOut.AppendBlanks(patterns.size());
+
+    bool canceled = false;
+    for (int pageNo = 1; pageNo <= nPages; pageNo++) {
+        if (tracker) {
+            canceled = tracker->WasCanceled();
+            if (canceled)
+                break;
+            tracker->UpdateProgress(pageNo, nPages);
+        }
+        PageTextCache::ReadScope scope(textCache);
+        int len;
+        const WCHAR* text = textCache->GetData(pageNo, &len);
+        finder.FindAll((const wchar16*)text, len, [&](int pattern, size_t start, size_t end) {
+            StartAt(pageNo, (int)start);
+            SelectUpTo(pageNo, (int)end);
+            hitCountsOut.at(pattern)++;
+            sink->AddHit(pageNo, pattern, &result);
+        });
+    }
+
+    // allow for FindFirst/FindNext to start from scratch
+    Clear();
+    return !canceled;
+}
@@ -10,6 +10,30 @@ class ProgressUpdateUI {
     virtual ~ProgressUpdateUI() {}
 };
 
+// receives the results of TextSearch::FindAll
+class TextSearchSink {
+  public:
+    // called in page order for every page with at least one hit starting on it.
+    // hits contains the rectangles of all those hits (a hit spanning a page break
+    // also has rectangles on the following page) and totalHits is the running total.
+    // Calls are serialized but might happen on different threads
+    virtual void AddPageHits(int pageNo, int hitCount, TextSel* hits, int totalHits) = 0;
+    virtual ~TextSearchSink() {}
+};
+
+// receives the results of TextSearch::FindPatterns
+class PatternSearchSink {
+  public:
+    // called in page order for every hit, pattern being the index of the pattern that matched
+    virtual void AddHit(int pageNo, int pattern, TextSel* hit) = 0;
+    virtual ~PatternSearchSink() {}
+};
+
+// number of threads searching pages in parallel in TextSearch::FindAll
+#define MAX_FIND_ALL_THREADS 4
+
+class WStrFinder;
+
 class TextSearch : public TextSelection {
   public:
     TextSearch(BaseEngine* engine, PageTextCache* textCache);
@@ -20,6 +44,18 @@ class TextSearch : public TextSelection {
     void SetLastResult(TextSelection* sel);
     TextSel* FindFirst(int page, const WCHAR* text, ProgressUpdateUI* tracker = nullptr);
     TextSel* FindNext(ProgressUpdateUI* tracker = nullptr);
+    // finds all hits for text in the whole document, searching several pages in parallel,
+    // and streams them to sink. Returns the total number of hits (or -1 if canceled).
+    // Note that tracker is called from the worker threads. This resets the state for FindNext
+    int FindAll(const WCHAR* text, TextSearchSink* sink, ProgressUpdateUI* tracker = nullptr);
+    // finds all hits for any of the patterns, looking at the text of every page only once, and
+    // streams them to sink. hitCountsOut receives the number of hits per pattern. As for FindFirst,
+    // runs of whitespace match any whitespace and '-', '\'' and '"' match their typographic
+    // variants (here also the other way around). Other than for FindFirst, hits can't span page
+    // breaks and whitespace following punctuation (e.g. in "a, b") isn't optional.
+    // Returns false if canceled. This resets the state for FindNext
+    bool FindPatterns(const WStrVec& patterns, PatternSearchSink* sink, Vec<int>& hitCountsOut,
+                      ProgressUpdateUI* tracker = nullptr);
 
     // note: the result might not be a valid page number!
     int GetCurrentPageNo() const { return findPage; }
@@ -50,20 +86,26 @@ class TextSearch : public TextSelection {
     bool FindTextInPage(int pageNo, PageAndOffset* finalGlyph);
     bool FindStartingAtPage(int pageNo, ProgressUpdateUI* tracker);
     PageAndOffset MatchEnd(const WCHAR* start) const;
+    int FindAllInPage(int pageNo, Vec<int>& pagesOut, Vec<RectI>& rectsOut);
 
-    void Clear() {
-        str::ReplacePtr(&findText, nullptr);
-        str::ReplacePtr(&anchor, nullptr);
-        str::ReplacePtr(&lastText, nullptr);
-        Reset();
-    }
+    void Clear();
     void Reset();
+    const WCHAR* LoadPageText(int pageNo);
+    void UpdateAnchorFinder();
+    void ResetPagesToSkip();
+    void SkipPagesNotInIndex();
+    bool PageMightContainAnchor(int pageNo);
 
   private:
     const WCHAR* pageText = nullptr;
+    int pageTextLen = 0;
     int findIndex = 0;
+    // anchor search kernel with precomputed case variants (cf. UpdateAnchorFinder)
+    WStrFinder* anchorFinder = nullptr;
 
     WCHAR* lastText = nullptr;
     int nPages = 0;
     std::vector<bool> pagesToSkip;
+    // whether pagesToSkip already accounts for the text index
+    bool indexApplied = false;
 };
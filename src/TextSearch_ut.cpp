@@ -0,0 +1,188 @@
+/* Copyright 2018 the SumatraPDF project authors (see AUTHORS file).
+   License: GPLv3 */
+
+#include "BaseUtil.h"
+#include "BaseEngine.h"
+#include "TextSelection.h"
+#include "TextSearch.h"
+
+// must be last due to assert() over-write
+#include "UtAssert.h"
+
+// an engine whose pages consist of a single line of text
+class TextSearchTestEngine : public BaseEngine {
+    WStrVec pages;
+
+  public:
+    TextSearchTestEngine(const WCHAR** texts, int count) {
+        for (int i = 0; i < count; i++) {
+            pages.Append(str::Dup(texts[i]));
+        }
+    }
+
+    BaseEngine* Clone() override { return nullptr; }
+    int PageCount() const override { return (int)pages.size(); }
+    RectD PageMediabox(int pageNo) override {
+        UNUSED(pageNo);
+        return RectD(0, 0, 600, 800);
+    }
+    RenderedBitmap* RenderBitmap(int pageNo, float zoom, int rotation, RectD* pageRect, RenderTarget target,
+                                 AbortCookie** cookie_out) override {
+        UNUSED(pageNo);
+        UNUSED(zoom);
+        UNUSED(rotation);
+        UNUSED(pageRect);
+        UNUSED(target);
+        UNUSED(cookie_out);
+        return nullptr;
+    }
+    PointD Transform(PointD pt, int pageNo, float zoom, int rotation, bool inverse) override {
+        UNUSED(pageNo);
+        UNUSED(zoom);
+        UNUSED(rotation);
+        UNUSED(inverse);
+        return pt;
+    }
+    RectD Transform(RectD rect, int pageNo, float zoom, int rotation, bool inverse) override {
+        UNUSED(pageNo);
+        UNUSED(zoom);
+        UNUSED(rotation);
+        UNUSED(inverse);
+        return rect;
+    }
+    unsigned char* GetFileData(size_t* cbCount) override {
+        UNUSED(cbCount);
+        return nullptr;
+    }
+    bool SaveFileAs(const char* copyFileName, bool includeUserAnnots) override {
+        UNUSED(copyFileName);
+        UNUSED(includeUserAnnots);
+        return false;
+    }
+    // every glyph gets a 10x12 box on the same line
+    WCHAR* ExtractPageText(int pageNo, const WCHAR* lineSep, RectI** coordsOut, RenderTarget target) override {
+        UNUSED(lineSep);
+        UNUSED(target);
+        const WCHAR* text = pages.at(pageNo - 1);
+        if (coordsOut) {
+            size_t len = str::Len(text);
+            *coordsOut = AllocArray<RectI>(len + 1);
+            for (size_t i = 0; i < len; i++) {
+                (*coordsOut)[i] = RectI(10 * (int)i, 10, 10, 12);
+            }
+        }
+        return str::Dup(text);
+    }
+    bool HasClipOptimizations(int pageNo) override {
+        UNUSED(pageNo);
+        return false;
+    }
+    WCHAR* GetProperty(DocumentProperty prop) override {
+        UNUSED(prop);
+        return nullptr;
+    }
+    bool SupportsAnnotation(bool forSaving) const override {
+        UNUSED(forSaving);
+        return false;
+    }
+    void UpdateUserAnnotations(Vec<PageAnnotation>* list) override { UNUSED(list); }
+    const WCHAR* GetDefaultFileExt() const override { return L".txt"; }
+    Vec<PageElement*>* GetElements(int pageNo) override {
+        UNUSED(pageNo);
+        return nullptr;
+    }
+    PageElement* GetElementAtPos(int pageNo, PointD pt) override {
+        UNUSED(pageNo);
+        UNUSED(pt);
+        return nullptr;
+    }
+    bool BenchLoadPage(int pageNo) override {
+        UNUSED(pageNo);
+        return true;
+    }
+};
+
+// records the calls of TextSearch::FindAll (which are serialized)
+class TextSearchTestSink : public TextSearchSink, public ProgressUpdateUI {
+  public:
+    Vec<int> hitPages;
+    Vec<int> hitCounts;
+    int lastTotal = 0;
+    bool rectsOk = true;
+    int updates = 0;
+    // WasCanceled returns true after that many progress updates
+    int cancelAfter = INT_MAX;
+
+    void AddPageHits(int pageNo, int hitCount, TextSel* hits, int totalHits) override {
+        hitPages.Append(pageNo);
+        hitCounts.Append(hitCount);
+        lastTotal = totalHits;
+        // each hit of "foo" has a rectangle on the page it starts on
+        if (hits->len != hitCount)
+            rectsOk = false;
+        for (int i = 0; i < hits->len; i++) {
+            if (hits->pages[i] != pageNo || hits->rects[i].dx != 30)
+                rectsOk = false;
+        }
+    }
+    void UpdateProgress(int current, int total) override {
+        UNUSED(current);
+        UNUSED(total);
+        updates++;
+    }
+    bool WasCanceled() override { return updates >= cancelAfter; }
+};
+
+#define FIND_ALL_TEST_PAGES 40
+
+// page n contains n % 4 hits
+static const WCHAR* gFindAllTestTexts[] = {L"nothing here", L"one foo", L"foo and foo", L"Foo, foo and fOO"};
+
+static void FindAllCompletionTest(BaseEngine* engine, PageTextCache* cache) {
+    // repeat a few times, since aborting pages which were already done used to cancel the search
+    for (int run = 0; run < 20; run++) {
+        TextSearch search(engine, cache);
+        TextSearchTestSink sink;
+        int total = search.FindAll(L"foo", &sink, &sink);
+        // pages 1 to 40 contain 10 * (0 + 1 + 2 + 3) hits
+        utassert(total == 60);
+        utassert(sink.lastTotal == 60);
+        utassert(sink.rectsOk);
+        utassert(sink.hitPages.size() == 30);
+        // pages are reported in order
+        bool ordered = true;
+        for (size_t i = 0; i < sink.hitPages.size(); i++) {
+            int pageNo = sink.hitPages.at(i);
+            if ((i > 0 && pageNo <= sink.hitPages.at(i - 1)) || sink.hitCounts.at(i) != pageNo % 4)
+                ordered = false;
+        }
+        utassert(ordered);
+    }
+
+    TextSearch search(engine, cache);
+    TextSearchTestSink sink;
+    utassert(search.FindAll(L"bar", &sink) == 0 && sink.hitPages.size() == 0);
+    utassert(search.FindAll(L"", &sink) == 0);
+}
+
+static void FindAllCancellationTest(BaseEngine* engine, PageTextCache* cache) {
+    TextSearch search(engine, cache);
+    TextSearchTestSink sink;
+    sink.cancelAfter = 5;
+    utassert(search.FindAll(L"foo", &sink, &sink) == -1);
+    // no pages are reported once the search has been canceled
+    utassert(sink.hitPages.size() < 5);
+    utassert(sink.updates == 5);
+}
+
+void TextSearchTest() {
+    const WCHAR* texts[FIND_ALL_TEST_PAGES];
+    for (int i = 0; i < FIND_ALL_TEST_PAGES; i++) {
+        texts[i] = gFindAllTestTexts[(i + 1) % 4];
+    }
+    TextSearchTestEngine engine(texts, FIND_ALL_TEST_PAGES);
+    PageTextCache cache(&engine);
+
+    FindAllCompletionTest(&engine, &cache);
+    FindAllCancellationTest(&engine, &cache);
+}
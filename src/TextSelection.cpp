@@ -3,63 +3,416 @@
 
 #include "BaseUtil.h"
 #include "ScopedWin.h"
+#include "WorkScheduler.h"
 #include "BaseEngine.h"
 #include "TextSelection.h"
+#include "TextIndex.h"
 
-PageTextCache::PageTextCache(BaseEngine* engine) : engine(engine) {
-    int count = engine->PageCount();
-    coords = AllocArray<RectI*>(count);
-    text = AllocArray<WCHAR*>(count);
-    lens = AllocArray<int>(count);
-#ifdef DEBUG
-    debug_size = count * (sizeof(RectI*) + sizeof(WCHAR*) + sizeof(int));
-#endif
+// how long a background extraction waits before checking again
+// whether the user is still waiting for something more important
+#define EXTRACTION_THROTTLE_MS 50
 
+class BackgroundTextItem : public WorkItem {
+    std::function<bool()> isBusy;
+
+  protected:
+    PageTextCache* cache;
+    volatile bool aborted;
+
+    // returns false if the item has been aborted in the meantime
+    bool WaitUntilIdle() {
+        // text extraction must not slow down rendering and user interaction
+        SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+        while (isBusy && isBusy() && !aborted) {
+            Sleep(EXTRACTION_THROTTLE_MS);
+        }
+        return !aborted;
+    }
+
+  public:
+    BackgroundTextItem(PageTextCache* cache, const std::function<bool()>& isBusy)
+        : isBusy(isBusy), cache(cache), aborted(false) {}
+
+    virtual void Abort() { aborted = true; }
+};
+
+class PageTextExtractItem : public BackgroundTextItem {
+    int pageNo;
+
+  public:
+    PageTextExtractItem(PageTextCache* cache, int pageNo, const std::function<bool()>& isBusy)
+        : BackgroundTextItem(cache, isBusy), pageNo(pageNo) {}
+
+    virtual void Run() {
+        // pages extracted beyond the memory budget would only evict other pages
+        if (WaitUntilIdle() && !cache->HasData(pageNo) && !cache->IsFull()) {
+            PageTextCache::ReadScope scope(cache);
+            cache->GetData(pageNo);
+        }
+    }
+};
+
+// loads the text index for a document or builds it, if it's missing or outdated
+class TextIndexItem : public BackgroundTextItem {
+    AutoFreeW filePath;
+    AutoFreeW indexPath;
+
+  public:
+    TextIndexItem(PageTextCache* cache, const WCHAR* filePath, const WCHAR* indexPath,
+                  const std::function<bool()>& isBusy)
+        : BackgroundTextItem(cache, isBusy), filePath(str::Dup(filePath)), indexPath(str::Dup(indexPath)) {}
+
+    virtual void Run() {
+        unsigned char digest[16];
+        if (!WaitUntilIdle() || !TextIndex::CalcFileDigest(filePath, digest))
+            return;
+        int pageCount = cache->PageCount();
+        TextIndex* index = TextIndex::Open(indexPath, digest, pageCount);
+        if (!index) {
+            // the text of a page is only needed until the next page is requested.
+            // While the cache has room, pages are extracted into it, so that the
+            // pre-warming extraction doesn't have to extract the same pages again
+            // (pages beyond the budget are extracted on their own, so as not to evict others)
+            std::unique_ptr<PageTextCache::ReadScope> scope;
+            AutoFreeW pageText;
+            auto getPageText = [&](int pageNo, int* lenOut) {
+                if (cache->HasData(pageNo) || !cache->IsFull()) {
+                    // end the previous page's scope first, so that pages evicted meanwhile can be freed
+                    scope.reset();
+                    scope.reset(new PageTextCache::ReadScope(cache));
+                    return cache->GetData(pageNo, lenOut);
+                }
+                pageText.Set(cache->GetTextOnly(pageNo, lenOut));
+                return (const WCHAR*)pageText.Get();
+            };
+            auto shouldAbort = [&]() { return !WaitUntilIdle(); };
+            if (!TextIndex::Build(indexPath, digest, pageCount, getPageText, shouldAbort))
+                return;
+            index = TextIndex::Open(indexPath, digest, pageCount);
+        }
+        if (index)
+            cache->SetIndex(index);
+    }
+};
+
+/*
+The glyph boxes of a page are stored as a byte stream with one record per glyph,
+starting with a flags byte:
+  COORDS_EMPTY: the box is empty (e.g. for line breaks), no further data
+  COORDS_REPEAT: the box is the same as the previous one (e.g. for DjVu words)
+  COORDS_SAME_LINE: y and dy are the same as for the previous box
+followed by the zigzag encoded varints x - previous right edge, y - previous y, dx, dy
+(with y and dy omitted for COORDS_SAME_LINE). Empty boxes don't count as previous box.
+Every COORDS_BLOCK_GLYPHS glyphs, the previous box is reset, so that decoding can
+start at any block. This takes 2 to 4 bytes for most glyphs instead of sizeof(RectI).
+*/
+
+#define COORDS_BLOCK_GLYPHS 64
+
+enum { COORDS_EMPTY = 1, COORDS_REPEAT = 2, COORDS_SAME_LINE = 4 };
+
+struct PageTextData {
+    WCHAR* text;
+    int len;
+    // encoded glyph boxes
+    uint8_t* coords;
+    // offsets into coords for every COORDS_BLOCK_GLYPHS-th glyph
+    uint32_t* blocks;
+    // memory used by this page
+    size_t size;
+    uint64_t lastUsed;
+    // the value of PageTextCache::evictions after evicting this page
+    uint64_t evicted;
+};
+
+// differences are computed modulo 2^32, so that the encoding is lossless for all values
+static void AppendVarint(Vec<uint8_t>& out, uint32_t value) {
+    int32_t n = (int32_t)value;
+    uint32_t zz = ((uint32_t)n << 1) ^ (uint32_t)(n >> 31);
+    for (; zz >= 0x80; zz >>= 7) {
+        out.Append((uint8_t)(zz | 0x80));
+    }
+    out.Append((uint8_t)zz);
+}
+
+static uint32_t ReadVarint(const uint8_t*& data) {
+    uint32_t zz = 0;
+    for (int shift = 0;; shift += 7) {
+        uint8_t b = *data++;
+        zz |= (uint32_t)(b & 0x7F) << shift;
+        if (!(b & 0x80))
+            break;
+    }
+    return (zz >> 1) ^ (0 - (zz & 1));
+}
+
+static PageTextData* CreatePageTextData(WCHAR* text, const RectI* coords) {
+    PageTextData* page = AllocStruct<PageTextData>();
+    page->text = text;
+    page->len = (int)str::Len(text);
+
+    int blockCount = page->len / COORDS_BLOCK_GLYPHS + 1;
+    page->blocks = AllocArray<uint32_t>(blockCount);
+    Vec<uint8_t> data(page->len * 3);
+    RectI prev;
+    for (int i = 0; i < page->len; i++) {
+        if (i % COORDS_BLOCK_GLYPHS == 0) {
+            page->blocks[i / COORDS_BLOCK_GLYPHS] = (uint32_t)data.size();
+            prev = RectI();
+        }
+        RectI r = coords ? coords[i] : RectI();
+        if (r == RectI()) {
+            data.Append(COORDS_EMPTY);
+            continue;
+        }
+        if (r == prev) {
+            data.Append(COORDS_REPEAT);
+            continue;
+        }
+        bool sameLine = r.y == prev.y && r.dy == prev.dy;
+        data.Append(sameLine ? COORDS_SAME_LINE : 0);
+        AppendVarint(data, (uint32_t)r.x - (uint32_t)prev.x - (uint32_t)prev.dx);
+        if (!sameLine)
+            AppendVarint(data, (uint32_t)r.y - (uint32_t)prev.y);
+        AppendVarint(data, (uint32_t)r.dx);
+        if (!sameLine)
+            AppendVarint(data, (uint32_t)r.dy);
+        prev = r;
+    }
+    page->coords = AllocArray<uint8_t>(data.size() + 1);
+    memcpy(page->coords, data.LendData(), data.size());
+
+    page->size = sizeof(PageTextData) + (page->len + 1) * sizeof(WCHAR) + data.size() + 1 +
+                 blockCount * sizeof(uint32_t);
+    return page;
+}
+
+static void FreePageTextData(PageTextData* page) {
+    free(page->text);
+    free(page->coords);
+    free(page->blocks);
+    free(page);
+}
+
+static void DecodeCoords(PageTextData* page, int start, int count, RectI* coordsOut) {
+    CrashIf(start < 0 || count < 0 || start + count > page->len);
+    RectI prev;
+    const uint8_t* data = nullptr;
+    for (int i = start - start % COORDS_BLOCK_GLYPHS; i < start + count; i++) {
+        if (i % COORDS_BLOCK_GLYPHS == 0) {
+            data = page->coords + page->blocks[i / COORDS_BLOCK_GLYPHS];
+            prev = RectI();
+        }
+        uint8_t flags = *data++;
+        RectI r;
+        if (flags & COORDS_REPEAT) {
+            r = prev;
+        } else if (!(flags & COORDS_EMPTY)) {
+            r.x = (int)((uint32_t)prev.x + (uint32_t)prev.dx + ReadVarint(data));
+            r.y = (flags & COORDS_SAME_LINE) ? prev.y : (int)((uint32_t)prev.y + ReadVarint(data));
+            r.dx = (int)ReadVarint(data);
+            r.dy = (flags & COORDS_SAME_LINE) ? prev.dy : (int)ReadVarint(data);
+            prev = r;
+        }
+        if (i >= start)
+            coordsOut[i - start] = r;
+    }
+}
+
+PageTextCache::PageTextCache(BaseEngine* engine, int pageCount)
+    : engine(engine), pageCount(pageCount), bytes(0), useCount(0), evictions(0), extractor(nullptr), index(nullptr) {
+    if (this->pageCount <= 0)
+        this->pageCount = engine->PageCount();
+    pages = AllocArray<PageTextData*>(pageCount);
     InitializeCriticalSection(&access);
 }
 
 PageTextCache::~PageTextCache() {
+    StopExtraction();
+
     EnterCriticalSection(&access);
+    CrashIf(readers.size() != 0);
 
-    for (int i = 0; i < engine->PageCount(); i++) {
-        free(coords[i]);
-        free(text[i]);
+    for (int i = 0; i < pageCount; i++) {
+        if (pages[i])
+            FreePageTextData(pages[i]);
     }
-
-    free(coords);
-    free(text);
-    free(lens);
+    free(pages);
+    FreeRetired();
+    delete index;
 
     LeaveCriticalSection(&access);
     DeleteCriticalSection(&access);
 }
 
+PageTextCache::ReadScope::ReadScope(PageTextCache* cache) : cache(cache) {
+    ScopedCritSec scope(&cache->access);
+    start = cache->evictions;
+    cache->readers.Append(start);
+}
+
+PageTextCache::ReadScope::~ReadScope() {
+    ScopedCritSec scope(&cache->access);
+    bool removed = cache->readers.Remove(start);
+    CrashIf(!removed);
+    cache->FreeRetired();
+}
+
+// frees all retired pages which have been evicted before the oldest active ReadScope started
+// (must be called with access held)
+void PageTextCache::FreeRetired() {
+    uint64_t oldestReader = UINT64_MAX;
+    for (uint64_t start : readers) {
+        oldestReader = std::min(oldestReader, start);
+    }
+    size_t count = 0;
+    for (; count < retired.size() && retired.at(count)->evicted <= oldestReader; count++) {
+        FreePageTextData(retired.at(count));
+    }
+    retired.RemoveAt(0, count);
+}
+
+// must be called with access held
+void PageTextCache::EvictOverBudget(PageTextData* keep) {
+    while (bytes > MAX_PAGE_TEXT_MEMORY) {
+        int victim = -1;
+        for (int i = 0; i < pageCount; i++) {
+            if (pages[i] && pages[i] != keep && (-1 == victim || pages[i]->lastUsed < pages[victim]->lastUsed))
+                victim = i;
+        }
+        if (-1 == victim)
+            break;
+        bytes -= pages[victim]->size;
+        pages[victim]->evicted = ++evictions;
+        retired.Append(pages[victim]);
+        pages[victim] = nullptr;
+    }
+    FreeRetired();
+}
+
 bool PageTextCache::HasData(int pageNo) {
-    CrashIf(pageNo < 1 || pageNo > engine->PageCount());
-    return text[pageNo - 1] != nullptr;
+    CrashIf(pageNo < 1 || pageNo > pageCount);
+    return pages[pageNo - 1] != nullptr;
 }
 
-const WCHAR* PageTextCache::GetData(int pageNo, int* lenOut, RectI** coordsOut) {
+bool PageTextCache::IsFull() {
     ScopedCritSec scope(&access);
+    return bytes >= MAX_PAGE_TEXT_MEMORY;
+}
 
-    if (!text[pageNo - 1]) {
-        text[pageNo - 1] = engine->ExtractPageText(pageNo, L"\n", &coords[pageNo - 1]);
-        if (!text[pageNo - 1]) {
-            text[pageNo - 1] = str::Dup(L"");
-            lens[pageNo - 1] = 0;
-        } else {
-            lens[pageNo - 1] = (int)str::Len(text[pageNo - 1]);
-        }
-#ifdef DEBUG
-        debug_size += (lens[pageNo - 1] + 1) * (sizeof(WCHAR) + sizeof(RectI));
-#endif
+PageTextData* PageTextCache::GetPage(int pageNo) {
+    EnterCriticalSection(&access);
+    PageTextData* page = pages[pageNo - 1];
+    if (page)
+        page->lastUsed = ++useCount;
+    LeaveCriticalSection(&access);
+    if (page)
+        return page;
+
+    // extract without holding the lock, so that requests for other pages
+    // (e.g. from the background extraction) don't have to wait for this one
+    RectI* pageCoords = nullptr;
+    WCHAR* pageText = engine->ExtractPageText(pageNo, L"\n", &pageCoords);
+    if (!pageText)
+        pageText = str::Dup(L"");
+    page = CreatePageTextData(pageText, pageCoords);
+    free(pageCoords);
+
+    ScopedCritSec scope(&access);
+    if (pages[pageNo - 1]) {
+        // another thread has extracted the same page in the meantime
+        FreePageTextData(page);
+        page = pages[pageNo - 1];
+    } else {
+        pages[pageNo - 1] = page;
+        bytes += page->size;
+        EvictOverBudget(page);
     }
+    page->lastUsed = ++useCount;
+    return page;
+}
 
+const WCHAR* PageTextCache::GetData(int pageNo, int* lenOut) {
+    PageTextData* page = GetPage(pageNo);
+    if (lenOut)
+        *lenOut = page->len;
+    return page->text;
+}
+
+WCHAR* PageTextCache::GetTextOnly(int pageNo, int* lenOut) {
+    {
+        ScopedCritSec scope(&access);
+        PageTextData* page = pages[pageNo - 1];
+        if (page) {
+            page->lastUsed = ++useCount;
+            if (lenOut)
+                *lenOut = page->len;
+            return str::DupN(page->text, page->len);
+        }
+    }
+    WCHAR* text = engine->ExtractPageText(pageNo, L"\n");
+    if (!text)
+        text = str::Dup(L"");
     if (lenOut)
-        *lenOut = lens[pageNo - 1];
-    if (coordsOut)
-        *coordsOut = coords[pageNo - 1];
-    return text[pageNo - 1];
+        *lenOut = (int)str::Len(text);
+    return text;
+}
+
+void PageTextCache::GetCoords(int pageNo, int start, int count, RectI* coordsOut) {
+    DecodeCoords(GetPage(pageNo), start, count, coordsOut);
+}
+
+int PageTextCache::PageCount() const {
+    return pageCount;
+}
+
+void PageTextCache::StartExtraction(int pageNo, const std::function<bool()>& isBusy) {
+    int count = pageCount;
+    if (!extractor)
+        extractor = new WorkScheduler(DefaultWorkerCount(MAX_TEXT_EXTRACTION_THREADS));
+    else
+        extractor->RemoveQueued(nullptr);
+    pageNo = limitValue(pageNo, 1, count);
+
+    // the most recently queued items are run first, so queue the
+    // pages farthest away from pageNo first and the closest ones last
+    Vec<int> pages;
+    for (int dist = 0; pageNo - dist >= 1 || pageNo + dist <= count; dist++) {
+        if (pageNo + dist <= count)
+            pages.Append(pageNo + dist);
+        if (dist > 0 && pageNo - dist >= 1)
+            pages.Append(pageNo - dist);
+    }
+    for (int i = (int)pages.size() - 1; i >= 0; i--) {
+        if (!HasData(pages.at(i)))
+            extractor->Push(new PageTextExtractItem(this, pages.at(i), isBusy));
+    }
+}
+
+void PageTextCache::StartIndexing(const WCHAR* filePath, const WCHAR* indexPath, const std::function<bool()>& isBusy) {
+    if (!filePath || !indexPath || GetIndex())
+        return;
+    if (!extractor)
+        extractor = new WorkScheduler(DefaultWorkerCount(MAX_TEXT_EXTRACTION_THREADS));
+    extractor->Push(new TextIndexItem(this, filePath, indexPath, isBusy));
+}
+
+TextIndex* PageTextCache::GetIndex() {
+    ScopedCritSec scope(&access);
+    return index;
+}
+
+void PageTextCache::SetIndex(TextIndex* newIndex) {
+    ScopedCritSec scope(&access);
+    CrashIf(index);
+    delete index;
+    index = newIndex;
+}
+
+void PageTextCache::StopExtraction() {
+    // the destructor drops the queued items and waits for the running ones
+    delete extractor;
+    extractor = nullptr;
 }
 
 TextSelection::TextSelection(BaseEngine* engine, PageTextCache* textCache)
@@ -85,9 +438,15 @@ void TextSelection::Reset() {
 // (i.e. when over the right half of a glyph, the returned index will be for the
 // glyph following it, which will be the first glyph (not) to be selected)
 int TextSelection::FindClosestGlyph(int pageNo, double x, double y) {
+    PageTextCache::ReadScope scope(textCache);
     int textLen;
-    RectI* coords;
-    textCache->GetData(pageNo, &textLen, &coords);
+    textCache->GetData(pageNo, &textLen);
+    ScopedMem<RectI> coords(AllocArray<RectI>(textLen + 1));
+    textCache->GetCoords(pageNo, 0, textLen, coords);
+    return FindClosestGlyph(pageNo, x, y, coords, textLen);
+}
+
+int TextSelection::FindClosestGlyph(int pageNo, double x, double y, const RectI* coords, int textLen) {
     PointD pt = PointD(x, y);
 
     unsigned int maxDist = UINT_MAX;
@@ -133,12 +492,16 @@ int TextSelection::FindClosestGlyph(int pageNo, double x, double y) {
 }
 
 void TextSelection::FillResultRects(int pageNo, int glyph, int length, WStrVec* lines) {
+    PageTextCache::ReadScope scope(textCache);
     int len;
-    RectI* coords;
-    const WCHAR* text = textCache->GetData(pageNo, &len, &coords);
+    const WCHAR* text = textCache->GetData(pageNo, &len);
     CrashIf(len < glyph + length);
+    // also decode the box following the range, for cutting the last rectangle's right edge
+    int count = std::min(length + 1, len - glyph);
+    ScopedMem<RectI> coords(AllocArray<RectI>(count + 1));
+    textCache->GetCoords(pageNo, glyph, count, coords);
     RectI mediabox = engine->PageMediabox(pageNo).Round();
-    RectI *c = &coords[glyph], *end = c + length;
+    RectI *c = coords.Get(), *end = c + length;
     while (c < end) {
         // skip line breaks
         for (; c < end && !c->x && !c->dx; c++)
@@ -154,12 +517,12 @@ void TextSelection::FillResultRects(int pageNo, int glyph, int length, WStrVec*
             continue;
 
         if (lines) {
-            lines->Push(str::DupN(text + (c0 - coords), c - c0));
+            lines->Push(str::DupN(text + glyph + (c0 - coords), c - c0));
             continue;
         }
 
         // cut the right edge, if it overlaps the next character
-        if (c < coords + len && (c->x || c->dx) && bbox.x < c->x && bbox.x + bbox.dx > c->x)
+        if (c < coords + count && (c->x || c->dx) && bbox.x < c->x && bbox.x + bbox.dx > c->x)
             bbox.dx = c->x - bbox.x;
 
         result.len++;
@@ -175,11 +538,13 @@ void TextSelection::FillResultRects(int pageNo, int glyph, int length, WStrVec*
 }
 
 bool TextSelection::IsOverGlyph(int pageNo, double x, double y) {
+    PageTextCache::ReadScope scope(textCache);
     int textLen;
-    RectI* coords;
-    textCache->GetData(pageNo, &textLen, &coords);
+    textCache->GetData(pageNo, &textLen);
+    ScopedMem<RectI> coords(AllocArray<RectI>(textLen + 1));
+    textCache->GetCoords(pageNo, 0, textLen, coords);
 
-    int glyphIx = FindClosestGlyph(pageNo, x, y);
+    int glyphIx = FindClosestGlyph(pageNo, x, y, coords, textLen);
     PointI pt = PointD(x, y).ToInt();
     // when over the right half of a glyph, FindClosestGlyph returns the
     // index of the next glyph, in which case glyphIx must be decremented
@@ -194,6 +559,7 @@ void TextSelection::StartAt(int pageNo, int glyphIx) {
     startPage = pageNo;
     startGlyph = glyphIx;
     if (glyphIx < 0) {
+        PageTextCache::ReadScope scope(textCache);
         int textLen;
         textCache->GetData(pageNo, &textLen);
         startGlyph += textLen + 1;
@@ -204,6 +570,7 @@ void TextSelection::SelectUpTo(int pageNo, int glyphIx) {
     if (startPage == -1 || startGlyph == -1)
         return;
 
+    PageTextCache::ReadScope scope(textCache);
     endPage = pageNo;
     endGlyph = glyphIx;
     if (glyphIx < 0) {
@@ -231,6 +598,7 @@ void TextSelection::SelectUpTo(int pageNo, int glyphIx) {
 }
 
 void TextSelection::SelectWordAt(int pageNo, double x, double y) {
+    PageTextCache::ReadScope scope(textCache);
     int ix = FindClosestGlyph(pageNo, x, y);
     int textLen;
     const WCHAR* text = textCache->GetData(pageNo, &textLen);
@@ -255,6 +623,7 @@ void TextSelection::CopySelection(TextSelection* orig) {
 }
 
 WCHAR* TextSelection::ExtractText(const WCHAR* lineSep) {
+    PageTextCache::ReadScope scope(textCache);
     WStrVec lines;
 
     int fromPage, fromGlyph, toPage, toGlyph;
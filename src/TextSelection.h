@@ -9,23 +9,86 @@ inline bool isWordChar(WCHAR c) {
     return IsCharAlphaNumeric(c) || c == '_';
 }
 
+// number of threads extracting page text in the background
+#define MAX_TEXT_EXTRACTION_THREADS 2
+// memory budget for the text of pages which aren't currently being read
+#define MAX_PAGE_TEXT_MEMORY (32 * 1024 * 1024)
+
+class WorkScheduler;
+class TextIndex;
+struct PageTextData;
+
 class PageTextCache {
     BaseEngine* engine;
-    RectI** coords;
-    WCHAR** text;
-    int* lens;
-#ifdef DEBUG
-    size_t debug_size;
-#endif
+    // the engine's page count might still change (cf. BaseEngine::SetPageCountFinalCallback),
+    // so pages is sized for the count at creation (as estimated by the DisplayModel)
+    int pageCount;
+    PageTextData** pages;
+    // memory used by all pages in the cache
+    size_t bytes;
+    // for finding the least recently used page
+    uint64_t useCount;
+    // number of pages evicted so far
+    uint64_t evictions;
+    // the value of evictions at the start of each active ReadScope (on all threads)
+    Vec<uint64_t> readers;
+    // evicted pages (in order of eviction), which can't be freed while a
+    // ReadScope is active which started before they've been evicted
+    Vec<PageTextData*> retired;
 
     CRITICAL_SECTION access;
 
+    // extracts the text of all pages in the background (cf. StartExtraction)
+    WorkScheduler* extractor;
+    TextIndex* index;
+
+    PageTextData* GetPage(int pageNo);
+    void EvictOverBudget(PageTextData* keep);
+    void FreeRetired();
+
   public:
-    explicit PageTextCache(BaseEngine* engine);
+    // pageCount defaults to the engine's (exact) page count
+    explicit PageTextCache(BaseEngine* engine, int pageCount = 0);
     ~PageTextCache();
 
+    // GetData and GetCoords must only be called inside a ReadScope. Pages which are evicted
+    // to stay within MAX_PAGE_TEXT_MEMORY aren't freed before all ReadScopes (on all
+    // threads) which started before the eviction have ended, so the returned text
+    // remains valid until then. ReadScopes should thus be short (e.g. one per page)
+    class ReadScope {
+        PageTextCache* cache;
+        uint64_t start;
+
+      public:
+        explicit ReadScope(PageTextCache* cache);
+        ~ReadScope();
+    };
+
     bool HasData(int pageNo);
-    const WCHAR* GetData(int pageNo, int* lenOut = nullptr, RectI** coordsOut = nullptr);
+    const WCHAR* GetData(int pageNo, int* lenOut = nullptr);
+    // decodes the bounding boxes of count glyphs starting at glyph start
+    // (glyphs without a box, e.g. line breaks, have an empty rectangle)
+    void GetCoords(int pageNo, int start, int count, RectI* coordsOut);
+    // returns true once the budget is used up (so prefetching more text is pointless)
+    bool IsFull();
+    // returns a newly allocated copy of a page's text, for callers which only search it:
+    // uncached pages are extracted without glyph boxes and aren't added to the cache
+    WCHAR* GetTextOnly(int pageNo, int* lenOut = nullptr);
+
+    // starts extracting the text of all pages on low priority threads, beginning
+    // with the pages closest to pageNo, so that searching and selecting text doesn't
+    // have to wait for it. The extraction pauses for as long as isBusy returns true
+    void StartExtraction(int pageNo, const std::function<bool()>& isBusy = nullptr);
+    // loads the persistent text index for filePath from indexPath in the background
+    // (or creates it there from the extracted text, if it's missing or outdated)
+    void StartIndexing(const WCHAR* filePath, const WCHAR* indexPath, const std::function<bool()>& isBusy = nullptr);
+    // drops all pending extractions and waits for the running ones to finish
+    void StopExtraction();
+
+    // returns nullptr until the text index has been loaded (cf. StartIndexing)
+    TextIndex* GetIndex();
+    void SetIndex(TextIndex* index);
+    int PageCount() const;
 };
 
 struct TextSel {
@@ -61,5 +124,6 @@ class TextSelection {
     PageTextCache* textCache;
 
     int FindClosestGlyph(int pageNo, double x, double y);
+    int FindClosestGlyph(int pageNo, double x, double y, const RectI* coords, int textLen);
     void FillResultRects(int pageNo, int glyph, int length, WStrVec* lines = nullptr);
 };
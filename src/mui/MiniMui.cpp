@@ -4,6 +4,7 @@
 // as little of mui as necessary to make ../EngineDump.cpp compile
 
 #include "BaseUtil.h"
+#include "ScopedWin.h"
 #include "MiniMui.h"
 #include "WinUtil.h"
 
@@ -11,7 +12,11 @@ using namespace Gdiplus;
 
 namespace mui {
 
+// the font cache is shared with the threads laying out ebooks
+static CRITICAL_SECTION gMiniMuiCs;
+
 HFONT CachedFont::GetHFont() {
+    ScopedCritSec scope(&gMiniMuiCs);
     if (!hFont) {
         LOGFONTW lf;
         // TODO: Graphics is probably only used for metrics,
@@ -48,6 +53,7 @@ class CachedFontItem : public CachedFont {
 static CachedFontItem* gFontCache = nullptr;
 
 CachedFont* GetCachedFont(const WCHAR* name, float size, FontStyle style) {
+    ScopedCritSec scope(&gMiniMuiCs);
     CachedFontItem** item = &gFontCache;
     for (; *item; item = &(*item)->_next) {
         if ((*item)->SameAs(name, size, style)) {
@@ -78,33 +84,34 @@ void InitGraphicsMode(Graphics* g) {
     g->SetPageUnit(UnitPixel);
 }
 
-class GlobalGraphicsHack {
+struct MeasureTextBitmap {
     Bitmap bmp;
 
-  public:
-    Graphics gfx;
-
-    GlobalGraphicsHack() : bmp(1, 1, PixelFormat32bppARGB), gfx(&bmp) { InitGraphicsMode(&gfx); }
+    MeasureTextBitmap() : bmp(1, 1, PixelFormat32bppARGB) {}
 };
 
-static GlobalGraphicsHack* gGraphicsHack = nullptr;
+// the bitmap must be constructed before the Graphics drawing into it
+class MeasureTextGraphics : MeasureTextBitmap, public Graphics {
+  public:
+    MeasureTextGraphics() : Graphics(&bmp) { InitGraphicsMode(this); }
+};
 
+// GDI+ objects mustn't be used on several threads at once, so every caller
+// gets its own Graphics (these are only needed once per formatter or font)
 Graphics* AllocGraphicsForMeasureText() {
-    if (!gGraphicsHack) {
-        gGraphicsHack = new GlobalGraphicsHack();
-    }
-    return &gGraphicsHack->gfx;
+    return new MeasureTextGraphics();
 }
 
 void FreeGraphicsForMeasureText(Graphics* g) {
-    UNUSED(g); /* deallocation happens in mui::Destroy */
+    delete static_cast<MeasureTextGraphics*>(g);
 }
 
 // allow for calls to mui::Initialize and mui::Destroy to be nested
 static LONG gMiniMuiRefCount = 0;
 
 void Initialize() {
-    InterlockedIncrement(&gMiniMuiRefCount);
+    if (InterlockedIncrement(&gMiniMuiRefCount) == 1)
+        InitializeCriticalSection(&gMiniMuiCs);
 }
 
 void Destroy() {
@@ -113,7 +120,6 @@ void Destroy() {
 
     delete gFontCache;
     gFontCache = nullptr;
-    delete gGraphicsHack;
-    gGraphicsHack = nullptr;
+    DeleteCriticalSection(&gMiniMuiCs);
 }
 } // namespace mui
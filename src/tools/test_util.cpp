@@ -13,6 +13,12 @@ extern void SumatraPDF_UnitTests();
 // in src/mui/SvgPath_ut.cpp
 extern void SvgPath_UnitTests();
 
+// in src/TextIndex_ut.cpp
+extern void TextIndexTest();
+
+// in src/TextSearch_ut.cpp
+extern void TextSearchTest();
+
 extern void BaseUtilTest();
 extern void ByteOrderTests();
 extern void CmdLineParserTest();
@@ -32,11 +38,16 @@ extern void TrivialHtmlParser_UnitTests();
 // extern void VarintGobTest();
 extern void VecTest();
 extern void WinUtilTest();
+extern void WorkSchedulerTest();
+extern void WStrFinderTest();
+extern void WStrFinderBenchmark();
 extern void StrFormatTest();
 
 int main(int argc, char** argv) {
-    UNUSED(argc);
-    UNUSED(argv);
+    if (argc > 1 && str::Eq(argv[1], "-bench")) {
+        WStrFinderBenchmark();
+        return 0;
+    }
     printf("Running unit tests\n");
     InitDynCalls();
     BaseUtilTest();
@@ -57,8 +68,12 @@ int main(int argc, char** argv) {
     // VarintGobTest();
     VecTest();
     WinUtilTest();
+    WorkSchedulerTest();
+    WStrFinderTest();
     SumatraPDF_UnitTests();
     SvgPath_UnitTests();
+    TextIndexTest();
+    TextSearchTest();
     StrFormatTest();
 
     int res = utassert_print_results();
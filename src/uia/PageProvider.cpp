@@ -212,6 +212,7 @@ HRESULT STDMETHODCALLTYPE SumatraUIAutomationPageProvider::get_Value(BSTR* pRetV
     if (released)
         return E_FAIL;
 
+    PageTextCache::ReadScope scope(dm->textCache);
     const WCHAR* pageContent = dm->textCache->GetData(pageNum);
     if (!pageContent) {
         *pRetVal = nullptr;
@@ -90,6 +90,7 @@ int SumatraUIAutomationTextRange::GetPageGlyphCount(int pageNum) {
     AssertCrash(document->IsDocumentLoaded());
     AssertCrash(pageNum > 0);
 
+    PageTextCache::ReadScope scope(document->GetDM()->textCache);
     int pageLen;
     document->GetDM()->textCache->GetData(pageNum, &pageLen);
     return pageLen;
@@ -119,6 +120,7 @@ void SumatraUIAutomationTextRange::ValidateEndEndpoint() {
 
 int SumatraUIAutomationTextRange::FindPreviousWordEndpoint(int pageno, int idx, bool dontReturnInitial) {
     // based on TextSelection::SelectWordAt
+    PageTextCache::ReadScope scope(document->GetDM()->textCache);
     int textLen;
     const WCHAR* pageText = document->GetDM()->textCache->GetData(pageno, &textLen);
 
@@ -137,6 +139,7 @@ int SumatraUIAutomationTextRange::FindPreviousWordEndpoint(int pageno, int idx,
 }
 
 int SumatraUIAutomationTextRange::FindNextWordEndpoint(int pageno, int idx, bool dontReturnInitial) {
+    PageTextCache::ReadScope scope(document->GetDM()->textCache);
     int textLen;
     const WCHAR* pageText = document->GetDM()->textCache->GetData(pageno, &textLen);
 
@@ -155,6 +158,7 @@ int SumatraUIAutomationTextRange::FindNextWordEndpoint(int pageno, int idx, bool
 }
 
 int SumatraUIAutomationTextRange::FindPreviousLineEndpoint(int pageno, int idx, bool dontReturnInitial) {
+    PageTextCache::ReadScope scope(document->GetDM()->textCache);
     int textLen;
     const WCHAR* pageText = document->GetDM()->textCache->GetData(pageno, &textLen);
 
@@ -173,6 +177,7 @@ int SumatraUIAutomationTextRange::FindPreviousLineEndpoint(int pageno, int idx,
 }
 
 int SumatraUIAutomationTextRange::FindNextLineEndpoint(int pageno, int idx, bool dontReturnInitial) {
+    PageTextCache::ReadScope scope(document->GetDM()->textCache);
     int textLen;
     const WCHAR* pageText = document->GetDM()->textCache->GetData(pageno, &textLen);
 
@@ -0,0 +1,468 @@
+/* Copyright 2018 the SumatraPDF project authors (see AUTHORS file).
+   License: Simplified BSD (see COPYING.BSD) */
+
+#include "BaseUtil.h"
+#include "WStrFinder.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HAS_SSE2 1
+#include <immintrin.h>
+#if COMPILER_MSVC
+#include <intrin.h>
+// MSVC allows using AVX2 intrinsics without enabling them for the whole file
+#define TARGET_AVX2
+#else
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#else
+#define HAS_SSE2 0
+#endif
+
+#if !OS_WIN
+#include <wctype.h>
+#endif
+
+static wchar16 ToLower16(wchar16 c) {
+#if OS_WIN
+    return (wchar16)(uintptr_t)CharLowerW((LPWSTR)(uintptr_t)c);
+#else
+    return (wchar16)towlower(c);
+#endif
+}
+
+static wchar16 ToUpper16(wchar16 c) {
+#if OS_WIN
+    return (wchar16)(uintptr_t)CharUpperW((LPWSTR)(uintptr_t)c);
+#else
+    return (wchar16)towupper(c);
+#endif
+}
+
+// must match isWordChar in TextSelection.h
+static bool IsWordChar16(wchar16 c) {
+#if OS_WIN
+    return IsCharAlphaNumericW((WCHAR)c) || c == '_';
+#else
+    return iswalnum(c) || c == '_';
+#endif
+}
+
+// must match str::IsWs
+static bool IsWs16(wchar16 c) {
+    return iswspace(c) != 0;
+}
+
+// the character that c is matched as with MultiWStrFinder's looseMatching
+// (cf. TextSearch::MatchEnd)
+static wchar16 LooseChar16(wchar16 c) {
+    if (IsWs16(c))
+        return ' ';
+    // HYPHEN, NON-BREAKING HYPHEN, FIGURE DASH, EN DASH and EM DASH
+    if (0x2010 <= c && c <= 0x2014)
+        return '-';
+    // LEFT/RIGHT SINGLE QUOTATION MARK
+    if (0x2018 <= c && c <= 0x201b)
+        return '\'';
+    // LEFT/RIGHT DOUBLE QUOTATION MARK
+    if (0x201c <= c && c <= 0x201f)
+        return '"';
+    return c;
+}
+
+static bool gDisableSimd = false;
+
+void WStrFinder::DisableSimd(bool disable) {
+    gDisableSimd = disable;
+}
+
+#if HAS_SSE2
+static bool DetectAvx2() {
+#if COMPILER_MSVC
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7)
+        return false;
+    __cpuid(info, 1);
+    // the OS must also save the AVX registers on context switches
+    bool osxsave = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0;
+    if (!osxsave || (_xgetbv(0) & 6) != 6)
+        return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+static bool HasAvx2() {
+    static bool hasAvx2 = DetectAvx2();
+    return hasAvx2;
+}
+
+static inline int LowestBit(uint32_t mask) {
+#if COMPILER_MSVC
+    unsigned long idx;
+    _BitScanForward(&idx, mask);
+    return (int)idx;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+static inline int HighestBit(uint32_t mask) {
+#if COMPILER_MSVC
+    unsigned long idx;
+    _BitScanReverse(&idx, mask);
+    return (int)idx;
+#else
+    return 31 - __builtin_clz(mask);
+#endif
+}
+#endif
+
+WStrFinder::WStrFinder(const wchar16* needle, bool caseSensitive, bool matchWordStart, bool matchWordEnd)
+    : matchWordStart(matchWordStart), matchWordEnd(matchWordEnd) {
+    while (needle && needle[len]) {
+        len++;
+    }
+    lower = AllocArray<wchar16>(len + 1);
+    upper = AllocArray<wchar16>(len + 1);
+    for (size_t i = 0; i < len; i++) {
+        lower[i] = caseSensitive ? needle[i] : ToLower16(needle[i]);
+        upper[i] = caseSensitive ? needle[i] : ToUpper16(needle[i]);
+    }
+}
+
+WStrFinder::~WStrFinder() {
+    free(lower);
+    free(upper);
+}
+
+// pos + len must not exceed sLen
+bool WStrFinder::IsMatchAt(const wchar16* s, size_t sLen, size_t pos) const {
+    for (size_t i = 0; i < len; i++) {
+        wchar16 c = s[pos + i];
+        if (c != lower[i] && c != upper[i])
+            return false;
+    }
+    if (matchWordStart && pos > 0 && IsWordChar16(s[pos - 1]) && IsWordChar16(s[pos]))
+        return false;
+    size_t end = pos + len;
+    if (matchWordEnd && end < sLen && IsWordChar16(s[end - 1]) && IsWordChar16(s[end]))
+        return false;
+    return true;
+}
+
+#if HAS_SSE2
+// scans the start positions from i on in blocks of 8 for as long as a whole block fits
+// into s. Returns true if a match has been found, else i is the first unscanned position
+bool WStrFinder::FindSse2(const wchar16* s, size_t sLen, size_t& i, size_t* found) const {
+    const __m128i first1 = _mm_set1_epi16((short)lower[0]), first2 = _mm_set1_epi16((short)upper[0]);
+    const __m128i last1 = _mm_set1_epi16((short)lower[len - 1]), last2 = _mm_set1_epi16((short)upper[len - 1]);
+    for (; i + len - 1 + 8 <= sLen; i += 8) {
+        __m128i a = _mm_loadu_si128((const __m128i*)(s + i));
+        __m128i b = _mm_loadu_si128((const __m128i*)(s + i + len - 1));
+        __m128i ma = _mm_or_si128(_mm_cmpeq_epi16(a, first1), _mm_cmpeq_epi16(a, first2));
+        __m128i mb = _mm_or_si128(_mm_cmpeq_epi16(b, last1), _mm_cmpeq_epi16(b, last2));
+        // two mask bits per character
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_and_si128(ma, mb));
+        while (mask) {
+            int bit = LowestBit(mask);
+            if (IsMatchAt(s, sLen, i + bit / 2)) {
+                *found = i + bit / 2;
+                return true;
+            }
+            mask &= ~(3u << bit);
+        }
+    }
+    return false;
+}
+
+// scans the start positions before end downwards in blocks of 8. Returns true if
+// a match has been found, else end is the exclusive bound of the unscanned positions
+bool WStrFinder::FindLastSse2(const wchar16* s, size_t sLen, size_t& end, size_t* found) const {
+    const __m128i first1 = _mm_set1_epi16((short)lower[0]), first2 = _mm_set1_epi16((short)upper[0]);
+    const __m128i last1 = _mm_set1_epi16((short)lower[len - 1]), last2 = _mm_set1_epi16((short)upper[len - 1]);
+    for (; end >= 8; end -= 8) {
+        size_t i = end - 8;
+        __m128i a = _mm_loadu_si128((const __m128i*)(s + i));
+        __m128i b = _mm_loadu_si128((const __m128i*)(s + i + len - 1));
+        __m128i ma = _mm_or_si128(_mm_cmpeq_epi16(a, first1), _mm_cmpeq_epi16(a, first2));
+        __m128i mb = _mm_or_si128(_mm_cmpeq_epi16(b, last1), _mm_cmpeq_epi16(b, last2));
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_and_si128(ma, mb));
+        while (mask) {
+            int bit = HighestBit(mask) & ~1;
+            if (IsMatchAt(s, sLen, i + bit / 2)) {
+                *found = i + bit / 2;
+                return true;
+            }
+            mask &= ~(3u << bit);
+        }
+    }
+    return false;
+}
+
+TARGET_AVX2
+bool WStrFinder::FindAvx2(const wchar16* s, size_t sLen, size_t& i, size_t* found) const {
+    const __m256i first1 = _mm256_set1_epi16((short)lower[0]), first2 = _mm256_set1_epi16((short)upper[0]);
+    const __m256i last1 = _mm256_set1_epi16((short)lower[len - 1]);
+    const __m256i last2 = _mm256_set1_epi16((short)upper[len - 1]);
+    for (; i + len - 1 + 16 <= sLen; i += 16) {
+        __m256i a = _mm256_loadu_si256((const __m256i*)(s + i));
+        __m256i b = _mm256_loadu_si256((const __m256i*)(s + i + len - 1));
+        __m256i ma = _mm256_or_si256(_mm256_cmpeq_epi16(a, first1), _mm256_cmpeq_epi16(a, first2));
+        __m256i mb = _mm256_or_si256(_mm256_cmpeq_epi16(b, last1), _mm256_cmpeq_epi16(b, last2));
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(ma, mb));
+        while (mask) {
+            int bit = LowestBit(mask);
+            if (IsMatchAt(s, sLen, i + bit / 2)) {
+                *found = i + bit / 2;
+                return true;
+            }
+            mask &= ~(3u << bit);
+        }
+    }
+    return false;
+}
+
+TARGET_AVX2
+bool WStrFinder::FindLastAvx2(const wchar16* s, size_t sLen, size_t& end, size_t* found) const {
+    const __m256i first1 = _mm256_set1_epi16((short)lower[0]), first2 = _mm256_set1_epi16((short)upper[0]);
+    const __m256i last1 = _mm256_set1_epi16((short)lower[len - 1]);
+    const __m256i last2 = _mm256_set1_epi16((short)upper[len - 1]);
+    for (; end >= 16; end -= 16) {
+        size_t i = end - 16;
+        __m256i a = _mm256_loadu_si256((const __m256i*)(s + i));
+        __m256i b = _mm256_loadu_si256((const __m256i*)(s + i + len - 1));
+        __m256i ma = _mm256_or_si256(_mm256_cmpeq_epi16(a, first1), _mm256_cmpeq_epi16(a, first2));
+        __m256i mb = _mm256_or_si256(_mm256_cmpeq_epi16(b, last1), _mm256_cmpeq_epi16(b, last2));
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(ma, mb));
+        while (mask) {
+            int bit = HighestBit(mask) & ~1;
+            if (IsMatchAt(s, sLen, i + bit / 2)) {
+                *found = i + bit / 2;
+                return true;
+            }
+            mask &= ~(3u << bit);
+        }
+    }
+    return false;
+}
+#endif
+
+ptrdiff_t WStrFinder::Find(const wchar16* s, size_t sLen, size_t from) const {
+    if (0 == len || len > sLen || from > sLen - len)
+        return -1;
+    size_t i = from;
+#if HAS_SSE2
+    size_t found;
+    if (!gDisableSimd && (HasAvx2() ? FindAvx2(s, sLen, i, &found) : FindSse2(s, sLen, i, &found)))
+        return (ptrdiff_t)found;
+#endif
+    // the remaining positions are too close to the end of s for a vector load
+    for (; i + len <= sLen; i++) {
+        if ((s[i] == lower[0] || s[i] == upper[0]) && IsMatchAt(s, sLen, i))
+            return (ptrdiff_t)i;
+    }
+    return -1;
+}
+
+ptrdiff_t WStrFinder::FindLast(const wchar16* s, size_t sLen, size_t before) const {
+    if (0 == len || len > sLen)
+        return -1;
+    size_t end = std::min(before, sLen - len + 1);
+#if HAS_SSE2
+    size_t found;
+    if (!gDisableSimd && (HasAvx2() ? FindLastAvx2(s, sLen, end, &found) : FindLastSse2(s, sLen, end, &found)))
+        return (ptrdiff_t)found;
+#endif
+    while (end > 0) {
+        end--;
+        if ((s[end] == lower[0] || s[end] == upper[0]) && IsMatchAt(s, sLen, end))
+            return (ptrdiff_t)end;
+    }
+    return -1;
+}
+
+// after Compile, delta contains the offsets of the next states' rows,
+// with this flag set if the next state has any outputs
+#define HAS_OUTPUT (1 << 30)
+
+MultiWStrFinder::MultiWStrFinder(bool caseSensitive, bool looseMatching)
+    : caseSensitive(caseSensitive), looseMatching(looseMatching) {
+    classes = AllocArray<uint16_t>(0x10000);
+    // the root state
+    AddState();
+}
+
+MultiWStrFinder::~MultiWStrFinder() {
+    free(classes);
+}
+
+int MultiWStrFinder::AddState() {
+    int* row = delta.AppendBlanks(classCount);
+    for (int i = 0; i < classCount; i++) {
+        row[i] = -1;
+    }
+    output.Append(-1);
+    outputLink.Append(0);
+    return (int)output.size() - 1;
+}
+
+// returns the class of c, adding a new class if c (resp. its case variants) doesn't have one yet
+int MultiWStrFinder::ClassOf(wchar16 c) {
+    if (classes[c])
+        return classes[c];
+    CrashIf(classCount == 0xFFFF);
+    int cls = classCount++;
+    classes[c] = (uint16_t)cls;
+    if (!caseSensitive) {
+        classes[ToLower16(c)] = (uint16_t)cls;
+        classes[ToUpper16(c)] = (uint16_t)cls;
+    }
+    if (looseMatching && (c == ' ' || c == '-' || c == '\'' || c == '"')) {
+        for (int v = 0; v < 0x10000; v++) {
+            if (LooseChar16((wchar16)v) == c)
+                classes[v] = (uint16_t)cls;
+        }
+        if (c == ' ')
+            wsClass = cls;
+    }
+    // widen the rows of all existing states
+    int stateCount = (int)output.size();
+    Vec<int> widened(stateCount * classCount);
+    for (int s = 0; s < stateCount; s++) {
+        widened.Append(delta.LendData() + s * (classCount - 1), classCount - 1);
+        widened.Append(-1);
+    }
+    delta.Reset();
+    delta.Append(widened.LendData(), widened.size());
+    return cls;
+}
+
+int MultiWStrFinder::AddPattern(const wchar16* pattern, bool matchWordStart, bool matchWordEnd) {
+    CrashIf(compiled);
+    Pattern p = {0, matchWordStart, matchWordEnd, -1};
+    int idx = (int)patterns.size();
+    int state = 0;
+    for (size_t i = 0; pattern && pattern[i]; i++) {
+        wchar16 c = caseSensitive ? pattern[i] : ToLower16(pattern[i]);
+        if (looseMatching) {
+            c = LooseChar16(c);
+            // a run of whitespace is matched as a single space
+            if (c == ' ' && i > 0 && LooseChar16(pattern[i - 1]) == ' ')
+                continue;
+        }
+        p.len++;
+        int cls = ClassOf(c);
+        int next = delta.at(state * classCount + cls);
+        if (-1 == next) {
+            next = AddState();
+            delta.at(state * classCount + cls) = next;
+        }
+        state = next;
+    }
+    if (p.len > 0) {
+        p.nextSameState = output.at(state);
+        output.at(state) = idx;
+    }
+    maxLen = std::max(maxLen, p.len);
+    patterns.Append(p);
+    return idx;
+}
+
+// turns the trie into a DFA by resolving all missing transitions along the failure links
+void MultiWStrFinder::Compile() {
+    CrashIf(compiled);
+    int stateCount = (int)output.size();
+    int* d = delta.LendData();
+    Vec<int> fail(stateCount);
+    fail.AppendBlanks(stateCount);
+    // states in breadth-first order, so that a state's failure state is always done before it
+    Vec<int> queue(stateCount);
+    for (int cls = 0; cls < classCount; cls++) {
+        int next = d[cls];
+        if (-1 == next) {
+            d[cls] = 0;
+        } else {
+            fail.at(next) = 0;
+            queue.Append(next);
+        }
+    }
+    for (size_t i = 0; i < queue.size(); i++) {
+        int state = queue.at(i);
+        int f = fail.at(state);
+        outputLink.at(state) = output.at(f) != -1 ? f : outputLink.at(f);
+        for (int cls = 0; cls < classCount; cls++) {
+            int next = d[state * classCount + cls];
+            if (-1 == next) {
+                d[state * classCount + cls] = d[f * classCount + cls];
+            } else {
+                fail.at(next) = d[f * classCount + cls];
+                queue.Append(next);
+            }
+        }
+    }
+    CrashIf((int64_t)stateCount * classCount >= HAS_OUTPUT);
+    // premultiply the transitions for FindAll and mark those to states with outputs
+    for (int state = 0; state < stateCount; state++) {
+        for (int cls = 0; cls < classCount; cls++) {
+            int& next = d[state * classCount + cls];
+            bool hasOutput = output.at(next) != -1 || outputLink.at(next) != 0;
+            next = next * classCount | (hasOutput ? HAS_OUTPUT : 0);
+        }
+    }
+    compiled = true;
+}
+
+void MultiWStrFinder::FindAll(const wchar16* s, size_t sLen,
+                              const std::function<void(int, size_t, size_t)>& onMatch) const {
+    CrashIf(!compiled);
+    // the first offset at which a pattern's next match may start
+    Vec<size_t> nextAllowed(patterns.size());
+    nextAllowed.AppendBlanks(patterns.size());
+    // with looseMatching, whitespace following whitespace isn't passed through the DFA,
+    // so the offsets of the most recently passed characters are kept for finding the
+    // start of a match (in a ring buffer which fits the longest pattern)
+    bool skipWs = looseMatching && wsClass != 0;
+    size_t ringSize = 1;
+    while (ringSize < maxLen) {
+        ringSize <<= 1;
+    }
+    Vec<size_t> passedAt(ringSize);
+    size_t* ring = passedAt.AppendBlanks(ringSize);
+    size_t passed = 0;
+    int prevCls = 0;
+    const int* d = delta.LendData();
+    const int* out = output.LendData();
+    const int* link = outputLink.LendData();
+    int row = 0;
+    for (size_t i = 0; i < sLen; i++) {
+        int cls = classes[s[i]];
+        if (skipWs) {
+            if (cls == wsClass && prevCls == wsClass)
+                continue;
+            prevCls = cls;
+            ring[passed++ & (ringSize - 1)] = i;
+        }
+        int next = d[row + cls];
+        row = next & ~HAS_OUTPUT;
+        if (!(next & HAS_OUTPUT))
+            continue;
+        int state = row / classCount;
+        for (int st = out[state] != -1 ? state : link[state]; st != 0; st = link[st]) {
+            for (int idx = out[st]; idx != -1; idx = patterns.at(idx).nextSameState) {
+                const Pattern& p = patterns.at(idx);
+                size_t start = skipWs ? ring[(passed - p.len) & (ringSize - 1)] : i + 1 - p.len;
+                if (start < nextAllowed.at(idx))
+                    continue;
+                if (p.matchWordStart && start > 0 && IsWordChar16(s[start - 1]) && IsWordChar16(s[start]))
+                    continue;
+                if (p.matchWordEnd && i + 1 < sLen && IsWordChar16(s[i]) && IsWordChar16(s[i + 1]))
+                    continue;
+                nextAllowed.at(idx) = i + 1;
+                onMatch(idx, start, i + 1);
+            }
+        }
+    }
+}
@@ -0,0 +1,96 @@
+/* Copyright 2018 the SumatraPDF project authors (see AUTHORS file).
+   License: Simplified BSD (see COPYING.BSD) */
+
+// a UTF-16 code unit (the same as WCHAR on Windows)
+typedef uint16_t wchar16;
+
+// Finds a fixed needle in UTF-16 text, optionally ignoring case, much faster than
+// StrStrI/StrRStrI. The needle's case variants are computed once upfront, so that
+// the text itself never has to be case-folded. Candidate positions are found by
+// comparing the first and the last character of the needle at 8 (SSE2) resp.
+// 16 (AVX2, if supported by the CPU) positions at once.
+class WStrFinder {
+    wchar16* lower = nullptr;
+    wchar16* upper = nullptr;
+    size_t len = 0;
+    bool matchWordStart;
+    bool matchWordEnd;
+
+    bool IsMatchAt(const wchar16* s, size_t sLen, size_t pos) const;
+    bool FindSse2(const wchar16* s, size_t sLen, size_t& i, size_t* found) const;
+    bool FindAvx2(const wchar16* s, size_t sLen, size_t& i, size_t* found) const;
+    bool FindLastSse2(const wchar16* s, size_t sLen, size_t& end, size_t* found) const;
+    bool FindLastAvx2(const wchar16* s, size_t sLen, size_t& end, size_t* found) const;
+
+  public:
+    // matchWordStart/matchWordEnd reject matches starting/ending in the middle of a word
+    WStrFinder(const wchar16* needle, bool caseSensitive, bool matchWordStart = false, bool matchWordEnd = false);
+    ~WStrFinder();
+
+    // returns the offset of the first match in s[0..sLen) at or after from, or -1
+    ptrdiff_t Find(const wchar16* s, size_t sLen, size_t from = 0) const;
+    // returns the offset of the last match starting before before, or -1
+    // (the match itself may extend beyond before)
+    ptrdiff_t FindLast(const wchar16* s, size_t sLen, size_t before) const;
+
+    size_t Len() const { return len; }
+
+    // for testing and benchmarking the fallback code
+    static void DisableSimd(bool disable);
+};
+
+// Finds any number of fixed patterns in UTF-16 text in a single pass (Aho-Corasick).
+// The patterns are compiled into a DFA over the characters occurring in them (case
+// variants share a character class), so that each character of the text is looked
+// at exactly once, no matter how many patterns there are.
+// With looseMatching, any run of whitespace in a pattern matches any run of whitespace
+// in the text and HYPHEN-MINUS, APOSTROPHE and QUOTATION MARK share a character class
+// with their typographic variants (similar to TextSearch::MatchEnd)
+class MultiWStrFinder {
+    struct Pattern {
+        size_t len;
+        bool matchWordStart;
+        bool matchWordEnd;
+        // next pattern ending in the same state (for duplicate patterns), or -1
+        int nextSameState;
+    };
+
+    bool caseSensitive;
+    bool looseMatching;
+    Vec<Pattern> patterns;
+    // the longest pattern's length
+    size_t maxLen = 0;
+    // character class of every UTF-16 code unit (0 for code units not in any pattern)
+    uint16_t* classes = nullptr;
+    int classCount = 1;
+    // the class shared by all whitespace with looseMatching (0 if no pattern contains whitespace)
+    int wsClass = 0;
+    // transitions for all states and classes (while building the trie -1 for none)
+    Vec<int> delta;
+    // first pattern ending in a state, or -1
+    Vec<int> output;
+    // closest state along the failure links with an output, or 0
+    Vec<int> outputLink;
+    bool compiled = false;
+
+    int AddState();
+    int ClassOf(wchar16 c);
+
+  public:
+    explicit MultiWStrFinder(bool caseSensitive, bool looseMatching = false);
+    ~MultiWStrFinder();
+
+    // returns the index of the new pattern. Must not be called after Compile.
+    // Empty patterns never match
+    int AddPattern(const wchar16* pattern, bool matchWordStart = false, bool matchWordEnd = false);
+    void Compile();
+
+    // calls onMatch(pattern, start, end) for all matches s[start..end) in s[0..sLen), ordered
+    // by their end. Matches of the same pattern don't overlap (as for WStrFinder::Find
+    // continuing after the previous match), matches of different patterns may
+    void FindAll(const wchar16* s, size_t sLen, const std::function<void(int, size_t, size_t)>& onMatch) const;
+
+    // the length of the pattern (with looseMatching, after collapsing its whitespace)
+    size_t PatternLen(int pattern) const { return patterns.at(pattern).len; }
+    int PatternCount() const { return (int)patterns.size(); }
+};
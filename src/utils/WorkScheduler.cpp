@@ -0,0 +1,196 @@
+/* Copyright 2018 the SumatraPDF project authors (see AUTHORS file).
+   License: Simplified BSD (see COPYING.BSD) */
+
+#include "BaseUtil.h"
+#include "WorkScheduler.h"
+
+WorkScheduler::WorkScheduler(int workerCount, int priorityCount, size_t maxQueued)
+    : priorityCount(std::max(priorityCount, 1)), maxQueued(maxQueued), queuedCount(0), stopping(false) {
+    queues = new Vec<WorkItem*>[this->priorityCount];
+    for (int i = 0; i < std::max(workerCount, 1); i++) {
+        workers.push_back(std::thread([this] { WorkerLoop(); }));
+    }
+}
+
+WorkScheduler::~WorkScheduler() {
+    RemoveQueued(nullptr);
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        stopping = true;
+        for (WorkItem* item : running) {
+            item->Abort();
+        }
+    }
+    wakeUp.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    // items pushed in the meantime (e.g. by an aborted item) are never run
+    RemoveQueued(nullptr);
+    CrashIf(queuedCount != 0 || running.size() != 0);
+    delete[] queues;
+}
+
+Vec<WorkItem*>& WorkScheduler::QueueFor(int priority) {
+    return queues[limitValue(priority, 0, priorityCount - 1)];
+}
+
+// must be called with mutex held
+WorkItem* WorkScheduler::PopNext() {
+    for (int i = 0; i < priorityCount; i++) {
+        if (queues[i].size() > 0) {
+            queuedCount--;
+            return queues[i].Pop();
+        }
+    }
+    return nullptr;
+}
+
+// must be called with mutex held
+WorkItem* WorkScheduler::DropLeastImportant() {
+    for (int i = priorityCount - 1; i >= 0; i--) {
+        if (queues[i].size() > 0) {
+            queuedCount--;
+            return queues[i].PopAt(0);
+        }
+    }
+    return nullptr;
+}
+
+void WorkScheduler::WorkerLoop() {
+    for (;;) {
+        WorkItem* item;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wakeUp.wait(lock, [this] { return stopping || queuedCount > 0; });
+            if (stopping)
+                return;
+            item = PopNext();
+            running.Append(item);
+        }
+
+        item->Run();
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            running.Remove(item);
+        }
+        // delete outside of the lock, as destructors might call back into the scheduler
+        delete item;
+        itemDone.notify_all();
+    }
+}
+
+bool WorkScheduler::Push(WorkItem* item) {
+    CrashIf(!item);
+    WorkItem* dropped = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        QueueFor(item->priority).Append(item);
+        queuedCount++;
+        if (maxQueued > 0 && queuedCount > maxQueued)
+            dropped = DropLeastImportant();
+    }
+    if (dropped != item)
+        wakeUp.notify_one();
+    delete dropped;
+    return dropped != item;
+}
+
+size_t WorkScheduler::RemoveQueued(const WorkItemPredicate& pred) {
+    Vec<WorkItem*> removed;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (int i = 0; i < priorityCount; i++) {
+            Vec<WorkItem*>& queue = queues[i];
+            for (size_t j = 0; j < queue.size();) {
+                if (!pred || pred(queue.at(j))) {
+                    removed.Append(queue.PopAt(j));
+                    queuedCount--;
+                } else {
+                    j++;
+                }
+            }
+        }
+    }
+    for (WorkItem* item : removed) {
+        delete item;
+    }
+    return removed.size();
+}
+
+bool WorkScheduler::UpdateQueued(const WorkItemPredicate& update) {
+    std::unique_lock<std::mutex> lock(mutex);
+    for (int i = 0; i < priorityCount; i++) {
+        Vec<WorkItem*>& queue = queues[i];
+        for (size_t j = queue.size(); j > 0; j--) {
+            WorkItem* item = queue.at(j - 1);
+            if (!update(item))
+                continue;
+            // the most important item of a priority is at the end of its queue
+            queue.RemoveAt(j - 1);
+            QueueFor(item->priority).Append(item);
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t WorkScheduler::AbortRunning(const WorkItemPredicate& pred) {
+    std::unique_lock<std::mutex> lock(mutex);
+    size_t count = 0;
+    for (WorkItem* item : running) {
+        if (!pred || pred(item)) {
+            item->Abort();
+            count++;
+        }
+    }
+    return count;
+}
+
+bool WorkScheduler::Visit(const WorkItemPredicate& visit) {
+    std::unique_lock<std::mutex> lock(mutex);
+    for (WorkItem* item : running) {
+        if (visit(item))
+            return true;
+    }
+    for (int i = 0; i < priorityCount; i++) {
+        Vec<WorkItem*>& queue = queues[i];
+        for (size_t j = queue.size(); j > 0; j--) {
+            if (visit(queue.at(j - 1)))
+                return true;
+        }
+    }
+    return false;
+}
+
+void WorkScheduler::WaitForRunning(const WorkItemPredicate& pred) {
+    std::unique_lock<std::mutex> lock(mutex);
+    itemDone.wait(lock, [&] {
+        for (WorkItem* item : running) {
+            if (!pred || pred(item))
+                return false;
+        }
+        return true;
+    });
+}
+
+size_t WorkScheduler::QueuedCount() {
+    std::unique_lock<std::mutex> lock(mutex);
+    return queuedCount;
+}
+
+size_t WorkScheduler::RunningCount() {
+    std::unique_lock<std::mutex> lock(mutex);
+    return running.size();
+}
+
+bool WorkScheduler::IsFull() {
+    std::unique_lock<std::mutex> lock(mutex);
+    return maxQueued > 0 && queuedCount >= maxQueued;
+}
+
+int DefaultWorkerCount(int maxCount) {
+    int count = (int)std::thread::hardware_concurrency();
+    return limitValue(count, 1, std::max(maxCount, 1));
+}
@@ -0,0 +1,87 @@
+/* Copyright 2018 the SumatraPDF project authors (see AUTHORS file).
+   License: Simplified BSD (see COPYING.BSD) */
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A unit of work to be executed by a WorkScheduler.
+// Items are owned (and deleted) by the scheduler once they've been added,
+// so any clean-up (e.g. notifying a waiting caller) belongs in the destructor.
+class WorkItem {
+  public:
+    // items with a lower value are run first
+    int priority = 0;
+
+    explicit WorkItem(int priority = 0) : priority(priority) {}
+    virtual ~WorkItem() {}
+
+    // called on one of the worker threads
+    virtual void Run() = 0;
+    // called from any thread while Run() is in progress, to request
+    // that Run() returns as early as possible
+    virtual void Abort() {}
+};
+
+typedef std::function<bool(WorkItem*)> WorkItemPredicate;
+
+// A pool of worker threads fed from a priority queue. Queued items are run by priority
+// and within the same priority most recently added (or promoted) first, since during
+// scrolling and zooming the most recent request is the most relevant one. When more
+// than maxQueued items are waiting, the least important one is dropped.
+class WorkScheduler {
+    std::mutex mutex;
+    // signaled when an item has been queued or the scheduler is shutting down
+    std::condition_variable wakeUp;
+    // signaled whenever a worker has finished running an item
+    std::condition_variable itemDone;
+
+    Vec<WorkItem*>* queues; // one per priority
+    int priorityCount;
+    size_t maxQueued;
+    size_t queuedCount;
+
+    Vec<WorkItem*> running;
+    std::vector<std::thread> workers;
+    bool stopping;
+
+    void WorkerLoop();
+    Vec<WorkItem*>& QueueFor(int priority);
+    WorkItem* PopNext();
+    WorkItem* DropLeastImportant();
+
+  public:
+    WorkScheduler(int workerCount, int priorityCount = 1, size_t maxQueued = 0);
+    // drops all queued items, aborts the running ones and waits for the workers to exit
+    // (items pushed until then are dropped as well)
+    ~WorkScheduler();
+
+    // takes ownership of item. Returns false if item was immediately dropped
+    // because the queue is full of more important items
+    bool Push(WorkItem* item);
+
+    // deletes all queued items for which pred returns true (a nullptr pred matches all),
+    // returns the number of removed items
+    size_t RemoveQueued(const WorkItemPredicate& pred);
+    // calls update on all queued items (most important first) until it returns true,
+    // then moves that item to the front of its priority (which might have been changed
+    // by update). Returns true if an item was updated
+    bool UpdateQueued(const WorkItemPredicate& update);
+    // calls Abort() for all running items matching pred, returns their number
+    size_t AbortRunning(const WorkItemPredicate& pred);
+    // calls visit for all running and then all queued items until it returns true
+    // (the items must not be modified or kept). Returns true if visit returned true
+    bool Visit(const WorkItemPredicate& visit);
+    // blocks until Run() has returned for all running items matching pred
+    void WaitForRunning(const WorkItemPredicate& pred);
+
+    size_t QueuedCount();
+    size_t RunningCount();
+    bool IsFull();
+    int WorkerCount() const { return (int)workers.size(); }
+};
+
+// a reasonable number of worker threads for CPU-bound work
+int DefaultWorkerCount(int maxCount);
@@ -0,0 +1,337 @@
+/* Copyright 2018 the SumatraPDF project authors (see AUTHORS file).
+   License: Simplified BSD (see COPYING.BSD) */
+
+#include "BaseUtil.h"
+#include "WStrFinder.h"
+#include <chrono>
+
+// must be last due to assert() over-write
+#include "UtAssert.h"
+
+static wchar16* ToW16(const char* s) {
+    size_t len = str::Len(s);
+    wchar16* res = AllocArray<wchar16>(len + 1);
+    for (size_t i = 0; i < len; i++) {
+        res[i] = (wchar16)(unsigned char)s[i];
+    }
+    return res;
+}
+
+static wchar16 AsciiLower(wchar16 c) {
+    return 'A' <= c && c <= 'Z' ? c + 'a' - 'A' : c;
+}
+
+static bool AsciiIsWordChar(wchar16 c) {
+    return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || ('0' <= c && c <= '9') || c == '_';
+}
+
+// straight-forward implementation of what WStrFinder is supposed to do
+static bool RefIsMatchAt(const wchar16* s, size_t sLen, const wchar16* needle, size_t nLen, size_t pos, bool cs,
+                         bool wordStart, bool wordEnd) {
+    for (size_t i = 0; i < nLen; i++) {
+        if (cs ? s[pos + i] != needle[i] : AsciiLower(s[pos + i]) != AsciiLower(needle[i]))
+            return false;
+    }
+    if (wordStart && pos > 0 && AsciiIsWordChar(s[pos - 1]) && AsciiIsWordChar(s[pos]))
+        return false;
+    if (wordEnd && pos + nLen < sLen && AsciiIsWordChar(s[pos + nLen - 1]) && AsciiIsWordChar(s[pos + nLen]))
+        return false;
+    return true;
+}
+
+static void CheckFinder(const wchar16* s, size_t sLen, const wchar16* needle, bool cs, bool wordStart, bool wordEnd) {
+    size_t nLen = 0;
+    while (needle[nLen]) {
+        nLen++;
+    }
+    WStrFinder finder(needle, cs, wordStart, wordEnd);
+    bool ok = true;
+    for (size_t from = 0; from <= sLen; from += 7) {
+        ptrdiff_t expected = -1;
+        for (size_t pos = from; pos + nLen <= sLen && expected < 0; pos++) {
+            if (RefIsMatchAt(s, sLen, needle, nLen, pos, cs, wordStart, wordEnd))
+                expected = (ptrdiff_t)pos;
+        }
+        ok = ok && finder.Find(s, sLen, from) == expected;
+
+        expected = -1;
+        for (size_t pos = std::min(from, sLen); pos > 0 && expected < 0; pos--) {
+            if (pos - 1 + nLen <= sLen && RefIsMatchAt(s, sLen, needle, nLen, pos - 1, cs, wordStart, wordEnd))
+                expected = (ptrdiff_t)pos - 1;
+        }
+        ok = ok && finder.FindLast(s, sLen, from) == expected;
+    }
+    utassert(ok);
+}
+
+static void SimpleTest() {
+    ScopedMem<wchar16> text(ToW16("Hello World, hello world_wide: HELLO!"));
+    size_t len = 37;
+    ScopedMem<wchar16> hello(ToW16("hello"));
+    WStrFinder ci(hello, false);
+    utassert(0 == ci.Find(text, len));
+    utassert(13 == ci.Find(text, len, 1));
+    utassert(31 == ci.Find(text, len, 14));
+    utassert(-1 == ci.Find(text, len, 32));
+    utassert(31 == ci.FindLast(text, len, len));
+    utassert(13 == ci.FindLast(text, len, 31));
+    utassert(-1 == ci.FindLast(text, len, 0));
+
+    WStrFinder cs(hello, true);
+    utassert(13 == cs.Find(text, len));
+    utassert(13 == cs.FindLast(text, len, len));
+
+    ScopedMem<wchar16> world(ToW16("world"));
+    WStrFinder wordEnd(world, false, false, true);
+    utassert(6 == wordEnd.Find(text, len));
+    utassert(6 == wordEnd.FindLast(text, len, len));
+    ScopedMem<wchar16> wide(ToW16("ide"));
+    WStrFinder wordStart(wide, false, true, false);
+    utassert(-1 == wordStart.Find(text, len));
+
+    ScopedMem<wchar16> empty(ToW16(""));
+    WStrFinder none(empty, false);
+    utassert(-1 == none.Find(text, len));
+    utassert(-1 == none.FindLast(text, len, len));
+}
+
+static void RandomizedTest() {
+    const char* alphabet = "aAbB_ -";
+    const char* needles[] = {"a", "ab", "aB a", "b-_", "a b a", "bbbbbbbbbbbbbbbbbbb", "Ab_aB_ab a-B"};
+    uint32_t seed = 1;
+    for (size_t sLen : {0, 1, 7, 8, 9, 15, 16, 17, 31, 33, 100, 257}) {
+        wchar16* s = AllocArray<wchar16>(sLen + 1);
+        for (size_t i = 0; i < sLen; i++) {
+            seed = seed * 1103515245 + 12345;
+            s[i] = (wchar16)alphabet[(seed >> 16) % 7];
+        }
+        for (const char* n : needles) {
+            ScopedMem<wchar16> needle(ToW16(n));
+            for (int flags = 0; flags < 8; flags++) {
+                CheckFinder(s, sLen, needle, flags & 1, (flags & 2) != 0, (flags & 4) != 0);
+            }
+        }
+        free(s);
+    }
+}
+
+// compares the matches of MultiWStrFinder with those of a naive search for every pattern
+static void CheckMultiFinder(const wchar16* s, size_t sLen, const char** patterns, size_t count, int flags) {
+    bool cs = flags & 1, wordStart = (flags & 2) != 0, wordEnd = (flags & 4) != 0;
+    MultiWStrFinder finder(cs);
+    bool ok = true;
+    for (size_t i = 0; i < count; i++) {
+        ScopedMem<wchar16> pattern(ToW16(patterns[i]));
+        // only apply the word options to every other pattern
+        bool odd = (i % 2) != 0;
+        ok = ok && (int)i == finder.AddPattern(pattern, wordStart && odd, wordEnd && odd);
+    }
+    finder.Compile();
+
+    Vec<size_t> found;
+    size_t lastEnd = 0;
+    bool ordered = true;
+    finder.FindAll(s, sLen, [&](int pattern, size_t offset, size_t end) {
+        ordered = ordered && end >= lastEnd && end == offset + finder.PatternLen(pattern);
+        lastEnd = end;
+        found.Append(pattern * (sLen + 1) + offset);
+    });
+    std::sort(found.LendData(), found.LendData() + found.size());
+
+    Vec<size_t> expected;
+    for (size_t i = 0; i < count; i++) {
+        ScopedMem<wchar16> pattern(ToW16(patterns[i]));
+        size_t nLen = str::Len(patterns[i]);
+        bool odd = (i % 2) != 0;
+        for (size_t pos = 0; nLen > 0 && pos + nLen <= sLen; pos++) {
+            if (RefIsMatchAt(s, sLen, pattern, nLen, pos, cs, wordStart && odd, wordEnd && odd)) {
+                expected.Append(i * (sLen + 1) + pos);
+                pos += nLen - 1;
+            }
+        }
+    }
+    std::sort(expected.LendData(), expected.LendData() + expected.size());
+
+    ok = ok && ordered && found.size() == expected.size();
+    for (size_t i = 0; ok && i < found.size(); i++) {
+        ok = found.at(i) == expected.at(i);
+    }
+    utassert(ok);
+}
+
+static void MultiFinderTest() {
+    ScopedMem<wchar16> text(ToW16("she sells sea shells, he said"));
+    size_t len = 29;
+    const char* words[] = {"he", "she", "hers", "shell", "", "sea", "he"};
+    MultiWStrFinder finder(false);
+    for (const char* w : words) {
+        ScopedMem<wchar16> pattern(ToW16(w));
+        finder.AddPattern(pattern);
+    }
+    finder.Compile();
+    int counts[dimof(words)] = {0};
+    finder.FindAll(text, len, [&](int pattern, size_t start, size_t end) {
+        UNUSED(start);
+        UNUSED(end);
+        counts[pattern]++;
+    });
+    utassert(3 == counts[0] && 2 == counts[1] && 0 == counts[2] && 1 == counts[3]);
+    utassert(0 == counts[4] && 1 == counts[5] && 3 == counts[6]);
+
+    const char* alphabet = "aAbB_ -";
+    const char* patterns[] = {"a", "ab", "aB a", "b-_", "a b a", "bbbbb", "Ab_aB_ab a-B", "ba", "aba", "b"};
+    uint32_t seed = 1;
+    for (size_t sLen : {0, 1, 7, 33, 100, 257}) {
+        wchar16* s = AllocArray<wchar16>(sLen + 1);
+        for (size_t i = 0; i < sLen; i++) {
+            seed = seed * 1103515245 + 12345;
+            s[i] = (wchar16)alphabet[(seed >> 16) % 7];
+        }
+        for (int flags = 0; flags < 8; flags++) {
+            CheckMultiFinder(s, sLen, patterns, dimof(patterns), flags);
+        }
+        free(s);
+    }
+}
+
+// whitespace runs, dashes and quotation marks with looseMatching
+static void LooseMultiFinderTest() {
+    // "a  b\n-c a-c it's ab" with an EN DASH in the second "a-c" and a RIGHT SINGLE QUOTATION MARK
+    const wchar16 text[] = {'a', ' ', ' ', 'b', '\n', '-', 'c', ' ', 'a', 0x2013, 'c', ' ',
+                            'i', 't', 0x2019, 's', ' ', 'a', 'b', 0};
+    size_t len = dimof(text) - 1;
+    const char* words[] = {"a b -c", "a-c", "it's", "b", " ", "a\t\tb"};
+    for (bool loose : {false, true}) {
+        MultiWStrFinder finder(false, loose);
+        for (const char* w : words) {
+            ScopedMem<wchar16> pattern(ToW16(w));
+            finder.AddPattern(pattern);
+        }
+        finder.Compile();
+        Vec<size_t> found;
+        finder.FindAll(text, len, [&](int pattern, size_t start, size_t end) {
+            found.Append(pattern);
+            found.Append(start);
+            found.Append(end);
+        });
+        if (!loose) {
+            // only "b" (twice) and the five spaces match literally
+            utassert(found.size() == 3 * 7);
+            continue;
+        }
+        // (pattern, start, end) ordered by end. " " only matches the first
+        // character of a whitespace run and "a\t\tb" matches as "a b"
+        size_t expected[] = {4, 1,  2,  5, 0,  4,  3, 3,  4,  4, 4,  5,  0, 0,  7,  4, 7,  8,
+                             1, 8, 11,  4, 11, 12, 2, 12, 16, 4, 16, 17, 3, 18, 19};
+        utassert(found.size() == dimof(expected));
+        for (size_t i = 0; i < found.size() && i < dimof(expected); i++) {
+            utassert(found.at(i) == expected[i]);
+        }
+        utassert(finder.PatternLen(5) == 3);
+    }
+}
+
+void WStrFinderTest() {
+    SimpleTest();
+    RandomizedTest();
+    WStrFinder::DisableSimd(true);
+    SimpleTest();
+    RandomizedTest();
+    WStrFinder::DisableSimd(false);
+    MultiFinderTest();
+    LooseMultiFinderTest();
+}
+
+// the per character case-insensitive comparison which WStrFinder replaces
+// (on Windows, StrStrI is used for comparison instead)
+static const wchar16* NaiveFindI(const wchar16* s, size_t sLen, const wchar16* needle, size_t nLen) {
+    for (size_t i = 0; i + nLen <= sLen; i++) {
+        size_t j = 0;
+        for (; j < nLen && AsciiLower(s[i + j]) == AsciiLower(needle[j]); j++)
+            ;
+        if (j == nLen)
+            return s + i;
+    }
+    return nullptr;
+}
+
+static double MsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// compares the speed of WStrFinder with the code it replaces, for a page
+// of a dense numeric table where the needle's first character is frequent
+void WStrFinderBenchmark() {
+    const size_t len = 4 * 1024 * 1024;
+    wchar16* text = AllocArray<wchar16>(len + 1);
+    for (size_t i = 0; i < len; i++) {
+        text[i] = (i % 9 == 8) ? ' ' : (wchar16)('0' + (i * 7919) % 10);
+    }
+    ScopedMem<wchar16> needle(ToW16("1.5e+3"));
+    const int rounds = 10;
+
+    auto start = std::chrono::steady_clock::now();
+    size_t hits = 0;
+    for (int i = 0; i < rounds; i++) {
+#if OS_WIN
+        hits += StrStrIW((WCHAR*)text, (WCHAR*)needle.Get()) != nullptr;
+#else
+        hits += NaiveFindI(text, len, needle, 6) != nullptr;
+#endif
+    }
+    printf("old: %.1f ms per %d MB\n", MsSince(start) / rounds, (int)(len * 2 / (1024 * 1024)));
+
+    for (int disableSimd = 1; disableSimd >= 0; disableSimd--) {
+        WStrFinder::DisableSimd(disableSimd != 0);
+        WStrFinder finder(needle, false);
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < rounds; i++) {
+            hits += finder.Find(text, len) >= 0;
+        }
+        printf("WStrFinder%s: %.1f ms per %d MB\n", disableSimd ? " (scalar)" : "", MsSince(start) / rounds,
+               (int)(len * 2 / (1024 * 1024)));
+    }
+    WStrFinder::DisableSimd(false);
+    utassert(0 == hits);
+
+    // searching for many terms at once, in text resembling prose
+    const char* letters = "etaoinshrdlcumwfgypbvk etaoinshr ";
+    uint32_t seed = 1;
+    for (size_t i = 0; i < len; i++) {
+        seed = seed * 1103515245 + 12345;
+        text[i] = (wchar16)letters[(seed >> 16) % 33];
+    }
+    const char* terms[] = {"liability", "indemnify", "termination", "warranty",   "assignment",
+                           "arbitration", "confidential", "force majeure", "governing law", "severability",
+                           "waiver",     "notice",      "damages",      "breach",        "renewal",
+                           "exclusive",  "license",     "payment",      "audit",         "insurance"};
+    const int termCount = (int)dimof(terms);
+    size_t multiHits = 0;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) {
+        for (const char* term : terms) {
+            ScopedMem<wchar16> pattern(ToW16(term));
+            WStrFinder finder(pattern, false);
+            for (ptrdiff_t pos = finder.Find(text, len); pos >= 0; pos = finder.Find(text, len, pos + finder.Len())) {
+                hits++;
+            }
+        }
+    }
+    printf("%d x WStrFinder: %.1f ms per %d MB\n", termCount, MsSince(start) / rounds,
+           (int)(len * 2 / (1024 * 1024)));
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) {
+        MultiWStrFinder finder(false);
+        for (const char* term : terms) {
+            ScopedMem<wchar16> pattern(ToW16(term));
+            finder.AddPattern(pattern);
+        }
+        finder.Compile();
+        finder.FindAll(text, len, [&](int, size_t, size_t) { multiHits++; });
+    }
+    printf("MultiWStrFinder (%d terms): %.1f ms per %d MB\n", termCount, MsSince(start) / rounds,
+           (int)(len * 2 / (1024 * 1024)));
+    utassert(hits == multiHits);
+    free(text);
+}
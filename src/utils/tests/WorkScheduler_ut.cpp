@@ -0,0 +1,229 @@
+/* Copyright 2018 the SumatraPDF project authors (see AUTHORS file).
+   License: Simplified BSD (see COPYING.BSD) */
+
+#include "BaseUtil.h"
+#include "WorkScheduler.h"
+#include <atomic>
+
+// must be last due to assert() over-write
+#include "UtAssert.h"
+
+struct SchedulerTestCounters {
+    std::atomic<int> ran{0};
+    std::atomic<int> deleted{0};
+    std::atomic<int> aborted{0};
+    std::mutex orderAccess;
+    Vec<int> order;
+};
+
+class SchedulerTestItem : public WorkItem {
+  public:
+    SchedulerTestCounters* counters;
+    int id;
+    // if set, Run() blocks until either *gate is true or Abort() is called
+    std::atomic<bool>* gate;
+    std::atomic<bool> abort{false};
+
+    SchedulerTestItem(SchedulerTestCounters* counters, int id, int priority, std::atomic<bool>* gate = nullptr)
+        : WorkItem(priority), counters(counters), id(id), gate(gate) {}
+    ~SchedulerTestItem() override { counters->deleted++; }
+
+    void Run() override {
+        while (gate && !*gate && !abort) {
+            std::this_thread::yield();
+        }
+        std::unique_lock<std::mutex> lock(counters->orderAccess);
+        counters->order.Append(id);
+        counters->ran++;
+    }
+
+    void Abort() override {
+        abort = true;
+        counters->aborted++;
+    }
+};
+
+// waits until the single worker has picked up the gate item
+static void WaitUntilRunning(WorkScheduler& scheduler, size_t count) {
+    while (scheduler.RunningCount() < count) {
+        std::this_thread::yield();
+    }
+}
+
+static void WaitUntilIdle(WorkScheduler& scheduler) {
+    while (scheduler.QueuedCount() > 0) {
+        std::this_thread::yield();
+    }
+    scheduler.WaitForRunning(nullptr);
+}
+
+static bool HasId(WorkItem* item, int id) {
+    return static_cast<SchedulerTestItem*>(item)->id == id;
+}
+
+static void PriorityOrderTest() {
+    SchedulerTestCounters counters;
+    std::atomic<bool> gate(false);
+    {
+        WorkScheduler scheduler(1, 3);
+        scheduler.Push(new SchedulerTestItem(&counters, 0, 0, &gate));
+        WaitUntilRunning(scheduler, 1);
+
+        scheduler.Push(new SchedulerTestItem(&counters, 1, 2));
+        scheduler.Push(new SchedulerTestItem(&counters, 2, 1));
+        scheduler.Push(new SchedulerTestItem(&counters, 3, 0));
+        scheduler.Push(new SchedulerTestItem(&counters, 4, 2));
+        scheduler.Push(new SchedulerTestItem(&counters, 5, 0));
+        // out of range priorities are clamped
+        scheduler.Push(new SchedulerTestItem(&counters, 6, 7));
+        utassert(6 == scheduler.QueuedCount());
+
+        gate = true;
+        WaitUntilIdle(scheduler);
+    }
+    utassert(7 == counters.ran && 7 == counters.deleted);
+    // within the same priority, the most recently added item runs first
+    int expected[] = {0, 5, 3, 2, 6, 4, 1};
+    utassert(dimof(expected) == counters.order.size());
+    for (size_t i = 0; i < dimof(expected); i++) {
+        utassert(expected[i] == counters.order.at(i));
+    }
+}
+
+static void QueueManipulationTest() {
+    SchedulerTestCounters counters;
+    std::atomic<bool> gate(false);
+    {
+        WorkScheduler scheduler(1, 3, 4);
+        scheduler.Push(new SchedulerTestItem(&counters, 0, 0, &gate));
+        WaitUntilRunning(scheduler, 1);
+
+        utassert(scheduler.Push(new SchedulerTestItem(&counters, 1, 1)));
+        utassert(scheduler.Push(new SchedulerTestItem(&counters, 2, 2)));
+        utassert(scheduler.Push(new SchedulerTestItem(&counters, 3, 1)));
+        utassert(scheduler.Push(new SchedulerTestItem(&counters, 4, 0)));
+        utassert(scheduler.IsFull());
+        // the queue is full, so the least important (and oldest) item is dropped
+        utassert(scheduler.Push(new SchedulerTestItem(&counters, 5, 0)));
+        utassert(1 == counters.deleted);
+        utassert(!scheduler.Visit([](WorkItem* item) { return HasId(item, 2); }));
+        // ... which might be the new item itself
+        utassert(!scheduler.Push(new SchedulerTestItem(&counters, 6, 2)));
+        utassert(2 == counters.deleted);
+
+        utassert(scheduler.Visit([](WorkItem* item) { return HasId(item, 0); }));
+        utassert(!scheduler.Visit([](WorkItem* item) { return HasId(item, 42); }));
+
+        // promote item 1 to the front of the most important priority
+        bool ok = scheduler.UpdateQueued([](WorkItem* item) {
+            if (!HasId(item, 1))
+                return false;
+            item->priority = 0;
+            return true;
+        });
+        utassert(ok);
+        utassert(!scheduler.UpdateQueued([](WorkItem* item) { return HasId(item, 42); }));
+
+        utassert(1 == scheduler.RemoveQueued([](WorkItem* item) { return HasId(item, 4); }));
+        utassert(3 == counters.deleted);
+        utassert(3 == scheduler.QueuedCount());
+
+        gate = true;
+        WaitUntilIdle(scheduler);
+    }
+    int expected[] = {0, 1, 5, 3};
+    utassert(dimof(expected) == counters.order.size());
+    for (size_t i = 0; i < dimof(expected); i++) {
+        utassert(expected[i] == counters.order.at(i));
+    }
+    utassert(7 == counters.deleted);
+}
+
+static void AbortTest() {
+    SchedulerTestCounters counters;
+    std::atomic<bool> gate(false);
+    {
+        WorkScheduler scheduler(2, 1);
+        scheduler.Push(new SchedulerTestItem(&counters, 1, 0, &gate));
+        scheduler.Push(new SchedulerTestItem(&counters, 2, 0, &gate));
+        WaitUntilRunning(scheduler, 2);
+        utassert(1 == scheduler.AbortRunning([](WorkItem* item) { return HasId(item, 2); }));
+        scheduler.WaitForRunning([](WorkItem* item) { return HasId(item, 2); });
+        utassert(1 == counters.ran && 1 == counters.aborted);
+        utassert(2 == counters.order.at(0));
+        // destroying the scheduler aborts all items that are still running
+    }
+    utassert(2 == counters.ran && 2 == counters.aborted && 2 == counters.deleted);
+}
+
+// pushes another item once it's been aborted, as when the scheduler is being destroyed
+class PushOnAbortTestItem : public SchedulerTestItem {
+  public:
+    WorkScheduler* scheduler;
+
+    PushOnAbortTestItem(SchedulerTestCounters* counters, WorkScheduler* scheduler, std::atomic<bool>* gate)
+        : SchedulerTestItem(counters, 0, 0, gate), scheduler(scheduler) {}
+
+    void Run() override {
+        SchedulerTestItem::Run();
+        if (abort)
+            scheduler->Push(new SchedulerTestItem(counters, 1, 0));
+    }
+};
+
+static void PushWhileStoppingTest() {
+    SchedulerTestCounters counters;
+    std::atomic<bool> gate(false);
+    {
+        WorkScheduler scheduler(1, 1);
+        scheduler.Push(new PushOnAbortTestItem(&counters, &scheduler, &gate));
+        WaitUntilRunning(scheduler, 1);
+    }
+    // the item pushed during destruction was dropped without running
+    utassert(1 == counters.ran && 1 == counters.aborted && 2 == counters.deleted);
+}
+
+// several producers push, promote and remove items while several workers consume them
+static void LoadTest() {
+    const int producerCount = 4;
+    const int itemsPerProducer = 2000;
+    SchedulerTestCounters counters;
+    std::atomic<int> pushed(0);
+    {
+        WorkScheduler scheduler(4, 3, 64);
+        std::vector<std::thread> producers;
+        for (int n = 0; n < producerCount; n++) {
+            producers.push_back(std::thread([&, n] {
+                for (int i = 0; i < itemsPerProducer; i++) {
+                    int id = n * itemsPerProducer + i;
+                    scheduler.Push(new SchedulerTestItem(&counters, id, id % 3));
+                    pushed++;
+                    if (i % 7 == 0)
+                        scheduler.RemoveQueued([n](WorkItem* item) { return HasId(item, n); });
+                    if (i % 5 == 0)
+                        scheduler.UpdateQueued([id](WorkItem* item) { return HasId(item, id - 1); });
+                    if (i % 11 == 0)
+                        scheduler.Visit([](WorkItem* item) { return item->priority > 2; });
+                }
+            }));
+        }
+        for (std::thread& producer : producers) {
+            producer.join();
+        }
+        WaitUntilIdle(scheduler);
+        utassert(0 == scheduler.QueuedCount() && 0 == scheduler.RunningCount());
+    }
+    utassert(producerCount * itemsPerProducer == pushed);
+    // every item was either run or dropped and deleted exactly once
+    utassert(pushed == counters.deleted);
+    utassert(counters.ran <= counters.deleted);
+    utassert((size_t)counters.ran == counters.order.size());
+}
+
+void WorkSchedulerTest() {
+    PriorityOrderTest();
+    QueueManipulationTest();
+    AbortTest();
+    PushWhileStoppingTest();
+    LoadTest();
+}
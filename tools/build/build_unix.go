@@ -312,7 +312,7 @@ func link(ctx *BuildContext, dstPath string, srcPaths []string) {
 	args = append(args, "-o", dstPath)
 	args = append(args, srcPaths...)
 	// unfortunately must be at the end, so can't be in ctx.LinkFlags
-	args = append(args, "-lstdc++")
+	args = append(args, "-lstdc++", "-lpthread", "-lm")
 	cmd := exec.Command(ctx.LinkCmd, args...)
 
 	createDirForFile(dstPath)
@@ -514,13 +514,254 @@ func buildZlibArchive(ctx *BuildContext) string {
 func buildTestUnixFiles(ctx *BuildContext) []string {
 	var localWg sync.WaitGroup
 	localCtx := ctx.GetCopy(&localWg)
-	localCtx.CFlags = append(localCtx.CFlags, "-Wno-implicit-fallthrough")
+	// mupdf's fz_throw and fz_warn pass __FILE__ as char *
+	localCtx.CFlags = append(localCtx.CFlags, "-Wno-implicit-fallthrough", "-Wno-write-strings")
+	// PdfLinear_ut.cpp, ScanConverter_ut.cpp, StextSearch_ut.cpp and DrawBlend_ut.cpp test our changes
+	// to mupdf (ScanConverter_ut.cpp and DrawBlend_ut.cpp call the draw device's internals, see draw-imp.h)
+	localCtx.IncDirs = append(localCtx.IncDirs, "mupdf/include", "mupdf/source/fitz")
 	localCtx.OutDir = filepath.Join(normalizePath(localCtx.OutDir), "test_unix_obj")
-	files := filesInDir("src/utils", "Archive.cpp", "BaseUtil.cpp", "ByteOrderDecoder.cpp", "FileUtil.cpp", "PalmDbReader.cpp", "StrSlice.cpp", "StrUtil.cpp", "StrUtil_unix.cpp", "TxtParser.cpp", "UtAssert.cpp")
-	files2 := filesInDir("src/utils/tests", "ByteOrderDecoder_ut.cpp")
+	files := filesInDir("src/utils", "Archive.cpp", "BaseUtil.cpp", "ByteOrderDecoder.cpp", "FileUtil.cpp", "PalmDbReader.cpp", "StrSlice.cpp", "StrUtil.cpp", "StrUtil_unix.cpp", "TxtParser.cpp", "UtAssert.cpp", "WorkScheduler.cpp", "WStrFinder.cpp")
+	files2 := filesInDir("src/utils/tests", "ByteOrderDecoder_ut.cpp", "WorkScheduler_ut.cpp", "WStrFinder_ut.cpp")
 	files = append(files, files2...)
 	ccMulti(localCtx, files...)
 	cc(localCtx, "tools/test_unix/main.cpp")
+	cc(localCtx, "tools/test_unix/PdfLinear_ut.cpp")
+	cc(localCtx, "tools/test_unix/ScanConverter_ut.cpp")
+	cc(localCtx, "tools/test_unix/StextSearch_ut.cpp")
+	cc(localCtx, "tools/test_unix/DrawBlend_ut.cpp")
+	localCtx.Wg.Wait()
+	return localCtx.CcOutputs
+}
+
+func freetypeFiles() []string {
+	files := filesInDir("ext/freetype2/src/base", "ftbase.c", "ftbbox.c", "ftbitmap.c", "ftgasp.c", "ftglyph.c", "ftinit.c", "ftstroke.c", "ftsynth.c", "ftsystem.c", "fttype1.c", "ftxf86.c", "ftotval.c", "ftdebug.c")
+	files2 := filesInDir("ext/freetype2/src", "cff/cff.c", "cid/type1cid.c", "psaux/psaux.c", "psnames/psnames.c", "smooth/smooth.c", "sfnt/sfnt.c", "truetype/truetype.c", "type1/type1.c", "raster/raster.c", "otvalid/otvalid.c", "pshinter/pshinter.c", "gzip/ftgzip.c")
+	return append(files, files2...)
+}
+
+func buildFreetypeArchive(ctx *BuildContext) string {
+	archivePath := ctx.InOutDir("freetype.a")
+
+	var localWg sync.WaitGroup
+	localCtx := ctx.GetCopy(&localWg)
+	localCtx.CDefines = append(localCtx.CDefines, "FT2_BUILD_LIBRARY", "FT_OPTION_AUTOFIT2")
+	localCtx.RemoveCFlag("-Wextra")
+	localCtx.CFlags = append(localCtx.CFlags, "-Wno-unused-function")
+	localCtx.IncDirs = append(localCtx.IncDirs, "ext/freetype2/config", "ext/freetype2/include")
+	localCtx.OutDir = filepath.Join(normalizePath(localCtx.OutDir), "freetype")
+
+	ccMulti(localCtx, freetypeFiles()...)
+	localCtx.Wg.Wait()
+
+	ar(ctx, archivePath, localCtx.CcOutputs)
+	return archivePath
+}
+
+func jbig2decFiles() []string {
+	return filesInDir("ext/jbig2dec", "jbig2.c", "jbig2_arith.c", "jbig2_arith_iaid.c", "jbig2_arith_int.c", "jbig2_generic.c", "jbig2_huffman.c", "jbig2_halftone.c", "jbig2_image.c", "jbig2_metadata.c", "jbig2_mmr.c", "jbig2_page.c", "jbig2_refinement.c", "jbig2_segment.c", "jbig2_symbol_dict.c", "jbig2_text.c")
+}
+
+func buildJbig2decArchive(ctx *BuildContext) string {
+	archivePath := ctx.InOutDir("jbig2dec.a")
+
+	var localWg sync.WaitGroup
+	localCtx := ctx.GetCopy(&localWg)
+	localCtx.CDefines = append(localCtx.CDefines, "HAVE_STRING_H=1", "HAVE_STDINT_H=1", "JBIG_NO_MEMENTO")
+	localCtx.RemoveCFlag("-Wextra")
+	localCtx.CFlags = append(localCtx.CFlags, "-Wno-unused-function")
+	localCtx.IncDirs = append(localCtx.IncDirs, "ext/jbig2dec")
+	localCtx.OutDir = filepath.Join(normalizePath(localCtx.OutDir), "jbig2dec")
+
+	ccMulti(localCtx, jbig2decFiles()...)
+	localCtx.Wg.Wait()
+
+	ar(ctx, archivePath, localCtx.CcOutputs)
+	return archivePath
+}
+
+// the portable C version, without the SIMD assembly used on Windows
+func libjpegTurboFiles() []string {
+	return filesInDir("ext/libjpeg-turbo", "jcomapi.c", "jdapimin.c", "jdapistd.c", "jdatadst.c", "jdatasrc.c", "jdcoefct.c", "jdcolor.c", "jddctmgr.c", "jdhuff.c", "jdinput.c", "jdmainct.c", "jdmarker.c", "jdmaster.c", "jdmerge.c", "jdpostct.c", "jdsample.c", "jdtrans.c", "jerror.c", "jfdctflt.c", "jfdctint.c", "jidctflt.c", "jidctfst.c", "jidctint.c", "jquant1.c", "jquant2.c", "jutils.c", "jmemmgr.c", "jmemnobs.c", "jaricom.c", "jdarith.c", "jfdctfst.c", "jdphuff.c", "jidctred.c", "jsimd_none.c")
+}
+
+func buildLibjpegTurboArchive(ctx *BuildContext) string {
+	archivePath := ctx.InOutDir("libjpeg-turbo.a")
+
+	var localWg sync.WaitGroup
+	localCtx := ctx.GetCopy(&localWg)
+	localCtx.RemoveCFlag("-Wextra")
+	localCtx.CFlags = append(localCtx.CFlags, "-Wno-attributes")
+	localCtx.IncDirs = append(localCtx.IncDirs, "ext/libjpeg-turbo")
+	localCtx.OutDir = filepath.Join(normalizePath(localCtx.OutDir), "libjpeg-turbo")
+
+	ccMulti(localCtx, libjpegTurboFiles()...)
+	localCtx.Wg.Wait()
+
+	ar(ctx, archivePath, localCtx.CcOutputs)
+	return archivePath
+}
+
+func openjpegFiles() []string {
+	var res []string
+	for _, path := range cFilesInDir("ext/openjpeg/src/lib/openjp2") {
+		// a stand-alone program
+		if filepath.Base(path) != "t1_generate_luts.c" {
+			res = append(res, path)
+		}
+	}
+	return res
+}
+
+func buildOpenjpegArchive(ctx *BuildContext) string {
+	archivePath := ctx.InOutDir("openjpeg.a")
+
+	var localWg sync.WaitGroup
+	localCtx := ctx.GetCopy(&localWg)
+	localCtx.CDefines = append(localCtx.CDefines, "USE_JPIP", "OPJ_STATIC", "OPJ_EXPORTS", "OPJ_HAVE_STDINT_H", "OPJ_HAVE_INTTYPES_H")
+	localCtx.RemoveCFlag("-Wextra")
+	localCtx.CFlags = append(localCtx.CFlags, "-Wno-attributes", "-Wno-misleading-indentation", "-Wno-use-after-free")
+	localCtx.OutDir = filepath.Join(normalizePath(localCtx.OutDir), "openjpeg")
+
+	ccMulti(localCtx, openjpegFiles()...)
+	localCtx.Wg.Wait()
+
+	ar(ctx, archivePath, localCtx.CcOutputs)
+	return archivePath
+}
+
+func runGenerator(cmdPath string, dstPath string, srcPaths []string) {
+	if !needsRebuild(dstPath, append(srcPaths, cmdPath)...) {
+		return
+	}
+	createDirForFile(dstPath)
+	args := append([]string{dstPath}, srcPaths...)
+	cmd := exec.Command(cmdPath, args...)
+	out, err := cmd.CombinedOutput()
+	if err != nil {
+		fmt.Printf("%s failed:\n%s\n", strings.Join(cmd.Args, " "), string(out))
+	}
+	panicIfErr(err)
+}
+
+func filesInDirAll(dir string) []string {
+	fileInfos, err := ioutil.ReadDir(normalizePath(dir))
+	panicIfErr(err)
+	var res []string
+	for _, fi := range fileInfos {
+		if !fi.IsDir() {
+			res = append(res, filepath.Join(normalizePath(dir), fi.Name()))
+		}
+	}
+	return res
+}
+
+// the equivalent of scripts/gen_mupdf_generated.bat: builds cmapdump and fontdump
+// and uses them to generate the cmap and font headers. Returns the directory
+// with the generated headers
+func buildMupdfGenerated(ctx *BuildContext) string {
+	genDir := ctx.InOutDir("mupdf_generated")
+
+	var localWg sync.WaitGroup
+	localCtx := ctx.GetCopy(&localWg)
+	localCtx.RemoveCFlag("-Wextra")
+	localCtx.IncDirs = append(localCtx.IncDirs, "mupdf/include")
+	localCtx.OutDir = filepath.Join(normalizePath(localCtx.OutDir), "mupdf_tools")
+
+	var tools []string
+	for _, name := range []string{"cmapdump", "fontdump"} {
+		cc(localCtx, filepath.Join("mupdf", "scripts", name+".c"))
+		tools = append(tools, localCtx.InOutDir(name))
+	}
+	localCtx.Wg.Wait()
+	for i, toolPath := range tools {
+		link(localCtx, toolPath, []string{localCtx.CcOutputs[i]})
+	}
+	localCtx.Wg.Wait()
+
+	for _, name := range []string{"cns", "gb", "japan", "korea"} {
+		cmaps := filesInDirAll(filepath.Join("mupdf", "resources", "cmaps", name))
+		runGenerator(tools[0], filepath.Join(genDir, "gen_cmap_"+name+".h"), cmaps)
+	}
+	// the equivalent of font_base14.asm
+	var fonts []string
+	for _, path := range filesInDirAll("mupdf/resources/fonts/urw") {
+		if filepath.Ext(path) == ".cff" {
+			fonts = append(fonts, path)
+		}
+	}
+	runGenerator(tools[1], filepath.Join(genDir, "gen_font_base14.h"), fonts)
+	return genDir
+}
+
+func mupdfFiles() []string {
+	files := filesInDir("mupdf/source/fitz", "bbox-device.c", "bitmap.c", "buffer.c", "colorspace.c", "compressed-buffer.c", "context.c", "crypt-aes.c", "crypt-arc4.c", "crypt-md5.c", "crypt-sha2.c", "device.c", "error.c", "filter-basic.c", "filter-dct.c", "filter-fax.c", "filter-flate.c", "filter-jbig2.c", "filter-lzw.c", "filter-predict.c", "font.c", "function.c", "geometry.c", "getopt.c", "halftone.c", "hash.c", "image.c", "link.c", "list-device.c", "load-jpeg.c", "load-jpx.c", "load-jxr.c", "load-png.c", "load-tiff.c", "memory.c", "outline.c", "output.c", "path.c", "pixmap.c", "shade.c", "stext-device.c", "stext-output.c", "stext-paragraph.c", "stext-search.c", "store.c", "stream-open.c", "stream-read.c", "string.c", "text.c", "time.c", "trace-device.c", "transition.c", "ucdn.c", "xml.c", "glyph.c", "tree.c", "document.c", "filter-leech.c", "printf.c", "strtod.c", "ftoa.c", "unzip.c", "draw-affine.c", "draw-blend.c", "draw-device.c", "draw-edge.c", "draw-glyph.c", "draw-mesh.c", "draw-paint.c", "draw-path.c", "draw-scale-simple.c", "draw-unpack.c", "document-all.c")
+	files2 := filesInDir("mupdf/source/pdf", "pdf-annot.c", "pdf-cmap-load.c", "pdf-cmap-parse.c", "pdf-cmap-table.c", "pdf-cmap.c", "pdf-colorspace.c", "pdf-crypt.c", "pdf-device.c", "pdf-encoding.c", "pdf-event.c", "pdf-field.c", "pdf-font.c", "pdf-fontfile.c", "pdf-form.c", "pdf-ft-tools.c", "pdf-function.c", "pdf-image.c", "pdf-interpret.c", "pdf-lex.c", "pdf-metrics.c", "pdf-nametree.c", "pdf-object.c", "pdf-outline.c", "pdf-page.c", "pdf-parse.c", "pdf-pattern.c", "pdf-pkcs7.c", "pdf-repair.c", "pdf-shade.c", "pdf-store.c", "pdf-stream.c", "pdf-type3.c", "pdf-unicode.c", "pdf-write.c", "pdf-xobject.c", "pdf-xref-aux.c", "pdf-xref.c", "pdf-appearance.c", "pdf-run.c", "pdf-op-run.c", "pdf-op-buffer.c", "pdf-op-filter.c", "pdf-clean.c", "pdf-annot-edit.c", "js/pdf-js-none.c")
+	files3 := filesInDir("mupdf/source/xps", "xps-common.c", "xps-doc.c", "xps-glyphs.c", "xps-gradient.c", "xps-image.c", "xps-outline.c", "xps-path.c", "xps-resource.c", "xps-tile.c", "xps-util.c", "xps-zip.c")
+	files4 := filesInDir("mupdf/source", "cbz/mucbz.c", "img/muimage.c", "tiff/mutiff.c")
+	files = append(files, files2...)
+	files = append(files, files3...)
+	return append(files, files4...)
+}
+
+func buildMupdfArchive(ctx *BuildContext, genDir string) string {
+	archivePath := ctx.InOutDir("mupdf.a")
+
+	var localWg sync.WaitGroup
+	localCtx := ctx.GetCopy(&localWg)
+	// NOASMFONTS: fonts are included from gen_font_base14.h instead of font_base14.asm
+	localCtx.CDefines = append(localCtx.CDefines, "NOCJKFONT", "SHARE_JPEG", "NOASMFONTS", "USE_JPIP", "OPJ_EXPORTS", "OPJ_HAVE_INTTYPES_H")
+	localCtx.RemoveCFlag("-Wextra")
+	localCtx.CFlags = append(localCtx.CFlags, "-Wno-comment", "-Wno-parentheses", "-Wno-sequence-point", "-Wno-incompatible-pointer-types", "-Wno-stringop-overflow", "-Wno-unused-but-set-variable", "-Wno-unused-function", "-Wno-unused-variable")
+	// fitz accesses fz_rect as fz_point (fz_rect_min/fz_rect_max), which gcc's
+	// type-based alias analysis breaks (e.g. page transforms lose their translation)
+	localCtx.CFlags = append(localCtx.CFlags, "-fno-strict-aliasing")
+	localCtx.IncDirs = append(localCtx.IncDirs, "mupdf/scripts/openjpeg", "mupdf/include", genDir, "ext/zlib", "ext/freetype2/config", "ext/freetype2/include", "ext/jbig2dec", "ext/libjpeg-turbo", "ext/openjpeg/src/lib/openjp2")
+	localCtx.OutDir = filepath.Join(normalizePath(localCtx.OutDir), "mupdf")
+
+	ccMulti(localCtx, mupdfFiles()...)
+	localCtx.Wg.Wait()
+
+	ar(ctx, archivePath, localCtx.CcOutputs)
+	return archivePath
+}
+
+func libdjvuFiles() []string {
+	return filesInDir("ext/libdjvu", "Arrays.cpp", "atomic.cpp", "BSByteStream.cpp", "BSEncodeByteStream.cpp", "ByteStream.cpp", "DataPool.cpp", "DjVmDir0.cpp", "DjVmDoc.cpp", "DjVmNav.cpp", "DjVuAnno.cpp", "DjVuDocEditor.cpp", "DjVuDocument.cpp", "DjVuDumpHelper.cpp", "DjVuErrorList.cpp", "DjVuFile.cpp", "DjVuFileCache.cpp", "DjVuGlobal.cpp", "DjVuGlobalMemory.cpp", "DjVuImage.cpp", "DjVuInfo.cpp", "DjVuMessage.cpp", "DjVuMessageLite.cpp", "DjVuNavDir.cpp", "DjVuPalette.cpp", "DjVuPort.cpp", "DjVuText.cpp", "DjVuToPS.cpp", "GBitmap.cpp", "GContainer.cpp", "GException.cpp", "GIFFManager.cpp", "GMapAreas.cpp", "GOS.cpp", "GPixmap.cpp", "GRect.cpp", "GScaler.cpp", "GSmartPointer.cpp", "GString.cpp", "GThreads.cpp", "GUnicode.cpp", "GURL.cpp", "IFFByteStream.cpp", "IW44EncodeCodec.cpp", "IW44Image.cpp", "JB2EncodeCodec.cpp", "DjVmDir.cpp", "JB2Image.cpp", "JPEGDecoder.cpp", "MMRDecoder.cpp", "MMX.cpp", "UnicodeByteStream.cpp", "XMLParser.cpp", "XMLTags.cpp", "ZPCodec.cpp", "ddjvuapi.cpp", "debug.cpp", "miniexp.cpp")
+}
+
+func buildLibdjvuArchive(ctx *BuildContext) string {
+	archivePath := ctx.InOutDir("libdjvu.a")
+
+	var localWg sync.WaitGroup
+	localCtx := ctx.GetCopy(&localWg)
+	localCtx.CDefines = append(localCtx.CDefines, "NEED_JPEG_DECODER", "THREADMODEL=0", "DDJVUAPI=", "MINILISPAPI=", "DO_CHANGELOCALE=0", "DEBUGLVL=0")
+	// what djvulibre's configure would detect
+	localCtx.CDefines = append(localCtx.CDefines, "AUTOCONF", "UNIX", "HAVE_STDINCLUDES", "HAVE_NAMESPACES", "HAVE_BOOL", "HAS_WCHAR", "HAVE_WCHAR_H", "HAVE_MBSTATE_T", "HAVE_UNISTD_H", "HAVE_DIRENT_H", "HAVE_STRERROR", "HAVE_STDINT_H", "DIR_DATADIR=\"/usr/local/share\"")
+	localCtx.RemoveCFlag("-Wextra")
+	// libdjvu uses exceptions
+	localCtx.CxxFlags = removeFromStrArray(localCtx.CxxFlags, "-fno-exceptions")
+	localCtx.CFlags = append(localCtx.CFlags, "-Wno-class-memaccess", "-Wno-deprecated-copy", "-Wno-misleading-indentation", "-Wno-parentheses", "-Wno-register", "-Wno-uninitialized", "-Wno-maybe-uninitialized", "-Wno-unused-local-typedefs", "-Wno-unused-but-set-variable")
+	localCtx.IncDirs = append(localCtx.IncDirs, "ext/libjpeg-turbo")
+	localCtx.OutDir = filepath.Join(normalizePath(localCtx.OutDir), "libdjvu")
+
+	ccMulti(localCtx, libdjvuFiles()...)
+	localCtx.Wg.Wait()
+
+	ar(ctx, archivePath, localCtx.CcOutputs)
+	return archivePath
+}
+
+func buildRenderUnixFiles(ctx *BuildContext) []string {
+	var localWg sync.WaitGroup
+	localCtx := ctx.GetCopy(&localWg)
+	// mupdf's fz_throw and fz_warn pass __FILE__ as char *
+	localCtx.CFlags = append(localCtx.CFlags, "-Wno-implicit-fallthrough", "-Wno-write-strings")
+	// -paint-bench calls the draw device's paint functions directly (see draw-imp.h)
+	localCtx.IncDirs = append(localCtx.IncDirs, "mupdf/include", "mupdf/source/fitz", "ext/libdjvu")
+	localCtx.OutDir = filepath.Join(normalizePath(localCtx.OutDir), "render_unix_obj")
+	files := filesInDir("src/utils", "BaseUtil.cpp", "StrUtil.cpp", "StrUtil_unix.cpp")
+	ccMulti(localCtx, files...)
+	cc(localCtx, "tools/render_unix/main.cpp")
 	localCtx.Wg.Wait()
 	return localCtx.CcOutputs
 }
@@ -556,10 +797,25 @@ func main() {
 	unarrAchive := builUnarrArchive(ctx)
 	testUnixFiles := buildTestUnixFiles(ctx)
 
+	freetypeArchive := buildFreetypeArchive(ctx)
+	jbig2decArchive := buildJbig2decArchive(ctx)
+	libjpegTurboArchive := buildLibjpegTurboArchive(ctx)
+	openjpegArchive := buildOpenjpegArchive(ctx)
+	mupdfGenerated := buildMupdfGenerated(ctx)
+	mupdfArchive := buildMupdfArchive(ctx, mupdfGenerated)
+	libdjvuArchive := buildLibdjvuArchive(ctx)
+	renderUnixFiles := buildRenderUnixFiles(ctx)
+	wg.Wait()
+
 	linkInputs := dupStrArray(testUnixFiles)
-	linkInputs = append(linkInputs, unarrAchive, zlibArchive)
+	linkInputs = append(linkInputs, unarrAchive, mupdfArchive, freetypeArchive, jbig2decArchive, libjpegTurboArchive, openjpegArchive, zlibArchive)
 	dstPath := filepath.Join(ctx.OutDir, "test_unix")
 	link(ctx, dstPath, linkInputs)
+
+	linkInputs = dupStrArray(renderUnixFiles)
+	linkInputs = append(linkInputs, mupdfArchive, libdjvuArchive, freetypeArchive, jbig2decArchive, libjpegTurboArchive, openjpegArchive, zlibArchive)
+	dstPath = filepath.Join(ctx.OutDir, "render_unix")
+	link(ctx, dstPath, linkInputs)
 	wg.Wait()
 
 	fmt.Printf("completed in %s\n", time.Since(timeStart))
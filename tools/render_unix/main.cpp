@@ -0,0 +1,927 @@
+/* Copyright 2018 the SumatraPDF project authors (see AUTHORS file).
+   License: GPLv3 */
+
+/* A headless driver for rendering PDF, XPS, CBZ and DjVu documents without
+   any Win32/GDI dependencies, meant for benchmarking and regression testing
+   rendering throughput on Linux. Per-page timings are written to stdout as JSON.
+
+   usage: render_unix [-pages <ranges>] [-zoom <z1,z2,...>] [-repeat <n>] [-threads <n>]
+                      [-input file|mmap|memory] [-out <dir>] [-format png|pnm|raw] [-password <pwd>]
+                      [-simd none|sse2|avx2] [-scan sampled|analytic] <file>...
+          render_unix -paint-bench [-repeat <n>]
+          render_unix -scale-bench [-repeat <n>]
+
+   - zoom 1.0 renders at 72 dpi (the default)
+   - pages are given as e.g. "1-3,7,10-" (default: all pages)
+   - with -repeat, each page is rendered n times and the fastest timings are reported
+   - with -threads, PDF, XPS and CBZ pages are rasterized in n horizontal bands,
+     each on its own thread (the same as PdfEngine does for large bitmaps)
+   - -input selects how PDF, XPS and CBZ files are read: with buffered reads (the default, as
+     PdfEngine does for large files), memory-mapped or read into memory upfront (as PdfEngine
+     does for small files). loadMs and the first page's loadMs show the difference
+   - with -out, rendered pages are saved as <dir>/<file name>-<page>-<zoom>.<format>
+     (raw is the uncompressed RGBA samples, row after row; raw pages are rasterized
+     straight into their memory-mapped output file, as PdfEngine does into DIB sections)
+   - -simd limits the instruction set used by fitz' paint functions (default: the best available)
+   - -scan selects how fitz anti-aliases filled paths: by counting covered sub-pixels (the default)
+     or by computing the exact area covered (see fz_set_scan_converter)
+   - -paint-bench checks that the SIMD paint functions produce the same pixels as the scalar ones
+     and reports how long each takes for synthetic spans (exits with 1 on any difference)
+   - -scale-bench does the same for fitz' image scaler, downscaling synthetic 300 dpi A4 scans
+     with 1, 2 and 4 components to typical screen resolutions */
+
+extern "C" {
+#include <mupdf/fitz.h>
+#include "draw-imp.h"
+}
+#include <ddjvuapi.h>
+
+#include "BaseUtil.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <random>
+#include <thread>
+
+// 1.0 is 72 dpi, same as for BaseEngine::RenderBitmap
+#define DEFAULT_ZOOM 1.0f
+
+typedef std::chrono::steady_clock::time_point TimePoint;
+
+static TimePoint Now() {
+    return std::chrono::steady_clock::now();
+}
+
+static double MsSince(TimePoint start) {
+    return std::chrono::duration<double, std::milli>(Now() - start).count();
+}
+
+// fitz contexts can only be cloned (for use on other threads) if they have locking functions
+static std::mutex gFitzLocks[FZ_LOCK_MAX];
+
+static void LockFitz(void* user, int lock) {
+    UNUSED(user);
+    gFitzLocks[lock].lock();
+}
+
+static void UnlockFitz(void* user, int lock) {
+    UNUSED(user);
+    gFitzLocks[lock].unlock();
+}
+
+static fz_locks_context gFitzLocksContext = {nullptr, LockFitz, UnlockFitz};
+
+struct PageTimings {
+    double loadMs = 0;
+    // time for interpreting the page into a display list
+    double runMs = 0;
+    double rasterizeMs = 0;
+};
+
+// the part of BaseEngine that's needed for headless rendering
+class HeadlessEngine {
+  public:
+    virtual ~HeadlessEngine() {}
+
+    virtual const char* Kind() const = 0;
+    virtual int PageCount() = 0;
+    // renders page pageNo (starting at 1) into a new RGBA pixmap
+    // (owned by the caller), returns nullptr on failure
+    // allocator optionally provides the memory for the pixmap's samples
+    virtual fz_pixmap* RenderPage(int pageNo, float zoom, PageTimings& timings,
+                                  const fz_pixmap_allocator* allocator) = 0;
+};
+
+// PDF, XPS and CBZ documents (and single images) through fitz' document API
+class FitzEngine : public HeadlessEngine {
+    fz_context* ctx;
+    fz_document* doc;
+    char* kind;
+    // number of bands (and threads) to rasterize each page in
+    int bandCount;
+
+  public:
+    FitzEngine(fz_context* ctx, fz_document* doc, const char* kind, int bandCount)
+        : ctx(ctx), doc(doc), kind(str::Dup(kind)), bandCount(bandCount) {}
+    ~FitzEngine() override {
+        fz_close_document(doc);
+        free(kind);
+    }
+
+    const char* Kind() const override { return kind; }
+    int PageCount() override { return fz_count_pages(doc); }
+    fz_pixmap* RenderPage(int pageNo, float zoom, PageTimings& timings,
+                          const fz_pixmap_allocator* allocator) override;
+
+    static HeadlessEngine* CreateFromFile(fz_context* ctx, const char* path, const char* password, int bandCount,
+                                          const char* input);
+};
+
+static fz_stream* OpenInput(fz_context* ctx, const char* path, const char* input) {
+    if (str::Eq(input, "mmap"))
+        return fz_open_file_mapped(ctx, path);
+    if (!str::Eq(input, "memory"))
+        return fz_open_file(ctx, path);
+    fz_stream* file = fz_open_file(ctx, path);
+    fz_buffer* data = nullptr;
+    fz_var(data);
+    fz_try(ctx) {
+        fz_seek(file, 0, 2);
+        int size = fz_tell(file);
+        fz_seek(file, 0, 0);
+        // (a too small initial size would be taken for a compression bomb)
+        data = fz_read_all(file, size);
+    }
+    fz_always(ctx) {
+        fz_close(file);
+    }
+    fz_catch(ctx) {
+        fz_rethrow(ctx);
+    }
+    fz_stream* stm = fz_open_buffer(ctx, data);
+    fz_drop_buffer(ctx, data);
+    return stm;
+}
+
+HeadlessEngine* FitzEngine::CreateFromFile(fz_context* ctx, const char* path, const char* password, int bandCount,
+                                           const char* input) {
+    fz_document* doc = nullptr;
+    fz_stream* stm = nullptr;
+    fz_var(stm);
+    fz_try(ctx) {
+        stm = OpenInput(ctx, path, input);
+        doc = fz_open_document_with_stream(ctx, path, stm);
+    }
+    fz_always(ctx) {
+        fz_close(stm);
+    }
+    fz_catch(ctx) {
+        return nullptr;
+    }
+    if (fz_needs_password(doc) && (!password || !fz_authenticate_password(doc, password))) {
+        fz_close_document(doc);
+        return nullptr;
+    }
+
+    const char* ext = strrchr(path, '.');
+    return new FitzEngine(ctx, doc, ext ? ext + 1 : "fitz", bandCount);
+}
+
+// draws the part of list covered by band into the corresponding rows of pix
+static bool RasterizeBand(fz_context* ctx, fz_display_list* list, const fz_matrix* ctm, fz_pixmap* pix,
+                          fz_irect band) {
+    fz_context* bandCtx = fz_clone_context(ctx);
+    if (!bandCtx)
+        return false;
+
+    fz_pixmap* bandPix = nullptr;
+    fz_device* dev = nullptr;
+    bool ok = true;
+    fz_var(bandPix);
+    fz_var(dev);
+    fz_try(bandCtx) {
+        unsigned char* samples = pix->samples + (size_t)(band.y0 - pix->y) * pix->w * pix->n;
+        bandPix = fz_new_pixmap_with_bbox_and_data(bandCtx, pix->colorspace, &band, samples);
+        dev = fz_new_draw_device(bandCtx, bandPix);
+        fz_rect cliprect;
+        fz_rect_from_irect(&cliprect, &band);
+        fz_run_display_list(list, dev, ctm, &cliprect, nullptr);
+    }
+    fz_always(bandCtx) {
+        fz_free_device(dev);
+        fz_drop_pixmap(bandCtx, bandPix);
+    }
+    fz_catch(bandCtx) {
+        ok = false;
+    }
+    fz_free_context(bandCtx);
+    return ok;
+}
+
+// cf. PdfEngineImpl::RunPageListBanded
+static bool RasterizeBanded(fz_context* ctx, fz_display_list* list, const fz_matrix* ctm, fz_pixmap* pix,
+                            int bandCount) {
+    // nothing to draw (e.g. for an empty mediabox)
+    if (pix->w <= 0 || pix->h <= 0)
+        return true;
+    bandCount = limitValue(bandCount, 1, pix->h);
+    int bandHeight = (pix->h + bandCount - 1) / bandCount;
+    Vec<int> results;
+    results.AppendBlanks(bandCount);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < bandCount; i++) {
+        fz_irect band = {pix->x, pix->y + i * bandHeight, pix->x + pix->w,
+                         std::min(pix->y + (i + 1) * bandHeight, pix->y + pix->h)};
+        threads.push_back(std::thread([=, &results] { results.at(i) = RasterizeBand(ctx, list, ctm, pix, band); }));
+    }
+    bool ok = true;
+    for (int i = 0; i < bandCount; i++) {
+        threads[i].join();
+        ok = ok && results.at(i);
+    }
+    return ok;
+}
+
+fz_pixmap* FitzEngine::RenderPage(int pageNo, float zoom, PageTimings& timings,
+                                  const fz_pixmap_allocator* allocator) {
+    fz_page* page = nullptr;
+    fz_display_list* list = nullptr;
+    fz_device* dev = nullptr;
+    fz_pixmap* pix = nullptr;
+
+    fz_var(page);
+    fz_var(list);
+    fz_var(dev);
+    fz_var(pix);
+
+    fz_try(ctx) {
+        TimePoint start = Now();
+        page = fz_load_page(doc, pageNo - 1);
+        timings.loadMs = MsSince(start);
+
+        start = Now();
+        list = fz_new_display_list(ctx);
+        dev = fz_new_list_device(ctx, list);
+        fz_run_page(doc, page, dev, &fz_identity, nullptr);
+        fz_free_device(dev);
+        dev = nullptr;
+        timings.runMs = MsSince(start);
+
+        start = Now();
+        fz_matrix ctm;
+        fz_scale(&ctm, zoom, zoom);
+        // bounds of the page in device space, also used for clipping
+        fz_rect bounds;
+        fz_bound_page(doc, page, &bounds);
+        fz_transform_rect(&bounds, &ctm);
+        fz_irect bbox;
+        fz_round_rect(&bbox, &bounds);
+        pix = fz_new_pixmap_with_bbox_and_allocator(ctx, fz_device_rgb(ctx), &bbox, allocator);
+        fz_clear_pixmap_with_value(ctx, pix, 0xFF);
+        if (bandCount > 1) {
+            if (!RasterizeBanded(ctx, list, &ctm, pix, bandCount))
+                fz_throw(ctx, FZ_ERROR_GENERIC, "banded rendering failed");
+        } else {
+            dev = fz_new_draw_device(ctx, pix);
+            fz_run_display_list(list, dev, &ctm, &bounds, nullptr);
+            fz_free_device(dev);
+            dev = nullptr;
+        }
+        timings.rasterizeMs = MsSince(start);
+    }
+    fz_always(ctx) {
+        fz_free_device(dev);
+        if (list)
+            fz_drop_display_list(ctx, list);
+        fz_free_page(doc, page);
+    }
+    fz_catch(ctx) {
+        fz_drop_pixmap(ctx, pix);
+        return nullptr;
+    }
+    return pix;
+}
+
+// DjVu documents through ddjvuapi (libdjvu is built without thread support,
+// so messages are processed synchronously)
+class DjVuEngine : public HeadlessEngine {
+    ddjvu_context_t* djvuCtx;
+    ddjvu_document_t* doc;
+    fz_context* ctx;
+
+    void SpinMessageLoop() {
+        const ddjvu_message_t* msg;
+        while ((msg = ddjvu_message_peek(djvuCtx)) != nullptr) {
+            if (DDJVU_NEWSTREAM == msg->m_any.tag && msg->m_newstream.streamid != 0)
+                ddjvu_stream_close(msg->m_any.document, msg->m_newstream.streamid, /* stop */ FALSE);
+            ddjvu_message_pop(djvuCtx);
+        }
+    }
+
+  public:
+    DjVuEngine(fz_context* ctx, ddjvu_context_t* djvuCtx, ddjvu_document_t* doc)
+        : djvuCtx(djvuCtx), doc(doc), ctx(ctx) {}
+    ~DjVuEngine() override { ddjvu_document_release(doc); }
+
+    const char* Kind() const override { return "djvu"; }
+    int PageCount() override { return ddjvu_document_get_pagenum(doc); }
+    fz_pixmap* RenderPage(int pageNo, float zoom, PageTimings& timings,
+                          const fz_pixmap_allocator* allocator) override;
+
+    static HeadlessEngine* CreateFromFile(fz_context* ctx, ddjvu_context_t* djvuCtx, const char* path);
+};
+
+HeadlessEngine* DjVuEngine::CreateFromFile(fz_context* ctx, ddjvu_context_t* djvuCtx, const char* path) {
+    ddjvu_document_t* doc = ddjvu_document_create_by_filename_utf8(djvuCtx, path, /* cache */ FALSE);
+    if (!doc)
+        return nullptr;
+    DjVuEngine* engine = new DjVuEngine(ctx, djvuCtx, doc);
+    while (!ddjvu_document_decoding_done(doc))
+        engine->SpinMessageLoop();
+    if (ddjvu_document_decoding_error(doc) || 0 == engine->PageCount()) {
+        delete engine;
+        return nullptr;
+    }
+    return engine;
+}
+
+fz_pixmap* DjVuEngine::RenderPage(int pageNo, float zoom, PageTimings& timings,
+                                  const fz_pixmap_allocator* allocator) {
+    TimePoint start = Now();
+    ddjvu_page_t* page = ddjvu_page_create_by_pageno(doc, pageNo - 1);
+    if (!page)
+        return nullptr;
+    while (!ddjvu_page_decoding_done(page))
+        SpinMessageLoop();
+    if (ddjvu_page_decoding_error(page)) {
+        ddjvu_page_release(page);
+        return nullptr;
+    }
+    timings.loadMs = MsSince(start);
+
+    start = Now();
+    int dpi = std::max(ddjvu_page_get_resolution(page), 1);
+    int dx = (int)(ddjvu_page_get_width(page) * 72.0 * zoom / dpi + 0.5);
+    int dy = (int)(ddjvu_page_get_height(page) * 72.0 * zoom / dpi + 0.5);
+    fz_pixmap* pix = nullptr;
+    fz_try(ctx) {
+        fz_irect bbox = {0, 0, std::max(dx, 1), std::max(dy, 1)};
+        pix = fz_new_pixmap_with_bbox_and_allocator(ctx, fz_device_rgb(ctx), &bbox, allocator);
+    }
+    fz_catch(ctx) {
+        ddjvu_page_release(page);
+        return nullptr;
+    }
+
+    ddjvu_format_t* fmt = ddjvu_format_create(DDJVU_FORMAT_RGB24, 0, nullptr);
+    ddjvu_format_set_row_order(fmt, /* top_to_bottom */ TRUE);
+    ddjvu_rect_t rect = {0, 0, (unsigned int)pix->w, (unsigned int)pix->h};
+    int stride = pix->w * 3;
+    unsigned char* rgb = AllocArray<unsigned char>((size_t)stride * pix->h);
+    if (!rgb || !ddjvu_page_render(page, DDJVU_RENDER_COLOR, &rect, &rect, fmt, stride, (char*)rgb)) {
+        // nothing was rendered, leave the page blank (same as DjVuEngine)
+        fz_clear_pixmap_with_value(ctx, pix, 0xFF);
+    } else {
+        // expand to the RGBA layout used by fitz pixmaps
+        unsigned char* src = rgb;
+        unsigned char* dst = pix->samples;
+        for (int i = 0; i < pix->w * pix->h; i++) {
+            *dst++ = *src++;
+            *dst++ = *src++;
+            *dst++ = *src++;
+            *dst++ = 0xFF;
+        }
+    }
+    free(rgb);
+    ddjvu_format_release(fmt);
+    ddjvu_page_release(page);
+    timings.rasterizeMs = MsSince(start);
+
+    return pix;
+}
+
+struct RenderOptions {
+    // pairs of first and last page, last page 0 means "until the end"
+    Vec<int> pageRanges;
+    Vec<float> zooms;
+    int repeat = 1;
+    int threads = 1;
+    const char* outDir = nullptr;
+    const char* format = "png";
+    const char* password = nullptr;
+    const char* input = "file";
+};
+
+// parses page ranges such as "1-3,7,10-"
+static bool ParsePageRanges(const char* s, Vec<int>& ranges) {
+    while (*s) {
+        char* end;
+        long first = strtol(s, &end, 10);
+        long last = first;
+        if (end == s || first < 1)
+            return false;
+        s = end;
+        if ('-' == *s) {
+            s++;
+            last = strtol(s, &end, 10);
+            if (end == s)
+                last = 0;
+            else if (last < first)
+                return false;
+            s = end;
+        }
+        ranges.Append((int)first);
+        ranges.Append((int)last);
+        if (',' == *s)
+            s++;
+        else if (*s)
+            return false;
+    }
+    return ranges.size() > 0;
+}
+
+static bool ParseZooms(const char* s, Vec<float>& zooms) {
+    while (*s) {
+        char* end;
+        float zoom = strtof(s, &end);
+        if (end == s || zoom <= 0)
+            return false;
+        zooms.Append(zoom);
+        s = end;
+        if (',' == *s)
+            s++;
+        else if (*s)
+            return false;
+    }
+    return zooms.size() > 0;
+}
+
+static bool IsPageInRanges(const Vec<int>& ranges, int pageNo) {
+    if (0 == ranges.size())
+        return true;
+    for (size_t i = 0; i + 1 < ranges.size(); i += 2) {
+        if (ranges.at(i) <= pageNo && (pageNo <= ranges.at(i + 1) || 0 == ranges.at(i + 1)))
+            return true;
+    }
+    return false;
+}
+
+static void AppendJsonString(str::Str<char>& json, const char* s) {
+    json.Append('"');
+    for (; *s; s++) {
+        if ('"' == *s || '\\' == *s) {
+            json.Append('\\');
+            json.Append(*s);
+        } else if ((unsigned char)*s < 0x20) {
+            json.AppendFmt("\\u%04x", (unsigned char)*s);
+        } else {
+            json.Append(*s);
+        }
+    }
+    json.Append('"');
+}
+
+// raw output file that pages are rasterized into directly (see AllocMappedOutput)
+struct MappedOutput {
+    fz_pixmap_allocator allocator;
+    const char* path = nullptr;
+    unsigned char* samples = nullptr;
+    size_t size = 0;
+};
+
+static unsigned char* AllocMappedOutput(fz_context* ctx, void* opaque, int w, int h, int n) {
+    UNUSED(ctx);
+    MappedOutput* out = (MappedOutput*)opaque;
+    size_t size = (size_t)w * h * n;
+    int fd = open(out->path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+        return nullptr;
+    void* data = MAP_FAILED;
+    if (size > 0 && 0 == ftruncate(fd, (off_t)size))
+        data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    // returning nullptr makes fitz fall back to allocating the samples itself
+    if (MAP_FAILED == data)
+        return nullptr;
+    out->samples = (unsigned char*)data;
+    out->size = size;
+    return out->samples;
+}
+
+static void ReleaseMappedOutput(fz_context* ctx, void* opaque, unsigned char* samples) {
+    UNUSED(ctx);
+    MappedOutput* out = (MappedOutput*)opaque;
+    munmap(samples, out->size);
+    if (samples == out->samples)
+        out->samples = nullptr;
+}
+
+static bool SavePixmap(fz_context* ctx, fz_pixmap* pix, const char* path, const char* format) {
+    bool ok = true;
+    fz_try(ctx) {
+        if (str::Eq(format, "png")) {
+            fz_write_png(ctx, pix, (char*)path, 0);
+        } else if (str::Eq(format, "pnm")) {
+            fz_write_pnm(ctx, pix, (char*)path);
+        } else {
+            FILE* f = fopen(path, "wb");
+            if (!f)
+                fz_throw(ctx, FZ_ERROR_GENERIC, "can't create %s", path);
+            size_t size = (size_t)pix->w * pix->h * pix->n;
+            ok = fwrite(pix->samples, 1, size, f) == size;
+            fclose(f);
+        }
+    }
+    fz_catch(ctx) {
+        ok = false;
+    }
+    return ok;
+}
+
+static HeadlessEngine* CreateEngine(fz_context* ctx, ddjvu_context_t* djvuCtx, const char* path,
+                                    const RenderOptions& opts) {
+    if (str::EndsWithI(path, ".djvu") || str::EndsWithI(path, ".djv"))
+        return DjVuEngine::CreateFromFile(ctx, djvuCtx, path);
+    return FitzEngine::CreateFromFile(ctx, path, opts.password, opts.threads, opts.input);
+}
+
+static bool RenderFile(fz_context* ctx, ddjvu_context_t* djvuCtx, const char* path, RenderOptions& opts,
+                       str::Str<char>& json) {
+    json.Append("{\"path\":");
+    AppendJsonString(json, path);
+
+    TimePoint start = Now();
+    HeadlessEngine* engine = CreateEngine(ctx, djvuCtx, path, opts);
+    double loadMs = MsSince(start);
+    if (!engine) {
+        json.Append(",\"error\":\"failed to load\"}");
+        return false;
+    }
+
+    json.AppendFmt(",\"engine\":\"%s\",\"loadMs\":%.3f,\"pageCount\":%d,\"pages\":[", engine->Kind(), loadMs,
+                   engine->PageCount());
+
+    const char* baseName = strrchr(path, '/');
+    baseName = baseName ? baseName + 1 : path;
+    double totalMs = loadMs;
+    int rendered = 0;
+    MappedOutput mapped;
+    mapped.allocator = {AllocMappedOutput, ReleaseMappedOutput, &mapped};
+    for (int pageNo = 1; pageNo <= engine->PageCount(); pageNo++) {
+        if (!IsPageInRanges(opts.pageRanges, pageNo))
+            continue;
+        for (float zoom : opts.zooms) {
+            AutoFree outPath;
+            if (opts.outDir)
+                outPath.Set(str::Format("%s/%s-%d-%.3g.%s", opts.outDir, baseName, pageNo, zoom, opts.format));
+            const fz_pixmap_allocator* allocator = nullptr;
+            if (outPath && str::Eq(opts.format, "raw")) {
+                mapped.path = outPath;
+                allocator = &mapped.allocator;
+            }
+
+            PageTimings best;
+            fz_pixmap* pix = nullptr;
+            for (int run = 0; run < opts.repeat; run++) {
+                PageTimings timings;
+                fz_drop_pixmap(ctx, pix);
+                pix = engine->RenderPage(pageNo, zoom, timings, allocator);
+                if (!pix)
+                    break;
+                double total = timings.loadMs + timings.runMs + timings.rasterizeMs;
+                if (0 == run || total < best.loadMs + best.runMs + best.rasterizeMs)
+                    best = timings;
+            }
+
+            if (rendered++ > 0)
+                json.Append(',');
+            json.AppendFmt("{\"page\":%d,\"zoom\":%.3f", pageNo, zoom);
+            if (!pix) {
+                json.Append(",\"error\":\"failed to render\"}");
+                continue;
+            }
+            json.AppendFmt(",\"width\":%d,\"height\":%d,\"loadMs\":%.3f,\"runMs\":%.3f,\"rasterizeMs\":%.3f", pix->w,
+                           pix->h, best.loadMs, best.runMs, best.rasterizeMs);
+            totalMs += best.loadMs + best.runMs + best.rasterizeMs;
+
+            if (outPath) {
+                json.Append(",\"output\":");
+                AppendJsonString(json, outPath);
+                // pages rendered into their mapped output file have already been saved
+                if (pix->samples != mapped.samples && !SavePixmap(ctx, pix, outPath, opts.format))
+                    json.Append(",\"error\":\"failed to save\"");
+            }
+            json.Append('}');
+            fz_drop_pixmap(ctx, pix);
+        }
+    }
+    json.AppendFmt("],\"totalMs\":%.3f}", totalMs);
+
+    delete engine;
+    return true;
+}
+
+static const char* gSimdLevelNames[] = {"none", "sse2", "avx2"};
+
+// runs of uncovered and fully covered pixels with partially covered ones
+// in between, roughly as produced for anti-aliased glyphs and paths
+static void FillCoverage(unsigned char* mask, size_t len, std::minstd_rand& rnd) {
+    for (size_t i = 0; i < len;) {
+        size_t run = rnd() % 24 + 1;
+        unsigned int kind = rnd() % 3;
+        for (; run > 0 && i < len; run--, i++) {
+            mask[i] = 0 == kind ? 0 : 1 == kind ? 255 : (unsigned char)rnd();
+        }
+    }
+}
+
+// premultiplied RGBA pixels, a third of them opaque and a few transparent
+static void FillPixels(fz_pixmap* pix, std::minstd_rand& rnd) {
+    unsigned char* p = pix->samples;
+    for (int i = 0; i < pix->w * pix->h; i++, p += 4) {
+        unsigned int kind = rnd() % 8;
+        int alpha = kind < 3 ? 255 : kind < 4 ? 0 : (int)(rnd() % 256);
+        for (int k = 0; k < 3; k++) {
+            p[k] = (unsigned char)(rnd() % (alpha + 1));
+        }
+        p[3] = (unsigned char)alpha;
+    }
+}
+
+// calls fn for consecutive spans of up to maxLen pixels covering row y
+static void ForEachSpan(int w, int y, int maxLen, const std::function<void(int x, int len)>& fn) {
+    for (int x = 0; x < w;) {
+        int len = std::min(1 + (x * 7 + y * 13) % maxLen, w - x);
+        fn(x, len);
+        x += len;
+    }
+}
+
+struct PaintBenchCase {
+    const char* name;
+    bool translucent;
+    std::function<void(fz_pixmap* dst)> paint;
+};
+
+static int PaintBench(fz_context* ctx, int repeat) {
+    const int dx = 1024, dy = 256;
+    fz_irect bbox = {0, 0, dx, dy};
+    fz_pixmap* dst = fz_new_pixmap_with_bbox(ctx, fz_device_rgb(ctx), &bbox);
+    fz_pixmap* initial = fz_new_pixmap_with_bbox(ctx, fz_device_rgb(ctx), &bbox);
+    fz_pixmap* expected = fz_new_pixmap_with_bbox(ctx, fz_device_rgb(ctx), &bbox);
+    fz_pixmap* src = fz_new_pixmap_with_bbox(ctx, fz_device_rgb(ctx), &bbox);
+    fz_pixmap* mask = fz_new_pixmap_with_bbox(ctx, nullptr, &bbox);
+    std::minstd_rand rnd(1);
+    FillPixels(initial, rnd);
+    FillPixels(src, rnd);
+    FillCoverage(mask->samples, (size_t)dx * dy, rnd);
+    // glyphs are only painted through fz_paint_glyph if they're run-length encoded
+    const int glyphSize = 64;
+    fz_glyph* glyph = fz_new_glyph_from_8bpp_data(ctx, 0, 0, glyphSize, glyphSize, mask->samples, dx);
+
+    unsigned char opaque[4] = {30, 60, 200, 255};
+    unsigned char translucent[4] = {20, 40, 100, 128};
+    size_t stride = (size_t)dx * 4;
+    std::vector<PaintBenchCase> cases;
+    for (unsigned char* color : {opaque, translucent}) {
+        bool isTranslucent = color == translucent;
+        auto solid = [=](fz_pixmap* pix) {
+            for (int y = 0; y < dy; y++) {
+                ForEachSpan(dx, y, 64, [&](int x, int len) {
+                    fz_paint_solid_color(pix->samples + y * stride + x * 4, 4, len, color);
+                });
+            }
+        };
+        cases.push_back({"solid_color", isTranslucent, solid});
+        auto withColor = [=](fz_pixmap* pix) {
+            for (int y = 0; y < dy; y++) {
+                ForEachSpan(dx, y, 256, [&](int x, int len) {
+                    fz_paint_span_with_color(pix->samples + y * stride + x * 4, mask->samples + y * dx + x, 4, len,
+                                             color);
+                });
+            }
+        };
+        cases.push_back({"span_with_color", isTranslucent, withColor});
+        auto glyphs = [=](fz_pixmap* pix) {
+            for (int y = 0; y + glyphSize <= dy; y += glyphSize) {
+                for (int x = 0; x + glyphSize <= dx; x += glyphSize / 2) {
+                    unsigned char* dp = pix->samples + y * stride + x * 4;
+                    fz_paint_glyph(color, pix, dp, glyph, glyphSize, glyphSize, 0, 0);
+                }
+            }
+        };
+        cases.push_back({"glyph", isTranslucent, glyphs});
+    }
+    auto withAlpha = [=](fz_pixmap* pix) {
+        for (int y = 0; y < dy; y++) {
+            ForEachSpan(dx, y, 256, [&](int x, int len) {
+                fz_paint_span(pix->samples + y * stride + x * 4, src->samples + y * stride + x * 4, 4, len, 100);
+            });
+        }
+    };
+    cases.push_back({"span_with_alpha", false, withAlpha});
+    auto withMask = [=](fz_pixmap* pix) { fz_paint_pixmap_with_mask(pix, src, mask); };
+    cases.push_back({"pixmap_with_mask", false, withMask});
+
+    int mismatches = 0;
+    str::Str<char> json;
+    json.Append("{\"paint\":[");
+    for (size_t i = 0; i < cases.size(); i++) {
+        PaintBenchCase& c = cases[i];
+        json.AppendFmt("%s{\"name\":\"%s\",\"translucent\":%s", i > 0 ? "," : "", c.name,
+                       c.translucent ? "true" : "false");
+        for (int level = FZ_SIMD_NONE; level <= FZ_SIMD_AVX2; level++) {
+            if (fz_set_simd_level(level) != level)
+                break;
+            double bestMs = 0;
+            for (int run = 0; run < repeat; run++) {
+                memcpy(dst->samples, initial->samples, stride * dy);
+                TimePoint start = Now();
+                c.paint(dst);
+                double ms = MsSince(start);
+                if (0 == run || ms < bestMs)
+                    bestMs = ms;
+            }
+            json.AppendFmt(",\"%sMs\":%.3f", gSimdLevelNames[level], bestMs);
+            if (FZ_SIMD_NONE == level) {
+                memcpy(expected->samples, dst->samples, stride * dy);
+            } else if (memcmp(expected->samples, dst->samples, stride * dy) != 0) {
+                json.AppendFmt(",\"error\":\"%s differs from scalar\"", gSimdLevelNames[level]);
+                mismatches++;
+            }
+        }
+        json.Append('}');
+    }
+    json.Append("]}");
+    puts(json.Get());
+    fz_set_simd_level(FZ_SIMD_AVX2);
+
+    fz_drop_glyph(ctx, glyph);
+    fz_drop_pixmap(ctx, mask);
+    fz_drop_pixmap(ctx, src);
+    fz_drop_pixmap(ctx, expected);
+    fz_drop_pixmap(ctx, initial);
+    fz_drop_pixmap(ctx, dst);
+    return mismatches > 0 ? 1 : 0;
+}
+
+// a smooth gradient with some noise, roughly like a scanned page
+static void FillScan(fz_pixmap* pix, std::minstd_rand& rnd) {
+    unsigned char* p = pix->samples;
+    for (int y = 0; y < pix->h; y++) {
+        for (int x = 0; x < pix->w; x++) {
+            for (int k = 0; k < pix->n; k++) {
+                int v = (x * (k + 1) / 8 + y / 16) % 256 + (int)(rnd() % 32) - 16;
+                *p++ = (unsigned char)std::max(0, std::min(v, 255));
+            }
+        }
+    }
+}
+
+static int ScaleBench(fz_context* ctx, int repeat) {
+    // an A4 page scanned at 300 dpi
+    const int dx = 2480, dy = 3508;
+    // 72, 96, 150 and 225 dpi (and a flipped image as for rotated pages)
+    const float ratios[] = {0.24f, 0.32f, 0.5f, 0.75f, -0.32f};
+    int mismatches = 0;
+    std::minstd_rand rnd(1);
+    str::Str<char> json;
+    json.Append("{\"scale\":[");
+    for (int n : {1, 2, 4}) {
+        fz_colorspace* cs = 1 == n ? nullptr : 2 == n ? fz_device_gray(ctx) : fz_device_rgb(ctx);
+        fz_irect bbox = {0, 0, dx, dy};
+        fz_pixmap* src = fz_new_pixmap_with_bbox(ctx, cs, &bbox);
+        FillScan(src, rnd);
+        for (float ratio : ratios) {
+            json.AppendFmt("%s{\"n\":%d,\"ratio\":%.2f", 1 == n && ratio == ratios[0] ? "" : ",", n, ratio);
+            fz_pixmap* expected = nullptr;
+            for (int level = FZ_SIMD_NONE; level <= FZ_SIMD_SSE2; level++) {
+                if (fz_set_simd_level(level) != level)
+                    break;
+                // weights are computed once and then reused from the caches
+                fz_scale_cache* cacheX = fz_new_scale_cache(ctx);
+                fz_scale_cache* cacheY = fz_new_scale_cache(ctx);
+                fz_pixmap* scaled = nullptr;
+                double bestMs = 0;
+                for (int run = 0; run < repeat; run++) {
+                    fz_drop_pixmap(ctx, scaled);
+                    TimePoint start = Now();
+                    scaled = fz_scale_pixmap_cached(ctx, src, 0, 0, dx * ratio, dy * ratio, nullptr, cacheX, cacheY);
+                    double ms = MsSince(start);
+                    if (0 == run || ms < bestMs)
+                        bestMs = ms;
+                }
+                json.AppendFmt(",\"%sMs\":%.3f", gSimdLevelNames[level], bestMs);
+                if (FZ_SIMD_NONE == level) {
+                    expected = scaled;
+                    scaled = nullptr;
+                } else if (!scaled || !expected || scaled->w != expected->w || scaled->h != expected->h ||
+                           memcmp(scaled->samples, expected->samples, (size_t)scaled->w * scaled->h * n) != 0) {
+                    json.AppendFmt(",\"error\":\"%s differs from scalar\"", gSimdLevelNames[level]);
+                    mismatches++;
+                }
+                fz_drop_pixmap(ctx, scaled);
+                fz_free_scale_cache(ctx, cacheY);
+                fz_free_scale_cache(ctx, cacheX);
+            }
+            fz_drop_pixmap(ctx, expected);
+            json.Append('}');
+        }
+        fz_drop_pixmap(ctx, src);
+    }
+    json.Append("]}");
+    puts(json.Get());
+    fz_set_simd_level(FZ_SIMD_AVX2);
+    return mismatches > 0 ? 1 : 0;
+}
+
+static int Usage() {
+    fprintf(stderr,
+            "usage: render_unix [-pages <ranges>] [-zoom <z1,z2,...>] [-repeat <n>] [-threads <n>]\n"
+            "                   [-input file|mmap|memory] [-out <dir>] [-format png|pnm|raw] [-password <pwd>]\n"
+            "                   [-simd none|sse2|avx2] [-scan sampled|analytic] <file>...\n"
+            "       render_unix -paint-bench [-repeat <n>]\n"
+            "       render_unix -scale-bench [-repeat <n>]\n");
+    return 2;
+}
+
+int main(int argc, char** argv) {
+    RenderOptions opts;
+    Vec<const char*> files;
+    int simdLevel = FZ_SIMD_AVX2;
+    int scanConverter = FZ_SCAN_CONVERT_SAMPLED;
+    bool paintBench = false;
+    bool scaleBench = false;
+    for (int i = 1; i < argc; i++) {
+        bool hasArg = i + 1 < argc;
+        if (str::Eq(argv[i], "-pages") && hasArg) {
+            if (!ParsePageRanges(argv[++i], opts.pageRanges))
+                return Usage();
+        } else if (str::Eq(argv[i], "-zoom") && hasArg) {
+            if (!ParseZooms(argv[++i], opts.zooms))
+                return Usage();
+        } else if (str::Eq(argv[i], "-repeat") && hasArg) {
+            opts.repeat = std::max(atoi(argv[++i]), 1);
+        } else if (str::Eq(argv[i], "-threads") && hasArg) {
+            opts.threads = std::max(atoi(argv[++i]), 1);
+        } else if (str::Eq(argv[i], "-out") && hasArg) {
+            opts.outDir = argv[++i];
+        } else if (str::Eq(argv[i], "-format") && hasArg) {
+            opts.format = argv[++i];
+            if (!str::Eq(opts.format, "png") && !str::Eq(opts.format, "pnm") && !str::Eq(opts.format, "raw"))
+                return Usage();
+        } else if (str::Eq(argv[i], "-input") && hasArg) {
+            opts.input = argv[++i];
+            if (!str::Eq(opts.input, "file") && !str::Eq(opts.input, "mmap") && !str::Eq(opts.input, "memory"))
+                return Usage();
+        } else if (str::Eq(argv[i], "-password") && hasArg) {
+            opts.password = argv[++i];
+        } else if (str::Eq(argv[i], "-simd") && hasArg) {
+            const char* name = argv[++i];
+            for (simdLevel = FZ_SIMD_NONE; simdLevel <= FZ_SIMD_AVX2; simdLevel++) {
+                if (str::Eq(name, gSimdLevelNames[simdLevel]))
+                    break;
+            }
+            if (simdLevel > FZ_SIMD_AVX2)
+                return Usage();
+        } else if (str::Eq(argv[i], "-scan") && hasArg) {
+            const char* name = argv[++i];
+            if (str::Eq(name, "analytic"))
+                scanConverter = FZ_SCAN_CONVERT_ANALYTIC;
+            else if (!str::Eq(name, "sampled"))
+                return Usage();
+        } else if (str::Eq(argv[i], "-paint-bench")) {
+            paintBench = true;
+        } else if (str::Eq(argv[i], "-scale-bench")) {
+            scaleBench = true;
+        } else if ('-' == argv[i][0]) {
+            return Usage();
+        } else {
+            files.Append(argv[i]);
+        }
+    }
+    if (0 == files.size() && !paintBench && !scaleBench)
+        return Usage();
+    if (0 == opts.zooms.size())
+        opts.zooms.Append(DEFAULT_ZOOM);
+
+    fz_context* ctx = fz_new_context(nullptr, &gFitzLocksContext, FZ_STORE_DEFAULT);
+    if (!ctx) {
+        fprintf(stderr, "failed to initialize fitz\n");
+        return 1;
+    }
+    if (paintBench || scaleBench) {
+        int result = paintBench ? PaintBench(ctx, opts.repeat) : ScaleBench(ctx, opts.repeat);
+        fz_free_context(ctx);
+        return result;
+    }
+    if (fz_set_simd_level(simdLevel) != simdLevel)
+        fprintf(stderr, "warning: -simd %s isn't supported, using %s\n", gSimdLevelNames[simdLevel],
+                gSimdLevelNames[fz_simd_level()]);
+    // band contexts are cloned from ctx and inherit this
+    fz_set_scan_converter(ctx, scanConverter);
+    fz_register_document_handlers(ctx);
+    ddjvu_context_t* djvuCtx = ddjvu_context_create("render_unix");
+
+    bool ok = true;
+    str::Str<char> json;
+    json.Append("{\"files\":[");
+    for (size_t i = 0; i < files.size(); i++) {
+        if (i > 0)
+            json.Append(',');
+        ok = RenderFile(ctx, djvuCtx, files.at(i), opts, json) && ok;
+        // flush per document, so that results of long runs aren't lost on crashes
+        fputs(json.Get(), stdout);
+        fflush(stdout);
+        json.Reset();
+    }
+    puts("]}");
+
+    if (djvuCtx)
+        ddjvu_context_release(djvuCtx);
+    fz_free_context(ctx);
+    return ok ? 0 : 1;
+}
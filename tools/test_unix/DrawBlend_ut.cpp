@@ -0,0 +1,53 @@
+/* Copyright 2018 the SumatraPDF project authors (see AUTHORS file).
+   License: GPLv3 */
+
+extern "C" {
+#include <mupdf/fitz.h>
+#include "draw-imp.h"
+}
+
+#include "BaseUtil.h"
+
+// must be last due to assert() over-write
+#include "UtAssert.h"
+
+// blends a single source pixel onto a single backdrop pixel (both given as RGBA)
+// in a pixmap of colorspace cs and returns the result as RGBA
+static void BlendPixel(fz_context* ctx, fz_colorspace* cs, const unsigned char backdrop[4],
+                       const unsigned char source[4], int blendmode, unsigned char result[4]) {
+    bool isBgr = cs == fz_device_bgr(ctx);
+    fz_pixmap* dst = fz_new_pixmap(ctx, cs, 1, 1);
+    fz_pixmap* src = fz_new_pixmap(ctx, cs, 1, 1);
+    for (int i = 0; i < 4; i++) {
+        int j = isBgr && i != 1 && i != 3 ? 2 - i : i;
+        dst->samples[j] = backdrop[i];
+        src->samples[j] = source[i];
+    }
+    fz_blend_pixmap(dst, src, 255, blendmode, 1, nullptr);
+    for (int i = 0; i < 4; i++) {
+        int j = isBgr && i != 1 && i != 3 ? 2 - i : i;
+        result[i] = dst->samples[j];
+    }
+    fz_drop_pixmap(ctx, src);
+    fz_drop_pixmap(ctx, dst);
+}
+
+// the non-separable blend modes mix the color components, so blending into
+// a BGR pixmap must give the same colors as blending into an RGB pixmap
+void DrawBlendTest() {
+    fz_context* ctx = fz_new_context(nullptr, nullptr, FZ_STORE_DEFAULT);
+    const unsigned char backdrop[4] = {200, 40, 10, 255};
+    const unsigned char source[4] = {10, 60, 180, 255};
+    int blendmodes[] = {FZ_BLEND_HUE, FZ_BLEND_SATURATION, FZ_BLEND_COLOR, FZ_BLEND_LUMINOSITY, FZ_BLEND_MULTIPLY};
+    for (int i = 0; i < (int)dimof(blendmodes); i++) {
+        unsigned char rgb[4], bgr[4];
+        BlendPixel(ctx, fz_device_rgb(ctx), backdrop, source, blendmodes[i], rgb);
+        BlendPixel(ctx, fz_device_bgr(ctx), backdrop, source, blendmodes[i], bgr);
+        utassert(memcmp(rgb, bgr, sizeof(rgb)) == 0);
+    }
+    // luminosity keeps the backdrop's hue, so red remains the dominant component
+    unsigned char result[4];
+    BlendPixel(ctx, fz_device_bgr(ctx), backdrop, source, FZ_BLEND_LUMINOSITY, result);
+    utassert(result[0] > result[1] && result[0] > result[2]);
+    fz_free_context(ctx);
+}
@@ -0,0 +1,329 @@
+/* Copyright 2018 the SumatraPDF project authors (see AUTHORS file).
+   License: GPLv3 */
+
+extern "C" {
+#include <mupdf/pdf.h>
+}
+
+#include "BaseUtil.h"
+#include <string>
+
+// must be last due to assert() over-write
+#include "UtAssert.h"
+
+// a linearized document with two pages: the first page section consists of objects 5 (the
+// linearization dictionary) to 8 and has its own xref, the main xref at the end of the file
+// covers objects 1 (the page tree) to 4. There are no hint tables, so that objects of the
+// second page can only be found through the main xref (or by repairing it)
+static std::string MakeLinearizedPdf(bool breakMainXref) {
+    const char* firstPageObjs[] = {
+        "<< /Type /Catalog /Pages 1 0 R >>",
+        "<< /Type /Page /Parent 1 0 R /MediaBox [0 0 100 100] /Contents 8 0 R >>",
+        "<< /Length 15 >>\nstream\n0 0 m 10 10 l S\nendstream",
+    };
+    const char* mainObjs[] = {
+        "<< /Type /Pages /Count 2 /Kids [7 0 R 2 0 R] >>",
+        "<< /Type /Page /Parent 1 0 R /MediaBox [0 0 200 300] /Contents 3 0 R >>",
+        "<< /Length 15 >>\nstream\n0 0 m 20 30 l S\nendstream",
+        "null",
+    };
+    // /L and /Prev are fixed width, so that they can be filled in afterwards
+    std::string pdf = "%PDF-1.4\n";
+    int offsets[9] = {0};
+    offsets[5] = (int)pdf.size();
+    pdf += "5 0 obj\n<< /Linearized 1 /L 0000000000 /H [0 0] /O 7 /E 0 /N 2 /T 0 >>\nendobj\n";
+    int firstXref = (int)pdf.size();
+    pdf += "xref\n5 4\n";
+    size_t firstEntries = pdf.size();
+    pdf += std::string(4 * 20, ' ');
+    pdf += "trailer\n<< /Size 9 /Prev 0000000000 /Root 6 0 R >>\nstartxref\n0\n%%EOF\n";
+    for (int i = 0; i < 3; i++) {
+        offsets[6 + i] = (int)pdf.size();
+        AutoFree obj(str::Format("%d 0 obj\n%s\nendobj\n", 6 + i, firstPageObjs[i]));
+        pdf += obj.Get();
+    }
+    for (int i = 0; i < 4; i++) {
+        offsets[1 + i] = (int)pdf.size();
+        AutoFree obj(str::Format("%d 0 obj\n%s\nendobj\n", 1 + i, mainObjs[i]));
+        pdf += obj.Get();
+    }
+    int mainXref = (int)pdf.size();
+    // a broken main xref is neither an xref table nor an xref stream
+    pdf += breakMainXref ? "xerf\n0 5\n0000000000 65535 f \n" : "xref\n0 5\n0000000000 65535 f \n";
+    for (int i = 1; i <= 4; i++) {
+        AutoFree entry(str::Format("%010d 00000 n \n", offsets[i]));
+        pdf += entry.Get();
+    }
+    AutoFree tail(str::Format("trailer\n<< /Size 5 >>\nstartxref\n%d\n%%%%EOF\n", firstXref));
+    pdf += tail.Get();
+
+    for (int i = 0; i < 4; i++) {
+        AutoFree entry(str::Format("%010d 00000 n \n", offsets[5 + i]));
+        pdf.replace(firstEntries + 20 * i, 20, entry.Get());
+    }
+    AutoFree len(str::Format("%010d", (int)pdf.size()));
+    pdf.replace(pdf.find("/L ") + 3, 10, len.Get());
+    AutoFree prev(str::Format("%010d", mainXref));
+    pdf.replace(pdf.find("/Prev ") + 6, 10, prev.Get());
+    return pdf;
+}
+
+static void PdfLinearLoadTest(fz_context* ctx, bool breakMainXref) {
+    std::string data = MakeLinearizedPdf(breakMainXref);
+    fz_stream* stm = fz_open_memory(ctx, (unsigned char*)data.data(), (int)data.size());
+    pdf_document* doc = nullptr;
+    fz_try(ctx) {
+        doc = pdf_open_document_linear_with_stream(ctx, stm);
+    }
+    fz_catch(ctx) {
+        doc = nullptr;
+    }
+    utassert(doc);
+    if (!doc) {
+        fz_close(stm);
+        return;
+    }
+    // only the first page section has been read so far
+    utassert(doc->linear_obj && doc->file_reading_linearly);
+    utassert(pdf_count_pages(doc) == 2);
+
+    // the second page needs the main xref, which has to be repaired if it's broken
+    pdf_page* page = nullptr;
+    fz_try(ctx) {
+        page = pdf_load_page(doc, 1);
+    }
+    fz_catch(ctx) {
+        page = nullptr;
+    }
+    utassert(page);
+    if (page) {
+        fz_rect bounds;
+        pdf_bound_page(doc, page, &bounds);
+        utassert(bounds.x1 == 200 && bounds.y1 == 300);
+        pdf_free_page(doc, page);
+    }
+    utassert(!doc->file_reading_linearly);
+    utassert(doc->repair_attempted == breakMainXref);
+
+    // the first page is still available
+    page = nullptr;
+    fz_try(ctx) {
+        page = pdf_load_page(doc, 0);
+    }
+    fz_catch(ctx) {
+        page = nullptr;
+    }
+    utassert(page);
+    if (page) {
+        fz_rect bounds;
+        pdf_bound_page(doc, page, &bounds);
+        utassert(bounds.x1 == 100 && bounds.y1 == 100);
+        pdf_free_page(doc, page);
+    }
+
+    pdf_close_document(doc);
+    fz_close(stm);
+}
+
+// appends the lowest n bits of value to data (most significant bit first)
+static void AppendBits(std::string& data, int& bitPos, unsigned int value, int n) {
+    for (int i = n - 1; i >= 0; i--) {
+        if (bitPos % 8 == 0)
+            data += '\0';
+        if ((value >> i) & 1)
+            data[data.size() - 1] |= (char)(0x80 >> (bitPos % 8));
+        bitPos++;
+    }
+}
+
+// a linearized document with three pages and hint tables: the first page section consists of
+// objects 5 (the linearization dictionary) to 9, pages 2 and 3 are objects 1 and 3 (each
+// followed by its content stream) and the hint stream 10 follows them. The main xref is broken,
+// so that pages 2 and 3 (and their content) can only be found through the hint tables
+static std::string MakeHintedLinearizedPdf() {
+    const char* firstPageObjs[] = {
+        "<< /Type /Catalog /Pages 7 0 R >>",
+        "<< /Type /Pages /Count 3 /Kids [8 0 R 1 0 R 3 0 R] >>",
+        "<< /Type /Page /Parent 7 0 R /MediaBox [0 0 100 100] /Contents 9 0 R >>",
+        "<< /Length 15 >>\nstream\n0 0 m 10 10 l S\nendstream",
+    };
+    const char* pageObjs[] = {
+        "<< /Type /Page /Parent 7 0 R /MediaBox [0 0 200 300] /Contents 2 0 R >>",
+        "<< /Length 15 >>\nstream\n0 0 m 20 30 l S\nendstream",
+        "<< /Type /Page /Parent 7 0 R /MediaBox [0 0 400 500] /Contents 4 0 R >>",
+        "<< /Length 15 >>\nstream\n0 0 m 40 50 l S\nendstream",
+    };
+    // /L and /H are fixed width, so that they can be filled in afterwards
+    std::string pdf = "%PDF-1.4\n";
+    int offsets[11] = {0};
+    offsets[5] = (int)pdf.size();
+    pdf += "5 0 obj\n<< /Linearized 1 /L 0000000000 /H [0000000000 0000000000] /O 8 /E 0 /N 3 /T 0 >>\nendobj\n";
+    pdf += "xref\n5 6\n";
+    size_t firstEntries = pdf.size();
+    pdf += std::string(6 * 20, ' ');
+    pdf += "trailer\n<< /Size 11 /Root 6 0 R >>\nstartxref\n0\n%%EOF\n";
+    for (int i = 0; i < 4; i++) {
+        offsets[6 + i] = (int)pdf.size();
+        AutoFree obj(str::Format("%d 0 obj\n%s\nendobj\n", 6 + i, firstPageObjs[i]));
+        pdf += obj.Get();
+    }
+    for (int i = 0; i < 4; i++) {
+        offsets[1 + i] = (int)pdf.size();
+        AutoFree obj(str::Format("%d 0 obj\n%s\nendobj\n", 1 + i, pageObjs[i]));
+        pdf += obj.Get();
+    }
+
+    // cf. Annex F of the PDF 1.7 specification, only the items read by pdf_load_hints are
+    // filled in. Every page consists of two objects, the first page's length reaches from
+    // its page object to the second page's
+    int pageLens[3] = {offsets[1] - offsets[8], offsets[3] - offsets[1], (int)pdf.size() - offsets[3]};
+    std::string hints;
+    int bitPos = 0;
+    AppendBits(hints, bitPos, 2, 32);          // least number of objects in a page
+    AppendBits(hints, bitPos, offsets[8], 32); // location of the first page's page object
+    AppendBits(hints, bitPos, 1, 16);          // bits needed for the number of objects
+    AppendBits(hints, bitPos, 0, 32);          // least page length
+    AppendBits(hints, bitPos, 16, 16);         // bits needed for the page length
+    AppendBits(hints, bitPos, 0, 32 + 16 + 32 + 16);
+    AppendBits(hints, bitPos, 1, 16); // bits needed for the number of shared objects
+    AppendBits(hints, bitPos, 1, 16); // bits needed for a shared object identifier
+    AppendBits(hints, bitPos, 0, 16 + 16);
+    for (int i = 0; i < 3; i++) {
+        AppendBits(hints, bitPos, 0, 1);
+    }
+    bitPos = 0;
+    for (int i = 0; i < 3; i++) {
+        AppendBits(hints, bitPos, pageLens[i], 16);
+    }
+    bitPos = 0;
+    for (int i = 0; i < 3; i++) {
+        AppendBits(hints, bitPos, 0, 1);
+    }
+    // the shared object hint table (without any shared objects)
+    int sharedOffset = (int)hints.size();
+    bitPos = 0;
+    AppendBits(hints, bitPos, 0, 32 * 4);
+    AppendBits(hints, bitPos, 1, 16);
+    AppendBits(hints, bitPos, 0, 32);
+    AppendBits(hints, bitPos, 1, 16);
+
+    offsets[10] = (int)pdf.size();
+    AutoFree hintHead(str::Format("10 0 obj\n<< /S %d /Length %d >>\nstream\n", sharedOffset, (int)hints.size()));
+    pdf += hintHead.Get();
+    pdf += hints;
+    pdf += "\nendstream\nendobj\n";
+    int hintLen = (int)pdf.size() - offsets[10];
+
+    // a broken main xref is neither an xref table nor an xref stream
+    pdf += "xerf\n0 5\n0000000000 65535 f \n";
+    for (int i = 1; i <= 4; i++) {
+        AutoFree entry(str::Format("%010d 00000 n \n", offsets[i]));
+        pdf += entry.Get();
+    }
+    pdf += "trailer\n<< /Size 5 >>\nstartxref\n0\n%%EOF\n";
+
+    for (int i = 0; i < 6; i++) {
+        AutoFree entry(str::Format("%010d 00000 n \n", offsets[5 + i]));
+        pdf.replace(firstEntries + 20 * i, 20, entry.Get());
+    }
+    AutoFree len(str::Format("%010d", (int)pdf.size()));
+    pdf.replace(pdf.find("/L ") + 3, 10, len.Get());
+    AutoFree hint(str::Format("%010d %010d", offsets[10], hintLen));
+    pdf.replace(pdf.find("/H [") + 4, 21, hint.Get());
+    return pdf;
+}
+
+static void PdfLinearHintsTest(fz_context* ctx) {
+    std::string data = MakeHintedLinearizedPdf();
+    fz_stream* stm = fz_open_memory(ctx, (unsigned char*)data.data(), (int)data.size());
+    pdf_document* doc = nullptr;
+    fz_try(ctx) {
+        doc = pdf_open_document_linear_with_stream(ctx, stm);
+    }
+    fz_catch(ctx) {
+        doc = nullptr;
+    }
+    utassert(doc);
+    if (!doc) {
+        fz_close(stm);
+        return;
+    }
+    utassert(doc->linear_obj && doc->file_reading_linearly);
+    utassert(pdf_count_pages(doc) == 3);
+    utassert(!doc->hints_loaded);
+
+    // pdf_progressive_advance loads the hint tables (through pdf_load_hint_object_complete)
+    // and locates pages 3 and 2 without reading the main xref
+    float sizes[][2] = {{400, 500}, {200, 300}, {100, 100}};
+    for (int pageNo = 3; pageNo >= 1; pageNo--) {
+        pdf_obj* obj = nullptr;
+        pdf_page* page = nullptr;
+        fz_try(ctx) {
+            obj = pdf_progressive_advance(doc, pageNo - 1);
+            page = pdf_load_page_by_obj(doc, pageNo - 1, obj);
+        }
+        fz_catch(ctx) {
+            page = nullptr;
+        }
+        utassert(obj && pdf_to_num(obj) == (pageNo == 1 ? 8 : pageNo * 2 - 3));
+        utassert(page);
+        if (page) {
+            fz_rect bounds;
+            pdf_bound_page(doc, page, &bounds);
+            utassert(bounds.x1 == sizes[3 - pageNo][0] && bounds.y1 == sizes[3 - pageNo][1]);
+            // the content stream is also located through the hint tables
+            fz_device* dev = fz_new_bbox_device(ctx, &bounds);
+            fz_try(ctx) {
+                pdf_run_page(doc, page, dev, &fz_identity, nullptr);
+            }
+            fz_catch(ctx) {
+                utassert(false);
+            }
+            fz_free_device(dev);
+            pdf_free_page(doc, page);
+        }
+    }
+    utassert(doc->hints_loaded && doc->hint_page && doc->hint_obj_offsets);
+    utassert(doc->file_reading_linearly && !doc->repair_attempted);
+
+    pdf_close_document(doc);
+    fz_close(stm);
+}
+
+// ordinary documents are opened as before (without a warning about a missing linearization dictionary)
+static void PdfLinearOrdinaryTest(fz_context* ctx) {
+    std::string pdf = "%PDF-1.4\n";
+    int offsets[3];
+    offsets[1] = (int)pdf.size();
+    pdf += "1 0 obj\n<< /Type /Catalog /Pages 2 0 R >>\nendobj\n";
+    offsets[2] = (int)pdf.size();
+    pdf += "2 0 obj\n<< /Type /Pages /Count 0 /Kids [] >>\nendobj\n";
+    AutoFree xref(str::Format("xref\n0 3\n0000000000 65535 f \n%010d 00000 n \n%010d 00000 n \n"
+                              "trailer\n<< /Size 3 /Root 1 0 R >>\nstartxref\n%d\n%%%%EOF\n",
+                              offsets[1], offsets[2], (int)pdf.size()));
+    pdf += xref.Get();
+
+    fz_stream* stm = fz_open_memory(ctx, (unsigned char*)pdf.data(), (int)pdf.size());
+    pdf_document* doc = nullptr;
+    fz_try(ctx) {
+        doc = pdf_open_document_linear_with_stream(ctx, stm);
+    }
+    fz_catch(ctx) {
+        doc = nullptr;
+    }
+    utassert(doc);
+    if (doc) {
+        utassert(!doc->linear_obj && !doc->file_reading_linearly && !doc->repair_attempted);
+        pdf_close_document(doc);
+    }
+    fz_close(stm);
+}
+
+void PdfLinearTest() {
+    fz_context* ctx = fz_new_context(nullptr, nullptr, FZ_STORE_DEFAULT);
+    PdfLinearLoadTest(ctx, false);
+    PdfLinearLoadTest(ctx, true);
+    PdfLinearHintsTest(ctx);
+    PdfLinearOrdinaryTest(ctx);
+    fz_free_context(ctx);
+}
@@ -0,0 +1,84 @@
+/* Copyright 2018 the SumatraPDF project authors (see AUTHORS file).
+   License: GPLv3 */
+
+extern "C" {
+#include <mupdf/fitz.h>
+#include "draw-imp.h"
+}
+
+#include "BaseUtil.h"
+
+// must be last due to assert() over-write
+#include "UtAssert.h"
+
+#define COVERAGE_PIXMAP_SIZE 8
+
+// scan converts the polygon into an alpha-only pixmap (the same as the draw device does for
+// paths with a clip mask), which then contains the polygon's coverage of each pixel
+static fz_pixmap* FillPolygon(fz_context* ctx, const fz_point* pts, int count) {
+    fz_pixmap* pix = fz_new_pixmap(ctx, nullptr, COVERAGE_PIXMAP_SIZE, COVERAGE_PIXMAP_SIZE);
+    fz_clear_pixmap(ctx, pix);
+    fz_irect clip = {0, 0, COVERAGE_PIXMAP_SIZE, COVERAGE_PIXMAP_SIZE};
+    fz_gel* gel = fz_new_gel(ctx);
+    fz_reset_gel(gel, &clip);
+    for (int i = 0; i < count; i++) {
+        const fz_point& next = pts[(i + 1) % count];
+        fz_insert_gel(gel, pts[i].x, pts[i].y, next.x, next.y);
+    }
+    fz_sort_gel(gel);
+    fz_irect bbox;
+    fz_intersect_irect(fz_bound_gel(gel, &bbox), &clip);
+    fz_scan_convert(gel, 0, &bbox, pix, nullptr);
+    fz_free_gel(gel);
+    return pix;
+}
+
+static unsigned char CoverageAt(fz_pixmap* pix, int x, int y) {
+    return pix->samples[y * pix->w + x];
+}
+
+// compares the coverage of each pixel to the exact area covered by the rectangle
+static bool HasExactRectCoverage(fz_context* ctx, float x0, float y0, float x1, float y1) {
+    fz_point pts[] = {{x0, y0}, {x1, y0}, {x1, y1}, {x0, y1}};
+    fz_pixmap* pix = FillPolygon(ctx, pts, dimof(pts));
+    bool exact = true;
+    for (int y = 0; y < COVERAGE_PIXMAP_SIZE; y++) {
+        for (int x = 0; x < COVERAGE_PIXMAP_SIZE; x++) {
+            float dx = std::max(0.f, std::min(x1, x + 1.f) - std::max(x0, (float)x));
+            float dy = std::max(0.f, std::min(y1, y + 1.f) - std::max(y0, (float)y));
+            if (CoverageAt(pix, x, y) != (unsigned char)(dx * dy * 255 + 0.5f))
+                exact = false;
+        }
+    }
+    fz_drop_pixmap(ctx, pix);
+    return exact;
+}
+
+static void AnalyticCoverageTest(fz_context* ctx) {
+    fz_set_scan_converter(ctx, FZ_SCAN_CONVERT_ANALYTIC);
+    utassert(fz_scan_converter(ctx) == FZ_SCAN_CONVERT_ANALYTIC);
+
+    // pixel aligned, halves and quarters of pixels
+    utassert(HasExactRectCoverage(ctx, 1, 1, 5, 4));
+    utassert(HasExactRectCoverage(ctx, 0, 0, 2.5f, 1));
+    utassert(HasExactRectCoverage(ctx, 1.25f, 0.5f, 3.75f, 2.25f));
+
+    // the diagonal of a triangle halves the pixels it crosses
+    fz_point triangle[] = {{0, 0}, {2, 0}, {0, 2}};
+    fz_pixmap* pix = FillPolygon(ctx, triangle, dimof(triangle));
+    utassert(CoverageAt(pix, 0, 0) == 255);
+    utassert(CoverageAt(pix, 1, 0) == 128 && CoverageAt(pix, 0, 1) == 128);
+    utassert(CoverageAt(pix, 1, 1) == 0 && CoverageAt(pix, 2, 0) == 0);
+    fz_drop_pixmap(ctx, pix);
+
+    fz_set_scan_converter(ctx, FZ_SCAN_CONVERT_SAMPLED);
+}
+
+void ScanConverterTest() {
+    fz_context* ctx = fz_new_context(nullptr, nullptr, FZ_STORE_DEFAULT);
+    utassert(fz_scan_converter(ctx) == FZ_SCAN_CONVERT_SAMPLED);
+    // both converters fully cover pixels inside of pixel aligned paths
+    utassert(HasExactRectCoverage(ctx, 1, 1, 5, 4));
+    AnalyticCoverageTest(ctx);
+    fz_free_context(ctx);
+}
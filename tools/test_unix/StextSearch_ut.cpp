@@ -0,0 +1,130 @@
+/* Copyright 2018 the SumatraPDF project authors (see AUTHORS file).
+   License: GPLv3 */
+
+extern "C" {
+#include <mupdf/pdf.h>
+}
+
+#include "BaseUtil.h"
+#include <string>
+
+// must be last due to assert() over-write
+#include "UtAssert.h"
+
+// a single page with the text "Hello   World" on a first and "Second line" on a second line
+static std::string MakeTextPdf() {
+    const char* content = "BT /F1 12 Tf 10 80 Td (Hello   World) Tj 0 -20 Td (Second line) Tj ET";
+    AutoFree stream(str::Format("<< /Length %d >>\nstream\n%s\nendstream", (int)str::Len(content), content));
+    const char* objs[] = {
+        "<< /Type /Catalog /Pages 2 0 R >>",
+        "<< /Type /Pages /Count 1 /Kids [3 0 R] >>",
+        "<< /Type /Page /Parent 2 0 R /MediaBox [0 0 200 100] /Contents 4 0 R "
+        "/Resources << /Font << /F1 5 0 R >> >> >>",
+        stream.Get(),
+        "<< /Type /Font /Subtype /Type1 /BaseFont /Helvetica >>",
+    };
+    std::string pdf = "%PDF-1.4\n";
+    int offsets[dimof(objs)];
+    for (int i = 0; i < (int)dimof(objs); i++) {
+        offsets[i] = (int)pdf.size();
+        AutoFree obj(str::Format("%d 0 obj\n%s\nendobj\n", i + 1, objs[i]));
+        pdf += obj.Get();
+    }
+    int xref = (int)pdf.size();
+    AutoFree head(str::Format("xref\n0 %d\n0000000000 65535 f \n", (int)dimof(objs) + 1));
+    pdf += head.Get();
+    for (int i = 0; i < (int)dimof(objs); i++) {
+        AutoFree entry(str::Format("%010d 00000 n \n", offsets[i]));
+        pdf += entry.Get();
+    }
+    AutoFree tail(str::Format("trailer\n<< /Size %d /Root 1 0 R >>\nstartxref\n%d\n%%%%EOF\n", (int)dimof(objs) + 1,
+                              xref));
+    pdf += tail.Get();
+    return pdf;
+}
+
+// checks fz_search_text_index against fz_search_text_page and returns the number of hits
+static int SearchIndex(fz_context* ctx, fz_text_page* text, fz_text_index* index, const char* needle) {
+    fz_rect hits[8], pageHits[8];
+    int count = fz_search_text_index(ctx, index, needle, hits, dimof(hits));
+    int pageCount = fz_search_text_page(ctx, text, needle, pageHits, dimof(pageHits));
+    utassert(count == pageCount);
+    for (int i = 0; i < count && i < pageCount; i++) {
+        utassert(memcmp(&hits[i], &pageHits[i], sizeof(fz_rect)) == 0);
+    }
+    utassert((count > 0) == (fz_text_index_contains(ctx, index, needle) != 0));
+    return count;
+}
+
+static void StextSearchIndexTest(fz_context* ctx, fz_text_page* text) {
+    fz_text_index* index = fz_new_text_index(ctx, text);
+    // "Hello   World", "Second line" and a pseudo-newline after either line
+    utassert(index->len == 13 + 1 + 11 + 1);
+
+    // ASCII letters are matched case-insensitively
+    utassert(SearchIndex(ctx, text, index, "hello") == 1);
+    utassert(SearchIndex(ctx, text, index, "SECOND LINE") == 1);
+    // runs of whitespace match any amount of whitespace
+    utassert(SearchIndex(ctx, text, index, "hello world") == 1);
+    utassert(SearchIndex(ctx, text, index, "Hello \t World") == 1);
+    // whitespace doesn't match nothing
+    utassert(SearchIndex(ctx, text, index, "helloworld") == 0);
+    // a hit across a line break has one box per line
+    fz_rect hits[4];
+    utassert(SearchIndex(ctx, text, index, "world second") == 2);
+    utassert(fz_search_text_index(ctx, index, "world second", hits, dimof(hits)) == 2);
+    utassert(hits[0].y0 < hits[1].y0 && hits[0].x1 > hits[1].x1);
+    // hit_max limits the number of boxes
+    utassert(fz_search_text_index(ctx, index, "world second", hits, 1) == 1);
+    utassert(SearchIndex(ctx, text, index, "l") == 4);
+
+    utassert(SearchIndex(ctx, text, index, "missing") == 0);
+    utassert(SearchIndex(ctx, text, index, "lines") == 0);
+    utassert(SearchIndex(ctx, text, index, "") == 0);
+
+    fz_drop_text_index(ctx, index);
+}
+
+void StextSearchTest() {
+    fz_context* ctx = fz_new_context(nullptr, nullptr, FZ_STORE_DEFAULT);
+    std::string data = MakeTextPdf();
+    fz_stream* stm = fz_open_memory(ctx, (unsigned char*)data.data(), (int)data.size());
+    pdf_document* doc = nullptr;
+    pdf_page* page = nullptr;
+    fz_text_sheet* sheet = nullptr;
+    fz_text_page* text = nullptr;
+    fz_device* dev = nullptr;
+    fz_var(doc);
+    fz_var(page);
+    fz_var(sheet);
+    fz_var(text);
+    fz_var(dev);
+    fz_try(ctx) {
+        doc = pdf_open_document_with_stream(ctx, stm);
+        page = pdf_load_page(doc, 0);
+        sheet = fz_new_text_sheet(ctx);
+        text = fz_new_text_page(ctx);
+        dev = fz_new_text_device(ctx, sheet, text);
+        // the text device collects spans between fz_begin_page and fz_end_page
+        fz_rect bounds;
+        fz_begin_page(dev, pdf_bound_page(doc, page, &bounds), &fz_identity);
+        pdf_run_page(doc, page, dev, &fz_identity, nullptr);
+        fz_end_page(dev);
+    }
+    fz_catch(ctx) {
+        fz_free_text_page(ctx, text);
+        text = nullptr;
+    }
+    fz_free_device(dev);
+    utassert(text);
+    if (text) {
+        StextSearchIndexTest(ctx, text);
+        fz_free_text_page(ctx, text);
+    }
+    fz_free_text_sheet(ctx, sheet);
+    if (page)
+        pdf_free_page(doc, page);
+    pdf_close_document(doc);
+    fz_close(stm);
+    fz_free_context(ctx);
+}
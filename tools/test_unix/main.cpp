@@ -158,11 +158,28 @@ void testByteWriter() {
     utassert(buf[0] == 0);
 }
 
-extern void ByteOrderTests(); // ByteOrderDecoder_ut.cpp
-
-int main(int, char**) {
+extern void ByteOrderTests();    // ByteOrderDecoder_ut.cpp
+extern void WorkSchedulerTest(); // WorkScheduler_ut.cpp
+extern void WStrFinderTest();    // WStrFinder_ut.cpp
+extern void WStrFinderBenchmark();
+extern void PdfLinearTest(); // PdfLinear_ut.cpp
+extern void ScanConverterTest(); // ScanConverter_ut.cpp
+extern void StextSearchTest();   // StextSearch_ut.cpp
+extern void DrawBlendTest();     // DrawBlend_ut.cpp
+
+int main(int argc, char** argv) {
+    if (argc > 1 && str::Eq(argv[1], "-bench")) {
+        WStrFinderBenchmark();
+        return 0;
+    }
     testByteWriter();
     testTxtParser();
     ByteOrderTests();
+    WorkSchedulerTest();
+    WStrFinderTest();
+    PdfLinearTest();
+    ScanConverterTest();
+    StextSearchTest();
+    DrawBlendTest();
     utassert_print_results();
 }